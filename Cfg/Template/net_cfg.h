@@ -233,6 +233,16 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 *
 *               See also 'net_tmr.h  NETWORK TIMER TASK TIME DEFINES  Notes #1 & #2'
 *                      & 'net_tmr.c  NetTmr_Task()  Notes #1 & #2'.
+*
+*           (3) Configure NET_TMR_CFG_HI_RES_EN to enable high-resolution network timers.  High-resolution
+*               timers are kept in a separate deadline-ordered list handled at NET_TMR_CFG_HI_RES_FREQ so
+*               that TCP retransmit, delayed acknowledgement & transmit queue timers are NOT limited to the
+*               NET_TMR_CFG_TASK_FREQ period.
+*
+*               (a) NET_TMR_CFG_HI_RES_FREQ  MUST be an integer multiple of NET_TMR_CFG_TASK_FREQ & MUST
+*                   NOT be greater than the OS tick rate.
+*
+*               See also 'net_tmr.c  NetTmr_GetHiRes()  Note #2'.
 *********************************************************************************************************
 *********************************************************************************************************
 */
@@ -240,6 +250,13 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 #define  NET_TMR_CFG_NBR_TMR                    100u            /* Configure total number of TIMERs (see Note #1).      */
 #define  NET_TMR_CFG_TASK_FREQ                  10u             /* Configure Timer Task frequency   (see Note #2).      */
 
+                                                                /* Configure high-resolution timers (see Note #3) :     */
+#define  NET_TMR_CFG_HI_RES_EN                  DEF_DISABLED
+                                                                /*   DEF_DISABLED  High-res tmrs DISABLED               */
+                                                                /*   DEF_ENABLED   High-res tmrs ENABLED                */
+
+#define  NET_TMR_CFG_HI_RES_FREQ                1000u           /* Configure high-res timer frequency (see Note #3a).   */
+
 
 
 
@@ -266,6 +283,26 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                              NETWORK ADDRESS CACHE LAYER CONFIGURATION
+*
+* Note(s) : (1) Packets waiting on ARP or NDP address resolution are held in per-cache transmit queues,
+*               each bounded by NetARP_CfgCacheTxQ_MaxTh() / NetNDP_CfgCacheTxQ_MaxTh().
+*               NET_CACHE_CFG_TX_Q_PEND_MAX bounds the total number of packets held across ALL caches.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  NET_CACHE_CFG_TX_Q_PEND_MAX            16u             /* Configure max nbr of pkts pending addr resolution.   */
+
+#define  NET_CACHE_CFG_TX_Q_DROP_OLDEST_EN      DEF_DISABLED
+                                                                /* Configure pending pkt drop policy when Q full :      */
+                                                                /*   DEF_DISABLED      Drop newest pkt                  */
+                                                                /*   DEF_ENABLED       Drop oldest pkt                  */
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -293,6 +330,7 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 #define  NET_NDP_CFG_DEST_NBR                   5u              /* Configures number of NDP Destination cache entries.  */
 #define  NET_NDP_CFG_PREFIX_NBR                 5u              /* Configures number of NDP Prefix entries.             */
 #define  NET_NDP_CFG_ROUTER_NBR                 1u              /* Configures number of NDP Router entries.             */
+#define  NET_NDP_CFG_ROUTE_NBR                  5u              /* Configures number of NDP Route table entries.        */
 
 
 
@@ -317,6 +355,11 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 
 #define  NET_IPv4_CFG_IF_MAX_NBR_ADDR           1u              /* Configure maximum number of addresses per interface. */
 
+                                                                /* Configure IPv4 early demux to drop UDP/TCP pkts ...  */
+#define  NET_IPv4_CFG_EARLY_DEMUX_EN            DEF_DISABLED    /* ... for unbound ports before reassembly/chk sum.     */
+                                                                /*   DEF_DISABLED    IPv4 early demux disabled.         */
+                                                                /*   DEF_ENABLED     IPv4 early demux enabled.          */
+
 /*
 *********************************************************************************************************
 *                                                IPv6
@@ -340,6 +383,11 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 
 #define  NET_IPv6_CFG_IF_MAX_NBR_ADDR           2u              /* Configure maximum number of addresses per interface. */
 
+                                                                /* Configure IPv6 forwarding between interfaces.        */
+#define  NET_IPv6_CFG_FWD_EN                    DEF_DISABLED
+                                                                /*   DEF_DISABLED    IPv6 forwarding disabled.          */
+                                                                /*   DEF_ENABLED     IPv6 forwarding enabled.           */
+
 
 
 /*
@@ -357,6 +405,12 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
                                                                 /*   DEF_ENABLED     Multicast rx or tx enabled.        */
 
 #define  NET_MCAST_CFG_HOST_GRP_NBR_MAX         2u              /* Configure maximum number of Multicast groups.        */
+#define  NET_MCAST_CFG_SRC_NBR_MAX              4u              /* Configure maximum number of sources per group.       */
+
+                                                                /* Configure IGMPv3/MLDv2 source filtering :            */
+#define  NET_MCAST_CFG_SRC_FILTER_EN            DEF_DISABLED
+                                                                /*   DEF_DISABLED    IGMPv1/MLDv1 reports only.         */
+                                                                /*   DEF_ENABLED     IGMPv3/MLDv2 reports & src filter. */
 
 
 /*
@@ -413,6 +467,35 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
                                                                 /*   DEF_DISABLED  Socket select  DISABLED              */
                                                                 /*   DEF_ENABLED   Socket select  ENABLED               */
 
+                                                                /* Configure socket event poll functionality :          */
+#define  NET_SOCK_CFG_EVENT_POLL_EN             DEF_DISABLED
+                                                                /*   DEF_DISABLED  Socket event poll DISABLED           */
+                                                                /*   DEF_ENABLED   Socket event poll ENABLED            */
+                                                                /*                 (requires NET_SOCK_CFG_SEL_EN)       */
+
+#define  NET_SOCK_CFG_EVENT_POLL_NBR            1u              /* Configure number of socket event poll sets.          */
+
+                                                                /* Configure maximum number of data vector elements ... */
+#define  NET_SOCK_CFG_DATA_VEC_NBR_MAX          8u              /* ... per vectored socket tx/rx (sendmsg()/recvmsg()). */
+                                                                /* Configure maximum number of datagrams per batched... */
+#define  NET_SOCK_CFG_MSG_NBR_MAX               4u              /* ... socket tx/rx (sendmmsg()/recvmmsg()).            */
+
+                                                                /* Configure socket zero-copy transmit functionality :  */
+#define  NET_SOCK_CFG_TX_ZERO_COPY_EN           DEF_DISABLED
+                                                                /*   DEF_DISABLED  Zero-copy transmit DISABLED          */
+                                                                /*   DEF_ENABLED   Zero-copy transmit ENABLED           */
+
+                                                                /* Configure socket file transmit functionality :       */
+#define  NET_SOCK_CFG_TX_FILE_EN                DEF_DISABLED
+                                                                /*   DEF_DISABLED  File transmit DISABLED               */
+                                                                /*   DEF_ENABLED   File transmit ENABLED                */
+                                                                /*                 (requires TCP)                       */
+
+                                                                /* Configure socket local port sharing (SO_REUSEPORT) : */
+#define  NET_SOCK_CFG_REUSE_PORT_EN             DEF_DISABLED
+                                                                /*   DEF_DISABLED  Port sharing DISABLED                */
+                                                                /*   DEF_ENABLED   Port sharing ENABLED                 */
+
                                                                 /* Configure stream-type sockets' accept queue          */
 #define  NET_SOCK_CFG_CONN_ACCEPT_Q_SIZE_MAX    2u              /* maximum size. (See Note # 1)                         */
 
@@ -471,6 +554,73 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
                                                                 /*   DEF_DISABLED  TCP layer  DISABLED                  */
                                                                 /*   DEF_ENABLED   TCP layer  ENABLED                   */
 
+                                                                /* Configure TCP window scale option (RFC #7323) :      */
+#define  NET_TCP_CFG_WIN_SCALE_EN               DEF_DISABLED
+                                                                /*   DEF_DISABLED  Window scaling DISABLED              */
+                                                                /*   DEF_ENABLED   Window scaling ENABLED               */
+
+                                                                /* Configure TCP receive window auto-tuning :           */
+#define  NET_TCP_CFG_RX_WIN_AUTO_TUNE_EN        DEF_DISABLED
+                                                                /*   DEF_DISABLED  Rx window auto-tuning DISABLED       */
+                                                                /*   DEF_ENABLED   Rx window auto-tuning ENABLED        */
+
+                                                                /* Configure TCP SYN cache & SYN cookies :              */
+#define  NET_TCP_CFG_SYN_CACHE_EN               DEF_DISABLED
+                                                                /*   DEF_DISABLED  SYN cache DISABLED                   */
+                                                                /*   DEF_ENABLED   SYN cache ENABLED                    */
+
+                                                                /* Configure TCP transmit cork & MSG_MORE :             */
+#define  NET_TCP_CFG_TX_CORK_EN                 DEF_DISABLED
+                                                                /*   DEF_DISABLED  Tx cork DISABLED                     */
+                                                                /*   DEF_ENABLED   Tx cork ENABLED                      */
+
+                                                                /* Configure TCP RACK-TLP loss detection (RFC #8985) :  */
+#define  NET_TCP_CFG_RACK_EN                    DEF_DISABLED
+                                                                /*   DEF_DISABLED  RACK-TLP DISABLED                    */
+                                                                /*   DEF_ENABLED   RACK-TLP ENABLED                     */
+
+                                                                /* Configure TCP transmit pacing :                      */
+#define  NET_TCP_CFG_TX_PACE_EN                 DEF_DISABLED
+                                                                /*   DEF_DISABLED  Tx pacing DISABLED                   */
+                                                                /*   DEF_ENABLED   Tx pacing ENABLED                    */
+
+                                                                /* Configure TCP explicit congestion notification ...   */
+                                                                /* ... (ECN, RFC #3168) :                               */
+#define  NET_TCP_CFG_ECN_EN                     DEF_DISABLED
+                                                                /*   DEF_DISABLED  ECN DISABLED                         */
+                                                                /*   DEF_ENABLED   ECN ENABLED                          */
+
+                                                                /* Configure TCP Fast Open (TFO, RFC #7413) :           */
+#define  NET_TCP_CFG_FAST_OPEN_EN               DEF_DISABLED
+                                                                /*   DEF_DISABLED  TFO DISABLED                         */
+                                                                /*   DEF_ENABLED   TFO ENABLED                          */
+
+                                                                /* Configure TCP path MTU discovery (RFC #1191, ...     */
+                                                                /* ... RFC #8201 & RFC #4821) :                         */
+#define  NET_TCP_CFG_PATH_MTU_EN                DEF_DISABLED
+                                                                /*   DEF_DISABLED  Path MTU discovery DISABLED          */
+                                                                /*   DEF_ENABLED   Path MTU discovery ENABLED           */
+
+                                                                /* Configure TCP compact TIME-WAIT handling :           */
+#define  NET_TCP_CFG_TIME_WAIT_COMPACT_EN       DEF_DISABLED
+                                                                /*   DEF_DISABLED  TIME-WAIT held by TCP conns          */
+                                                                /*   DEF_ENABLED   TIME-WAIT held in time-wait tbl      */
+
+                                                                /* Configure TCP adaptive delayed acks :                */
+#define  NET_TCP_CFG_ACK_ADAPT_EN               DEF_DISABLED
+                                                                /*   DEF_DISABLED  Ack every 2nd seg (or on ack dly)    */
+                                                                /*   DEF_ENABLED   Quick-ack & ack decimation           */
+
+                                                                /* Configure TCP re-tx Q seq nbr idx :                  */
+#define  NET_TCP_CFG_RE_TX_Q_IDX_EN             DEF_DISABLED
+                                                                /*   DEF_DISABLED  Re-tx Q walked from head on ack      */
+                                                                /*   DEF_ENABLED   Re-tx Q idx'd by seq nbr             */
+
+                                                                /* Configure TCP random ISN hash :                      */
+#define  NET_TCP_CFG_ISN_SIPHASH_EN             DEF_DISABLED
+                                                                /*   DEF_DISABLED  ISN hashed by MD5                    */
+                                                                /*   DEF_ENABLED   ISN hashed by keyed SipHash-2-4      */
+
 /* ========================================= ADVANCED TCP LAYER CONFIGURATION ========================================= */
 /* By default TCP RX and TX windows are set to equal the socket RX and TX queue sizes. Default values can be changed by */
 /* redefining the following defines. TCP windows must be properly configured to optimize performance (see note about    */
@@ -479,6 +629,32 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 /*     #define  NET_TCP_DFLT_RX_WIN_SIZE_OCTET      NET_SOCK_CFG_RX_Q_SIZE_OCTET                                        */
 /*     #define  NET_TCP_DFLT_TX_WIN_SIZE_OCTET      NET_SOCK_CFG_TX_Q_SIZE_OCTET                                        */
 /*                                                                                                                      */
+/* When receive window auto-tuning is enabled, each TCP connection's receive window grows from its configured size up  */
+/* to the following per-connection maximum as the application drains data. The total growth of ALL connections is     */
+/* bounded by the following global maximum. Note that windows larger than 65535 octets require window scaling.         */
+/*                                                                                                                      */
+/*     #define  NET_TCP_DFLT_RX_WIN_AUTO_TUNE_MAX_OCTET      (NET_TCP_DFLT_RX_WIN_SIZE_OCTET * 4u)                      */
+/*     #define  NET_TCP_DFLT_RX_WIN_AUTO_TUNE_TOT_MAX_OCTET  NET_TCP_DFLT_RX_WIN_AUTO_TUNE_MAX_OCTET                    */
+/*                                                                                                                      */
+/* When the SYN cache is enabled, connection requests received by listening sockets are held in a compact table until   */
+/* the three-way handshake completes; TCP connections are allocated ONLY for completed handshakes. When the table is    */
+/* full, SYN cookies are used instead. The number of SYN cache entries can be changed by redefining the following :     */
+/*                                                                                                                      */
+/*     #define  NET_TCP_DFLT_SYN_CACHE_NBR_ENTRY  (NET_SOCK_CFG_SOCK_NBR_TCP * NET_SOCK_CFG_CONN_ACCEPT_Q_SIZE_MAX)     */
+/*                                                                                                                      */
+/* When TCP Fast Open is enabled, the cookies received from remote servers are held in a client cookie cache so that    */
+/* subsequent connections to the same server can carry data in their SYN. The number of cached server cookies can be    */
+/* changed by redefining the following :                                                                                */
+/*                                                                                                                      */
+/*     #define  NET_TCP_DFLT_FAST_OPEN_CACHE_NBR_ENTRY       8u                                                         */
+/*                                                                                                                      */
+/* When path MTU discovery is enabled, the path MTUs learned from ICMP messages & from black-hole detection are held in */
+/* a per-remote-host cache so that new connections start at the discovered segment size. Cached path MTUs expire, and   */
+/* connections probe for a larger path MTU, after the following timeout. Both values can be changed by redefining :     */
+/*                                                                                                                      */
+/*     #define  NET_TCP_DFLT_PATH_MTU_CACHE_NBR_ENTRY        8u                                                         */
+/*     #define  NET_TCP_DFLT_PATH_MTU_TIMEOUT_SEC          600u                                                         */
+/*                                                                                                                      */
 /* As shown in the TCP state diagram (see RFC #793), before moving from 'TIME-WAIT' state to 'CLOSED' state a timeout   */
 /* (2MSL) must expire. This means that the TCP connection cannot be made available for subsequent TCP connections until */
 /* this timeout. It can be a problem for embedded systems with low resources especially when many TCP connections are   */
@@ -490,6 +666,20 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 /*                                                                                                                      */
 /*     #define  NET_TCP_DFLT_TIMEOUT_CONN_MAX_SEG_SEC       0u                                                          */
 /*                                                                                                                      */
+/* When compact TIME-WAIT handling is enabled, connections that reach the 'TIME-WAIT' state with a non-zero MSL are     */
+/* freed immediately & only their addresses & sequence numbers are held in a time-wait table until the 2MSL timeout     */
+/* expires. Connections keep the full 'TIME-WAIT' state if the table is full. The number of time-wait entries can be    */
+/* changed by redefining the following :                                                                                */
+/*                                                                                                                      */
+/*     #define  NET_TCP_DFLT_TIME_WAIT_NBR_ENTRY            16u                                                         */
+/*                                                                                                                      */
+/* When the TCP re-transmit queue index is enabled, each connection indexes its re-transmit queue segments by sequence  */
+/* number so that received acknowledgements find & release acknowledged segments without walking the queue. Segments    */
+/* beyond the index size are walked as before until the index is rebuilt. The number of indexed segments per connection */
+/* can be changed by redefining the following :                                                                         */
+/*                                                                                                                      */
+/*     #define  NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY          32u                                                         */
+/*                                                                                                                      */
 /* To avoid leaving a connection in the FIN_WAIT_2 state forever when a connection moves from the 'FIN_WAIT_1' state to */
 /* the FIN_WAIT_2, the TCP connection's timer is set to 15 second, and when it expires the connection is dropped. Thus, */
 /* if the other host doesn't response to the close request, the connection will still be closed after the timeout.      */
@@ -537,6 +727,13 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 /*                                                                                                                      */
 /*     #define  NET_TCP_CFG_RANDOM_ISN_GEN                                                                              */
 /*                                                                                                                      */
+/* When NET_TCP_CFG_ISN_SIPHASH_EN is enabled, F is a SipHash-2-4 keyed hash of the four-tuple instead of MD5. SipHash  */
+/* processes the four-tuple in a few 64-bit rounds & is much faster than MD5 on small micro-controllers. Its 128-bit    */
+/* key is separate from the secret key used by SYN & TCP Fast Open cookies & is regenerated every rekey period.         */
+/* Rekeying can be disabled by setting the following to 0 :                                                             */
+/*                                                                                                                      */
+/*     #define  NET_TCP_DFLT_ISN_REKEY_TIME_SEC           3600u                                                         */
+/*                                                                                                                      */
 /* ==================================================================================================================== */
 
 
@@ -119,6 +119,9 @@
 #define  NET_IF_TX_SUSPEND_TIMEOUT_MIN_MS                  0
 #define  NET_IF_TX_SUSPEND_TIMEOUT_MAX_MS                100
 
+                                                                /* Max nbr of zero-copy tx pkt gather vec segs ...      */
+#define  NET_IF_TX_VEC_NBR_MAX                             3u   /* ... (see 'NetIF_TxPktDataExtPrepare()  Note #2').    */
+
 
 /*
 *********************************************************************************************************
@@ -262,6 +265,13 @@ static  NET_BUF_SIZE   NetIF_TxPkt                      (       NET_IF
                                                                 NET_BUF            *p_buf,
                                                                 NET_ERR            *p_err);
 
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+static  CPU_INT16U     NetIF_TxPktDataExtPrepare        (       NET_IF             *p_if,
+                                                                NET_BUF            *p_buf,
+                                                                NET_BUF_DATA_VEC   *p_vec,
+                                                                NET_ERR            *p_err);
+#endif
+
 #if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
      (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
 static  void           NetIF_TxPktValidate              (       NET_IF             *p_if,
@@ -7246,6 +7256,12 @@ static  void  NetIF_TxHandler (NET_BUF  *p_buf,
 *               (3) Network buffer already freed by lower layer.
 *
 *               (4) Error codes from network interface/device driver handler functions returned as is.
+*
+*               (5) Zero-copy transmit packets are transmitted via the device's gather transmit, if
+*                   available; otherwise their referenced application data is copied into the packet
+*                   buffer immediately before transmit.
+*
+*                   See also 'NetIF_TxPktDataExtPrepare()  Note #1'.
 *********************************************************************************************************
 */
 
@@ -7253,12 +7269,19 @@ static  NET_BUF_SIZE  NetIF_TxPkt (NET_IF   *p_if,
                                    NET_BUF  *p_buf,
                                    NET_ERR  *p_err)
 {
-    NET_IF_API    *p_if_api;
-    NET_DEV_API   *pdev_api;
-    NET_BUF_HDR   *p_buf_hdr;
-    CPU_INT08U    *p_data;
-    NET_BUF_SIZE   size;
-    NET_ERR        err;
+    NET_IF_API         *p_if_api;
+    NET_DEV_API        *pdev_api;
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+#ifdef  NET_IF_ETHER_MODULE_EN
+    NET_DEV_API_ETHER  *p_dev_api_ether;
+#endif
+    NET_BUF_DATA_VEC    vec[NET_IF_TX_VEC_NBR_MAX];
+    CPU_INT16U          vec_nbr;
+#endif
+    NET_BUF_HDR        *p_buf_hdr;
+    CPU_INT08U         *p_data;
+    NET_BUF_SIZE        size;
+    NET_ERR             err;
 
 
 
@@ -7325,6 +7348,21 @@ static  NET_BUF_SIZE  NetIF_TxPkt (NET_IF   *p_if,
 
 
                                                                 /* ------------ PREPARE TX PKT VIA NET DEV ------------ */
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+    vec_nbr = 0u;
+    if (p_buf_hdr->DataExtRefPtr != DEF_NULL) {                 /* If pkt refs app data, prepare pkt (see Note #5).     */
+        vec_nbr = NetIF_TxPktDataExtPrepare(p_if, p_buf, &vec[0], p_err);
+        if (*p_err != NET_IF_ERR_NONE) {
+             NetIF_TxPktDiscard(p_buf, DEF_NO, &err);
+            *p_err = NET_ERR_TX;
+             return (0u);
+        }
+    }
+#ifndef NET_IF_ETHER_MODULE_EN
+   (void)&vec_nbr;                                              /* Prevent 'variable unused' compiler warning.          */
+#endif
+#endif
+
     p_data = &p_buf->DataPtr[p_buf_hdr->IF_HdrIx];
     size   =  p_buf_hdr->TotLen;
     DEF_BIT_SET(p_buf_hdr->Flags, NET_BUF_FLAG_TX_LOCK);         /* Protect tx pkt buf from concurrent access by dev hw. */
@@ -7333,7 +7371,17 @@ static  NET_BUF_SIZE  NetIF_TxPkt (NET_IF   *p_if,
 
                                                                 /* ---------------- TX PKT VIA NET DEV ---------------- */
     pdev_api = (NET_DEV_API *)p_if->Dev_API;
+#if (defined(NET_SOCK_TX_ZERO_COPY_MODULE_EN) && \
+     defined(NET_IF_ETHER_MODULE_EN))
+    if (vec_nbr > 0u) {                                         /* Tx pkt via dev gather tx (see Note #5).              */
+        p_dev_api_ether = (NET_DEV_API_ETHER *)p_if->Dev_API;
+        p_dev_api_ether->TxVec(p_if, &vec[0], vec_nbr, p_err);
+    } else {
+        pdev_api->Tx(p_if, p_data, size, p_err);
+    }
+#else
     pdev_api->Tx(p_if, p_data, size, p_err);
+#endif
     if (*p_err != NET_DEV_ERR_NONE) {
          NetIF_TxPktListRemove(p_buf);                           /* See Note #2a.                                        */
          NetIF_TxPktDiscard(p_buf, DEF_NO, &err);
@@ -7349,6 +7397,104 @@ static  NET_BUF_SIZE  NetIF_TxPkt (NET_IF   *p_if,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetIF_TxPktDataExtPrepare()
+*
+* Description : Prepare a zero-copy transmit packet for the network device :
+*
+*                   (a) Describe the packet as a gather vector, if the device supports gather transmit
+*                   (b) Copy the packet's referenced application data into its buffer, otherwise
+*
+*
+* Argument(s) : p_if        Pointer to network interface to transmit the packet.
+*               ----        Argument validated in NetIF_TxHandler().
+*
+*               p_buf       Pointer to network buffer data packet to transmit.
+*               -----       Argument checked   in NetIF_Tx().
+*
+*               p_vec       Pointer to an array of NET_IF_TX_VEC_NBR_MAX data segments that will receive
+*                               the packet's gather vector.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IF_ERR_NONE                 Packet successfully prepared.
+*
+*                                                               ------ RETURNED BY NetBuf_DataExtCopy() : ------
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length (outside buffer's DATA area).
+*
+* Return(s)   : Number of gather vector segments, if packet to transmit via device gather transmit.
+*
+*               0,                                otherwise.
+*
+* Caller(s)   : NetIF_TxPkt().
+*
+* Note(s)     : (1) Only Ethernet devices that define the optional gather transmit API function support
+*                   gather transmit (see 'net_if_ether.h  ETHERNET DEVICE API DATA TYPES  Note #2').
+*
+*               (2) The gather vector describes the packet's protocol headers, its referenced application
+*                   data & any DATA area octets after the referenced data (e.g. Ethernet frame pad octets).
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+static  CPU_INT16U  NetIF_TxPktDataExtPrepare (NET_IF            *p_if,
+                                               NET_BUF           *p_buf,
+                                               NET_BUF_DATA_VEC  *p_vec,
+                                               NET_ERR           *p_err)
+{
+#ifdef  NET_IF_ETHER_MODULE_EN
+    NET_DEV_API_ETHER  *p_dev_api;
+    CPU_INT16U          ext_ix_end;
+    CPU_INT16U          tot_ix_end;
+    CPU_INT16U          vec_nbr;
+#endif
+    NET_BUF_HDR        *p_buf_hdr;
+
+
+    p_buf_hdr = &p_buf->Hdr;
+
+#ifdef  NET_IF_ETHER_MODULE_EN
+    if (p_if->Type == NET_IF_TYPE_ETHER) {                      /* If dev supports gather tx (see Note #1), ...         */
+        p_dev_api = (NET_DEV_API_ETHER *)p_if->Dev_API;
+        if (p_dev_api->TxVec != DEF_NULL) {                     /* ... describe pkt as gather vec (see Note #2).        */
+            ext_ix_end = p_buf_hdr->DataExtIx + p_buf_hdr->DataExtLen;
+            tot_ix_end = p_buf_hdr->IF_HdrIx  + (CPU_INT16U)p_buf_hdr->TotLen;
+
+            p_vec[0].DataPtr = (void *)&p_buf->DataPtr[p_buf_hdr->IF_HdrIx];
+            p_vec[0].DataLen =  p_buf_hdr->DataExtIx - p_buf_hdr->IF_HdrIx;
+            p_vec[1].DataPtr = (void *) p_buf_hdr->DataExtPtr;
+            p_vec[1].DataLen =  p_buf_hdr->DataExtLen;
+            vec_nbr          =  2u;
+
+            if (tot_ix_end > ext_ix_end) {
+                p_vec[2].DataPtr = (void *)&p_buf->DataPtr[ext_ix_end];
+                p_vec[2].DataLen =  tot_ix_end - ext_ix_end;
+                vec_nbr++;
+            }
+
+           *p_err = NET_IF_ERR_NONE;
+            return (vec_nbr);
+        }
+    }
+#else
+   (void)&p_if;                                                 /* Prevent 'variable unused' compiler warning.          */
+   (void)&p_vec;
+#endif
+
+    NetBuf_DataExtCopy(p_buf, p_err);                           /* Else copy ref'd data into buf.                       */
+    if (*p_err != NET_BUF_ERR_NONE) {
+         return (0u);
+    }
+
+   *p_err = NET_IF_ERR_NONE;
+
+    return (0u);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         NetIF_TxPktValidate()
@@ -255,7 +255,21 @@ typedef  struct net_dev_link_state_ether {
 *                   NOT require a specific API's functionality MUST define an empty API function which
 *                   may need to return an appropriate error code.
 *
+*                   However, the optional gather transmit function 'TxVec()' MAY be NULL (see Note #2).
+*
 *               See also 'net_if.h  GENERIC NETWORK DEVICE API DATA TYPE  Note #1'.
+*
+*           (2) (a) Devices that support gather DMA MAY define 'TxVec()' to transmit a frame described by an
+*                   array of data segments; the network interface layer uses it to transmit zero-copy
+*                   packets whose application data is referenced in place rather than copied into the
+*                   network buffer (see 'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES').
+*
+*               (b) The first segment ALWAYS starts at the frame's Ethernet header & is the address that the
+*                   device MUST post to NetIF_TxDeallocQPost() once the frame has been transmitted, exactly
+*                   as for 'Tx()'.
+*
+*               (c) Devices without gather DMA leave 'TxVec()' NULL; zero-copy packets are then copied into
+*                   their network buffer immediately before 'Tx()'.
 *********************************************************************************************************
 */
 
@@ -317,6 +331,12 @@ typedef  struct  net_dev_api_ether {
                                  CPU_INT08U           phy_addr,
                                  CPU_INT08U           reg_addr,
                                  CPU_INT16U           reg_data,
+                                 NET_ERR             *p_err);
+
+                                                                        /*   Gather tx (optional; see Note #2)          */
+    void  (*TxVec)              (NET_IF              *pif,
+                                 NET_BUF_DATA_VEC    *p_vec,
+                                 CPU_INT16U           vec_nbr,
                                  NET_ERR             *p_err);
 } NET_DEV_API_ETHER;
 
@@ -727,6 +727,14 @@ NET_BUF_SIZE  NetIF_Loopback_Tx (NET_IF   *p_if,
              return (0u);
     }
 
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+    NetBuf_DataExtCopy(p_buf_tx, &err);                                 /* Copy any ref'd app data into tx buf.         */
+    if (err != NET_BUF_ERR_NONE) {
+        NetBuf_Free(p_buf_rx);                                          /* See Note #3b.                                */
+        NetIF_Loopback_TxPktDiscard(p_buf_tx, p_err);
+        return (0u);
+    }
+#endif
                                                                         /* Copy tx loopback pkt into rx loopback buf.   */
     NetBuf_DataCopy((NET_BUF    *) p_buf_rx,
                     (NET_BUF    *) p_buf_tx,
@@ -373,6 +373,8 @@ void  NetARP_Init (NET_ERR  *p_err)
     NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_ARP] = (NET_CACHE_ADDR *)0;
     NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_ARP] = (NET_CACHE_ADDR *)0;
 
+    NetCache_TxQ_PendNbr = 0u;                                  /* Init global pending tx Q cnt.                        */
+
    *p_err = NET_ARP_ERR_NONE;
 }
 
@@ -1005,6 +1007,8 @@ exit:
 *                           NET_BUF_ERR_NONE_AVAIL              ARP buffer threshold is greater than number
 *                                                                   of configured transmit buffers for current
 *                                                                   interface.
+*                           NET_CACHE_ERR_UNRESOLVED            ARP cache pending transmit queue full;
+*                                                                   transmit buffer NOT enqueued.
 *
 *                           ----------------------- RETURNED BY NetIF_Get() -----------------------
 *                           See NetIF_Get() for additional return error codes.
@@ -1072,8 +1076,6 @@ void  NetARP_CacheHandler (NET_BUF  *p_buf,
     CPU_INT08U          *p_addr_hw;
     CPU_INT08U          *p_addr_protocol;
     NET_BUF_HDR         *p_buf_hdr;
-    NET_BUF_HDR         *ptail_buf_hdr;
-    NET_BUF             *ptail_buf;
     NET_ARP_CACHE       *p_cache;
     NET_CACHE_ADDR_ARP  *p_cache_addr_arp;
     NET_BUF_QTY          buf_max_th;
@@ -1140,33 +1142,16 @@ void  NetARP_CacheHandler (NET_BUF  *p_buf,
                      return;
                  }
 
-                 if (p_cache_addr_arp->TxQ_Nbr >= buf_max_th) {
-                    *p_err = NET_CACHE_ERR_UNRESOLVED;
+                                                                /* Q buf to ARP cache's bounded pending tx Q.           */
+                 NetCache_TxQ_Add((NET_CACHE_ADDR *)p_cache_addr_arp,
+                                                    p_buf,
+                                                    buf_max_th,
+                                                    p_err);
+                 if (*p_err != NET_CACHE_ERR_NONE) {
                      return;
                  }
 
-                 ptail_buf = p_cache_addr_arp->TxQ_Tail;
-                 if (ptail_buf != (NET_BUF *)0) {               /* If Q NOT empty,    append buf @ Q tail.              */
-                     ptail_buf_hdr                 = &ptail_buf->Hdr;
-                     ptail_buf_hdr->NextSecListPtr = (NET_BUF *)p_buf;
-                     p_buf_hdr->PrevSecListPtr      = (NET_BUF *)ptail_buf;
-                     p_cache_addr_arp->TxQ_Tail     = (NET_BUF *)p_buf;
-
-                 } else {                                       /* Else add buf as first q'd buf.                       */
-                     p_cache_addr_arp->TxQ_Head     = (NET_BUF *)p_buf;
-                     p_cache_addr_arp->TxQ_Tail     = (NET_BUF *)p_buf;
-#if 0                                                           /* Init'd in NetBuf_Get() [see Note #5].                */
-                     p_buf_hdr->PrevSecListPtr      = (NET_BUF *)0;
-                     p_buf_hdr->NextSecListPtr      = (NET_BUF *)0;
-#endif
-                 }
-
-                 p_cache_addr_arp->TxQ_Nbr++;
-                                                                /* Cfg buf's unlink fnct/obj to ARP cache.              */
-                 p_buf_hdr->UnlinkFnctPtr = (NET_BUF_FNCT)&NetCache_UnlinkBuf;
-                 p_buf_hdr->UnlinkObjPtr  = (void       *) p_cache_addr_arp;
-
-                *p_err                    =  NET_ARP_ERR_CACHE_PEND;
+                *p_err = NET_ARP_ERR_CACHE_PEND;
                  break;
 
 
@@ -1978,6 +1963,8 @@ void  NetARP_TxReq (NET_CACHE_ADDR_ARP  *p_cache_addr_arp)
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_ARP_ERR_CACHE_PEND              ARP cache added in 'PENDING' state.
+*                               NET_CACHE_ERR_UNRESOLVED            ARP cache added in 'PENDING' state but
+*                                                                       buffer NOT enqueued (see Note #5).
 *
 *                                                                   -- RETURNED BY NetCache_CfgAddrs() : --
 *                               NET_CACHE_ERR_NONE_AVAIL            NO available ARP caches to allocate.
@@ -2009,6 +1996,10 @@ void  NetARP_TxReq (NET_CACHE_ADDR_ARP  *p_cache_addr_arp)
 *               (4) Some buffer controls were previously initialized in NetBuf_Get() when the packet
 *                   was received at the network interface layer.  These buffer controls do NOT need
 *                   to be re-initialized but are shown for completeness.
+*
+*               (5) If the global pending transmit buffer maximum is reached, the ARP cache is still
+*                   added & the ARP request still transmitted, but the buffer is NOT enqueued & MUST
+*                   be discarded by the caller (see 'net_cache.c  NetCache_TxQ_Add()  Note #3b').
 *********************************************************************************************************
 */
 void  NetARP_CacheAddPend (NET_BUF      *p_buf,
@@ -2021,6 +2012,8 @@ void  NetARP_CacheAddPend (NET_BUF      *p_buf,
     CPU_INT08U           addr_protocol_sender[NET_IPv4_ADDR_SIZE];
     NET_IF_NBR           if_nbr;
     NET_TMR_TICK         timeout_tick;
+    NET_BUF_QTY          buf_max_th;
+    NET_ERR              err_q;
     CPU_SR_ALLOC();
 
                                                                 /* ------------------ CFG ARP CACHE ------------------- */
@@ -2049,18 +2042,18 @@ void  NetARP_CacheAddPend (NET_BUF      *p_buf,
         return;
     }
 
-                                                                /* Cfg buf's unlink fnct/obj to ARP cache.              */
-    p_buf_hdr->UnlinkFnctPtr  = (NET_BUF_FNCT)NetCache_UnlinkBuf;
-    p_buf_hdr->UnlinkObjPtr   = (void       *)p_cache_addr_arp;
-
 #if 0                                                           /* Init'd in NetBuf_Get() [see Note #4].                */
     p_buf_hdr->PrevSecListPtr = (NET_BUF *)0;
     p_buf_hdr->NextSecListPtr = (NET_BUF *)0;
 #endif
                                                                 /* Q buf to ARP cache (see Note #3a1).                  */
-    p_cache_addr_arp->TxQ_Head         = (NET_BUF *)p_buf;
-    p_cache_addr_arp->TxQ_Tail         = (NET_BUF *)p_buf;
-    p_cache_addr_arp->TxQ_Nbr++;
+    CPU_CRITICAL_ENTER();
+    buf_max_th = NetARP_CacheTxQ_MaxTh_nbr;
+    CPU_CRITICAL_EXIT();
+    NetCache_TxQ_Add((NET_CACHE_ADDR *)p_cache_addr_arp,
+                                       p_buf,
+                                       buf_max_th,
+                                      &err_q);
 
     p_cache_arp = (NET_ARP_CACHE *)p_cache_addr_arp->ParentPtr;
 
@@ -2072,6 +2065,11 @@ void  NetARP_CacheAddPend (NET_BUF      *p_buf,
     NetARP_TxReq(p_cache_addr_arp);                             /* Tx ARP req to resolve ARP cache.                     */
 
 
+    if (err_q != NET_CACHE_ERR_NONE) {                          /* If buf NOT q'd, rtn err to discard buf (see Note #5).*/
+       *p_err = NET_CACHE_ERR_UNRESOLVED;
+        return;
+    }
+
    *p_err = NET_ARP_ERR_CACHE_PEND;
 }
 
@@ -2546,7 +2544,6 @@ static  void  NetARP_RxPktCacheUpdate (NET_IF_NBR    if_nbr,
     CPU_INT08U          *p_addr_sender_protocol = DEF_NULL;
     NET_CACHE_ADDR_ARP  *p_cache_addr_arp       = DEF_NULL;
     NET_ARP_CACHE       *p_cache_arp            = DEF_NULL;
-    NET_BUF             *p_buf_head             = DEF_NULL;
     NET_TMR_TICK         timeout_tick           = 0u;
     CPU_SR_ALLOC();
 
@@ -2592,17 +2589,11 @@ static  void  NetARP_RxPktCacheUpdate (NET_IF_NBR    if_nbr,
                             (NET_TMR_TICK)timeout_tick,
                             (NET_ERR    *)p_err);
 
-                 p_buf_head                  =  p_cache_addr_arp->TxQ_Head;
-                 p_cache_addr_arp->TxQ_Head  = (NET_BUF *)0;
-                 p_cache_addr_arp->TxQ_Tail  = (NET_BUF *)0;
-                 p_cache_addr_arp->TxQ_Nbr   = 0u;
                  p_cache_arp->ReqAttemptsCtr = 0u;              /* Reset request attempts counter.                      */
 
-                 if (p_buf_head != DEF_NULL) {
-                     NetCache_TxPktHandler(NET_PROTOCOL_TYPE_ARP,
-                                           p_buf_head,          /* ... & handle/tx cache's buf Q.                       */
-                                           p_addr_sender_hw);
-                 }
+                 NetCache_TxQ_Flush(NET_PROTOCOL_TYPE_ARP,      /* ... & handle/tx cache's buf Q.                       */
+                                   (NET_CACHE_ADDR *)p_cache_addr_arp,
+                                    p_addr_sender_hw);
                  p_cache_arp->State = NET_ARP_CACHE_STATE_RESOLVED;
                 *p_err              = NET_ARP_ERR_CACHE_RESOLVED;
                  break;
@@ -65,6 +65,9 @@
 #include  "../../Source/net_icmp.h"
 #include  "../../Source/net_stat.h"
 #include  "../../Source/net_util.h"
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+#include  "../../Source/net_tcp.h"
+#endif
 
 
 /*
@@ -157,6 +160,24 @@
 #define  NET_ICMPv4_PTR_IX_ICMP_UNUSED_PARAM_PROB          5
 
 
+/*
+*********************************************************************************************************
+*                                      ICMPv4 PATH MTU DEFINES
+*
+* Note(s) : (1) RFC #1191, Section 7 specifies a table of common MTU plateaus to estimate the next-hop MTU
+*               from routers that do NOT return the next-hop MTU; plateaus below the IPv4 default maximum
+*               datagram size are NOT used (see 'net_tcp.h  TCP PATH MTU DISCOVERY DEFINES  Note #1b').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+#define  NET_ICMPv4_PMTU_IX_MTU                            2    /* Next-hop MTU ix in 'Unused' field.                   */
+#define  NET_ICMPv4_PMTU_IP_HDR_LEN_MASK                0x0Fu
+
+#define  NET_ICMPv4_PMTU_PLATEAU_NBR                       7
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         ICMPv4 FLAG DEFINES
@@ -341,6 +362,18 @@ typedef  struct  net_ICMPv4_hdr_addr_mask {
 *********************************************************************************************************
 */
 
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN                              /* See 'ICMPv4 PATH MTU DEFINES  Note #1'.              */
+static  const  CPU_INT16U  NetICMPv4_PMTU_PlateauTbl[NET_ICMPv4_PMTU_PLATEAU_NBR] = {
+    32000u,
+    17914u,
+     8166u,
+     4352u,
+     2002u,
+     1492u,
+     1006u
+};
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -401,6 +434,12 @@ static  void                       NetICMPv4_RxReplyDemux             (NET_BUF
                                                                        NET_ICMPv4_HDR          *p_icmp_hdr,
                                                                        NET_ERR                 *p_err);
 
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void                       NetICMPv4_RxMsgErrDemux            (NET_BUF                 *p_buf,
+                                                                       NET_BUF_HDR             *p_buf_hdr,
+                                                                       NET_ICMPv4_HDR          *p_icmp_hdr);
+#endif
+
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
 static  void                       NetICMPv4_RxPktValidateBuf         (NET_BUF_HDR             *p_buf_hdr,
                                                                        NET_ERR                 *p_err);
@@ -619,6 +658,9 @@ void  NetICMPv4_Rx (NET_BUF  *p_buf,
         case NET_ICMPv4_ERR_MSG_TYPE_ERR:
                                                                 /* See Note #3a.                                        */
              NET_CTR_STAT_INC(Net_StatCtrs.ICMPv4.RxMsgErrCtr);
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+             NetICMPv4_RxMsgErrDemux(p_buf, p_buf_hdr, p_icmp_hdr);
+#endif
              break;
 
         case NET_ICMPv4_ERR_RX_BROADCAST:
@@ -1222,6 +1264,108 @@ static  void  NetICMPv4_RxReplyDemux (NET_BUF         *p_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetICMPv4_RxMsgErrDemux()
+*
+* Description : Demultiplex ICMPv4 'Fragmentation Needed' error message to TCP path MTU discovery.
+*
+* Argument(s) : p_buf       Pointer to network buffer that received ICMPv4 message.
+*               -----       Argument checked   in NetICMPv4_Rx().
+*
+*               p_buf_hdr   Pointer to network buffer header.
+*               ---------   Argument validated in NetICMPv4_Rx().
+*
+*               p_icmp_hdr  Pointer to network buffer ICMPv4 header.
+*               ----------  Argument validated in NetICMPv4_Rx().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetICMPv4_Rx().
+*
+* Note(s)     : (1) ICMPv4 error messages in fragmented packet buffers are NOT demultiplexed.
+*
+*               (2) The returned datagram MUST include the complete IPv4 header & the first 8 octets of
+*                   the TCP header; i.e. the TCP ports & sequence number (see RFC #792, Section 'Destination
+*                   Unreachable Message' & RFC #1191, Section 4).
+*
+*               (3) Routers that do NOT implement RFC #1191 return a next-hop MTU of zero; the next-hop
+*                   MTU is estimated as the next plateau below the returned datagram's total length (see
+*                   'ICMPv4 PATH MTU DEFINES  Note #1').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void  NetICMPv4_RxMsgErrDemux (NET_BUF         *p_buf,
+                                       NET_BUF_HDR     *p_buf_hdr,
+                                       NET_ICMPv4_HDR  *p_icmp_hdr)
+{
+    NET_ICMPv4_HDR_ERR  *p_icmp_err_hdr;
+    NET_IPv4_HDR        *p_ip_hdr;
+    NET_IPv4_ADDR        addr_src;
+    NET_IPv4_ADDR        addr_dest;
+    CPU_INT32U           mtu;
+    CPU_INT16U           ip_hdr_len;
+    CPU_INT16U           ip_tot_len;
+    CPU_INT16U           msg_len_min;
+    CPU_INT08U           ix;
+
+
+   (void)&p_buf;
+
+    if ((p_icmp_hdr->Type != NET_ICMPv4_MSG_TYPE_DEST_UNREACH) ||
+        (p_icmp_hdr->Code != NET_ICMPv4_MSG_CODE_DEST_FRAG_NEEDED)) {
+        return;
+    }
+
+    if (p_buf_hdr->NextBufPtr != DEF_NULL) {                    /* See Note #1.                                         */
+        return;
+    }
+
+                                                                /* ------------ VALIDATE RETURNED DATAGRAM ------------ */
+    p_icmp_err_hdr = (NET_ICMPv4_HDR_ERR *)p_icmp_hdr;
+    p_ip_hdr       = (NET_IPv4_HDR       *)&p_icmp_err_hdr->Data[0];
+
+    ip_hdr_len     = (CPU_INT16U)(p_ip_hdr->Ver_HdrLen & NET_ICMPv4_PMTU_IP_HDR_LEN_MASK);
+    ip_hdr_len    *=  NET_IPv4_HDR_LEN_WORD_SIZE;
+    if (ip_hdr_len < NET_IPv4_HDR_SIZE_MIN) {
+        return;
+    }
+                                                                /* See Note #2.                                         */
+    msg_len_min = NET_ICMPv4_HDR_SIZE_DEST_UNREACH + ip_hdr_len + NET_ICMPv4_MSG_ERR_DATA_SIZE_MIN_OCTETS;
+    if (p_buf_hdr->ICMP_MsgLen < msg_len_min) {
+        return;
+    }
+
+    if (p_ip_hdr->Protocol != NET_IP_HDR_PROTOCOL_TCP) {
+        return;
+    }
+
+                                                                /* ----------------- GET NEXT-HOP MTU ----------------- */
+    mtu = NET_UTIL_VAL_GET_NET_16(&p_icmp_err_hdr->Unused[NET_ICMPv4_PMTU_IX_MTU]);
+    if (mtu == 0u) {                                            /* See Note #3.                                         */
+        ip_tot_len = NET_UTIL_VAL_GET_NET_16(&p_ip_hdr->TotLen);
+        mtu        = NET_IPv4_MAX_DATAGRAM_SIZE_DFLT;
+        for (ix = 0u; ix < NET_ICMPv4_PMTU_PLATEAU_NBR; ix++) {
+            if (NetICMPv4_PMTU_PlateauTbl[ix] < ip_tot_len) {
+                mtu = NetICMPv4_PMTU_PlateauTbl[ix];
+                break;
+            }
+        }
+    }
+
+                                                                /* ------------------ DEMUX TO TCP -------------------- */
+    addr_src  = NET_UTIL_VAL_GET_NET_32(&p_ip_hdr->AddrSrc);
+    addr_dest = NET_UTIL_VAL_GET_NET_32(&p_ip_hdr->AddrDest);
+
+    NetTCP_RxPathMTU_IPv4(addr_src,
+                          addr_dest,
+                          (NET_TCP_HDR *)((CPU_INT08U *)p_ip_hdr + ip_hdr_len),
+                          mtu);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    NetICMPv4_RxPktValidateBuf()
@@ -91,7 +91,7 @@
 
 #define  NET_IGMP_HDR_VER_MASK                          0xF0u
 #define  NET_IGMP_HDR_VER_SHIFT                            4u
-#define  NET_IGMP_HDR_VER                                  1u   /* Supports IGMPv1 ONLY (see 'net_igmp.h  Note #2').    */
+#define  NET_IGMP_HDR_VER                                  1u   /* IGMPv1 compatibility hdr (see 'net_igmp.h  Note #2').*/
 
 #define  NET_IGMP_HDR_TYPE_MASK                         0x0Fu
 
@@ -109,6 +109,54 @@
 #define  NET_IGMP_MSG_LEN_DATA                             0
 
 
+/*
+*********************************************************************************************************
+*                                      IGMPv3 MESSAGE DEFINES
+*
+* Note(s) : (1) RFC #3376, Section 7.1 states that "the IGMP version of a Membership Query message is
+*               determined as follows" :
+*
+*               (a) "IGMPv1 Query: length = 8 octets AND Max Resp Code field is zero".
+*               (b) "IGMPv2 Query: length = 8 octets AND Max Resp Code field is non-zero".
+*               (c) "IGMPv3 Query: length >= 12 octets".
+*
+*           (2) RFC #3376, Section 4.2.14 states that "Version 3 Reports are sent with an IP destination
+*               address of 224.0.0.22, to which all IGMPv3-capable multicast routers listen".
+*
+*           (3) RFC #3376, Section 4.1.1 encodes Max Resp Codes >= 128 as a floating-point value :
+*
+*                         0 1 2 3 4 5 6 7
+*                       +-+-+-+-+-+-+-+-+
+*                       |1| exp | mant  |       Max Resp Time = (mant | 0x10) << (exp + 3)
+*                       +-+-+-+-+-+-+-+-+
+*
+*               Max Resp Time is expressed in units of 1/10 second.
+*********************************************************************************************************
+*/
+
+#define  NET_IGMP_V3_MSG_TYPE_REPORT                    0x22u   /* Complete IGMPv3 report ver/type octet.               */
+
+#define  NET_IGMP_V3_QUERY_MSG_SIZE_MIN                   12    /* See Note #1c.                                        */
+#define  NET_IGMP_V3_REPORT_HDR_SIZE                       8
+#define  NET_IGMP_V3_GRP_REC_HDR_SIZE                      8
+
+#define  NET_IGMP_V3_REC_TYPE_MODE_IS_INCLUDE              1u
+#define  NET_IGMP_V3_REC_TYPE_MODE_IS_EXCLUDE              2u
+#define  NET_IGMP_V3_REC_TYPE_CHANGE_TO_INCLUDE            3u
+#define  NET_IGMP_V3_REC_TYPE_CHANGE_TO_EXCLUDE            4u
+
+                                                                /* See Note #2.                                         */
+#define  NET_IGMP_V3_ADDR_ALL_ROUTERS     (((NET_IPv4_ADDR)224uL << (3u * DEF_OCTET_NBR_BITS)) | \
+                                           ((NET_IPv4_ADDR)  0uL << (2u * DEF_OCTET_NBR_BITS)) | \
+                                           ((NET_IPv4_ADDR)  0uL << (1u * DEF_OCTET_NBR_BITS)) | \
+                                           ((NET_IPv4_ADDR) 22uL << (0u * DEF_OCTET_NBR_BITS)))
+
+#define  NET_IGMP_V3_MAX_RESP_CODE_FLOAT                0x80u   /* See Note #3.                                         */
+#define  NET_IGMP_V3_MAX_RESP_CODE_EXP_MASK             0x70u
+#define  NET_IGMP_V3_MAX_RESP_CODE_EXP_SHIFT               4u
+#define  NET_IGMP_V3_MAX_RESP_CODE_MANT_MASK            0x0Fu
+
+
 /*
 *********************************************************************************************************
 *                                      IGMP MESSAGE TYPE DEFINES
@@ -237,6 +285,23 @@
                                                                 /* ------------------ NET IGMP FLAGS ------------------ */
 #define  NET_IGMP_FLAG_NONE                       DEF_BIT_NONE
 #define  NET_IGMP_FLAG_USED                       DEF_BIT_00    /* IGMP host grp cur used; i.e. NOT in free pool.       */
+#define  NET_IGMP_FLAG_STATE_CHNG                 DEF_BIT_01    /* IGMP host grp filter state change report pending.    */
+
+
+/*
+*********************************************************************************************************
+*                                    IGMP HOST GROUP HASH DEFINES
+*
+* Note(s) : (1) Host groups are indexed by interface number & group address in a table of hash buckets
+*               so that the per-datagram membership & source filter checks do NOT walk the entire IGMP
+*               Host Group List.
+*********************************************************************************************************
+*/
+
+#define  NET_IGMP_HOST_GRP_HASH_TBL_SIZE   ((NET_MCAST_CFG_HOST_GRP_NBR_MAX / 2u) + 1u)
+
+#define  NET_IGMP_HOST_GRP_HASH(if_nbr, addr_grp)   ((CPU_INT16U)((((addr_grp) ^ ((addr_grp) >> 16u)) + (if_nbr)) % \
+                                                                   NET_IGMP_HOST_GRP_HASH_TBL_SIZE))
 
 
 
@@ -316,6 +381,26 @@ typedef  struct  net_igmp_hdr {
 } NET_IGMP_HDR;
 
 
+/*
+*********************************************************************************************************
+*                                  IGMP HOST GROUP SOURCE DATA TYPE
+*
+* Note(s) : (1) Each source address is listed at most once per host group, in either INCLUDE or EXCLUDE
+*               filter mode (see 'net_igmp.h  IGMP SOURCE FILTER MODE DEFINES').
+*
+*           (2) The host group's filter mode is EXCLUDE while any-source members remain (see 'NetIGMP_
+*               HostGrpJoinHandler()'), in which case ONLY EXCLUDE sources are reported & filtered;
+*               otherwise, the filter mode is INCLUDE & ONLY INCLUDE sources are reported & accepted.
+*********************************************************************************************************
+*/
+
+typedef  struct  net_igmp_host_grp_src {
+    NET_IPv4_ADDR             AddrSrc;                          /* IGMP   src addr.                                     */
+    NET_IGMP_FILTER_MODE      FilterMode;                       /* IGMP   src filter mode (see Note #1).                */
+    CPU_INT16U                RefCtr;                           /* IGMP   src ref ctr.                                  */
+} NET_IGMP_HOST_GRP_SRC;
+
+
 /*
 *********************************************************************************************************
 *                                     IGMP HOST GROUP DATA TYPES
@@ -340,6 +425,12 @@ typedef  struct  net_igmp_hdr {
 *                                         |    Reference    |
 *                                         |     Counter     |
 *                                         |-----------------|
+*                                         |  Source Table   |
+*                                         |-----------------|
+*
+*
+* Note(s) : (1) 'RefCtr' counts ALL host group references, i.e. any-source memberships plus INCLUDE source
+*               references; 'AnySrcRefCtr' counts ONLY the any-source memberships.
 *********************************************************************************************************
 */
 
@@ -349,6 +440,7 @@ typedef  struct  net_igmp_host_grp  NET_IGMP_HOST_GRP;
 struct  net_igmp_host_grp {
     NET_IGMP_HOST_GRP        *PrevPtr;                          /* Ptr to PREV IGMP host grp.                           */
     NET_IGMP_HOST_GRP        *NextPtr;                          /* Ptr to NEXT IGMP host grp.                           */
+    NET_IGMP_HOST_GRP        *HashNextPtr;                      /* Ptr to NEXT IGMP host grp in same hash bucket.       */
 
     NET_TMR                  *TmrPtr;                           /* Ptr to host grp TMR.                                 */
 
@@ -357,6 +449,10 @@ struct  net_igmp_host_grp {
 
     NET_IGMP_HOST_GRP_STATE   State;                            /* IGMP   host grp state.                               */
     CPU_INT16U                RefCtr;                           /* IGMP   host grp ref ctr.                             */
+    CPU_INT16U                AnySrcRefCtr;                     /* IGMP   host grp any-src ref ctr (see Note #1).       */
+
+    CPU_INT08U                SrcNbr;                           /* Nbr of IGMP host grp srcs.                           */
+    NET_IGMP_HOST_GRP_SRC     SrcTbl[NET_MCAST_CFG_SRC_NBR_MAX];/* Tbl of IGMP host grp srcs.                           */
 
     NET_IGMP_FLAGS            Flags;                            /* IGMP   host grp flags.                               */
 };
@@ -384,8 +480,12 @@ static  NET_IGMP_HOST_GRP  *NetIGMP_HostGrpPoolPtr;        /* Ptr to pool of fre
 static  NET_STAT_POOL       NetIGMP_HostGrpPoolStat;
 
 static  NET_IGMP_HOST_GRP  *NetIGMP_HostGrpListHead;       /* Ptr to head of IGMP Host Grp List.                  */
+                                                            /* Tbl of IGMP host grp hash buckets.                  */
+static  NET_IGMP_HOST_GRP  *NetIGMP_HostGrpHashTbl[NET_IGMP_HOST_GRP_HASH_TBL_SIZE];
 
 static  CPU_BOOLEAN         NetIGMP_AllHostsJoinedOnIF[NET_IF_NBR_IF_TOT];
+                                                            /* IGMPv1 compatibility mode per IF.                   */
+static  CPU_BOOLEAN         NetIGMP_CompatV1OnIF[NET_IF_NBR_IF_TOT];
 
 static  RAND_NBR            NetIGMP_RandSeed;
 
@@ -412,7 +512,8 @@ static  void                NetIGMP_RxPktValidate          (NET_BUF            *
 
 
 static  void                NetIGMP_RxMsgQuery             (NET_IF_NBR          if_nbr,
-                                                            NET_IGMP_HDR       *p_igmp_hdr);
+                                                            NET_IGMP_HDR       *p_igmp_hdr,
+                                                            CPU_INT16U          msg_len);
 
 static  void                NetIGMP_RxMsgReport            (NET_IF_NBR          if_nbr,
                                                             NET_IGMP_HDR       *p_igmp_hdr);
@@ -434,6 +535,11 @@ static  void                NetIGMP_TxMsg                  (NET_IF_NBR
 static  void                NetIGMP_TxMsgReport            (NET_IGMP_HOST_GRP  *p_host_grp,
                                                             NET_ERR            *p_err);
 
+static  void                NetIGMP_TxMsgReportV3          (NET_IGMP_HOST_GRP  *p_host_grp,
+                                                            NET_IPv4_ADDR       addr_src,
+                                                            CPU_INT08U          rec_type,
+                                                            NET_ERR            *p_err);
+
 static  void                NetIGMP_TxIxDataGet            (NET_IF_NBR          if_nbr,
                                                             CPU_INT16U          data_len,
                                                             CPU_INT16U         *p_ix,
@@ -457,6 +563,25 @@ static  NET_IGMP_HOST_GRP  *NetIGMP_HostGrpAdd             (NET_IF_NBR
 
 static  void                NetIGMP_HostGrpRemove          (NET_IGMP_HOST_GRP  *p_host_grp);
 
+static  void                NetIGMP_HostGrpLeaveTx         (NET_IGMP_HOST_GRP  *p_host_grp);
+
+static  void                NetIGMP_HostGrpStateChng       (NET_IGMP_HOST_GRP  *p_host_grp);
+
+static  void                NetIGMP_AllHostsJoin           (NET_IF_NBR          if_nbr,
+                                                            NET_ERR            *p_err);
+
+
+static  NET_IGMP_HOST_GRP_SRC  *NetIGMP_HostGrpSrcSrch     (NET_IGMP_HOST_GRP  *p_host_grp,
+                                                            NET_IPv4_ADDR       addr_src);
+
+static  void                NetIGMP_HostGrpSrcDel          (NET_IGMP_HOST_GRP      *p_host_grp,
+                                                            NET_IGMP_HOST_GRP_SRC  *p_src);
+
+static  void                NetIGMP_HostGrpSrcClrMode      (NET_IGMP_HOST_GRP     *p_host_grp,
+                                                            NET_IGMP_FILTER_MODE   filter_mode);
+
+static  NET_IGMP_FILTER_MODE  NetIGMP_HostGrpFilterModeGet (NET_IGMP_HOST_GRP  *p_host_grp);
+
 static  void                NetIGMP_HostGrpInsert          (NET_IGMP_HOST_GRP  *p_host_grp);
 
 static  void                NetIGMP_HostGrpUnlink          (NET_IGMP_HOST_GRP  *p_host_grp);
@@ -497,8 +622,8 @@ static  void                NetIGMP_HostGrpClr             (NET_IGMP_HOST_GRP  *
 *
 *                   (a) Initialize IGMP host group pool
 *                   (b) Initialize IGMP host group table
-*                   (c) Initialize IGMP Host Group List pointer
-*                   (d) Initialize IGMP all-hosts groups
+*                   (c) Initialize IGMP Host Group List pointer & hash table
+*                   (d) Initialize IGMP all-hosts groups & compatibility mode
 *                   (e) Initialize IGMP random seed
 *
 *
@@ -531,6 +656,7 @@ void  NetIGMP_Init (void)
 {
     NET_IGMP_HOST_GRP      *p_host_grp;
     NET_IGMP_HOST_GRP_QTY   i;
+    CPU_INT16U              hash_ix;
     NET_IF_NBR              if_nbr;
     NET_ERR                 err;
 
@@ -561,10 +687,20 @@ void  NetIGMP_Init (void)
 
     NetIGMP_HostGrpListHead = (NET_IGMP_HOST_GRP *)0;           /* ----------- INIT IGMP HOST GRP LIST PTR ------------ */
 
+                                                                /* ----------- INIT IGMP HOST GRP HASH TBL ------------ */
+    for (hash_ix = 0u; hash_ix < NET_IGMP_HOST_GRP_HASH_TBL_SIZE; hash_ix++) {
+        NetIGMP_HostGrpHashTbl[hash_ix] = (NET_IGMP_HOST_GRP *)0;
+    }
+
 
                                                                 /* ---------------- INIT ALL-HOSTS GRP ---------------- */
     for (if_nbr = NET_IF_NBR_BASE_CFGD; if_nbr < NET_IF_NBR_IF_TOT; if_nbr++) {
         NetIGMP_AllHostsJoinedOnIF[if_nbr] = DEF_NO;            /* See Note #3.                                         */
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+        NetIGMP_CompatV1OnIF[if_nbr]       = DEF_NO;            /* Start in IGMPv3 mode (see 'net_igmp.h  Note #2').    */
+#else
+        NetIGMP_CompatV1OnIF[if_nbr]       = DEF_YES;           /* See 'net_igmp.h  Note #2f'.                          */
+#endif
     }
 
 
@@ -739,6 +875,10 @@ CPU_BOOLEAN  NetIGMP_HostGrpJoin (NET_IF_NBR      if_nbr,
 *
 *                   (b) However, failure to transmit the initial report or to configure the timer does
 *                       NOT prevent the host group from being inserted into the IGMP Host Group List.
+*
+*               (10) A host group joined with NO source list is an any-source membership, i.e. an EXCLUDE
+*                    filter with an empty source list (see RFC #3376, Section 3.1).  If the host group was
+*                    previously joined ONLY for INCLUDE sources, its filter mode changes to EXCLUDE.
 *********************************************************************************************************
 */
 
@@ -747,8 +887,6 @@ CPU_BOOLEAN  NetIGMP_HostGrpJoinHandler (NET_IF_NBR      if_nbr,
                                          NET_ERR        *p_err)
 {
     NET_IGMP_HOST_GRP  *p_host_grp;
-    NET_TMR_TICK        timeout_tick;
-    NET_ERR             err;
 
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -770,16 +908,9 @@ CPU_BOOLEAN  NetIGMP_HostGrpJoinHandler (NET_IF_NBR      if_nbr,
          return (DEF_FAIL);                                     /* ... rtn err.                                         */
     }
 
-                                                                /* Chk all-hosts grp (see Note #7b).                    */
-    if (NetIGMP_AllHostsJoinedOnIF[if_nbr] != DEF_YES) {
-        NetIGMP_HostGrpAdd(if_nbr,
-                           NET_IPv4_ADDR_MULTICAST_ALL_HOSTS,
-                           p_err);
-        if (*p_err != NET_IGMP_ERR_NONE) {
-             return (DEF_FAIL);
-        }
-
-        NetIGMP_AllHostsJoinedOnIF[if_nbr] = DEF_YES;
+    NetIGMP_AllHostsJoin(if_nbr, p_err);                        /* Chk all-hosts grp (see Note #7b).                    */
+    if (*p_err != NET_IGMP_ERR_NONE) {
+         return (DEF_FAIL);
     }
 
 
@@ -799,6 +930,10 @@ CPU_BOOLEAN  NetIGMP_HostGrpJoinHandler (NET_IF_NBR      if_nbr,
     p_host_grp = NetIGMP_HostGrpSrch(if_nbr, addr_grp);
     if (p_host_grp != (NET_IGMP_HOST_GRP *)0) {                 /* If host grp found, ...                               */
         p_host_grp->RefCtr++;                                   /* ... inc ref ctr.                                     */
+        p_host_grp->AnySrcRefCtr++;
+        if (p_host_grp->AnySrcRefCtr == 1u) {                   /* If filter mode chngd to EXCLUDE (see Note #10), ...  */
+            NetIGMP_HostGrpStateChng(p_host_grp);               /* ... advertise new filter state.                      */
+        }
        *p_err =  NET_IGMP_ERR_NONE;
         return (DEF_OK);
     }
@@ -809,18 +944,7 @@ CPU_BOOLEAN  NetIGMP_HostGrpJoinHandler (NET_IF_NBR      if_nbr,
     }
 
 
-                                                                /* --------------- ADVERTISE MEMBERSHIP --------------- */
-    NetIGMP_TxMsgReport(p_host_grp, &err);                      /* See Note #9a1.                                       */
-
-                                                                /* Cfg report timeout.                                  */
-    timeout_tick       = (NET_TMR_TICK)(NET_IGMP_HOST_GRP_REPORT_DLY_JOIN_SEC * NET_TMR_TIME_TICK_PER_SEC);
-    p_host_grp->TmrPtr =  NetTmr_Get((CPU_FNCT_PTR ) NetIGMP_HostGrpReportDlyTimeout,
-                                     (void        *) p_host_grp,/* See Note #7a.                                        */
-                                     (NET_TMR_TICK ) timeout_tick,
-                                     (NET_ERR     *)&err);
-
-    p_host_grp->State  = (err == NET_TMR_ERR_NONE) ? NET_IGMP_HOST_GRP_STATE_DELAYING
-                                                   : NET_IGMP_HOST_GRP_STATE_IDLE;
+    NetIGMP_HostGrpStateChng(p_host_grp);                       /* Advertise membership (see Note #9).                  */
 
    *p_err =  NET_IGMP_ERR_NONE;
 
@@ -939,6 +1063,9 @@ CPU_BOOLEAN  NetIGMP_HostGrpLeave (NET_IF_NBR      if_nbr,
 *               (3) NetIGMP_HostGrpLeaveHandler() blocked until network initialization completes.
 *
 *               (4) IP host group address MUST be in host-order.
+*
+*               (5) Leaving the last any-source membership discards the host group's EXCLUDE sources;
+*                   the host group then reverts to INCLUDE filter mode for any remaining INCLUDE sources.
 *********************************************************************************************************
 */
 
@@ -958,14 +1085,21 @@ CPU_BOOLEAN  NetIGMP_HostGrpLeaveHandler (NET_IF_NBR      if_nbr,
 
                                                                 /* ---------------- SRCH HOST GRP LIST ---------------- */
     p_host_grp = NetIGMP_HostGrpSrch(if_nbr, addr_grp);
-    if (p_host_grp == (NET_IGMP_HOST_GRP *)0) {                 /* If host grp NOT found, ...                           */
+    if ((p_host_grp               == (NET_IGMP_HOST_GRP *)0) || /* If host grp NOT found ...                            */
+        (p_host_grp->AnySrcRefCtr <   1u)) {                    /* ... or NOT joined for any src, ...                   */
        *p_err =  NET_IGMP_ERR_HOST_GRP_NOT_FOUND;               /* ... rtn err.                                         */
         return (DEF_FAIL);
     }
 
+    p_host_grp->AnySrcRefCtr--;
     p_host_grp->RefCtr--;                                        /* Dec ref ctr.                                         */
     if (p_host_grp->RefCtr < 1) {                                /* If last ref to host grp, ...                         */
-        NetIGMP_HostGrpRemove(p_host_grp);                       /* ... remove host grp from Host Grp List.              */
+        NetIGMP_HostGrpLeaveTx(p_host_grp);                      /* ... advertise leave ...                              */
+        NetIGMP_HostGrpRemove(p_host_grp);                       /* ... & remove host grp from Host Grp List.            */
+
+    } else if (p_host_grp->AnySrcRefCtr < 1u) {                  /* If last any-src ref (see Note #5), ...               */
+        NetIGMP_HostGrpSrcClrMode(p_host_grp, NET_IGMP_FILTER_MODE_EXCLUDE);
+        NetIGMP_HostGrpStateChng(p_host_grp);                    /* ... advertise new filter state.                      */
     }
 
 
@@ -977,170 +1111,687 @@ CPU_BOOLEAN  NetIGMP_HostGrpLeaveHandler (NET_IF_NBR      if_nbr,
 
 /*
 *********************************************************************************************************
-*                                       NetIGMP_IsGrpJoinedOnIF()
+*                                        NetIGMP_HostGrpSrcAdd()
 *
-* Description : Check for joined host group on specified interface.
+* Description : Add a source filter to a host group.
 *
-* Argument(s) : if_nbr      Interface number to search.
+* Argument(s) : if_nbr          Interface number of host group.
 *
-*               addr_grp    IP address of host group.
+*               addr_grp        IP address of host group (see Note #2).
 *
-* Return(s)   : DEF_YES, if host group address joined on interface.
+*               addr_src        IP address of source to filter (see Note #2).
 *
-*               DEF_NO,  otherwise.
+*               filter_mode     Source filter mode :
 *
-* Caller(s)   : NetIP_RxPktValidate().
+*                                   NET_IGMP_FILTER_MODE_INCLUDE    Receive host group datagrams from source.
+*                                   NET_IGMP_FILTER_MODE_EXCLUDE    Block   host group datagrams from source.
 *
-*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
-*               application function(s).
+*               p_err           Pointer to variable that will receive the return error code from this function :
 *
-* Note(s)     : none.
+*                                                                   - RETURNED BY NetIGMP_HostGrpSrcAddHandler() : -
+*                               NET_IGMP_ERR_NONE                   Source filter successfully added.
+*                               NET_IGMP_ERR_INVALID_ADDR_GRP       Invalid group  address.
+*                               NET_IGMP_ERR_INVALID_ADDR_SRC       Invalid source address.
+*                               NET_IGMP_ERR_INVALID_FILTER_MODE    Invalid OR conflicting filter mode.
+*                               NET_IGMP_ERR_HOST_GRP_NOT_FOUND     Host group NOT joined for any source.
+*                               NET_IGMP_ERR_HOST_GRP_NONE_AVAIL    NO available host group to allocate.
+*                               NET_IGMP_ERR_SRC_NONE_AVAIL         NO available source entry.
+*                               NET_IF_ERR_INVALID_IF               Invalid OR disabled configured interface.
+*                               NET_INIT_ERR_NOT_COMPLETED          Network initialization NOT complete.
+*
+*                                                                   --- RETURNED BY Net_GlobalLockAcquire() : ----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
+*
+*                               NET_ERR_FAULT_FEATURE_DIS           Source filtering disabled (see Note #3).
+*
+* Return(s)   : DEF_OK,   if source filter successfully added.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application interface (API) function & MAY be
+*               called by application function(s) [see also Note #1].
+*
+* Note(s)     : (1) NetIGMP_HostGrpSrcAdd() MUST NOT be called with the global network lock already
+*                   acquired.
+*
+*                   See also 'NetIGMP_HostGrpJoin()  Note #1'.
+*
+*               (2) IP addresses MUST be in host-order.
+*
+*               (3) Source filters are ONLY available if NET_MCAST_CFG_SRC_FILTER_EN is enabled (see
+*                   'net_igmp.h  Note #2f').
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetIGMP_IsGrpJoinedOnIF (NET_IF_NBR     if_nbr,
-                                      NET_IPv4_ADDR  addr_grp)
+CPU_BOOLEAN  NetIGMP_HostGrpSrcAdd (NET_IF_NBR             if_nbr,
+                                    NET_IPv4_ADDR          addr_grp,
+                                    NET_IPv4_ADDR          addr_src,
+                                    NET_IGMP_FILTER_MODE   filter_mode,
+                                    NET_ERR               *p_err)
 {
-    NET_IGMP_HOST_GRP  *p_host_grp;
-    CPU_BOOLEAN         grp_joined;
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+    CPU_BOOLEAN  src_add;
+#endif
 
 
-    p_host_grp  =  NetIGMP_HostGrpSrch(if_nbr, addr_grp);
-    grp_joined = (p_host_grp != (NET_IGMP_HOST_GRP *)0) ? DEF_YES : DEF_NO;
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+#endif
 
-    return (grp_joined);
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+                                                                /* Acquire net lock (see Note #1).                      */
+    Net_GlobalLockAcquire((void *)&NetIGMP_HostGrpSrcAdd, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         return (DEF_FAIL);
+    }
+                                                                /* Add src filter.                                      */
+    src_add = NetIGMP_HostGrpSrcAddHandler(if_nbr, addr_grp, addr_src, filter_mode, p_err);
+
+    Net_GlobalLockRelease();                                    /* Release net lock.                                    */
+
+    return (src_add);
+
+#else
+   (void)&if_nbr;
+   (void)&addr_grp;
+   (void)&addr_src;
+   (void)&filter_mode;
+   *p_err = NET_ERR_FAULT_FEATURE_DIS;                          /* See Note #3.                                         */
+    return (DEF_FAIL);
+#endif
 }
 
 
 /*
 *********************************************************************************************************
-*                                             NetIGMP_Rx()
+*                                    NetIGMP_HostGrpSrcAddHandler()
 *
-* Description : (1) Process received IGMP packets & update host group status :
+* Description : (1) Add a source filter to a host group :
 *
-*                   (a) Validate IGMP packet
-*                   (b) Update   IGMP host group status
-*                   (c) Free     IGMP packet
-*                   (d) Update receive statistics
+*                   (a) Validate interface number, group & source addresses & filter mode
+*                   (b) Search host group; for INCLUDE sources, add host group if NOT found
+*                   (c) Add or reference host group source entry
+*                   (d) Advertise new filter state to multicast router(s)
 *
-*               (2) Although IGMP data units are typically referred to as 'messages' (see RFC #1112,
-*                   Appendix I), the term 'IGMP packet' (see RFC #1983, 'packet') is used for IGMP
-*                   Receive until the packet is validated as an IGMP message.
 *
+* Argument(s) : if_nbr          Interface number of host group.
 *
-* Argument(s) : p_buf        Pointer to network buffer that received IGMP packet.
+*               addr_grp        IP address of host group (see Note #3).
 *
-*               p_err        Pointer to variable that will receive the return error code from this function :
+*               addr_src        IP address of source to filter (see Note #3).
 *
-*                               NET_IGMP_ERR_NONE               IGMP packet successfully received & processed.
+*               filter_mode     Source filter mode (see 'NetIGMP_HostGrpSrcAdd()').
 *
-*                                                               ---- RETURNED BY NetIGMP_RxPktDiscard() : ----
-*                               NET_ERR_RX                      Receive error; packet discarded.
+*               p_err           Pointer to variable that will receive the return error code from this function
+*                                   (see 'NetIGMP_HostGrpSrcAdd()').
 *
-* Return(s)   : none.
+* Return(s)   : DEF_OK,   if source filter successfully added.
 *
-* Caller(s)   : NetIP_RxPktDemuxDatagram().
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetIGMP_HostGrpSrcAdd().
 *
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
-*               application function(s).
+*               application function(s) [see also Note #2].
 *
-* Note(s)     : none.
+* Note(s)     : (2) NetIGMP_HostGrpSrcAddHandler() is called by network protocol suite function(s) & MUST
+*                   be called with the global network lock already acquired.
+*
+*               (3) IP addresses MUST be in host-order.
+*
+*               (4) (a) INCLUDE sources request reception from ONLY the listed sources (source-specific
+*                       membership) & join the host group if needed.
+*
+*                   (b) EXCLUDE sources block a source for the host group's any-source members & therefore
+*                       require the host group to be joined with NetIGMP_HostGrpJoin().
+*
+*                   See also 'net_igmp.c  IGMP HOST GROUP SOURCE DATA TYPE  Note #2'.
 *********************************************************************************************************
 */
 
-void  NetIGMP_Rx (NET_BUF  *p_buf,
-                  NET_ERR  *p_err)
+CPU_BOOLEAN  NetIGMP_HostGrpSrcAddHandler (NET_IF_NBR             if_nbr,
+                                           NET_IPv4_ADDR          addr_grp,
+                                           NET_IPv4_ADDR          addr_src,
+                                           NET_IGMP_FILTER_MODE   filter_mode,
+                                           NET_ERR               *p_err)
 {
-#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)
-    NET_CTR       *p_ctr;
-#endif
-    NET_BUF_HDR   *p_buf_hdr;
-    NET_IGMP_HDR  *p_igmp_hdr;
-    NET_IF_NBR     if_nbr;
+    NET_IGMP_HOST_GRP      *p_host_grp;
+    NET_IGMP_HOST_GRP_SRC  *p_src;
+    CPU_BOOLEAN             grp_new;
 
 
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* ------------------- VALIDATE PTR ------------------- */
-    if (p_buf == (NET_BUF *)0) {
-        NetIGMP_RxPktDiscard(p_buf, p_err);
-        NET_CTR_ERR_INC(Net_ErrCtrs.IGMP.NullPtrCtr);
-        return;
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        return (DEF_FAIL);
     }
 #endif
 
+                                                                /* ----------------- VALIDATE IF NBR ------------------ */
+    NetIF_IsEnCfgdHandler(if_nbr, p_err);
+    if (*p_err != NET_IF_ERR_NONE) {
+         return (DEF_FAIL);
+    }
 
-    NET_CTR_STAT_INC(Net_StatCtrs.IGMP.RxMsgCtr);
+                                                                /* ----------------- VALIDATE ADDRS ------------------- */
+    if ((addr_grp == NET_IPv4_ADDR_MULTICAST_ALL_HOSTS) ||
+        (addr_grp <  NET_IPv4_ADDR_MULTICAST_HOST_MIN)  ||
+        (addr_grp >  NET_IPv4_ADDR_MULTICAST_HOST_MAX)) {
+        *p_err =  NET_IGMP_ERR_INVALID_ADDR_GRP;
+         return (DEF_FAIL);
+    }
 
+    if ((addr_src == NET_IPv4_ADDR_NONE)      ||
+        (addr_src == NET_IPv4_ADDR_BROADCAST) ||
+       ((addr_src &  NET_IPv4_ADDR_CLASS_D_MASK) == NET_IPv4_ADDR_CLASS_D)) {
+        *p_err =  NET_IGMP_ERR_INVALID_ADDR_SRC;
+         return (DEF_FAIL);
+    }
 
-                                                                /* -------------- VALIDATE RX'D IGMP PKT -------------- */
-    p_buf_hdr = &p_buf->Hdr;
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-    NetIGMP_RxPktValidateBuf(p_buf_hdr, p_err);                 /* Validate rx'd buf.                                   */
-    switch (*p_err) {
-        case NET_IGMP_ERR_NONE:
+                                                                /* -------------- VALIDATE FILTER MODE ---------------- */
+    switch (filter_mode) {
+        case NET_IGMP_FILTER_MODE_INCLUDE:
+        case NET_IGMP_FILTER_MODE_EXCLUDE:
              break;
 
 
-        case NET_ERR_INVALID_PROTOCOL:
-        case NET_BUF_ERR_INVALID_IX:
         default:
-             NetIGMP_RxPktDiscard(p_buf, p_err);
-             return;
+            *p_err = NET_IGMP_ERR_INVALID_FILTER_MODE;
+             return (DEF_FAIL);
     }
-#endif
-    p_igmp_hdr = (NET_IGMP_HDR *)&p_buf->DataPtr[p_buf_hdr->IGMP_MsgIx];
-    if_nbr    =  p_buf_hdr->IF_Nbr;
-    NetIGMP_RxPktValidate(p_buf, p_buf_hdr, p_igmp_hdr, p_err); /* Validate rx'd pkt.                                   */
-
 
-                                                                /* ------------------ DEMUX IGMP MSG ------------------ */
-    switch (*p_err) {
-        case NET_IGMP_ERR_MSG_TYPE_QUERY:
-             NetIGMP_RxMsgQuery(if_nbr, p_igmp_hdr);
 
-#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)
-             p_ctr = &Net_StatCtrs.IGMP.RxMsgQueryCtr;
-#endif
-             break;
+                                                                /* ---------------- SRCH HOST GRP LIST ---------------- */
+    grp_new    = DEF_NO;
+    p_host_grp = NetIGMP_HostGrpSrch(if_nbr, addr_grp);
+    if (p_host_grp == (NET_IGMP_HOST_GRP *)0) {
+        if (filter_mode != NET_IGMP_FILTER_MODE_INCLUDE) {      /* EXCLUDE srcs req any-src membership (see Note #4b).  */
+           *p_err = NET_IGMP_ERR_HOST_GRP_NOT_FOUND;
+            return (DEF_FAIL);
+        }
 
+        NetIGMP_AllHostsJoin(if_nbr, p_err);
+        if (*p_err != NET_IGMP_ERR_NONE) {
+             return (DEF_FAIL);
+        }
+                                                                /* Add new host grp (see Note #4a).                     */
+        p_host_grp = NetIGMP_HostGrpAdd(if_nbr, addr_grp, p_err);
+        if (*p_err != NET_IGMP_ERR_NONE) {
+             return (DEF_FAIL);
+        }
+        p_host_grp->RefCtr       = 0u;                          /* Grp ONLY ref'd by INCLUDE src below.                 */
+        p_host_grp->AnySrcRefCtr = 0u;
+        grp_new                  = DEF_YES;
 
-        case NET_IGMP_ERR_MSG_TYPE_REPORT:
-             NetIGMP_RxMsgReport(if_nbr, p_igmp_hdr);
+    } else if ((filter_mode              == NET_IGMP_FILTER_MODE_EXCLUDE) &&
+               (p_host_grp->AnySrcRefCtr <  1u)) {
+       *p_err = NET_IGMP_ERR_HOST_GRP_NOT_FOUND;
+        return (DEF_FAIL);
+    }
 
-#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)
-             p_ctr = &Net_StatCtrs.IGMP.RxMsgReportCtr;
-#endif
-             break;
 
+                                                                /* ------------------ ADD SRC ENTRY ------------------- */
+    p_src = NetIGMP_HostGrpSrcSrch(p_host_grp, addr_src);
+    if (p_src != (NET_IGMP_HOST_GRP_SRC *)0) {
+        if (p_src->FilterMode != filter_mode) {                 /* Src already listed in other mode.                    */
+           *p_err = NET_IGMP_ERR_INVALID_FILTER_MODE;
+            return (DEF_FAIL);
+        }
+        p_src->RefCtr++;
 
-        case NET_IGMP_ERR_INVALID_VER:
-        case NET_IGMP_ERR_INVALID_TYPE:
-        case NET_IGMP_ERR_INVALID_LEN:
-        case NET_IGMP_ERR_INVALID_CHK_SUM:
-        case NET_IGMP_ERR_INVALID_ADDR_DEST:
-        case NET_IGMP_ERR_INVALID_ADDR_GRP:
-        default:
-             NetIGMP_RxPktDiscard(p_buf, p_err);
-             return;
+    } else {
+        if (p_host_grp->SrcNbr >= NET_MCAST_CFG_SRC_NBR_MAX) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.IGMP.NoneAvailCtr);
+           *p_err = NET_IGMP_ERR_SRC_NONE_AVAIL;
+            return (DEF_FAIL);
+        }
+        p_src             = &p_host_grp->SrcTbl[p_host_grp->SrcNbr];
+        p_src->AddrSrc    =  addr_src;
+        p_src->FilterMode =  filter_mode;
+        p_src->RefCtr     =  1u;
+        p_host_grp->SrcNbr++;
     }
 
+    if (filter_mode == NET_IGMP_FILTER_MODE_INCLUDE) {          /* INCLUDE srcs ref host grp.                           */
+        p_host_grp->RefCtr++;
+    }
 
-    NetIGMP_RxPktFree(p_buf);                                   /* ------------------- FREE IGMP PKT ------------------ */
-
-                                                                /* ------------------ UPDATE RX STATS ----------------- */
-    NET_CTR_STAT_INC(Net_StatCtrs.IGMP.RxMsgCompCtr);
-    NET_CTR_STAT_INC(*p_ctr);
 
+                                                                /* ------------ ADVERTISE NEW FILTER STATE ------------ */
+    if ((grp_new       == DEF_YES) ||
+        (p_src->RefCtr == 1u)) {
+        NetIGMP_HostGrpStateChng(p_host_grp);
+    }
 
    *p_err = NET_IGMP_ERR_NONE;
+
+    return (DEF_OK);
 }
 
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
-*********************************************************************************************************
+*                                      NetIGMP_HostGrpSrcRemove()
+*
+* Description : Remove a source filter from a host group.
+*
+* Argument(s) : if_nbr      Interface number of host group.
+*
+*               addr_grp    IP address of host group (see Note #2).
+*
+*               addr_src    IP address of filtered source (see Note #2).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                                                                   - RETURNED BY NetIGMP_HostGrpSrcRemoveHandler() : -
+*                               NET_IGMP_ERR_NONE                   Source filter successfully removed.
+*                               NET_IGMP_ERR_HOST_GRP_NOT_FOUND     Host group NOT found.
+*                               NET_IGMP_ERR_SRC_NOT_FOUND          Source     NOT found.
+*                               NET_INIT_ERR_NOT_COMPLETED          Network initialization NOT complete.
+*
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : ------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
+*
+*                               NET_ERR_FAULT_FEATURE_DIS           Source filtering disabled (see Note #3).
+*
+* Return(s)   : DEF_OK,   if source filter successfully removed.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application interface (API) function & MAY be
+*               called by application function(s) [see also Note #1].
+*
+* Note(s)     : (1) NetIGMP_HostGrpSrcRemove() MUST NOT be called with the global network lock already
+*                   acquired.
+*
+*                   See also 'NetIGMP_HostGrpLeave()  Note #1'.
+*
+*               (2) IP addresses MUST be in host-order.
+*
+*               (3) Source filters are ONLY available if NET_MCAST_CFG_SRC_FILTER_EN is enabled (see
+*                   'net_igmp.h  Note #2f').
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetIGMP_HostGrpSrcRemove (NET_IF_NBR      if_nbr,
+                                       NET_IPv4_ADDR   addr_grp,
+                                       NET_IPv4_ADDR   addr_src,
+                                       NET_ERR        *p_err)
+{
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+    CPU_BOOLEAN  src_remove;
+#endif
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+#endif
+
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+                                                                /* Acquire net lock (see Note #1).                      */
+    Net_GlobalLockAcquire((void *)&NetIGMP_HostGrpSrcRemove, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         return (DEF_FAIL);
+    }
+                                                                /* Remove src filter.                                   */
+    src_remove = NetIGMP_HostGrpSrcRemoveHandler(if_nbr, addr_grp, addr_src, p_err);
+
+    Net_GlobalLockRelease();                                    /* Release net lock.                                    */
+
+    return (src_remove);
+
+#else
+   (void)&if_nbr;
+   (void)&addr_grp;
+   (void)&addr_src;
+   *p_err = NET_ERR_FAULT_FEATURE_DIS;                          /* See Note #3.                                         */
+    return (DEF_FAIL);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                   NetIGMP_HostGrpSrcRemoveHandler()
+*
+* Description : (1) Remove a source filter from a host group :
+*
+*                   (a) Search host group & source entry
+*                   (b) Dereference source entry; free it on last reference
+*                   (c) Remove host group on last INCLUDE source reference, if NOT joined for any source
+*                   (d) Advertise new filter state to multicast router(s)
+*
+*
+* Argument(s) : if_nbr      Interface number of host group.
+*
+*               addr_grp    IP address of host group (see Note #3).
+*
+*               addr_src    IP address of filtered source (see Note #3).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*                               (see 'NetIGMP_HostGrpSrcRemove()').
+*
+* Return(s)   : DEF_OK,   if source filter successfully removed.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetIGMP_HostGrpSrcRemove().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetIGMP_HostGrpSrcRemoveHandler() is called by network protocol suite function(s) &
+*                   MUST be called with the global network lock already acquired.
+*
+*               (3) IP addresses MUST be in host-order.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetIGMP_HostGrpSrcRemoveHandler (NET_IF_NBR      if_nbr,
+                                              NET_IPv4_ADDR   addr_grp,
+                                              NET_IPv4_ADDR   addr_src,
+                                              NET_ERR        *p_err)
+{
+    NET_IGMP_HOST_GRP      *p_host_grp;
+    NET_IGMP_HOST_GRP_SRC  *p_src;
+    NET_IGMP_FILTER_MODE    filter_mode;
+    CPU_BOOLEAN             src_freed;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        return (DEF_FAIL);
+    }
+#endif
+
+                                                                /* ---------------- SRCH HOST GRP/SRC ----------------- */
+    p_host_grp = NetIGMP_HostGrpSrch(if_nbr, addr_grp);
+    if (p_host_grp == (NET_IGMP_HOST_GRP *)0) {
+       *p_err =  NET_IGMP_ERR_HOST_GRP_NOT_FOUND;
+        return (DEF_FAIL);
+    }
+
+    p_src = NetIGMP_HostGrpSrcSrch(p_host_grp, addr_src);
+    if (p_src == (NET_IGMP_HOST_GRP_SRC *)0) {
+       *p_err =  NET_IGMP_ERR_SRC_NOT_FOUND;
+        return (DEF_FAIL);
+    }
+
+                                                                /* ------------------ DEREF SRC ENTRY ----------------- */
+    filter_mode = p_src->FilterMode;
+    src_freed   = DEF_NO;
+    p_src->RefCtr--;
+    if (p_src->RefCtr < 1u) {
+        NetIGMP_HostGrpSrcDel(p_host_grp, p_src);
+        src_freed = DEF_YES;
+    }
+
+    if (filter_mode == NET_IGMP_FILTER_MODE_INCLUDE) {
+        p_host_grp->RefCtr--;
+        if (p_host_grp->RefCtr < 1u) {                          /* If last ref to host grp, ...                         */
+            NetIGMP_HostGrpLeaveTx(p_host_grp);                 /* ... advertise leave ...                              */
+            NetIGMP_HostGrpRemove(p_host_grp);                  /* ... & remove host grp.                               */
+           *p_err = NET_IGMP_ERR_NONE;
+            return (DEF_OK);
+        }
+    }
+
+                                                                /* ------------ ADVERTISE NEW FILTER STATE ------------ */
+    if (src_freed == DEF_YES) {
+        NetIGMP_HostGrpStateChng(p_host_grp);
+    }
+
+   *p_err = NET_IGMP_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetIGMP_IsGrpJoinedOnIF()
+*
+* Description : Check for joined host group on specified interface.
+*
+* Argument(s) : if_nbr      Interface number to search.
+*
+*               addr_grp    IP address of host group.
+*
+* Return(s)   : DEF_YES, if host group address joined on interface.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetIP_RxPktValidate().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetIGMP_IsGrpJoinedOnIF (NET_IF_NBR     if_nbr,
+                                      NET_IPv4_ADDR  addr_grp)
+{
+    NET_IGMP_HOST_GRP  *p_host_grp;
+    CPU_BOOLEAN         grp_joined;
+
+
+    p_host_grp  =  NetIGMP_HostGrpSrch(if_nbr, addr_grp);
+    grp_joined = (p_host_grp != (NET_IGMP_HOST_GRP *)0) ? DEF_YES : DEF_NO;
+
+    return (grp_joined);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetIGMP_IsSrcAllowedOnIF()
+*
+* Description : Check host group source filter for a received datagram.
+*
+* Argument(s) : if_nbr      Interface number the datagram was received on.
+*
+*               addr_grp    IP address of host group (i.e. the datagram's destination address).
+*
+*               addr_src    IP address of the datagram's source.
+*
+* Return(s)   : DEF_YES, if host group joined on interface & source NOT filtered out.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetIPv4_RxPktValidate().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Interface multicast address filters are typically imperfect (i.e. hashed) & may pass
+*                   datagrams for groups & sources NOT requested; the source filter is therefore ALWAYS
+*                   enforced in software (see RFC #3376, Section 3.2).
+*
+*               (2) See 'net_igmp.c  IGMP HOST GROUP SOURCE DATA TYPE  Note #2'.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetIGMP_IsSrcAllowedOnIF (NET_IF_NBR     if_nbr,
+                                       NET_IPv4_ADDR  addr_grp,
+                                       NET_IPv4_ADDR  addr_src)
+{
+    NET_IGMP_HOST_GRP      *p_host_grp;
+    NET_IGMP_HOST_GRP_SRC  *p_src;
+    NET_IGMP_FILTER_MODE    filter_mode;
+    CPU_BOOLEAN             src_allowed;
+
+
+    p_host_grp = NetIGMP_HostGrpSrch(if_nbr, addr_grp);
+    if (p_host_grp == (NET_IGMP_HOST_GRP *)0) {
+        return (DEF_NO);
+    }
+
+    if (p_host_grp->SrcNbr < 1u) {                              /* If NO src filters, accept any src.                   */
+        return (DEF_YES);
+    }
+
+    filter_mode = NetIGMP_HostGrpFilterModeGet(p_host_grp);     /* See Note #2.                                         */
+    p_src       = NetIGMP_HostGrpSrcSrch(p_host_grp, addr_src);
+
+    if (filter_mode == NET_IGMP_FILTER_MODE_EXCLUDE) {
+        src_allowed = ((p_src             == (NET_IGMP_HOST_GRP_SRC *)0) ||
+                       (p_src->FilterMode != NET_IGMP_FILTER_MODE_EXCLUDE)) ? DEF_YES : DEF_NO;
+    } else {
+        src_allowed = ((p_src             != (NET_IGMP_HOST_GRP_SRC *)0) &&
+                       (p_src->FilterMode == NET_IGMP_FILTER_MODE_INCLUDE)) ? DEF_YES : DEF_NO;
+    }
+
+    return (src_allowed);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             NetIGMP_Rx()
+*
+* Description : (1) Process received IGMP packets & update host group status :
+*
+*                   (a) Validate IGMP packet
+*                   (b) Update   IGMP host group status
+*                   (c) Free     IGMP packet
+*                   (d) Update receive statistics
+*
+*               (2) Although IGMP data units are typically referred to as 'messages' (see RFC #1112,
+*                   Appendix I), the term 'IGMP packet' (see RFC #1983, 'packet') is used for IGMP
+*                   Receive until the packet is validated as an IGMP message.
+*
+*
+* Argument(s) : p_buf        Pointer to network buffer that received IGMP packet.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IGMP_ERR_NONE               IGMP packet successfully received & processed.
+*
+*                                                               ---- RETURNED BY NetIGMP_RxPktDiscard() : ----
+*                               NET_ERR_RX                      Receive error; packet discarded.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIP_RxPktDemuxDatagram().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  NetIGMP_Rx (NET_BUF  *p_buf,
+                  NET_ERR  *p_err)
+{
+#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)
+    NET_CTR       *p_ctr;
+#endif
+    NET_BUF_HDR   *p_buf_hdr;
+    NET_IGMP_HDR  *p_igmp_hdr;
+    NET_IF_NBR     if_nbr;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* ------------------- VALIDATE PTR ------------------- */
+    if (p_buf == (NET_BUF *)0) {
+        NetIGMP_RxPktDiscard(p_buf, p_err);
+        NET_CTR_ERR_INC(Net_ErrCtrs.IGMP.NullPtrCtr);
+        return;
+    }
+#endif
+
+
+    NET_CTR_STAT_INC(Net_StatCtrs.IGMP.RxMsgCtr);
+
+
+                                                                /* -------------- VALIDATE RX'D IGMP PKT -------------- */
+    p_buf_hdr = &p_buf->Hdr;
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    NetIGMP_RxPktValidateBuf(p_buf_hdr, p_err);                 /* Validate rx'd buf.                                   */
+    switch (*p_err) {
+        case NET_IGMP_ERR_NONE:
+             break;
+
+
+        case NET_ERR_INVALID_PROTOCOL:
+        case NET_BUF_ERR_INVALID_IX:
+        default:
+             NetIGMP_RxPktDiscard(p_buf, p_err);
+             return;
+    }
+#endif
+    p_igmp_hdr = (NET_IGMP_HDR *)&p_buf->DataPtr[p_buf_hdr->IGMP_MsgIx];
+    if_nbr    =  p_buf_hdr->IF_Nbr;
+    NetIGMP_RxPktValidate(p_buf, p_buf_hdr, p_igmp_hdr, p_err); /* Validate rx'd pkt.                                   */
+
+
+                                                                /* ------------------ DEMUX IGMP MSG ------------------ */
+    switch (*p_err) {
+        case NET_IGMP_ERR_MSG_TYPE_QUERY:
+             NetIGMP_RxMsgQuery(if_nbr, p_igmp_hdr, p_buf_hdr->IGMP_MsgLen);
+
+#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)
+             p_ctr = &Net_StatCtrs.IGMP.RxMsgQueryCtr;
+#endif
+             break;
+
+
+        case NET_IGMP_ERR_MSG_TYPE_REPORT:
+             NetIGMP_RxMsgReport(if_nbr, p_igmp_hdr);
+
+#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)
+             p_ctr = &Net_StatCtrs.IGMP.RxMsgReportCtr;
+#endif
+             break;
+
+
+        case NET_IGMP_ERR_INVALID_VER:
+        case NET_IGMP_ERR_INVALID_TYPE:
+        case NET_IGMP_ERR_INVALID_LEN:
+        case NET_IGMP_ERR_INVALID_CHK_SUM:
+        case NET_IGMP_ERR_INVALID_ADDR_DEST:
+        case NET_IGMP_ERR_INVALID_ADDR_GRP:
+        default:
+             NetIGMP_RxPktDiscard(p_buf, p_err);
+             return;
+    }
+
+
+    NetIGMP_RxPktFree(p_buf);                                   /* ------------------- FREE IGMP PKT ------------------ */
+
+                                                                /* ------------------ UPDATE RX STATS ----------------- */
+    NET_CTR_STAT_INC(Net_StatCtrs.IGMP.RxMsgCompCtr);
+    NET_CTR_STAT_INC(*p_ctr);
+
+
+   *p_err = NET_IGMP_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
 */
 
 /*
@@ -1256,6 +1907,10 @@ static  void  NetIGMP_RxPktValidateBuf (NET_BUF_HDR  *p_buf_hdr,
 *
 *                   (b) Since IGMP message headers do NOT contain a message length field, the IGMP Message
 *                       Length is assumed to be the remaining IP Datagram Length.
+*
+*               (5) IGMPv2 & IGMPv3 queries share the IGMPv1 query ver/type octet (0x11).  Group-specific
+*                   queries are sent to the queried group address rather than the all-hosts address
+*                   (see RFC #3376, Section 4.1.12).
 *********************************************************************************************************
 */
 
@@ -1301,8 +1956,9 @@ static  void  NetIGMP_RxPktValidate (NET_BUF       *p_buf,
     igmp_type = p_igmp_hdr->Ver_Type & NET_IGMP_HDR_TYPE_MASK;
 
     switch (igmp_type) {
-        case NET_IGMP_MSG_TYPE_QUERY:
-             if (p_buf_hdr->IP_AddrDest != NET_IPv4_ADDR_MULTICAST_ALL_HOSTS) {
+        case NET_IGMP_MSG_TYPE_QUERY:                           /* General or grp-specific query (see Note #5).         */
+             if ((p_buf_hdr->IP_AddrDest != NET_IPv4_ADDR_MULTICAST_ALL_HOSTS) &&
+                 (p_buf_hdr->IP_AddrDest != igmp_grp_addr)) {
                  NET_CTR_ERR_INC(Net_ErrCtrs.IGMP.RxPktInvalidAddrDestCtr);
                 *p_err = NET_IGMP_ERR_INVALID_ADDR_DEST;
                  return;
@@ -1349,9 +2005,10 @@ static  void  NetIGMP_RxPktValidate (NET_BUF       *p_buf,
 *
 * Description : (1) Process IGMP received query :
 *
-*                   (a) Search host group in IDLE     state
-*                   (b) Configure timer for host group
-*                   (c) Set    host group in DELAYING state
+*                   (a) Select interface IGMP compatibility mode
+*                   (b) Search host group(s) in IDLE     state
+*                   (c) Configure timer for host group
+*                   (d) Set    host group in DELAYING state
 *
 *
 * Argument(s) : if_nbr      Interface number the packet was received from.
@@ -1359,6 +2016,8 @@ static  void  NetIGMP_RxPktValidate (NET_BUF       *p_buf,
 *               p_igmp_hdr  Pointer to received packet's IGMP header.
 *               ----------  Argument validated in NetIGMP_Rx().
 *
+*               msg_len     Length of received IGMP message (see Note #4).
+*
 * Return(s)   : none.
 *
 * Caller(s)   : NetIGMP_Rx().
@@ -1366,29 +2025,74 @@ static  void  NetIGMP_RxPktValidate (NET_BUF       *p_buf,
 * Note(s)     : (2) See 'net_igmp.h  IGMP HEADER' for IGMP header format.
 *
 *               (3) See 'net_igmp.h  IGMP HOST GROUP STATES  Note #1' for state transitions.
+*
+*               (4) (a) An interface reports in IGMPv1 compatibility mode while IGMPv1 or IGMPv2 queries
+*                       are received, & in IGMPv3 mode once an IGMPv3 query is received.
+*
+*                   (b) IGMPv2 routers accept IGMPv1 reports (see RFC #2236, Section 5).
+*
+*                   (c) If source filtering is disabled, interfaces ALWAYS report in IGMPv1 compatibility
+*                       mode (see 'net_igmp.h  Note #2f').
+*
+*                   See also 'net_igmp.c  IGMPv3 MESSAGE DEFINES  Note #1'.
+*
+*               (5) IGMPv1 queries carry NO maximum response time; a default maximum delay of
+*                   NET_IGMP_HOST_GRP_REPORT_DLY_MAX_SEC seconds is used.  Otherwise, the maximum delay
+*                   is decoded from the Max Resp Code (see 'net_igmp.c  IGMPv3 MESSAGE DEFINES  Note #3').
+*
+*               (6) Group-and-source-specific queries are answered with the group's current state.
 *********************************************************************************************************
 */
 
 static  void  NetIGMP_RxMsgQuery (NET_IF_NBR     if_nbr,
-                                  NET_IGMP_HDR  *p_igmp_hdr)
+                                  NET_IGMP_HDR  *p_igmp_hdr,
+                                  CPU_INT16U     msg_len)
 {
     NET_IGMP_HOST_GRP  *p_host_grp;
-    CPU_INT16U          timeout_sec;
+    NET_IPv4_ADDR       addr_grp;
+    CPU_INT08U          max_resp_code;
+    CPU_INT08U          max_resp_exp;
+    CPU_INT32U          max_resp_tenths;
+    CPU_INT32U          timeout_tenths;
     NET_TMR_TICK        timeout_tick;
     NET_ERR             err;
 
 
-   (void)&p_igmp_hdr;                                           /* Prevent 'variable unused' compiler warning.          */
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+                                                                /* ------------- SEL IF COMPATIBILITY MODE ------------ */
+    NetIGMP_CompatV1OnIF[if_nbr] = (msg_len < NET_IGMP_V3_QUERY_MSG_SIZE_MIN) ? DEF_YES : DEF_NO;
+#else
+   (void)&msg_len;                                              /* Prevent 'variable unused' warning (see Note #4c).    */
+#endif
+
+                                                                /* -------------- DECODE MAX RESP DLY ----------------- */
+    max_resp_code = p_igmp_hdr->Unused;                         /* See Note #5.                                         */
+    if (max_resp_code == 0u) {
+        max_resp_tenths = (CPU_INT32U)NET_IGMP_HOST_GRP_REPORT_DLY_MAX_SEC * 10u;
+
+    } else if ((max_resp_code & NET_IGMP_V3_MAX_RESP_CODE_FLOAT) == 0u) {
+        max_resp_tenths = (CPU_INT32U)max_resp_code;
+
+    } else {
+        max_resp_exp    = (max_resp_code & NET_IGMP_V3_MAX_RESP_CODE_EXP_MASK) >> NET_IGMP_V3_MAX_RESP_CODE_EXP_SHIFT;
+        max_resp_tenths = ((CPU_INT32U)(max_resp_code & NET_IGMP_V3_MAX_RESP_CODE_MANT_MASK) | 0x10u) << (max_resp_exp + 3u);
+    }
+
+    NET_UTIL_VAL_COPY_GET_NET_32(&addr_grp, &p_igmp_hdr->AddrGrp);
+    if (addr_grp != NET_IPv4_ADDR_NONE) {                       /* For grp-specific query, ...                          */
+        p_host_grp = NetIGMP_HostGrpSrch(if_nbr, addr_grp);     /* ... handle ONLY queried host grp.                    */
+    } else {
+        p_host_grp = NetIGMP_HostGrpListHead;
+    }
 
-    p_host_grp = NetIGMP_HostGrpListHead;
     while (p_host_grp != (NET_IGMP_HOST_GRP *)0) {              /* Handle ALL host grp in host grp list.                */
         if (p_host_grp->IF_Nbr == if_nbr) {                     /* If host grp IF nbr is query IF nbr & ..              */
                                                                 /* .. host grp state  is IDLE,          ..              */
             if (p_host_grp->State == NET_IGMP_HOST_GRP_STATE_IDLE) {
                                                                 /* .. calc new rand timeout             ..              */
                 NetIGMP_RandSeed   =  Math_RandSeed(NetIGMP_RandSeed);
-                timeout_sec        =  NetIGMP_RandSeed % (CPU_INT16U)(NET_IGMP_HOST_GRP_REPORT_DLY_MAX_SEC + 1);
-                timeout_tick       = (NET_TMR_TICK)(timeout_sec * NET_TMR_TIME_TICK_PER_SEC);
+                timeout_tenths     =  NetIGMP_RandSeed % (max_resp_tenths + 1u);
+                timeout_tick       = (NET_TMR_TICK)((timeout_tenths * NET_TMR_TIME_TICK_PER_SEC) / 10u);
 
                                                                 /* .. & set tmr.                                        */
                 p_host_grp->TmrPtr =  NetTmr_Get((CPU_FNCT_PTR ) NetIGMP_HostGrpReportDlyTimeout,
@@ -1404,6 +2108,10 @@ static  void  NetIGMP_RxMsgQuery (NET_IF_NBR     if_nbr,
             }
         }
 
+        if (addr_grp != NET_IPv4_ADDR_NONE) {                   /* Grp-specific query handled.                          */
+            break;
+        }
+
         p_host_grp = (NET_IGMP_HOST_GRP *)p_host_grp->NextPtr;
     }
 }
@@ -1432,6 +2140,9 @@ static  void  NetIGMP_RxMsgQuery (NET_IF_NBR     if_nbr,
 * Note(s)     : (2) See 'net_igmp.h  IGMP HEADER' for IGMP header format.
 *
 *               (3) See 'net_igmp.h  IGMP HOST GROUP STATES  Note #1' for state transitions.
+*
+*               (4) RFC #3376, Section 5.1 states that IGMPv3 hosts do NOT suppress their reports; other
+*                   members' reports are therefore ONLY honored in IGMPv1 compatibility mode.
 *********************************************************************************************************
 */
 
@@ -1442,6 +2153,10 @@ static  void  NetIGMP_RxMsgReport (NET_IF_NBR     if_nbr,
     NET_IGMP_HOST_GRP  *p_host_grp;
 
 
+    if (NetIGMP_CompatV1OnIF[if_nbr] != DEF_YES) {              /* See Note #4.                                         */
+        return;
+    }
+
     NET_UTIL_VAL_COPY_GET_NET_32(&addr_grp, &p_igmp_hdr->AddrGrp);
 
     p_host_grp = NetIGMP_HostGrpSrch(if_nbr, addr_grp);
@@ -1757,7 +2472,8 @@ static  void  NetIGMP_TxMsg (NET_IF_NBR      if_nbr,
 *                       (2) Get host group's source IP address
 *                       (3) Get host group's        IP address
 *
-*                   (b) Update transmit statistics
+*                   (b) Transmit IGMPv3 report, or IGMPv1 report in compatibility mode (see Note #2)
+*                   (c) Update transmit statistics
 *
 *
 * Argument(s) : p_host_grp  Pointer to host group to transmit report.
@@ -1780,52 +2496,266 @@ static  void  NetIGMP_TxMsg (NET_IF_NBR      if_nbr,
 *
 * Caller(s)   : NetIGMP_HostGrpJoinHandler(),
 *               NetIGMP_HostGrpReportDlyTimeout(),
+*               NetIGMP_HostGrpStateChng(),
+*               NetIGMP_HostGrpLeaveTx(),
 *               NetIGMP_RxMsgQuery().
 *
-* Note(s)     : none.
+* Note(s)     : (2) (a) In IGMPv3 mode, a State-Change Record (CHANGE_TO_INCLUDE_MODE/CHANGE_TO_EXCLUDE_MODE)
+*                       is reported while a filter state change is pending; otherwise a Current-State
+*                       Record (MODE_IS_INCLUDE/MODE_IS_EXCLUDE) is reported (see RFC #3376, Section 4.2.12).
+*
+*                   (b) In IGMPv1 compatibility mode, source lists are ignored (see RFC #3376, Section 7.2.1).
+*********************************************************************************************************
+*/
+
+static  void  NetIGMP_TxMsgReport (NET_IGMP_HOST_GRP  *p_host_grp,
+                                   NET_ERR            *p_err)
+{
+    NET_IF_NBR            if_nbr;
+    NET_IP_ADDRS_QTY      addr_ip_tbl_qty;
+    NET_IPv4_ADDR         addr_ip_tbl[NET_IPv4_CFG_IF_MAX_NBR_ADDR];
+    NET_IPv4_ADDR         addr_src;
+    NET_IPv4_ADDR         addr_grp;
+    NET_IGMP_FILTER_MODE  filter_mode;
+    CPU_BOOLEAN           state_chng;
+    CPU_INT08U            rec_type;
+    NET_ERR               err;
+
+
+                                                                /* ------------- PREPARE IGMP REPORT MSG -------------- */
+    if_nbr          = p_host_grp->IF_Nbr;                       /* Get IGMP host grp IF nbr.                            */
+    addr_ip_tbl_qty = sizeof(addr_ip_tbl) / sizeof(NET_IPv4_ADDR);
+   (void)NetIPv4_GetAddrHostHandler((NET_IF_NBR        ) if_nbr,
+                                    (NET_IPv4_ADDR    *)&addr_ip_tbl[0],
+                                    (NET_IP_ADDRS_QTY *)&addr_ip_tbl_qty,
+                                    (NET_ERR          *)&err);
+    if (err != NET_IPv4_ERR_NONE) {
+       *p_err = NET_IGMP_ERR_INVALID_ADDR_SRC;
+        return;
+    }
+
+    addr_src = addr_ip_tbl[0];                                  /* Get IGMP host grp src addr.                          */
+    addr_grp = p_host_grp->AddrGrp;                             /* Get IGMP host grp     addr.                          */
+
+
+                                                                /* ---------------- TX IGMP REPORT MSG ---------------- */
+    if (NetIGMP_CompatV1OnIF[if_nbr] != DEF_YES) {              /* See Note #2a.                                        */
+        filter_mode = NetIGMP_HostGrpFilterModeGet(p_host_grp);
+        state_chng  = DEF_BIT_IS_SET(p_host_grp->Flags, NET_IGMP_FLAG_STATE_CHNG);
+        if (state_chng == DEF_YES) {
+            rec_type = (filter_mode == NET_IGMP_FILTER_MODE_INCLUDE) ? NET_IGMP_V3_REC_TYPE_CHANGE_TO_INCLUDE
+                                                                     : NET_IGMP_V3_REC_TYPE_CHANGE_TO_EXCLUDE;
+        } else {
+            rec_type = (filter_mode == NET_IGMP_FILTER_MODE_INCLUDE) ? NET_IGMP_V3_REC_TYPE_MODE_IS_INCLUDE
+                                                                     : NET_IGMP_V3_REC_TYPE_MODE_IS_EXCLUDE;
+        }
+
+        NetIGMP_TxMsgReportV3(p_host_grp, addr_src, rec_type, p_err);
+
+    } else {                                                    /* See Note #2b.                                        */
+        NetIGMP_TxMsg((NET_IF_NBR   )if_nbr,
+                      (NET_IPv4_ADDR)addr_src,
+                      (NET_IPv4_ADDR)addr_grp,
+                      (CPU_INT08U   )NET_IGMP_MSG_TYPE_REPORT,
+                      (NET_ERR     *)p_err);
+    }
+    if (*p_err != NET_IGMP_ERR_NONE) {
+         return;
+    }
+
+
+                                                                /* ------------------ UPDATE TX STATS ----------------- */
+    NET_CTR_STAT_INC(Net_StatCtrs.IGMP.TxMsgReportCtr);
+
+
+   *p_err = NET_IGMP_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetIGMP_TxMsgReportV3()
+*
+* Description : (1) Prepare & transmit an IGMPv3 Membership Report for a single host group :
+*
+*                   (a) Collect host group source list for record's filter mode
+*                   (b) Get buffer for IGMP Message
+*                   (c) Prepare IGMPv3 Report header & group record (see RFC #3376, Section 4.2)
+*                   (d) Transmit IGMP Message to all IGMPv3-capable routers
+*
+*
+* Argument(s) : p_host_grp  Pointer to host group to report.
+*               ----------  Argument checked in NetIGMP_TxMsgReport().
+*
+*               addr_src    Source IP address (see Note #2).
+*
+*               rec_type    IGMPv3 group record type.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IGMP_ERR_NONE               IGMP message successfully transmitted.
+*
+*                                                               -- RETURNED BY NetIGMP_TxPktDiscard() : ---
+*                               NET_ERR_TX                      Transmit error; packet discarded.
+*
+*                                                               --------- RETURNED BY NetIP_Tx() : --------
+*                               NET_ERR_IF_LOOPBACK_DIS         Loopback interface disabled.
+*                               NET_ERR_IF_LINK_DOWN            Network  interface link state down (i.e.
+*                                                                   NOT available for receive or transmit).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIGMP_TxMsgReport().
+*
+* Note(s)     : (2) IP addresses MUST be in host-order.
+*
+*               (3) See 'NetIGMP_TxMsg()  Notes #5 & #6'.
 *********************************************************************************************************
 */
 
-static  void  NetIGMP_TxMsgReport (NET_IGMP_HOST_GRP  *p_host_grp,
-                                   NET_ERR            *p_err)
-{
-    NET_IF_NBR        if_nbr;
-    NET_IP_ADDRS_QTY  addr_ip_tbl_qty;
-    NET_IPv4_ADDR     addr_ip_tbl[NET_IPv4_CFG_IF_MAX_NBR_ADDR];
-    NET_IPv4_ADDR     addr_src;
-    NET_IPv4_ADDR     addr_grp;
-    NET_ERR           err;
+static  void  NetIGMP_TxMsgReportV3 (NET_IGMP_HOST_GRP  *p_host_grp,
+                                     NET_IPv4_ADDR       addr_src,
+                                     CPU_INT08U          rec_type,
+                                     NET_ERR            *p_err)
+{
+    NET_BUF               *pmsg_buf;
+    NET_BUF_HDR           *pmsg_buf_hdr;
+    CPU_INT08U            *p_msg;
+    NET_IGMP_HOST_GRP_SRC *p_src;
+    NET_IGMP_FILTER_MODE   filter_mode;
+    NET_IF_NBR             if_nbr;
+    CPU_INT16U             msg_len;
+    CPU_INT16U             msg_ix;
+    CPU_INT16U             msg_ix_offset;
+    CPU_INT16U             src_nbr;
+    CPU_INT16U             rec_nbr;
+    CPU_INT16U             igmp_chk_sum;
+    CPU_INT16U             i;
+    NET_IPv4_ADDR          addr_dest;
+    NET_ERR                err;
+
+
+                                                                /* ----------------- CALC IGMP MSG LEN ---------------- */
+    if_nbr      = p_host_grp->IF_Nbr;
+    filter_mode = ((rec_type == NET_IGMP_V3_REC_TYPE_MODE_IS_INCLUDE) ||
+                   (rec_type == NET_IGMP_V3_REC_TYPE_CHANGE_TO_INCLUDE)) ? NET_IGMP_FILTER_MODE_INCLUDE
+                                                                         : NET_IGMP_FILTER_MODE_EXCLUDE;
+    src_nbr     = 0u;
+    for (i = 0u; i < p_host_grp->SrcNbr; i++) {
+        if (p_host_grp->SrcTbl[i].FilterMode == filter_mode) {
+            src_nbr++;
+        }
+    }
+
+    msg_len = NET_IGMP_V3_REPORT_HDR_SIZE  +
+              NET_IGMP_V3_GRP_REC_HDR_SIZE +
+             (src_nbr * sizeof(NET_IPv4_ADDR));
+
+
+                                                                /* ------------------ GET IGMP TX BUF ----------------- */
+    msg_ix = 0u;
+    NetIGMP_TxIxDataGet(if_nbr, msg_len, &msg_ix, &err);
+    if (err != NET_IGMP_ERR_NONE) {
+       *p_err = NET_ERR_TX;
+        return;
+    }
+
+    pmsg_buf = NetBuf_Get(if_nbr,
+                          NET_TRANSACTION_TX,
+                          msg_len,
+                          msg_ix,
+                         &msg_ix_offset,
+                          NET_BUF_FLAG_NONE,
+                         &err);
+    if (err != NET_BUF_ERR_NONE) {
+        NetIGMP_TxPktDiscard(pmsg_buf, p_err);
+        return;
+    }
+
+    msg_ix += msg_ix_offset;
+
+                                                                /* Init msg buf ctrls.                                  */
+    pmsg_buf_hdr                        = &pmsg_buf->Hdr;
+    pmsg_buf_hdr->IGMP_MsgIx            = (CPU_INT16U  )msg_ix;
+    pmsg_buf_hdr->IGMP_MsgLen           = (CPU_INT16U  )msg_len;
+    pmsg_buf_hdr->TotLen                = (NET_BUF_SIZE)pmsg_buf_hdr->IGMP_MsgLen;
+    pmsg_buf_hdr->ProtocolHdrType       =  NET_PROTOCOL_TYPE_IGMP;
+    pmsg_buf_hdr->ProtocolHdrTypeNetSub =  NET_PROTOCOL_TYPE_IGMP;
+
 
+                                                                /* ---------------- PREPARE IGMPv3 MSG ---------------- */
+    p_msg = &pmsg_buf->DataPtr[pmsg_buf_hdr->IGMP_MsgIx];
+    Mem_Clr(p_msg, NET_IGMP_V3_REPORT_HDR_SIZE + NET_IGMP_V3_GRP_REC_HDR_SIZE);
 
-                                                                /* ------------- PREPARE IGMP REPORT MSG -------------- */
-    if_nbr          = p_host_grp->IF_Nbr;                       /* Get IGMP host grp IF nbr.                            */
-    addr_ip_tbl_qty = sizeof(addr_ip_tbl) / sizeof(NET_IPv4_ADDR);
-   (void)NetIPv4_GetAddrHostHandler((NET_IF_NBR        ) if_nbr,
-                                    (NET_IPv4_ADDR    *)&addr_ip_tbl[0],
-                                    (NET_IP_ADDRS_QTY *)&addr_ip_tbl_qty,
-                                    (NET_ERR          *)&err);
-    if (err != NET_IPv4_ERR_NONE) {
-       *p_err = NET_IGMP_ERR_INVALID_ADDR_SRC;
-        return;
-    }
+    p_msg[0] = NET_IGMP_V3_MSG_TYPE_REPORT;                     /* Report hdr : type, reserved, chk sum, reserved, ...  */
+    rec_nbr  = 1u;
+    NET_UTIL_VAL_COPY_SET_NET_16(&p_msg[6], &rec_nbr);          /* ... nbr of grp recs.                                 */
 
-    addr_src = addr_ip_tbl[0];                                  /* Get IGMP host grp src addr.                          */
-    addr_grp = p_host_grp->AddrGrp;                             /* Get IGMP host grp     addr.                          */
+    p_msg   += NET_IGMP_V3_REPORT_HDR_SIZE;
+    p_msg[0] = rec_type;                                        /* Grp rec : rec type, aux data len, nbr of srcs, ...   */
+    NET_UTIL_VAL_COPY_SET_NET_16(&p_msg[2], &src_nbr);
+    NET_UTIL_VAL_COPY_SET_NET_32(&p_msg[4], &p_host_grp->AddrGrp);  /* ... grp addr, ...                             */
 
+    p_msg   += NET_IGMP_V3_GRP_REC_HDR_SIZE;
+    p_src    = &p_host_grp->SrcTbl[0];
+    for (i = 0u; i < p_host_grp->SrcNbr; i++) {                 /* ... src addrs.                                       */
+        if (p_src->FilterMode == filter_mode) {
+            NET_UTIL_VAL_COPY_SET_NET_32(p_msg, &p_src->AddrSrc);
+            p_msg += sizeof(NET_IPv4_ADDR);
+        }
+        p_src++;
+    }
 
-                                                                /* ---------------- TX IGMP REPORT MSG ---------------- */
-    NetIGMP_TxMsg((NET_IF_NBR   )if_nbr,
-                  (NET_IPv4_ADDR)addr_src,
-                  (NET_IPv4_ADDR)addr_grp,
-                  (CPU_INT08U   )NET_IGMP_MSG_TYPE_REPORT,
-                  (NET_ERR     *)p_err);
-    if (*p_err != NET_IGMP_ERR_NONE) {
+                                                                /* Calc chk sum (see Note #3).                          */
+    p_msg        = &pmsg_buf->DataPtr[pmsg_buf_hdr->IGMP_MsgIx];
+    igmp_chk_sum =  NetUtil_16BitOnesCplChkSumHdrCalc((void     *)p_msg,
+                                                      (CPU_INT16U)msg_len,
+                                                      (NET_ERR  *)p_err);
+    if (*p_err != NET_UTIL_ERR_NONE) {
+         NetIGMP_TxPktDiscard(pmsg_buf, p_err);
          return;
     }
 
+    NET_UTIL_VAL_COPY_16(&p_msg[2], &igmp_chk_sum);
 
-                                                                /* ------------------ UPDATE TX STATS ----------------- */
-    NET_CTR_STAT_INC(Net_StatCtrs.IGMP.TxMsgReportCtr);
+
+                                                                /* ------------------- TX IGMP MSG -------------------- */
+    addr_dest = NET_IGMP_V3_ADDR_ALL_ROUTERS;
+    NetIPv4_Tx(pmsg_buf,
+               addr_src,
+               addr_dest,
+               NET_IPv4_TOS_DFLT,
+               NET_IPv4_TTL_MULTICAST_IGMP,
+               NET_IPv4_FLAG_NONE,
+               DEF_NULL,
+               p_err);
+
+
+                                                                /* --------- FREE IGMP MSG / UPDATE TX STATS ---------- */
+    switch (*p_err) {
+        case NET_IPv4_ERR_NONE:
+             NetIGMP_TxPktFree(pmsg_buf);
+             NET_CTR_STAT_INC(Net_StatCtrs.IGMP.TxMsgCtr);
+             break;
+
+
+        case NET_ERR_TX:
+        case NET_ERR_IF_LINK_DOWN:
+        case NET_ERR_IF_LOOPBACK_DIS:
+             NET_CTR_ERR_INC(Net_ErrCtrs.IGMP.TxPktDiscardedCtr);
+             return;
+
+
+        case NET_IPv4_ERR_TX_PKT:
+             NET_CTR_ERR_INC(Net_ErrCtrs.IGMP.TxPktDiscardedCtr);
+            *p_err = NET_ERR_TX;
+             return;
+
+
+        default:
+             NetIGMP_TxPktDiscard(pmsg_buf, p_err);
+             return;
+    }
 
 
    *p_err = NET_IGMP_ERR_NONE;
@@ -2020,9 +2950,17 @@ static  void  NetIGMP_TxPktDiscard (NET_BUF  *p_buf,
 * Caller(s)   : NetIGMP_HostGrpJoinHandler(),
 *               NetIGMP_HostGrpLeaveHandler(),
 *               NetIGMP_IsGrpJoinedOnIF(),
+*               NetIGMP_IsSrcAllowedOnIF(),
+*               NetIGMP_HostGrpSrcAddHandler(),
+*               NetIGMP_HostGrpSrcRemoveHandler(),
+*               NetIGMP_RxMsgQuery(),
 *               NetIGMP_RxMsgReport().
 *
 * Note(s)     : (2) IP host group address MUST be in host-order.
+*
+*               (3) Since the host group search is performed for every received multicast datagram, host
+*                   groups are searched in their hash bucket (see 'net_igmp.c  IGMP HOST GROUP HASH
+*                   DEFINES  Note #1') rather than by walking the IGMP Host Group List.
 *********************************************************************************************************
 */
 
@@ -2032,15 +2970,17 @@ static  NET_IGMP_HOST_GRP  *NetIGMP_HostGrpSrch (NET_IF_NBR     if_nbr,
     NET_IGMP_HOST_GRP  *p_host_grp;
     NET_IGMP_HOST_GRP  *p_host_grp_next;
     CPU_BOOLEAN         found;
+    CPU_INT16U          hash_ix;
 
-
-    p_host_grp = NetIGMP_HostGrpListHead;                       /* Start @ IGMP Host Grp List head (see Note #1b2A1b).  */
+                                                                /* Start @ host grp's hash bucket (see Note #3).        */
+    hash_ix    = NET_IGMP_HOST_GRP_HASH(if_nbr, addr_grp);
+    p_host_grp = NetIGMP_HostGrpHashTbl[hash_ix];
     found     = DEF_NO;
 
-    while ((p_host_grp != (NET_IGMP_HOST_GRP *)0) &&            /* Srch IGMP Host Grp List ...                          */
+    while ((p_host_grp != (NET_IGMP_HOST_GRP *)0) &&            /* Srch hash bucket ...                                 */
            (found     ==  DEF_NO)) {                            /* ... until host grp found.                            */
 
-        p_host_grp_next = (NET_IGMP_HOST_GRP *) p_host_grp->NextPtr;
+        p_host_grp_next = (NET_IGMP_HOST_GRP *) p_host_grp->HashNextPtr;
 
         found = ((p_host_grp->IF_Nbr  == if_nbr) &&             /* Cmp IF nbr & grp addr.                               */
                  (p_host_grp->AddrGrp == addr_grp)) ? DEF_YES : DEF_NO;
@@ -2109,9 +3049,11 @@ static  NET_IGMP_HOST_GRP  *NetIGMP_HostGrpAdd (NET_IF_NBR      if_nbr,
 
 
                                                                 /* ------------------- CFG HOST GRP ------------------- */
-    p_host_grp->AddrGrp =  addr_grp;
-    p_host_grp->IF_Nbr  =  if_nbr;
-    p_host_grp->RefCtr  =  1u;
+    p_host_grp->AddrGrp      =  addr_grp;
+    p_host_grp->IF_Nbr       =  if_nbr;
+    p_host_grp->RefCtr       =  1u;
+    p_host_grp->AnySrcRefCtr =  1u;                             /* Dflt any-src membership (see 'NetIGMP_HostGrpJoin... */
+                                                                /* ... Handler()  Note #10').                           */
                                                                 /* Set host grp state.                                  */
                                                                 /* See 'net_igmp.h  IGMP HOST GROUP STATES  Note #2'.   */
     p_host_grp->State   = (addr_grp == NET_IPv4_ADDR_MULTICAST_ALL_HOSTS) ? NET_IGMP_HOST_GRP_STATE_STATIC
@@ -2195,6 +3137,288 @@ static  void  NetIGMP_HostGrpRemove (NET_IGMP_HOST_GRP  *p_host_grp)
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetIGMP_HostGrpLeaveTx()
+*
+* Description : Advertise that a host group is left on its interface.
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in NetIGMP_HostGrpLeaveHandler(),
+*                                               NetIGMP_HostGrpSrcRemoveHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIGMP_HostGrpLeaveHandler(),
+*               NetIGMP_HostGrpSrcRemoveHandler().
+*
+* Note(s)     : (1) (a) In IGMPv3 mode, leaving a host group is reported as a change to INCLUDE mode with
+*                       an empty source list (see RFC #3376, Section 5.1).  Since the host group is freed
+*                       immediately, the State-Change Report is NOT retransmitted.
+*
+*                   (b) IGMPv1 does NOT define a leave message.
+*********************************************************************************************************
+*/
+
+static  void  NetIGMP_HostGrpLeaveTx (NET_IGMP_HOST_GRP  *p_host_grp)
+{
+    NET_ERR  err;
+
+
+    if (NetIGMP_CompatV1OnIF[p_host_grp->IF_Nbr] == DEF_YES) {  /* See Note #1b.                                        */
+        return;
+    }
+
+    DEF_BIT_SET(p_host_grp->Flags, NET_IGMP_FLAG_STATE_CHNG);   /* See Note #1a.                                        */
+    NetIGMP_TxMsgReport(p_host_grp, &err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetIGMP_HostGrpStateChng()
+*
+* Description : Advertise a host group's new membership or source filter state :
+*
+*                   (a) Transmit State-Change Report immediately
+*                   (b) Configure report timer to retransmit the report
+*
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIGMP_HostGrpJoinHandler(),
+*               NetIGMP_HostGrpLeaveHandler(),
+*               NetIGMP_HostGrpSrcAddHandler(),
+*               NetIGMP_HostGrpSrcRemoveHandler().
+*
+* Note(s)     : (1) See 'NetIGMP_HostGrpJoinHandler()  Note #9'
+*                 & 'NetIGMP_HostGrpReportDlyTimeout()  Note #4'.
+*********************************************************************************************************
+*/
+
+static  void  NetIGMP_HostGrpStateChng (NET_IGMP_HOST_GRP  *p_host_grp)
+{
+    NET_TMR_TICK  timeout_tick;
+    NET_ERR       err;
+
+
+    if (p_host_grp->State == NET_IGMP_HOST_GRP_STATE_STATIC) {
+        return;
+    }
+
+    DEF_BIT_SET(p_host_grp->Flags, NET_IGMP_FLAG_STATE_CHNG);
+    NetIGMP_TxMsgReport(p_host_grp, &err);                      /* Tx report immed'ly.                                  */
+
+    if (p_host_grp->TmrPtr != (NET_TMR *)0) {                   /* Restart report tmr.                                  */
+        NetTmr_Free(p_host_grp->TmrPtr);
+        p_host_grp->TmrPtr = (NET_TMR *)0;
+    }
+
+    timeout_tick       = (NET_TMR_TICK)(NET_IGMP_HOST_GRP_REPORT_DLY_JOIN_SEC * NET_TMR_TIME_TICK_PER_SEC);
+    p_host_grp->TmrPtr =  NetTmr_Get((CPU_FNCT_PTR ) NetIGMP_HostGrpReportDlyTimeout,
+                                     (void        *) p_host_grp,
+                                     (NET_TMR_TICK ) timeout_tick,
+                                     (NET_ERR     *)&err);
+    if (err == NET_TMR_ERR_NONE) {
+        p_host_grp->State = NET_IGMP_HOST_GRP_STATE_DELAYING;
+    } else {
+        p_host_grp->State = NET_IGMP_HOST_GRP_STATE_IDLE;
+        DEF_BIT_CLR(p_host_grp->Flags, NET_IGMP_FLAG_STATE_CHNG);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetIGMP_AllHostsJoin()
+*
+* Description : Join the all-hosts group on an interface, if NOT yet joined.
+*
+* Argument(s) : if_nbr      Interface number to join the all-hosts group.
+*               ------      Argument checked in caller(s).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IGMP_ERR_NONE                   All-hosts group joined.
+*
+*                                                                   --- RETURNED BY NetIGMP_HostGrpAdd() : ---
+*                               NET_IGMP_ERR_HOST_GRP_NONE_AVAIL    NO available host group to allocate.
+*                               NET_IGMP_ERR_HOST_GRP_INVALID_TYPE  Host group is NOT a valid host group type.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIGMP_HostGrpJoinHandler(),
+*               NetIGMP_HostGrpSrcAddHandler().
+*
+* Note(s)     : (1) See 'NetIGMP_HostGrpJoinHandler()  Note #7'.
+*********************************************************************************************************
+*/
+
+static  void  NetIGMP_AllHostsJoin (NET_IF_NBR   if_nbr,
+                                    NET_ERR     *p_err)
+{
+    if (NetIGMP_AllHostsJoinedOnIF[if_nbr] != DEF_YES) {
+        NetIGMP_HostGrpAdd(if_nbr,
+                           NET_IPv4_ADDR_MULTICAST_ALL_HOSTS,
+                           p_err);
+        if (*p_err != NET_IGMP_ERR_NONE) {
+             return;
+        }
+
+        NetIGMP_AllHostsJoinedOnIF[if_nbr] = DEF_YES;
+    }
+
+   *p_err = NET_IGMP_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetIGMP_HostGrpSrcSrch()
+*
+* Description : Search a host group's source table for a source address.
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in caller(s).
+*
+*               addr_src    IP address of source to search (see Note #1).
+*
+* Return(s)   : Pointer to host group source entry, if found.
+*
+*               Pointer to NULL,                    otherwise.
+*
+* Caller(s)   : NetIGMP_HostGrpSrcAddHandler(),
+*               NetIGMP_HostGrpSrcRemoveHandler(),
+*               NetIGMP_IsSrcAllowedOnIF().
+*
+* Note(s)     : (1) IP source address MUST be in host-order.
+*********************************************************************************************************
+*/
+
+static  NET_IGMP_HOST_GRP_SRC  *NetIGMP_HostGrpSrcSrch (NET_IGMP_HOST_GRP  *p_host_grp,
+                                                        NET_IPv4_ADDR       addr_src)
+{
+    NET_IGMP_HOST_GRP_SRC  *p_src;
+    CPU_INT08U              i;
+
+
+    p_src = &p_host_grp->SrcTbl[0];
+    for (i = 0u; i < p_host_grp->SrcNbr; i++) {
+        if (p_src->AddrSrc == addr_src) {
+            return (p_src);
+        }
+        p_src++;
+    }
+
+    return ((NET_IGMP_HOST_GRP_SRC *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetIGMP_HostGrpSrcDel()
+*
+* Description : Delete a source entry from a host group's source table.
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in caller(s).
+*
+*               p_src       Pointer to the host group's source entry to delete.
+*               -----       Argument checked in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIGMP_HostGrpSrcRemoveHandler(),
+*               NetIGMP_HostGrpSrcClrMode().
+*
+* Note(s)     : (1) The last source entry is moved into the deleted entry's slot.
+*********************************************************************************************************
+*/
+
+static  void  NetIGMP_HostGrpSrcDel (NET_IGMP_HOST_GRP      *p_host_grp,
+                                     NET_IGMP_HOST_GRP_SRC  *p_src)
+{
+    NET_IGMP_HOST_GRP_SRC  *p_src_last;
+
+
+    p_host_grp->SrcNbr--;
+    p_src_last = &p_host_grp->SrcTbl[p_host_grp->SrcNbr];
+    if (p_src != p_src_last) {                                  /* See Note #1.                                         */
+       *p_src   = *p_src_last;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetIGMP_HostGrpSrcClrMode()
+*
+* Description : Delete ALL of a host group's source entries in a specific filter mode.
+*
+* Argument(s) : p_host_grp      Pointer to a host group.
+*               ----------      Argument checked in NetIGMP_HostGrpLeaveHandler().
+*
+*               filter_mode     Filter mode of source entries to delete.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIGMP_HostGrpLeaveHandler().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetIGMP_HostGrpSrcClrMode (NET_IGMP_HOST_GRP     *p_host_grp,
+                                         NET_IGMP_FILTER_MODE   filter_mode)
+{
+    CPU_INT08U  i;
+
+
+    i = p_host_grp->SrcNbr;
+    while (i > 0u) {                                            /* Srch backwards since entries are moved on del.       */
+        i--;
+        if (p_host_grp->SrcTbl[i].FilterMode == filter_mode) {
+            NetIGMP_HostGrpSrcDel(p_host_grp, &p_host_grp->SrcTbl[i]);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    NetIGMP_HostGrpFilterModeGet()
+*
+* Description : Get a host group's interface filter mode.
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in caller(s).
+*
+* Return(s)   : NET_IGMP_FILTER_MODE_EXCLUDE, if host group joined for any source;
+*
+*               NET_IGMP_FILTER_MODE_INCLUDE, otherwise.
+*
+* Caller(s)   : NetIGMP_IsSrcAllowedOnIF(),
+*               NetIGMP_TxMsgReport().
+*
+* Note(s)     : (1) See 'net_igmp.c  IGMP HOST GROUP SOURCE DATA TYPE  Note #2'.
+*********************************************************************************************************
+*/
+
+static  NET_IGMP_FILTER_MODE  NetIGMP_HostGrpFilterModeGet (NET_IGMP_HOST_GRP  *p_host_grp)
+{
+    NET_IGMP_FILTER_MODE  filter_mode;
+
+
+    filter_mode = (p_host_grp->AnySrcRefCtr > 0u) ? NET_IGMP_FILTER_MODE_EXCLUDE
+                                                  : NET_IGMP_FILTER_MODE_INCLUDE;
+
+    return (filter_mode);
+}
+
+
 /*
 *********************************************************************************************************
 *                                        NetIGMP_HostGrpInsert()
@@ -2214,6 +3438,8 @@ static  void  NetIGMP_HostGrpRemove (NET_IGMP_HOST_GRP  *p_host_grp)
 
 static  void  NetIGMP_HostGrpInsert (NET_IGMP_HOST_GRP  *p_host_grp)
 {
+    CPU_INT16U  hash_ix;
+
                                                                         /* ---------- CFG IGMP HOST GRP PTRS ---------- */
     p_host_grp->PrevPtr = (NET_IGMP_HOST_GRP *)0;
     p_host_grp->NextPtr = (NET_IGMP_HOST_GRP *)NetIGMP_HostGrpListHead;
@@ -2224,6 +3450,11 @@ static  void  NetIGMP_HostGrpInsert (NET_IGMP_HOST_GRP  *p_host_grp)
     }
 
     NetIGMP_HostGrpListHead = p_host_grp;                                /* Insert host grp @ list head (see Note #1).   */
+
+                                                                        /* --- INSERT IGMP HOST GRP INTO HASH BUCKET -- */
+    hash_ix                         = NET_IGMP_HOST_GRP_HASH(p_host_grp->IF_Nbr, p_host_grp->AddrGrp);
+    p_host_grp->HashNextPtr         = NetIGMP_HostGrpHashTbl[hash_ix];
+    NetIGMP_HostGrpHashTbl[hash_ix] = p_host_grp;
 }
 
 
@@ -2249,8 +3480,10 @@ static  void  NetIGMP_HostGrpInsert (NET_IGMP_HOST_GRP  *p_host_grp)
 
 static  void  NetIGMP_HostGrpUnlink (NET_IGMP_HOST_GRP  *p_host_grp)
 {
-    NET_IGMP_HOST_GRP  *p_host_grp_prev;
-    NET_IGMP_HOST_GRP  *p_host_grp_next;
+    NET_IGMP_HOST_GRP   *p_host_grp_prev;
+    NET_IGMP_HOST_GRP   *p_host_grp_next;
+    NET_IGMP_HOST_GRP  **pp_hash;
+    CPU_INT16U           hash_ix;
 
                                                                         /* ------ UNLINK IGMP HOST GRP FROM LIST ------ */
     p_host_grp_prev = p_host_grp->PrevPtr;
@@ -2266,9 +3499,21 @@ static  void  NetIGMP_HostGrpUnlink (NET_IGMP_HOST_GRP  *p_host_grp)
         p_host_grp_next->PrevPtr = p_host_grp_prev;
     }
 
+                                                                        /* -- UNLINK IGMP HOST GRP FROM HASH BUCKET --- */
+    hash_ix = NET_IGMP_HOST_GRP_HASH(p_host_grp->IF_Nbr, p_host_grp->AddrGrp);
+    pp_hash = &NetIGMP_HostGrpHashTbl[hash_ix];
+    while (*pp_hash != (NET_IGMP_HOST_GRP *)0) {
+        if (*pp_hash == p_host_grp) {
+            *pp_hash = p_host_grp->HashNextPtr;
+             break;
+        }
+        pp_hash = &(*pp_hash)->HashNextPtr;
+    }
+
 #if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)                             /* Clr host grp ptrs (see Note #1).             */
-    p_host_grp->PrevPtr = (NET_IGMP_HOST_GRP *)0;
-    p_host_grp->NextPtr = (NET_IGMP_HOST_GRP *)0;
+    p_host_grp->PrevPtr     = (NET_IGMP_HOST_GRP *)0;
+    p_host_grp->NextPtr     = (NET_IGMP_HOST_GRP *)0;
+    p_host_grp->HashNextPtr = (NET_IGMP_HOST_GRP *)0;
 #endif
 }
 
@@ -2328,6 +3573,9 @@ static  void  NetIGMP_HostGrpUnlink (NET_IGMP_HOST_GRP  *p_host_grp)
 *                       See also 'net_igmp.h  IGMP REPORT DEFINES  Note #2'.
 *
 *                   (b) Revert to 'IDLE' state, if the error is permanent.
+*
+*               (4) State-Change Reports are transmitted immediately & retransmitted once on timeout
+*                   (see RFC #3376, Section 5.1); following reports are Current-State Reports.
 *********************************************************************************************************
 */
 
@@ -2354,7 +3602,9 @@ static  void  NetIGMP_HostGrpReportDlyTimeout (void  *p_host_grp_timeout)
     NetIGMP_TxMsgReport(p_host_grp, &err);
     switch (err) {
         case NET_IGMP_ERR_NONE:                                 /* If NO err, ...                                       */
-             p_host_grp->State = NET_IGMP_HOST_GRP_STATE_IDLE;  /* ... set state to 'IDLE'.                             */
+             p_host_grp->State = NET_IGMP_HOST_GRP_STATE_IDLE;  /* ... set state to 'IDLE' ...                          */
+                                                                /* ... & state chng report retransmitted (see Note #4). */
+             DEF_BIT_CLR(p_host_grp->Flags, NET_IGMP_FLAG_STATE_CHNG);
              break;
 
 
@@ -2375,6 +3625,7 @@ static  void  NetIGMP_HostGrpReportDlyTimeout (void  *p_host_grp_timeout)
         case NET_IGMP_ERR_INVALID_ADDR_SRC:
         default:                                                /* On all other errs, ...                               */
              p_host_grp->State = NET_IGMP_HOST_GRP_STATE_IDLE;  /* ... set state to 'IDLE'.                             */
+             DEF_BIT_CLR(p_host_grp->Flags, NET_IGMP_FLAG_STATE_CHNG);
              break;
     }
 }
@@ -2555,17 +3806,20 @@ static  void  NetIGMP_HostGrpFree (NET_IGMP_HOST_GRP  *p_host_grp)
 
 static  void  NetIGMP_HostGrpClr (NET_IGMP_HOST_GRP  *p_host_grp)
 {
-    p_host_grp->PrevPtr = (NET_IGMP_HOST_GRP *)0;
-    p_host_grp->NextPtr = (NET_IGMP_HOST_GRP *)0;
+    p_host_grp->PrevPtr      = (NET_IGMP_HOST_GRP *)0;
+    p_host_grp->NextPtr      = (NET_IGMP_HOST_GRP *)0;
+    p_host_grp->HashNextPtr  = (NET_IGMP_HOST_GRP *)0;
 
-    p_host_grp->TmrPtr  = (NET_TMR           *)0;
+    p_host_grp->TmrPtr       = (NET_TMR           *)0;
 
-    p_host_grp->IF_Nbr  =  NET_IF_NBR_NONE;
-    p_host_grp->AddrGrp =  NET_IPv4_ADDR_NONE;
+    p_host_grp->IF_Nbr       =  NET_IF_NBR_NONE;
+    p_host_grp->AddrGrp      =  NET_IPv4_ADDR_NONE;
 
-    p_host_grp->State   =  NET_IGMP_HOST_GRP_STATE_FREE;
-    p_host_grp->RefCtr  =  0u;
-    p_host_grp->Flags   =  NET_IGMP_FLAG_NONE;
+    p_host_grp->State        =  NET_IGMP_HOST_GRP_STATE_FREE;
+    p_host_grp->RefCtr       =  0u;
+    p_host_grp->AnySrcRefCtr =  0u;
+    p_host_grp->SrcNbr       =  0u;
+    p_host_grp->Flags        =  NET_IGMP_FLAG_NONE;
 }
 
 
@@ -30,8 +30,9 @@
 *                (a) IGMP is NOT required for the transmission of IP class-D (multicast) packets
 *                    (see RFC #1112, Section 3 'Levels of Conformance : Level 1').
 *
-*            (2) Supports Internet Group Management Protocol version 1, as described in RFC #1112
-*                with the following restrictions/constraints :
+*            (2) Supports Internet Group Management Protocol version 3, as described in RFC #3376,
+*                & falls back to version 1 reports (RFC #1112) on interfaces where a version 1 or
+*                version 2 querier is heard, with the following restrictions/constraints :
 *
 *                (a) Only one socket may receive datagrams for a specific host group address & port
 *                    number at any given time.
@@ -43,6 +44,16 @@
 *                    no longer needed by the application.
 *
 *                (c) Transmission of IGMP Query Messages NOT currently supported. #### NET-820
+*
+*                (d) Source filters are kept per interface & host group, NOT per socket; blocked
+*                    sources apply to ALL any-source members of the host group.
+*
+*                (e) IGMPv3 Router Alert IP option NOT transmitted & Older Version Querier Present
+*                    timeout NOT implemented; an interface returns to version 3 when a version 3
+*                    query is next received.
+*
+*                (f) IGMPv3 reports & source filters are ONLY available if NET_MCAST_CFG_SRC_FILTER_EN
+*                    is enabled; otherwise, ALL interfaces report in version 1 compatibility mode.
 *********************************************************************************************************
 */
 
@@ -103,6 +114,26 @@
 #define  NET_IGMP_HOST_GRP_NBR_MIN                         1
 #define  NET_IGMP_HOST_GRP_NBR_MAX       DEF_INT_16U_MAX_VAL    /* See Note #1.                                         */
 
+#define  NET_IGMP_SRC_NBR_MIN                              1
+#define  NET_IGMP_SRC_NBR_MAX             DEF_INT_08U_MAX_VAL
+
+
+/*
+*********************************************************************************************************
+*                                    IGMP SOURCE FILTER MODE DEFINES
+*
+* Note(s) : (1) RFC #3376, Section 3.1 defines the two source filter modes of a multicast reception
+*               state :
+*
+*               (a) INCLUDE     Datagrams are ONLY accepted from the listed source addresses.
+*               (b) EXCLUDE     Datagrams are accepted from all but the listed source addresses.
+*********************************************************************************************************
+*/
+
+#define  NET_IGMP_FILTER_MODE_NONE                         0u
+#define  NET_IGMP_FILTER_MODE_INCLUDE                      1u   /* See Note #1a.                                        */
+#define  NET_IGMP_FILTER_MODE_EXCLUDE                      2u   /* See Note #1b.                                        */
+
 
 /*
 *********************************************************************************************************
@@ -112,6 +143,14 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                 IGMP SOURCE FILTER MODE DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT08U  NET_IGMP_FILTER_MODE;
+
 
 
 /*
@@ -170,9 +209,38 @@ CPU_BOOLEAN  NetIGMP_HostGrpLeaveHandler(NET_IF_NBR      if_nbr,
                                          NET_ERR        *p_err);
 
 
+                                                                    /* ------------- SRC FILTER FNCTS --------------- */
+CPU_BOOLEAN  NetIGMP_HostGrpSrcAdd      (NET_IF_NBR             if_nbr,
+                                         NET_IPv4_ADDR          addr_grp,
+                                         NET_IPv4_ADDR          addr_src,
+                                         NET_IGMP_FILTER_MODE   filter_mode,
+                                         NET_ERR               *p_err);
+
+CPU_BOOLEAN  NetIGMP_HostGrpSrcAddHandler(NET_IF_NBR             if_nbr,
+                                          NET_IPv4_ADDR          addr_grp,
+                                          NET_IPv4_ADDR          addr_src,
+                                          NET_IGMP_FILTER_MODE   filter_mode,
+                                          NET_ERR               *p_err);
+
+
+CPU_BOOLEAN  NetIGMP_HostGrpSrcRemove   (NET_IF_NBR             if_nbr,
+                                         NET_IPv4_ADDR          addr_grp,
+                                         NET_IPv4_ADDR          addr_src,
+                                         NET_ERR               *p_err);
+
+CPU_BOOLEAN  NetIGMP_HostGrpSrcRemoveHandler(NET_IF_NBR          if_nbr,
+                                             NET_IPv4_ADDR       addr_grp,
+                                             NET_IPv4_ADDR       addr_src,
+                                             NET_ERR            *p_err);
+
+
 CPU_BOOLEAN  NetIGMP_IsGrpJoinedOnIF    (NET_IF_NBR      if_nbr,
                                          NET_IPv4_ADDR   addr_grp);
 
+CPU_BOOLEAN  NetIGMP_IsSrcAllowedOnIF   (NET_IF_NBR      if_nbr,
+                                         NET_IPv4_ADDR   addr_grp,
+                                         NET_IPv4_ADDR   addr_src);
+
 
 /*
 *********************************************************************************************************
@@ -220,6 +288,15 @@ void         NetIGMP_Rx                 (NET_BUF        *p_buf,
 #endif
 
 
+#if     (DEF_CHK_VAL(NET_MCAST_CFG_SRC_NBR_MAX,           \
+                     NET_IGMP_SRC_NBR_MIN,               \
+                     NET_IGMP_SRC_NBR_MAX) != DEF_OK)
+#error  "NET_MCAST_CFG_SRC_NBR_MAX       illegally #define'd in 'net_cfg.h'     "
+#error  "                               [MUST be  >= NET_IGMP_SRC_NBR_MIN     ]"
+#error  "                               [     &&  <= NET_IGMP_SRC_NBR_MAX     ]"
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
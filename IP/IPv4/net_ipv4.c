@@ -222,6 +222,19 @@
 #define  NET_IPv4_ADDR_CFG_STATE_DYNAMIC_INIT             21u
 
 
+/*
+*********************************************************************************************************
+*                                  IPv4 HOST ADDRESS INDEX DEFINES
+*
+* Note(s) : (1) The host address index is an open-addressed hash table of every configured IPv4 host
+*               address on every interface. The table is sized to twice the maximum number of configurable
+*               addresses so that it is never more than half full & linear probing stays short.
+*********************************************************************************************************
+*/
+
+#define  NET_IPv4_ADDR_HASH_TBL_SIZE                    (NET_IF_NBR_IF_TOT * NET_IPv4_CFG_IF_MAX_NBR_ADDR * 2u)
+
+
 
 
 /*
@@ -313,6 +326,20 @@ typedef  struct  net_ipv4_opt_ts_route {
 } NET_IPv4_OPT_TS_ROUTE;
 
 
+/*
+*********************************************************************************************************
+*                                IPv4 HOST ADDRESS INDEX ENTRY DATA TYPE
+*
+* Note(s) : (1) An index entry is free when 'AddrsPtr' is NULL.
+*********************************************************************************************************
+*/
+
+typedef  struct  net_ipv4_addr_hash_entry {
+    NET_IPv4_ADDRS     *AddrsPtr;                               /* Ptr to IF's cfg'd IPv4 addrs (see Note #1).          */
+    NET_IF_NBR          IF_Nbr;                                 /* IF nbr of cfg'd IPv4 addr.                           */
+} NET_IPv4_ADDR_HASH_ENTRY;
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -339,6 +366,9 @@ static  NET_TMR_TICK      NetIPv4_FragReasmTimeout_tick;  /* IPv4 frag reasm tim
 
 static  CPU_INT16U        NetIPv4_TxID_Ctr;               /* Global tx ID field ctr.                              */
 
+                                                                /* Cfg'd host addrs index.                              */
+static  NET_IPv4_ADDR_HASH_ENTRY  NetIPv4_AddrHashTbl[NET_IPv4_ADDR_HASH_TBL_SIZE];
+
 
 
 
@@ -369,6 +399,13 @@ static  NET_IPv4_ADDRS  *NetIPv4_GetAddrsHostCfgd        (NET_IPv4_ADDR   addr,
 static  NET_IPv4_ADDRS  *NetIPv4_GetAddrsHostCfgdOnIF    (NET_IPv4_ADDR   addr,
                                                           NET_IF_NBR      if_nbr);
 
+                                                                            /* ---------- HOST ADDR INDEX FNCTS ------- */
+static  void             NetIPv4_AddrHashRebuild         (void);
+
+static  NET_IPv4_ADDRS  *NetIPv4_AddrHashSrch            (NET_IPv4_ADDR   addr,
+                                                          NET_IF_NBR      if_nbr,
+                                                          NET_IF_NBR     *p_if_nbr);
+
 
 
                                                                             /* -------- VALIDATE RX DATAGRAMS --------- */
@@ -401,6 +438,13 @@ static  CPU_BOOLEAN    NetIPv4_RxPktValidateOptTS        (NET_BUF_HDR    *p_buf_
                                                           CPU_INT08U     *p_opt_len,
                                                           NET_ERR        *p_err);
 
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+                                                                                    /* ------- EARLY DEMUX RX PKTS ------ */
+static  void           NetIPv4_RxPktDemuxEarly           (NET_BUF        *p_buf,
+                                                          NET_BUF_HDR    *p_buf_hdr,
+                                                          NET_ERR        *p_err);
+#endif
+
                                                                                     /* -------- REASM RX FRAGS -------- */
 
 static  NET_BUF       *NetIPv4_RxPktFragReasm            (NET_BUF        *p_buf,
@@ -579,7 +623,7 @@ static  CPU_BOOLEAN      NetIPv4_IsAddrHostCfgdHandler   (NET_IPv4_ADDR   addr);
 *
 * Description : (1) Initialize Internet Protocol Layer :
 *
-*                   (a) Initialize ALL interfaces' configurable IPv4 addresses
+*                   (a) Initialize ALL interfaces' configurable IPv4 addresses & host address index
 *                   (b) Initialize IPv4 fragmentation list pointers
 *                   (c) Initialize IPv4 identification (ID) counter
 *
@@ -636,6 +680,8 @@ void  NetIPv4_Init (void)
         p_ip_if_cfg->AddrProtocolConflict = DEF_NO;
     }
 
+    NetIPv4_AddrHashRebuild();                                      /* Init host addr index.                            */
+
 
                                                                     /* ------------- INIT IPv4 FRAG LISTS ------------- */
     NetIPv4_FragReasmListsHead = (NET_BUF *)0;
@@ -903,6 +949,7 @@ CPU_BOOLEAN  NetIPv4_CfgAddrAdd (NET_IF_NBR      if_nbr,
     p_ip_addrs->AddrDfltGateway        =  addr_dflt_gateway;
 
     p_ip_if_cfg->AddrsNbrCfgd++;
+    NetIPv4_AddrHashRebuild();                                          /* Update host addr index.                      */
 #if 0                                                                   /* See Note #7b1.                               */
                                                                         /* Set to static  addr cfg (see Note #7a1).     */
     p_ip_if_cfg->AddrCfgState          =  NET_IPv4_ADDR_CFG_STATE_STATIC;
@@ -1206,6 +1253,7 @@ CPU_BOOLEAN  NetIPv4_CfgAddrAddDynamic (NET_IF_NBR      if_nbr,
     p_ip_addrs->AddrDfltGateway        =  addr_dflt_gateway;
 
     p_ip_if_cfg->AddrsNbrCfgd          =  1u;                           /* Cfg single dynamic addr     (see Note #8a2). */
+    NetIPv4_AddrHashRebuild();                                          /* Update host addr index.                      */
                                                                         /* Set to     dynamic addr cfg (see Note #8a2). */
     p_ip_if_cfg->AddrCfgState          =  NET_IPv4_ADDR_CFG_STATE_DYNAMIC;
     CPU_CRITICAL_ENTER();
@@ -1815,6 +1863,7 @@ CPU_BOOLEAN  NetIPv4_CfgAddrRemove (NET_IF_NBR      if_nbr,
     p_ip_addrs->AddrDfltGateway        = NET_IPv4_ADDR_NONE;
 
     p_ip_if_cfg->AddrsNbrCfgd--;
+    NetIPv4_AddrHashRebuild();                                          /* Update host addr index.                      */
     if (p_ip_if_cfg->AddrsNbrCfgd < 1) {                                /* If NO addr(s) cfg'd, ...                     */
                                                                         /* ... dflt to static addr cfg (see Note #5c).  */
         p_ip_if_cfg->AddrCfgState         = NET_IPv4_ADDR_CFG_STATE_STATIC;
@@ -3872,9 +3921,10 @@ CPU_BOOLEAN  NetIPv4_IsValidFlags (NET_IPv4_FLAGS  flags)
 * Description : (1) Process received datagrams & forward to network protocol layers :
 *
 *                   (a) Validate IPv4 packet & options
-*                   (b) Reassemble fragmented datagrams
-*                   (c) Demultiplex datagram to higher-layer protocols
-*                   (d) Update receive statistics
+*                   (b) Discard packets for unbound transport ports             See Note #6
+*                   (c) Reassemble fragmented datagrams
+*                   (d) Demultiplex datagram to higher-layer protocols
+*                   (e) Update receive statistics
 *
 *               (2) Although IPv4 data units are typically referred to as 'datagrams' (see RFC #791, Section 1.1),
 *                   the term 'IP packet' (see RFC #1983, 'packet') is used for IPv4 Receive until the packet is
@@ -3911,6 +3961,8 @@ CPU_BOOLEAN  NetIPv4_IsValidFlags (NET_IPv4_FLAGS  flags)
 *                           fragmented packet buffers.
 *
 *               (5) Network buffer already freed by higher layer; only increment error counter.
+*
+*               (6) See 'NetIPv4_RxPktDemuxEarly()  Note #1'.
 *********************************************************************************************************
 */
 
@@ -3955,6 +4007,11 @@ void  NetIPv4_Rx (NET_BUF  *p_buf,
 
     NetIPv4_RxPktValidate(p_buf, p_buf_hdr, p_ip_hdr, p_err);   /* Validate rx'd pkt.                                   */
 
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+    if (*p_err == NET_IPv4_ERR_NONE) {                          /* Discard pkts for unbound ports (see Note #6).        */
+        NetIPv4_RxPktDemuxEarly(p_buf, p_buf_hdr, p_err);
+    }
+#endif
 
 
                                                                 /* ------------------- REASM FRAGS -------------------- */
@@ -3983,6 +4040,7 @@ void  NetIPv4_Rx (NET_BUF  *p_buf,
         case NET_IPv4_ERR_RX_OPT_BUF_NONE_AVAIL:
         case NET_IPv4_ERR_RX_OPT_BUF_LEN:
         case NET_IPv4_ERR_RX_OPT_BUF_WR:
+        case NET_IPv4_ERR_RX_PORT_NONE:
         default:
              NetIPv4_RxPktDiscard(p_buf, p_err);
              return;
@@ -4479,6 +4537,7 @@ static  CPU_BOOLEAN  NetIPv4_CfgAddrRemoveAllHandler (NET_IF_NBR   if_nbr,
     }
 
     p_ip_if_cfg->AddrsNbrCfgd         = 0u;                             /* NO  addr(s) cfg'd.                           */
+    NetIPv4_AddrHashRebuild();                                          /* Update host addr index.                      */
     p_ip_if_cfg->AddrCfgState         = NET_IPv4_ADDR_CFG_STATE_STATIC; /* Set to static addr cfg (see Note #3c).       */
     CPU_CRITICAL_ENTER();
     p_ip_if_cfg->AddrProtocolConflict = DEF_NO;                         /* Clr addr conflict.                           */
@@ -4617,17 +4676,7 @@ static  NET_IPv4_ADDRS  *NetIPv4_GetAddrsHostCfgd (NET_IPv4_ADDR   addr,
 
 
                                                                 /* -------- SRCH ALL CFG'D IF's FOR IPv4 ADDR --------- */
-    if_nbr    =  NET_IF_NBR_BASE_CFGD;
-    p_ip_addrs = (NET_IPv4_ADDRS *)0;
-
-    while ((if_nbr    <   NET_IF_NBR_IF_TOT) &&                 /* Srch all cfg'd IF's ...                              */
-           (p_ip_addrs == (NET_IPv4_ADDRS *)0)) {               /* ... until addr found.                                */
-
-        p_ip_addrs = NetIPv4_GetAddrsHostCfgdOnIF(addr, if_nbr);
-        if (p_ip_addrs == (NET_IPv4_ADDRS *)0) {                /* If addr NOT found, ...                               */
-            if_nbr++;                                           /* ... adv to next IF nbr.                              */
-        }
-    }
+    p_ip_addrs = NetIPv4_AddrHashSrch(addr, NET_IF_NBR_WILDCARD, &if_nbr);
 
     if (p_ip_addrs != (NET_IPv4_ADDRS *)0) {                    /* If addr avail, ...                                   */
         if (p_if_nbr != (NET_IF_NBR *)0) {
@@ -4671,10 +4720,7 @@ static  NET_IPv4_ADDRS  *NetIPv4_GetAddrsHostCfgdOnIF (NET_IPv4_ADDR  addr,
     CPU_BOOLEAN        valid;
     NET_ERR            err;
 #endif
-    NET_IPv4_IF_CFG   *p_ip_if_cfg;
     NET_IPv4_ADDRS    *p_ip_addrs;
-    NET_IP_ADDRS_QTY   addr_ix;
-    CPU_BOOLEAN        addr_found;
 
 
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* ----------------- VALIDATE IF NBR ------------------ */
@@ -4691,29 +4737,139 @@ static  NET_IPv4_ADDRS  *NetIPv4_GetAddrsHostCfgdOnIF (NET_IPv4_ADDR  addr,
 
 
                                                                 /* -------------- SRCH IF FOR IPv4 ADDR --------------- */
-    addr_ix    =  0u;
-    addr_found =  DEF_NO;
-    p_ip_if_cfg = &NetIPv4_IF_CfgTbl[if_nbr];
-    p_ip_addrs  = &p_ip_if_cfg->AddrsTbl[addr_ix];
+    p_ip_addrs = NetIPv4_AddrHashSrch(addr, if_nbr, (NET_IF_NBR *)0);
 
-    while ((addr_ix    <  p_ip_if_cfg->AddrsNbrCfgd) &&         /* Srch all cfg'd addrs ...                             */
-           (addr_found == DEF_NO)) {                            /* ... until addr found.                                */
 
-        if (p_ip_addrs->AddrHost != addr) {                     /* If addr NOT found, ...                               */
-            p_ip_addrs++;                                       /* ... adv to IF's next addr.                           */
-            addr_ix++;
+    return (p_ip_addrs);
+}
 
-        } else {
-            addr_found = DEF_YES;
+
+/*
+*********************************************************************************************************
+*                                      NetIPv4_AddrHashRebuild()
+*
+* Description : Rebuild the host address index from ALL interfaces' configured IPv4 addresses.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIPv4_Init(),
+*               NetIPv4_CfgAddrAdd(),
+*               NetIPv4_CfgAddrAddDynamic(),
+*               NetIPv4_CfgAddrRemove(),
+*               NetIPv4_CfgAddrRemoveAllHandler().
+*
+* Note(s)     : (1) The index MUST be rebuilt each time an interface's address table is modified since
+*                   removing an address shifts the remaining addresses in the table.
+*
+*               (2) Addresses are inserted in interface & address table order. Since linear probing
+*                   never moves an inserted entry, NetIPv4_AddrHashSrch() returns the same address
+*                   structure as a sequential search of ALL interfaces' address tables.
+*********************************************************************************************************
+*/
+
+static  void  NetIPv4_AddrHashRebuild (void)
+{
+    NET_IPv4_IF_CFG           *p_ip_if_cfg;
+    NET_IPv4_ADDRS            *p_ip_addrs;
+    NET_IPv4_ADDR_HASH_ENTRY  *p_entry;
+    NET_IP_ADDRS_QTY           addr_ix;
+    NET_IF_NBR                 if_nbr;
+    CPU_INT32U                 ix;
+
+
+    Mem_Clr(&NetIPv4_AddrHashTbl[0],
+             sizeof(NetIPv4_AddrHashTbl));
+
+    for (if_nbr = NET_IF_NBR_BASE; if_nbr < NET_IF_NBR_IF_TOT; if_nbr++) {
+        p_ip_if_cfg = &NetIPv4_IF_CfgTbl[if_nbr];
+        p_ip_addrs  = &p_ip_if_cfg->AddrsTbl[0];
+
+        for (addr_ix = 0u; addr_ix < p_ip_if_cfg->AddrsNbrCfgd; addr_ix++) {
+            if (p_ip_addrs->AddrHost != NET_IPv4_ADDR_NONE) {
+                                                                /* Find first free entry from addr's hash ix.           */
+                ix      = (p_ip_addrs->AddrHost * 2654435761u) % NET_IPv4_ADDR_HASH_TBL_SIZE;
+                p_entry = &NetIPv4_AddrHashTbl[ix];
+                while (p_entry->AddrsPtr != (NET_IPv4_ADDRS *)0) {
+                    ix      = (ix + 1u) % NET_IPv4_ADDR_HASH_TBL_SIZE;
+                    p_entry = &NetIPv4_AddrHashTbl[ix];
+                }
+
+                p_entry->AddrsPtr = p_ip_addrs;
+                p_entry->IF_Nbr   = if_nbr;
+            }
+            p_ip_addrs++;
         }
     }
+}
 
-    if (addr_found != DEF_YES) {
-        return ((NET_IPv4_ADDRS *)0);
+
+/*
+*********************************************************************************************************
+*                                       NetIPv4_AddrHashSrch()
+*
+* Description : Search the host address index for a configured IPv4 host address.
+*
+* Argument(s) : addr        IPv4 host address to search (see Note #1).
+*
+*               if_nbr      Interface number to search for configured IPv4 address, or
+*                               NET_IF_NBR_WILDCARD to search ALL interfaces.
+*
+*               p_if_nbr    Pointer to variable that will receive the interface number of the configured
+*                               IPv4 address, if found (optional).
+*
+* Return(s)   : Pointer to corresponding IPv4 address structure, if IPv4 address found.
+*
+*               Pointer to NULL,                                 otherwise.
+*
+* Caller(s)   : NetIPv4_GetAddrsHostCfgd(),
+*               NetIPv4_GetAddrsHostCfgdOnIF().
+*
+* Note(s)     : (1) IPv4 address MUST be in host-order.
+*
+*               (2) Search ends on the first free entry since entries are never removed individually
+*                   (see 'NetIPv4_AddrHashRebuild()  Note #1').
+*
+*               (3) A wildcard search skips reserved interfaces, like a sequential search starting at
+*                   NET_IF_NBR_BASE_CFGD.
+*********************************************************************************************************
+*/
+
+static  NET_IPv4_ADDRS  *NetIPv4_AddrHashSrch (NET_IPv4_ADDR   addr,
+                                               NET_IF_NBR      if_nbr,
+                                               NET_IF_NBR     *p_if_nbr)
+{
+    NET_IPv4_ADDR_HASH_ENTRY  *p_entry;
+    CPU_INT32U                 ix;
+    CPU_INT32U                 nbr_srch;
+
+
+    ix       = (addr * 2654435761u) % NET_IPv4_ADDR_HASH_TBL_SIZE;
+    nbr_srch =  0u;
+
+    while (nbr_srch < NET_IPv4_ADDR_HASH_TBL_SIZE) {
+        p_entry = &NetIPv4_AddrHashTbl[ix];
+        if (p_entry->AddrsPtr == (NET_IPv4_ADDRS *)0) {         /* See Note #2.                                         */
+            break;
+        }
+
+        if ((p_entry->AddrsPtr->AddrHost == addr) &&          /* See Note #3.                                         */
+          (((if_nbr          == NET_IF_NBR_WILDCARD)  &&
+            (p_entry->IF_Nbr >= NET_IF_NBR_BASE_CFGD)) ||
+            (p_entry->IF_Nbr == if_nbr))) {
+            if (p_if_nbr != (NET_IF_NBR *)0) {
+               *p_if_nbr  = p_entry->IF_Nbr;
+            }
+            return (p_entry->AddrsPtr);
+        }
+
+        ix = (ix + 1u) % NET_IPv4_ADDR_HASH_TBL_SIZE;
+        nbr_srch++;
     }
 
 
-    return (p_ip_addrs);
+    return ((NET_IPv4_ADDRS *)0);
 }
 
 
@@ -5158,6 +5314,8 @@ static  void  NetIPv4_RxPktValidate (NET_BUF        *p_buf,
     NET_UTIL_VAL_COPY_GET_NET_16(&p_buf_hdr->IP_TotLen,   &p_ip_hdr->TotLen);
     NET_UTIL_VAL_COPY_GET_NET_32(&p_buf_hdr->IP_AddrSrc,  &p_ip_hdr->AddrSrc);
     NET_UTIL_VAL_COPY_GET_NET_32(&p_buf_hdr->IP_AddrDest, &p_ip_hdr->AddrDest);
+                                                                /* Get rx'd ECN codepoint from TOS.                     */
+    p_buf_hdr->IP_ECN = p_ip_hdr->TOS & NET_IP_ECN_MASK;
 
 
                                                                 /* ---------------- VALIDATE IPv4 VER ----------------- */
@@ -5557,6 +5715,19 @@ static  void  NetIPv4_RxPktValidate (NET_BUF        *p_buf,
            *p_err = NET_IPv4_ERR_INVALID_ADDR_DEST;
             return;
         }
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+                                                                    /* Chk grp src filter, except for IGMP msgs.        */
+        if (p_ip_hdr->Protocol != NET_IP_HDR_PROTOCOL_IGMP) {
+            addr_host_grp_joined = NetIGMP_IsSrcAllowedOnIF(if_nbr,
+                                                            p_buf_hdr->IP_AddrDest,
+                                                            p_buf_hdr->IP_AddrSrc);
+            if (addr_host_grp_joined != DEF_YES) {
+                NET_CTR_ERR_INC(Net_ErrCtrs.IPv4.RxDestCtr);
+               *p_err = NET_IPv4_ERR_INVALID_ADDR_DEST;
+                return;
+            }
+        }
+#endif
 
         NET_CTR_STAT_INC(Net_StatCtrs.IPv4.RxDestMcastCtr);
         ip_multicast = DEF_YES;
@@ -6345,6 +6516,104 @@ static  CPU_BOOLEAN  NetIPv4_RxPktValidateOptTS (NET_BUF_HDR  *p_buf_hdr,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetIPv4_RxPktDemuxEarly()
+*
+* Description : Discard a received UDP or TCP packet if NO connection is bound to its destination port.
+*
+* Argument(s) : p_buf       Pointer to network buffer that received IPv4 packet.
+*               -----       Argument checked   in NetIPv4_Rx().
+*
+*               p_buf_hdr   Pointer to network buffer header.
+*               ---------   Argument validated in NetIPv4_Rx().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IPv4_ERR_NONE               Packet NOT discarded.
+*                               NET_IPv4_ERR_RX_PORT_NONE       NO connection bound to destination port.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIPv4_Rx().
+*
+* Note(s)     : (1) (a) Packets for unbound ports are discarded BEFORE fragment reassembly & BEFORE the
+*                       transport layer verifies the packet's check-sum, so that floods of unwanted
+*                       datagrams (e.g. broadcast storms) cost as little receive processing as possible.
+*
+*                   (b) Since the packet is silently discarded, NO ICMP Port Unreachable message NOR TCP
+*                       reset is transmitted for unbound ports.
+*
+*               (2) Only the first fragment of a fragmented datagram carries the transport header; all
+*                   other fragments are passed on to reassembly.  Fragments whose first fragment was
+*                   discarded are freed when their reassembly times out.
+*
+*               (3) UDP & TCP headers both begin with the source & destination port numbers.
+*
+*               (4) Packets whose destination port hashes to a bucket with any bound connection are
+*                   passed on (see 'net_conn.h  NETWORK CONNECTION PORT HASH DEFINES  Note #2').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+static  void  NetIPv4_RxPktDemuxEarly (NET_BUF      *p_buf,
+                                       NET_BUF_HDR  *p_buf_hdr,
+                                       NET_ERR      *p_err)
+{
+    NET_CONN_PROTOCOL_IX   protocol_ix;
+    NET_PORT_NBR           port_nbr;
+    CPU_INT16U             frag_offset;
+    CPU_BOOLEAN            bound;
+
+
+   *p_err = NET_IPv4_ERR_NONE;
+
+    switch (p_buf_hdr->ProtocolHdrTypeTransport) {
+        case NET_PROTOCOL_TYPE_UDP_V4:
+             protocol_ix = NET_CONN_PROTOCOL_IX_IP_V4_UDP;
+             break;
+
+#ifdef  NET_TCP_MODULE_EN
+        case NET_PROTOCOL_TYPE_TCP_V4:
+             protocol_ix = NET_CONN_PROTOCOL_IX_IP_V4_TCP;
+             break;
+#endif
+
+        default:                                                /* Only demux UDP & TCP pkts.                           */
+             return;
+    }
+
+    frag_offset = (CPU_INT16U)(p_buf_hdr->IP_Flags_FragOffset & NET_IPv4_HDR_FRAG_OFFSET_MASK);
+    if (frag_offset != NET_IPv4_HDR_FRAG_OFFSET_NONE) {         /* See Note #2.                                         */
+        return;
+    }
+
+    if (p_buf_hdr->DataLen < (NET_BUF_SIZE)(2u * sizeof(NET_PORT_NBR))) {
+        return;                                                 /* Let transport layer discard truncated hdr.           */
+    }
+                                                                /* Get dest port (see Note #3).                         */
+    NET_UTIL_VAL_COPY_GET_NET_16(&port_nbr, &p_buf->DataPtr[p_buf_hdr->TransportHdrIx + sizeof(NET_PORT_NBR)]);
+
+    bound = NetConn_ListIsPortBound(protocol_ix, port_nbr);     /* See Note #4.                                         */
+    if (bound != DEF_NO) {
+        return;
+    }
+
+#ifdef  NET_TCP_MODULE_EN
+    if (protocol_ix == NET_CONN_PROTOCOL_IX_IP_V4_TCP) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv4.RxEarlyDemuxTCP_DisCtr);
+    } else {
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv4.RxEarlyDemuxUDP_DisCtr);
+    }
+#else
+    NET_CTR_ERR_INC(Net_ErrCtrs.IPv4.RxEarlyDemuxUDP_DisCtr);
+#endif
+
+   *p_err = NET_IPv4_ERR_RX_PORT_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       NetIPv4_RxPktFragReasm()
@@ -54,6 +54,9 @@
 #include  "../../Source/net_stat.h"
 #include  "../../Source/net.h"
 #include  "../../Source/net_util.h"
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+#include  "../../Source/net_tcp.h"
+#endif
 
 
 /*
@@ -101,6 +104,7 @@
 #define  NET_ICMPv6_HDR_SIZE_DFLT                          8
 
 #define  NET_ICMPv6_HDR_SIZE_DEST_UNREACH                NET_ICMPv6_HDR_SIZE_DFLT
+#define  NET_ICMPv6_HDR_SIZE_PKT_TOO_BIG                 NET_ICMPv6_HDR_SIZE_DFLT
 #define  NET_ICMPv6_HDR_SIZE_TIME_EXCEED                 NET_ICMPv6_HDR_SIZE_DFLT
 #define  NET_ICMPv6_HDR_SIZE_PARAM_PROB                  NET_ICMPv6_HDR_SIZE_DFLT
 #define  NET_ICMPv6_HDR_SIZE_ECHO                        NET_ICMPv6_HDR_SIZE_DFLT
@@ -123,6 +127,7 @@
 #define  NET_ICMPv6_MSG_LEN_MIN_DFLT                     NET_ICMPv6_HDR_SIZE_DFLT
 
 #define  NET_ICMPv6_MSG_LEN_MIN_DEST_UNREACH            (NET_ICMPv6_HDR_SIZE_DEST_UNREACH + NET_ICMPv6_MSG_ERR_LEN_MIN)
+#define  NET_ICMPv6_MSG_LEN_MIN_PKT_TOO_BIG             (NET_ICMPv6_HDR_SIZE_PKT_TOO_BIG  + NET_ICMPv6_MSG_ERR_LEN_MIN)
 #define  NET_ICMPv6_MSG_LEN_MIN_TIME_EXCEED             (NET_ICMPv6_HDR_SIZE_TIME_EXCEED  + NET_ICMPv6_MSG_ERR_LEN_MIN)
 #define  NET_ICMPv6_MSG_LEN_MIN_PARAM_PROB              (NET_ICMPv6_HDR_SIZE_PARAM_PROB   + NET_ICMPv6_MSG_ERR_LEN_MIN)
 #define  NET_ICMPv6_MSG_LEN_MIN_ECHO                     NET_ICMPv6_HDR_SIZE_ECHO
@@ -131,6 +136,7 @@
 #define  NET_ICMPv6_MSG_LEN_MAX_NONE                     DEF_INT_16U_MAX_VAL
 
 #define  NET_ICMPv6_MSG_LEN_MAX_DEST_UNREACH             NET_ICMPv6_MSG_LEN_MAX_NONE
+#define  NET_ICMPv6_MSG_LEN_MAX_PKT_TOO_BIG              NET_ICMPv6_MSG_LEN_MAX_NONE
 #define  NET_ICMPv6_MSG_LEN_MAX_TIME_EXCEED              NET_ICMPv6_MSG_LEN_MAX_NONE
 #define  NET_ICMPv6_MSG_LEN_MAX_PARAM_PROB               NET_ICMPv6_MSG_LEN_MAX_NONE
 #define  NET_ICMPv6_MSG_LEN_MAX_ECHO                     NET_ICMPv6_MSG_LEN_MAX_NONE
@@ -263,6 +269,12 @@ static  void                       NetICMPv6_RxReplyDemux             (NET_BUF
                                                                        NET_ICMPv6_HDR            *p_icmp_hdr,
                                                                        NET_ERR                   *p_err);
 
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void                       NetICMPv6_RxMsgErrDemux            (NET_BUF                   *p_buf,
+                                                                       NET_BUF_HDR               *p_buf_hdr,
+                                                                       NET_ICMPv6_HDR            *p_icmp_hdr);
+#endif
+
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
 static  void                       NetICMPv6_RxPktValidateBuf         (NET_BUF_HDR               *p_buf_hdr,
                                                                        NET_ERR                   *p_err);
@@ -482,6 +494,9 @@ void  NetICMPv6_Rx (NET_BUF  *p_buf,
 
         case NET_ICMPv6_ERR_MSG_TYPE_ERR:                       /* See Note #3a.                                        */
              NET_CTR_STAT_INC(Net_StatCtrs.ICMPv6.RxMsgErrCtr);
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+             NetICMPv6_RxMsgErrDemux(p_buf, p_buf_hdr, p_icmp_hdr);
+#endif
              break;
 
 
@@ -714,7 +729,7 @@ exit_release:
 *
 *                       (1) Type                           See 'net_icmp.h  ICMP MESSAGE TYPES & CODES'
 *                       (2) Code                           See 'net_icmp.h  ICMP MESSAGE TYPES & CODES'
-*                       (3) Pointer
+*                       (3) Pointer                        See Note #8
 *                       (4) Unused
 *                       (5) Check-Sum
 *
@@ -737,7 +752,8 @@ exit_release:
 *
 *               code        ICMPv6 Error Message code (see Note #1c2).
 *
-*               ptr         Pointer to received packet's ICMPv6 error (optional).
+*               ptr         Pointer to received packet's ICMPv6 error (optional), or next-hop MTU for
+*                               Packet Too Big messages (see Note #8).
 *
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
@@ -780,6 +796,17 @@ exit_release:
 *                       back to host-order (see 'net_util.c  NetUtil_16BitOnesCplChkSumHdrCalc()  Note #3b').
 *
 *               (6) Network buffer already freed by lower layer; only increment error counter.
+*
+*               (7) RFC #4443, Section 2.2 states that if the message "is a response to a message sent to
+*                   an address that does not belong to the node, the Source Address of the reply MUST be a
+*                   unicast address belonging to the node". When the datagram was being forwarded, the
+*                   source address is therefore selected on the receiving interface.
+*
+*               (8) RFC #4443, Section 3.2 states that the Packet Too Big message's "MTU" field holds
+*                   "the Maximum Transmission Unit of the next-hop link".  Since this field has the same
+*                   offset & size as the Parameter Problem message's "Pointer" field, the next-hop MTU is
+*                   passed in 'ptr' & Packet Too Big messages are prepared with the Parameter Problem
+*                   header.
 *********************************************************************************************************
 */
 
@@ -805,6 +832,12 @@ void  NetICMPv6_TxMsgErr (NET_BUF     *p_buf,
     CPU_INT16U                  msg_ix_data;
     CPU_INT16U                  msg_chk_sum;
     CPU_INT16U                  data_ix;
+    const  NET_IPv6_ADDR       *p_addr_src;
+#ifdef  NET_IPv6_FWD_MODULE_EN
+    const  NET_IPv6_ADDRS      *p_addrs_src;
+    NET_IF_NBR                  if_nbr;
+    CPU_BOOLEAN                 addr_host;
+#endif
     NET_ERR                     err;
 
 
@@ -836,6 +869,25 @@ void  NetICMPv6_TxMsgErr (NET_BUF     *p_buf,
         return;
     }
 
+                                                                /* -------------- SEL ERR MSG SRC ADDR ---------------- */
+    p_addr_src = &p_buf_hdr->IPv6_AddrDest;
+#ifdef  NET_IPv6_FWD_MODULE_EN
+    addr_host  =  NetIPv6_IsAddrHostCfgdHandler(&p_buf_hdr->IPv6_AddrDest);
+    if (addr_host == DEF_NO) {                                  /* If rx'd datagram NOT for host (see Note #7), ...     */
+        if_nbr      = p_buf_hdr->IF_Nbr;                        /* ... sel src addr on rx'd IF.                         */
+        p_addrs_src = NetIPv6_GetAddrSrcHandler(&if_nbr,
+                                                 DEF_NULL,
+                                                &p_buf_hdr->IPv6_AddrSrc,
+                                                 DEF_NULL,
+                                                &err);
+        if (p_addrs_src == (NET_IPv6_ADDRS *)0) {
+            NetICMPv6_TxPktDiscard((NET_BUF *)0, p_err);
+            return;
+        }
+        p_addr_src = &p_addrs_src->AddrHost;
+    }
+#endif
+
                                                                 /* -------------- GET ICMPv6 ERR MSG BUF -------------- */
                                                                 /* Calc err msg buf size.                               */
     switch (type) {
@@ -844,6 +896,11 @@ void  NetICMPv6_TxMsgErr (NET_BUF     *p_buf,
              break;
 
 
+        case NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG:
+             msg_size_hdr = NET_ICMPv6_HDR_SIZE_PKT_TOO_BIG;
+             break;
+
+
         case NET_ICMPv6_MSG_TYPE_TIME_EXCEED:
              msg_size_hdr = NET_ICMPv6_HDR_SIZE_TIME_EXCEED;
              break;
@@ -941,8 +998,8 @@ void  NetICMPv6_TxMsgErr (NET_BUF     *p_buf,
                                                                                 /* Calc msg chk sum (see Note #6).      */
                                                                                 /* Prepare IPv6 pseudo-hdr.             */
              Mem_Clr(&pseudo_hdr, sizeof(NET_IPv6_PSEUDO_HDR));
-             pseudo_hdr.AddrSrc          = p_buf_hdr->IPv6_AddrDest;
-             pseudo_hdr.AddrDest         = p_buf_hdr->IPv6_AddrSrc;
+             pseudo_hdr.AddrSrc          = *p_addr_src;
+             pseudo_hdr.AddrDest         =  p_buf_hdr->IPv6_AddrSrc;
              pseudo_hdr.UpperLayerPktLen = NET_UTIL_HOST_TO_NET_32(p_msg_err_hdr->ICMP_MsgLen);
              pseudo_hdr.NextHdr          = NET_UTIL_HOST_TO_NET_16(NET_IP_HDR_PROTOCOL_ICMPv6);
 
@@ -969,6 +1026,7 @@ void  NetICMPv6_TxMsgErr (NET_BUF     *p_buf,
              break;
 
 
+        case NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG:                   /* See Note #8.                                         */
         case NET_ICMPv6_MSG_TYPE_PARAM_PROB:
              p_icmp_hdr_param_prob       = (NET_ICMPv6_HDR_PARAM_PROB *)&p_msg_err->DataPtr[p_msg_err_hdr->ICMP_MsgIx];
              p_icmp_hdr_param_prob->Type =  type;
@@ -978,8 +1036,8 @@ void  NetICMPv6_TxMsgErr (NET_BUF     *p_buf,
                                                                                 /* Calc msg chk sum (see Note #6).      */
                                                                                 /* Prepare IPv6 pseudo-hdr.             */
              Mem_Clr(&pseudo_hdr, sizeof(NET_IPv6_PSEUDO_HDR));
-             pseudo_hdr.AddrSrc          = p_buf_hdr->IPv6_AddrDest;
-             pseudo_hdr.AddrDest         = p_buf_hdr->IPv6_AddrSrc;
+             pseudo_hdr.AddrSrc          = *p_addr_src;
+             pseudo_hdr.AddrDest         =  p_buf_hdr->IPv6_AddrSrc;
              pseudo_hdr.UpperLayerPktLen = NET_UTIL_HOST_TO_NET_32(p_msg_err_hdr->ICMP_MsgLen);
              pseudo_hdr.NextHdr          = NET_UTIL_HOST_TO_NET_16(NET_IP_HDR_PROTOCOL_ICMPv6);
 
@@ -1013,7 +1071,7 @@ void  NetICMPv6_TxMsgErr (NET_BUF     *p_buf,
 
                                                                 /* ---------------- TX ICMPv6 ERR MSG ----------------- */
     NetIPv6_Tx(                    p_msg_err,
-                                  &p_buf_hdr->IPv6_AddrDest,
+               (NET_IPv6_ADDR    *)p_addr_src,
                                   &p_buf_hdr->IPv6_AddrSrc,
                (NET_IPv6_EXT_HDR *)0,
                                    NET_IPv6_HDR_TRAFFIC_CLASS,
@@ -1893,6 +1951,10 @@ exit_release:
 *                       Note #3b' & 'net_util.c  NetUtil_16BitOnesCplChkSumDataCalc()  Note #4b').
 *
 *               (8) Network buffer already freed by lower layer; only increment error counter.
+*
+*               (9) MLDPv2 Reports carry a single Multicast Address Record, passed in the data buffer &
+*                   copied after the 8-octet message header.  The header's second reserved field holds
+*                   the Number of Multicast Address Records (see RFC #3810, Section 5.2).
 *********************************************************************************************************
 */
 
@@ -2022,6 +2084,7 @@ NET_ICMPv6_REQ_ID_SEQ  NetICMPv6_TxMsgReqHandler (NET_IF_NBR         if_nbr,
 
 
         case NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V1:
+        case NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V2:
         case NET_ICMPv6_MSG_TYPE_MLDP_DONE:
              msg_size_hdr = NET_MLDP_HDR_SIZE_DFLT;
 
@@ -2367,6 +2430,33 @@ NET_ICMPv6_REQ_ID_SEQ  NetICMPv6_TxMsgReqHandler (NET_IF_NBR         if_nbr,
              break;
 
 
+        case NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V2:                /* See Note #9.                                         */
+             DEF_BIT_SET(p_msg_req_hdr->Flags, NET_BUF_FLAG_TX_MULTICAST);
+
+             p_icmp_hdr_v1 = (NET_MLDP_V1_HDR *)&p_msg_req_head->DataPtr[p_msg_req_hdr->ICMP_MsgIx];
+             p_icmp_hdr_v1->Type           = type;
+             p_icmp_hdr_v1->Code           = code;
+             Mem_Clr(&p_icmp_hdr_v1->MaxResponseDly, sizeof(p_icmp_hdr_v1->MaxResponseDly));
+             NET_UTIL_VAL_SET_NET_16(&p_icmp_hdr_v1->Reserved, 1u);
+
+                                                                            /* Calc ICMPv6 msg chk sum (see Note #5).   */
+             NET_UTIL_VAL_SET_NET_16(&p_icmp_hdr_v1->ChkSum, 0x0000u);      /* Clr             chk sum (see Note #5b).  */
+#ifdef NET_ICMP_CFG_CHK_SUM_OFFLOAD_TX
+             msg_chk_sum = 0u;
+#else
+             msg_chk_sum = NetUtil_16BitOnesCplChkSumDataCalc((void     *) p_msg_req_head,
+                                                              (void     *)&ipv6_pseudo_hdr,
+                                                                           NET_IPv6_PSEUDO_HDR_SIZE,
+                                                                          &err);
+#endif
+             if (err != NET_UTIL_ERR_NONE) {
+                 NetICMPv6_TxPktDiscard(p_msg_req_head, p_err);
+                 goto exit;
+             }
+             NET_UTIL_VAL_COPY_16(&p_icmp_hdr_v1->ChkSum, &msg_chk_sum);
+             break;
+
+
         default:                                                /* See Note #4.                                         */
              NetICMPv6_TxPktDiscard(p_msg_req_head, p_err);
              goto exit;
@@ -2429,6 +2519,85 @@ exit:
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                      NetICMPv6_RxMsgErrDemux()
+*
+* Description : Demultiplex ICMPv6 'Packet Too Big' error message to TCP path MTU discovery.
+*
+* Argument(s) : p_buf       Pointer to network buffer that received ICMPv6 message.
+*               -----       Argument checked   in NetICMPv6_Rx().
+*
+*               p_buf_hdr   Pointer to network buffer header.
+*               ---------   Argument validated in NetICMPv6_Rx().
+*
+*               p_icmp_hdr  Pointer to network buffer ICMPv6 header.
+*               ----------  Argument validated in NetICMPv6_Rx().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetICMPv6_Rx().
+*
+* Note(s)     : (1) ICMPv6 error messages in fragmented packet buffers are NOT demultiplexed.
+*
+*               (2) The returned packet MUST include the IPv6 header & the first 8 octets of the TCP header;
+*                   i.e. the TCP ports & sequence number (see RFC #4443, Section 3.2 & RFC #8201, Section 4).
+*                   Returned packets with IPv6 extension headers are NOT demultiplexed.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void  NetICMPv6_RxMsgErrDemux (NET_BUF         *p_buf,
+                                       NET_BUF_HDR     *p_buf_hdr,
+                                       NET_ICMPv6_HDR  *p_icmp_hdr)
+{
+    NET_ICMPv6_HDR_ERR  *p_icmp_err_hdr;
+    NET_IPv6_HDR        *p_ip_hdr;
+    NET_IPv6_ADDR        addr_src;
+    NET_IPv6_ADDR        addr_dest;
+    CPU_INT32U           mtu;
+    CPU_INT16U           msg_len_min;
+
+
+   (void)&p_buf;
+
+    if ((p_icmp_hdr->Type != NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG) ||
+        (p_icmp_hdr->Code != NET_ICMPv6_MSG_CODE_PKT_TOO_BIG)) {
+        return;
+    }
+
+    if (p_buf_hdr->NextBufPtr != DEF_NULL) {                    /* See Note #1.                                         */
+        return;
+    }
+
+                                                                /* -------------- VALIDATE RETURNED PKT --------------- */
+    p_icmp_err_hdr = (NET_ICMPv6_HDR_ERR *)p_icmp_hdr;
+    p_ip_hdr       = (NET_IPv6_HDR       *)&p_icmp_err_hdr->Data[0];
+                                                                /* See Note #2.                                         */
+    msg_len_min = NET_ICMPv6_HDR_SIZE_PKT_TOO_BIG + NET_IPv6_HDR_SIZE + NET_ICMPv6_MSG_ERR_DATA_SIZE_MIN_OCTETS;
+    if (p_buf_hdr->ICMP_MsgLen < msg_len_min) {
+        return;
+    }
+
+    if (p_ip_hdr->NextHdr != NET_IP_HDR_PROTOCOL_TCP) {
+        return;
+    }
+
+                                                                /* ------------------- GET PATH MTU ------------------- */
+    mtu = NET_UTIL_VAL_GET_NET_32(&p_icmp_err_hdr->Unused[0]);
+
+                                                                /* ------------------- DEMUX TO TCP ------------------- */
+    Mem_Copy(&addr_src,  &p_ip_hdr->AddrSrc,  sizeof(addr_src));
+    Mem_Copy(&addr_dest, &p_ip_hdr->AddrDest, sizeof(addr_dest));
+
+    NetTCP_RxPathMTU_IPv6(&addr_src,
+                          &addr_dest,
+                          (NET_TCP_HDR *)((CPU_INT08U *)p_ip_hdr + NET_IPv6_HDR_SIZE),
+                          mtu);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    NetICMPv6_RxPktValidateBuf()
@@ -2728,6 +2897,23 @@ static  void  NetICMPv6_RxPktValidate (NET_BUF         *p_buf,
              break;
 
 
+        case NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG:
+             switch (p_icmp_hdr->Code) {
+                 case NET_ICMPv6_MSG_CODE_PKT_TOO_BIG:
+                      icmp_msg_len_hdr = NET_ICMPv6_HDR_SIZE_PKT_TOO_BIG;
+                      icmp_msg_len_min = NET_ICMPv6_MSG_LEN_MIN_PKT_TOO_BIG;
+                      icmp_msg_len_max = NET_ICMPv6_MSG_LEN_MAX_PKT_TOO_BIG;
+                      break;
+
+
+                 default:
+                      NET_CTR_ERR_INC(Net_ErrCtrs.ICMPv6.RxHdrCodeCtr);
+                     *p_err = NET_ICMPv6_ERR_INVALID_CODE;
+                      return;
+             }
+             break;
+
+
         case NET_ICMPv6_MSG_TYPE_TIME_EXCEED:
              switch (p_icmp_hdr->Code) {
                  case NET_ICMPv6_MSG_CODE_TIME_EXCEED_HOP_LIMIT:
@@ -2920,6 +3106,7 @@ static  void  NetICMPv6_RxPktValidate (NET_BUF         *p_buf,
              break;
 
 
+        case NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG:
         case NET_ICMPv6_MSG_TYPE_ECHO_REQ:
         case NET_ICMPv6_MSG_TYPE_ECHO_REPLY:
         case NET_ICMPv6_MSG_TYPE_NDP_NEIGHBOR_SOL:
@@ -2964,6 +3151,7 @@ static  void  NetICMPv6_RxPktValidate (NET_BUF         *p_buf,
 
     switch (p_icmp_hdr->Type) {
         case NET_ICMPv6_MSG_TYPE_DEST_UNREACH:
+        case NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG:
         case NET_ICMPv6_MSG_TYPE_TIME_EXCEED:
         case NET_ICMPv6_MSG_TYPE_PARAM_PROB:
              p_buf_hdr->DataLen = 0u;                           /* Clr data len/ix       (see Note #9a1).               */
@@ -3027,6 +3215,7 @@ static  void  NetICMPv6_RxPktValidate (NET_BUF         *p_buf,
                                                                 /* -------------- DEMUX ICMPv6 MSG TYPE --------------- */
     switch (p_icmp_hdr->Type) {
         case NET_ICMPv6_MSG_TYPE_DEST_UNREACH:
+        case NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG:
         case NET_ICMPv6_MSG_TYPE_TIME_EXCEED:
         case NET_ICMPv6_MSG_TYPE_PARAM_PROB:
             *p_err = NET_ICMPv6_ERR_MSG_TYPE_ERR;
@@ -3244,6 +3433,10 @@ static  void  NetICMPv6_RxPktDiscard (NET_BUF  *p_buf,
 *
 *                   (d) See 'net_icmpv6.h  ICMP POINTER DEFINES  Note #2' for supported ICMPv6 Parameter Problem
 *                       Message protocols.
+*
+*               (6) An ICMPv6 Packet Too Big Message's next-hop MTU is passed as its pointer field value
+*                   (see 'NetICMPv6_TxMsgErr()  Note #8') & MUST NOT be less than the IPv6 minimum link
+*                   MTU.
 *********************************************************************************************************
 */
 
@@ -3315,6 +3508,7 @@ static  void  NetICMPv6_TxMsgErrValidate (NET_BUF       *p_buf,
 
         switch (p_icmp_hdr->Type) {                              /* ... chk ICMPv6 msg type & ...                        */
             case NET_ICMPv6_MSG_TYPE_DEST_UNREACH:
+            case NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG:
             case NET_ICMPv6_MSG_TYPE_TIME_EXCEED:
             case NET_ICMPv6_MSG_TYPE_PARAM_PROB:
                 *p_err = NET_ICMPv6_ERR_TX_INVALID_ERR_MSG;      /* ... rtn err for ICMPv6 err msgs (see Note #1a1).     */
@@ -3365,6 +3559,20 @@ static  void  NetICMPv6_TxMsgErrValidate (NET_BUF       *p_buf,
              break;
 
 
+        case NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG:
+             if (code != NET_ICMPv6_MSG_CODE_PKT_TOO_BIG) {
+                 NET_CTR_ERR_INC(Net_ErrCtrs.ICMPv6.TxHdrCodeCtr);
+                *p_err = NET_ICMPv6_ERR_INVALID_CODE;
+                 return;
+             }
+             if (ptr < NET_IPv6_MAX_DATAGRAM_SIZE_DFLT) {       /* Validate next-hop MTU (see Note #6).                 */
+                 NET_CTR_ERR_INC(Net_ErrCtrs.ICMPv6.TxHdrPtrCtr);
+                *p_err = NET_ICMPv6_ERR_INVALID_PTR;
+                 return;
+             }
+             break;
+
+
         case NET_ICMPv6_MSG_TYPE_TIME_EXCEED:
              switch (code) {
                  case NET_ICMPv6_MSG_CODE_TIME_EXCEED_HOP_LIMIT:
@@ -3385,7 +3593,7 @@ static  void  NetICMPv6_TxMsgErrValidate (NET_BUF       *p_buf,
                  case NET_ICMPv6_MSG_CODE_PARAM_PROB_IP_HDR:
                  case NET_ICMPv6_MSG_CODE_PARAM_PROB_BAD_NEXT_HDR:
                  case NET_ICMPv6_MSG_CODE_PARAM_PROB_BAD_OPT:
-                                                                /* Validate ICMPv6 Param Prob Msg ptr (see Note #6).    */
+                                                                /* Validate ICMPv6 Param Prob Msg ptr (see Note #5).    */
 #if 0                                                           /* See Note #5b.                                        */
                       if (ptr < NET_ICMPv6_PTR_IX_BASE) {
                           NET_CTR_ERR_INC(Net_ErrCtrs.ICMPv6.TxHdrPtrCtr);
@@ -3446,6 +3654,7 @@ static  void  NetICMPv6_TxMsgErrValidate (NET_BUF       *p_buf,
 *                               NET_ICMPv6_MSG_TYPE_NDP_ROUTER_SOL
 *                               NET_ICMPv6_MSG_TYPE_NDP_NEIGHBOR_SOL
 *                               NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V1
+*                               NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V2
 *                               NET_ICMPv6_MSG_TYPE_MLDP_DONE
 *
 *               code        ICMPv6 Request Message code (see Note #1b).
@@ -3515,6 +3724,7 @@ static  void  NetICMPv6_TxMsgReqValidate (CPU_INT08U   type,
 
 
         case NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V1:
+        case NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V2:
              switch (code) {
                  case NET_ICMPv6_MSG_CODE_MLDP_REPORT:
                       break;
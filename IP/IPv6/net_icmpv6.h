@@ -132,6 +132,8 @@
 #define  NET_ICMPv6_MSG_CODE_DEST_SRC_ADDR_FAIL_INGRESS    5u
 #define  NET_ICMPv6_MSG_CODE_DEST_ROUTE_REJECT             6u
 
+#define  NET_ICMPv6_MSG_CODE_PKT_TOO_BIG                   0u
+
 #define  NET_ICMPv6_MSG_CODE_TIME_EXCEED_HOP_LIMIT         0u
 #define  NET_ICMPv6_MSG_CODE_TIME_EXCEED_FRAG_REASM        1u
 
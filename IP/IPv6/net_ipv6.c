@@ -26,7 +26,9 @@
 * Note(s)  : (1) Supports Internet Protocol as described in RFC #2460, also known as IPv6, with the
 *                following restrictions/constraints :
 *
-*                (a) IPv6 forwarding/routing NOT currently supported       RFC #2460
+*                (a) IPv6 forwarding/routing supported ONLY if             RFC #2460
+*                    NET_IPv6_CFG_FWD_EN is enabled; ICMPv6 Packet Too
+*                    Big & Redirect messages NOT       supported
 *
 *                (b) Transmit fragmentation  NOT currently supported       RFC #2460, Section 4.5
 *                                                                         'Fragment Header'
@@ -94,6 +96,20 @@
 #define  NET_IPv6_AUTO_CFG_RAND_RETRY_MAX                3
 
 
+/*
+*********************************************************************************************************
+*                                  IPv6 HOST ADDRESS INDEX DEFINES
+*
+* Note(s) : (1) The host address index is an open-addressed hash table of every configured IPv6 host
+*               address & its solicited-node multicast address on every interface. The table is sized to
+*               twice the maximum number of indexed addresses so that it is never more than half full &
+*               linear probing stays short.
+*********************************************************************************************************
+*/
+
+#define  NET_IPv6_ADDR_HASH_TBL_SIZE                    (NET_IF_NBR_IF_TOT * NET_IPv6_CFG_IF_MAX_NBR_ADDR * 4u)
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -140,6 +156,24 @@ typedef  struct  net_ipv6_policy {
 } NET_IPv6_POLICY;
 
 
+/*
+*********************************************************************************************************
+*                                IPv6 HOST ADDRESS INDEX ENTRY DATA TYPE
+*
+* Note(s) : (1) 'AddrPtr' points either to the host address or to the solicited-node multicast address of
+*               the IPv6 addresses structure pointed by 'AddrsPtr'.
+*
+*           (2) An index entry is free when 'AddrsPtr' is NULL.
+*********************************************************************************************************
+*/
+
+typedef  struct  net_ipv6_addr_hash_entry {
+    const  NET_IPv6_ADDR   *AddrPtr;                            /* Ptr to indexed IPv6 addr      (see Note #1).         */
+           NET_IPv6_ADDRS  *AddrsPtr;                           /* Ptr to IF's cfg'd IPv6 addrs  (see Note #2).         */
+           NET_IF_NBR       IF_Nbr;                             /* IF nbr of cfg'd IPv6 addr.                           */
+} NET_IPv6_ADDR_HASH_ENTRY;
+
+
 /*
 ---------------------------------------------------------------------------------------------------------
 -                                              POLICY 01
@@ -359,6 +393,9 @@ static  const  NET_IPv6_POLICY  *NetIPv6_PolicyTbl[]   = {
 
 static  NET_IPv6_IF_CFG               NetIPv6_IF_CfgTbl[NET_IF_NBR_IF_TOT];
 
+                                                                      /* Cfg'd host addrs index.                        */
+static  NET_IPv6_ADDR_HASH_ENTRY      NetIPv6_AddrHashTbl[NET_IPv6_ADDR_HASH_TBL_SIZE];
+
 
 static  NET_BUF                      *NetIPv6_FragReasmListsHead;     /* Ptr to head of frag reasm lists.               */
 static  NET_BUF                      *NetIPv6_FragReasmListsTail;     /* Ptr to tail of frag reasm lists.               */
@@ -424,6 +461,19 @@ static  const  NET_IPv6_ADDRS   *NetIPv6_AddrSrcSel               (       NET_IF
 
 static  const  NET_IPv6_POLICY  *NetIPv6_AddrSelPolicyGet         (const  NET_IPv6_ADDR             *p_addr);
 
+                                                                            /* -------- HOST ADDR INDEX FNCTS --------- */
+static         void              NetIPv6_AddrHashRebuild          (       void);
+
+static         void              NetIPv6_AddrHashInsert           (const  NET_IPv6_ADDR             *p_addr,
+                                                                          NET_IPv6_ADDRS            *p_ip_addrs,
+                                                                          NET_IF_NBR                 if_nbr);
+
+static         NET_IPv6_ADDRS   *NetIPv6_AddrHashSrch             (const  NET_IPv6_ADDR             *p_addr,
+                                                                          NET_IF_NBR                 if_nbr,
+                                                                          NET_IF_NBR                *p_if_nbr);
+
+static         CPU_INT32U        NetIPv6_AddrHash                 (const  NET_IPv6_ADDR             *p_addr);
+
 
 
                                                                             /* -------------- CFG FNCTS --------------- */
@@ -444,6 +494,12 @@ static         void              NetIPv6_RxPktValidate            (       NET_BU
                                                                           NET_IPv6_HDR              *p_ip_hdr,
                                                                           NET_ERR                   *p_err);
 
+#if (defined(NET_MLDP_MODULE_EN) && defined(NET_MCAST_SRC_FILTER_MODULE_EN))
+static         CPU_BOOLEAN       NetIPv6_RxPktIsMLDP_Msg          (       NET_BUF                   *p_buf,
+                                                                          NET_BUF_HDR               *p_buf_hdr,
+                                                                          NET_IPv6_HDR              *p_ip_hdr);
+#endif
+
 static         void              NetIPv6_RxPktValidateNextHdr     (       NET_BUF                   *p_buf,
                                                                           NET_BUF_HDR               *p_buf_hdr,
                                                                           NET_IPv6_NEXT_HDR          next_hdr,
@@ -532,6 +588,14 @@ static         void              NetIPv6_RxPktDemuxDatagram       (       NET_BU
                                                                           NET_BUF_HDR               *p_buf_hdr,
                                                                           NET_ERR                   *p_err);
 
+#ifdef  NET_IPv6_FWD_MODULE_EN
+                                                                            /* ---------- FWD RX DATAGRAMS ------------ */
+static         void              NetIPv6_RxPktFwd                 (       NET_BUF                   *p_buf,
+                                                                          NET_BUF_HDR               *p_buf_hdr,
+                                                                          NET_IPv6_HDR              *p_ip_hdr,
+                                                                          NET_ERR                   *p_err);
+#endif
+
 
 static         void              NetIPv6_RxPktDiscard             (       NET_BUF                   *p_buf,
                                                                           NET_ERR                   *p_err);
@@ -684,6 +748,8 @@ void  NetIPv6_Init (NET_ERR  *p_err)
 
     }
 
+    NetIPv6_AddrHashRebuild();                                  /* Init host addr index.                                */
+
 #ifdef NET_DAD_MODULE_EN
     NetDAD_Init(p_err);
     if (*p_err != NET_DAD_ERR_NONE) {
@@ -1608,6 +1674,7 @@ NET_IPv6_ADDRS  *NetIPv6_CfgAddrAddHandler (NET_IF_NBR               if_nbr,
         p_ip_addrs->IfNbr             = if_nbr;                 /* Configure IF number of address.                      */
 
         p_ip_if_cfg->AddrsNbrCfgd++;                            /* Increment number of address configured on IF.        */
+        NetIPv6_AddrHashRebuild();                              /* Update host addr index.                              */
 
     }
 
@@ -1638,6 +1705,7 @@ NET_IPv6_ADDRS  *NetIPv6_CfgAddrAddHandler (NET_IF_NBR               if_nbr,
             }
 
             p_ip_addrs->AddrMcastSolicitedPtr = &p_host_grp->AddrGrp;
+            NetIPv6_AddrHashRebuild();                          /* Update host addr index.                              */
 
         } else {
             p_host_grp = NetMLDP_HostGrpJoinHandler(if_nbr,     /* Join  mcast group of the solicited mcast.            */
@@ -2075,6 +2143,7 @@ CPU_BOOLEAN  NetIPv6_CfgAddrRemoveHandler (NET_IF_NBR      if_nbr,
     p_ip_addrs->AddrHostPrefixLen     = 0u;
 
     p_ip_if_cfg->AddrsNbrCfgd--;
+    NetIPv6_AddrHashRebuild();                                          /* Update host addr index.                      */
 
    *p_err  = NET_IPv6_ERR_NONE;
     result = DEF_OK;
@@ -2290,6 +2359,7 @@ CPU_BOOLEAN  NetIPv6_CfgAddrRemoveAllHandler (NET_IF_NBR   if_nbr,
     }
 
     p_ip_if_cfg->AddrsNbrCfgd = 0u;                                     /* NO  addr(s) cfg'd.                           */
+    NetIPv6_AddrHashRebuild();                                          /* Update host addr index.                      */
 
 
    *p_err =  NET_IPv6_ERR_NONE;
@@ -3442,17 +3512,8 @@ NET_IPv6_ADDRS  *NetIPv6_GetAddrsHost (const  NET_IPv6_ADDR  *p_addr,
 
 
                                                                 /* -------- SRCH ALL CFG'D IF's FOR IPv6 ADDR --------- */
-    if_nbr     =  NET_IF_NBR_BASE_CFGD;
-    p_ip_addrs = (NET_IPv6_ADDRS *)0;
-
-    while ((if_nbr     <   NET_IF_NBR_IF_TOT) &&                /* Srch all cfg'd IF's ...                              */
-           (p_ip_addrs == (NET_IPv6_ADDRS *)0)) {               /* ... until addr found.                                */
-
-        p_ip_addrs = NetIPv6_GetAddrsHostOnIF(if_nbr, p_addr);
-        if (p_ip_addrs == (NET_IPv6_ADDRS *)0) {                /* If addr NOT found, ...                               */
-            if_nbr++;                                           /* ... adv to next IF nbr.                              */
-        }
-    }
+    if_nbr     =  NET_IF_NBR_NONE;
+    p_ip_addrs =  NetIPv6_AddrHashSrch(p_addr, NET_IF_NBR_WILDCARD, &if_nbr);
 
     if (p_ip_addrs != (NET_IPv6_ADDRS *)0) {                    /* If addr avail, ...                                   */
         if (p_if_nbr != (NET_IF_NBR *)0) {
@@ -3499,13 +3560,7 @@ NET_IPv6_ADDRS  *NetIPv6_GetAddrsHostOnIF (       NET_IF_NBR      if_nbr,
     CPU_BOOLEAN        valid;
     NET_ERR            err;
 #endif
-           NET_IPv6_IF_CFG   *p_ip_if_cfg;
-           NET_IPv6_ADDRS    *p_ip_addrs;
-    const  NET_IPv6_ADDR     *p_mcast_solicited_addr;
-           NET_IP_ADDRS_QTY   addr_ix;
-           CPU_BOOLEAN        addr_found;
-           CPU_BOOLEAN        addr_found_host;
-           CPU_BOOLEAN        addr_found_mcast_solicited;
+    NET_IPv6_ADDRS    *p_ip_addrs;
 
 
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* ----------------- VALIDATE IF NBR ------------------ */
@@ -3520,36 +3575,216 @@ NET_IPv6_ADDRS  *NetIPv6_GetAddrsHostOnIF (       NET_IF_NBR      if_nbr,
     }
 
                                                                 /* -------------- SRCH IF FOR IPv6 ADDR --------------- */
-    addr_ix                    =  0u;
-    addr_found                 =  DEF_NO;
-    addr_found_host            =  DEF_NO;
-    addr_found_mcast_solicited =  DEF_NO;
-    p_ip_if_cfg                = &NetIPv6_IF_CfgTbl[if_nbr];
-    p_ip_addrs                 = &p_ip_if_cfg->AddrsTbl[addr_ix];
+    p_ip_addrs = NetIPv6_AddrHashSrch(p_addr, if_nbr, (NET_IF_NBR *)0);
 
-    while ((addr_ix    <  p_ip_if_cfg->AddrsNbrCfgd) &&         /* Srch all cfg'd addrs ...                             */
-           (addr_found == DEF_NO)) {                            /* ... until addr found.                                */
+    return (p_ip_addrs);
+}
 
-        p_mcast_solicited_addr = p_ip_addrs->AddrMcastSolicitedPtr;
 
-        addr_found_host = Mem_Cmp(p_addr, &p_ip_addrs->AddrHost, NET_IPv6_ADDR_SIZE);
-        if (addr_found_host == DEF_NO) {
-            addr_found_mcast_solicited = Mem_Cmp(p_addr, p_mcast_solicited_addr, NET_IPv6_ADDR_SIZE);
+/*
+*********************************************************************************************************
+*                                      NetIPv6_AddrHashRebuild()
+*
+* Description : Rebuild the host address index from ALL interfaces' configured IPv6 addresses.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIPv6_Init(),
+*               NetIPv6_CfgAddrAddHandler(),
+*               NetIPv6_CfgAddrRemoveHandler(),
+*               NetIPv6_CfgAddrRemoveAllHandler(),
+*               NetIPv6_AddrValidLifetimeTimeout().
+*
+* Note(s)     : (1) The index MUST be rebuilt each time an interface's address table or an address'
+*                   solicited-node multicast address is modified.
+*
+*               (2) For each address, the host address is inserted before its solicited-node multicast
+*                   address, in interface & address table order. Since linear probing never moves an
+*                   inserted entry, NetIPv6_AddrHashSrch() returns the same address structure as a
+*                   sequential search of ALL interfaces' address tables.
+*********************************************************************************************************
+*/
+
+static  void  NetIPv6_AddrHashRebuild (void)
+{
+    NET_IPv6_IF_CFG   *p_ip_if_cfg;
+    NET_IPv6_ADDRS    *p_ip_addrs;
+    NET_IP_ADDRS_QTY   addr_ix;
+    NET_IF_NBR         if_nbr;
+
+
+    Mem_Clr(&NetIPv6_AddrHashTbl[0],
+             sizeof(NetIPv6_AddrHashTbl));
+
+    for (if_nbr = NET_IF_NBR_BASE; if_nbr < NET_IF_NBR_IF_TOT; if_nbr++) {
+        p_ip_if_cfg = &NetIPv6_IF_CfgTbl[if_nbr];
+        p_ip_addrs  = &p_ip_if_cfg->AddrsTbl[0];
+
+        for (addr_ix = 0u; addr_ix < p_ip_if_cfg->AddrsNbrCfgd; addr_ix++) {
+            NetIPv6_AddrHashInsert(&p_ip_addrs->AddrHost, p_ip_addrs, if_nbr);
+
+            if (p_ip_addrs->AddrMcastSolicitedPtr != (NET_IPv6_ADDR *)0) {
+                NetIPv6_AddrHashInsert(p_ip_addrs->AddrMcastSolicitedPtr, p_ip_addrs, if_nbr);
+            }
+            p_ip_addrs++;
         }
+    }
+}
 
-        addr_found = addr_found_host | addr_found_mcast_solicited;
 
-        if (addr_found == DEF_NO) {                             /* If addr NOT found, ...                               */
-            p_ip_addrs++;                                       /* ... adv to IF's next addr.                           */
-            addr_ix++;
+/*
+*********************************************************************************************************
+*                                       NetIPv6_AddrHashInsert()
+*
+* Description : Insert an IPv6 address in the host address index.
+*
+* Argument(s) : p_addr      Pointer to IPv6 address to index.
+*               ------      Argument validated in NetIPv6_AddrHashRebuild().
+*
+*               p_ip_addrs  Pointer to IPv6 addresses structure of the indexed address.
+*               ----------  Argument validated in NetIPv6_AddrHashRebuild().
+*
+*               if_nbr      Interface number of the indexed address.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIPv6_AddrHashRebuild().
+*
+* Note(s)     : (1) The index is sized so that a free entry is always available (see 'IPv6 HOST ADDRESS
+*                   INDEX DEFINES  Note #1').
+*********************************************************************************************************
+*/
+
+static  void  NetIPv6_AddrHashInsert (const  NET_IPv6_ADDR   *p_addr,
+                                             NET_IPv6_ADDRS  *p_ip_addrs,
+                                             NET_IF_NBR       if_nbr)
+{
+    NET_IPv6_ADDR_HASH_ENTRY  *p_entry;
+    CPU_BOOLEAN                addr_unspecified;
+    CPU_INT32U                 ix;
+
+
+    addr_unspecified = NetIPv6_IsAddrUnspecified(p_addr);
+    if (addr_unspecified == DEF_YES) {
+        return;
+    }
+                                                                /* Find first free entry from addr's hash ix.           */
+    ix      =  NetIPv6_AddrHash(p_addr);
+    p_entry = &NetIPv6_AddrHashTbl[ix];
+    while (p_entry->AddrsPtr != (NET_IPv6_ADDRS *)0) {          /* See Note #1.                                         */
+        ix      = (ix + 1u) % NET_IPv6_ADDR_HASH_TBL_SIZE;
+        p_entry = &NetIPv6_AddrHashTbl[ix];
+    }
+
+    p_entry->AddrPtr  = p_addr;
+    p_entry->AddrsPtr = p_ip_addrs;
+    p_entry->IF_Nbr   = if_nbr;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetIPv6_AddrHashSrch()
+*
+* Description : Search the host address index for a configured IPv6 host or solicited-node multicast
+*               address.
+*
+* Argument(s) : p_addr      Pointer to IPv6 address to search.
+*               ------      Argument validated by caller(s).
+*
+*               if_nbr      Interface number to search for configured IPv6 address, or
+*                               NET_IF_NBR_WILDCARD to search ALL interfaces.
+*
+*               p_if_nbr    Pointer to variable that will receive the interface number of the configured
+*                               IPv6 address, if found (optional).
+*
+* Return(s)   : Pointer to corresponding IPv6 addresses structure, if IPv6 address found.
+*
+*               Pointer to NULL,                                   otherwise.
+*
+* Caller(s)   : NetIPv6_GetAddrsHost(),
+*               NetIPv6_GetAddrsHostOnIF().
+*
+* Note(s)     : (1) Search ends on the first free entry since entries are never removed individually
+*                   (see 'NetIPv6_AddrHashRebuild()  Note #1').
+*
+*               (2) A wildcard search skips reserved interfaces, like a sequential search starting at
+*                   NET_IF_NBR_BASE_CFGD.
+*********************************************************************************************************
+*/
+
+static  NET_IPv6_ADDRS  *NetIPv6_AddrHashSrch (const  NET_IPv6_ADDR  *p_addr,
+                                                      NET_IF_NBR      if_nbr,
+                                                      NET_IF_NBR     *p_if_nbr)
+{
+    NET_IPv6_ADDR_HASH_ENTRY  *p_entry;
+    CPU_BOOLEAN                addr_found;
+    CPU_INT32U                 ix;
+    CPU_INT32U                 nbr_srch;
+
+
+    ix       = NetIPv6_AddrHash(p_addr);
+    nbr_srch = 0u;
+
+    while (nbr_srch < NET_IPv6_ADDR_HASH_TBL_SIZE) {
+        p_entry = &NetIPv6_AddrHashTbl[ix];
+        if (p_entry->AddrsPtr == (NET_IPv6_ADDRS *)0) {         /* See Note #1.                                         */
+            break;
+        }
+
+        if (((if_nbr          == NET_IF_NBR_WILDCARD)  &&       /* See Note #2.                                         */
+             (p_entry->IF_Nbr >= NET_IF_NBR_BASE_CFGD)) ||
+             (p_entry->IF_Nbr == if_nbr)) {
+            addr_found = Mem_Cmp(p_addr, p_entry->AddrPtr, NET_IPv6_ADDR_SIZE);
+            if (addr_found == DEF_YES) {
+                if (p_if_nbr != (NET_IF_NBR *)0) {
+                   *p_if_nbr  = p_entry->IF_Nbr;
+                }
+                return (p_entry->AddrsPtr);
+            }
         }
+
+        ix = (ix + 1u) % NET_IPv6_ADDR_HASH_TBL_SIZE;
+        nbr_srch++;
     }
 
-    if (addr_found != DEF_YES) {
-        return ((NET_IPv6_ADDRS *)0);
+
+    return ((NET_IPv6_ADDRS *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetIPv6_AddrHash()
+*
+* Description : Get the host address index hash of an IPv6 address.
+*
+* Argument(s) : p_addr      Pointer to IPv6 address.
+*               ------      Argument validated by caller(s).
+*
+* Return(s)   : Index in the host address index.
+*
+* Caller(s)   : NetIPv6_AddrHashInsert(),
+*               NetIPv6_AddrHashSrch().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  NetIPv6_AddrHash (const  NET_IPv6_ADDR  *p_addr)
+{
+    CPU_INT32U  hash;
+    CPU_INT08U  i;
+
+
+    hash = 0u;
+    for (i = 0u; i < NET_IPv6_ADDR_SIZE; i++) {
+        hash = (hash * 31u) + p_addr->Addr[i];
     }
 
-    return (p_ip_addrs);
+    return (hash % NET_IPv6_ADDR_HASH_TBL_SIZE);
 }
 
 
@@ -5626,6 +5861,13 @@ void  NetIPv6_Rx (NET_BUF  *p_buf,
              break;
 
 
+#ifdef  NET_IPv6_FWD_MODULE_EN
+        case NET_IPv6_ERR_RX_FWD:                               /* Datagram NOT for this host, fwd it.                  */
+             NetIPv6_RxPktFwd(p_buf, p_buf_hdr, p_ip_hdr, p_err);
+             return;
+#endif
+
+
         case NET_IF_ERR_INVALID_IF:
         case NET_IPv6_ERR_INVALID_VER:
         case NET_IPv6_ERR_INVALID_LEN_HDR:
@@ -6718,6 +6960,7 @@ void  NetIPv6_AddrValidLifetimeTimeout (void  *p_ipv6_addr_timeout)
     Mem_Clr(&p_ipv6_addrs->AddrHost, NET_IPv6_ADDR_SIZE);
 
     p_ipv6_if_cfg->AddrsNbrCfgd--;
+    NetIPv6_AddrHashRebuild();                                  /* Update host addr index.                              */
 }
 
 
@@ -7854,6 +8097,7 @@ static  void  NetIPv6_RxPktValidateBuf (NET_BUF_HDR  *p_buf_hdr,
 *                               NET_IPv6_ERR_INVALID_ADDR_SRC           Invalid IPv6 source      address.
 *                               NET_IPv6_ERR_INVALID_ADDR_DEST          Invalid IPv6 destination address.
 *                               NET_IPv6_ERR_INVALID_EH                 Invalid IPv6 Extension header.
+*                               NET_IPv6_ERR_RX_FWD                     Received packet to forward (see Note #6c2).
 *
 *                                                                       --- RETURNED BY NetIF_IsEnHandler() : ----
 *                               NET_IF_ERR_INVALID_IF                   Invalid OR disabled network interface.
@@ -7962,6 +8206,10 @@ static  void  NetIPv6_RxPktValidateBuf (NET_BUF_HDR  *p_buf_hdr,
 *                               (2) MUST NOT be one of the following :
 *                                   (a) Unspecified  IPv6 address
 *
+*                       (2) If IPv6 forwarding is enabled, a unicast datagram that is NOT destined for any
+*                           of the host's IPv6 address(es) is NOT discarded but returned to NetIPv6_Rx()
+*                           to be forwarded (see 'NetIPv6_RxPktFwd()').
+*
 *              (7) See 'net_ipv6.h  IPv6 ADDRESS DEFINES  Notes #2 & #3' for supported IPv6 addresses.
 *********************************************************************************************************
 */
@@ -7992,6 +8240,9 @@ static  void  NetIPv6_RxPktValidate (NET_BUF        *p_buf,
            CPU_BOOLEAN          rx_remote_host;
 #ifdef NET_MLDP_MODULE_EN
            CPU_BOOLEAN          grp_joined;
+#ifdef NET_MCAST_SRC_FILTER_MODULE_EN
+           CPU_BOOLEAN          is_mldp_msg;
+#endif
 #endif
 #ifdef NET_ICMPv6_MODULE_EN
            NET_ERR              msg_err;
@@ -8012,6 +8263,8 @@ static  void  NetIPv6_RxPktValidate (NET_BUF        *p_buf,
        *p_err = NET_IPv6_ERR_INVALID_VER;
         return;
     }
+                                                                /* Get rx'd ECN codepoint from traffic class.           */
+    p_buf_hdr->IP_ECN = (CPU_INT08U)((ip_ver_traffic_flow >> NET_IPv6_HDR_TRAFFIC_CLASS_SHIFT) & NET_IP_ECN_MASK);
 
 #if  (NET_IPv6_CFG_TRAFFIC_CLASS_EN == DEF_ENABLED)
                                                                 /* ----------- VALIDATE IPv6 TRAFFIC CLASS ------------ */
@@ -8166,6 +8419,21 @@ static  void  NetIPv6_RxPktValidate (NET_BUF        *p_buf,
                  *p_err = NET_IPv6_ERR_INVALID_ADDR_DEST;
                   return;
               }
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+              if (addr_type == NET_IPv6_ADDR_TYPE_MCAST) {      /* Chk grp src filter, except for MLDP msgs.            */
+                  is_mldp_msg = NetIPv6_RxPktIsMLDP_Msg(p_buf, p_buf_hdr, p_ip_hdr);
+                  if (is_mldp_msg == DEF_NO) {
+                      grp_joined = NetMLDP_IsSrcAllowedOnIF(if_nbr,
+                                                           &p_buf_hdr->IPv6_AddrDest,
+                                                           &p_buf_hdr->IPv6_AddrSrc);
+                      if (grp_joined == DEF_NO) {
+                          NET_CTR_ERR_INC(Net_ErrCtrs.IPv6.RxInvDestCtr);
+                         *p_err = NET_IPv6_ERR_INVALID_ADDR_DEST;
+                          return;
+                      }
+                  }
+              }
+#endif
 #else
               NET_CTR_ERR_INC(Net_ErrCtrs.IPv6.RxInvDestCtr);
              *p_err = NET_IPv6_ERR_INVALID_ADDR_DEST;
@@ -8182,6 +8450,15 @@ static  void  NetIPv6_RxPktValidate (NET_BUF        *p_buf,
             p_ip_addrs = NetIPv6_GetAddrsHostOnIF(                        if_nbr,
                                                   (const NET_IPv6_ADDR *)&p_buf_hdr->IPv6_AddrDest);
             if (p_ip_addrs == (NET_IPv6_ADDRS *)0) {
+#ifdef  NET_IPv6_FWD_MODULE_EN                                  /* Fwd unicast datagram NOT for host (see Note #6c2).   */
+                if (((addr_type == NET_IPv6_ADDR_TYPE_UNICAST)    ||
+                     (addr_type == NET_IPv6_ADDR_TYPE_SITE_LOCAL)) &&
+                     (if_nbr    != NET_IF_NBR_LOCAL_HOST)          &&
+                     (NetIPv6_IsAddrHostCfgdHandler(&p_buf_hdr->IPv6_AddrDest) == DEF_NO)) {
+                    *p_err = NET_IPv6_ERR_RX_FWD;
+                     return;
+                }
+#endif
                 NET_CTR_ERR_INC(Net_ErrCtrs.IPv6.RxInvDestCtr);
                 *p_err = NET_IPv6_ERR_INVALID_ADDR_DEST;
                 return;
@@ -8233,6 +8510,98 @@ static  void  NetIPv6_RxPktValidate (NET_BUF        *p_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        NetIPv6_RxPktIsMLDP_Msg()
+*
+* Description : Check if a received IPv6 packet carries an MLDP message.
+*
+* Argument(s) : p_buf           Pointer to network buffer that received IPv6 packet.
+*               ----            Argument checked   in NetIPv6_Rx().
+*
+*               p_buf_hdr       Pointer to network buffer header that received IPv6 packet.
+*               --------        Argument validated in NetIPv6_Rx().
+*
+*               p_ip_hdr        Pointer to received packet's IPv6 header.
+*               --------        Argument validated in NetIPv6_Rx()/NetIPv6_RxPktValidateBuf().
+*
+* Return(s)   : DEF_YES, if packet is an MLDP Query, Report or Done message.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetIPv6_RxPktValidate().
+*
+* Note(s)     : (1) MLDP messages are ICMPv6 messages sent with a Hop-by-Hop Router Alert option (see
+*                   RFC #2710, Section 3 & RFC #3810, Section 5).  Only the Hop-by-Hop header, if any, is
+*                   skipped to reach the ICMPv6 message type; extension headers are NOT yet validated.
+*
+*               (2) MLDP messages are exempt from the host group source filter check since they MUST
+*                   reach MLDP regardless of the group's source filter (see 'NetIPv6_RxPktValidate()
+*                   Note #6c1A2').
+*********************************************************************************************************
+*/
+
+#if (defined(NET_MLDP_MODULE_EN) && defined(NET_MCAST_SRC_FILTER_MODULE_EN))
+static  CPU_BOOLEAN  NetIPv6_RxPktIsMLDP_Msg (NET_BUF       *p_buf,
+                                              NET_BUF_HDR   *p_buf_hdr,
+                                              NET_IPv6_HDR  *p_ip_hdr)
+{
+    NET_IPv6_OPT_HDR   *p_opt_hdr;
+    NET_ICMPv6_HDR     *p_icmp_hdr;
+    NET_IPv6_NEXT_HDR   next_hdr;
+    CPU_INT16U          msg_ix;
+    CPU_INT16U          msg_len;
+    CPU_INT16U          eh_len;
+    CPU_BOOLEAN         is_mldp_msg;
+
+
+    if ((p_buf_hdr->IP_HdrLen + p_buf_hdr->IP_TotLen) > p_buf_hdr->DataLen) {
+        return (DEF_NO);
+    }
+
+    msg_ix   = p_buf_hdr->IP_HdrIx + p_buf_hdr->IP_HdrLen;
+    msg_len  = p_buf_hdr->IP_TotLen;
+    next_hdr = p_ip_hdr->NextHdr;
+                                                                /* --------------- SKIP HOP-BY-HOP HDR ---------------- */
+    if (next_hdr == NET_IP_HDR_PROTOCOL_EXT_HOP_BY_HOP) {       /* See Note #1.                                         */
+        if (msg_len < NET_IPv6_EH_ALIGN_SIZE) {
+            return (DEF_NO);
+        }
+        p_opt_hdr = (NET_IPv6_OPT_HDR *)&p_buf->DataPtr[msg_ix];
+        eh_len    = (p_opt_hdr->HdrLen + 1u) * NET_IPv6_EH_ALIGN_SIZE;
+        if (eh_len > msg_len) {
+            return (DEF_NO);
+        }
+        next_hdr  = p_opt_hdr->NextHdr;
+        msg_ix   += eh_len;
+        msg_len  -= eh_len;
+    }
+                                                                /* ---------------- CHK ICMPv6 MSG TYPE --------------- */
+    if ((next_hdr != NET_IP_HDR_PROTOCOL_ICMPv6) ||
+        (msg_len  <  sizeof(NET_ICMPv6_HDR))) {
+        return (DEF_NO);
+    }
+
+    p_icmp_hdr = (NET_ICMPv6_HDR *)&p_buf->DataPtr[msg_ix];
+    switch (p_icmp_hdr->Type) {
+        case NET_ICMPv6_MSG_TYPE_MLDP_QUERY:
+        case NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V1:
+        case NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V2:
+        case NET_ICMPv6_MSG_TYPE_MLDP_DONE:
+             is_mldp_msg = DEF_YES;
+             break;
+
+
+        default:
+             is_mldp_msg = DEF_NO;
+             break;
+    }
+
+    return (is_mldp_msg);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        NetIPv6_RxPktValidateNextHdr()
@@ -10232,6 +10601,237 @@ static  void  NetIPv6_RxPktDemuxDatagram (NET_BUF      *p_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetIPv6_RxPktFwd()
+*
+* Description : (1) Forward a received IPv6 datagram NOT destined for this host :
+*
+*                   (a) Validate datagram may be forwarded
+*                   (b) Decrement & validate Hop Limit
+*                   (c) Find outgoing interface & next-hop address
+*                   (d) Copy datagram into a transmit buffer of the outgoing interface
+*                   (e) Transmit datagram
+*
+*
+* Argument(s) : p_buf       Pointer to network buffer that received IPv6 datagram.
+*               -----       Argument checked   in NetIPv6_Rx().
+*
+*               p_buf_hdr   Pointer to network buffer header.
+*               ---------   Argument validated in NetIPv6_Rx().
+*
+*               p_ip_hdr    Pointer to received packet's IPv6 header.
+*               --------    Argument validated in NetIPv6_Rx()/NetIPv6_RxPktValidateBuf().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IPv6_ERR_NONE               Datagram successfully forwarded.
+*                               NET_ERR_RX                      Datagram NOT forwarded & discarded.
+*
+*                                                               --------- RETURNED BY NetIF_Tx() : ---------
+*                               See NetIF_Tx() for additional error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIPv6_Rx().
+*
+* Note(s)     : (2) RFC #4291, Section 2.5.6 states that "routers must not forward any packets with
+*                   Link-Local source or destination addresses to other links". Link-local destinations
+*                   are already rejected by NetIPv6_RxPktValidate().
+*
+*               (3) RFC #4443, Section 3.3 states that "if a router receives a packet with a Hop Limit of
+*                   zero, or if a router decrements a packet's Hop Limit to zero, it MUST discard the
+*                   packet and originate an ICMPv6 Time Exceeded message".
+*
+*                   NetICMPv6_TxMsgErr() requires the ICMPv6 message index of an ICMPv6 datagram to NOT
+*                   reply to an ICMPv6 error message. Since a forwarded datagram is NOT demultiplexed,
+*                   the index is set here when the ICMPv6 header immediately follows the IPv6 header.
+*
+*               (4) RFC #4443, Section 3.2 states that a Packet Too Big message "MUST be sent by a router
+*                   in response to a packet that it cannot forward because the packet is larger than the
+*                   MTU of the outgoing link".  The whole datagram, including its IPv6 header, is
+*                   compared to the outgoing interface MTU.
+*
+*               (5) The datagram is copied into a buffer allocated on the outgoing interface since network
+*                   buffers are owned by the interface that received them. The received buffer is freed
+*                   once the datagram is copied.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_IPv6_FWD_MODULE_EN
+static  void  NetIPv6_RxPktFwd (NET_BUF       *p_buf,
+                                NET_BUF_HDR   *p_buf_hdr,
+                                NET_IPv6_HDR  *p_ip_hdr,
+                                NET_ERR       *p_err)
+{
+    const  NET_IPv6_ADDR  *p_addr_next_hop;
+           NET_IF         *p_if;
+           NET_DEV_CFG    *p_dev_cfg;
+           NET_BUF        *p_buf_fwd;
+           NET_BUF_HDR    *p_buf_fwd_hdr;
+           NET_IPv6_HDR   *p_ip_hdr_fwd;
+           NET_IF_NBR      if_nbr_tx;
+           NET_MTU         mtu;
+           CPU_INT16U      pkt_len;
+           CPU_INT16U      ix;
+           NET_BUF_SIZE    ix_offset;
+           CPU_BOOLEAN     addr_invalid;
+           NET_ERR         err;
+
+
+                                                                /* ---------------- VALIDATE SRC ADDR ----------------- */
+    addr_invalid = NetIPv6_IsAddrLinkLocal(&p_buf_hdr->IPv6_AddrSrc);
+    if (addr_invalid == DEF_NO) {
+        addr_invalid = NetIPv6_IsAddrUnspecified(&p_buf_hdr->IPv6_AddrSrc);
+    }
+    if (addr_invalid == DEF_YES) {                              /* See Note #2.                                         */
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv6.RxInvAddrSrcCtr);
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+
+    pkt_len = p_buf_hdr->IP_TotLen + p_buf_hdr->IP_HdrLen;
+    if (pkt_len > p_buf_hdr->DataLen) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv6.RxInvTotLenCtr);
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+
+    if (p_ip_hdr->NextHdr == NET_IP_HDR_PROTOCOL_ICMPv6) {      /* See Note #3.                                         */
+        p_buf_hdr->ICMP_MsgIx  = p_buf_hdr->IP_HdrIx + p_buf_hdr->IP_HdrLen;
+        p_buf_hdr->ICMP_MsgLen = p_buf_hdr->IP_TotLen;
+    }
+
+                                                                /* ----------------- CHK HOP LIMIT -------------------- */
+    if (p_ip_hdr->HopLim <= 1u) {                               /* See Note #3.                                         */
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv6.RxFwdHopLimCtr);
+#ifdef  NET_ICMPv6_MODULE_EN
+        NetICMPv6_TxMsgErr(p_buf,
+                           NET_ICMPv6_MSG_TYPE_TIME_EXCEED,
+                           NET_ICMPv6_MSG_CODE_TIME_EXCEED_HOP_LIMIT,
+                           NET_ICMPv6_MSG_PTR_NONE,
+                          &err);
+#endif
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+
+                                                                /* --------------- FIND NEXT-HOP ADDR ----------------- */
+    p_addr_next_hop = NetNDP_NextHopFwd(&if_nbr_tx, &p_buf_hdr->IPv6_AddrDest, &err);
+    if ((p_addr_next_hop == (NET_IPv6_ADDR *)0) ||
+        (if_nbr_tx       == p_buf_hdr->IF_Nbr)) {               /* Do NOT fwd datagram back on rx'd link.               */
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv6.RxFwdNoRouteCtr);
+#ifdef  NET_ICMPv6_MODULE_EN
+        NetICMPv6_TxMsgErr(p_buf,
+                           NET_ICMPv6_MSG_TYPE_DEST_UNREACH,
+                           NET_ICMPv6_MSG_CODE_DEST_NO_ROUTE,
+                           NET_ICMPv6_MSG_PTR_NONE,
+                          &err);
+#endif
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+
+                                                                /* ------------------- CHK TX MTU --------------------- */
+    mtu = NetIF_MTU_GetProtocol(if_nbr_tx, NET_PROTOCOL_TYPE_IP_V6, NET_IF_FLAG_NONE, &err);
+    if (err != NET_IF_ERR_NONE) {
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+
+    if (pkt_len > mtu) {                                        /* See Note #4.                                         */
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv6.RxFwdTooBigCtr);
+#ifdef  NET_ICMPv6_MODULE_EN
+        NetICMPv6_TxMsgErr(p_buf,
+                           NET_ICMPv6_MSG_TYPE_PKT_TOO_BIG,
+                           NET_ICMPv6_MSG_CODE_PKT_TOO_BIG,
+                           mtu,
+                          &err);
+#endif
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+
+                                                                /* -------------- GET TX BUF (see Note #5) ------------ */
+    p_if = NetIF_Get(if_nbr_tx, &err);
+    if (err != NET_IF_ERR_NONE) {
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+
+    p_dev_cfg = (NET_DEV_CFG *)p_if->Dev_Cfg;
+    ix        =  p_dev_cfg->TxBufIxOffset;
+    NetIF_TxIxDataGet(if_nbr_tx, 0u, &ix, &err);
+    if (err != NET_IF_ERR_NONE) {
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+
+    p_buf_fwd = NetBuf_Get(if_nbr_tx,
+                           NET_TRANSACTION_TX,
+                           pkt_len,
+                           ix,
+                          &ix_offset,
+                           NET_BUF_FLAG_NONE,
+                          &err);
+    if (err != NET_BUF_ERR_NONE) {
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+    ix += (CPU_INT16U)ix_offset;
+
+    NetBuf_DataWr(               p_buf_fwd,                     /* Copy rx'd datagram into tx buf.                      */
+                                 ix,
+                                 pkt_len,
+                  (CPU_INT08U *) p_ip_hdr,
+                                &err);
+    if (err != NET_BUF_ERR_NONE) {
+        NetBuf_Free(p_buf_fwd);
+        NetIPv6_RxPktDiscard(p_buf, p_err);
+        return;
+    }
+
+                                                                /* --------------- UPDATE TX BUF CTRLS ---------------- */
+    p_buf_fwd_hdr                      = &p_buf_fwd->Hdr;
+    p_buf_fwd_hdr->IP_HdrIx            =  ix;
+    p_buf_fwd_hdr->IP_HdrLen           =  p_buf_hdr->IP_HdrLen;
+    p_buf_fwd_hdr->IP_TotLen           =  pkt_len;
+    p_buf_fwd_hdr->IP_DataLen          =  p_buf_hdr->IP_TotLen;
+    p_buf_fwd_hdr->IP_DatagramLen      =  p_buf_hdr->IP_TotLen;
+    p_buf_fwd_hdr->TotLen              = (NET_BUF_SIZE)pkt_len;
+    p_buf_fwd_hdr->ProtocolHdrType     =  NET_PROTOCOL_TYPE_IP_V6;
+    p_buf_fwd_hdr->ProtocolHdrTypeNet  =  NET_PROTOCOL_TYPE_IP_V6;
+    p_buf_fwd_hdr->IF_NbrTx            =  if_nbr_tx;
+
+    Mem_Copy(&p_buf_fwd_hdr->IPv6_AddrSrc,       &p_buf_hdr->IPv6_AddrSrc,  NET_IPv6_ADDR_SIZE);
+    Mem_Copy(&p_buf_fwd_hdr->IPv6_AddrDest,      &p_buf_hdr->IPv6_AddrDest, NET_IPv6_ADDR_SIZE);
+    Mem_Copy(&p_buf_fwd_hdr->IPv6_AddrNextRoute,  p_addr_next_hop,          NET_IPv6_ADDR_SIZE);
+
+                                                                /* --------------- DECREMENT HOP LIMIT ---------------- */
+    p_ip_hdr_fwd          = (NET_IPv6_HDR *)&p_buf_fwd->DataPtr[ix];
+    p_ip_hdr_fwd->HopLim -= 1u;
+
+                                                                /* ---------------- FREE RX'D DATAGRAM ---------------- */
+    NetBuf_FreeBuf(p_buf, (NET_CTR *)0);
+
+                                                                /* ------------------ TX DATAGRAM --------------------- */
+    NetIF_Tx(p_buf_fwd, p_err);
+    switch (*p_err) {
+        case NET_IF_ERR_NONE:
+        case NET_IF_ERR_TX_ADDR_PEND:
+             NET_CTR_STAT_INC(Net_StatCtrs.IPv6.RxDgramFwdCtr);
+            *p_err = NET_IPv6_ERR_NONE;
+             break;
+
+
+        default:
+             NET_CTR_ERR_INC(Net_ErrCtrs.IPv6.TxPktDisCtr);
+             break;
+    }
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       NetIPv6_RxPktDiscard()
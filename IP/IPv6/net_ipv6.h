@@ -26,7 +26,9 @@
 * Note(s)  : (1) Supports Internet Protocol as described in RFC #2460, also known as IPv6, with the
 *                following restrictions/constraints :
 *
-*                (a) IPv6 forwarding/routing NOT currently supported       RFC #2460
+*                (a) IPv6 forwarding/routing supported ONLY if             RFC #2460
+*                    NET_IPv6_CFG_FWD_EN is enabled; ICMPv6 Packet Too
+*                    Big & Redirect messages NOT       supported
 *
 *                (b) Transmit fragmentation  NOT currently supported       RFC #2460, Section 4.5
 *                                                                         'Fragment Header'
@@ -45,6 +45,7 @@
 #include  "../../Source/net_tmr.h"
 #include  "../../IF/net_if.h"
 #include  "../../Source/net.h"
+#include  "../../Source/net_util.h"
 
 
 /*
@@ -101,6 +102,51 @@
 #define  NET_MLDP_HOST_GRP_REPORT_DLY_RETRY_SEC            2    /* See Note #2.                                         */
 
 
+/*
+*********************************************************************************************************
+*                                        MLDPv2 MESSAGE DEFINES
+*
+* Note(s) : (1) RFC #3810, Section 8.1 states that "the MLD version of a received Query message is
+*               determined as follows" :
+*
+*               (a) "MLDv1 Query: length = 24 octets".
+*               (b) "MLDv2 Query: length >= 28 octets".
+*
+*           (2) RFC #3810, Section 5.2.14 states that "Version 2 Multicast Listener Reports are sent
+*               with an IP destination address of FF02:0:0:0:0:0:0:16, to which all MLDv2-capable
+*               multicast routers listen".
+*
+*           (3) RFC #3810, Section 5.1.3 encodes Maximum Response Codes >= 32768 as a floating-point
+*               value :
+*
+*                          0 1 2 3 4 5 6 7 8 9 A B C D E F
+*                         +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+*                         |1| exp |          mant         |     Maximum Response Delay =
+*                         +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+         (mant | 0x1000) << (exp + 3)
+*
+*               Maximum Response Delay is expressed in milliseconds.
+*********************************************************************************************************
+*/
+
+#define  NET_MLDP_V2_QUERY_MSG_SIZE_MIN                   28    /* See Note #1b.                                        */
+#define  NET_MLDP_V2_GRP_REC_HDR_SIZE                     20
+
+#define  NET_MLDP_V2_REC_TYPE_MODE_IS_INCLUDE              1u
+#define  NET_MLDP_V2_REC_TYPE_MODE_IS_EXCLUDE              2u
+#define  NET_MLDP_V2_REC_TYPE_CHANGE_TO_INCLUDE            3u
+#define  NET_MLDP_V2_REC_TYPE_CHANGE_TO_EXCLUDE            4u
+
+                                                                /* See Note #2.                                         */
+#define  NET_MLDP_V2_ADDR_ALL_ROUTERS_SCOPE             0x02u
+#define  NET_MLDP_V2_ADDR_ALL_ROUTERS_GRP_ID            0x16u
+
+#define  NET_MLDP_V2_MAX_RESP_CODE_FLOAT              0x8000u   /* See Note #3.                                         */
+#define  NET_MLDP_V2_MAX_RESP_CODE_EXP_MASK           0x7000u
+#define  NET_MLDP_V2_MAX_RESP_CODE_EXP_SHIFT              12u
+#define  NET_MLDP_V2_MAX_RESP_CODE_MANT_MASK          0x0FFFu
+#define  NET_MLDP_V2_MAX_RESP_CODE_MANT_BIT           0x1000u
+
+
 /*
 *********************************************************************************************************
 *                                          MLDP FLAG DEFINES
@@ -109,6 +155,24 @@
                                                                 /* ------------------ NET MLDP FLAGS ------------------ */
 #define  NET_MLDP_FLAG_NONE                              DEF_BIT_NONE
 #define  NET_MLDP_FLAG_USED                              DEF_BIT_00    /* MLDP host grp cur used; i.e. NOT in free pool.*/
+#define  NET_MLDP_FLAG_STATE_CHNG                        DEF_BIT_01    /* MLDP host grp filter state chng report pend.  */
+
+
+/*
+*********************************************************************************************************
+*                                    MLDP HOST GROUP HASH DEFINES
+*
+* Note(s) : (1) Host groups are indexed by interface number & the low-order octets of the group address
+*               in a table of hash buckets so that the per-datagram membership & source filter checks do
+*               NOT walk the entire MLDP Host Group List.
+*********************************************************************************************************
+*/
+
+#define  NET_MLDP_HOST_GRP_HASH_TBL_SIZE   ((NET_MCAST_CFG_HOST_GRP_NBR_MAX / 2u) + 1u)
+
+#define  NET_MLDP_HOST_GRP_HASH(if_nbr, p_addr)   ((CPU_INT16U)((((((CPU_INT16U)(p_addr)->Addr[12] << 8u) | (p_addr)->Addr[13])  ^ \
+                                                                  (((CPU_INT16U)(p_addr)->Addr[14] << 8u) | (p_addr)->Addr[15])) + \
+                                                                  (if_nbr)) % NET_MLDP_HOST_GRP_HASH_TBL_SIZE))
 
 
 /*
@@ -160,6 +224,10 @@ static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpPoolPtr;
 static  NET_STAT_POOL       NetMLDP_HostGrpPoolStat;                            /* Stastici Pool for MLDP.              */
 
 static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpListHead;                            /* Ptr to head of MLDP Host Grp List.   */
+                                                                                /* Tbl of MLDP host grp hash buckets.   */
+static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpHashTbl[NET_MLDP_HOST_GRP_HASH_TBL_SIZE];
+
+static  CPU_BOOLEAN         NetMLDP_CompatV1OnIF[NET_IF_NBR_IF_TOT];             /* MLDPv1 compatibility mode per IF.    */
 
 static  RAND_NBR            NetMLDP_RandSeed;                                   /* Variable for MLDP random delay.      */
 
@@ -180,6 +248,7 @@ static  void                NetMLDP_RxPktValidate           (      NET_BUF
 static  void                NetMLDP_RxQuery                 (      NET_IF_NBR          if_nbr,
                                                              const NET_IPv6_ADDR       *p_addr_dest,
                                                                    NET_MLDP_V1_HDR     *p_mldp_hdr,
+                                                                   CPU_INT16U           msg_len,
                                                                    NET_ERR             *p_err);
 
 static  void                NetMLDP_RxReport                (      NET_IF_NBR          if_nbr,
@@ -194,6 +263,10 @@ static  void                NetMLDP_TxReport                (      NET_IF_NBR
                                                                    NET_IPv6_ADDR      *p_addr_mcast_dest,
                                                                    NET_ERR            *p_err);
 
+static  void                NetMLDP_TxReportV2              (      NET_MLDP_HOST_GRP  *p_host_grp,
+                                                                   CPU_INT08U          rec_type,
+                                                                   NET_ERR            *p_err);
+
 static  void                NetMLDP_TxMsgDone               (      NET_IF_NBR          if_nbr,
                                                                    NET_IPv6_ADDR      *p_addr_mcast_dest,
                                                                    NET_ERR            *p_err);
@@ -205,10 +278,27 @@ static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpSrchIF           (      NET_IF_NBR
 
 static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpAdd              (      NET_IF_NBR          if_nbr,
                                                              const NET_IPv6_ADDR      *p_addr,
+                                                             const NET_IPv6_ADDR      *p_addr_src,
                                                                    NET_ERR            *p_err);
 
 static  void                NetMLDP_HostGrpRemove           (      NET_MLDP_HOST_GRP  *p_host_grp);
 
+static  void                NetMLDP_HostGrpLeaveTx          (      NET_MLDP_HOST_GRP  *p_host_grp,
+                                                                   NET_ERR            *p_err);
+
+static  void                NetMLDP_HostGrpStateChng        (      NET_MLDP_HOST_GRP  *p_host_grp);
+
+static  NET_MLDP_HOST_GRP_SRC  *NetMLDP_HostGrpSrcSrch      (      NET_MLDP_HOST_GRP  *p_host_grp,
+                                                             const NET_IPv6_ADDR      *p_addr_src);
+
+static  void                NetMLDP_HostGrpSrcDel           (      NET_MLDP_HOST_GRP      *p_host_grp,
+                                                                   NET_MLDP_HOST_GRP_SRC  *p_src);
+
+static  void                NetMLDP_HostGrpSrcClrMode       (      NET_MLDP_HOST_GRP     *p_host_grp,
+                                                                   NET_MLDP_FILTER_MODE   filter_mode);
+
+static  NET_MLDP_FILTER_MODE  NetMLDP_HostGrpFilterModeGet  (      NET_MLDP_HOST_GRP  *p_host_grp);
+
 static  void                NetMLDP_HostGrpInsert           (      NET_MLDP_HOST_GRP  *p_host_grp);
 
 static  void                NetMLDP_HostGrpUnlink           (      NET_MLDP_HOST_GRP  *p_host_grp);
@@ -249,8 +339,9 @@ static  void                NetMLDP_LinkStateNotification   (      NET_IF_NBR
 *
 *                   (a) Initialize MLDP host group pool
 *                   (b) Initialize MLDP host group table
-*                   (c) Initialize MLDP Host Group List pointer
-*                   (d) Initialize MLDP random seed
+*                   (c) Initialize MLDP Host Group List pointer & hash table
+*                   (d) Initialize MLDP compatibility mode
+*                   (e) Initialize MLDP random seed
 *
 *
 * Argument(s) : none.
@@ -272,6 +363,8 @@ void  NetMLDP_Init (void)
 
     NET_MLDP_HOST_GRP      *p_host_grp;
     NET_MLDP_HOST_GRP_QTY   i;
+    CPU_INT16U              hash_ix;
+    NET_IF_NBR              if_nbr;
     NET_ERR                 err;
 
 
@@ -301,6 +394,20 @@ void  NetMLDP_Init (void)
 
     NetMLDP_HostGrpListHead = (NET_MLDP_HOST_GRP *)0;           /* ----------- INIT MLDP HOST GRP LIST PTR ------------ */
 
+                                                                /* ----------- INIT MLDP HOST GRP HASH TBL ------------ */
+    for (hash_ix = 0u; hash_ix < NET_MLDP_HOST_GRP_HASH_TBL_SIZE; hash_ix++) {
+        NetMLDP_HostGrpHashTbl[hash_ix] = (NET_MLDP_HOST_GRP *)0;
+    }
+
+                                                                /* ------------- INIT MLDP COMPAT MODE ---------------- */
+    for (if_nbr = NET_IF_NBR_BASE_CFGD; if_nbr < NET_IF_NBR_IF_TOT; if_nbr++) {
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+        NetMLDP_CompatV1OnIF[if_nbr] = DEF_NO;                  /* Start in MLDPv2 mode (see 'net_mldp.h  Note #2').    */
+#else
+        NetMLDP_CompatV1OnIF[if_nbr] = DEF_YES;                 /* See 'net_mldp.h  Note #2c'.                          */
+#endif
+    }
+
                                                                 /* ------------------ INIT RAND SEED ------------------ */
     NetMLDP_RandSeed = 1u;                                      /* See 'lib_math.c  Math_Init()  Note #2'.              */
 }
@@ -450,6 +557,10 @@ exit:
 *                   See also 'NetMLDP_HostGrpJoin()  Note #1.
 *
 *               (3) NetMLDP_HostGrpJoinHandler() blocked until network initialization completes.
+*
+*               (4) A host group joined with NO source list is an any-source membership, i.e. an EXCLUDE
+*                   filter with an empty source list (see RFC #3810, Section 2.1).  If the host group was
+*                   previously joined ONLY for INCLUDE sources, its filter mode changes to EXCLUDE.
 *********************************************************************************************************
 */
 
@@ -487,11 +598,16 @@ NET_MLDP_HOST_GRP  *NetMLDP_HostGrpJoinHandler (      NET_IF_NBR      if_nbr,
     p_grp = NetMLDP_HostGrpSrch(if_nbr, p_addr);
     if (p_grp != DEF_NULL) {                                    /* If host grp found, ...                               */
         p_grp->RefCtr++;
+        p_grp->AnySrcRefCtr++;
+        if (p_grp->AnySrcRefCtr == 1u) {                        /* ... & filter mode chngd to EXCLUDE (see Note #4), ...*/
+            NetMLDP_HostGrpStateChng(p_grp);                    /* ... advertise new filter state.                      */
+        }
        *p_err = NET_MLDP_ERR_NONE;
         goto exit;
     }
 
-    p_grp = NetMLDP_HostGrpAdd(if_nbr, p_addr, p_err);          /* Add new host grp into Host Grp List.                 */
+                                                                /* Add new host grp into Host Grp List.                 */
+    p_grp = NetMLDP_HostGrpAdd(if_nbr, p_addr, (NET_IPv6_ADDR *)0, p_err);
     if (*p_err != NET_MLDP_ERR_NONE) {
          goto exit;
     }
@@ -630,6 +746,9 @@ exit_release:
 *                   See also 'NetMLDP_HostGrpLeave()  Note #1'.
 *
 *               (3) NetMLDP_HostGrpLeaveHandler() blocked until network initialization completes.
+*
+*               (4) Leaving the last any-source membership discards the host group's EXCLUDE sources;
+*                   the host group then reverts to INCLUDE filter mode for any remaining INCLUDE sources.
 *********************************************************************************************************
 */
 
@@ -638,9 +757,7 @@ CPU_BOOLEAN  NetMLDP_HostGrpLeaveHandler (      NET_IF_NBR     if_nbr,
                                                 NET_ERR       *p_err)
 {
     NET_MLDP_HOST_GRP  *p_host_grp;
-    CPU_BOOLEAN         is_mcast_allnodes;
     CPU_BOOLEAN         is_mcast;
-    CPU_INT08U          scope;
     CPU_BOOLEAN         result;
 
 
@@ -670,54 +787,515 @@ CPU_BOOLEAN  NetMLDP_HostGrpLeaveHandler (      NET_IF_NBR     if_nbr,
     }
                                                                 /* ---------------- SRCH HOST GRP LIST ---------------- */
     p_host_grp = NetMLDP_HostGrpSrch(if_nbr, p_addr);
-    if (p_host_grp == (NET_MLDP_HOST_GRP *)0) {                 /* If host grp NOT found, ...                           */
+    if ((p_host_grp               == (NET_MLDP_HOST_GRP *)0) || /* If host grp NOT found ...                            */
+        (p_host_grp->AnySrcRefCtr <   1u)) {                    /* ... or NOT joined for any src, ...                   */
        *p_err  =  NET_MLDP_ERR_HOST_GRP_NOT_FOUND;              /* ... rtn err.                                         */
         result = DEF_FAIL;
         goto exit;
     }
 
+    p_host_grp->AnySrcRefCtr--;
     p_host_grp->RefCtr--;                                       /* Dec ref ctr.                                         */
 
+    if (p_host_grp->RefCtr > 0u) {
+        if (p_host_grp->AnySrcRefCtr < 1u) {                    /* If last any-src ref (see Note #4), ...               */
+            NetMLDP_HostGrpSrcClrMode(p_host_grp, NET_MLDP_FILTER_MODE_EXCLUDE);
+            NetMLDP_HostGrpStateChng(p_host_grp);               /* ... advertise new filter state.                      */
+        }
+       *p_err  = NET_MLDP_ERR_NONE;
+        result = DEF_OK;
+        goto exit;
+    }
+
                                                                 /* ----------- ADVERTISE END OF MEMBERSHIP ------------ */
-    is_mcast_allnodes = NetIPv6_IsAddrMcastAllNodes(&p_host_grp->AddrGrp);
+    NetMLDP_HostGrpLeaveTx(p_host_grp, p_err);
+    switch (*p_err) {
+        case NET_MLDP_ERR_NONE:
+        case NET_ERR_IF_LINK_DOWN:
+             result = DEF_OK;
+             break;
 
-    scope             = NetIPv6_GetAddrScope(&p_host_grp->AddrGrp);
+        case NET_MLDP_ERR_INVALID_HOP_HDR:
+        case NET_ERR_TX:
+        case NET_ERR_TX_BUF_NONE_AVAIL:
+        case NET_ERR_FAULT_UNKNOWN_ERR:
+             result = DEF_FAIL;
+             goto exit;
 
-    if (( is_mcast_allnodes == DEF_NO)            &&
-        ((scope != NET_IPv6_ADDR_SCOPE_RESERVED)  &&
-         (scope != NET_IPv6_ADDR_SCOPE_IF_LOCAL))) {
+        default:
+            result = DEF_FAIL;
+           *p_err  = NET_ERR_FAULT_UNKNOWN_ERR;
+            goto exit;
+    }
 
-        if (p_host_grp->RefCtr < 1) {
-            NetMLDP_TxMsgDone(if_nbr,
-                             &p_host_grp->AddrGrp,
-                              p_err);
-            switch (*p_err) {
-                case NET_MLDP_ERR_NONE:
-                case NET_ERR_IF_LINK_DOWN:
-                     result = DEF_OK;
-                     break;
-
-                case NET_MLDP_ERR_INVALID_HOP_HDR:
-                case NET_ERR_TX:
-                case NET_ERR_TX_BUF_NONE_AVAIL:
-                case NET_ERR_FAULT_UNKNOWN_ERR:
-                     result = DEF_FAIL;
-                     goto exit;
-
-                default:
-                    result = DEF_FAIL;
-                   *p_err  = NET_ERR_FAULT_UNKNOWN_ERR;
-                    goto exit;
-            }
+                                                                /* -------- REMOVE HOST GRP FROM HOST GRP LIST -------- */
+    NetMLDP_HostGrpRemove(p_host_grp);
+
+   *p_err = NET_MLDP_ERR_NONE;
+
+exit:
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetMLDP_HostGrpSrcAdd()
+*
+* Description : Add a source filter to a host group.
+*
+* Argument(s) : if_nbr          Interface number of host group.
+*
+*               p_addr_grp      Pointer to IPv6 address of host group.
+*
+*               p_addr_src      Pointer to IPv6 address of source to filter.
+*
+*               filter_mode     Source filter mode :
+*
+*                                   NET_MLDP_FILTER_MODE_INCLUDE    Receive host group packets from source.
+*                                   NET_MLDP_FILTER_MODE_EXCLUDE    Block   host group packets from source.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                                                   - RETURNED BY NetMLDP_HostGrpSrcAddHandler() : -
+*                               NET_MLDP_ERR_NONE                   Source filter successfully added.
+*                               NET_MLDP_ERR_INVALID_ADDR_GRP       Invalid group  address.
+*                               NET_MLDP_ERR_INVALID_ADDR_SRC       Invalid source address.
+*                               NET_MLDP_ERR_INVALID_FILTER_MODE    Invalid OR conflicting filter mode.
+*                               NET_MLDP_ERR_HOST_GRP_NOT_FOUND     Host group NOT joined for any source.
+*                               NET_MLDP_ERR_HOST_GRP_NONE_AVAIL    NO available host group to allocate.
+*                               NET_MLDP_ERR_SRC_NONE_AVAIL         NO available source entry.
+*                               NET_IF_ERR_INVALID_IF               Invalid OR disabled configured interface.
+*                               NET_INIT_ERR_NOT_COMPLETED          Network initialization NOT complete.
+*
+*                                                                   --- RETURNED BY Net_GlobalLockAcquire() : ----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
+*
+*                               NET_ERR_FAULT_FEATURE_DIS           Source filtering disabled (see Note #2).
+*
+* Return(s)   : DEF_OK,   if source filter successfully added.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #1].
+*
+* Note(s)     : (1) NetMLDP_HostGrpSrcAdd() MUST NOT be called with the global network lock already
+*                   acquired.
+*
+*                   See also 'NetMLDP_HostGrpJoin()  Note #1'.
+*
+*               (2) Source filters are ONLY available if NET_MCAST_CFG_SRC_FILTER_EN is enabled (see
+*                   'net_mldp.h  Note #2c').
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetMLDP_HostGrpSrcAdd (NET_IF_NBR             if_nbr,
+                                    NET_IPv6_ADDR         *p_addr_grp,
+                                    NET_IPv6_ADDR         *p_addr_src,
+                                    NET_MLDP_FILTER_MODE   filter_mode,
+                                    NET_ERR               *p_err)
+{
+    CPU_BOOLEAN  result = DEF_FAIL;
+
+
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+    Net_GlobalLockAcquire((void *)&NetMLDP_HostGrpSrcAdd, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE POINTERS ----------------- */
+    if ((p_addr_grp == (NET_IPv6_ADDR *)0) ||
+        (p_addr_src == (NET_IPv6_ADDR *)0)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.MLDP.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        goto exit_release;
+    }
+#endif
+
+                                                                /* Add src filter.                                      */
+    result = NetMLDP_HostGrpSrcAddHandler(if_nbr,
+                                          p_addr_grp,
+                                          p_addr_src,
+                                          filter_mode,
+                                          p_err);
+    goto exit_release;
+
+
+exit_release:
+    Net_GlobalLockRelease();
+#else
+   (void)&if_nbr;
+   (void)&p_addr_grp;
+   (void)&p_addr_src;
+   (void)&filter_mode;
+   *p_err = NET_ERR_FAULT_FEATURE_DIS;                          /* See Note #2.                                         */
+    goto exit_lock_fault;
+#endif
+
+exit_lock_fault:
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    NetMLDP_HostGrpSrcAddHandler()
+*
+* Description : (1) Add a source filter to a host group :
+*
+*                   (a) Validate interface number, group & source addresses & filter mode
+*                   (b) Search host group; for INCLUDE sources, add host group if NOT found
+*                   (c) Add or reference host group source entry
+*                   (d) Advertise new filter state to multicast router(s)
+*
+*
+* Argument(s) : if_nbr          Interface number of host group.
+*
+*               p_addr_grp      Pointer to IPv6 address of host group.
+*               ----------      Argument validated by caller(s).
+*
+*               p_addr_src      Pointer to IPv6 address of source to filter.
+*               ----------      Argument validated by caller(s).
+*
+*               filter_mode     Source filter mode (see 'NetMLDP_HostGrpSrcAdd()').
+*
+*               p_err           Pointer to variable that will receive the return error code from this function
+*                                   (see 'NetMLDP_HostGrpSrcAdd()').
+*
+* Return(s)   : DEF_OK,   if source filter successfully added.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetMLDP_HostGrpSrcAdd().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetMLDP_HostGrpSrcAddHandler() is called by network protocol suite function(s) & MUST
+*                   be called with the global network lock already acquired.
+*
+*               (3) (a) INCLUDE sources request reception from ONLY the listed sources (source-specific
+*                       membership) & join the host group if needed.
+*
+*                   (b) EXCLUDE sources block a source for the host group's any-source members & therefore
+*                       require the host group to be joined with NetMLDP_HostGrpJoin().
+*
+*                   See also 'net_mldp.h  MLDP HOST GROUP SOURCE DATA TYPE  Note #2'.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetMLDP_HostGrpSrcAddHandler (      NET_IF_NBR             if_nbr,
+                                           const NET_IPv6_ADDR         *p_addr_grp,
+                                           const NET_IPv6_ADDR         *p_addr_src,
+                                                 NET_MLDP_FILTER_MODE   filter_mode,
+                                                 NET_ERR               *p_err)
+{
+    NET_MLDP_HOST_GRP      *p_host_grp;
+    NET_MLDP_HOST_GRP_SRC  *p_src;
+    CPU_BOOLEAN             is_mcast;
+    CPU_BOOLEAN             is_mcast_allnodes;
+    CPU_BOOLEAN             is_unspecified;
+    CPU_BOOLEAN             is_loopback;
+    CPU_BOOLEAN             result;
+
+
+    result = DEF_FAIL;
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err = NET_INIT_ERR_NOT_COMPLETED;
+        goto exit;
+    }
+#endif
+
+                                                                /* ----------------- VALIDATE IF NBR ------------------ */
+    NetIF_IsValidHandler(if_nbr, p_err);
+    if (*p_err != NET_IF_ERR_NONE) {
+         goto exit;
+    }
+
+                                                                /* ----------------- VALIDATE ADDRS ------------------- */
+    is_mcast          = NetIPv6_IsAddrMcast(p_addr_grp);
+    is_mcast_allnodes = NetIPv6_IsAddrMcastAllNodes(p_addr_grp);
+    if ((is_mcast          != DEF_YES) ||
+        (is_mcast_allnodes == DEF_YES)) {
+       *p_err = NET_MLDP_ERR_INVALID_ADDR_GRP;
+        goto exit;
+    }
+
+    is_mcast       = NetIPv6_IsAddrMcast(p_addr_src);
+    is_unspecified = NetIPv6_IsAddrUnspecified(p_addr_src);
+    is_loopback    = NetIPv6_IsAddrLoopback(p_addr_src);
+    if ((is_mcast       == DEF_YES) ||
+        (is_unspecified == DEF_YES) ||
+        (is_loopback    == DEF_YES)) {
+       *p_err = NET_MLDP_ERR_INVALID_ADDR_SRC;
+        goto exit;
+    }
+
+                                                                /* -------------- VALIDATE FILTER MODE ---------------- */
+    switch (filter_mode) {
+        case NET_MLDP_FILTER_MODE_INCLUDE:
+        case NET_MLDP_FILTER_MODE_EXCLUDE:
+             break;
+
+
+        default:
+            *p_err = NET_MLDP_ERR_INVALID_FILTER_MODE;
+             goto exit;
+    }
+
+                                                                /* ---------------- SRCH HOST GRP LIST ---------------- */
+    p_host_grp = NetMLDP_HostGrpSrch(if_nbr, p_addr_grp);
+    if (p_host_grp == (NET_MLDP_HOST_GRP *)0) {
+        if (filter_mode != NET_MLDP_FILTER_MODE_INCLUDE) {      /* EXCLUDE srcs req any-src membership (see Note #3b).  */
+           *p_err = NET_MLDP_ERR_HOST_GRP_NOT_FOUND;
+            goto exit;
+        }
+                                                                /* Add new host grp with INCLUDE src (see Note #3a).    */
+        p_host_grp = NetMLDP_HostGrpAdd(if_nbr, p_addr_grp, p_addr_src, p_err);
+        if (*p_err != NET_MLDP_ERR_NONE) {
+             goto exit;
+        }
+        result = DEF_OK;
+        goto exit;
+
+    } else if ((filter_mode              == NET_MLDP_FILTER_MODE_EXCLUDE) &&
+               (p_host_grp->AnySrcRefCtr <  1u)) {
+       *p_err = NET_MLDP_ERR_HOST_GRP_NOT_FOUND;
+        goto exit;
+    }
+
+                                                                /* ------------------ ADD SRC ENTRY ------------------- */
+    p_src = NetMLDP_HostGrpSrcSrch(p_host_grp, p_addr_src);
+    if (p_src != (NET_MLDP_HOST_GRP_SRC *)0) {
+        if (p_src->FilterMode != filter_mode) {                 /* Src already listed in other mode.                    */
+           *p_err = NET_MLDP_ERR_INVALID_FILTER_MODE;
+            goto exit;
         }
+        p_src->RefCtr++;
+
+    } else {
+        if (p_host_grp->SrcNbr >= NET_MCAST_CFG_SRC_NBR_MAX) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.MLDP.NoneAvailCtr);
+           *p_err = NET_MLDP_ERR_SRC_NONE_AVAIL;
+            goto exit;
+        }
+        p_src             = &p_host_grp->SrcTbl[p_host_grp->SrcNbr];
+        Mem_Copy(&p_src->AddrSrc, p_addr_src, NET_IPv6_ADDR_SIZE);
+        p_src->FilterMode =  filter_mode;
+        p_src->RefCtr     =  1u;
+        p_host_grp->SrcNbr++;
     }
 
-                                                                /* -------- REMOVE HOST GRP FROM HOST GRP LIST -------- */
-    if (p_host_grp->RefCtr < 1) {
-        NetMLDP_HostGrpRemove(p_host_grp);
+    if (filter_mode == NET_MLDP_FILTER_MODE_INCLUDE) {          /* INCLUDE srcs ref host grp.                           */
+        p_host_grp->RefCtr++;
     }
 
-   *p_err = NET_MLDP_ERR_NONE;
+                                                                /* ------------ ADVERTISE NEW FILTER STATE ------------ */
+    if (p_src->RefCtr == 1u) {
+        NetMLDP_HostGrpStateChng(p_host_grp);
+    }
+
+   *p_err  = NET_MLDP_ERR_NONE;
+    result = DEF_OK;
+
+exit:
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetMLDP_HostGrpSrcRemove()
+*
+* Description : Remove a source filter from a host group.
+*
+* Argument(s) : if_nbr      Interface number of host group.
+*
+*               p_addr_grp  Pointer to IPv6 address of host group.
+*
+*               p_addr_src  Pointer to IPv6 address of filtered source.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                                                                   - RETURNED BY NetMLDP_HostGrpSrcRemoveHandler() : -
+*                               NET_MLDP_ERR_NONE                   Source filter successfully removed.
+*                               NET_MLDP_ERR_HOST_GRP_NOT_FOUND     Host group NOT found.
+*                               NET_MLDP_ERR_SRC_NOT_FOUND          Source     NOT found.
+*                               NET_INIT_ERR_NOT_COMPLETED          Network initialization NOT complete.
+*
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : ------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
+*
+*                               NET_ERR_FAULT_FEATURE_DIS           Source filtering disabled (see Note #2).
+*
+* Return(s)   : DEF_OK,   if source filter successfully removed.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #1].
+*
+* Note(s)     : (1) NetMLDP_HostGrpSrcRemove() MUST NOT be called with the global network lock already
+*                   acquired.
+*
+*                   See also 'NetMLDP_HostGrpLeave()  Note #1'.
+*
+*               (2) Source filters are ONLY available if NET_MCAST_CFG_SRC_FILTER_EN is enabled (see
+*                   'net_mldp.h  Note #2c').
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetMLDP_HostGrpSrcRemove (NET_IF_NBR      if_nbr,
+                                       NET_IPv6_ADDR  *p_addr_grp,
+                                       NET_IPv6_ADDR  *p_addr_src,
+                                       NET_ERR        *p_err)
+{
+    CPU_BOOLEAN  result = DEF_FAIL;
+
+
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+    Net_GlobalLockAcquire((void *)&NetMLDP_HostGrpSrcRemove, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE POINTERS ----------------- */
+    if ((p_addr_grp == (NET_IPv6_ADDR *)0) ||
+        (p_addr_src == (NET_IPv6_ADDR *)0)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.MLDP.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        goto exit_release;
+    }
+#endif
+
+                                                                /* Remove src filter.                                   */
+    result = NetMLDP_HostGrpSrcRemoveHandler(if_nbr, p_addr_grp, p_addr_src, p_err);
+    goto exit_release;
+
+
+exit_release:
+    Net_GlobalLockRelease();
+#else
+   (void)&if_nbr;
+   (void)&p_addr_grp;
+   (void)&p_addr_src;
+   *p_err = NET_ERR_FAULT_FEATURE_DIS;                          /* See Note #2.                                         */
+    goto exit_lock_fault;
+#endif
+
+exit_lock_fault:
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   NetMLDP_HostGrpSrcRemoveHandler()
+*
+* Description : (1) Remove a source filter from a host group :
+*
+*                   (a) Search host group & source entry
+*                   (b) Dereference source entry; free it on last reference
+*                   (c) Remove host group on last INCLUDE source reference, if NOT joined for any source
+*                   (d) Advertise new filter state to multicast router(s)
+*
+*
+* Argument(s) : if_nbr      Interface number of host group.
+*
+*               p_addr_grp  Pointer to IPv6 address of host group.
+*               ----------  Argument validated by caller(s).
+*
+*               p_addr_src  Pointer to IPv6 address of filtered source.
+*               ----------  Argument validated by caller(s).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function
+*                               (see 'NetMLDP_HostGrpSrcRemove()').
+*
+* Return(s)   : DEF_OK,   if source filter successfully removed.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetMLDP_HostGrpSrcRemove().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetMLDP_HostGrpSrcRemoveHandler() is called by network protocol suite function(s) &
+*                   MUST be called with the global network lock already acquired.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetMLDP_HostGrpSrcRemoveHandler (      NET_IF_NBR      if_nbr,
+                                              const NET_IPv6_ADDR  *p_addr_grp,
+                                              const NET_IPv6_ADDR  *p_addr_src,
+                                                    NET_ERR        *p_err)
+{
+    NET_MLDP_HOST_GRP      *p_host_grp;
+    NET_MLDP_HOST_GRP_SRC  *p_src;
+    NET_MLDP_FILTER_MODE    filter_mode;
+    CPU_BOOLEAN             src_freed;
+    CPU_BOOLEAN             result;
+
+
+    result = DEF_FAIL;
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err = NET_INIT_ERR_NOT_COMPLETED;
+        goto exit;
+    }
+#endif
+
+                                                                /* ---------------- SRCH HOST GRP/SRC ----------------- */
+    p_host_grp = NetMLDP_HostGrpSrch(if_nbr, p_addr_grp);
+    if (p_host_grp == (NET_MLDP_HOST_GRP *)0) {
+       *p_err = NET_MLDP_ERR_HOST_GRP_NOT_FOUND;
+        goto exit;
+    }
+
+    p_src = NetMLDP_HostGrpSrcSrch(p_host_grp, p_addr_src);
+    if (p_src == (NET_MLDP_HOST_GRP_SRC *)0) {
+       *p_err = NET_MLDP_ERR_SRC_NOT_FOUND;
+        goto exit;
+    }
+
+                                                                /* ------------------ DEREF SRC ENTRY ----------------- */
+    filter_mode = p_src->FilterMode;
+    src_freed   = DEF_NO;
+    p_src->RefCtr--;
+    if (p_src->RefCtr < 1u) {
+        NetMLDP_HostGrpSrcDel(p_host_grp, p_src);
+        src_freed = DEF_YES;
+    }
+
+    if (filter_mode == NET_MLDP_FILTER_MODE_INCLUDE) {
+        p_host_grp->RefCtr--;
+        if (p_host_grp->RefCtr < 1u) {                          /* If last ref to host grp, ...                         */
+            NetMLDP_HostGrpLeaveTx(p_host_grp, p_err);          /* ... advertise leave ...                              */
+            NetMLDP_HostGrpRemove(p_host_grp);                  /* ... & remove host grp.                               */
+           *p_err  = NET_MLDP_ERR_NONE;
+            result = DEF_OK;
+            goto exit;
+        }
+    }
+
+                                                                /* ------------ ADVERTISE NEW FILTER STATE ------------ */
+    if (src_freed == DEF_YES) {
+        NetMLDP_HostGrpStateChng(p_host_grp);
+    }
+
+   *p_err  = NET_MLDP_ERR_NONE;
+    result = DEF_OK;
 
 exit:
     return (result);
@@ -769,6 +1347,78 @@ CPU_BOOLEAN  NetMLDP_IsGrpJoinedOnIF (      NET_IF_NBR      if_nbr,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetMLDP_IsSrcAllowedOnIF()
+*
+* Description : Check host group source filter for a received packet.
+*
+* Argument(s) : if_nbr      Interface number the packet was received on.
+*
+*               p_addr_grp  Pointer to IPv6 address of host group (i.e. the packet's destination address).
+*
+*               p_addr_src  Pointer to IPv6 address of the packet's source.
+*
+* Return(s)   : DEF_YES, if host group joined on interface & source NOT filtered out.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetIPv6_RxPktValidate().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Interface multicast address filters are typically imperfect (i.e. hashed) & may pass
+*                   packets for groups & sources NOT requested; the source filter is therefore ALWAYS
+*                   enforced in software (see RFC #3810, Section 3.2).
+*
+*               (2) See 'net_mldp.h  MLDP HOST GROUP SOURCE DATA TYPE  Note #2'.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetMLDP_IsSrcAllowedOnIF (      NET_IF_NBR      if_nbr,
+                                       const NET_IPv6_ADDR  *p_addr_grp,
+                                       const NET_IPv6_ADDR  *p_addr_src)
+{
+    NET_MLDP_HOST_GRP      *p_host_grp;
+    NET_MLDP_HOST_GRP_SRC  *p_src;
+    NET_MLDP_FILTER_MODE    filter_mode;
+    CPU_BOOLEAN             src_allowed;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE POINTERS ----------------- */
+    if ((p_addr_grp == (NET_IPv6_ADDR *)0) ||
+        (p_addr_src == (NET_IPv6_ADDR *)0)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.MLDP.NullPtrCtr);
+        return (DEF_NO);
+    }
+#endif
+
+    p_host_grp = NetMLDP_HostGrpSrch(if_nbr, p_addr_grp);
+    if (p_host_grp == (NET_MLDP_HOST_GRP *)0) {
+        return (DEF_NO);
+    }
+
+    if (p_host_grp->SrcNbr < 1u) {                              /* If NO src filters, accept any src.                   */
+        return (DEF_YES);
+    }
+
+    filter_mode = NetMLDP_HostGrpFilterModeGet(p_host_grp);     /* See Note #2.                                         */
+    p_src       = NetMLDP_HostGrpSrcSrch(p_host_grp, p_addr_src);
+
+    if (filter_mode == NET_MLDP_FILTER_MODE_EXCLUDE) {
+        src_allowed = ((p_src             == (NET_MLDP_HOST_GRP_SRC *)0) ||
+                       (p_src->FilterMode != NET_MLDP_FILTER_MODE_EXCLUDE)) ? DEF_YES : DEF_NO;
+    } else {
+        src_allowed = ((p_src             != (NET_MLDP_HOST_GRP_SRC *)0) &&
+                       (p_src->FilterMode == NET_MLDP_FILTER_MODE_INCLUDE)) ? DEF_YES : DEF_NO;
+    }
+
+    return (src_allowed);
+}
+
+
 /*
 *********************************************************************************************************
 *                                       NetMLDP_HopByHopHdr()
@@ -897,6 +1547,7 @@ void  NetMLDP_Rx (NET_BUF          *p_buf,
              NetMLDP_RxQuery(if_nbr,
                             &p_buf_hdr->IPv6_AddrDest,
                              p_mldp_hdr,
+                             p_buf_hdr->MLDP_MsgLen,
                              p_err);
 #if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)
              p_ctr = (NET_CTR *)Net_StatCtrs.MLDP.RxMsgQueryCtr;
@@ -1118,6 +1769,8 @@ static  void  NetMLDP_RxPktValidate (NET_BUF          *p_buf,
 *               p_mldp_hdr    Pointer to received packet's MLDP header.
 *               ----------    Argument validated in caller(s).
 *
+*               msg_len       Length of received MLDP message.
+*
 *               p_err         Pointer to variable that will receive the return error code from this function :
 *
 *                                 NET_MLDP_ERR_NONE
@@ -1136,12 +1789,23 @@ static  void  NetMLDP_RxPktValidate (NET_BUF          *p_buf,
 *
 *                   (b) MLD messages are never sent for multicast addresses whose scope is 0
 *                      (reserved) or 1 (node-local).
+*
+*               (3) (a) The interface's MLDP compatibility mode follows the version of the last query
+*                       received (see 'MLDPv2 MESSAGE DEFINES  Note #1'), unless source filtering is
+*                       disabled (see 'net_mldp.h  Note #2c').
+*
+*                   (b) The Maximum Response Delay is received in network-order; MLDPv2 queries encode
+*                       large delays as a floating-point value (see 'MLDPv2 MESSAGE DEFINES  Note #3').
+*
+*                   (c) Multicast-Address-and-Source-Specific Queries are answered as Multicast-Address-
+*                       Specific Queries, i.e. with the host group's complete current state.
 *********************************************************************************************************
 */
 
 static  void  NetMLDP_RxQuery (      NET_IF_NBR        if_nbr,
                                const NET_IPv6_ADDR    *p_addr_dest,
                                      NET_MLDP_V1_HDR  *p_mldp_hdr,
+                                     CPU_INT16U        msg_len,
                                      NET_ERR          *p_err)
 {
     NET_MLDP_HOST_GRP        *p_mldp_grp;
@@ -1151,6 +1815,8 @@ static  void  NetMLDP_RxQuery (      NET_IF_NBR        if_nbr,
     NET_TMR_TICK              timeout_tick;
     CPU_INT16U                timeout_sec;
     CPU_INT32U                resp_delay_ms;
+    CPU_INT16U                resp_code;
+    CPU_INT16U                resp_exp;
     CPU_INT08U                scope;
     CPU_BOOLEAN               is_addr_unspecified;
     CPU_BOOLEAN               is_addr_mcast;
@@ -1180,8 +1846,25 @@ static  void  NetMLDP_RxQuery (      NET_IF_NBR        if_nbr,
          return;
     }
 
+#ifdef  NET_MCAST_SRC_FILTER_MODULE_EN
+                                                                /* ---------------- SET COMPAT MODE ------------------- */
+    if (msg_len < NET_MLDP_V2_QUERY_MSG_SIZE_MIN) {             /* See Note #3a.                                        */
+        NetMLDP_CompatV1OnIF[if_nbr] = DEF_YES;
+    } else {
+        NetMLDP_CompatV1OnIF[if_nbr] = DEF_NO;
+    }
+#endif
+
                                                                 /* ----------------- SET DELAY VALUE ------------------ */
-    resp_delay_ms = p_mldp_hdr->MaxResponseDly;
+    NET_UTIL_VAL_COPY_GET_NET_16(&resp_code, &p_mldp_hdr->MaxResponseDly);
+    if ((msg_len >= NET_MLDP_V2_QUERY_MSG_SIZE_MIN) &&          /* See Note #3b.                                        */
+        (DEF_BIT_IS_SET(resp_code, NET_MLDP_V2_MAX_RESP_CODE_FLOAT) == DEF_YES)) {
+        resp_exp      = (resp_code & NET_MLDP_V2_MAX_RESP_CODE_EXP_MASK) >> NET_MLDP_V2_MAX_RESP_CODE_EXP_SHIFT;
+        resp_delay_ms = (CPU_INT32U)((resp_code & NET_MLDP_V2_MAX_RESP_CODE_MANT_MASK) | NET_MLDP_V2_MAX_RESP_CODE_MANT_BIT);
+        resp_delay_ms <<= (resp_exp + 3u);
+    } else {
+        resp_delay_ms = (CPU_INT32U)resp_code;
+    }
     if (resp_delay_ms != 0) {
         timeout_tick = resp_delay_ms * NET_TMR_TIME_TICK_PER_SEC / 1000;
     } else {
@@ -1279,8 +1962,7 @@ static  void  NetMLDP_RxQuery (      NET_IF_NBR        if_nbr,
 *                   (a) Find if IF is listening to the multicast address.
 *                   (b) If the group address is one the IF listen to :
 *                           i)   remove delay timer.
-*                           ii)  Increase the listener count.
-*                           iii) Change the group state to IDLE.
+*                           ii)  Change the group state to IDLE.
 *
 * Argument(s) : if_nbr        Interface number on which message was received.
 *
@@ -1299,7 +1981,12 @@ static  void  NetMLDP_RxQuery (      NET_IF_NBR        if_nbr,
 *
 * Caller(s)   : NetMLDP_Rx().
 *
-* Note(s)     : none.
+* Note(s)     : (2) RFC #3810, Section 6.1 states that MLDv2 listeners do NOT suppress their reports on
+*                   hearing other listeners' reports.  Reports are ONLY suppressed on interfaces in
+*                   MLDPv1 compatibility mode.
+*
+*               (3) Reports from other listeners do NOT reference the host group; the host group's
+*                   reference counter ONLY counts local memberships.
 *********************************************************************************************************
 */
 
@@ -1322,6 +2009,11 @@ static  void  NetMLDP_RxReport (      NET_IF_NBR        if_nbr,
     }
 #endif
 
+    if (NetMLDP_CompatV1OnIF[if_nbr] != DEF_YES) {              /* See Note #2.                                         */
+       *p_err = NET_MLDP_ERR_NONE;
+        return;
+    }
+
     p_mldp_grp_addr = &p_mldp_hdr->McastAddr;
 
     is_addr_mcast   =  NetIPv6_IsAddrMcast(p_mldp_grp_addr);
@@ -1339,8 +2031,6 @@ static  void  NetMLDP_RxReport (      NET_IF_NBR        if_nbr,
         return;
     }
 
-    p_mldp_grp->RefCtr++;                                       /* Increase Listener counter.                           */
-
     p_mldp_grp->State = NET_MLDP_HOST_GRP_STATE_IDLE;           /* Set state to IDLE.                                   */
 
                                                                 /* Free timer.                                          */
@@ -1370,9 +2060,12 @@ static  void  NetMLDP_RxReport (      NET_IF_NBR        if_nbr,
 * Return(s)   : none.
 *
 * Caller(s)   : NetMLDP_HostGrpAdd(),
-*               NetMLDP_TxAdvertiseMembership().
+*               NetMLDP_HostGrpStateChng(),
+*               NetMLDP_LinkStateNotification().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Unsolicited reports advertise a change of the host group's filter state & are sent as
+*                   MLDPv2 State Change Reports; the report is retransmitted once on the report timeout
+*                   (see RFC #3810, Section 6.1 & 'NetMLDP_HostGrpReportDlyTimeout()  Note #4').
 *********************************************************************************************************
 */
 
@@ -1414,36 +2107,188 @@ static  void  NetMLDP_TxAdvertiseMembership (NET_MLDP_HOST_GRP  *p_grp,
             p_grp->Delay_ms = 0u;
         }
 
-        NetMLDP_TxReport(p_grp->IF_Nbr,
-                        &p_grp->AddrGrp,
-                         p_err);
-        switch (*p_err) {
-            case NET_MLDP_ERR_NONE:
-            case NET_ERR_TX_BUF_NONE_AVAIL:
-                 break;
+        DEF_BIT_SET(p_grp->Flags, NET_MLDP_FLAG_STATE_CHNG);    /* See Note #1.                                         */
+
+        NetMLDP_TxReport(p_grp->IF_Nbr,
+                        &p_grp->AddrGrp,
+                         p_err);
+
+        if (p_grp->TmrPtr == (NET_TMR *)0) {                    /* If report NOT retransmitted, end state chng.         */
+            DEF_BIT_CLR(p_grp->Flags, NET_MLDP_FLAG_STATE_CHNG);
+        }
+
+        switch (*p_err) {
+            case NET_MLDP_ERR_NONE:
+            case NET_ERR_TX_BUF_NONE_AVAIL:
+                 break;
+
+            case NET_ERR_IF_LINK_DOWN:
+                 if (p_grp->TmrPtr != (NET_TMR *)0) {
+                     NetTmr_Free(p_grp->TmrPtr);
+                     p_grp->TmrPtr = (NET_TMR *)0;
+                 }
+                 DEF_BIT_CLR(p_grp->Flags, NET_MLDP_FLAG_STATE_CHNG);
+                 break;
+
+            case NET_ERR_TX:
+            case NET_MLDP_ERR_INVALID_HOP_HDR:
+                *p_err = NET_ERR_TX;
+                 goto exit;
+
+            default:
+                *p_err = NET_ERR_FAULT_UNKNOWN_ERR;
+                 goto exit;
+        }
+
+    } else {
+        p_grp->TmrPtr   = (NET_TMR *)0;
+        p_grp->State    =  NET_MLDP_HOST_GRP_STATE_IDLE;
+        p_grp->Delay_ms =  0;
+    }
+
+
+   *p_err =  NET_MLDP_ERR_NONE;
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetMLDP_TxReport()
+*
+* Description : Transmit Multicast Listener Report message.
+*
+* Argument(s) : if_nbr              Network interface number to transmit Multicast Listener Report message.
+*
+*               p_addr_mcast_dest   Pointer to IPv6 multicast group address.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_MLDP_ERR_NONE               MLDP Report successfully transmitted.
+*                               NET_MLDP_ERR_INVALID_HOP_HDR    Error while setting Hop-by-Hop ext header.
+*                               NET_MLDP_ERR_TX                 Error while transmitting MDLP report.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetMLDP_TxAdvertiseMembership(),
+*               NetMLDP_RxQuery(),
+*               NetMLDP_HostGrpLeaveTx(),
+*               NetMLDP_HostGrpReportDlyTimeout().
+*
+* Note(s)     : (1) (a) Interfaces in MLDPv2 mode report the host group's filter state in an MLDPv2
+*                       Report; a State Change Report is sent while the host group's state change is
+*                       pending, a Current State Report otherwise (see RFC #3810, Section 5.2.12).
+*
+*                   (b) Interfaces in MLDPv1 compatibility mode send an MLDPv1 Report.
+*********************************************************************************************************
+*/
+
+static  void  NetMLDP_TxReport (NET_IF_NBR      if_nbr,
+                                NET_IPv6_ADDR  *p_addr_mcast_dest,
+                                NET_ERR        *p_err)
+{
+    NET_IPv6_ADDR          addr_unspecified;
+    NET_IPv6_ADDR         *p_addr_dest;
+    NET_IPv6_ADDR         *p_addr_src;
+    NET_IPv6_EXT_HDR       hop_hdr;
+    NET_IPv6_EXT_HDR      *p_ext_hdr_head;
+    NET_MLDP_HOST_GRP     *p_host_grp;
+    NET_MLDP_FILTER_MODE   filter_mode;
+    CPU_BOOLEAN            state_chng;
+    CPU_INT08U             rec_type;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE POINTER ------------------ */
+    if (p_addr_mcast_dest == (NET_IPv6_ADDR *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.MLDP.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+#endif
+
+                                                                /* ---------------- TX MLDPv2 REPORT ------------------ */
+    if (NetMLDP_CompatV1OnIF[if_nbr] != DEF_YES) {              /* See Note #1a.                                        */
+        p_host_grp = NetMLDP_HostGrpSrch(if_nbr, p_addr_mcast_dest);
+        if (p_host_grp != (NET_MLDP_HOST_GRP *)0) {
+            filter_mode = NetMLDP_HostGrpFilterModeGet(p_host_grp);
+            state_chng  = DEF_BIT_IS_SET(p_host_grp->Flags, NET_MLDP_FLAG_STATE_CHNG);
+            if (state_chng == DEF_YES) {
+                rec_type = (filter_mode == NET_MLDP_FILTER_MODE_INCLUDE) ? NET_MLDP_V2_REC_TYPE_CHANGE_TO_INCLUDE
+                                                                         : NET_MLDP_V2_REC_TYPE_CHANGE_TO_EXCLUDE;
+            } else {
+                rec_type = (filter_mode == NET_MLDP_FILTER_MODE_INCLUDE) ? NET_MLDP_V2_REC_TYPE_MODE_IS_INCLUDE
+                                                                         : NET_MLDP_V2_REC_TYPE_MODE_IS_EXCLUDE;
+            }
+
+            NetMLDP_TxReportV2(p_host_grp, rec_type, p_err);
+            goto exit;
+        }
+    }
+
+                                                                /* Take the multicast address being reported as dest.   */
+    p_addr_dest = p_addr_mcast_dest;
+
+                                                                /* Take a Link-Local address cfgd on IF as src addr.    */
+    p_addr_src = NetIPv6_GetAddrLinkLocalCfgd(if_nbr);
+    if (p_addr_src == (NET_IPv6_ADDR *)0) {
+        NetIPv6_AddrUnspecifiedSet(&addr_unspecified, p_err);
+        p_addr_src = &addr_unspecified;
+    }
+
+                                                                /* ---------------- ADD HOP-HOP HEADER ---------------- */
+    p_ext_hdr_head = (NET_IPv6_EXT_HDR *)0;
+
+    p_ext_hdr_head =  NetIPv6_ExtHdrAddToList(p_ext_hdr_head,
+                                             &hop_hdr,
+                                              NET_IP_HDR_PROTOCOL_EXT_HOP_BY_HOP,
+                                              NET_MLDP_OPT_HDR_SIZE,
+                                              NetMLDP_PrepareHopByHopHdr,
+                                              NET_IPv6_EXT_HDR_KEY_HOP_BY_HOP,
+                                              p_err);
+    switch (*p_err) {
+        case NET_IPv6_ERR_NONE:
+             break;
+
+        case NET_IPv6_ERR_INVALID_EH:
+             *p_err = NET_MLDP_ERR_INVALID_HOP_HDR;
+              goto exit;
 
-            case NET_ERR_IF_LINK_DOWN:
-                 NetTmr_Free(p_grp->TmrPtr);
-                 break;
+        default:
+            *p_err = NET_ERR_FAULT_UNKNOWN_ERR;
+             goto exit;
+    }
 
-            case NET_ERR_TX:
-            case NET_MLDP_ERR_INVALID_HOP_HDR:
-                *p_err = NET_ERR_TX;
-                 goto exit;
+                                                                /* ---------------- TX MLDP REPORT MSG ---------------- */
+    (void)NetICMPv6_TxMsgReqHandler(        if_nbr,
+                                            NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V1,
+                                            NET_ICMPv6_MSG_CODE_MLDP_REPORT,
+                                            0u,
+                                            p_addr_src,
+                                            p_addr_dest,
+                                            NET_IPv6_HDR_HOP_LIM_MIN,
+                                            DEF_NO,
+                                            p_ext_hdr_head,
+                                    (void *)p_addr_mcast_dest,
+                                            NET_IPv6_ADDR_SIZE,
+                                            p_err);
+    switch (*p_err) {
+        case NET_ICMPv6_ERR_NONE:
+             break;
 
-            default:
-                *p_err = NET_ERR_FAULT_UNKNOWN_ERR;
-                 goto exit;
-        }
+        case NET_ERR_TX:
+        case NET_ERR_IF_LINK_DOWN:
+             goto exit;
 
-    } else {
-        p_grp->TmrPtr   = (NET_TMR *)0;
-        p_grp->State    =  NET_MLDP_HOST_GRP_STATE_IDLE;
-        p_grp->Delay_ms =  0;
+        default:
+            *p_err = NET_ERR_FAULT_UNKNOWN_ERR;
+             goto exit;
     }
 
 
-   *p_err =  NET_MLDP_ERR_NONE;
+   *p_err = NET_MLDP_ERR_NONE;
 
 exit:
     return;
@@ -1452,55 +2297,87 @@ exit:
 
 /*
 *********************************************************************************************************
-*                                         NetMLDP_TxReport()
+*                                        NetMLDP_TxReportV2()
 *
-* Description : Transmit Multicast Listener Report message.
+* Description : (1) Transmit an MLDPv2 Multicast Listener Report for a single host group :
 *
-* Argument(s) : if_nbr              Network interface number to transmit Multicast Listener Report message.
+*                   (a) Prepare Multicast Address Record with host group source list for record's
+*                       filter mode (see RFC #3810, Section 5.2)
+*                   (b) Add Hop-by-Hop header with Router Alert option
+*                   (c) Transmit report to all MLDPv2-capable routers
 *
-*               p_addr_mcast_dest   Pointer to IPv6 multicast group address.
+*
+* Argument(s) : p_host_grp  Pointer to host group to report.
+*               ----------  Argument checked in NetMLDP_TxReport().
+*
+*               rec_type    MLDPv2 Multicast Address Record type.
 *
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_MLDP_ERR_NONE               MLDP Report successfully transmitted.
 *                               NET_MLDP_ERR_INVALID_HOP_HDR    Error while setting Hop-by-Hop ext header.
-*                               NET_MLDP_ERR_TX                 Error while transmitting MDLP report.
+*                               NET_ERR_TX                      Error while transmitting MDLP report.
+*                               NET_ERR_IF_LINK_DOWN            Network interface link state down.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : NetMLDP_HostGrpJoinHandler()
-*               NetMLDP_RxQuery()
-*               NetMLDP_HostGrpReportDlyTimeout()
+* Caller(s)   : NetMLDP_TxReport().
 *
-* Note(s)     : none.
+* Note(s)     : (2) The MLDPv2 Report header's Reserved & Number of Multicast Address Records fields are
+*                   set by NetICMPv6_TxMsgReqHandler(); a single record is transmitted.
+*
+*               (3) See 'MLDPv2 MESSAGE DEFINES  Note #2'.
 *********************************************************************************************************
 */
 
-static  void  NetMLDP_TxReport (NET_IF_NBR      if_nbr,
-                                NET_IPv6_ADDR  *p_addr_mcast_dest,
-                                NET_ERR        *p_err)
+static  void  NetMLDP_TxReportV2 (NET_MLDP_HOST_GRP  *p_host_grp,
+                                  CPU_INT08U          rec_type,
+                                  NET_ERR            *p_err)
 {
-    NET_IPv6_ADDR      addr_unspecified;
-    NET_IPv6_ADDR     *p_addr_dest;
-    NET_IPv6_ADDR     *p_addr_src;
-    NET_IPv6_EXT_HDR   hop_hdr;
-    NET_IPv6_EXT_HDR  *p_ext_hdr_head;
-
-
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-                                                                /* ---------------- VALIDATE POINTER ------------------ */
-    if (p_addr_mcast_dest == (NET_IPv6_ADDR *)0) {
-        NET_CTR_ERR_INC(Net_ErrCtrs.MLDP.NullPtrCtr);
-       *p_err = NET_ERR_FAULT_NULL_PTR;
-        return;
+    CPU_INT08U              rec[NET_MLDP_V2_GRP_REC_HDR_SIZE + (NET_MCAST_CFG_SRC_NBR_MAX * NET_IPv6_ADDR_SIZE)];
+    NET_IPv6_ADDR           addr_unspecified;
+    NET_IPv6_ADDR           addr_mcast_all_routers;
+    NET_IPv6_ADDR          *p_addr_src;
+    NET_IPv6_EXT_HDR        hop_hdr;
+    NET_IPv6_EXT_HDR       *p_ext_hdr_head;
+    NET_MLDP_HOST_GRP_SRC  *p_src;
+    NET_MLDP_FILTER_MODE    filter_mode;
+    NET_IF_NBR              if_nbr;
+    CPU_INT16U              rec_len;
+    CPU_INT16U              src_nbr;
+    CPU_INT08U              i;
+
+
+    if_nbr = p_host_grp->IF_Nbr;
+
+                                                                /* ---------------- PREPARE GRP RECORD ---------------- */
+    filter_mode = ((rec_type == NET_MLDP_V2_REC_TYPE_MODE_IS_INCLUDE) ||
+                   (rec_type == NET_MLDP_V2_REC_TYPE_CHANGE_TO_INCLUDE)) ? NET_MLDP_FILTER_MODE_INCLUDE
+                                                                         : NET_MLDP_FILTER_MODE_EXCLUDE;
+    rec_len = NET_MLDP_V2_GRP_REC_HDR_SIZE;
+    src_nbr = 0u;
+    p_src   = &p_host_grp->SrcTbl[0];
+    for (i = 0u; i < p_host_grp->SrcNbr; i++) {                 /* Copy srcs in rec's filter mode.                      */
+        if (p_src->FilterMode == filter_mode) {
+            Mem_Copy(&rec[rec_len], &p_src->AddrSrc, NET_IPv6_ADDR_SIZE);
+            rec_len += NET_IPv6_ADDR_SIZE;
+            src_nbr++;
+        }
+        p_src++;
     }
-#endif
 
-                                                                /* Take the multicast address being reported as dest.   */
-    p_addr_dest = p_addr_mcast_dest;
+    rec[0] = rec_type;                                          /* Rec type, aux data len, nbr of srcs, grp addr.       */
+    rec[1] = 0u;
+    NET_UTIL_VAL_COPY_SET_NET_16(&rec[2], &src_nbr);
+    Mem_Copy(&rec[4], &p_host_grp->AddrGrp, NET_IPv6_ADDR_SIZE);
 
-                                                                /* Take a Link-Local address cfgd on IF as src addr.    */
-    p_addr_src = NetIPv6_GetAddrLinkLocalCfgd(if_nbr);
+                                                                /* ----------------- SET SRC/DEST ADDR ---------------- */
+    Mem_Clr(&addr_mcast_all_routers, NET_IPv6_ADDR_SIZE);       /* See Note #3.                                         */
+    addr_mcast_all_routers.Addr[0]  = 0xFFu;
+    addr_mcast_all_routers.Addr[1]  = NET_MLDP_V2_ADDR_ALL_ROUTERS_SCOPE;
+    addr_mcast_all_routers.Addr[15] = NET_MLDP_V2_ADDR_ALL_ROUTERS_GRP_ID;
+
+    p_addr_src = NetIPv6_GetAddrLinkLocalCfgd(if_nbr);          /* Take a Link-Local address cfgd on IF as src addr.    */
     if (p_addr_src == (NET_IPv6_ADDR *)0) {
         NetIPv6_AddrUnspecifiedSet(&addr_unspecified, p_err);
         p_addr_src = &addr_unspecified;
@@ -1521,26 +2398,26 @@ static  void  NetMLDP_TxReport (NET_IF_NBR      if_nbr,
              break;
 
         case NET_IPv6_ERR_INVALID_EH:
-             *p_err = NET_MLDP_ERR_INVALID_HOP_HDR;
-              goto exit;
+            *p_err = NET_MLDP_ERR_INVALID_HOP_HDR;
+             goto exit;
 
         default:
             *p_err = NET_ERR_FAULT_UNKNOWN_ERR;
              goto exit;
     }
 
-                                                                /* ---------------- TX MLDP REPORT MSG ---------------- */
+                                                                /* --------------- TX MLDPv2 REPORT MSG --------------- */
     (void)NetICMPv6_TxMsgReqHandler(        if_nbr,
-                                            NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V1,
+                                            NET_ICMPv6_MSG_TYPE_MLDP_REPORT_V2,
                                             NET_ICMPv6_MSG_CODE_MLDP_REPORT,
                                             0u,
                                             p_addr_src,
-                                            p_addr_dest,
+                                           &addr_mcast_all_routers,
                                             NET_IPv6_HDR_HOP_LIM_MIN,
                                             DEF_NO,
                                             p_ext_hdr_head,
-                                    (void *)p_addr_mcast_dest,
-                                            NET_IPv6_ADDR_SIZE,
+                                    (void *)&rec[0],
+                                            rec_len,
                                             p_err);
     switch (*p_err) {
         case NET_ICMPv6_ERR_NONE:
@@ -1581,7 +2458,7 @@ exit:
 *
 * Return(s)   : none.
 *
-* Caller(s)   : NetMLDP_HostGrpLeaveHandler().
+* Caller(s)   : NetMLDP_HostGrpLeaveTx().
 *
 * Note(s)     : None.
 *********************************************************************************************************
@@ -1747,9 +2624,14 @@ exit:
 *               NetMLDP_HostGrpLeaveHandler(),
 *               NetMLDP_IsGrpJoinedOnIF(),
 *               NetMLDP_RxQuery(),
-*               NetMLDP_RxReport().
+*               NetMLDP_RxReport(),
+*               NetMLDP_HostGrpSrcAddHandler(),
+*               NetMLDP_HostGrpSrcRemoveHandler(),
+*               NetMLDP_IsSrcAllowedOnIF(),
+*               NetMLDP_TxReport().
 *
-* Note(s)     : none.
+* Note(s)     : (3) The MLDP Host Group List is ONLY walked to advertise memberships; lookups search the
+*                   host group's hash bucket (see 'MLDP HOST GROUP HASH DEFINES  Note #1').
 *********************************************************************************************************
 */
 
@@ -1758,22 +2640,21 @@ static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpSrch (      NET_IF_NBR      if_nbr,
 {
     NET_MLDP_HOST_GRP  *p_host_grp;
     NET_MLDP_HOST_GRP  *p_host_grp_next;
-    CPU_INT08U          match_bit;
+    CPU_INT16U          hash_ix;
     CPU_BOOLEAN         found;
 
 
-    p_host_grp = NetMLDP_HostGrpListHead;                       /* Start @ MLDP Host Grp List head.                     */
+    hash_ix    = NET_MLDP_HOST_GRP_HASH(if_nbr, p_addr);        /* See Note #3.                                         */
+    p_host_grp = NetMLDP_HostGrpHashTbl[hash_ix];               /* Start @ MLDP host grp hash bucket head.              */
     found      = DEF_NO;
 
-    while ((p_host_grp != (NET_MLDP_HOST_GRP *)0) &&            /* Srch MLDP Host Grp List ...                          */
+    while ((p_host_grp != (NET_MLDP_HOST_GRP *)0) &&            /* Srch MLDP host grp hash bucket ...                   */
            (found      ==  DEF_NO)               ) {            /* ... until host grp found.                            */
 
-        p_host_grp_next = (NET_MLDP_HOST_GRP *) p_host_grp->NextListPtr;
-
-        match_bit       =  NetIPv6_GetAddrMatchingLen(&p_host_grp->AddrGrp, p_addr);
+        p_host_grp_next = (NET_MLDP_HOST_GRP *) p_host_grp->HashNextPtr;
 
         found = ((p_host_grp->IF_Nbr  == if_nbr) &&             /* Cmp IF nbr & grp addr.                               */
-                 (match_bit == 128)) ? DEF_YES : DEF_NO;
+                 (Mem_Cmp(&p_host_grp->AddrGrp, p_addr, NET_IPv6_ADDR_SIZE) == DEF_YES)) ? DEF_YES : DEF_NO;
 
         if (found != DEF_YES) {                                 /* If NOT found, adv to next MLDP host grp.             */
             p_host_grp = p_host_grp_next;
@@ -1851,6 +2732,8 @@ static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpSrchIF (NET_IF_NBR  if_nbr)
 *               p_addr      Pointer to IPv6 address of host group to add.
 *               --------    Argument checked in NetMLDP_HostGrpJoinHandler().
 *
+*               p_addr_src  Pointer to IPv6 address of host group's first INCLUDE source, if any (see Note #2).
+*
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_MLDP_ERR_NONE                   Host group succesfully added.
@@ -1862,14 +2745,18 @@ static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpSrchIF (NET_IF_NBR  if_nbr)
 *
 *               Pointer to NULL,       otherwise.
 *
-* Caller(s)   : NetMLDP_HostGrpJoinHandler().
+* Caller(s)   : NetMLDP_HostGrpJoinHandler(),
+*               NetMLDP_HostGrpSrcAddHandler().
 *
-* Note(s)     : none.
+* Note(s)     : (2) A host group added with NO source is an any-source membership; otherwise, the host
+*                   group is ONLY referenced by its INCLUDE source.  The source is configured PRIOR to
+*                   advertising the membership so that the initial report carries the correct filter state.
 *********************************************************************************************************
 */
 
 static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpAdd (      NET_IF_NBR      if_nbr,
                                                 const NET_IPv6_ADDR  *p_addr,
+                                                const NET_IPv6_ADDR  *p_addr_src,
                                                       NET_ERR        *p_err)
 {
     NET_MLDP_HOST_GRP  *p_host_grp;
@@ -1891,6 +2778,16 @@ static  NET_MLDP_HOST_GRP  *NetMLDP_HostGrpAdd (      NET_IF_NBR      if_nbr,
     p_host_grp->IF_Nbr  =   if_nbr;
     p_host_grp->RefCtr  =   1u;
 
+    if (p_addr_src == (NET_IPv6_ADDR *)0) {                     /* See Note #2.                                         */
+        p_host_grp->AnySrcRefCtr = 1u;
+    } else {
+        p_host_grp->AnySrcRefCtr = 0u;
+        Mem_Copy(&p_host_grp->SrcTbl[0].AddrSrc, p_addr_src, NET_IPv6_ADDR_SIZE);
+        p_host_grp->SrcTbl[0].FilterMode = NET_MLDP_FILTER_MODE_INCLUDE;
+        p_host_grp->SrcTbl[0].RefCtr     = 1u;
+        p_host_grp->SrcNbr               = 1u;
+    }
+
                                                                 /* Set host grp state.                                  */
     p_host_grp->State = NET_MLDP_HOST_GRP_STATE_IDLE;
 
@@ -2025,6 +2922,256 @@ static  void  NetMLDP_HostGrpRemove (NET_MLDP_HOST_GRP  *p_host_grp)
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetMLDP_HostGrpLeaveTx()
+*
+* Description : Advertise that a host group is left on its interface.
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in NetMLDP_HostGrpLeaveHandler(),
+*                                               NetMLDP_HostGrpSrcRemoveHandler().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_MLDP_ERR_NONE               Host group leave successfully advertised.
+*
+*                                                               --- RETURNED BY NetMLDP_TxReport() : ---
+*                                                               --- RETURNED BY NetMLDP_TxMsgDone() : --
+*                               NET_MLDP_ERR_INVALID_HOP_HDR    Error while setting Hop-by-Hop ext header.
+*                               NET_ERR_TX                      Error while transmitting the MLDP message.
+*                               NET_ERR_IF_LINK_DOWN            Interface link is down.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetMLDP_HostGrpLeaveHandler(),
+*               NetMLDP_HostGrpSrcRemoveHandler().
+*
+* Note(s)     : (1) Leaves are NOT advertised for the all-nodes group nor for reserved & interface-local
+*                   scope groups (see RFC #3810, Section 6).
+*
+*               (2) (a) In MLDPv2 mode, leaving a host group is reported as a change to INCLUDE mode with
+*                       an empty source list (see RFC #3810, Section 6.1).  Since the host group is freed
+*                       immediately, the State Change Report is NOT retransmitted.
+*
+*                   (b) In MLDPv1 compatibility mode, a Done message is transmitted.
+*********************************************************************************************************
+*/
+
+static  void  NetMLDP_HostGrpLeaveTx (NET_MLDP_HOST_GRP  *p_host_grp,
+                                      NET_ERR            *p_err)
+{
+    CPU_BOOLEAN  is_mcast_allnodes;
+    CPU_INT08U   scope;
+
+
+    is_mcast_allnodes = NetIPv6_IsAddrMcastAllNodes(&p_host_grp->AddrGrp);
+    scope             = NetIPv6_GetAddrScope(&p_host_grp->AddrGrp);
+
+    if ((is_mcast_allnodes == DEF_YES)                   ||     /* See Note #1.                                         */
+        (scope             == NET_IPv6_ADDR_SCOPE_RESERVED) ||
+        (scope             == NET_IPv6_ADDR_SCOPE_IF_LOCAL)) {
+       *p_err = NET_MLDP_ERR_NONE;
+        return;
+    }
+
+    if (NetMLDP_CompatV1OnIF[p_host_grp->IF_Nbr] == DEF_YES) {  /* See Note #2b.                                        */
+        NetMLDP_TxMsgDone(p_host_grp->IF_Nbr,
+                         &p_host_grp->AddrGrp,
+                          p_err);
+        return;
+    }
+
+    DEF_BIT_SET(p_host_grp->Flags, NET_MLDP_FLAG_STATE_CHNG);   /* See Note #2a.                                        */
+    NetMLDP_TxReport(p_host_grp->IF_Nbr,
+                    &p_host_grp->AddrGrp,
+                     p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetMLDP_HostGrpStateChng()
+*
+* Description : Advertise a host group's new membership or source filter state :
+*
+*                   (a) Transmit State Change Report immediately
+*                   (b) Configure report timer to retransmit the report
+*
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetMLDP_HostGrpJoinHandler(),
+*               NetMLDP_HostGrpLeaveHandler(),
+*               NetMLDP_HostGrpSrcAddHandler(),
+*               NetMLDP_HostGrpSrcRemoveHandler().
+*
+* Note(s)     : (1) See 'NetMLDP_TxAdvertiseMembership()  Note #1'.
+*********************************************************************************************************
+*/
+
+static  void  NetMLDP_HostGrpStateChng (NET_MLDP_HOST_GRP  *p_host_grp)
+{
+    NET_ERR  err;
+
+
+    if (p_host_grp->TmrPtr != (NET_TMR *)0) {                   /* Restart report tmr.                                  */
+        NetTmr_Free(p_host_grp->TmrPtr);
+        p_host_grp->TmrPtr = (NET_TMR *)0;
+    }
+
+    NetMLDP_TxAdvertiseMembership(p_host_grp, &err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetMLDP_HostGrpSrcSrch()
+*
+* Description : Search a host group's source table for a source address.
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in caller(s).
+*
+*               p_addr_src  Pointer to IPv6 address of source to search.
+*               ----------  Argument checked in caller(s).
+*
+* Return(s)   : Pointer to host group source entry, if found.
+*
+*               Pointer to NULL,                    otherwise.
+*
+* Caller(s)   : NetMLDP_HostGrpSrcAddHandler(),
+*               NetMLDP_HostGrpSrcRemoveHandler(),
+*               NetMLDP_IsSrcAllowedOnIF().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  NET_MLDP_HOST_GRP_SRC  *NetMLDP_HostGrpSrcSrch (      NET_MLDP_HOST_GRP  *p_host_grp,
+                                                        const NET_IPv6_ADDR      *p_addr_src)
+{
+    NET_MLDP_HOST_GRP_SRC  *p_src;
+    CPU_INT08U              i;
+
+
+    p_src = &p_host_grp->SrcTbl[0];
+    for (i = 0u; i < p_host_grp->SrcNbr; i++) {
+        if (Mem_Cmp(&p_src->AddrSrc, p_addr_src, NET_IPv6_ADDR_SIZE) == DEF_YES) {
+            return (p_src);
+        }
+        p_src++;
+    }
+
+    return ((NET_MLDP_HOST_GRP_SRC *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetMLDP_HostGrpSrcDel()
+*
+* Description : Delete a source entry from a host group's source table.
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in caller(s).
+*
+*               p_src       Pointer to the host group's source entry to delete.
+*               -----       Argument checked in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetMLDP_HostGrpSrcRemoveHandler(),
+*               NetMLDP_HostGrpSrcClrMode().
+*
+* Note(s)     : (1) The last source entry is moved into the deleted entry's slot.
+*********************************************************************************************************
+*/
+
+static  void  NetMLDP_HostGrpSrcDel (NET_MLDP_HOST_GRP      *p_host_grp,
+                                     NET_MLDP_HOST_GRP_SRC  *p_src)
+{
+    NET_MLDP_HOST_GRP_SRC  *p_src_last;
+
+
+    p_host_grp->SrcNbr--;
+    p_src_last = &p_host_grp->SrcTbl[p_host_grp->SrcNbr];
+    if (p_src != p_src_last) {                                  /* See Note #1.                                         */
+       *p_src   = *p_src_last;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetMLDP_HostGrpSrcClrMode()
+*
+* Description : Delete ALL of a host group's source entries in a specific filter mode.
+*
+* Argument(s) : p_host_grp      Pointer to a host group.
+*               ----------      Argument checked in NetMLDP_HostGrpLeaveHandler().
+*
+*               filter_mode     Filter mode of source entries to delete.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetMLDP_HostGrpLeaveHandler().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetMLDP_HostGrpSrcClrMode (NET_MLDP_HOST_GRP     *p_host_grp,
+                                         NET_MLDP_FILTER_MODE   filter_mode)
+{
+    CPU_INT08U  i;
+
+
+    i = p_host_grp->SrcNbr;
+    while (i > 0u) {                                            /* Srch backwards since entries are moved on del.       */
+        i--;
+        if (p_host_grp->SrcTbl[i].FilterMode == filter_mode) {
+            NetMLDP_HostGrpSrcDel(p_host_grp, &p_host_grp->SrcTbl[i]);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    NetMLDP_HostGrpFilterModeGet()
+*
+* Description : Get a host group's interface filter mode.
+*
+* Argument(s) : p_host_grp  Pointer to a host group.
+*               ----------  Argument checked in caller(s).
+*
+* Return(s)   : NET_MLDP_FILTER_MODE_EXCLUDE, if host group joined for any source;
+*
+*               NET_MLDP_FILTER_MODE_INCLUDE, otherwise.
+*
+* Caller(s)   : NetMLDP_IsSrcAllowedOnIF(),
+*               NetMLDP_TxReport().
+*
+* Note(s)     : (1) See 'net_mldp.h  MLDP HOST GROUP SOURCE DATA TYPE  Note #2'.
+*********************************************************************************************************
+*/
+
+static  NET_MLDP_FILTER_MODE  NetMLDP_HostGrpFilterModeGet (NET_MLDP_HOST_GRP  *p_host_grp)
+{
+    NET_MLDP_FILTER_MODE  filter_mode;
+
+
+    filter_mode = (p_host_grp->AnySrcRefCtr > 0u) ? NET_MLDP_FILTER_MODE_EXCLUDE
+                                                  : NET_MLDP_FILTER_MODE_INCLUDE;
+
+    return (filter_mode);
+}
+
+
 /*
 *********************************************************************************************************
 *                                       NetMLDP_HostGrpInsert()
@@ -2044,6 +3191,8 @@ static  void  NetMLDP_HostGrpRemove (NET_MLDP_HOST_GRP  *p_host_grp)
 
 static  void  NetMLDP_HostGrpInsert (NET_MLDP_HOST_GRP  *p_host_grp)
 {
+    CPU_INT16U  hash_ix;
+
                                                                         /* ---------- CFG MLDP HOST GRP PTRS ---------- */
     p_host_grp->PrevListPtr = (NET_MLDP_HOST_GRP *)0;
     p_host_grp->NextListPtr = (NET_MLDP_HOST_GRP *)NetMLDP_HostGrpListHead;
@@ -2054,6 +3203,11 @@ static  void  NetMLDP_HostGrpInsert (NET_MLDP_HOST_GRP  *p_host_grp)
     }
 
     NetMLDP_HostGrpListHead = p_host_grp;                               /* Insert host grp @ list head.                 */
+
+                                                                        /* ---- INSERT MLDP HOST GRP INTO HASH TBL ---- */
+    hash_ix                         = NET_MLDP_HOST_GRP_HASH(p_host_grp->IF_Nbr, &p_host_grp->AddrGrp);
+    p_host_grp->HashNextPtr         = NetMLDP_HostGrpHashTbl[hash_ix];
+    NetMLDP_HostGrpHashTbl[hash_ix] = p_host_grp;
 }
 
 
@@ -2079,8 +3233,9 @@ static  void  NetMLDP_HostGrpInsert (NET_MLDP_HOST_GRP  *p_host_grp)
 
 static  void  NetMLDP_HostGrpUnlink (NET_MLDP_HOST_GRP  *p_host_grp)
 {
-    NET_MLDP_HOST_GRP  *p_host_grp_prev;
-    NET_MLDP_HOST_GRP  *p_host_grp_next;
+    NET_MLDP_HOST_GRP   *p_host_grp_prev;
+    NET_MLDP_HOST_GRP   *p_host_grp_next;
+    NET_MLDP_HOST_GRP  **pp_hash;
 
                                                                         /* ------ UNLINK MLDP HOST GRP FROM LIST ------ */
     p_host_grp_prev = p_host_grp->PrevListPtr;
@@ -2096,9 +3251,20 @@ static  void  NetMLDP_HostGrpUnlink (NET_MLDP_HOST_GRP  *p_host_grp)
         p_host_grp_next->PrevListPtr = p_host_grp_prev;
     }
 
+                                                                        /* ---- UNLINK MLDP HOST GRP FROM HASH TBL ---- */
+    pp_hash = &NetMLDP_HostGrpHashTbl[NET_MLDP_HOST_GRP_HASH(p_host_grp->IF_Nbr, &p_host_grp->AddrGrp)];
+    while (*pp_hash != (NET_MLDP_HOST_GRP *)0) {
+        if (*pp_hash == p_host_grp) {
+            *pp_hash = p_host_grp->HashNextPtr;
+             break;
+        }
+        pp_hash = &(*pp_hash)->HashNextPtr;
+    }
+
 #if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)                             /* Clr host grp ptrs (see Note #1).             */
     p_host_grp->PrevListPtr = (NET_MLDP_HOST_GRP *)0;
     p_host_grp->NextListPtr = (NET_MLDP_HOST_GRP *)0;
+    p_host_grp->HashNextPtr = (NET_MLDP_HOST_GRP *)0;
 #endif
 }
 
@@ -2282,6 +3448,8 @@ static  void  NetMLDP_HostGrpClr (NET_MLDP_HOST_GRP  *p_host_grp)
     p_host_grp->PrevIF_ListPtr  = (NET_MLDP_HOST_GRP *)0;
     p_host_grp->NextIF_ListPtr  = (NET_MLDP_HOST_GRP *)0;
 
+    p_host_grp->HashNextPtr     = (NET_MLDP_HOST_GRP *)0;
+
     p_host_grp->TmrPtr          = (NET_TMR           *)0;
     p_host_grp->Delay_ms        =  0;
 
@@ -2290,6 +3458,9 @@ static  void  NetMLDP_HostGrpClr (NET_MLDP_HOST_GRP  *p_host_grp)
 
     p_host_grp->State           =  NET_MLDP_HOST_GRP_STATE_FREE;
     p_host_grp->RefCtr          =  0u;
+    p_host_grp->AnySrcRefCtr    =  0u;
+    p_host_grp->SrcNbr          =  0u;
+    Mem_Clr(&p_host_grp->SrcTbl[0], sizeof(p_host_grp->SrcTbl));
     p_host_grp->Flags           =  NET_MLDP_FLAG_NONE;
 }
 
@@ -2346,6 +3517,9 @@ static  void  NetMLDP_HostGrpClr (NET_MLDP_HOST_GRP  *p_host_grp)
 *                       is transitory.
 *
 *                   (b) Revert to 'IDLE' state, if the error is permanent.
+*
+*               (4) A pending state change ends once its report is retransmitted, or on a permanent
+*                   transmit error (see 'NetMLDP_TxAdvertiseMembership()  Note #1').
 *********************************************************************************************************
 */
 
@@ -2375,7 +3549,8 @@ static  void  NetMLDP_HostGrpReportDlyTimeout (void  *p_host_grp_timeout)
     switch (err) {
         case NET_MLDP_ERR_NONE:                                 /* If NO err, ...                                       */
         case NET_ERR_IF_LINK_DOWN:
-             p_host_grp->State = NET_MLDP_HOST_GRP_STATE_IDLE;  /* ... set state to 'IDLE'.                             */
+             p_host_grp->State = NET_MLDP_HOST_GRP_STATE_IDLE;  /* ... set state to 'IDLE' (see Note #4).               */
+             DEF_BIT_CLR(p_host_grp->Flags, NET_MLDP_FLAG_STATE_CHNG);
              break;
 
 
@@ -2398,6 +3573,7 @@ static  void  NetMLDP_HostGrpReportDlyTimeout (void  *p_host_grp_timeout)
 
         default:                                                /* On all other errs, ...                               */
              p_host_grp->State = NET_MLDP_HOST_GRP_STATE_IDLE;  /* ... set state to 'IDLE'.                             */
+             DEF_BIT_CLR(p_host_grp->Flags, NET_MLDP_FLAG_STATE_CHNG);
              break;
     }
 }
@@ -25,8 +25,18 @@
 *********************************************************************************************************
 * Note(s)  : (1) Supports Neighbor Discovery Protocol as described in RFC #2710.
 *
-*            (2) Only the MLDPv1 is supported. MLDPv2 as described in RFC #3810 is not yet
-*                supported.
+*            (2) Supports MLDPv2 source filtering & reports as described in RFC #3810, & falls back to
+*                MLDPv1 reports on interfaces where an MLDPv1 querier is heard, with the following
+*                restrictions/constraints :
+*
+*                (a) Source filters are kept per interface & host group, NOT per socket; blocked
+*                    sources apply to ALL any-source members of the host group.
+*
+*                (b) Older Version Querier Present timeout NOT implemented; an interface returns to
+*                    MLDPv2 when an MLDPv2 query is next received.
+*
+*                (c) MLDPv2 reports & source filters are ONLY available if NET_MCAST_CFG_SRC_FILTER_EN
+*                    is enabled; otherwise, ALL interfaces report in MLDPv1 compatibility mode.
 *********************************************************************************************************
 */
 
@@ -105,6 +115,26 @@
 #define  NET_MLDP_MSG_SIZE_MAX                           NET_ICMPv6_MSG_LEN_MAX_NONE
 
 
+/*
+*********************************************************************************************************
+*                                    MLDP SOURCE FILTER MODE DEFINES
+*
+* Note(s) : (1) RFC #3810, Section 2.1 defines the two source filter modes of a multicast address
+*               listening state :
+*
+*               (a) INCLUDE     Packets are ONLY accepted from the listed source addresses.
+*               (b) EXCLUDE     Packets are accepted from all but the listed source addresses.
+*********************************************************************************************************
+*/
+
+#define  NET_MLDP_FILTER_MODE_NONE                         0u
+#define  NET_MLDP_FILTER_MODE_INCLUDE                      1u   /* See Note #1a.                                        */
+#define  NET_MLDP_FILTER_MODE_EXCLUDE                      2u   /* See Note #1b.                                        */
+
+#define  NET_MLDP_SRC_NBR_MIN                              1
+#define  NET_MLDP_SRC_NBR_MAX                            DEF_INT_08U_MAX_VAL
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -129,6 +159,15 @@ typedef  CPU_INT16U  NET_MLDP_HOST_GRP_QTY;
 #define  NET_MLDP_HOST_GRP_NBR_MAX                       DEF_INT_16U_MAX_VAL
 
 
+/*
+*********************************************************************************************************
+*                                 MLDP SOURCE FILTER MODE DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT08U  NET_MLDP_FILTER_MODE;
+
+
 /*
 *********************************************************************************************************
 *                                   MLDP HOST GROUP STATE DATA TYPE
@@ -191,12 +230,34 @@ typedef  struct  net_mldp_v1_hdr {
 } NET_MLDP_V1_HDR;
 
 
+/*
+*********************************************************************************************************
+*                                  MLDP HOST GROUP SOURCE DATA TYPE
+*
+* Note(s) : (1) Each source address is listed at most once per host group, in either INCLUDE or EXCLUDE
+*               filter mode (see 'MLDP SOURCE FILTER MODE DEFINES').
+*
+*           (2) The host group's filter mode is EXCLUDE while any-source members remain, in which case
+*               ONLY EXCLUDE sources are reported & filtered; otherwise, the filter mode is INCLUDE &
+*               ONLY INCLUDE sources are reported & accepted.
+*********************************************************************************************************
+*/
+
+typedef  struct  net_mldp_host_grp_src {
+    NET_IPv6_ADDR             AddrSrc;                          /* MLDP   src addr.                                     */
+    NET_MLDP_FILTER_MODE      FilterMode;                       /* MLDP   src filter mode (see Note #1).                */
+    CPU_INT16U                RefCtr;                           /* MLDP   src ref ctr.                                  */
+} NET_MLDP_HOST_GRP_SRC;
+
+
 /*
 *********************************************************************************************************
 *                                IPv6 MULTICAST GROUP DATA TYPES
 *
 * Note(s) : (1) Structure holding the group membership information of a IPv6 multicast address
 *
+*           (2) 'RefCtr' counts ALL host group references, i.e. any-source memberships plus INCLUDE source
+*               references; 'AnySrcRefCtr' counts ONLY the any-source memberships.
 *********************************************************************************************************
 */
 
@@ -209,6 +270,8 @@ struct net_mldp_host_grp {
     NET_MLDP_HOST_GRP        *PrevIF_ListPtr;                   /* Ptr to PREV MLDP host grp of same IF.                */
     NET_MLDP_HOST_GRP        *NextIF_ListPtr;                   /* Ptr to NEXT MLDP host grp of same IF.                */
 
+    NET_MLDP_HOST_GRP        *HashNextPtr;                      /* Ptr to NEXT MLDP host grp in same hash bucket.       */
+
     NET_TMR                  *TmrPtr;                           /* Pointer to MDLP delay timer.                         */
     CPU_INT32U                Delay_ms;                         /* Delay value.                                         */
 
@@ -217,6 +280,11 @@ struct net_mldp_host_grp {
 
     NET_MLDP_HOST_GRP_STATE   State;                            /* MLDP   host grp state.                               */
     CPU_INT16U                RefCtr;                           /* MLDP   host grp ref ctr.                             */
+    CPU_INT16U                AnySrcRefCtr;                     /* MLDP   host grp any-src ref ctr (see Note #2).       */
+
+    CPU_INT08U                SrcNbr;                           /* Nbr of MLDP host grp srcs.                           */
+    NET_MLDP_HOST_GRP_SRC     SrcTbl[NET_MCAST_CFG_SRC_NBR_MAX];/* Tbl of MLDP host grp srcs.                           */
+
     CPU_INT16U                Flags;                            /* MLDP   host grp flags.                               */
 };
 
@@ -261,6 +329,17 @@ CPU_BOOLEAN         NetMLDP_HostGrpLeave        (NET_IF_NBR         if_nbr,
                                                  NET_IPv6_ADDR     *p_addr,
                                                  NET_ERR           *p_err);
 
+CPU_BOOLEAN         NetMLDP_HostGrpSrcAdd       (NET_IF_NBR             if_nbr,
+                                                 NET_IPv6_ADDR         *p_addr_grp,
+                                                 NET_IPv6_ADDR         *p_addr_src,
+                                                 NET_MLDP_FILTER_MODE   filter_mode,
+                                                 NET_ERR               *p_err);
+
+CPU_BOOLEAN         NetMLDP_HostGrpSrcRemove    (NET_IF_NBR         if_nbr,
+                                                 NET_IPv6_ADDR     *p_addr_grp,
+                                                 NET_IPv6_ADDR     *p_addr_src,
+                                                 NET_ERR           *p_err);
+
 
 /*
 *********************************************************************************************************
@@ -278,9 +357,24 @@ CPU_BOOLEAN         NetMLDP_HostGrpLeaveHandler (      NET_IF_NBR         if_nbr
                                                  const NET_IPv6_ADDR     *p_addr,
                                                        NET_ERR           *p_err);
 
+CPU_BOOLEAN         NetMLDP_HostGrpSrcAddHandler    (      NET_IF_NBR             if_nbr,
+                                                     const NET_IPv6_ADDR         *p_addr_grp,
+                                                     const NET_IPv6_ADDR         *p_addr_src,
+                                                           NET_MLDP_FILTER_MODE   filter_mode,
+                                                           NET_ERR               *p_err);
+
+CPU_BOOLEAN         NetMLDP_HostGrpSrcRemoveHandler (      NET_IF_NBR         if_nbr,
+                                                     const NET_IPv6_ADDR     *p_addr_grp,
+                                                     const NET_IPv6_ADDR     *p_addr_src,
+                                                           NET_ERR           *p_err);
+
 CPU_BOOLEAN         NetMLDP_IsGrpJoinedOnIF     (      NET_IF_NBR         if_nbr,
                                                  const NET_IPv6_ADDR     *p_addr_grp);
 
+CPU_BOOLEAN         NetMLDP_IsSrcAllowedOnIF    (      NET_IF_NBR         if_nbr,
+                                                 const NET_IPv6_ADDR     *p_addr_grp,
+                                                 const NET_IPv6_ADDR     *p_addr_src);
+
 void                NetMLDP_Rx                  (      NET_BUF           *p_buf,
                                                        NET_BUF_HDR       *p_buf_hdr,
                                                        NET_MLDP_V1_HDR   *p_ndp_hdr,
@@ -295,6 +389,14 @@ void                NetMLDP_Rx                  (      NET_BUF           *p_buf,
 *********************************************************************************************************
 */
 
+#if     (DEF_CHK_VAL(NET_MCAST_CFG_SRC_NBR_MAX,           \
+                     NET_MLDP_SRC_NBR_MIN,               \
+                     NET_MLDP_SRC_NBR_MAX) != DEF_OK)
+#error  "NET_MCAST_CFG_SRC_NBR_MAX       illegally #define'd in 'net_cfg.h'     "
+#error  "                               [MUST be  >= NET_MLDP_SRC_NBR_MIN     ]"
+#error  "                               [     &&  <= NET_MLDP_SRC_NBR_MAX     ]"
+#endif
+
 
 /*
 *********************************************************************************************************
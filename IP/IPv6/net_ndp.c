@@ -105,6 +105,19 @@
 #define  NET_NDP_IF_NO_MATCH                                 0
 
 
+/*
+*********************************************************************************************************
+*                                  DESTINATION CACHE HASH DEFINES
+*
+* Notes : (1) Destination cache entries are also chained in a hash table indexed on the destination
+*             address so that the lookup done for every transmitted (or forwarded) datagram does not
+*             walk the whole destination cache list.
+*********************************************************************************************************
+*/
+
+#define  NET_NDP_DEST_HASH_TBL_SIZE                          NET_NDP_CFG_DEST_NBR
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -202,6 +215,10 @@ static  NET_NDP_PREFIX            NetNDP_PrefixTbl[NET_NDP_CFG_PREFIX_NBR];
 
 static  NET_NDP_DEST_CACHE        NetNDP_DestTbl[NET_NDP_CFG_DEST_NBR];             /* Destination Cache Table.         */
 
+static  NET_NDP_DEST_CACHE       *NetNDP_DestHashTbl[NET_NDP_DEST_HASH_TBL_SIZE];   /* Destination Cache Hash Table.    */
+
+static  NET_NDP_ROUTE             NetNDP_RouteTbl[NET_NDP_CFG_ROUTE_NBR];           /* Route Table.                     */
+
 static  NET_NDP_ROUTER           *NetNDP_DefaultRouterTbl[NET_IF_NBR_IF_TOT];       /* Default Router Table.            */
 
                                                                                     /* Router pool variables.           */
@@ -220,6 +237,11 @@ static  NET_NDP_DEST_CACHE       *NetNDP_DestListHead;
 static  NET_NDP_DEST_CACHE       *NetNDP_DestListTail;
 static  NET_STAT_POOL             NetNDP_DestPoolStat;
 
+static  NET_NDP_ROUTE            *NetNDP_RoutePoolPtr;
+static  NET_NDP_ROUTE            *NetNDP_RouteListHead;
+static  NET_NDP_ROUTE            *NetNDP_RouteListTail;
+static  NET_STAT_POOL             NetNDP_RoutePoolStat;
+
 static  CPU_INT16U                NetNDP_ReachableTimeout_sec;
 static  NET_TMR_TICK              NetNDP_ReachableTimeout_tick;
 
@@ -394,6 +416,35 @@ static  void                 NetNDP_DestCacheRemove          (       NET_NDP_DES
 
 static  void                 NetNDP_DestCacheClr             (       NET_NDP_DEST_CACHE         *p_dest);
 
+static  CPU_INT16U           NetNDP_DestCacheHash            (const  NET_IPv6_ADDR              *p_addr);
+
+static  NET_NDP_ROUTE       *NetNDP_RouteCfg                 (       NET_IF_NBR                  if_nbr,
+                                                              const  NET_IPv6_ADDR              *p_addr_prefix,
+                                                                     CPU_INT08U                  prefix_len,
+                                                              const  NET_IPv6_ADDR              *p_addr_next_hop,
+                                                                     CPU_INT08U                  type,
+                                                                     NET_ERR                    *p_err);
+
+static  NET_NDP_ROUTE       *NetNDP_RouteGet                 (       NET_ERR                    *p_err);
+
+static  NET_NDP_ROUTE       *NetNDP_RouteSrch                (       NET_IF_NBR                  if_nbr,
+                                                              const  NET_IPv6_ADDR              *p_addr_prefix,
+                                                                     CPU_INT08U                  prefix_len);
+
+static  NET_NDP_ROUTE       *NetNDP_RouteSrchMatchAddr       (       NET_IF_NBR                  if_nbr,
+                                                              const  NET_IPv6_ADDR              *p_addr);
+
+static  void                 NetNDP_RouteRemove              (       NET_NDP_ROUTE              *p_route);
+
+static  void                 NetNDP_RouteClr                 (       NET_NDP_ROUTE              *p_route);
+
+static  CPU_BOOLEAN          NetNDP_RouteIsAddrMatch         (const  NET_IPv6_ADDR              *p_addr,
+                                                              const  NET_IPv6_ADDR              *p_addr_prefix,
+                                                                     CPU_INT08U                  prefix_len);
+
+static  void                 NetNDP_RouteInvalidateDestCache (const  NET_IPv6_ADDR              *p_addr_prefix,
+                                                                     CPU_INT08U                  prefix_len);
+
 static  CPU_BOOLEAN          NetNDP_IsAddrOnLink             (       NET_IF_NBR                  if_nbr,
                                                               const  NET_IPv6_ADDR              *p_addr);
 
@@ -442,7 +493,9 @@ static  void                 NetNDP_RouterAdvSignalPost      (       NET_IF_NBR
 *                   (h) Initialize NDP prefix table.
 *                   (i) Initialize NDP prefix list pointers.
 *                   (j) Initialize NDP destination cache table.
-*                   (k) Initialize NDP destination cache list pointers.
+*                   (k) Initialize NDP destination cache list pointers & hash table.
+*                   (l) Initialize NDP route table.
+*                   (m) Initialize NDP route list pointers.
 *
 *
 * Argument(s) : none.
@@ -463,6 +516,7 @@ void  NetNDP_Init (NET_ERR  *p_err)
     NET_NDP_ROUTER              *p_router;
     NET_NDP_PREFIX              *p_prefix;
     NET_NDP_DEST_CACHE          *p_dest;
+    NET_NDP_ROUTE               *p_route;
     NET_NDP_CACHE_QTY            i;
 
 
@@ -500,6 +554,8 @@ void  NetNDP_Init (NET_ERR  *p_err)
     NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_NDP] = DEF_NULL;
     NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_NDP] = DEF_NULL;
 
+    NetCache_TxQ_PendNbr = 0u;                                  /* Init global pending tx Q cnt.                        */
+
 
                                                                 /* ------------ INIT NDP ROUTER POOL/STATS ------------- */
     NetStat_PoolInit(&NetNDP_RouterPoolStat,
@@ -573,6 +629,8 @@ void  NetNDP_Init (NET_ERR  *p_err)
         p_dest->IF_Nbr     = NET_IF_NBR_NONE;
         p_dest->OnLink     = DEF_NO;
         p_dest->IsValid    = DEF_NO;
+        p_dest->IsDfltRouter = DEF_NO;
+        p_dest->HashNextPtr  = DEF_NULL;
         p_dest->NextPtr    = NetNDP_DestPoolPtr;                /* Free Destination Cache to Destination Cache pool.    */
         NetNDP_DestPoolPtr = p_dest;
         p_dest++;
@@ -582,6 +640,30 @@ void  NetNDP_Init (NET_ERR  *p_err)
     NetNDP_DestListHead = DEF_NULL;
     NetNDP_DestListTail = DEF_NULL;
 
+    for (i = 0u; i < NET_NDP_DEST_HASH_TBL_SIZE; i++) {
+        NetNDP_DestHashTbl[i] = DEF_NULL;
+    }
+
+
+                                                                /* ------------ INIT NDP ROUTE POOL/STATS ------------- */
+    NetStat_PoolInit(&NetNDP_RoutePoolStat,
+                      NET_NDP_CFG_ROUTE_NBR,
+                      p_err);
+
+                                                                /* ----------------- INIT ROUTE TABLE ----------------- */
+    NetNDP_RoutePoolPtr = DEF_NULL;
+    p_route = &NetNDP_RouteTbl[0];
+    for (i = 0u; i < NET_NDP_CFG_ROUTE_NBR; i++) {
+        NetNDP_RouteClr(p_route);
+        p_route->NextPtr    = NetNDP_RoutePoolPtr;              /* Free Route to Route pool.                            */
+        NetNDP_RoutePoolPtr = p_route;
+        p_route++;
+    }
+
+                                                                /* --------------- INIT ROUTE LIST PTRS --------------- */
+    NetNDP_RouteListHead = DEF_NULL;
+    NetNDP_RouteListTail = DEF_NULL;
+
 
    *p_err = NET_NDP_ERR_NONE;
 }
@@ -676,8 +758,6 @@ void   NetNDP_NeighborCacheHandler (const  NET_BUF  *p_buf,
     NET_BUF_HDR             *p_buf_hdr;
     CPU_INT08U              *p_addr_hw;
     CPU_INT08U              *p_addr_protocol;
-    NET_BUF_HDR             *p_tail_buf_hdr;
-    NET_BUF                 *p_tail_buf;
     NET_CACHE_ADDR_NDP      *p_cache_addr_ndp;
     NET_ICMPv6_HDR          *p_icmp_hdr;
     NET_NDP_NEIGHBOR_CACHE  *p_cache;
@@ -752,31 +832,16 @@ void   NetNDP_NeighborCacheHandler (const  NET_BUF  *p_buf,
                  buf_max_th = NetNDP_CacheTxQ_MaxTh_nbr;
                  CPU_CRITICAL_EXIT();
 
-                 if (p_cache_addr_ndp->TxQ_Nbr >= buf_max_th) {
-                    *p_err = NET_CACHE_ERR_UNRESOLVED;
+                                                                /* Q buf to NDP cache's bounded pending tx Q.           */
+                 NetCache_TxQ_Add((NET_CACHE_ADDR *)p_cache_addr_ndp,
+                                  (NET_BUF        *)p_buf,
+                                                    buf_max_th,
+                                                    p_err);
+                 if (*p_err != NET_CACHE_ERR_NONE) {
                      return;
                  }
 
-                 p_tail_buf = p_cache_addr_ndp->TxQ_Tail;
-                 if (p_tail_buf != (NET_BUF *)0) {              /* If Q NOT empty,    append buf @ Q tail.              */
-                     p_tail_buf_hdr                 = &p_tail_buf->Hdr;
-                     p_tail_buf_hdr->NextSecListPtr = (NET_BUF *)p_buf;
-                     p_buf_hdr->PrevSecListPtr      = (NET_BUF *)p_tail_buf;
-                     p_cache_addr_ndp->TxQ_Tail     = (NET_BUF *)p_buf;
-
-                 } else {                                       /* Else add buf as first q'd buf.                       */
-                     p_cache_addr_ndp->TxQ_Head     = (NET_BUF *)p_buf;
-                     p_cache_addr_ndp->TxQ_Tail     = (NET_BUF *)p_buf;
-#if 0                                                           /* Init'd in NetBuf_Get() [see Note #5].                */
-                     p_buf_hdr->PrevSecListPtr      = (NET_BUF *)0;
-                     p_buf_hdr->NextSecListPtr      = (NET_BUF *)0;
-#endif
-                 }
-                                                                /* Cfg buf's unlink fnct/obj to NDP cache.              */
-                 p_buf_hdr->UnlinkFnctPtr = (NET_BUF_FNCT)&NetCache_UnlinkBuf;
-                 p_buf_hdr->UnlinkObjPtr  = (void       *) p_cache_addr_ndp;
-
-                *p_err                    =  NET_NDP_ERR_NEIGHBOR_CACHE_PEND;
+                *p_err = NET_NDP_ERR_NEIGHBOR_CACHE_PEND;
                  goto exit;
 
 
@@ -1110,6 +1175,7 @@ const  NET_IPv6_ADDR  *NetNDP_NextHopByIF (       NET_IF_NBR      if_nbr,
 {
     NET_NDP_DEST_CACHE  *p_dest_cache;
     NET_NDP_ROUTER      *p_router;
+    NET_NDP_ROUTE       *p_route;
     NET_IPv6_ADDR       *p_addr_nexthop;
     CPU_BOOLEAN          on_link;
     CPU_BOOLEAN          addr_mcast;
@@ -1153,24 +1219,41 @@ const  NET_IPv6_ADDR  *NetNDP_NextHopByIF (       NET_IF_NBR      if_nbr,
             return ((NET_IPv6_ADDR *)0);
         }
     }
+                                                                /* ------------ CHECK FOR MATCHING ROUTE ------------- */
+    p_route = NetNDP_RouteSrchMatchAddr(if_nbr, p_addr_dest);
                                                                 /* ---------- CHECK IF DESTINAION IS ON LINK ---------- */
-    on_link = NetNDP_IsAddrOnLink(if_nbr,
-                                  p_addr_dest);
+    if (p_route != (NET_NDP_ROUTE *)0) {
+        on_link = p_route->OnLink;
+    } else {
+        on_link = NetNDP_IsAddrOnLink(if_nbr,
+                                      p_addr_dest);
+    }
     if (on_link == DEF_YES) {
-        p_dest_cache->IsValid = DEF_YES;
-        p_dest_cache->OnLink  = DEF_YES;
+        p_dest_cache->IsValid      = DEF_YES;
+        p_dest_cache->OnLink       = DEF_YES;
+        p_dest_cache->IsDfltRouter = DEF_NO;
         Mem_Copy(&p_dest_cache->AddrNextHop, p_addr_dest, NET_IPv6_ADDR_SIZE);
        *p_err = NET_NDP_ERR_TX_DEST_HOST_THIS_NET;
         return (p_addr_dest);
     }
 
+    if (p_route != (NET_NDP_ROUTE *)0) {                        /* Route next-hop takes precedence over dflt router.    */
+        p_dest_cache->IsValid      = DEF_YES;
+        p_dest_cache->OnLink       = DEF_NO;
+        p_dest_cache->IsDfltRouter = DEF_NO;
+        Mem_Copy(&p_dest_cache->AddrNextHop, &p_route->AddrNextHop, NET_IPv6_ADDR_SIZE);
+       *p_err = NET_NDP_ERR_TX_DFLT_GATEWAY;
+        return (&p_dest_cache->AddrNextHop);
+    }
+
                                                                 /* ------------- CHECK FOR ROUTER ON LINK ------------- */
     dflt_router = NetNDP_RouterDfltGet(if_nbr, &p_router, p_err);
     switch (*p_err) {
         case NET_NDP_ERR_NONE:
              if (dflt_router == DEF_YES) {
-                 p_dest_cache->IsValid = DEF_YES;
-                 p_dest_cache->OnLink  = DEF_NO;
+                 p_dest_cache->IsValid      = DEF_YES;
+                 p_dest_cache->OnLink       = DEF_NO;
+                 p_dest_cache->IsDfltRouter = DEF_YES;
                 *p_err = NET_NDP_ERR_TX_DFLT_GATEWAY;
              } else {
                  p_dest_cache->IsValid = DEF_NO;
@@ -1261,6 +1344,7 @@ const  NET_IPv6_ADDR  *NetNDP_NextHop (       NET_IF_NBR     *p_if_nbr,
            NET_NDP_DEST_CACHE  *p_dest;
            NET_NDP_DEST_CACHE  *p_dest_tmp;
            NET_NDP_ROUTER      *p_router;
+           NET_NDP_ROUTE       *p_route;
     const  NET_IPv6_ADDR       *p_addr_nexthop;
            NET_IPv6_ADDR       *p_addr_nexthop_tmp;
            NET_IF_NBR           if_nbr_tmp;
@@ -1345,13 +1429,23 @@ const  NET_IPv6_ADDR  *NetNDP_NextHop (       NET_IF_NBR     *p_if_nbr,
                 add_dest_tmp = DEF_NO;
             }
 
+                                                                /* ---------- CHECK FOR MATCHING ROUTE ON IF ---------- */
+            p_route = NetNDP_RouteSrchMatchAddr(if_nbr_tmp, p_addr_dest);
                                                                 /* --------- CHECK IF DESTINATION IS ON LINK ---------- */
-            on_link = NetNDP_IsAddrOnLink(if_nbr_tmp,
-                                          p_addr_dest);
+            if (p_route != (NET_NDP_ROUTE *)0) {
+                on_link = p_route->OnLink;
+            } else {
+                on_link = NetNDP_IsAddrOnLink(if_nbr_tmp,
+                                              p_addr_dest);
+            }
             if (on_link == DEF_YES) {
                 valid_nbr_current  = NET_NDP_IF_DEST_ON_LINK;
                 p_addr_nexthop_tmp = (NET_IPv6_ADDR *)p_addr_dest;
 
+            } else if (p_route != (NET_NDP_ROUTE *)0) {
+                valid_nbr_current  = NET_NDP_IF_DFLT_ROUTER_ON_LINK;
+                p_addr_nexthop_tmp = &p_route->AddrNextHop;
+
             } else {
                                                                 /* ------------ CHECK FOR ROUTER ON LINK -------------- */
                 if (NetNDP_DefaultRouterTbl[if_nbr_tmp] == (NET_NDP_ROUTER *)0) {
@@ -1415,8 +1509,9 @@ const  NET_IPv6_ADDR  *NetNDP_NextHop (       NET_IF_NBR     *p_if_nbr,
 
         case NET_NDP_IF_DFLT_ROUTER_ON_LINK_WITH_SRC_ADDR_CFGD:
         case NET_NDP_IF_DFLT_ROUTER_ON_LINK:
-             p_dest->IsValid = DEF_YES;
-             p_dest->OnLink  = DEF_NO;
+             p_dest->IsValid      = DEF_YES;
+             p_dest->OnLink       = DEF_NO;
+             p_dest->IsDfltRouter = DEF_YES;
             *p_err = NET_NDP_ERR_TX_DFLT_GATEWAY;
              break;
 
@@ -1443,6 +1538,100 @@ const  NET_IPv6_ADDR  *NetNDP_NextHop (       NET_IF_NBR     *p_if_nbr,
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetNDP_NextHopFwd()
+*
+* Description : Find Next Hop and the outgoing Interface for a datagram to forward.
+*
+* Argument(s) : p_if_nbr        Pointer to variable that will receive the outgoing interface number.
+*
+*               p_addr_dest     Pointer to IPv6 destination address of the datagram to forward.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_NDP_ERR_TX_DEST_HOST_THIS_NET   Destination is on-link on outgoing IF.
+*                               NET_NDP_ERR_TX_DFLT_GATEWAY         Next-hop is a router.
+*                               NET_NDP_ERR_TX_NO_NEXT_HOP          No route to destination.
+*
+* Return(s)   : Pointer to the next-hop IPv6 address, if route found.
+*
+*               Pointer to NULL,                      otherwise.
+*
+* Caller(s)   : NetIPv6_RxPktFwd().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) The Destination cache is searched first on every interface & serves as the route
+*                   cache in front of the Route table. Entries whose next-hop was selected from the
+*                   default router list by the host transmit path are skipped (see Note #2).
+*
+*               (2) On a Destination cache miss, the longest prefix match of the Route table is used &
+*                   the result is stored in the Destination cache. The default router list is NOT used
+*                   to forward datagrams; a default route ('::/0') MUST be configured instead.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_IPv6_FWD_MODULE_EN
+const  NET_IPv6_ADDR  *NetNDP_NextHopFwd (       NET_IF_NBR     *p_if_nbr,
+                                          const  NET_IPv6_ADDR  *p_addr_dest,
+                                                 NET_ERR        *p_err)
+{
+           NET_NDP_DEST_CACHE  *p_dest_cache;
+           NET_NDP_ROUTE       *p_route;
+    const  NET_IPv6_ADDR       *p_addr_nexthop;
+           NET_ERR              err;
+
+
+   *p_if_nbr = NET_IF_NBR_NONE;
+
+                                                                /* --- CHECK FOR DEST CACHE ENTRY (see Note #1) ------- */
+    p_dest_cache = NetNDP_DestCacheSrch(NET_IF_NBR_WILDCARD, p_addr_dest, &err);
+    if ((p_dest_cache               != (NET_NDP_DEST_CACHE *)0) &&
+        (p_dest_cache->IsValid      == DEF_YES)                 &&
+        (p_dest_cache->IsDfltRouter == DEF_NO)) {
+       *p_if_nbr = p_dest_cache->IF_Nbr;
+        if (p_dest_cache->OnLink == DEF_YES) {
+           *p_err = NET_NDP_ERR_TX_DEST_HOST_THIS_NET;
+        } else {
+           *p_err = NET_NDP_ERR_TX_DFLT_GATEWAY;
+        }
+        return (&p_dest_cache->AddrNextHop);
+    }
+
+                                                                /* ------ SRCH ROUTE TABLE (see Note #2) -------------- */
+    p_route = NetNDP_RouteSrchMatchAddr(NET_IF_NBR_WILDCARD, p_addr_dest);
+    if (p_route == (NET_NDP_ROUTE *)0) {
+       *p_err = NET_NDP_ERR_TX_NO_NEXT_HOP;
+        return ((NET_IPv6_ADDR *)0);
+    }
+
+    if (p_route->OnLink == DEF_YES) {
+        p_addr_nexthop =  p_addr_dest;
+       *p_err          =  NET_NDP_ERR_TX_DEST_HOST_THIS_NET;
+    } else {
+        p_addr_nexthop = &p_route->AddrNextHop;
+       *p_err          =  NET_NDP_ERR_TX_DFLT_GATEWAY;
+    }
+   *p_if_nbr = p_route->IF_Nbr;
+
+                                                                /* ------------- UPDATE DESTINATION CACHE ------------- */
+    if (p_dest_cache != (NET_NDP_DEST_CACHE *)0) {              /* Replace invalid or dflt router entry (see Note #1).  */
+        NetNDP_DestCacheRemove(p_dest_cache);
+    }
+
+   (void)NetNDP_DestCacheCfg(p_route->IF_Nbr,                   /* Failure only skips caching of the result.            */
+                             p_addr_dest,
+                             p_addr_nexthop,
+                             DEF_YES,
+                             p_route->OnLink,
+                            &err);
+
+    return (p_addr_nexthop);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   NetNDP_CfgNeighborCacheTimeout()
@@ -1726,6 +1915,231 @@ CPU_BOOLEAN  NetNDP_CfgCacheTxQ_MaxTh (NET_BUF_QTY  nbr_buf_max)
 }
 
 
+/*
+*********************************************************************************************************
+*                                        NetNDP_CfgRouteAdd()
+*
+* Description : Add a static route to the NDP Route table.
+*
+* Argument(s) : if_nbr              Interface number through which the destinations are reached.
+*
+*               p_addr_prefix       Pointer to IPv6 route prefix.
+*
+*               prefix_len          Route prefix length (see Note #1).
+*
+*               p_addr_next_hop     Pointer to IPv6 Next-Hop address (see Note #2) :
+*
+*                                       DEF_NULL    Destinations are on-link on the interface.
+*                                       Address     Router used to reach the destinations.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_NDP_ERR_NONE                Route successfully added.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_addr_prefix' passed a NULL pointer.
+*                               NET_NDP_ERR_INVALID_PREFIX      Invalid prefix length.
+*                               NET_NDP_ERR_INVALID_ARG         Invalid Next-Hop address.
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
+*
+*                                                               ------ RETURNED BY NetNDP_RouteCfg() : ------
+*                               NET_NDP_ERR_ROUTE_NONE_AVAIL    NO available route to allocate.
+*
+*                                                               - RETURNED BY NetIF_IsValidCfgdHandler() : -
+*                               See NetIF_IsValidCfgdHandler() for additional error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) The route prefix is masked by the prefix length. A prefix length of zero configures
+*                   a default route ('::/0').
+*
+*               (2) RFC #4861, Section 8 states that "a router MUST be able to determine the link-local
+*                   address for each of its neighboring routers". The Next-Hop address SHOULD therefore
+*                   be the link-local address of the router.
+*
+*               (3) Routes are used to select the next-hop of both locally transmitted & forwarded
+*                   datagrams. Routes take precedence over the default router list.
+*********************************************************************************************************
+*/
+
+void  NetNDP_CfgRouteAdd (       NET_IF_NBR      if_nbr,
+                          const  NET_IPv6_ADDR  *p_addr_prefix,
+                                 CPU_INT08U      prefix_len,
+                          const  NET_IPv6_ADDR  *p_addr_next_hop,
+                                 NET_ERR        *p_err)
+{
+    NET_IPv6_ADDR  addr_prefix;
+    CPU_INT08U     nbr_octets;
+    CPU_INT08U     nbr_bits;
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    CPU_BOOLEAN    addr_unspecified;
+    CPU_BOOLEAN    addr_mcast;
+#endif
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_addr_prefix == DEF_NULL) {
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        goto exit_fault;
+    }
+
+    if (prefix_len > NET_IPv6_ADDR_PREFIX_LEN_MAX) {
+       *p_err = NET_NDP_ERR_INVALID_PREFIX;
+        goto exit_fault;
+    }
+
+    if (p_addr_next_hop != DEF_NULL) {
+        addr_unspecified = NetIPv6_IsAddrUnspecified(p_addr_next_hop);
+        addr_mcast       = NetIPv6_IsAddrMcast(p_addr_next_hop);
+        if ((addr_unspecified == DEF_YES) ||
+            (addr_mcast       == DEF_YES)) {
+           *p_err = NET_NDP_ERR_INVALID_ARG;
+            goto exit_fault;
+        }
+    }
+#endif
+
+                                                                /* ------------ MASK PREFIX (see Note #1) ------------- */
+    Mem_Clr(&addr_prefix, NET_IPv6_ADDR_SIZE);
+    nbr_octets = prefix_len / DEF_OCTET_NBR_BITS;
+    nbr_bits   = prefix_len % DEF_OCTET_NBR_BITS;
+    Mem_Copy(&addr_prefix, p_addr_prefix, nbr_octets);
+    if (nbr_bits != 0u) {
+        addr_prefix.Addr[nbr_octets] = p_addr_prefix->Addr[nbr_octets] &
+                                       (CPU_INT08U)(DEF_OCTET_MASK << (DEF_OCTET_NBR_BITS - nbr_bits));
+    }
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetNDP_CfgRouteAdd, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_fault;
+    }
+
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        goto exit_release;
+    }
+
+                                                                /* ----------------- VALIDATE IF NBR ------------------ */
+    NetIF_IsValidCfgdHandler(if_nbr, p_err);
+    if (*p_err != NET_IF_ERR_NONE) {
+         goto exit_release;
+    }
+
+                                                                /* -------------------- ADD ROUTE --------------------- */
+   (void)NetNDP_RouteCfg(if_nbr,
+                        &addr_prefix,
+                         prefix_len,
+                         p_addr_next_hop,
+                         NET_NDP_ROUTE_TYPE_STATIC,
+                         p_err);
+
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+
+exit_fault:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetNDP_CfgRouteRemove()
+*
+* Description : Remove a route from the NDP Route table.
+*
+* Argument(s) : if_nbr          Interface number of the route to remove.
+*
+*               p_addr_prefix   Pointer to IPv6 route prefix.
+*
+*               prefix_len      Route prefix length.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_NDP_ERR_NONE                Route successfully removed.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_addr_prefix' passed a NULL pointer.
+*                               NET_NDP_ERR_INVALID_PREFIX      Invalid prefix length.
+*                               NET_NDP_ERR_ROUTE_NOT_FOUND     Route NOT found in Route table.
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
+*
+*                                                               - RETURNED BY NetIF_IsValidCfgdHandler() : -
+*                               See NetIF_IsValidCfgdHandler() for additional error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) The route prefix MUST be given as configured with NetNDP_CfgRouteAdd() (i.e. masked
+*                   by the prefix length).
+*********************************************************************************************************
+*/
+
+void  NetNDP_CfgRouteRemove (       NET_IF_NBR      if_nbr,
+                             const  NET_IPv6_ADDR  *p_addr_prefix,
+                                    CPU_INT08U      prefix_len,
+                                    NET_ERR        *p_err)
+{
+    NET_NDP_ROUTE  *p_route;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_addr_prefix == DEF_NULL) {
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        goto exit_fault;
+    }
+
+    if (prefix_len > NET_IPv6_ADDR_PREFIX_LEN_MAX) {
+       *p_err = NET_NDP_ERR_INVALID_PREFIX;
+        goto exit_fault;
+    }
+#endif
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetNDP_CfgRouteRemove, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_fault;
+    }
+
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        goto exit_release;
+    }
+
+                                                                /* ----------------- VALIDATE IF NBR ------------------ */
+    NetIF_IsValidCfgdHandler(if_nbr, p_err);
+    if (*p_err != NET_IF_ERR_NONE) {
+         goto exit_release;
+    }
+
+                                                                /* ------------------- REMOVE ROUTE ------------------- */
+    p_route = NetNDP_RouteSrch(if_nbr, p_addr_prefix, prefix_len);
+    if (p_route == (NET_NDP_ROUTE *)0) {
+       *p_err = NET_NDP_ERR_ROUTE_NOT_FOUND;
+        goto exit_release;
+    }
+
+    NetNDP_RouteRemove(p_route);
+
+   *p_err = NET_NDP_ERR_NONE;
+
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+
+exit_fault:
+    return;
+}
+
+
 /*
 *********************************************************************************************************
 *                                         NetNDP_CacheTimeout()
@@ -3754,7 +4168,6 @@ static  void  NetNDP_RxNeighborAdvertisement (const  NET_BUF                   *
     NET_NDP_OPT_HW_ADDR_HDR  *p_ndp_opt_hw_addr_hdr = DEF_NULL;
     NET_IPv6_HDR             *p_ip_hdr;
     NET_IPv6_ADDRS           *p_ipv6_addrs;
-    NET_BUF                  *p_buf_head;
     CPU_INT08U               *p_ndp_opt;
     NET_NDP_OPT_TYPE          opt_type;
     NET_NDP_OPT_LEN           opt_len;
@@ -3959,14 +4372,9 @@ static  void  NetNDP_RxNeighborAdvertisement (const  NET_BUF                   *
             p_cache_ndp->ReqAttemptsCtr = 0;
 
                                                                 /* See Note #3b2D.                                      */
-            p_buf_head                  =  p_cache_addr_ndp->TxQ_Head;
-            p_cache_addr_ndp->TxQ_Head  = (NET_BUF *)0;
-            p_cache_addr_ndp->TxQ_Tail  = (NET_BUF *)0;
-            p_cache_addr_ndp->TxQ_Nbr   = 0;
-
-            NetCache_TxPktHandler(NET_PROTOCOL_TYPE_NDP,
-                                  p_buf_head,
-                                 &p_ndp_opt_hw_addr_hdr->Addr[0]);
+            NetCache_TxQ_Flush(                  NET_PROTOCOL_TYPE_NDP,
+                               (NET_CACHE_ADDR *)p_cache_addr_ndp,
+                                                &p_ndp_opt_hw_addr_hdr->Addr[0]);
         } else {                                                /* See Note #3b1.                                       */
             *p_err = NET_NDP_ERR_OPT_TYPE;
              return;
@@ -4645,6 +5053,7 @@ exit:
 *
 *                   (a) Search Prefix List
 *                   (b) Update or add Prefix entry
+*                   (c) Add on-link Prefix to the Route table
 *
 *
 * Argument(s) : if_nbr          Interface number the packet was received from.
@@ -4689,6 +5098,7 @@ static  void  NetNDP_RxPrefixHandler (       NET_IF_NBR      if_nbr,
     NET_NDP_PREFIX      *p_prefix;
     NET_IPv6_ADDR        addr_masked;
     NET_TMR_TICK         timeout_tick;
+    NET_ERR              err;
 
 
                                                                 /* Insure that the received prefix is consistent ...    */
@@ -4753,7 +5163,18 @@ static  void  NetNDP_RxPrefixHandler (       NET_IF_NBR      if_nbr,
                                 NetNDP_PrefixTimeout,
                                 timeout_tick,
                                 p_err);
+    if (*p_err != NET_NDP_ERR_NONE) {
+         return;
+    }
 
+    if (on_link == DEF_YES) {                               /* Add on-link prefix to the route table.               */
+       (void)NetNDP_RouteCfg(if_nbr,
+                            &addr_masked,
+                             prefix_len,
+                             DEF_NULL,
+                             NET_NDP_ROUTE_TYPE_PREFIX,
+                            &err);
+    }
 }
 
 
@@ -5386,6 +5807,8 @@ static  void  NetNDP_RemovePrefixDestCache (       NET_IF_NBR   if_nbr,
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_CACHE_ERR_PEND              NDP cache added in 'PENDING' state.
+*                               NET_CACHE_ERR_UNRESOLVED        NDP cache added in 'PENDING' state but
+*                                                                   buffer NOT enqueued (see Note #5).
 *
 *                                                               - RETURNED BY NetNDP_NeighborCacheAddEntry() : -
 *                               NET_CACHE_ERR_NONE_AVAIL        NO available NDP caches to allocate.
@@ -5416,6 +5839,10 @@ static  void  NetNDP_RemovePrefixDestCache (       NET_IF_NBR   if_nbr,
 *               (4) Some buffer controls were previously initialized in NetBuf_Get() when the packet
 *                   was received at the network interface layer.  These buffer controls do NOT need
 *                   to be re-initialized but are shown for completeness.
+*
+*               (5) If the global pending transmit buffer maximum is reached, the NDP cache is still
+*                   added & the Neighbor Solicitation still transmitted, but the buffer is NOT enqueued
+*                   & MUST be discarded by the caller (see 'net_cache.c  NetCache_TxQ_Add()  Note #3b').
 *********************************************************************************************************
 */
 
@@ -5432,6 +5859,8 @@ static  void  NetNDP_NeighborCacheAddPend (const  NET_BUF      *p_buf,
     NET_NDP_OPT_HW_ADDR_HDR   ndp_opt_hw_addr_hdr;
     CPU_INT08U                hw_addr[NET_IP_HW_ADDR_LEN];
     CPU_INT08U                hw_addr_len;
+    NET_BUF_QTY               buf_max_th;
+    NET_ERR                   err_q;
     CPU_SR_ALLOC();
 
 
@@ -5459,18 +5888,18 @@ static  void  NetNDP_NeighborCacheAddPend (const  NET_BUF      *p_buf,
         return;
     }
 
-                                                                /* Cfg buf's unlink fnct/obj to NDP cache.              */
-    p_buf_hdr->UnlinkFnctPtr  = (NET_BUF_FNCT)NetCache_UnlinkBuf;
-    p_buf_hdr->UnlinkObjPtr   = (void       *)p_cache_addr_ndp;
-
 #if 0                                                           /* Init'd in NetBuf_Get() [see Note #4].                */
     p_buf_hdr->PrevSecListPtr = (NET_BUF *)0;
     p_buf_hdr->NextSecListPtr = (NET_BUF *)0;
 #endif
                                                                 /* Q buf to NDP cache (see Note #3a1).                  */
-    p_cache_addr_ndp->TxQ_Head    = (NET_BUF *)p_buf;
-    p_cache_addr_ndp->TxQ_Tail    = (NET_BUF *)p_buf;
-    p_cache_addr_ndp->TxQ_Nbr++;
+    CPU_CRITICAL_ENTER();
+    buf_max_th = NetNDP_CacheTxQ_MaxTh_nbr;
+    CPU_CRITICAL_EXIT();
+    NetCache_TxQ_Add((NET_CACHE_ADDR *)p_cache_addr_ndp,
+                     (NET_BUF        *)p_buf,
+                                       buf_max_th,
+                                      &err_q);
                                                                 /* -------------------- TX NDP REQ -------------------- */
                                                                 /* Tx Neighbor Solicitation msg to resolve NDP cache.   */
 
@@ -5496,6 +5925,11 @@ static  void  NetNDP_NeighborCacheAddPend (const  NET_BUF      *p_buf,
     p_cache_ndp = (NET_NDP_NEIGHBOR_CACHE *)p_cache_addr_ndp->ParentPtr;
     p_cache_ndp->ReqAttemptsCtr++;                              /* Inc req attempts ctr.                                */
 
+    if (err_q != NET_CACHE_ERR_NONE) {                          /* If buf NOT q'd, rtn err to discard buf (see Note #5).*/
+       *p_err = NET_CACHE_ERR_UNRESOLVED;
+        return;
+    }
+
    *p_err = NET_NDP_ERR_NEIGHBOR_CACHE_PEND;
 }
 
@@ -6612,8 +7046,9 @@ static  NET_NDP_PREFIX  *NetNDP_PrefixGet(NET_ERR  *p_err)
 *
 * Description : (1) Remove a prefix from the prefix list.
 *
-*                   (a) Unlink prefix from prefix list.
-*                   (b) Free prefix entry.
+*                   (a) Remove on-link route learned from prefix.
+*                   (b) Unlink prefix from prefix list.
+*                   (c) Free prefix entry.
 *
 *
 * Argument(s) : p_prefix    Pointer to the Prefix entry to remove from the Prefix list.
@@ -6639,6 +7074,7 @@ static  void  NetNDP_PrefixRemove(NET_NDP_PREFIX  *p_prefix,
 {
     NET_NDP_PREFIX  *p_prefix_next;
     NET_NDP_PREFIX  *p_prefix_prev;
+    NET_NDP_ROUTE   *p_route;
     NET_ERR          err;
 
 
@@ -6649,6 +7085,15 @@ static  void  NetNDP_PrefixRemove(NET_NDP_PREFIX  *p_prefix,
     }
 #endif
 
+                                                                /* -------------- REMOVE ON-LINK ROUTE ---------------- */
+    p_route = NetNDP_RouteSrch(p_prefix->IF_Nbr,
+                              &p_prefix->Prefix,
+                               p_prefix->PrefixLen);
+    if ((p_route       != (NET_NDP_ROUTE *)0)         &&
+        (p_route->Type == NET_NDP_ROUTE_TYPE_PREFIX)) {
+        NetNDP_RouteRemove(p_route);
+    }
+
     p_prefix_prev = p_prefix->PrevPtr;
     p_prefix_next = p_prefix->NextPtr;
 
@@ -6785,6 +7230,7 @@ static NET_NDP_DEST_CACHE  *NetNDP_DestCacheCfg (       NET_IF_NBR      if_nbr,
                                                         NET_ERR        *p_err)
 {
     NET_NDP_DEST_CACHE *p_dest;
+    CPU_INT16U          hash_ix;
 
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
     if (p_addr_dest == (NET_IPv6_ADDR *)0) {
@@ -6800,9 +7246,10 @@ static NET_NDP_DEST_CACHE  *NetNDP_DestCacheCfg (       NET_IF_NBR      if_nbr,
 
 
                                                                 /* -------------- CFG DESTINATION ENTRY --------------- */
-    p_dest->IF_Nbr  = if_nbr;
-    p_dest->IsValid = is_valid;
-    p_dest->OnLink  = on_link;
+    p_dest->IF_Nbr       = if_nbr;
+    p_dest->IsValid      = is_valid;
+    p_dest->OnLink       = on_link;
+    p_dest->IsDfltRouter = DEF_NO;
 
     Mem_Copy(&p_dest->AddrDest, p_addr_dest, NET_IPv6_ADDR_SIZE);
 
@@ -6810,6 +7257,11 @@ static NET_NDP_DEST_CACHE  *NetNDP_DestCacheCfg (       NET_IF_NBR      if_nbr,
         Mem_Copy(&p_dest->AddrNextHop, p_addr_next_hop, NET_IPv6_ADDR_SIZE);
     }
 
+                                                                /* ------- INSERT DESTINATION INTO HASH CHAIN --------- */
+    hash_ix                     = NetNDP_DestCacheHash(p_addr_dest);
+    p_dest->HashNextPtr         = NetNDP_DestHashTbl[hash_ix];
+    NetNDP_DestHashTbl[hash_ix] = p_dest;
+
 
    *p_err = NET_NDP_ERR_NONE;
 
@@ -6900,7 +7352,7 @@ static  NET_NDP_DEST_CACHE  *NetNDP_DestCacheGet(NET_ERR  *p_err)
 *
 * Description : Search for a matching Destination entry for the given address into the Destination Cache.
 *
-* Argument(s) : if_nbr      Interface number of the destination to look for.
+* Argument(s) : if_nbr      Interface number of the destination to look for (see Note #2).
 *
 *               p_addr      Pointer to the ipv6 address to look for in the Destination Cache.
 *
@@ -6913,9 +7365,14 @@ static  NET_NDP_DEST_CACHE  *NetNDP_DestCacheGet(NET_ERR  *p_err)
 *
 * Caller(s)   : NetNDP_NextHop(),
 *               NetNDP_NextHopByIF(),
+*               NetNDP_NextHopFwd(),
 *               NetNDP_RxRedirect().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Only the hash chain of the destination address is searched (see 'DESTINATION CACHE
+*                   HASH DEFINES  Note #1').
+*
+*               (2) If 'if_nbr' is NET_IF_NBR_WILDCARD, the first destination entry matching the address
+*                   on any interface is returned.
 *********************************************************************************************************
 */
 
@@ -6929,12 +7386,13 @@ static  NET_NDP_DEST_CACHE  *NetNDP_DestCacheSrch (       NET_IF_NBR      if_nbr
 
 
     found  =  DEF_NO;
-    p_dest = NetNDP_DestListHead;
+    p_dest = NetNDP_DestHashTbl[NetNDP_DestCacheHash(p_addr)];
 
-    while ((p_dest != (NET_NDP_DEST_CACHE *)0) &&               /* Srch Destination Cache List ...                      */
+    while ((p_dest != (NET_NDP_DEST_CACHE *)0) &&               /* Srch Destination hash chain ...                      */
            (found  ==  DEF_NO)                ) {               /* ... until cache found.                               */
 
-        if (p_dest->IF_Nbr == if_nbr) {
+        if ((if_nbr         == NET_IF_NBR_WILDCARD) ||
+            (p_dest->IF_Nbr == if_nbr)) {
 
             p_dest_addr = &p_dest->AddrDest.Addr[0];
                                                                 /* Cmp address with Destination cache address.          */
@@ -6948,7 +7406,7 @@ static  NET_NDP_DEST_CACHE  *NetNDP_DestCacheSrch (       NET_IF_NBR      if_nbr
             }
         }
 
-        p_dest = p_dest->NextPtr;                               /* Advertise to next Destination cache.                 */
+        p_dest = p_dest->HashNextPtr;                           /* Advertise to next Destination cache.                 */
     }
 
    *p_err  =  NET_NDP_ERR_DESTINATION_NOT_FOUND;
@@ -7009,7 +7467,7 @@ static  NET_NDP_DEST_CACHE  *NetNDP_DestCacheSrchInvalid(NET_ERR  *p_err)
 *
 * Description : (1) Remove a Destination cache entry from the Destination Cache.
 *
-*                   (a) Unlink destination entry from list
+*                   (a) Unlink destination entry from list & hash chain
 *                   (b) Free destination entry
 *
 *
@@ -7027,6 +7485,7 @@ static  void  NetNDP_DestCacheRemove(NET_NDP_DEST_CACHE  *p_dest)
 {
     NET_NDP_DEST_CACHE  *p_dest_next;
     NET_NDP_DEST_CACHE  *p_dest_prev;
+    NET_NDP_DEST_CACHE **p_hash_link;
     NET_ERR              err;
 
 
@@ -7054,6 +7513,17 @@ static  void  NetNDP_DestCacheRemove(NET_NDP_DEST_CACHE  *p_dest)
         NetNDP_DestListTail  = p_dest_prev;
     }
 
+                                                                /* --------- UNLINK DEST ENTRY FROM HASH CHAIN -------- */
+    p_hash_link = &NetNDP_DestHashTbl[NetNDP_DestCacheHash(&p_dest->AddrDest)];
+    while (*p_hash_link != (NET_NDP_DEST_CACHE *)0) {
+        if (*p_hash_link == p_dest) {
+            *p_hash_link = p_dest->HashNextPtr;
+             break;
+        }
+        p_hash_link = &(*p_hash_link)->HashNextPtr;
+    }
+    p_dest->HashNextPtr = (NET_NDP_DEST_CACHE *)0;
+
 #if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)                     /* Clear Destination entry pointers.                    */
     p_dest->PrevPtr = (NET_NDP_DEST_CACHE *)0;
     p_dest->NextPtr = (NET_NDP_DEST_CACHE *)0;
@@ -7100,13 +7570,15 @@ static  void  NetNDP_DestCacheClr(NET_NDP_DEST_CACHE  *p_dest)
     }
 #endif
 
-    p_dest->PrevPtr = (NET_NDP_DEST_CACHE *)0;
-    p_dest->NextPtr = (NET_NDP_DEST_CACHE *)0;
+    p_dest->PrevPtr     = (NET_NDP_DEST_CACHE *)0;
+    p_dest->NextPtr     = (NET_NDP_DEST_CACHE *)0;
+    p_dest->HashNextPtr = (NET_NDP_DEST_CACHE *)0;
 
     p_dest->IF_Nbr = NET_IF_NBR_NONE;
 
-    p_dest->IsValid = DEF_NO;
-    p_dest->OnLink  = DEF_NO;
+    p_dest->IsValid      = DEF_NO;
+    p_dest->OnLink       = DEF_NO;
+    p_dest->IsDfltRouter = DEF_NO;
 
     Mem_Clr(&p_dest->AddrDest, NET_IPv6_ADDR_SIZE);
     Mem_Clr(&p_dest->AddrNextHop, NET_IPv6_ADDR_SIZE);
@@ -7114,6 +7586,497 @@ static  void  NetNDP_DestCacheClr(NET_NDP_DEST_CACHE  *p_dest)
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetNDP_DestCacheHash()
+*
+* Description : Compute the Destination cache hash table index of an IPv6 destination address.
+*
+* Argument(s) : p_addr      Pointer to IPv6 destination address.
+*               ------      Argument validated by caller(s).
+*
+* Return(s)   : Index of the hash chain in the Destination cache hash table.
+*
+* Caller(s)   : NetNDP_DestCacheCfg(),
+*               NetNDP_DestCacheSrch(),
+*               NetNDP_DestCacheRemove().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NetNDP_DestCacheHash (const  NET_IPv6_ADDR  *p_addr)
+{
+    CPU_INT32U  hash;
+    CPU_INT08U  i;
+
+
+    hash = 0u;
+    for (i = 0u; i < NET_IPv6_ADDR_SIZE; i++) {
+        hash = (hash * 31u) + p_addr->Addr[i];
+    }
+
+    return ((CPU_INT16U)(hash % NET_NDP_DEST_HASH_TBL_SIZE));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetNDP_RouteCfg()
+*
+* Description : (1) Add or update a Route entry in the Route table :
+*
+*                   (a) Search Route table for an identical route & update it, if any.
+*                   (b) Get a Route from the Route pool & insert it in the Route table.
+*                   (c) Invalidate Destination cache entries covered by the route.
+*
+*
+* Argument(s) : if_nbr              Interface number of the route.
+*
+*               p_addr_prefix       Pointer to IPv6 route prefix (masked by prefix length).
+*               -------------       Argument validated by caller(s).
+*
+*               prefix_len          Prefix length.
+*
+*               p_addr_next_hop     Pointer to IPv6 Next-Hop address, DEF_NULL if route is on-link.
+*
+*               type                Route type :
+*
+*                                       NET_NDP_ROUTE_TYPE_STATIC   Route configured by application.
+*                                       NET_NDP_ROUTE_TYPE_PREFIX   On-link route learned from Router Adv.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_NDP_ERR_NONE                Route successfully configured.
+*
+*                                                               ------ RETURNED BY NetNDP_RouteGet() : ------
+*                               NET_NDP_ERR_ROUTE_NONE_AVAIL    NO available route to allocate.
+*
+* Return(s)   : Pointer to Route entry configured, if NO error(s).
+*
+*               Pointer to NULL,                   otherwise.
+*
+* Caller(s)   : NetNDP_CfgRouteAdd(),
+*               NetNDP_RxPrefixHandler().
+*
+* Note(s)     : (2) A route learned from a Router Advertisement never overrides a route configured by
+*                   the application.
+*
+*               (3) Routes are inserted in the Route list by decreasing prefix length (see 'net_ndp.h
+*                   ROUTE ENTRY DATA TYPE  Note #1').
+*********************************************************************************************************
+*/
+
+static  NET_NDP_ROUTE  *NetNDP_RouteCfg (       NET_IF_NBR      if_nbr,
+                                         const  NET_IPv6_ADDR  *p_addr_prefix,
+                                                CPU_INT08U      prefix_len,
+                                         const  NET_IPv6_ADDR  *p_addr_next_hop,
+                                                CPU_INT08U      type,
+                                                NET_ERR        *p_err)
+{
+    NET_NDP_ROUTE  *p_route;
+    NET_NDP_ROUTE  *p_route_next;
+
+
+                                                                /* --------------- SRCH IDENTICAL ROUTE --------------- */
+    p_route = NetNDP_RouteSrch(if_nbr, p_addr_prefix, prefix_len);
+    if (p_route != (NET_NDP_ROUTE *)0) {
+        if ((p_route->Type == NET_NDP_ROUTE_TYPE_STATIC) &&     /* See Note #2.                                         */
+            (type          == NET_NDP_ROUTE_TYPE_PREFIX)) {
+           *p_err = NET_NDP_ERR_NONE;
+            return (p_route);
+        }
+
+    } else {
+                                                                /* ------------------- GET NEW ROUTE ------------------ */
+        p_route = NetNDP_RouteGet(p_err);
+        if (p_route == (NET_NDP_ROUTE *)0) {
+            return ((NET_NDP_ROUTE *)0);                        /* Rtn err from NetNDP_RouteGet().                      */
+        }
+
+        p_route->IF_Nbr    = if_nbr;
+        p_route->PrefixLen = prefix_len;
+        Mem_Copy(&p_route->Prefix, p_addr_prefix, NET_IPv6_ADDR_SIZE);
+
+                                                                /* -------- INSERT ROUTE IN LIST (see Note #3) -------- */
+        p_route_next = NetNDP_RouteListHead;
+        while ((p_route_next            != (NET_NDP_ROUTE *)0) &&
+               (p_route_next->PrefixLen >= prefix_len)) {
+            p_route_next = p_route_next->NextPtr;
+        }
+
+        p_route->NextPtr = p_route_next;
+        if (p_route_next != (NET_NDP_ROUTE *)0) {               /* Insert route before next route ...                   */
+            p_route->PrevPtr      = p_route_next->PrevPtr;
+            p_route_next->PrevPtr = p_route;
+        } else {                                                /* ... or @ list tail.                                  */
+            p_route->PrevPtr      = NetNDP_RouteListTail;
+            NetNDP_RouteListTail  = p_route;
+        }
+
+        if (p_route->PrevPtr != (NET_NDP_ROUTE *)0) {
+            p_route->PrevPtr->NextPtr = p_route;
+        } else {
+            NetNDP_RouteListHead      = p_route;
+        }
+    }
+
+                                                                /* -------------------- CFG ROUTE --------------------- */
+    p_route->Type = type;
+    if (p_addr_next_hop != (NET_IPv6_ADDR *)0) {
+        p_route->OnLink = DEF_NO;
+        Mem_Copy(&p_route->AddrNextHop, p_addr_next_hop, NET_IPv6_ADDR_SIZE);
+    } else {
+        p_route->OnLink = DEF_YES;
+        Mem_Clr(&p_route->AddrNextHop, NET_IPv6_ADDR_SIZE);
+    }
+
+                                                                /* --------- INVALIDATE COVERED DEST CACHE ------------ */
+    NetNDP_RouteInvalidateDestCache(p_addr_prefix, prefix_len);
+
+
+   *p_err = NET_NDP_ERR_NONE;
+
+    return (p_route);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetNDP_RouteGet()
+*
+* Description : Get a Route entry from the Route pool.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_NDP_ERR_NONE                Route successfully acquired.
+*                               NET_NDP_ERR_ROUTE_NONE_AVAIL    NO available route to allocate.
+*
+* Return(s)   : Pointer to Route entry, if NO error(s).
+*
+*               Pointer to NULL,        otherwise.
+*
+* Caller(s)   : NetNDP_RouteCfg().
+*
+* Note(s)     : (1) Route entries are NOT evicted when the Route pool is empty since, unlike Destination
+*                   cache entries, they cannot be recovered on the next lookup.
+*********************************************************************************************************
+*/
+
+static  NET_NDP_ROUTE  *NetNDP_RouteGet (NET_ERR  *p_err)
+{
+    NET_NDP_ROUTE  *p_route;
+    NET_ERR         err;
+
+
+    if (NetNDP_RoutePoolPtr == (NET_NDP_ROUTE *)0) {            /* If Route pool empty, rtn err (see Note #1).          */
+        NET_CTR_ERR_INC(Net_ErrCtrs.NDP.RouteNoneAvailCtr);
+       *p_err = NET_NDP_ERR_ROUTE_NONE_AVAIL;
+        return ((NET_NDP_ROUTE *)0);
+    }
+
+    p_route             = NetNDP_RoutePoolPtr;                  /* Get Route from pool.                                 */
+    NetNDP_RoutePoolPtr = p_route->NextPtr;
+
+    NetNDP_RouteClr(p_route);
+                                                                /* ------------- UPDATE ROUTE POOL STATS -------------- */
+    NetStat_PoolEntryUsedInc(&NetNDP_RoutePoolStat, &err);
+
+   *p_err = NET_NDP_ERR_NONE;
+
+    return (p_route);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetNDP_RouteSrch()
+*
+* Description : Search the Route table for a route with the given interface, prefix & prefix length.
+*
+* Argument(s) : if_nbr          Interface number of the route to look for.
+*
+*               p_addr_prefix   Pointer to IPv6 route prefix.
+*               -------------   Argument validated by caller(s).
+*
+*               prefix_len      Prefix length.
+*
+* Return(s)   : Pointer to Route entry found, if any.
+*
+*               Pointer to NULL,              otherwise.
+*
+* Caller(s)   : NetNDP_CfgRouteRemove(),
+*               NetNDP_PrefixRemove(),
+*               NetNDP_RouteCfg().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  NET_NDP_ROUTE  *NetNDP_RouteSrch (       NET_IF_NBR      if_nbr,
+                                          const  NET_IPv6_ADDR  *p_addr_prefix,
+                                                 CPU_INT08U      prefix_len)
+{
+    NET_NDP_ROUTE  *p_route;
+    CPU_BOOLEAN     found;
+
+
+    p_route = NetNDP_RouteListHead;
+    while (p_route != (NET_NDP_ROUTE *)0) {
+        if ((p_route->IF_Nbr    == if_nbr) &&
+            (p_route->PrefixLen == prefix_len)) {
+            found = Mem_Cmp((void     *)&p_route->Prefix,
+                            (void     *) p_addr_prefix,
+                            (CPU_SIZE_T) NET_IPv6_ADDR_SIZE);
+            if (found == DEF_YES) {
+                return (p_route);
+            }
+        }
+        p_route = p_route->NextPtr;
+    }
+
+    return ((NET_NDP_ROUTE *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NetNDP_RouteSrchMatchAddr()
+*
+* Description : Search the Route table for the longest prefix route matching an IPv6 address.
+*
+* Argument(s) : if_nbr      Interface number of the route to look for (see Note #2).
+*
+*               p_addr      Pointer to IPv6 address to match.
+*               ------      Argument validated by caller(s).
+*
+* Return(s)   : Pointer to the longest matching Route entry, if any.
+*
+*               Pointer to NULL,                             otherwise.
+*
+* Caller(s)   : NetNDP_NextHop(),
+*               NetNDP_NextHopByIF(),
+*               NetNDP_NextHopFwd().
+*
+* Note(s)     : (1) Since the Route list is sorted by decreasing prefix length, the first matching
+*                   route is the longest prefix match.
+*
+*               (2) If 'if_nbr' is NET_IF_NBR_WILDCARD, routes on every interface are considered.
+*********************************************************************************************************
+*/
+
+static  NET_NDP_ROUTE  *NetNDP_RouteSrchMatchAddr (       NET_IF_NBR      if_nbr,
+                                                   const  NET_IPv6_ADDR  *p_addr)
+{
+    NET_NDP_ROUTE  *p_route;
+    CPU_BOOLEAN     match;
+
+
+    p_route = NetNDP_RouteListHead;
+    while (p_route != (NET_NDP_ROUTE *)0) {
+        if ((if_nbr          == NET_IF_NBR_WILDCARD) ||
+            (p_route->IF_Nbr == if_nbr)) {
+            match = NetNDP_RouteIsAddrMatch(p_addr,
+                                           &p_route->Prefix,
+                                            p_route->PrefixLen);
+            if (match == DEF_YES) {                             /* See Note #1.                                         */
+                return (p_route);
+            }
+        }
+        p_route = p_route->NextPtr;
+    }
+
+    return ((NET_NDP_ROUTE *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetNDP_RouteRemove()
+*
+* Description : (1) Remove a Route entry from the Route table :
+*
+*                   (a) Invalidate Destination cache entries covered by the route.
+*                   (b) Unlink route from Route list.
+*                   (c) Free route entry.
+*
+*
+* Argument(s) : p_route     Pointer to the Route entry to remove.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetNDP_CfgRouteRemove(),
+*               NetNDP_PrefixRemove().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetNDP_RouteRemove (NET_NDP_ROUTE  *p_route)
+{
+    NET_ERR  err;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    if (p_route == (NET_NDP_ROUTE *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.NDP.NullPtrCtr);
+        return;
+    }
+#endif
+
+    NetNDP_RouteInvalidateDestCache(&p_route->Prefix, p_route->PrefixLen);
+
+                                                                /* ----------- UNLINK ROUTE FROM ROUTE LIST ----------- */
+    if (p_route->PrevPtr != (NET_NDP_ROUTE *)0) {
+        p_route->PrevPtr->NextPtr = p_route->NextPtr;
+    } else {
+        NetNDP_RouteListHead      = p_route->NextPtr;
+    }
+
+    if (p_route->NextPtr != (NET_NDP_ROUTE *)0) {
+        p_route->NextPtr->PrevPtr = p_route->PrevPtr;
+    } else {
+        NetNDP_RouteListTail      = p_route->PrevPtr;
+    }
+
+                                                                /* ----------------- CLEAR ROUTE ENTRY ---------------- */
+    NetNDP_RouteClr(p_route);
+
+                                                                /* ----------------- FREE ROUTE ENTRY ----------------- */
+    p_route->NextPtr    = NetNDP_RoutePoolPtr;
+    NetNDP_RoutePoolPtr = p_route;
+
+                                                                /* ------------- UPDATE ROUTE POOL STATS -------------- */
+    NetStat_PoolEntryUsedDec(&NetNDP_RoutePoolStat, &err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetNDP_RouteClr()
+*
+* Description : Clear a Route entry.
+*
+* Argument(s) : p_route     Pointer to the Route entry to clear.
+*               -------     Argument validated by caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetNDP_Init(),
+*               NetNDP_RouteGet(),
+*               NetNDP_RouteRemove().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetNDP_RouteClr (NET_NDP_ROUTE  *p_route)
+{
+    p_route->PrevPtr   = (NET_NDP_ROUTE *)0;
+    p_route->NextPtr   = (NET_NDP_ROUTE *)0;
+    p_route->IF_Nbr    =  NET_IF_NBR_NONE;
+    p_route->PrefixLen =  0u;
+    p_route->OnLink    =  DEF_NO;
+    p_route->Type      =  NET_NDP_ROUTE_TYPE_NONE;
+
+    Mem_Clr(&p_route->Prefix,      NET_IPv6_ADDR_SIZE);
+    Mem_Clr(&p_route->AddrNextHop, NET_IPv6_ADDR_SIZE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetNDP_RouteIsAddrMatch()
+*
+* Description : Validate that an IPv6 address is covered by a route prefix.
+*
+* Argument(s) : p_addr          Pointer to IPv6 address to validate.
+*               ------          Argument validated by caller(s).
+*
+*               p_addr_prefix   Pointer to IPv6 route prefix.
+*               -------------   Argument validated by caller(s).
+*
+*               prefix_len      Prefix length, in bits.
+*
+* Return(s)   : DEF_YES, if the address matches the prefix.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetNDP_RouteSrchMatchAddr(),
+*               NetNDP_RouteInvalidateDestCache().
+*
+* Note(s)     : (1) A prefix length of zero matches every address (i.e. default route '::/0').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetNDP_RouteIsAddrMatch (const  NET_IPv6_ADDR  *p_addr,
+                                              const  NET_IPv6_ADDR  *p_addr_prefix,
+                                                     CPU_INT08U      prefix_len)
+{
+    CPU_INT08U   nbr_octets;
+    CPU_INT08U   nbr_bits;
+    CPU_INT08U   mask;
+    CPU_BOOLEAN  match;
+
+
+    nbr_octets = prefix_len / DEF_OCTET_NBR_BITS;
+    nbr_bits   = prefix_len % DEF_OCTET_NBR_BITS;
+
+    match = Mem_Cmp((void     *)&p_addr->Addr[0],
+                    (void     *)&p_addr_prefix->Addr[0],
+                    (CPU_SIZE_T) nbr_octets);
+    if ((match    == DEF_YES) &&
+        (nbr_bits != 0u)) {
+        mask  = (CPU_INT08U)(DEF_OCTET_MASK << (DEF_OCTET_NBR_BITS - nbr_bits));
+        match = ((p_addr->Addr[nbr_octets] & mask) == (p_addr_prefix->Addr[nbr_octets] & mask)) ? DEF_YES : DEF_NO;
+    }
+
+    return (match);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  NetNDP_RouteInvalidateDestCache()
+*
+* Description : Invalidate every Destination cache entry whose destination address is covered by a
+*               route prefix, on any interface.
+*
+* Argument(s) : p_addr_prefix   Pointer to IPv6 route prefix.
+*               -------------   Argument validated by caller(s).
+*
+*               prefix_len      Prefix length.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetNDP_RouteCfg(),
+*               NetNDP_RouteRemove().
+*
+* Note(s)     : (1) Invalidated entries are kept in the Destination cache & are re-resolved on their
+*                   next lookup.
+*********************************************************************************************************
+*/
+
+static  void  NetNDP_RouteInvalidateDestCache (const  NET_IPv6_ADDR  *p_addr_prefix,
+                                                      CPU_INT08U      prefix_len)
+{
+    NET_NDP_DEST_CACHE  *p_dest_cache;
+    CPU_BOOLEAN          match;
+
+
+    p_dest_cache = NetNDP_DestListHead;
+    while (p_dest_cache != (NET_NDP_DEST_CACHE *)0) {
+        match = NetNDP_RouteIsAddrMatch(&p_dest_cache->AddrDest,
+                                         p_addr_prefix,
+                                         prefix_len);
+        if (match == DEF_YES) {
+            p_dest_cache->IsValid = DEF_NO;
+        }
+        p_dest_cache = p_dest_cache->NextPtr;
+    }
+}
+
+
 /*
 *********************************************************************************************************
 *                                       NetNDP_IsAddrOnLink()
@@ -226,6 +226,17 @@
 #define  NET_NDP_CACHE_STATE_PROBE                         5u
 
 
+/*
+*********************************************************************************************************
+*                                      NDP ROUTE TYPES DEFINES
+*********************************************************************************************************
+*/
+
+#define  NET_NDP_ROUTE_TYPE_NONE                           0u
+#define  NET_NDP_ROUTE_TYPE_STATIC                         1u   /* Route cfg'd by app.                                  */
+#define  NET_NDP_ROUTE_TYPE_PREFIX                         2u   /* On-link route learned from Router Adv prefix.        */
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -438,6 +449,39 @@ NET_IPv6_ADDR         AddrNextHop;                              /* IPv6 Next-Hop
 CPU_BOOLEAN           OnLink;                                   /* On-Link status.                                      */
 
 CPU_BOOLEAN           IsValid;                                  /* Valid destination address status.                    */
+
+CPU_BOOLEAN           IsDfltRouter;                             /* Next-hop sel'd from dflt router list (not a route).  */
+
+NET_NDP_DEST_CACHE   *HashNextPtr;                              /* Pointer to next NDP destination cache in hash chain. */
+};
+
+
+/*
+*********************************************************************************************************
+*                                       ROUTE ENTRY DATA TYPE
+*
+* Note(s) : (1) Route entries are kept in a list sorted by decreasing prefix length so that the first
+*               matching entry found is the longest prefix match.
+*********************************************************************************************************
+*/
+                                                                /* -------------------- NET ROUTE --------------------- */
+typedef  struct  net_ndp_route  NET_NDP_ROUTE;
+
+struct  net_ndp_route {
+NET_NDP_ROUTE        *PrevPtr;                                  /* Pointer to previous NDP route entry.                 */
+NET_NDP_ROUTE        *NextPtr;                                  /* Pointer to next     NDP route entry.                 */
+
+NET_IF_NBR            IF_Nbr;                                   /* Interface number associated with route.              */
+
+NET_IPv6_ADDR         Prefix;                                   /* Route prefix IPv6 address.                           */
+
+CPU_INT08U            PrefixLen;                                /* Route prefix length.                                 */
+
+NET_IPv6_ADDR         AddrNextHop;                              /* IPv6 Next-Hop address (if NOT on-link).              */
+
+CPU_BOOLEAN           OnLink;                                   /* On-Link status.                                      */
+
+CPU_INT08U            Type;                                     /* Route type (see 'NDP ROUTE TYPES DEFINES').          */
 };
 
 
@@ -494,6 +538,19 @@ CPU_BOOLEAN          NetNDP_CfgSolicitMaxNbr         (NET_NDP_SOLICIT
 
 CPU_BOOLEAN          NetNDP_CfgCacheTxQ_MaxTh        (NET_BUF_QTY               nbr_buf_max);
 
+                                                                /* ------------- NDP ROUTE CFG FUNCTIONS -------------- */
+
+void                 NetNDP_CfgRouteAdd              (       NET_IF_NBR         if_nbr,
+                                                      const  NET_IPv6_ADDR     *p_addr_prefix,
+                                                             CPU_INT08U         prefix_len,
+                                                      const  NET_IPv6_ADDR     *p_addr_next_hop,
+                                                             NET_ERR           *p_err);
+
+void                 NetNDP_CfgRouteRemove           (       NET_IF_NBR         if_nbr,
+                                                      const  NET_IPv6_ADDR     *p_addr_prefix,
+                                                             CPU_INT08U         prefix_len,
+                                                             NET_ERR           *p_err);
+
 
 /*
 *********************************************************************************************************
@@ -531,6 +588,12 @@ const  NET_IPv6_ADDR       *NetNDP_NextHop                  (       NET_IF_NBR
                                                              const  NET_IPv6_ADDR            *p_addr_dest,
                                                                     NET_ERR                  *p_err);
 
+#ifdef  NET_IPv6_FWD_MODULE_EN
+const  NET_IPv6_ADDR       *NetNDP_NextHopFwd               (       NET_IF_NBR               *p_if_nbr,
+                                                             const  NET_IPv6_ADDR            *p_addr_dest,
+                                                                    NET_ERR                  *p_err);
+#endif
+
 
                                                                 /* ------- NDP NEIGHBOR CACHE TIMEOUT FUNCTIONS ------- */
 void                        NetNDP_CacheTimeout             (       void                     *p_cache_timeout);
@@ -615,6 +678,12 @@ CPU_BOOLEAN                 NetNDP_CacheGetIsRouterFlagState(       NET_IF_NBR
 #endif
 
 
+#if    (NET_NDP_CFG_ROUTE_NBR < 1u)
+#error  "NET_NDP_CFG_ROUTE_NBR                   illegally #define'd in 'net_cfg.h'  "
+#error  "                                        [MUST be  >= 1]                     "
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1226,10 +1226,10 @@ NET_SOCK_ID  NetApp_SockAccept (NET_SOCK_ID         sock_id,
 *********************************************************************************************************
 */
 
-CPU_INT16U  NetApp_SockRx (NET_SOCK_ID          sock_id,
+CPU_INT32U  NetApp_SockRx (NET_SOCK_ID          sock_id,
                            void                *p_data_buf,
-                           CPU_INT16U           data_buf_len,
-                           CPU_INT16U           data_rx_th,
+                           CPU_INT32U           data_buf_len,
+                           CPU_INT32U           data_rx_th,
                            NET_SOCK_API_FLAGS   flags,
                            NET_SOCK_ADDR       *p_addr_remote,
                            NET_SOCK_ADDR_LEN   *p_addr_len,
@@ -1246,10 +1246,10 @@ CPU_INT16U  NetApp_SockRx (NET_SOCK_ID          sock_id,
     NET_SOCK_ADDR_LEN   addr_len_temp;
     NET_SOCK_ADDR       addr_temp;
     CPU_INT08U         *p_data_buf_rem;
-    CPU_INT16U          data_buf_len_rem;
-    CPU_INT16S          rx_len;
-    CPU_INT16U          rx_len_tot;
-    CPU_INT16U          rx_th_actual;
+    CPU_INT32U          data_buf_len_rem;
+    NET_SOCK_RTN_CODE   rx_len;
+    CPU_INT32U          rx_len_tot;
+    CPU_INT32U          rx_th_actual;
     CPU_INT16U          retry_cnt;
     CPU_INT32U          timeout_ms_cfgd;
     CPU_BOOLEAN         timeout_cfgd;
@@ -1361,10 +1361,10 @@ CPU_INT16U  NetApp_SockRx (NET_SOCK_ID          sock_id,
                                                                 /* ... rx app data.                                     */
        *p_addr_len        = (NET_SOCK_ADDR_LEN) addr_len;
         p_data_buf_rem    = (CPU_INT08U      *)p_data_buf    + rx_len_tot;
-        data_buf_len_rem  = (CPU_INT16U       )(data_buf_len - rx_len_tot);
-        rx_len            = (CPU_INT16S       ) NetSock_RxDataFrom((NET_SOCK_ID        ) sock_id,
+        data_buf_len_rem  = (CPU_INT32U       )(data_buf_len - rx_len_tot);
+        rx_len            = (NET_SOCK_RTN_CODE) NetSock_RxDataFrom((NET_SOCK_ID        ) sock_id,
                                                                    (void              *) p_data_buf_rem,
-                                                                   (CPU_INT16U         ) data_buf_len_rem,
+                                                                   (CPU_INT32U         ) data_buf_len_rem,
                                                                    (NET_SOCK_API_FLAGS ) flags,
                                                                    (NET_SOCK_ADDR     *) p_addr_remote,
                                                                    (NET_SOCK_ADDR_LEN *) p_addr_len,
@@ -1376,7 +1376,7 @@ CPU_INT16U  NetApp_SockRx (NET_SOCK_ID          sock_id,
             case NET_SOCK_ERR_NONE:
             case NET_SOCK_ERR_INVALID_DATA_SIZE:
                  if (rx_len > 0) {                              /* If          rx len > 0, ...                          */
-                     rx_len_tot += (CPU_INT16U)rx_len;          /* ... inc tot rx len.                                  */
+                     rx_len_tot += (CPU_INT32U)rx_len;          /* ... inc tot rx len.                                  */
                  }
 
                  if (err == NET_SOCK_ERR_INVALID_DATA_SIZE) {   /* If app data buf NOT large enough for all rx'd data,  */
@@ -1560,9 +1560,9 @@ CPU_INT16U  NetApp_SockRx (NET_SOCK_ID          sock_id,
 *********************************************************************************************************
 */
 
-CPU_INT16U  NetApp_SockTx (NET_SOCK_ID          sock_id,
+CPU_INT32U  NetApp_SockTx (NET_SOCK_ID          sock_id,
                            void                *p_data,
-                           CPU_INT16U           data_len,
+                           CPU_INT32U           data_len,
                            NET_SOCK_API_FLAGS   flags,
                            NET_SOCK_ADDR       *p_addr_remote,
                            NET_SOCK_ADDR_LEN    addr_len,
@@ -1571,17 +1571,17 @@ CPU_INT16U  NetApp_SockTx (NET_SOCK_ID          sock_id,
                            CPU_INT32U           time_dly_ms,
                            NET_ERR             *p_err)
 {
-    CPU_INT08U   *p_data_buf;
-    CPU_INT16U    data_buf_len;
-    CPU_INT16S    tx_len;
-    CPU_INT16U    tx_len_tot;
-    CPU_INT16U    retry_cnt;
-    CPU_INT32U    timeout_ms_cfgd;
-    CPU_BOOLEAN   timeout_cfgd;
-    CPU_BOOLEAN   done;
-    CPU_BOOLEAN   dly;
-    NET_ERR       err;
-    NET_ERR       err_rtn;
+    CPU_INT08U         *p_data_buf;
+    CPU_INT32U          data_buf_len;
+    NET_SOCK_RTN_CODE   tx_len;
+    CPU_INT32U          tx_len_tot;
+    CPU_INT16U          retry_cnt;
+    CPU_INT32U          timeout_ms_cfgd;
+    CPU_BOOLEAN         timeout_cfgd;
+    CPU_BOOLEAN         done;
+    CPU_BOOLEAN         dly;
+    NET_ERR             err;
+    NET_ERR             err_rtn;
 
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -1650,19 +1650,19 @@ CPU_INT16U  NetApp_SockTx (NET_SOCK_ID          sock_id,
             NetApp_TimeDly_ms(time_dly_ms, &err);
         }
                                                                 /* ... tx app data.                                     */
-        p_data_buf    = (CPU_INT08U *)p_data     + tx_len_tot;
-        data_buf_len  = (CPU_INT16U  )( data_len - tx_len_tot);
-        tx_len        = (CPU_INT16S  )NetSock_TxDataTo((NET_SOCK_ID       ) sock_id,
-                                                       (void             *) p_data_buf,
-                                                       (CPU_INT16U        ) data_buf_len,
-                                                       (NET_SOCK_API_FLAGS) flags,
-                                                       (NET_SOCK_ADDR    *) p_addr_remote,
-                                                       (NET_SOCK_ADDR_LEN ) addr_len,
-                                                       (NET_ERR          *)&err);
+        p_data_buf    = (CPU_INT08U       *)p_data     + tx_len_tot;
+        data_buf_len  = (CPU_INT32U        )( data_len - tx_len_tot);
+        tx_len        = (NET_SOCK_RTN_CODE )NetSock_TxDataTo((NET_SOCK_ID       ) sock_id,
+                                                             (void             *) p_data_buf,
+                                                             (CPU_INT32U        ) data_buf_len,
+                                                             (NET_SOCK_API_FLAGS) flags,
+                                                             (NET_SOCK_ADDR    *) p_addr_remote,
+                                                             (NET_SOCK_ADDR_LEN ) addr_len,
+                                                             (NET_ERR          *)&err);
         switch (err) {
             case NET_SOCK_ERR_NONE:
                  if (tx_len > 0) {                              /* If          tx len > 0, ...                          */
-                     tx_len_tot += (CPU_INT16U)tx_len;          /* ... inc tot tx len.                                  */
+                     tx_len_tot += (CPU_INT32U)tx_len;          /* ... inc tot tx len.                                  */
                  }
                  retry_cnt = 0u;
                  dly       = DEF_NO;
@@ -159,10 +159,10 @@ NET_SOCK_ID         NetApp_SockAccept                   (NET_SOCK_ID
                                                          NET_ERR                   *p_err);
 
 
-CPU_INT16U          NetApp_SockRx                       (NET_SOCK_ID               sock_id,
+CPU_INT32U          NetApp_SockRx                       (NET_SOCK_ID               sock_id,
                                                          void                     *p_data_buf,
-                                                         CPU_INT16U                data_buf_len,
-                                                         CPU_INT16U                data_rx_th,
+                                                         CPU_INT32U                data_buf_len,
+                                                         CPU_INT32U                data_rx_th,
                                                          NET_SOCK_API_FLAGS        flags,
                                                          NET_SOCK_ADDR            *p_addr_remote,
                                                          NET_SOCK_ADDR_LEN        *p_addr_len,
@@ -171,9 +171,9 @@ CPU_INT16U          NetApp_SockRx                       (NET_SOCK_ID
                                                          CPU_INT32U                time_dly_ms,
                                                          NET_ERR                  *p_err);
 
-CPU_INT16U          NetApp_SockTx                       (NET_SOCK_ID               sock_id,
+CPU_INT32U          NetApp_SockTx                       (NET_SOCK_ID               sock_id,
                                                          void                     *p_data,
-                                                         CPU_INT16U                data_len,
+                                                         CPU_INT32U                data_len,
                                                          NET_SOCK_API_FLAGS        flags,
                                                          NET_SOCK_ADDR            *p_addr_remote,
                                                          NET_SOCK_ADDR_LEN         addr_len,
@@ -822,14 +822,14 @@ ssize_t  recvfrom (        int         sock_id,
     NET_ERR            err;
 
 
-    if (data_buf_len > DEF_INT_16U_MAX_VAL) {
+    if (data_buf_len > NET_SOCK_DATA_SIZE_MAX) {
         return (NET_BSD_ERR_DFLT);
     }
 
     addr_len   = (NET_SOCK_ADDR_LEN)*p_addr_len;
     rtn_code   = (ssize_t)NetSock_RxDataFrom((NET_SOCK_ID        ) sock_id,
                                              (void              *) p_data_buf,
-                                             (CPU_INT16U         ) data_buf_len,
+                                             (CPU_INT32U         ) data_buf_len,
                                              (NET_SOCK_API_FLAGS ) flags,
                                              (NET_SOCK_ADDR     *) p_addr_remote,
                                              (NET_SOCK_ADDR_LEN *)&addr_len,
@@ -943,13 +943,13 @@ ssize_t  recv (int      sock_id,
     NET_ERR  err;
 
 
-    if (data_buf_len > DEF_INT_16U_MAX_VAL) {
+    if (data_buf_len > NET_SOCK_DATA_SIZE_MAX) {
         return (NET_BSD_ERR_DFLT);
     }
 
     rtn_code = (ssize_t)NetSock_RxData((NET_SOCK_ID       ) sock_id,
                                        (void             *) p_data_buf,
-                                       (CPU_INT16U        ) data_buf_len,
+                                       (CPU_INT32U        ) data_buf_len,
                                        (NET_SOCK_API_FLAGS) flags,
                                        (NET_ERR          *)&err);
 
@@ -957,6 +957,222 @@ ssize_t  recv (int      sock_id,
 }
 
 
+/*
+*********************************************************************************************************
+*                                             recvmsg()
+*
+* Description : Receive data from a socket into a scatter/gather array.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to receive data.
+*
+*               p_msg           Pointer to a message header that describes :
+*
+*                                   (a) 'msg_iov'/'msg_iovlen'      Array of buffers to receive the socket's
+*                                                                       received data, filled in order.
+*                                   (b) 'msg_name'/'msg_namelen'    Optional address buffer that will receive
+*                                                                       the received data's remote address.
+*
+*               flags           Flags to select receive options; bit-field flags logically OR'd :
+*
+*                                   0                           No socket flags selected.
+*                                   MSG_PEEK                    Receive socket data without consuming
+*                                                                   the socket data.
+*                                   MSG_DONTWAIT                Receive socket data without blocking.
+*
+* Return(s)   : Number of positive data octets received, if NO error(s).
+*
+*                0,                                      if socket connection closed.
+*
+*               -1,                                      otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) See 'sendmsg()  Note #1'.
+*
+*               (2) Ancillary data is NOT supported; 'msg_controllen' is returned as 0.
+*
+*               (3) If a received datagram is larger than the total length of the scatter/gather array, the
+*                   array is maximally filled, the remaining octets are discarded & MSG_TRUNC is returned in
+*                   'msg_flags'.
+*
+*                   See also 'recvfrom()  Note #1a2'.
+*********************************************************************************************************
+*/
+
+ssize_t  recvmsg (        int      sock_id,
+                  struct  msghdr  *p_msg,
+                          int      flags)
+{
+    NET_SOCK_DATA_VEC   vec[NET_SOCK_CFG_DATA_VEC_NBR_MAX];
+    NET_SOCK_ADDR_LEN   addr_len;
+    NET_SOCK_ADDR_LEN  *p_addr_len;
+    ssize_t             rtn_code;
+    int                 vec_ix;
+    NET_ERR             err;
+
+
+    if (p_msg == (struct msghdr *)0) {
+        return (NET_BSD_ERR_DFLT);
+    }
+    if ((p_msg->msg_iov    == (struct iovec *)0) ||
+        (p_msg->msg_iovlen <  1)                 ||
+        (p_msg->msg_iovlen >  IOV_MAX)) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    for (vec_ix = 0; vec_ix < p_msg->msg_iovlen; vec_ix++) {     /* Conv scatter/gather array to sock data vec.          */
+        if (p_msg->msg_iov[vec_ix].iov_len > DEF_INT_16U_MAX_VAL) {
+            return (NET_BSD_ERR_DFLT);
+        }
+        vec[vec_ix].DataPtr = (void     *)p_msg->msg_iov[vec_ix].iov_base;
+        vec[vec_ix].DataLen = (CPU_INT16U)p_msg->msg_iov[vec_ix].iov_len;
+    }
+
+    addr_len   = 0u;
+    p_addr_len = (NET_SOCK_ADDR_LEN *)0;
+    if (p_msg->msg_name != (void *)0) {
+        addr_len   = (NET_SOCK_ADDR_LEN)p_msg->msg_namelen;
+        p_addr_len = &addr_len;
+    }
+
+    rtn_code = (ssize_t)NetSock_RxDataVec((NET_SOCK_ID        ) sock_id,
+                                          (NET_SOCK_DATA_VEC *)&vec[0],
+                                          (CPU_INT16U         ) p_msg->msg_iovlen,
+                                          (NET_SOCK_API_FLAGS ) flags,
+                                          (NET_SOCK_ADDR     *) p_msg->msg_name,
+                                          (NET_SOCK_ADDR_LEN *) p_addr_len,
+                                          (NET_ERR           *)&err);
+
+    p_msg->msg_namelen    = (socklen_t)addr_len;
+    p_msg->msg_controllen =  0;                                 /* See Note #2.                                         */
+    p_msg->msg_flags      =  0;
+    if ((rtn_code > 0) &&
+        (err      == NET_SOCK_ERR_INVALID_DATA_SIZE)) {         /* See Note #3.                                         */
+        p_msg->msg_flags  =  MSG_TRUNC;
+    }
+
+    return (rtn_code);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             recvmmsg()
+*
+* Description : Receive multiple datagrams from a socket, each into its own scatter/gather array.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to receive data.
+*
+*               p_msgvec        Pointer to an array of message headers; each message header receives one
+*                                   datagram as described in 'recvmsg()  p_msg'.
+*
+*               vlen            Number of message headers in the array (see Note #1a).
+*
+*               flags           Flags to select receive options; bit-field flags logically OR'd :
+*
+*                                   0                           No socket flags selected.
+*                                   MSG_DONTWAIT                Receive socket data without blocking.
+*
+*               p_timeout       Pointer to a receive timeout (see Note #2).
+*
+* Return(s)   : Number of messages received, if NO error(s).
+*
+*               -1,                          otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) (a) At most NET_SOCK_CFG_MSG_NBR_MAX messages are received per call; any further message
+*                       headers are left untouched.
+*
+*                   (b) Only datagram sockets are supported.  Only the first datagram may block; further
+*                       datagrams are received only while datagrams remain queued on the socket.
+*
+*                   (c) Each received message's length is returned in 'msg_len' & its header is updated as
+*                       described in 'recvmsg()  Note #2' & 'recvmsg()  Note #3'.
+*
+*                   See also 'net_sock.c  NetSock_RxDataMsgs()  Note #3'.
+*
+*               (2) A batch receive timeout is NOT supported; 'p_timeout' MUST be passed a NULL pointer & the
+*                   socket's receive timeout applies to the first datagram only.
+*********************************************************************************************************
+*/
+
+int  recvmmsg (        int            sock_id,
+               struct  mmsghdr       *p_msgvec,
+                       unsigned int   vlen,
+                       int            flags,
+               struct  timeval       *p_timeout)
+{
+    NET_SOCK_DATA_VEC   vec[NET_SOCK_CFG_MSG_NBR_MAX][NET_SOCK_CFG_DATA_VEC_NBR_MAX];
+    NET_SOCK_MSG        msgs[NET_SOCK_CFG_MSG_NBR_MAX];
+    struct  msghdr     *p_msg;
+    int                 rtn_code;
+    unsigned int        msg_ix;
+    int                 vec_ix;
+    NET_ERR             err;
+
+
+    if (p_msgvec == (struct mmsghdr *)0) {
+        return (NET_BSD_ERR_DFLT);
+    }
+    if (vlen < 1u) {
+        return (NET_BSD_ERR_DFLT);
+    }
+    if (p_timeout != (struct timeval *)0) {                     /* See Note #2.                                         */
+        return (NET_BSD_ERR_DFLT);
+    }
+    if (vlen > NET_SOCK_CFG_MSG_NBR_MAX) {                      /* See Note #1a.                                        */
+        vlen = NET_SOCK_CFG_MSG_NBR_MAX;
+    }
+
+    for (msg_ix = 0u; msg_ix < vlen; msg_ix++) {                /* Conv msg hdrs to sock msgs.                          */
+        p_msg = &p_msgvec[msg_ix].msg_hdr;
+        if ((p_msg->msg_iov    == (struct iovec *)0) ||
+            (p_msg->msg_iovlen <  1)                 ||
+            (p_msg->msg_iovlen >  IOV_MAX)) {
+            return (NET_BSD_ERR_DFLT);
+        }
+
+        for (vec_ix = 0; vec_ix < p_msg->msg_iovlen; vec_ix++) {
+            if (p_msg->msg_iov[vec_ix].iov_len > DEF_INT_16U_MAX_VAL) {
+                return (NET_BSD_ERR_DFLT);
+            }
+            vec[msg_ix][vec_ix].DataPtr = (void     *)p_msg->msg_iov[vec_ix].iov_base;
+            vec[msg_ix][vec_ix].DataLen = (CPU_INT16U)p_msg->msg_iov[vec_ix].iov_len;
+        }
+
+        msgs[msg_ix].VecPtr  = &vec[msg_ix][0];
+        msgs[msg_ix].VecNbr  = (CPU_INT16U       )p_msg->msg_iovlen;
+        msgs[msg_ix].AddrPtr = (NET_SOCK_ADDR   *)p_msg->msg_name;
+        msgs[msg_ix].AddrLen = (NET_SOCK_ADDR_LEN)p_msg->msg_namelen;
+    }
+
+    rtn_code = (int)NetSock_RxDataMsgs((NET_SOCK_ID        ) sock_id,
+                                       (NET_SOCK_MSG      *)&msgs[0],
+                                       (CPU_INT16U         ) vlen,
+                                       (NET_SOCK_API_FLAGS ) flags,
+                                       (NET_ERR           *)&err);
+
+    for (msg_ix = 0u; (int)msg_ix < rtn_code; msg_ix++) {       /* Rtn rx'd msg lens & hdrs (see Note #1c).             */
+        p_msg                    = &p_msgvec[msg_ix].msg_hdr;
+        p_msgvec[msg_ix].msg_len = (unsigned int)msgs[msg_ix].DataLen;
+        if (p_msg->msg_name != (void *)0) {
+            p_msg->msg_namelen   = (socklen_t)msgs[msg_ix].AddrLen;
+        }
+        p_msg->msg_controllen    =  0;
+        p_msg->msg_flags         = (int)msgs[msg_ix].Flags;
+    }
+
+    return (rtn_code);
+}
+
+
 /*
 *********************************************************************************************************
 *                                              sendto()
@@ -973,6 +1189,7 @@ ssize_t  recv (int      sock_id,
 *
 *                                   0                           No socket flags selected.
 *                                   MSG_DONTWAIT                Send socket data without blocking.
+*                                   MSG_MORE                    More stream data follows; do NOT push.
 *
 *               p_addr_remote   Pointer to destination address buffer (see Note #3);
 *                                   required for datagram sockets, optional for stream sockets.
@@ -1076,9 +1293,13 @@ ssize_t  sendto (        int         sock_id,
     NET_ERR  err;
 
 
+    if (data_len > NET_SOCK_DATA_SIZE_MAX) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
     rtn_code = (ssize_t)NetSock_TxDataTo((NET_SOCK_ID       ) sock_id,
                                          (void             *) p_data,
-                                         (CPU_INT16U        ) data_len,
+                                         (CPU_INT32U        ) data_len,
                                          (NET_SOCK_API_FLAGS) flags,
                                          (NET_SOCK_ADDR    *) p_addr_remote,
                                          (NET_SOCK_ADDR_LEN ) addr_len,
@@ -1104,6 +1325,7 @@ ssize_t  sendto (        int         sock_id,
 *
 *                                   0                           No socket flags selected.
 *                                   MSG_DONTWAIT                Send socket data without blocking.
+*                                   MSG_MORE                    More stream data follows; do NOT push.
 *
 * Return(s)   : Number of positive data octets sent, if NO error(s)              [see Note #3a1].
 *
@@ -1192,9 +1414,13 @@ ssize_t  send (int      sock_id,
     NET_ERR  err;
 
 
+    if (data_len > NET_SOCK_DATA_SIZE_MAX) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
     rtn_code = (ssize_t)NetSock_TxData((NET_SOCK_ID       ) sock_id,
                                        (void             *) p_data,
-                                       (CPU_INT16U        ) data_len,
+                                       (CPU_INT32U        ) data_len,
                                        (NET_SOCK_API_FLAGS) flags,
                                        (NET_ERR          *)&err);
 
@@ -1202,6 +1428,194 @@ ssize_t  send (int      sock_id,
 }
 
 
+/*
+*********************************************************************************************************
+*                                              sendmsg()
+*
+* Description : Send data from a scatter/gather array through a socket.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to send data.
+*
+*               p_msg           Pointer to a message header that describes :
+*
+*                                   (a) 'msg_iov'/'msg_iovlen'      Array of buffers with the data to send,
+*                                                                       sent in order.
+*                                   (b) 'msg_name'/'msg_namelen'    Optional destination address; required
+*                                                                       for unconnected datagram sockets.
+*
+*               flags           Flags to select send options; bit-field flags logically OR'd :
+*
+*                                   0                           No socket flags selected.
+*                                   MSG_DONTWAIT                Send socket data without blocking.
+*                                   MSG_MORE                    More stream data follows; do NOT push.
+*
+* Return(s)   : Number of positive data octets sent, if NO error(s).
+*
+*                0,                                  if socket connection closed.
+*
+*               -1,                                  otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) (a) The scatter/gather array MUST contain between 1 & IOV_MAX elements & its total length
+*                       MUST NOT exceed 65535 octets.
+*
+*                   (b) Data is copied directly between the scatter/gather array & the network buffers; a
+*                       datagram socket sends the whole array as a single datagram & a stream socket
+*                       coalesces the array into full-sized segments.
+*
+*                   See also 'net_sock.c  NetSock_TxDataVec()  Note #3'.
+*
+*               (2) Ancillary data is NOT supported; 'msg_control' & 'msg_controllen' are ignored.
+*
+*               (3) Secure sockets do NOT support scatter/gather I/O.
+*
+*                   See also 'net_sock.c  NetSock_TxDataHandler()  Note #7b'.
+*********************************************************************************************************
+*/
+
+ssize_t  sendmsg (        int      sock_id,
+                  struct  msghdr  *p_msg,
+                          int      flags)
+{
+    NET_SOCK_DATA_VEC  vec[NET_SOCK_CFG_DATA_VEC_NBR_MAX];
+    ssize_t            rtn_code;
+    int                vec_ix;
+    NET_ERR            err;
+
+
+    if (p_msg == (struct msghdr *)0) {
+        return (NET_BSD_ERR_DFLT);
+    }
+    if ((p_msg->msg_iov    == (struct iovec *)0) ||             /* See Note #1a.                                        */
+        (p_msg->msg_iovlen <  1)                 ||
+        (p_msg->msg_iovlen >  IOV_MAX)) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    for (vec_ix = 0; vec_ix < p_msg->msg_iovlen; vec_ix++) {     /* Conv scatter/gather array to sock data vec.          */
+        if (p_msg->msg_iov[vec_ix].iov_len > DEF_INT_16U_MAX_VAL) {
+            return (NET_BSD_ERR_DFLT);
+        }
+        vec[vec_ix].DataPtr = (void     *)p_msg->msg_iov[vec_ix].iov_base;
+        vec[vec_ix].DataLen = (CPU_INT16U)p_msg->msg_iov[vec_ix].iov_len;
+    }
+
+    rtn_code = (ssize_t)NetSock_TxDataVec((NET_SOCK_ID       ) sock_id,
+                                          (NET_SOCK_DATA_VEC *)&vec[0],
+                                          (CPU_INT16U        ) p_msg->msg_iovlen,
+                                          (NET_SOCK_API_FLAGS) flags,
+                                          (NET_SOCK_ADDR    *) p_msg->msg_name,
+                                          (NET_SOCK_ADDR_LEN ) p_msg->msg_namelen,
+                                          (NET_ERR          *)&err);
+
+    return (rtn_code);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             sendmmsg()
+*
+* Description : Send multiple datagrams through a socket, each from its own scatter/gather array.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to send data.
+*
+*               p_msgvec        Pointer to an array of message headers; each message header is sent as one
+*                                   datagram as described in 'sendmsg()  p_msg'.
+*
+*               vlen            Number of message headers in the array (see Note #1a).
+*
+*               flags           Flags to select send options; bit-field flags logically OR'd :
+*
+*                                   0                           No socket flags selected.
+*                                   MSG_DONTWAIT                Send socket data without blocking.
+*
+* Return(s)   : Number of messages sent, if NO error(s).
+*
+*               -1,                      otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) (a) At most NET_SOCK_CFG_MSG_NBR_MAX messages are sent per call; the application SHOULD
+*                       send any remaining messages with a further call.
+*
+*                   (b) Only datagram sockets are supported.
+*
+*                   (c) Each sent message's length is returned in 'msg_len'.
+*
+*                   See also 'net_sock.c  NetSock_TxDataMsgs()  Note #3'.
+*
+*               (2) See 'sendmsg()  Note #2'.
+*********************************************************************************************************
+*/
+
+int  sendmmsg (        int            sock_id,
+               struct  mmsghdr       *p_msgvec,
+                       unsigned int   vlen,
+                       int            flags)
+{
+    NET_SOCK_DATA_VEC   vec[NET_SOCK_CFG_MSG_NBR_MAX][NET_SOCK_CFG_DATA_VEC_NBR_MAX];
+    NET_SOCK_MSG        msgs[NET_SOCK_CFG_MSG_NBR_MAX];
+    struct  msghdr     *p_msg;
+    int                 rtn_code;
+    unsigned int        msg_ix;
+    int                 vec_ix;
+    NET_ERR             err;
+
+
+    if (p_msgvec == (struct mmsghdr *)0) {
+        return (NET_BSD_ERR_DFLT);
+    }
+    if (vlen < 1u) {
+        return (NET_BSD_ERR_DFLT);
+    }
+    if (vlen > NET_SOCK_CFG_MSG_NBR_MAX) {                      /* See Note #1a.                                        */
+        vlen = NET_SOCK_CFG_MSG_NBR_MAX;
+    }
+
+    for (msg_ix = 0u; msg_ix < vlen; msg_ix++) {                /* Conv msg hdrs to sock msgs.                          */
+        p_msg = &p_msgvec[msg_ix].msg_hdr;
+        if ((p_msg->msg_iov    == (struct iovec *)0) ||
+            (p_msg->msg_iovlen <  1)                 ||
+            (p_msg->msg_iovlen >  IOV_MAX)) {
+            return (NET_BSD_ERR_DFLT);
+        }
+
+        for (vec_ix = 0; vec_ix < p_msg->msg_iovlen; vec_ix++) {
+            if (p_msg->msg_iov[vec_ix].iov_len > DEF_INT_16U_MAX_VAL) {
+                return (NET_BSD_ERR_DFLT);
+            }
+            vec[msg_ix][vec_ix].DataPtr = (void     *)p_msg->msg_iov[vec_ix].iov_base;
+            vec[msg_ix][vec_ix].DataLen = (CPU_INT16U)p_msg->msg_iov[vec_ix].iov_len;
+        }
+
+        msgs[msg_ix].VecPtr  = &vec[msg_ix][0];
+        msgs[msg_ix].VecNbr  = (CPU_INT16U       )p_msg->msg_iovlen;
+        msgs[msg_ix].AddrPtr = (NET_SOCK_ADDR   *)p_msg->msg_name;
+        msgs[msg_ix].AddrLen = (NET_SOCK_ADDR_LEN)p_msg->msg_namelen;
+    }
+
+    rtn_code = (int)NetSock_TxDataMsgs((NET_SOCK_ID       ) sock_id,
+                                       (NET_SOCK_MSG     *)&msgs[0],
+                                       (CPU_INT16U        ) vlen,
+                                       (NET_SOCK_API_FLAGS) flags,
+                                       (NET_ERR          *)&err);
+
+    for (msg_ix = 0u; (int)msg_ix < rtn_code; msg_ix++) {       /* Rtn sent msg lens (see Note #1c).                    */
+        p_msgvec[msg_ix].msg_len = (unsigned int)msgs[msg_ix].DataLen;
+    }
+
+    return (rtn_code);
+}
+
+
 /*
 *********************************************************************************************************
 *                                              select()
@@ -1533,6 +1947,249 @@ int  select (        int       desc_nbr_max,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                           epoll_create()
+*
+* Description : Create a socket event poll set.
+*
+* Argument(s) : size        Hint for number of sockets to register (see Note #1).
+*
+* Return(s)   : Poll set identifier, if NO error(s).
+*
+*               NET_BSD_ERR_DFLT,    otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) As for Linux epoll_create(), 'size' is ignored but MUST be greater than zero.
+*
+*               (2) Poll set identifiers are NOT socket descriptors & MUST be freed with epoll_close(),
+*                   NOT close().
+*
+*               See also 'net_sock.c  NetSock_PollCreate()'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+int  epoll_create (int  size)
+{
+    int      rtn_code;
+    NET_ERR  err;
+
+
+    if (size < 1) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    rtn_code = (int)NetSock_PollCreate(&err);
+    if (err != NET_SOCK_ERR_NONE) {
+        rtn_code = NET_BSD_ERR_DFLT;
+    }
+
+    return (rtn_code);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            epoll_close()
+*
+* Description : Free a socket event poll set.
+*
+* Argument(s) : poll_id     Poll set identifier returned by epoll_create().
+*
+* Return(s)   :  0,                 if NO error(s).
+*
+*               NET_BSD_ERR_DFLT,   otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) See 'epoll_create()  Note #2'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+int  epoll_close (int  poll_id)
+{
+    int      rtn_code;
+    NET_ERR  err;
+
+
+    NetSock_PollClose((NET_SOCK_POLL_ID)poll_id, &err);
+
+    rtn_code = (err == NET_SOCK_ERR_NONE) ? NET_BSD_ERR_NONE : NET_BSD_ERR_DFLT;
+
+    return (rtn_code);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             epoll_ctl()
+*
+* Description : Register, modify or unregister a socket with a socket event poll set.
+*
+* Argument(s) : poll_id     Poll set identifier returned by epoll_create().
+*
+*               op          Poll set operation :
+*
+*                               EPOLL_CTL_ADD           Register   socket.
+*                               EPOLL_CTL_MOD           Modify     socket's events of interest.
+*                               EPOLL_CTL_DEL           Unregister socket.
+*
+*               sock_id     Socket descriptor/handle identifier of socket to (un)register.
+*
+*               p_event     Pointer to events of interest & application data (see Note #2); ignored for
+*                               EPOLL_CTL_DEL.
+*
+* Return(s)   :  0,                 if NO error(s).
+*
+*               NET_BSD_ERR_DFLT,   otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) Events of interest are EPOLLIN, EPOLLOUT & EPOLLERR, optionally combined with EPOLLET.
+*                   Unlike Linux, EPOLLERR is reported only if requested.
+*
+*               (2) Only the 'ptr' member of the 'data' union is stored & returned by epoll_wait().  If
+*                   'data.ptr' is NULL, epoll_wait() returns the socket descriptor in 'data.fd' instead.
+*
+*               See also 'net_sock.c  NetSock_PollCtl()'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+int  epoll_ctl (        int           poll_id,
+                        int           op,
+                        int           sock_id,
+                struct  epoll_event  *p_event)
+{
+    NET_SOCK_SEL_EVENT_FLAG   events;
+    void                     *p_data;
+    int                       rtn_code;
+    NET_ERR                   err;
+
+
+    events = NET_SOCK_SEL_EVENT_FLAG_NONE;
+    p_data = DEF_NULL;
+
+    if (op != EPOLL_CTL_DEL) {
+        if (p_event == DEF_NULL) {
+            return (NET_BSD_ERR_DFLT);
+        }
+        events = (NET_SOCK_SEL_EVENT_FLAG)p_event->events;
+        p_data =  p_event->data.ptr;
+    }
+
+    NetSock_PollCtl((NET_SOCK_POLL_ID)poll_id,
+                    (NET_SOCK_POLL_OP)op,
+                    (NET_SOCK_ID     )sock_id,
+                                      events,
+                                      p_data,
+                                     &err);
+
+    rtn_code = (err == NET_SOCK_ERR_NONE) ? NET_BSD_ERR_NONE : NET_BSD_ERR_DFLT;
+
+    return (rtn_code);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            epoll_wait()
+*
+* Description : Wait for events on the sockets registered with a socket event poll set.
+*
+* Argument(s) : poll_id         Poll set identifier returned by epoll_create().
+*
+*               p_events        Pointer to array that will receive the ready sockets' events.
+*
+*               events_nbr_max  Maximum number of events to return in 'p_events'.
+*
+*               timeout_ms      Timeout value (in milliseconds) :
+*
+*                                    0      Do NOT wait; return immediately.
+*                                   -1      Wait forever.
+*
+* Return(s)   : Number of ready sockets returned,    if NO error(s).
+*
+*                0,                                  if timeout occurred before any socket ready.
+*
+*               NET_BSD_ERR_DFLT,                    otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) At most NET_SOCK_NBR_SOCK events are returned per call.
+*
+*               See also 'epoll_ctl()  Note #2'
+*                      & 'net_sock.c  NetSock_PollWait()'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+int  epoll_wait (        int           poll_id,
+                 struct  epoll_event  *p_events,
+                         int           events_nbr_max,
+                         int           timeout_ms)
+{
+    NET_SOCK_POLL_EVENT  events_rdy[NET_SOCK_NBR_SOCK];
+    NET_SOCK_QTY         events_nbr;
+    CPU_INT32U           timeout;
+    int                  rtn_code;
+    int                  i;
+    NET_ERR              err;
+
+
+    if ((p_events       == DEF_NULL) ||
+        (events_nbr_max <  1)) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    if (events_nbr_max > NET_SOCK_NBR_SOCK) {                   /* See Note #1.                                         */
+        events_nbr_max = NET_SOCK_NBR_SOCK;
+    }
+
+    timeout  = (timeout_ms < 0) ? NET_TMR_TIME_INFINITE : (CPU_INT32U)timeout_ms;
+
+    rtn_code = (int)NetSock_PollWait((NET_SOCK_POLL_ID)poll_id,
+                                                       &events_rdy[0],
+                                     (NET_SOCK_QTY    )events_nbr_max,
+                                                        timeout,
+                                                       &err);
+    if (rtn_code <= 0) {
+        return (rtn_code);
+    }
+
+    events_nbr = (NET_SOCK_QTY)rtn_code;
+    for (i = 0; i < events_nbr; i++) {
+        p_events[i].events = events_rdy[i].Events;
+        if (events_rdy[i].DataPtr != DEF_NULL) {                /* See 'epoll_ctl()  Note #2'.                          */
+            p_events[i].data.ptr = events_rdy[i].DataPtr;
+        } else {
+            p_events[i].data.fd  = events_rdy[i].SockID;
+        }
+    }
+
+    return (rtn_code);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             inet_addr()
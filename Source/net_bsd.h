@@ -122,6 +122,21 @@
 #define  FD_MAX                   (FD_SETSIZE - 1)
 #define  FD_ARRAY_SIZE          (((FD_SETSIZE - 1) / (sizeof(CPU_DATA) * DEF_OCTET_NBR_BITS)) + 1)
 
+                                                                /* ---------------- SCATTER/GATHER I/O ---------------- */
+#define  IOV_MAX                   NET_SOCK_CFG_DATA_VEC_NBR_MAX
+
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+                                                                /* ------------------- EVENT POLL --------------------- */
+#define  EPOLLIN                   NET_SOCK_SEL_EVENT_FLAG_RD
+#define  EPOLLOUT                  NET_SOCK_SEL_EVENT_FLAG_WR
+#define  EPOLLERR                  NET_SOCK_SEL_EVENT_FLAG_ERR
+#define  EPOLLET                   NET_SOCK_POLL_EVENT_FLAG_EDGE
+
+#define  EPOLL_CTL_ADD             NET_SOCK_POLL_OP_ADD
+#define  EPOLL_CTL_MOD             NET_SOCK_POLL_OP_MOD
+#define  EPOLL_CTL_DEL             NET_SOCK_POLL_OP_DEL
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -493,6 +508,40 @@ struct  fd_set {                                                        /* See N
     CPU_DATA              fds_bits[FD_ARRAY_SIZE];
 };
 
+
+struct  iovec {                                                         /* See 'net_bsd.c  sendmsg()  Note #1'.         */
+            void         *iov_base;                                     /* Base addr of app data buf.                   */
+           _size_t        iov_len;                                      /* Len of app data buf (in octets).             */
+};
+
+struct  msghdr {
+            void         *msg_name;                                     /* Optional sock addr.                          */
+            socklen_t     msg_namelen;                                  /* Size of sock addr.                           */
+    struct  iovec        *msg_iov;                                      /* Scatter/gather array.                        */
+            int           msg_iovlen;                                   /* Nbr of elems in msg_iov (see IOV_MAX).       */
+            void         *msg_control;                                  /* Ancillary data (see 'net_bsd.c  sendmsg()    */
+            socklen_t     msg_controllen;                               /* ... Note #2').                               */
+            int           msg_flags;                                    /* Flags on rx'd msg.                           */
+};
+
+struct  mmsghdr {                                                       /* See 'net_bsd.c  sendmmsg()  Note #1'.        */
+    struct  msghdr        msg_hdr;                                      /* Msg hdr.                                     */
+            unsigned int  msg_len;                                      /* Nbr of octets tx'd/rx'd for msg.             */
+};
+
+
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+typedef  union  epoll_data {                                            /* See 'net_bsd.c  epoll_ctl()  Note #2'.       */
+    void                 *ptr;
+    int                   fd;
+} epoll_data_t;
+
+struct  epoll_event {
+    CPU_INT32U            events;                                       /* EPOLLIN/EPOLLOUT/EPOLLERR/EPOLLET.           */
+    epoll_data_t          data;
+};
+#endif
+
 struct  addrinfo {                                                      /* Structure and type definitions for addrinfo. */
             int           ai_flags;                                     /* Flags: AI_PASSIVE, AI_AI_NUMERICHOST, etc.   */
             int           ai_family;                                    /* Address family: AF_xxx.                      */
@@ -797,6 +846,16 @@ extern "C" {
                                                 _size_t      data_buf_len,
                                                  int         flags);
 
+       ssize_t       recvmsg     (               int         sock_id,
+                                        struct   msghdr     *p_msg,
+                                                 int         flags);
+
+       int           recvmmsg    (               int         sock_id,
+                                        struct   mmsghdr    *p_msgvec,
+                                        unsigned int         vlen,
+                                                 int         flags,
+                                        struct   timeval    *p_timeout);
+
 
                                                                         /* ----------------- TX FNCTS ----------------- */
        ssize_t       sendto      (               int         sock_id,
@@ -811,6 +870,15 @@ extern "C" {
                                                 _size_t      data_len,
                                                  int         flags);
 
+       ssize_t       sendmsg     (               int         sock_id,
+                                        struct   msghdr     *p_msg,
+                                                 int         flags);
+
+       int           sendmmsg    (               int         sock_id,
+                                        struct   mmsghdr    *p_msgvec,
+                                        unsigned int         vlen,
+                                                 int         flags);
+
 
                                                                         /* ------------ MULTIPLEX I/O FNCTS ----------- */
        int           select      (               int         desc_nbr_max,
@@ -819,6 +887,22 @@ extern "C" {
                                          struct  fd_set     *p_desc_err,
                                          struct  timeval    *p_timeout);
 
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+       int           epoll_create(               int         size);
+
+       int           epoll_close (               int         poll_id);
+
+       int           epoll_ctl   (               int         poll_id,
+                                                 int         op,
+                                                 int         sock_id,
+                                         struct  epoll_event *p_event);
+
+       int           epoll_wait  (               int         poll_id,
+                                         struct  epoll_event *p_events,
+                                                 int         events_nbr_max,
+                                                 int         timeout_ms);
+#endif
+
 
                                                                         /* ---------------- CONV FCNTS ---------------- */
        in_addr_t     inet_addr   (               char       *p_addr);
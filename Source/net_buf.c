@@ -2111,6 +2111,493 @@ void  NetBuf_DataCopy (NET_BUF       *p_buf_dest,
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetBuf_DataRdVec()
+*
+* Description : Read data from network buffer's DATA area into a data vector.
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area.
+*
+*               len         Number of octets to read.
+*
+*               p_cursor    Pointer to data vector cursor to read data into (see Note #1).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Read from network buffer DATA area successful.
+*                               NET_BUF_ERR_INVALID_LEN         Data vector too small for 'len' octets.
+*
+*                                                               -------- RETURNED BY NetBuf_DataRd() : --------
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_TYPE        Argument 'p_buf's TYPE is invalid or unknown.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxAppData(),
+*               NetUDP_RxAppData().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The data vector cursor is advanced past the octets read so that consecutive reads
+*                   from several network buffers fill the data vector in order (see 'net_buf.h  NETWORK
+*                   BUFFER DATA VECTOR DATA TYPES  Note #1b').
+*
+*               (2) Data vector application buffer sizes NOT validated beyond their configured lengths;
+*                   see also 'NetBuf_DataRd()  Note #3'.
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataRdVec (NET_BUF                  *p_buf,
+                        NET_BUF_SIZE              ix,
+                        NET_BUF_SIZE              len,
+                        NET_BUF_DATA_VEC_CURSOR  *p_cursor,
+                        NET_ERR                  *p_err)
+{
+    NET_BUF_DATA_VEC  *p_vec;
+    NET_BUF_SIZE       len_vec;
+    CPU_INT08U        *p_dest;
+
+
+   *p_err = NET_BUF_ERR_NONE;
+
+    while (len > 0) {
+        p_vec = p_cursor->VecPtr;
+                                                                /* Skip exhausted vec elem(s).                          */
+        while ((p_cursor->VecNbr >  0) &&
+               (p_cursor->VecIx  >= p_vec->DataLen)) {
+            p_vec++;
+            p_cursor->VecPtr = p_vec;
+            p_cursor->VecNbr--;
+            p_cursor->VecIx  = 0u;
+        }
+
+        if (p_cursor->VecNbr < 1) {                             /* If vec exhausted, rtn err.                           */
+            NET_CTR_ERR_INC(Net_ErrCtrs.Buf.LenCtr);
+           *p_err = NET_BUF_ERR_INVALID_LEN;
+            return;
+        }
+
+        len_vec = (NET_BUF_SIZE)(p_vec->DataLen - p_cursor->VecIx);
+        len_vec = (NET_BUF_SIZE)DEF_MIN(len_vec, len);
+        p_dest  = (CPU_INT08U *)p_vec->DataPtr + p_cursor->VecIx;
+
+        NetBuf_DataRd(p_buf, ix, len_vec, p_dest, p_err);
+        if (*p_err != NET_BUF_ERR_NONE) {
+             return;
+        }
+
+        ix              += len_vec;
+        len             -= len_vec;
+        p_cursor->VecIx += len_vec;                             /* Adv cursor (see Note #1).                            */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBuf_DataWrVec()
+*
+* Description : Write data from a data vector into network buffer's DATA area.
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area.
+*
+*               len         Number of octets to write.
+*
+*               p_cursor    Pointer to data vector cursor to write data from (see Note #1).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Write to network buffer DATA area successful.
+*                               NET_BUF_ERR_INVALID_LEN         Data vector holds less than 'len' octets.
+*
+*                                                               -------- RETURNED BY NetBuf_DataWr() : --------
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_TYPE        Argument 'p_buf's TYPE is invalid or unknown.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnAppData(),
+*               NetUDP_TxAppDataHandlerIPv4(),
+*               NetUDP_TxAppDataHandlerIPv6().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) See 'NetBuf_DataRdVec()  Note #1'.
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataWrVec (NET_BUF                  *p_buf,
+                        NET_BUF_SIZE              ix,
+                        NET_BUF_SIZE              len,
+                        NET_BUF_DATA_VEC_CURSOR  *p_cursor,
+                        NET_ERR                  *p_err)
+{
+    NET_BUF_DATA_VEC  *p_vec;
+    NET_BUF_SIZE       len_vec;
+    CPU_INT08U        *p_src;
+
+
+   *p_err = NET_BUF_ERR_NONE;
+
+    while (len > 0) {
+        p_vec = p_cursor->VecPtr;
+                                                                /* Skip exhausted vec elem(s).                          */
+        while ((p_cursor->VecNbr >  0) &&
+               (p_cursor->VecIx  >= p_vec->DataLen)) {
+            p_vec++;
+            p_cursor->VecPtr = p_vec;
+            p_cursor->VecNbr--;
+            p_cursor->VecIx  = 0u;
+        }
+
+        if (p_cursor->VecNbr < 1) {                             /* If vec exhausted, rtn err.                           */
+            NET_CTR_ERR_INC(Net_ErrCtrs.Buf.LenCtr);
+           *p_err = NET_BUF_ERR_INVALID_LEN;
+            return;
+        }
+
+        len_vec = (NET_BUF_SIZE)(p_vec->DataLen - p_cursor->VecIx);
+        len_vec = (NET_BUF_SIZE)DEF_MIN(len_vec, len);
+        p_src   = (CPU_INT08U *)p_vec->DataPtr + p_cursor->VecIx;
+
+        NetBuf_DataWr(p_buf, ix, len_vec, p_src, p_err);
+        if (*p_err != NET_BUF_ERR_NONE) {
+             return;
+        }
+
+        ix              += len_vec;
+        len             -= len_vec;
+        p_cursor->VecIx += len_vec;                             /* Adv cursor (see Note #1).                            */
+    }
+}
+
+
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+/*
+*********************************************************************************************************
+*                                         NetBuf_DataExtSet()
+*
+* Description : Reference application data into network buffer's DATA area without copying the data.
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area.
+*
+*               len         Number of octets to reference.
+*
+*               p_cursor    Pointer to external data cursor to reference data from (see Note #1).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Application data successfully referenced.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf'/'p_cursor' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_TYPE        Buffer already references application data
+*                                                                   (see Note #2).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnAppData(),
+*               NetUDP_TxAppDataHandlerIPv4(),
+*               NetUDP_TxAppDataHandlerIPv6().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The buffer references 'len' octets from the cursor's current application data & takes a
+*                   reference on the cursor's external data reference; the cursor is then advanced past the
+*                   referenced octets.
+*
+*                   See also 'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES  Note #1'.
+*
+*               (2) A network buffer references at most one application data area.
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataExtSet (NET_BUF                  *p_buf,
+                         NET_BUF_SIZE              ix,
+                         NET_BUF_SIZE              len,
+                         NET_BUF_DATA_EXT_CURSOR  *p_cursor,
+                         NET_ERR                  *p_err)
+{
+    NET_BUF_HDR   *p_buf_hdr;
+    NET_BUF_SIZE   len_data;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ------------------ VALIDATE PTRS ------------------- */
+    if ((p_buf    == (NET_BUF                 *)0) ||
+        (p_cursor == (NET_BUF_DATA_EXT_CURSOR *)0)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (len < 1) {                                              /* If req'd len = 0, rtn null ref.                      */
+       *p_err = NET_BUF_ERR_NONE;
+        return;
+    }
+
+    p_buf_hdr = &p_buf->Hdr;
+    if (p_buf_hdr->DataExtRefPtr != DEF_NULL) {                 /* See Note #2.                                         */
+       *p_err = NET_BUF_ERR_INVALID_TYPE;
+        return;
+    }
+
+                                                                /* ----------------- VALIDATE IX/SIZE ----------------- */
+    if (ix >= p_buf_hdr->Size) {                                /* If req'd ix  > size, rtn err.                        */
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.IxCtr);
+#endif
+       *p_err = NET_BUF_ERR_INVALID_IX;
+        return;
+    }
+
+    len_data = ix + len;
+    if (len_data > p_buf_hdr->Size) {                           /* If req'd len > size, rtn err.                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.LenCtr);
+       *p_err = NET_BUF_ERR_INVALID_LEN;
+        return;
+    }
+
+                                                                /* ------------------ REF BUF DATA -------------------- */
+    p_buf_hdr->DataExtPtr    = p_cursor->DataPtr;
+    p_buf_hdr->DataExtRefPtr = p_cursor->RefPtr;
+    p_buf_hdr->DataExtIx     = ix;
+    p_buf_hdr->DataExtLen    = len;
+
+    p_cursor->RefPtr->RefCtr++;
+    p_cursor->DataPtr       += len;                             /* Adv cursor (see Note #1).                            */
+
+   *p_err = NET_BUF_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetBuf_DataExtCopy()
+*
+* Description : Copy network buffer's referenced application data into the buffer's DATA area & release the
+*               buffer's external data reference.
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Referenced data successfully copied, or buffer
+*                                                                   does NOT reference application data.
+*
+*                                                               -------- RETURNED BY NetBuf_DataWr() : --------
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_TYPE        Argument 'p_buf's TYPE is invalid or unknown.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length (outside buffer's DATA area).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_TxPktDataExtPrepare(),
+*               NetIF_Loopback_Tx(),
+*               NetTCP_TxConnReTxQ().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Called wherever referenced data MUST be contiguous with the buffer's protocol headers or
+*                   MUST be moved within the buffer's DATA area.  Since the referenced data's part of the
+*                   DATA area is reserved (see 'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES
+*                   Note #1a'), the copy always fits.
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataExtCopy (NET_BUF  *p_buf,
+                          NET_ERR  *p_err)
+{
+    NET_BUF_HDR           *p_buf_hdr;
+    NET_BUF_DATA_EXT_REF  *p_ref;
+
+
+    p_buf_hdr = &p_buf->Hdr;
+    p_ref     =  p_buf_hdr->DataExtRefPtr;
+    if (p_ref == (NET_BUF_DATA_EXT_REF *)0) {                   /* If NO ref'd data, nothing to copy.                   */
+       *p_err = NET_BUF_ERR_NONE;
+        return;
+    }
+
+    NetBuf_DataWr((NET_BUF    *)p_buf,
+                  (NET_BUF_SIZE)p_buf_hdr->DataExtIx,
+                  (NET_BUF_SIZE)p_buf_hdr->DataExtLen,
+                  (CPU_INT08U *)p_buf_hdr->DataExtPtr,
+                  (NET_ERR    *)p_err);
+    if (*p_err != NET_BUF_ERR_NONE) {
+         return;
+    }
+
+    p_buf_hdr->DataExtPtr    = (CPU_INT08U           *)0;
+    p_buf_hdr->DataExtRefPtr = (NET_BUF_DATA_EXT_REF *)0;
+    p_buf_hdr->DataExtIx     =  NET_BUF_IX_NONE;
+    p_buf_hdr->DataExtLen    =  0u;
+
+    NetBuf_DataExtRefRelease(p_ref);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NetBuf_DataExtRefRelease()
+*
+* Description : Release a reference on application data &, on the last reference, signal the application.
+*
+* Argument(s) : p_ref       Pointer to an external data reference.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBuf_DataExtCopy(),
+*               NetBuf_FreeHandler(),
+*               NetSock_TxDataRef().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) See 'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES  Note #1b'.
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataExtRefRelease (NET_BUF_DATA_EXT_REF  *p_ref)
+{
+    if (p_ref->RefCtr < 1u) {
+        return;
+    }
+
+    p_ref->RefCtr--;
+    if (p_ref->RefCtr > 0u) {
+        return;
+    }
+
+    if (p_ref->FnctPtr != (NET_BUF_DATA_EXT_FNCT)0) {           /* On last ref, signal app (see Note #1).               */
+        p_ref->FnctPtr(p_ref->FnctArgPtr);
+    }
+}
+#endif
+
+
+#ifdef  NET_SOCK_TX_FILE_MODULE_EN
+/*
+*********************************************************************************************************
+*                                         NetBuf_DataWrFile()
+*
+* Description : Read data from a file directly into network buffer's DATA area.
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area.
+*
+*               len         Number of octets to read.
+*
+*               p_cursor    Pointer to file data cursor to read data from (see Note #1).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Write to network buffer DATA area successful.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf'/'p_cursor' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length (outside buffer's DATA area),
+*                                                                   or file read failed (see Note #2).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnAppData().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The file data is read in place into the buffer's DATA area; the file read function may
+*                   return fewer octets than requested per call & is called until 'len' octets are read.
+*
+*               (2) If the file read function fails or returns NO octets, the cursor's file read error is
+*                   latched (see 'net_buf.h  NETWORK BUFFER FILE DATA DATA TYPES  Note #1c').
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataWrFile (NET_BUF                   *p_buf,
+                         NET_BUF_SIZE               ix,
+                         NET_BUF_SIZE               len,
+                         NET_BUF_DATA_FILE_CURSOR  *p_cursor,
+                         NET_ERR                   *p_err)
+{
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    NET_BUF_HDR   *p_buf_hdr;
+    NET_BUF_SIZE   len_data;
+#endif
+    CPU_INT08U    *p_data;
+    CPU_SIZE_T     size_rd;
+    CPU_BOOLEAN    ok;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE PTRS --------------------- */
+    if ((p_buf    == (NET_BUF                  *)0) ||
+        (p_cursor == (NET_BUF_DATA_FILE_CURSOR *)0)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (len < 1) {                                              /* If req'd len = 0, rtn null wr.                       */
+       *p_err = NET_BUF_ERR_NONE;
+        return;
+    }
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ----------------- VALIDATE IX/SIZE ----------------- */
+    p_buf_hdr = &p_buf->Hdr;
+    if (ix >= p_buf_hdr->Size) {                                /* If req'd ix  > size, rtn err.                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.IxCtr);
+       *p_err = NET_BUF_ERR_INVALID_IX;
+        return;
+    }
+
+    len_data = ix + len;
+    if (len_data > p_buf_hdr->Size) {                           /* If req'd len > size, rtn err.                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.LenCtr);
+       *p_err = NET_BUF_ERR_INVALID_LEN;
+        return;
+    }
+#endif
+
+                                                                /* ---------------- RD FILE INTO BUF ------------------ */
+    p_data = &p_buf->DataPtr[ix];
+    while (len > 0) {                                           /* Rd until req'd len rd (see Note #1).                 */
+        size_rd = 0u;
+        ok      = p_cursor->RdFnct(p_cursor->FilePtr, (void *)p_data, (CPU_SIZE_T)len, &size_rd);
+        if ((ok      != DEF_OK) ||                              /* If file rd failed or NO data rd, ...                 */
+            (size_rd <  1u)     ||
+            (size_rd >  len)) {
+            p_cursor->RdErr = DEF_YES;                          /* ... latch rd err (see Note #2).                      */
+           *p_err           = NET_BUF_ERR_INVALID_LEN;
+            return;
+        }
+
+        p_data += size_rd;
+        len    -= (NET_BUF_SIZE)size_rd;
+    }
+
+   *p_err = NET_BUF_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           NetBuf_IsUsed()
@@ -2788,6 +3275,9 @@ exit_release:
 *
 *               (3) If a network buffer's unlink function is available, it is assumed that the function
 *                   correctly unlinks the network buffer from any other network layer(s).
+*
+*               (4) Freeing a zero-copy transmit buffer releases its reference on the application data; see
+*                   'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES  Note #1b'.
 *********************************************************************************************************
 */
 
@@ -2860,6 +3350,15 @@ static  void  NetBuf_FreeHandler (NET_BUF  *p_buf)
     }
 
 
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+                                                                /* ------------------ RELEASE EXT DATA ---------------- */
+    if (p_buf_hdr->DataExtRefPtr != DEF_NULL) {                 /* If buf refs app data, release ref (see Note #4).     */
+        NetBuf_DataExtRefRelease(p_buf_hdr->DataExtRefPtr);
+        p_buf_hdr->DataExtRefPtr = (NET_BUF_DATA_EXT_REF *)0;
+    }
+#endif
+
+
                                                                 /* ---------------------- CLR BUF --------------------- */
     DEF_BIT_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_USED);           /* Set buf as NOT used.                                 */
 
@@ -2971,6 +3470,12 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
     p_buf_hdr->DataIx                   =  NET_BUF_IX_NONE;
     p_buf_hdr->DataLen                  =  0u;
     p_buf_hdr->TotLen                   =  0u;
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+    p_buf_hdr->DataExtPtr               = (CPU_INT08U           *)0;
+    p_buf_hdr->DataExtRefPtr            = (NET_BUF_DATA_EXT_REF *)0;
+    p_buf_hdr->DataExtIx                =  NET_BUF_IX_NONE;
+    p_buf_hdr->DataExtLen               =  0u;
+#endif
 
 #ifdef  NET_ARP_MODULE_EN
     p_buf_hdr->ARP_AddrHW_Ptr           = (CPU_INT08U *)0;
@@ -2980,6 +3485,7 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
     p_buf_hdr->IP_TotLen                =  0u;
     p_buf_hdr->IP_DataLen               =  0u;
     p_buf_hdr->IP_DatagramLen           =  0u;
+    p_buf_hdr->IP_ECN                   =  NET_IP_ECN_NOT_ECT;
     p_buf_hdr->IP_FragSizeTot           =  NET_IP_FRAG_SIZE_NONE;
     p_buf_hdr->IP_FragSizeCur           =  0u;
 
@@ -3038,6 +3544,11 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
     p_buf_hdr->TCP_MaxSegSize           =  NET_TCP_MAX_SEG_SIZE_NONE;
     p_buf_hdr->TCP_WinSize              =  NET_TCP_WIN_SIZE_NONE;
     p_buf_hdr->TCP_WinSizeLast          =  NET_TCP_WIN_SIZE_NONE;
+    p_buf_hdr->TCP_WinScale             =  NET_TCP_WIN_SCALE_NONE;
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    p_buf_hdr->TCP_FastOpenCookieLen    =  NET_TCP_FAST_OPEN_COOKIE_LEN_NONE;
+    p_buf_hdr->TCP_FastOpenCookieIx     =  NET_BUF_IX_NONE;
+#endif
     p_buf_hdr->TCP_RTT_TS_Rxd_ms        =  NET_TCP_TX_RTT_TS_NONE;
     p_buf_hdr->TCP_RTT_TS_Txd_ms        =  NET_TCP_TX_RTT_TS_NONE;
     p_buf_hdr->TCP_Flags                =  NET_TCP_FLAG_NONE;
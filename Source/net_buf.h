@@ -312,6 +312,46 @@ typedef  enum  net_buf_type {
 } NET_BUF_TYPE;
 
 
+/*
+*********************************************************************************************************
+*                           NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES
+*
+* Note(s) : (1) (a) Zero-copy transmit buffers reference application data in place rather than copying it into
+*                   the buffer's DATA area.  The referenced data logically occupies the buffer's DATA area
+*                   from 'DataExtIx' for 'DataExtLen' octets; this part of the DATA area is reserved but
+*                   NOT written.
+*
+*               (b) An external data reference is owned by the application & counts the network buffers
+*                   that reference its data.  When the last buffer releases its reference (i.e. once the
+*                   buffer is freed or its referenced data is copied into its DATA area), the reference's
+*                   completion function is called with the reference's argument.
+*
+*               (c) An external data cursor tracks the current position within the referenced application
+*                   data as it is split across network buffers.
+*
+*           (2) The completion function is called with the global network lock acquired & MUST NOT call
+*               any network protocol suite function; it SHOULD only signal the application.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+typedef  void  (*NET_BUF_DATA_EXT_FNCT)(void  *p_arg);
+
+
+typedef  struct  net_buf_data_ext_ref {
+    NET_BUF_DATA_EXT_FNCT   FnctPtr;                            /* Ptr to app completion fnct (see Note #2).            */
+    void                   *FnctArgPtr;                         /* Ptr to app completion fnct arg.                      */
+    CPU_INT16U              RefCtr;                             /* Nbr of refs to app data.                             */
+} NET_BUF_DATA_EXT_REF;
+
+
+typedef  struct  net_buf_data_ext_cursor {
+    CPU_INT08U             *DataPtr;                            /* Ptr to cur app data.                                 */
+    NET_BUF_DATA_EXT_REF   *RefPtr;                             /* Ptr to app data ref.                                 */
+} NET_BUF_DATA_EXT_CURSOR;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   NETWORK BUFFER HEADER DATA TYPE
@@ -387,6 +427,9 @@ typedef  enum  net_buf_type {
 *
 *               (a) TCP transmit acknowledgement code variables ideally declared as 'NET_TCP_ACK_CODE';
 *                       declared as 'CPU_INT08U'.
+*
+*           (4) Zero-copy transmit buffers reference application data outside the DATA area; see 'NETWORK
+*               BUFFER EXTERNAL DATA REFERENCE DATA TYPES  Note #1a'.
 *********************************************************************************************************
 */
 
@@ -449,6 +492,7 @@ typedef  struct  net_buf_hdr {
     CPU_INT16U             IP_TotLen;                   /* IP                   tot  len (in octets   ).                */
     CPU_INT16U             IP_DataLen;                  /* IP pkt/frag          data len (in octets   ).                */
     CPU_INT16U             IP_DatagramLen;              /* IP complete datagram data len (in octets   ).                */
+    CPU_INT08U             IP_ECN;                      /* IP rx ECN codepoint.                                         */
 
     CPU_INT16U             ICMP_MsgIx;                  /* ICMP                 msg  ix  (in DATA area).                */
     CPU_INT16U             ICMP_MsgLen;                 /* ICMP                 msg  len (in octets   ).                */
@@ -470,6 +514,13 @@ typedef  struct  net_buf_hdr {
 
     NET_BUF_SIZE           TotLen;                      /* ALL                  DATA len (in octets   ).                */
 
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+    CPU_INT08U            *DataExtPtr;                  /* Ptr to ext app data (see Note #4).                           */
+    NET_BUF_DATA_EXT_REF  *DataExtRefPtr;               /* Ptr to ext app data ref.                                     */
+    CPU_INT16U             DataExtIx;                   /* Ext app              DATA ix  (in DATA area).                */
+    CPU_INT16U             DataExtLen;                  /* Ext app              DATA len (in octets   ).                */
+#endif
+
 
 
 #ifdef  NET_ARP_MODULE_EN
@@ -546,6 +597,11 @@ typedef  struct  net_buf_hdr {
     NET_TCP_SEG_SIZE       TCP_MaxSegSize;              /* TCP max   seg size.                                          */
     NET_TCP_WIN_SIZE       TCP_WinSize;                 /* TCP       win size.                                          */
     NET_TCP_WIN_SIZE       TCP_WinSizeLast;             /* TCP last  win size.                                          */
+    CPU_INT08U             TCP_WinScale;                /* TCP       win scale shift opt.                               */
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    CPU_INT08U             TCP_FastOpenCookieLen;       /* TCP Fast Open cookie len.                                    */
+    CPU_INT16U             TCP_FastOpenCookieIx;        /* TCP Fast Open cookie ix  (in DATA area).                     */
+#endif
 
     NET_TCP_TX_RTT_TS_MS   TCP_RTT_TS_Rxd_ms;           /* TCP RTT TS @ seg rx'd (in ms).                               */
     NET_TCP_TX_RTT_TS_MS   TCP_RTT_TS_Txd_ms;           /* TCP RTT TS @ seg tx'd (in ms).                               */
@@ -620,6 +676,67 @@ typedef  struct  net_buf_pools {
 } NET_BUF_POOLS;
 
 
+/*
+*********************************************************************************************************
+*                                 NETWORK BUFFER DATA VECTOR DATA TYPES
+*
+* Note(s) : (1) (a) A data vector describes application data scattered across several application buffers
+*                   (e.g. a protocol header, body & trailer).
+*
+*               (b) A data vector cursor tracks the current position within a data vector so that
+*                   NetBuf_DataRdVec() & NetBuf_DataWrVec() may copy data directly between network buffer
+*                   DATA areas & the vector's application buffers, across as many network buffers as
+*                   required, without staging the data in a contiguous buffer.
+*********************************************************************************************************
+*/
+
+typedef  struct  net_buf_data_vec {
+    void              *DataPtr;                                 /* Ptr to app data buf.                                 */
+    CPU_INT16U         DataLen;                                 /* App data buf len (in octets).                        */
+} NET_BUF_DATA_VEC;
+
+
+typedef  struct  net_buf_data_vec_cursor {
+    NET_BUF_DATA_VEC  *VecPtr;                                  /* Ptr to cur data vec elem.                            */
+    CPU_INT16U         VecNbr;                                  /* Nbr of data vec elems rem'ing (incl cur elem).       */
+    CPU_INT16U         VecIx;                                   /* Ix into cur data vec elem's app data buf.            */
+} NET_BUF_DATA_VEC_CURSOR;
+
+
+/*
+*********************************************************************************************************
+*                                  NETWORK BUFFER FILE DATA DATA TYPES
+*
+* Note(s) : (1) (a) A file data cursor describes a file whose data is read directly into network buffer
+*                   DATA areas by NetBuf_DataWrFile(), without staging the data in an application buffer.
+*
+*               (b) The file read function's signature matches NetFS_FileRd() (see 'net_fs.h  FUNCTION
+*                   PROTOTYPES') so that network file system files may be transmitted directly; it MUST
+*                   return DEF_OK & the number of octets read, or DEF_FAIL on error or end-of-file.
+*
+*               (c) 'RdErr' latches any file read error or premature end-of-file; the file's position is
+*                   then undefined.
+*
+*           (2) The file read function is called with the network lock held & MUST NOT call any network
+*               protocol suite function.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_TX_FILE_MODULE_EN
+typedef  CPU_BOOLEAN  (*NET_BUF_DATA_FILE_RD_FNCT)(void        *p_file,
+                                                   void        *p_dest,
+                                                   CPU_SIZE_T   size,
+                                                   CPU_SIZE_T  *p_size_rd);
+
+
+typedef  struct  net_buf_data_file_cursor {
+    void                       *FilePtr;                        /* Ptr to file.                                         */
+    NET_BUF_DATA_FILE_RD_FNCT   RdFnct;                         /* Ptr to file rd fnct (see Note #1b).                  */
+    CPU_BOOLEAN                 RdErr;                          /* File rd err latch   (see Note #1c).                  */
+} NET_BUF_DATA_FILE_CURSOR;
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -790,6 +907,39 @@ void           NetBuf_DataCopy                   (NET_BUF          *p_buf_dest,
                                                   NET_BUF_SIZE      len,
                                                   NET_ERR          *p_err);
 
+void           NetBuf_DataRdVec                  (NET_BUF                  *p_buf,
+                                                  NET_BUF_SIZE              ix,
+                                                  NET_BUF_SIZE              len,
+                                                  NET_BUF_DATA_VEC_CURSOR  *p_cursor,
+                                                  NET_ERR                  *p_err);
+
+void           NetBuf_DataWrVec                  (NET_BUF                  *p_buf,
+                                                  NET_BUF_SIZE              ix,
+                                                  NET_BUF_SIZE              len,
+                                                  NET_BUF_DATA_VEC_CURSOR  *p_cursor,
+                                                  NET_ERR                  *p_err);
+
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+void           NetBuf_DataExtSet                 (NET_BUF                  *p_buf,
+                                                  NET_BUF_SIZE              ix,
+                                                  NET_BUF_SIZE              len,
+                                                  NET_BUF_DATA_EXT_CURSOR  *p_cursor,
+                                                  NET_ERR                  *p_err);
+
+void           NetBuf_DataExtCopy                (NET_BUF                  *p_buf,
+                                                  NET_ERR                  *p_err);
+
+void           NetBuf_DataExtRefRelease          (NET_BUF_DATA_EXT_REF     *p_ref);
+#endif
+
+#ifdef  NET_SOCK_TX_FILE_MODULE_EN
+void           NetBuf_DataWrFile                 (NET_BUF                  *p_buf,
+                                                  NET_BUF_SIZE              ix,
+                                                  NET_BUF_SIZE              len,
+                                                  NET_BUF_DATA_FILE_CURSOR *p_cursor,
+                                                  NET_ERR                  *p_err);
+#endif
+
 
                                                                             /* ----------- BUF STATUS FNCTS ----------- */
 CPU_BOOLEAN    NetBuf_IsUsed                     (NET_BUF          *p_buf);
@@ -1197,12 +1197,12 @@ void  NetCache_Remove (NET_CACHE_ADDR  *pcache,
 *
 * Return(s)   : none.
 *
-* Caller(s)   : Referenced in NetARP_CacheHandler(),
-*                             NetARP_CacheAddPend(),
-*                             NetNDP_CacheHandler(),
-*                             NetNDP_CacheAddPend().
+* Caller(s)   : NetCache_TxQ_Add().
 *
-* Note(s)     : none.
+*               Referenced in NetCache_TxQ_Add() as queued buffers' unlink function.
+*
+* Note(s)     : (1) Unlinked buffers are no longer pending address resolution; both the cache's & the
+*                   global pending transmit queue counts are decremented (see 'NetCache_TxQ_Add()  Note #2').
 *********************************************************************************************************
 */
 
@@ -1259,6 +1259,13 @@ void  NetCache_UnlinkBuf (NET_BUF  *pbuf)
     } else {
         pcache->TxQ_Tail              =  pbuf_prev;
     }
+                                                                /* Update cache & global pending tx Q cnts.             */
+    if (pcache->TxQ_Nbr > 0u) {
+        pcache->TxQ_Nbr--;
+    }
+    if (NetCache_TxQ_PendNbr > 0u) {
+        NetCache_TxQ_PendNbr--;
+    }
 
 
                                                                 /* -------------- CLR BUF'S UNLINK CTRLS -------------- */
@@ -1270,6 +1277,172 @@ void  NetCache_UnlinkBuf (NET_BUF  *pbuf)
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetCache_TxQ_Add()
+*
+* Description : (1) Append a network buffer to a cache's pending transmit queue :
+*
+*                   (a) Enforce cache's  pending transmit queue threshold        See Note #2a
+*                   (b) Enforce global   pending transmit buffer maximum         See Note #2b
+*                   (c) Append  buffer @ pending transmit queue tail
+*                   (d) Configure buffer's unlink function/object
+*
+*
+* Argument(s) : pcache      Pointer to a cache in a pending state.
+*               ------      Argument checked in caller(s).
+*
+*               pbuf        Pointer to network buffer to transmit once the cache is resolved.
+*               ----        Argument checked in caller(s).
+*
+*               buf_max_th  Maximum number of buffers to queue on this cache.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_CACHE_ERR_NONE                  Buffer successfully queued.
+*                               NET_CACHE_ERR_UNRESOLVED            Pending transmit queue full; buffer
+*                                                                       NOT queued (see Note #3b).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetARP_CacheHandler(),
+*               NetARP_CacheAddPend(),
+*               NetNDP_CacheHandler(),
+*               NetNDP_CacheAddPend().
+*
+* Note(s)     : (2) Buffers pending address resolution are bounded :
+*
+*                   (a) per cache by the ARP/NDP cache transmit queue threshold, configured by
+*                       NetARP_CfgCacheTxQ_MaxTh() / NetNDP_CfgCacheTxQ_MaxTh();
+*
+*                   (b) across ALL caches by NET_CACHE_CFG_TX_Q_PEND_MAX, so that unresolved neighbors
+*                       cannot exhaust the network buffer pools.
+*
+*               (3) When either bound is reached :
+*
+*                   (a) If NET_CACHE_CFG_TX_Q_DROP_OLDEST_EN is enabled, the oldest buffer queued on this
+*                       cache is freed to make room for the new buffer.
+*
+*                   (b) Otherwise, or if this cache has NO queued buffers, the new buffer is NOT queued
+*                       & the caller MUST discard it.
+*********************************************************************************************************
+*/
+
+void  NetCache_TxQ_Add (NET_CACHE_ADDR  *pcache,
+                        NET_BUF         *pbuf,
+                        NET_BUF_QTY      buf_max_th,
+                        NET_ERR         *p_err)
+{
+    NET_BUF      *pbuf_tail;
+    NET_BUF_HDR  *pbuf_hdr;
+    NET_BUF_HDR  *pbuf_hdr_tail;
+#if (NET_CACHE_CFG_TX_Q_DROP_OLDEST_EN == DEF_ENABLED)
+    NET_BUF      *pbuf_head;
+    NET_CTR      *pctr;
+#endif
+
+
+                                                                /* ---------------- CHK PENDING Q BOUNDS -------------- */
+    if ((pcache->TxQ_Nbr      >= buf_max_th) ||                 /* See Note #2.                                         */
+        (NetCache_TxQ_PendNbr >= NET_CACHE_CFG_TX_Q_PEND_MAX)) {
+#if (NET_CACHE_CFG_TX_Q_DROP_OLDEST_EN == DEF_ENABLED)
+        pbuf_head = pcache->TxQ_Head;
+        if (pbuf_head == (NET_BUF *)0) {                        /* If NO buf q'd on this cache, drop new buf.           */
+            NET_CTR_ERR_INC(Net_ErrCtrs.Cache.TxQ_PendDropCtr);
+           *p_err = NET_CACHE_ERR_UNRESOLVED;
+            return;
+        }
+                                                                /* Else free oldest q'd buf (see Note #3a).             */
+        NetCache_UnlinkBuf(pbuf_head);
+#if (NET_CTR_CFG_ERR_EN == DEF_ENABLED)
+        pctr = &Net_ErrCtrs.Cache.TxQ_PendDropCtr;
+#else
+        pctr = (NET_CTR *)0;
+#endif
+       (void)NetBuf_FreeBufList(pbuf_head, pctr);
+#else
+        NET_CTR_ERR_INC(Net_ErrCtrs.Cache.TxQ_PendDropCtr);     /* Drop new buf (see Note #3b).                         */
+       *p_err = NET_CACHE_ERR_UNRESOLVED;
+        return;
+#endif
+    }
+
+                                                                /* ------------- APPEND BUF @ PENDING Q TAIL ---------- */
+    pbuf_hdr  = &pbuf->Hdr;
+    pbuf_tail =  pcache->TxQ_Tail;
+    if (pbuf_tail != (NET_BUF *)0) {                            /* If Q NOT empty,    append buf @ Q tail.              */
+        pbuf_hdr_tail                 = &pbuf_tail->Hdr;
+        pbuf_hdr_tail->NextSecListPtr =  pbuf;
+        pbuf_hdr->PrevSecListPtr      =  pbuf_tail;
+        pcache->TxQ_Tail              =  pbuf;
+
+    } else {                                                    /* Else add buf as first q'd buf.                       */
+        pcache->TxQ_Head              =  pbuf;
+        pcache->TxQ_Tail              =  pbuf;
+    }
+
+    pcache->TxQ_Nbr++;
+    NetCache_TxQ_PendNbr++;
+                                                                /* Cfg buf's unlink fnct/obj to cache.                  */
+    pbuf_hdr->UnlinkFnctPtr = (NET_BUF_FNCT)&NetCache_UnlinkBuf;
+    pbuf_hdr->UnlinkObjPtr  = (void       *) pcache;
+
+   *p_err = NET_CACHE_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetCache_TxQ_Flush()
+*
+* Description : Transmit ALL buffers queued on a resolved cache in a single pass.
+*
+* Argument(s) : proto_type  Protocol type of the cache :
+*
+*                               NET_PROTOCOL_TYPE_ARP
+*                               NET_PROTOCOL_TYPE_NDP
+*
+*               pcache      Pointer to a cache whose hardware address was just resolved.
+*               ------      Argument checked in caller(s).
+*
+*               paddr_hw    Pointer to resolved hardware address.
+*               --------    Argument checked in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetARP_RxPktCacheUpdate(),
+*               NetNDP_RxNeighborAdvertisement().
+*
+* Note(s)     : (1) The whole pending transmit queue is detached from the cache & released from the global
+*                   pending transmit buffer count at once, then handed to NetCache_TxPktHandler() as a
+*                   single burst.
+*********************************************************************************************************
+*/
+
+void  NetCache_TxQ_Flush (NET_PROTOCOL_TYPE   proto_type,
+                          NET_CACHE_ADDR     *pcache,
+                          CPU_INT08U         *paddr_hw)
+{
+    NET_BUF  *pbuf_head;
+
+
+    pbuf_head        = pcache->TxQ_Head;                        /* Detach pending tx Q from cache (see Note #1).        */
+    pcache->TxQ_Head = (NET_BUF *)0;
+    pcache->TxQ_Tail = (NET_BUF *)0;
+
+    if (NetCache_TxQ_PendNbr > pcache->TxQ_Nbr) {
+        NetCache_TxQ_PendNbr -= pcache->TxQ_Nbr;
+    } else {
+        NetCache_TxQ_PendNbr  = 0u;
+    }
+    pcache->TxQ_Nbr  = 0u;
+
+    if (pbuf_head != (NET_BUF *)0) {
+        NetCache_TxPktHandler(proto_type, pbuf_head, paddr_hw);
+    }
+}
+
+
 /*
 *********************************************************************************************************
 *                                        NetCache_TxPktHandler()
@@ -1288,8 +1461,7 @@ void  NetCache_UnlinkBuf (NET_BUF  *pbuf)
 *
 * Return(s)   : none.
 *
-* Caller(s)   : NetARP_RxPktCacheUpdate(),
-*               NetNDP_RxNeighborAdvertisement().
+* Caller(s)   : NetCache_TxQ_Flush().
 *
 * Note(s)     : (2) Addresses MUST be in network-order.
 *
@@ -1298,6 +1470,10 @@ void  NetCache_UnlinkBuf (NET_BUF  *pbuf)
 *                   (a) "Save (rather than discard) ... packets destined to the same unresolved
 *                        IP address and" ...
 *                   (b) "Transmit the saved packet[s] when the address has been resolved."
+*
+*               (4) Since ALL buffers in a cache's pending transmit queue share the same destination
+*                   (see 'NetCache_TxQ_Flush()  Note #1'), the NDP neighbor cache is searched & its
+*                   state updated only once per queue rather than once per buffer.
 *********************************************************************************************************
 */
 
@@ -1316,6 +1492,7 @@ void  NetCache_TxPktHandler (NET_PROTOCOL_TYPE   proto_type,
     CPU_INT08U              *paddr_protocol;
     CPU_INT08U               cache_state;
     NET_TMR_TICK             timeout_tick;
+    CPU_BOOLEAN              cache_chkd;
 #endif
     CPU_INT08U              *pbuf_addr_hw;
 #ifdef  NET_NDP_MODULE_EN
@@ -1325,6 +1502,10 @@ void  NetCache_TxPktHandler (NET_PROTOCOL_TYPE   proto_type,
     NET_ERR                  err;
 
 
+#ifdef  NET_NDP_MODULE_EN
+    cache_chkd = DEF_NO;
+#endif
+
     pbuf_list = pbuf_q;
     while (pbuf_list  != (NET_BUF *)0) {                        /* Handle ALL buf lists in Q.                           */
         pbuf_hdr       = &pbuf_list->Hdr;
@@ -1351,30 +1532,33 @@ void  NetCache_TxPktHandler (NET_PROTOCOL_TYPE   proto_type,
                      Mem_Copy((void     *)pbuf_addr_hw,         /* Copy hw addr into pkt buf.                           */
                               (void     *)paddr_hw,
                               (CPU_SIZE_T)NET_IF_HW_ADDR_LEN_MAX);
-                     paddr_protocol    =  pbuf_hdr->NDP_AddrProtocolPtr;
-                     pcache_addr_ndp = (NET_CACHE_ADDR_NDP *)NetCache_AddrSrch(NET_CACHE_TYPE_NDP,
-                                                                               if_nbr,
-                                                                               paddr_protocol,
-                                                                               NET_IPv6_ADDR_SIZE,
-                                                                              &err);
-                     if (pcache_addr_ndp != (NET_CACHE_ADDR_NDP *)0) {           /* If NDP cache found, chk state.      */
-                         pcache = (NET_NDP_NEIGHBOR_CACHE *) pcache_addr_ndp->ParentPtr;
-                         cache_state = pcache->State;
-                         if (cache_state == NET_NDP_CACHE_STATE_STALE) {
-                             pcache->State = NET_NDP_CACHE_STATE_DLY;
-                             CPU_CRITICAL_ENTER();
-                             timeout_tick = NetNDP_DelayTimeout_tick;
-                             CPU_CRITICAL_EXIT();
-                             NetTmr_Set(pcache->TmrPtr,
-                                        NetNDP_DelayTimeout,
-                                        timeout_tick,
-                                       &err);
-                             if (err != NET_TMR_ERR_NONE) {                          /* If tmr unavail, free NDP cache. */
-                                 NetCache_Remove((NET_CACHE_ADDR *)pcache_addr_ndp,  /* Clr but do NOT free tmr.        */
-                                                                   DEF_YES);
-                                 return;
+                     if (cache_chkd == DEF_NO) {                 /* Chk NDP cache state once per Q (see Note #4).        */
+                         cache_chkd      = DEF_YES;
+                         paddr_protocol  = pbuf_hdr->NDP_AddrProtocolPtr;
+                         pcache_addr_ndp = (NET_CACHE_ADDR_NDP *)NetCache_AddrSrch(NET_CACHE_TYPE_NDP,
+                                                                                   if_nbr,
+                                                                                   paddr_protocol,
+                                                                                   NET_IPv6_ADDR_SIZE,
+                                                                                  &err);
+                         if (pcache_addr_ndp != (NET_CACHE_ADDR_NDP *)0) {       /* If NDP cache found, chk state.      */
+                             pcache = (NET_NDP_NEIGHBOR_CACHE *) pcache_addr_ndp->ParentPtr;
+                             cache_state = pcache->State;
+                             if (cache_state == NET_NDP_CACHE_STATE_STALE) {
+                                 pcache->State = NET_NDP_CACHE_STATE_DLY;
+                                 CPU_CRITICAL_ENTER();
+                                 timeout_tick = NetNDP_DelayTimeout_tick;
+                                 CPU_CRITICAL_EXIT();
+                                 NetTmr_Set(pcache->TmrPtr,
+                                            NetNDP_DelayTimeout,
+                                            timeout_tick,
+                                           &err);
+                                 if (err != NET_TMR_ERR_NONE) {                      /* If tmr unavail, free NDP cache. */
+                                     NetCache_Remove((NET_CACHE_ADDR *)pcache_addr_ndp,/* Clr but do NOT free tmr.        */
+                                                                       DEF_YES);
+                                     return;
+                                }
                             }
-                        }
+                         }
                      }
                      break;
 #endif
@@ -1729,7 +1913,12 @@ static  void  NetCache_AddrFree (NET_CACHE_ADDR  *pcache,
                                           pctr,
                                          &NetCache_UnlinkBuf);
 
-             pcache->TxQ_Nbr = 0;
+             if (NetCache_TxQ_PendNbr > pcache->TxQ_Nbr) {             /* Release bufs from global pending cnt.        */
+                 NetCache_TxQ_PendNbr -= pcache->TxQ_Nbr;
+             } else {
+                 NetCache_TxQ_PendNbr  = 0u;
+             }
+             pcache->TxQ_Nbr = 0u;
 
                                                                         /* --------------- CLR ARP CACHE -------------- */
              pcache_arp->State          = NET_ARP_CACHE_STATE_FREE;     /* Set ARP cache as freed/NOT used.             */
@@ -1768,7 +1957,12 @@ static  void  NetCache_AddrFree (NET_CACHE_ADDR  *pcache,
                                           (NET_CTR    *)pctr,
                                           (NET_BUF_FNCT)NetCache_UnlinkBuf);
 
-            pcache->TxQ_Nbr = 0;
+             if (NetCache_TxQ_PendNbr > pcache->TxQ_Nbr) {             /* Release bufs from global pending cnt.        */
+                 NetCache_TxQ_PendNbr -= pcache->TxQ_Nbr;
+             } else {
+                 NetCache_TxQ_PendNbr  = 0u;
+             }
+             pcache->TxQ_Nbr = 0u;
                                                                         /* --------------- CLR NDP CACHE -------------- */
              pcache_ndp->State = NET_NDP_CACHE_STATE_NONE;              /* Set NDP cache as freed/NOT used.             */
              pcache_ndp->ReqAttemptsCtr = 0;
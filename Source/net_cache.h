@@ -312,6 +312,8 @@ NET_CACHE_EXT  NET_STAT_POOL        NetCache_AddrNDP_PoolStat;
 NET_CACHE_EXT  NET_CACHE_ADDR      *NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_MAX];
 NET_CACHE_EXT  NET_CACHE_ADDR      *NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_MAX];
 
+NET_CACHE_EXT  NET_BUF_QTY          NetCache_TxQ_PendNbr;               /* Nbr of pkts pending addr resolution.         */
+
 
 /*
 *********************************************************************************************************
@@ -386,6 +388,15 @@ void                NetCache_Remove       (NET_CACHE_ADDR      *p_cache,
 void                NetCache_UnlinkBuf    (NET_BUF             *p_buf);
 
                                                                             /* --------------- TX FNCTS --------------- */
+void                NetCache_TxQ_Add      (NET_CACHE_ADDR      *p_cache,
+                                           NET_BUF             *p_buf,
+                                           NET_BUF_QTY          buf_max_th,
+                                           NET_ERR             *p_err);
+
+void                NetCache_TxQ_Flush    (NET_PROTOCOL_TYPE    proto_type,
+                                           NET_CACHE_ADDR      *p_cache,
+                                           CPU_INT08U          *p_addr_hw);
+
 void                NetCache_TxPktHandler (NET_PROTOCOL_TYPE    proto_type,
                                            NET_BUF             *p_buf_q,
                                            CPU_INT08U          *p_addr_hw);
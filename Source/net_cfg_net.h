@@ -187,6 +187,14 @@
     #define  NET_IPV4_CHK_SUM_OFFLOAD_TX
 #endif
 
+#ifndef  NET_IPv4_CFG_EARLY_DEMUX_EN
+    #define  NET_IPv4_CFG_EARLY_DEMUX_EN                        DEF_DISABLED
+#endif
+
+#if (NET_IPv4_CFG_EARLY_DEMUX_EN == DEF_ENABLED)
+    #define  NET_IPv4_EARLY_DEMUX_MODULE_EN
+#endif
+
 #endif
 
 
@@ -209,6 +217,18 @@
             #define  NET_IPv6_ADDR_AUTO_CFG_MODULE_EN
         #endif
 
+        #ifndef  NET_IPv6_CFG_FWD_EN
+            #define  NET_IPv6_CFG_FWD_EN                        DEF_DISABLED
+        #endif
+
+        #if (NET_IPv6_CFG_FWD_EN == DEF_ENABLED)
+            #define  NET_IPv6_FWD_MODULE_EN
+        #endif
+
+        #ifndef  NET_NDP_CFG_ROUTE_NBR
+            #define  NET_NDP_CFG_ROUTE_NBR                      5u
+        #endif
+
     #endif
 
 #endif
@@ -230,6 +250,18 @@
     #define  NET_MCAST_RX_MODULE_EN
     #define  NET_MCAST_TX_MODULE_EN
 
+    #ifndef  NET_MCAST_CFG_SRC_NBR_MAX
+        #define  NET_MCAST_CFG_SRC_NBR_MAX                          4u
+    #endif
+
+    #ifndef  NET_MCAST_CFG_SRC_FILTER_EN
+        #define  NET_MCAST_CFG_SRC_FILTER_EN                        DEF_DISABLED
+    #endif
+
+    #if (NET_MCAST_CFG_SRC_FILTER_EN == DEF_ENABLED)
+        #define  NET_MCAST_SRC_FILTER_MODULE_EN
+    #endif
+
 
 #elif (defined(NET_IGMP_MCAST_TX_MODULE_EN))
     #define  NET_MCAST_MODULE_EN
@@ -250,6 +282,14 @@
 
     #define  NET_CACHE_MODULE_EN                               /* See Note #1.                                         */
 
+    #ifndef  NET_CACHE_CFG_TX_Q_PEND_MAX
+        #define  NET_CACHE_CFG_TX_Q_PEND_MAX                       16u
+    #endif
+
+    #ifndef  NET_CACHE_CFG_TX_Q_DROP_OLDEST_EN
+        #define  NET_CACHE_CFG_TX_Q_DROP_OLDEST_EN                  DEF_DISABLED
+    #endif
+
 #endif
 
 
@@ -296,6 +336,52 @@
 *                   the TCP Layer via the NET_TCP_MODULE_EN #define (see 'net_tcp.h  MODULE  Note #2').
 *                   However, the presence of the TCP Layer MUST be configured PRIOR to all other network
 *                   modules that require TCP Layer configuration.
+*
+*           (3) TCP window scaling widens the advertised window beyond 65535 octets & MUST be configured
+*               PRIOR to the TCP window size limits (see 'net_tcp.h  TCP WINDOW SIZE DEFINES  Note #2').
+*
+*           (4) TCP receive window auto-tuning grows & shrinks each connection's configured receive window
+*               (see 'net_tcp.h  TCP RECEIVE WINDOW AUTO-TUNING DEFINES').
+*
+*           (5) The TCP SYN cache holds passive connection requests in a compact table & in SYN cookies until
+*               the three-way handshake completes (see 'net_tcp.h  TCP SYN CACHE DEFINES').
+*
+*           (6) TCP transmit cork & the MSG_MORE transmit flag hold back pushing transmit data so that small
+*               writes coalesce into full-sized segments (see 'net_tcp.c  NetTCP_ConnCfgTxCorkEnHandler()
+*               Note #3').
+*
+*           (7) TCP RACK-TLP detects lost transmit segments from their transmit timestamps & probes tail
+*               losses before the re-transmit timeout expires (see 'net_tcp.h  TCP RACK-TLP DEFINES').
+*
+*           (8) TCP transmit pacing spreads each connection's transmit queue segments over its round-trip
+*               time &/or a configured maximum rate (see 'net_tcp.h  TCP TRANSMIT PACING DEFINES').
+*
+*           (9) TCP explicit congestion notification negotiates ECN in the connection handshake, echoes
+*               congestion-experienced marks back to the remote host & reduces the transmit congestion
+*               window on echoed marks instead of on lost segments (see 'net_tcp.h  TCP ECN DEFINES').
+*
+*          (10) TCP Fast Open carries application data in the connection's SYN once the client holds a valid
+*               server cookie & MUST be configured with the IP Layer to generate & cache the cookies (see
+*               'net_tcp.h  TCP FAST OPEN DEFINES').
+*
+*          (11) TCP path MTU discovery reduces each connection's maximum segment size from ICMP 'Fragmentation
+*               Needed' & 'Packet Too Big' messages & caches the discovered path MTU per remote host (see
+*               'net_tcp.h  TCP PATH MTU DISCOVERY DEFINES').
+*
+*          (12) TCP compact TIME-WAIT handling frees each connection that enters the TIME-WAIT state & holds
+*               ONLY its addresses, sequence numbers & 2MSL expiry in a time-wait table (see 'net_tcp.h
+*               TCP TIME-WAIT DEFINES').
+*
+*          (13) TCP adaptive acknowledgements acknowledge every received data segment at connection start
+*               & after out-of-order segments are received & otherwise acknowledge several data segments
+*               with a single delayed acknowledgement (see 'net_tcp.h  TCP ADAPTIVE ACK DEFINES').
+*
+*          (14) TCP re-transmit queue index holds each connection's re-transmit queue segments in sequence
+*               number order so that received acknowledgements are located by binary search (see 'net_tcp.h
+*               TCP RE-TRANSMIT QUEUE INDEX DEFINES').
+*
+*          (15) TCP random initial sequence numbers are hashed by a keyed SipHash-2-4 instead of MD5 & the
+*               hash key is periodically regenerated (see 'net_tcp.h  TCP ISN SIPHASH DEFINES').
 *********************************************************************************************************
 */
 
@@ -318,6 +404,115 @@
         #define  NET_TCP_CHK_SUM_OFFLOAD_TX
     #endif
 
+    #ifndef  NET_TCP_CFG_WIN_SCALE_EN
+        #define  NET_TCP_CFG_WIN_SCALE_EN                       DEF_DISABLED
+    #endif
+
+    #if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+        #define  NET_TCP_WIN_SCALE_MODULE_EN                    /* See Note #3.                                         */
+    #endif
+
+    #ifndef  NET_TCP_CFG_RX_WIN_AUTO_TUNE_EN
+        #define  NET_TCP_CFG_RX_WIN_AUTO_TUNE_EN                DEF_DISABLED
+    #endif
+
+    #if (NET_TCP_CFG_RX_WIN_AUTO_TUNE_EN == DEF_ENABLED)
+        #define  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN             /* See Note #4.                                         */
+    #endif
+
+    #ifndef  NET_TCP_CFG_SYN_CACHE_EN
+        #define  NET_TCP_CFG_SYN_CACHE_EN                       DEF_DISABLED
+    #endif
+
+    #if ((NET_TCP_CFG_SYN_CACHE_EN == DEF_ENABLED) && \
+         (defined(NET_IP_MODULE_EN)))
+        #define  NET_TCP_SYN_CACHE_MODULE_EN                    /* See Note #5.                                         */
+    #endif
+
+    #ifndef  NET_TCP_CFG_TX_CORK_EN
+        #define  NET_TCP_CFG_TX_CORK_EN                         DEF_DISABLED
+    #endif
+
+    #if (NET_TCP_CFG_TX_CORK_EN == DEF_ENABLED)
+        #define  NET_TCP_TX_CORK_MODULE_EN                      /* See Note #6.                                         */
+    #endif
+
+    #ifndef  NET_TCP_CFG_RACK_EN
+        #define  NET_TCP_CFG_RACK_EN                            DEF_DISABLED
+    #endif
+
+    #if (NET_TCP_CFG_RACK_EN == DEF_ENABLED)
+        #define  NET_TCP_RACK_MODULE_EN                         /* See Note #7.                                         */
+    #endif
+
+    #ifndef  NET_TCP_CFG_TX_PACE_EN
+        #define  NET_TCP_CFG_TX_PACE_EN                         DEF_DISABLED
+    #endif
+
+    #if (NET_TCP_CFG_TX_PACE_EN == DEF_ENABLED)
+        #define  NET_TCP_TX_PACE_MODULE_EN                      /* See Note #8.                                         */
+    #endif
+
+    #ifndef  NET_TCP_CFG_ECN_EN
+        #define  NET_TCP_CFG_ECN_EN                             DEF_DISABLED
+    #endif
+
+    #if (NET_TCP_CFG_ECN_EN == DEF_ENABLED)
+        #define  NET_TCP_ECN_MODULE_EN                          /* See Note #9.                                         */
+    #endif
+
+    #ifndef  NET_TCP_CFG_FAST_OPEN_EN
+        #define  NET_TCP_CFG_FAST_OPEN_EN                       DEF_DISABLED
+    #endif
+
+    #if ((NET_TCP_CFG_FAST_OPEN_EN == DEF_ENABLED) && \
+         (defined(NET_IP_MODULE_EN)))
+        #define  NET_TCP_FAST_OPEN_MODULE_EN                    /* See Note #10.                                        */
+    #endif
+
+    #ifndef  NET_TCP_CFG_PATH_MTU_EN
+        #define  NET_TCP_CFG_PATH_MTU_EN                        DEF_DISABLED
+    #endif
+
+    #if ((NET_TCP_CFG_PATH_MTU_EN == DEF_ENABLED) && \
+         (defined(NET_IP_MODULE_EN)))
+        #define  NET_TCP_PATH_MTU_MODULE_EN                     /* See Note #11.                                        */
+    #endif
+
+    #ifndef  NET_TCP_CFG_TIME_WAIT_COMPACT_EN
+        #define  NET_TCP_CFG_TIME_WAIT_COMPACT_EN               DEF_DISABLED
+    #endif
+
+    #if ((NET_TCP_CFG_TIME_WAIT_COMPACT_EN == DEF_ENABLED) && \
+         (defined(NET_IP_MODULE_EN)))
+        #define  NET_TCP_TIME_WAIT_MODULE_EN                    /* See Note #12.                                        */
+    #endif
+
+    #ifndef  NET_TCP_CFG_ACK_ADAPT_EN
+        #define  NET_TCP_CFG_ACK_ADAPT_EN                       DEF_DISABLED
+    #endif
+
+    #if (NET_TCP_CFG_ACK_ADAPT_EN == DEF_ENABLED)
+        #define  NET_TCP_ACK_ADAPT_MODULE_EN                    /* See Note #13.                                        */
+    #endif
+
+    #ifndef  NET_TCP_CFG_RE_TX_Q_IDX_EN
+        #define  NET_TCP_CFG_RE_TX_Q_IDX_EN                     DEF_DISABLED
+    #endif
+
+    #if (NET_TCP_CFG_RE_TX_Q_IDX_EN == DEF_ENABLED)
+        #define  NET_TCP_RE_TX_Q_IDX_MODULE_EN                  /* See Note #14.                                        */
+    #endif
+
+    #ifndef  NET_TCP_CFG_ISN_SIPHASH_EN
+        #define  NET_TCP_CFG_ISN_SIPHASH_EN                     DEF_DISABLED
+    #endif
+
+    #if ((NET_TCP_CFG_ISN_SIPHASH_EN == DEF_ENABLED) && \
+         (defined(NET_TCP_CFG_RANDOM_ISN_GEN)))
+        #define  NET_TCP_ISN_SIPHASH_MODULE_EN                  /* See Note #15.                                        */
+    #endif
+
 #endif
 
 
@@ -376,6 +571,12 @@
 *
 *           (2) The pre-processor NET_SOCK_DFLT_BSD_EN check is controlled in net_cfg.h and can be
 *               enabled by uncommenting it there.
+*
+*           (3) Socket event poll sets are signaled from the socket select post path & therefore
+*               require socket select to be enabled.
+*
+*           (4) Socket file transmit streams file data into TCP transmit buffers & therefore requires
+*               stream-type sockets.
 *********************************************************************************************************
 */
 
@@ -398,6 +599,58 @@
     #endif
 #endif
 
+                                                                /* -------- CFG SOCK EVENT POLL MODULE INCLUSION ------ */
+#ifndef  NET_SOCK_CFG_EVENT_POLL_EN
+    #define  NET_SOCK_CFG_EVENT_POLL_EN                         DEF_DISABLED
+#endif
+
+#ifndef  NET_SOCK_CFG_EVENT_POLL_NBR
+    #define  NET_SOCK_CFG_EVENT_POLL_NBR                        1u
+#endif
+
+#if ((NET_SOCK_CFG_SEL_EN        == DEF_ENABLED) && \
+     (NET_SOCK_CFG_EVENT_POLL_EN == DEF_ENABLED))
+    #define  NET_SOCK_EVENT_POLL_MODULE_EN                      /* See Note #3.                                         */
+#endif
+
+                                                                /* ---------- CFG SOCK DATA VECTOR MAX NBR ------------ */
+#ifndef  NET_SOCK_CFG_DATA_VEC_NBR_MAX
+    #define  NET_SOCK_CFG_DATA_VEC_NBR_MAX                      8u
+#endif
+
+                                                                /* ------------ CFG SOCK MSG BATCH MAX NBR ------------ */
+#ifndef  NET_SOCK_CFG_MSG_NBR_MAX
+    #define  NET_SOCK_CFG_MSG_NBR_MAX                           4u
+#endif
+
+                                                                /* ------- CFG SOCK TX ZERO-COPY MODULE INCLUSION ------ */
+#ifndef  NET_SOCK_CFG_TX_ZERO_COPY_EN
+    #define  NET_SOCK_CFG_TX_ZERO_COPY_EN                       DEF_DISABLED
+#endif
+
+#if (NET_SOCK_CFG_TX_ZERO_COPY_EN == DEF_ENABLED)
+    #define  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+#endif
+
+                                                                /* --------- CFG SOCK TX FILE MODULE INCLUSION -------- */
+#ifndef  NET_SOCK_CFG_TX_FILE_EN
+    #define  NET_SOCK_CFG_TX_FILE_EN                            DEF_DISABLED
+#endif
+
+#if ((NET_SOCK_CFG_TX_FILE_EN == DEF_ENABLED) && \
+     (defined(NET_SOCK_TYPE_STREAM_MODULE_EN)))
+    #define  NET_SOCK_TX_FILE_MODULE_EN                         /* See Note #4.                                         */
+#endif
+
+                                                                /* -------- CFG SOCK REUSE PORT MODULE INCLUSION ------- */
+#ifndef  NET_SOCK_CFG_REUSE_PORT_EN
+    #define  NET_SOCK_CFG_REUSE_PORT_EN                         DEF_DISABLED
+#endif
+
+#if (NET_SOCK_CFG_REUSE_PORT_EN == DEF_ENABLED)
+    #define  NET_SOCK_REUSE_PORT_MODULE_EN
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -418,6 +671,28 @@
 */
 
 
+/*
+*********************************************************************************************************
+*                                NETWORK TIMER MANAGEMENT CONFIGURATION
+*
+* Note(s) : (1) High-resolution network timers are handled by the Network Timer Task at the high-resolution
+*               timer frequency (see 'net_tmr.c  NetTmr_Task()  Note #4').
+*********************************************************************************************************
+*/
+
+#ifndef  NET_TMR_CFG_HI_RES_EN
+    #define  NET_TMR_CFG_HI_RES_EN                              DEF_DISABLED
+#endif
+
+#ifndef  NET_TMR_CFG_HI_RES_FREQ
+    #define  NET_TMR_CFG_HI_RES_FREQ                            1000u
+#endif
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    #define  NET_TMR_HI_RES_MODULE_EN                           /* See Note #1.                                         */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                               NETWORK COUNTER MANAGEMENT CONFIGURATION
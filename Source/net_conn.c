@@ -73,6 +73,13 @@ static  NET_CONN  *NetConn_ChainSrch             (NET_CONN             **p_conn_
                                                   CPU_INT08U            *p_addr_remote,
                                                   NET_ERR               *p_err);
 
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN
+static  NET_CONN  *NetConn_ChainSrchReusePort    (NET_CONN              *p_conn_chain,
+                                                  NET_CONN              *p_conn_half,
+                                                  CPU_INT08U            *p_addr_remote,
+                                                  CPU_SIZE_T             addr_len);
+#endif
+
 
 static  void       NetConn_ChainInsert           (NET_CONN             **p_conn_list,
                                                   NET_CONN              *p_conn_chain);
@@ -154,6 +161,9 @@ void  NetConn_Init (void)
     NET_CONN           **p_conn_list;
     CPU_INT16U           i;
     NET_CONN_LIST_QTY    j;
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+    CPU_INT16U           k;
+#endif
     NET_ERR              err;
 
 
@@ -189,6 +199,11 @@ void  NetConn_Init (void)
     for (j = 0u; j < NET_CONN_PROTOCOL_NBR_MAX; j++) {
        *p_conn_list = (NET_CONN *)0;
         p_conn_list++;
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN                          /* Init net conn list port hash ctrs.                   */
+        for (k = 0u; k < NET_CONN_PORT_HASH_TBL_SIZE; k++) {
+            NetConn_ConnListPortHashCtr[j][k] = 0;
+        }
+#endif
     }
 
                                                                 /* Init net conn list ptrs.                             */
@@ -3780,6 +3795,46 @@ void  NetConn_ListUnlink (NET_CONN_ID   conn_id,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetConn_ListIsPortBound()
+*
+* Description : Check whether any network connection in a connection list may be bound to a local port.
+*
+* Argument(s) : protocol_ix     Network connection list protocol index.
+*               -----------     Argument validated in NetIPv4_RxPktDemuxEarly().
+*
+*               port_nbr        Local port number to check (see Note #1).
+*
+* Return(s)   : DEF_YES, if a connection may be bound to the local port (see Note #2).
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetIPv4_RxPktDemuxEarly().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Port number MUST be in host-order.
+*
+*               (2) See 'net_conn.h  NETWORK CONNECTION PORT HASH DEFINES  Note #2'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+CPU_BOOLEAN  NetConn_ListIsPortBound (NET_CONN_PROTOCOL_IX  protocol_ix,
+                                      NET_PORT_NBR          port_nbr)
+{
+    CPU_BOOLEAN  bound;
+
+
+    bound = (NetConn_ConnListPortHashCtr[protocol_ix][NET_CONN_PORT_HASH(port_nbr)] > 0) ? DEF_YES : DEF_NO;
+
+    return (bound);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -3980,6 +4035,10 @@ static  NET_CONN  *NetConn_ListSrch (NET_CONN_FAMILY    family,
 *
 *               (3) (a) See 'NetConn_Srch()  Note #2b3B1b'.
 *                   (b) See 'NetConn_Srch()  Note #2b3B1a'.
+*
+*               (4) If a remote address is available & the half connection found is a member of a reuse port
+*                   group, the group connection selected for the remote address is returned instead (see
+*                   'net_conn.h  NETWORK CONNECTION FLAG DEFINES  Note #1').
 *********************************************************************************************************
 */
 
@@ -4120,6 +4179,16 @@ static  NET_CONN  *NetConn_ChainSrch (NET_CONN    **p_conn_list,
        *p_err  = NET_CONN_ERR_CONN_NONE;
     }
 
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN
+    if ((p_conn        != DEF_NULL) &&                          /* If reuse port half conn found, ...                   */
+        (p_addr_remote != DEF_NULL) &&
+        (p_conn->AddrRemoteValid == DEF_NO) &&
+        (DEF_BIT_IS_SET(p_conn->Flags, NET_CONN_FLAG_REUSE_PORT) == DEF_YES)) {
+                                                                /* ... sel group conn for remote addr (see Note #4).    */
+        p_conn = NetConn_ChainSrchReusePort(p_conn_chain, p_conn, p_addr_remote, addr_len);
+    }
+#endif
+
 
     if (p_conn != DEF_NULL) {                                   /* If net conn found, ..                                */
         p_conn->ConnAccessedCtr++;                              /* .. inc conn access ctr.                              */
@@ -4140,6 +4209,89 @@ static  NET_CONN  *NetConn_ChainSrch (NET_CONN    **p_conn_list,
 }
 
 
+/*
+*********************************************************************************************************
+*                                    NetConn_ChainSrchReusePort()
+*
+* Description : Select a network connection from a reuse port group for a remote address.
+*
+* Argument(s) : p_conn_chain        Pointer to a connection chain.
+*               -----------         Argument validated in NetConn_Srch().
+*
+*               p_conn_half         Pointer to a reuse port group's half connection.
+*               ----------          Argument validated in NetConn_ChainSrch().
+*
+*               p_addr_remote       Pointer to remote address.
+*               -------------       Argument validated in NetConn_ChainSrch().
+*
+*               addr_len            Length of connection addresses (in octets).
+*
+* Return(s)   : Pointer to reuse port group's connection selected for the remote address.
+*
+* Caller(s)   : NetConn_ChainSrch().
+*
+* Note(s)     : (1) The selected connection is the group connection with the highest weight, where each
+*                   connection's weight is a hash of the remote address & the connection's identifier
+*                   (see 'net_conn.h  NETWORK CONNECTION FLAG DEFINES  Note #1b').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN
+static  NET_CONN  *NetConn_ChainSrchReusePort (NET_CONN    *p_conn_chain,
+                                               NET_CONN    *p_conn_half,
+                                               CPU_INT08U  *p_addr_remote,
+                                               CPU_SIZE_T   addr_len)
+{
+    NET_CONN     *p_conn;
+    NET_CONN     *p_conn_sel;
+    CPU_BOOLEAN   found;
+    CPU_INT32U    hash;
+    CPU_INT32U    weight;
+    CPU_INT32U    weight_sel;
+    CPU_SIZE_T    i;
+
+
+    hash = 2166136261u;                                         /* Hash remote addr (FNV-1a).                           */
+    for (i = 0u; i < addr_len; i++) {
+        hash ^= p_addr_remote[i];
+        hash *= 16777619u;
+    }
+
+    p_conn_sel = DEF_NULL;
+    weight_sel = 0u;
+    p_conn     = p_conn_chain;
+    while (p_conn != DEF_NULL) {                                /* Srch ALL group conns in chain (see Note #1).         */
+        if ((p_conn->AddrRemoteValid == DEF_NO) &&
+            (DEF_BIT_IS_SET(p_conn->Flags, NET_CONN_FLAG_REUSE_PORT) == DEF_YES)) {
+
+            found = Mem_Cmp(&p_conn->AddrLocal[0], &p_conn_half->AddrLocal[0], addr_len);
+            if (found == DEF_YES) {
+                weight  =  hash ^ ((CPU_INT32U)p_conn->ID * 2654435761u);
+                weight ^=  weight >> 16;                        /* Mix conn weight.                                     */
+                weight *=  2246822507u;
+                weight ^=  weight >> 13;
+                weight *=  3266489909u;
+                weight ^=  weight >> 16;
+
+                if ((p_conn_sel == DEF_NULL) ||                 /* Sel highest weight conn.                             */
+                    (weight     >  weight_sel)) {
+                     p_conn_sel  = p_conn;
+                     weight_sel  = weight;
+                }
+            }
+        }
+        p_conn = p_conn->NextConnPtr;
+    }
+
+    if (p_conn_sel == DEF_NULL) {
+        p_conn_sel  = p_conn_half;
+    }
+
+    return (p_conn_sel);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        NetConn_ChainInsert()
@@ -4289,8 +4441,11 @@ static  void  NetConn_Add (NET_CONN  **p_conn_list,
                            NET_CONN   *p_conn_chain,
                            NET_CONN   *p_conn)
 {
-    NET_CONN  *p_conn_chain_prev;
-    NET_CONN  *p_conn_chain_next;
+    NET_CONN      *p_conn_chain_prev;
+    NET_CONN      *p_conn_chain_next;
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+    NET_PORT_NBR   port_nbr;
+#endif
 
 
     if (p_conn_chain == (NET_CONN *)0) {                            /* If conn chain empty, ...                         */
@@ -4333,6 +4488,12 @@ static  void  NetConn_Add (NET_CONN  **p_conn_list,
     }
 
     p_conn->ConnList = p_conn_list;                                 /* Mark conn's conn list ownership.                 */
+
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN                              /* Cnt conn in its local port hash bucket.          */
+    NET_UTIL_VAL_COPY_GET_NET_16(&port_nbr, &p_conn->AddrLocal[NET_CONN_ADDR_IP_IX_PORT]);
+    p_conn->ConnListPortHashIx = NET_CONN_PORT_HASH(port_nbr);
+    NetConn_ConnListPortHashCtr[p_conn->ProtocolIx][p_conn->ConnListPortHashIx]++;
+#endif
 }
 
 
@@ -4424,6 +4585,10 @@ static  void  NetConn_Unlink (NET_CONN  *p_conn)
 
     p_conn->ConnList     = (NET_CONN **)0;                              /* Clr net conn's conn list ownership.          */
 
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN                                  /* Uncnt conn from its port hash bucket.        */
+    NetConn_ConnListPortHashCtr[p_conn->ProtocolIx][p_conn->ConnListPortHashIx]--;
+#endif
+
 #if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)                             /* Clr net conn's chain/conn ptrs (see Note #1).*/
     p_conn->PrevChainPtr = (NET_CONN  *)0;
     p_conn->NextChainPtr = (NET_CONN  *)0;
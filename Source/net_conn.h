@@ -180,12 +180,25 @@
 /*
 *********************************************************************************************************
 *                                   NETWORK CONNECTION FLAG DEFINES
+*
+* Note(s) : (1) (a) Half connections with identical local addresses & the reuse port flag set form a
+*                   reuse port group; each connection is typically owned by a separate listening socket
+*                   &/or application task.
+*
+*               (b) Each received packet is demultiplexed to exactly one connection of the group, selected
+*                   by highest random weight of the packet's remote address & each connection's identifier.
+*                   Thus all packets from the same remote address are delivered to the same connection,
+*                   regardless of connection list order, & adding or removing a group connection ONLY
+*                   re-maps the remote addresses selecting that connection.
+*
+*                   See also 'net_conn.c  NetConn_ChainSrchReusePort()'.
 *********************************************************************************************************
 */
 
                                                                 /* ------------------ NET CONN FLAGS ------------------ */
 #define  NET_CONN_FLAG_NONE                       DEF_BIT_NONE
 #define  NET_CONN_FLAG_USED                       DEF_BIT_00    /* Conn cur used; i.e. NOT in free conn pool.           */
+#define  NET_CONN_FLAG_REUSE_PORT                 DEF_BIT_01    /* Conn local addr shared (see Note #1).                */
 
 
 /*
@@ -345,6 +358,26 @@ typedef  NET_CONN_QTY  NET_CONN_LIST_IX;
 #define  NET_CONN_LIST_IX_MAX     (NET_CONN_NBR_CONN - 1)
 
 
+/*
+*********************************************************************************************************
+*                                NETWORK CONNECTION PORT HASH DEFINES
+*
+* Note(s) : (1) Each connection list counts its linked connections per local port hash bucket so that
+*               receive can reject datagrams for unbound ports before any further processing (see
+*               'net_ipv4.c  NetIPv4_RxPktDemuxEarly()').
+*
+*           (2) A non-zero bucket does NOT guarantee that the port is bound; colliding ports are left for
+*               the transport layer to demultiplex.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+#define  NET_CONN_PORT_HASH_TBL_SIZE                   (((NET_CONN_NBR_CONN) * 2u) + 1u)
+
+#define  NET_CONN_PORT_HASH(port_nbr)                  ((CPU_INT16U)((port_nbr) % NET_CONN_PORT_HASH_TBL_SIZE))
+#endif
+
+
 /*
 *********************************************************************************************************
 *                               NETWORK CONNECTION CLOSE CODE DATA TYPE
@@ -451,6 +484,10 @@ typedef  NET_FLAGS  NET_CONN_FLAGS;
 *                               source route received in a datagram."
 *
 *                   (2) IP transmit options currently NOT implemented      See 'net_tcp.h  Note #1d'
+*
+*           (3) A connection's port hash index is saved when it is added into its connection list since its
+*               local address may be changed before it is unlinked (see 'NETWORK CONNECTION PORT HASH
+*               DEFINES  Note #1').
 *********************************************************************************************************
 */
 
@@ -465,6 +502,9 @@ struct  net_conn {
     NET_CONN                *NextConnPtr;                       /* Ptr to NEXT conn.                                    */
 
     NET_CONN               **ConnList;                          /* Conn list.                                           */
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+    CPU_INT16U               ConnListPortHashIx;                /* Conn list port hash ix (see Note #3).                */
+#endif
 
 
     NET_CONN_ID              ID;                                /* Net             conn id.                             */
@@ -529,6 +569,10 @@ NET_CONN_EXT  NET_CONN         *NetConn_ConnListConnPtr;            /* Ptr to cu
 NET_CONN_EXT  NET_CONN         *NetConn_ConnListNextChainPtr;       /* Ptr to next conn list chain to update.           */
 NET_CONN_EXT  NET_CONN         *NetConn_ConnListNextConnPtr;        /* Ptr to next conn list conn  to update.           */
 
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN                              /* Nbr conns per conn list port hash bucket.        */
+NET_CONN_EXT  NET_CONN_QTY      NetConn_ConnListPortHashCtr[NET_CONN_PROTOCOL_NBR_MAX][NET_CONN_PORT_HASH_TBL_SIZE];
+#endif
+
 
 NET_CONN_EXT  CPU_INT16U        NetConn_AccessedTh_nbr;             /* Nbr successful srch's to promote net conns.      */
 
@@ -771,6 +815,11 @@ void              NetConn_ListAdd                   (NET_CONN_ID              co
 void              NetConn_ListUnlink                (NET_CONN_ID              conn_id,
                                                      NET_ERR                 *p_err);
 
+#ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+CPU_BOOLEAN       NetConn_ListIsPortBound           (NET_CONN_PROTOCOL_IX     protocol_ix,
+                                                     NET_PORT_NBR             port_nbr);
+#endif
+
 
 /*
 *********************************************************************************************************
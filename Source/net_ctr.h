@@ -368,6 +368,10 @@ typedef  struct  net_ctr_ipv6_stats {
     NET_CTR  RxFragCtr;                                     /* Nbr rx'd IPv6 frags.                                     */
     NET_CTR  RxFragDgramReasmCtr;                           /* Nbr rx'd IPv6 frag'd datagrams reasm'd.                  */
 
+#ifdef  NET_IPv6_FWD_MODULE_EN
+    NET_CTR  RxDgramFwdCtr;                                 /* Nbr rx'd IPv6 datagrams fwd'd to another IF.             */
+#endif
+
 
     NET_CTR  TxDgramCtr;                                    /* Nbr tx'd IPv6 datagrams.                                 */
     NET_CTR  TxDestThisHostCtr;                             /* Nbr tx'd IPv6 datagrams           to this host.          */
@@ -489,6 +493,11 @@ typedef  struct  net_ctr_tcp_stats {
     NET_CTR  TxSegConnKAliveCtr;                            /* Nbr tx'd TCP conn keep-alive segs.                       */
     NET_CTR  TxSegConnTxQ_Ctr;                              /* Nbr tx'd TCP conn    tx Q    segs.                       */
     NET_CTR  TxSegConnReTxQ_Ctr;                            /* Nbr tx'd TCP conn re-tx Q    segs.                       */
+
+#ifdef  NET_TCP_ACK_ADAPT_MODULE_EN
+    NET_CTR  TxSegConnAckQuickCtr;                          /* Nbr tx'd TCP conn quick ack  segs.                       */
+    NET_CTR  RxSegAckDlydCtr;                               /* Nbr rx'd TCP segs w/ dly'd ack.                          */
+#endif
 } NET_CTR_TCP_STATS;
 
 
@@ -851,6 +860,7 @@ typedef  struct  net_ctr_ndp_errs {
         NET_CTR  RouterNoneAvailCtr;                        /* Nbr unavail NDP Router      pool accesses.               */
         NET_CTR  PrefixNoneAvailCtr;                        /* Nbr unavail NDP Prefix      pool accesses.               */
         NET_CTR  DestCacheNoneAvailCtr;                     /* Nbr unavail NDP Dest. cache pool accesses.               */
+        NET_CTR  RouteNoneAvailCtr;                         /* Nbr unavail NDP Route       pool accesses.               */
 
     #if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
          (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
@@ -872,6 +882,7 @@ typedef  struct  net_ctr_ndp_errs {
 typedef  struct  net_ctr_cache_errs {
 
         NET_CTR  TxPktDisCtr;
+        NET_CTR  TxQ_PendDropCtr;                           /* Nbr pkts dropped from full pending tx Q.                 */
 
     #if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
     (NET_ERR_CFG_ARG_CHK_DBG_EN      == DEF_ENABLED))
@@ -927,6 +938,10 @@ typedef  struct  net_ctr_ipv4_errs {
         NET_CTR  RxFragDisCtr;                              /* Nbr rx'd IPv4 frags            discarded.                */
         NET_CTR  RxFragDgramDisCtr;                         /* Nbr rx'd IPv4 frag'd datagrams discarded.                */
         NET_CTR  RxFragDgramTimeoutCtr;                     /* Nbr rx'd IPv4 frag'd datagrams timed out.                */
+    #ifdef  NET_IPv4_EARLY_DEMUX_MODULE_EN
+        NET_CTR  RxEarlyDemuxUDP_DisCtr;                    /* Nbr rx'd IPv4 UDP pkts discarded for unbound port.       */
+        NET_CTR  RxEarlyDemuxTCP_DisCtr;                    /* Nbr rx'd IPv4 TCP pkts discarded for unbound port.       */
+    #endif
     #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
         NET_CTR  RxInvBufIxCtr;                             /* Nbr rx   IPv4 pkts  with invalid buf ix.                 */
         NET_CTR  RxInvBufTypeCtr;
@@ -998,6 +1013,11 @@ typedef  struct  net_ctr_ipv6_errs {
         NET_CTR  RxFragDisCtr;                              /* Nbr rx'd IPv6 frags            discarded.                */
         NET_CTR  RxFragDgramDisCtr;                         /* Nbr rx'd IPv6 frag'd datagrams discarded.                */
         NET_CTR  RxFragDgramTimeoutCtr;                     /* Nbr rx'd IPv6 frag'd datagrams timed out.                */
+    #ifdef  NET_IPv6_FWD_MODULE_EN
+        NET_CTR  RxFwdHopLimCtr;                            /* Nbr rx'd IPv6 datagrams NOT fwd'd, hop limit exceeded.   */
+        NET_CTR  RxFwdNoRouteCtr;                           /* Nbr rx'd IPv6 datagrams NOT fwd'd, no route to dest.     */
+        NET_CTR  RxFwdTooBigCtr;                            /* Nbr rx'd IPv6 datagrams NOT fwd'd, larger than tx MTU.   */
+    #endif
     #if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
          (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
         NET_CTR  RxInvBufIxCtr;                             /* Nbr rx   IPv6 pkts  with invalid buf ix.                 */
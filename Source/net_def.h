@@ -491,7 +491,7 @@
 #ifdef   SO_REUSEPORT
 #undef   SO_REUSEPORT
 #endif
-#define  SO_REUSEPORT                                 0x000F
+#define  SO_REUSEPORT                                 0x000F    /*  = NET_SOCK_OPT_SOCK_REUSE_PORT                      */
 
 #ifdef   SO_BROADCAST
 #undef   SO_BROADCAST
@@ -581,6 +581,21 @@
 #endif
 #define  TCP_KEEPCNT                                  0x100C    /*  = NET_SOCK_OPT_TCP_KEEP_CNT                         */
 
+#ifdef   TCP_CORK
+#undef   TCP_CORK
+#endif
+#define  TCP_CORK                                     0x100D    /*  = NET_SOCK_OPT_TCP_CORK                             */
+
+#ifdef   TCP_MAX_PACING_RATE
+#undef   TCP_MAX_PACING_RATE
+#endif
+#define  TCP_MAX_PACING_RATE                          0x100E    /*  = NET_SOCK_OPT_TCP_MAX_PACING_RATE                  */
+
+#ifdef   TCP_FASTOPEN
+#undef   TCP_FASTOPEN
+#endif
+#define  TCP_FASTOPEN                                 0x100F    /*  = NET_SOCK_OPT_TCP_FAST_OPEN                        */
+
 
                                                                 /* ---------------------------------------------------- */
                                                                 /*                       IP LEVEL                       */
@@ -674,6 +689,11 @@
 #endif
 #define  MSG_DONTWAIT                             DEF_BIT_07
 
+#ifdef   MSG_MORE
+#undef   MSG_MORE
+#endif
+#define  MSG_MORE                                 DEF_BIT_15
+
 
 /*
 *********************************************************************************************************
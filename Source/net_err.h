@@ -558,6 +558,8 @@ typedef enum net_err {
     NET_IPv4_ERR_RX_OPT_BUF_LEN                 =   10211u,     /* IP opt buf len err.                                  */
     NET_IPv4_ERR_RX_OPT_BUF_WR                  =   10212u,     /* IP opt buf wr  err.                                  */
 
+    NET_IPv4_ERR_RX_PORT_NONE                   =   10220u,     /* NO conn bound to rx'd dest port.                     */
+
     NET_IPv4_ERR_TX_PKT                         =   10300u,     /* Tx pkt err.                                          */
     NET_IPv4_ERR_TX_DEST_NONE                   =   10301u,     /* NO      tx dest.                                     */
     NET_IPv4_ERR_TX_DEST_INVALID                =   10302u,     /* Invalid tx dest.                                     */
@@ -629,6 +631,8 @@ typedef enum net_err {
     NET_IPv6_ERR_RX_OPT_BUF_LEN                 =  11211u,      /* IP opt buf len err.                                  */
     NET_IPv6_ERR_RX_OPT_BUF_WR                  =  11212u,      /* IP opt buf wr  err.                                  */
 
+    NET_IPv6_ERR_RX_FWD                         =  11220u,      /* Rx'd datagram to fwd.                                */
+
     NET_IPv6_ERR_TX_PKT                         =  11300u,      /* Tx pkt err.                                          */
 
     NET_IPv6_ERR_TX_SRC_SEL_FAIL                =  11310u,      /* NO      tx src.                                      */
@@ -794,12 +798,14 @@ typedef enum net_err {
     NET_NDP_ERR_ROUTER_NONE_AVAIL               =  15060u,      /* NO NDP Router entry available.                       */
     NET_NDP_ERR_PREFIX_NONE_AVAIL               =  15061u,      /* NO NDP Prefix entry available.                       */
     NET_NDP_ERR_DEST_CACHE_NONE_AVAIL           =  15062u,      /* NO NDP Destination cache available.                  */
+    NET_NDP_ERR_ROUTE_NONE_AVAIL                =  15063u,      /* NO NDP Route entry available.                        */
 
     NET_NDP_ERR_ROUTER_DFLT_FIND                =  15070u,      /* NDP Default Router found.                            */
     NET_NDP_ERR_ROUTER_DFLT_NONE                =  15071u,      /* NDP Router found (but not default).                  */
     NET_NDP_ERR_ROUTER_NOT_FOUND                =  15072u,      /* NO corresponding NDP router found in list.           */
 
     NET_NDP_ERR_PREFIX_NOT_FOUND                =  15080u,      /* NO corresponding NDP prefix found in list.           */
+    NET_NDP_ERR_ROUTE_NOT_FOUND                 =  15081u,      /* NO corresponding NDP route  found in list.           */
 
     NET_NDP_ERR_DESTINATION_NOT_FOUND           =  15090u,      /* NO corresponding NDP dest cache found in list.       */
 
@@ -841,6 +847,10 @@ typedef enum net_err {
     NET_IGMP_ERR_HOST_GRP_NOT_FOUND             =  16031u,      /*    IGMP host grp NOT found.                          */
     NET_IGMP_ERR_HOST_GRP_INVALID_TYPE          =  16032u,      /*    IGMP host grp type invalid or unknown.            */
 
+    NET_IGMP_ERR_SRC_NONE_AVAIL                 =  16040u,      /* NO IGMP host grp src entry avail.                    */
+    NET_IGMP_ERR_SRC_NOT_FOUND                  =  16041u,      /*    IGMP host grp src NOT found.                      */
+    NET_IGMP_ERR_INVALID_FILTER_MODE            =  16042u,      /* Invalid IGMP src filter mode.                        */
+
 
 /*
 ---------------------------------------------------------------------------------------------------------
@@ -863,6 +873,10 @@ typedef enum net_err {
     NET_MLDP_ERR_HOST_GRP_NONE_AVAIL            =  17030u,       /* No more MLDP multicast group available.             */
     NET_MLDP_ERR_HOST_GRP_NOT_FOUND             =  17031u,       /* MLDP multicast group not found.                     */
 
+    NET_MLDP_ERR_SRC_NONE_AVAIL                 =  17032u,       /* No more MLDP multicast group source available.      */
+    NET_MLDP_ERR_SRC_NOT_FOUND                  =  17033u,       /* MLDP multicast group source not found.              */
+    NET_MLDP_ERR_INVALID_FILTER_MODE            =  17034u,       /* Invalid MLDP source filter mode.                    */
+
     NET_MLDP_ERR_MSG_TYPE_QUERY                 =  17040u,       /* Rx a MLDP Query message.                            */
     NET_MLDP_ERR_MSG_TYPE_REPORT                =  17041u,       /* Rx a MLDP Report message.                           */
 
@@ -1056,6 +1070,12 @@ typedef enum net_err {
 
     NET_SOCK_ERR_SEL_SIGNAL_FAULT               =  20300u,      /* Create Socket Select signal failed.                  */
 
+    NET_SOCK_ERR_POLL_INVALID_ID                =  20310u,      /* Invalid sock poll set id.                            */
+    NET_SOCK_ERR_POLL_NONE_AVAIL                =  20311u,      /* NO sock poll sets avail.                             */
+    NET_SOCK_ERR_POLL_SOCK_REG                  =  20312u,      /* Sock already registered with a poll set.             */
+    NET_SOCK_ERR_POLL_SOCK_NOT_REG              =  20313u,      /* Sock NOT     registered with poll set.               */
+    NET_SOCK_ERR_POLL_SIGNAL_FAULT              =  20314u,      /* Sock poll set signal fault.                          */
+
     NET_SOCK_ERR_RX_Q_CLOSED                    =  20400u,      /* Rx Q closed; i.e.   do NOT rx   pkt(s) to Q.         */
     NET_SOCK_ERR_RX_Q_EMPTY                     =  20401u,      /* Rx Q empty;  i.e.      NO  rx'd pkt(s) in Q.         */
     NET_SOCK_ERR_RX_Q_FULL                      =  20402u,      /* Rx Q full;   i.e. too many rx'd pkt(s) in Q.         */
@@ -1068,6 +1088,7 @@ typedef enum net_err {
     NET_SOCK_ERR_RX_Q_SIGNAL_FAULT              =  20514u,      /* Rx Q signal fault.                                   */
 
     NET_SOCK_ERR_TX_Q_CLOSED                    =  20600u,      /* Tx Q closed; i.e. do NOT Q pkt(s) to tx.             */
+    NET_SOCK_ERR_TX_FILE_RD                     =  20610u,      /* Tx file rd failed.                                   */
 
 
 /*
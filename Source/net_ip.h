@@ -117,6 +117,28 @@
 
 #define  NET_IP_FRAG_SIZE_NONE                        DEF_INT_16U_MAX_VAL
 
+
+/*
+*********************************************************************************************************
+*                                IP EXPLICIT CONGESTION NOTIFICATION DEFINES
+*
+* Note(s) : (1) RFC #3168, Section 5 defines the ECN field as the two least significant bits of both the
+*               IPv4 TOS octet & the IPv6 Traffic Class octet :
+*
+*               (a) Not-ECT     Transport is NOT ECN-capable.
+*               (b) ECT(1)      ECN-Capable Transport; NOT used by TCP (see RFC #3168, Section 6.1.1).
+*               (c) ECT(0)      ECN-Capable Transport.
+*               (d) CE          Congestion Experienced; set by routers instead of dropping the packet.
+*********************************************************************************************************
+*/
+
+#define  NET_IP_ECN_NOT_ECT                               0x00u
+#define  NET_IP_ECN_ECT_1                                 0x01u
+#define  NET_IP_ECN_ECT_0                                 0x02u
+#define  NET_IP_ECN_CE                                    0x03u
+
+#define  NET_IP_ECN_MASK                                  0x03u
+
 /*
 *********************************************************************************************************
 *                                        IP ADDRESS DATA DEFINES
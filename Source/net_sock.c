@@ -113,6 +113,9 @@
 #define  NET_SOCK_CONN_ACCEPT_NAME       "Net Sock Conn Accept Q"
 #define  NET_SOCK_CONN_CLOSE_NAME        "Net Sock Conn Close"
 #define  NET_SOCK_TASK_SEL_SIGNAL_NAME   "Net Sock Sel Task"
+#define  NET_SOCK_POLL_SIGNAL_NAME       "Net Sock Poll Set"
+
+#define  NET_SOCK_CONN_TIME_WAIT_RETRY_MAX                 4u   /* Max random port retries for time-wait conns.         */
 
 
 /*
@@ -133,6 +136,10 @@ static  MEM_DYN_POOL           NetSock_AcceptQ_ObjPool;
 static  MEM_DYN_POOL           NetSock_SelObjPool;
 #endif
 
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+static  NET_SOCK_POLL_SET      NetSock_PollSetTbl[NET_SOCK_CFG_EVENT_POLL_NBR];
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -210,6 +217,9 @@ static  NET_SOCK_RTN_CODE       NetSock_ConnHandlerDatagram          (NET_SOCK_I
 static  NET_SOCK_RTN_CODE       NetSock_ConnHandlerStream            (NET_SOCK_ID                sock_id,
                                                                       NET_SOCK                  *p_sock,
                                                                       NET_SOCK_ADDR             *p_addr_remote,
+                                                                      void                      *p_data,
+                                                                      CPU_INT16U                 data_len,
+                                                                      CPU_INT16U                *p_data_len_txd,
                                                                       NET_ERR                   *p_err);
 
 static  NET_SOCK_RTN_CODE       NetSock_ConnHandlerStreamWait        (NET_SOCK_ID                sock_id,
@@ -238,6 +248,12 @@ static  void                    NetSock_ConnHandlerAddrRemoteSet     (NET_SOCK
                                                                       CPU_BOOLEAN                addr_over_wr,
                                                                       NET_ERR                   *p_err);
 
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  void                    NetSock_ConnHandlerAddrTimeWait      (NET_SOCK                  *p_sock,
+                                                                      CPU_BOOLEAN                port_random,
+                                                                      NET_ERR                   *p_err);
+#endif
+
 
 
 #ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
@@ -268,10 +284,16 @@ static  CPU_BOOLEAN             NetSock_ConnAcceptQ_ConnID_Remove    (NET_SOCK
 
 
 
+static  CPU_INT16U              NetSock_DataVecLenGet                (NET_SOCK_DATA_VEC         *p_vec,
+                                                                      CPU_INT16U                 vec_nbr,
+                                                                      NET_ERR                   *p_err);
+
+
 static  NET_SOCK_RTN_CODE       NetSock_RxDataHandler                (NET_SOCK_ID                sock_id,
                                                                       void                      *p_data_buf,
-                                                                      CPU_INT16U                 data_buf_len,
+                                                                      CPU_INT32U                 data_buf_len,
                                                                       NET_SOCK_API_FLAGS         flags,
+                                                                      CPU_BOOLEAN                data_vec,
                                                                       NET_SOCK_ADDR             *p_addr_remote,
                                                                       NET_SOCK_ADDR_LEN         *p_addr_len,
                                                                       void                      *p_ip_opts_buf,
@@ -295,8 +317,9 @@ static  NET_SOCK_RTN_CODE       NetSock_RxDataHandlerDatagram        (NET_SOCK_I
 
 static  NET_SOCK_RTN_CODE       NetSock_TxDataHandler                (NET_SOCK_ID                sock_id,
                                                                       void                      *p_data,
-                                                                      CPU_INT16U                 data_len,
+                                                                      CPU_INT32U                 data_len,
                                                                       NET_SOCK_API_FLAGS         flags,
+                                                                      NET_SOCK_API_FLAGS         flags_int,
                                                                       NET_SOCK_ADDR             *p_addr_remote,
                                                                       NET_SOCK_ADDR_LEN          addr_len,
                                                                       NET_ERR                   *p_err);
@@ -363,6 +386,19 @@ static  CPU_BOOLEAN             NetSock_SelDescHandlerErrStream      (NET_SOCK
                                                                       NET_ERR                   *p_err);
 #endif
 
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+static  void                    NetSock_PollPost                     (NET_SOCK                  *p_sock,
+                                                                      NET_SOCK_SEL_EVENT_FLAG    flags_mask);
+
+static  NET_SOCK_SEL_EVENT_FLAG NetSock_PollRdyGet                   (NET_SOCK                  *p_sock);
+
+static  NET_SOCK_QTY            NetSock_PollRdyDrain                 (NET_SOCK_POLL_SET         *p_set,
+                                                                      NET_SOCK_POLL_EVENT       *p_events,
+                                                                      NET_SOCK_QTY               events_nbr_max);
+
+static  void                    NetSock_PollUnreg                    (NET_SOCK                  *p_sock);
+#endif
+
 
 
 static  CPU_BOOLEAN             NetSock_IsAvailRxDatagram            (NET_SOCK                  *p_sock,
@@ -457,10 +493,34 @@ static  CPU_BOOLEAN             NetSock_CfgTxNagleEnHandler          (NET_SOCK_I
                                                                       NET_ERR                   *p_err);
 #endif
 
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+static  CPU_BOOLEAN             NetSock_CfgTxCorkHandler             (NET_SOCK_ID                sock_id,
+                                                                      CPU_BOOLEAN                cork_en,
+                                                                      NET_ERR                   *p_err);
+#endif
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+static  CPU_BOOLEAN             NetSock_CfgTxPaceRateHandler         (NET_SOCK_ID                sock_id,
+                                                                      NET_TCP_TX_PACE_RATE       rate_max,
+                                                                      NET_ERR                   *p_err);
+#endif
+
 static  CPU_BOOLEAN             NetSock_CfgIF_Handler                (NET_SOCK_ID                sock_id,
                                                                       NET_IF_NBR                 if_nbr,
                                                                       NET_ERR                   *p_err);
 
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN
+static  CPU_BOOLEAN             NetSock_CfgReusePortHandler          (NET_SOCK_ID                sock_id,
+                                                                      CPU_BOOLEAN                reuse_port,
+                                                                      NET_ERR                   *p_err);
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  CPU_BOOLEAN             NetSock_CfgFastOpenHandler           (NET_SOCK_ID                sock_id,
+                                                                      CPU_BOOLEAN                fast_open,
+                                                                      NET_ERR                   *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -471,12 +531,15 @@ static  CPU_BOOLEAN             NetSock_CfgIF_Handler                (NET_SOCK_I
 *                   (a) Perform    Socket/OS initialization
 *                   (b) Initialize socket pool
 *                   (c) Initialize socket table
-*                   (d) Initialize random port number queue
+*                   (d) Initialize socket event poll sets
+*                   (e) Initialize random port number queue
 *
 *
 * Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_SOCK_ERR_NONE               Socket layer successfully initialized.
+*                               NET_SOCK_ERR_POLL_SIGNAL_FAULT  Socket event poll set signal NOT created.
+*                               NET_ERR_FAULT_MEM_ALLOC         Memory allocation fault.
 *
 *                               ------------ RETURNED BY NetSock_InitObj() ------------
 *                               See NetSock_InitObj() for addtional return error codes.
@@ -498,10 +561,14 @@ static  CPU_BOOLEAN             NetSock_CfgIF_Handler                (NET_SOCK_I
 
 void  NetSock_Init (NET_ERR  *p_err)
 {
-    NET_SOCK      *p_sock;
-    NET_SOCK_QTY   i;
-    NET_ERR        err;
-    LIB_ERR        err_lib;
+    NET_SOCK           *p_sock;
+    NET_SOCK_QTY        i;
+    NET_ERR             err;
+    LIB_ERR             err_lib;
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+    NET_SOCK_POLL_SET  *p_set;
+    KAL_ERR             err_kal;
+#endif
 
 
                                                                 /* --------------- INIT SOCK POOL/STATS --------------- */
@@ -529,6 +596,15 @@ void  NetSock_Init (NET_ERR  *p_err)
         p_sock->SecureSession = (void *)0;                       /* Init each sock w/ NULL secure session.               */
 #endif
 
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+        p_sock->PollID           =  NET_SOCK_POLL_ID_NONE;      /* Init each sock as NOT registered with poll set.      */
+        p_sock->PollEventsCfgd   =  NET_SOCK_SEL_EVENT_FLAG_NONE;
+        p_sock->PollEventsPosted =  NET_SOCK_SEL_EVENT_FLAG_NONE;
+        p_sock->PollRdyListed    =  DEF_NO;
+        p_sock->PollRdyNextPtr   = (NET_SOCK *)0;
+        p_sock->PollDataPtr      = (void     *)0;
+#endif
+
 #if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
         NetSock_Clr(p_sock);
 #endif
@@ -580,6 +656,41 @@ void  NetSock_Init (NET_ERR  *p_err)
     }
 #endif
 
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+                                                                /* ------------- INIT SOCK EVENT POLL SETS ------------ */
+    p_set = &NetSock_PollSetTbl[0];
+    for (i = 0; i < NET_SOCK_CFG_EVENT_POLL_NBR; i++) {
+        p_set->SignalObj = KAL_SemCreate((const  CPU_CHAR *)NET_SOCK_POLL_SIGNAL_NAME,
+                                                            DEF_NULL,
+                                                           &err_kal);
+        switch (err_kal) {
+            case KAL_ERR_NONE:
+                 break;
+
+            case KAL_ERR_MEM_ALLOC:
+                *p_err = NET_ERR_FAULT_MEM_ALLOC;
+                 return;
+
+
+            case KAL_ERR_ISR:
+            case KAL_ERR_INVALID_ARG:
+            case KAL_ERR_CREATE:
+            default:
+                *p_err = NET_SOCK_ERR_POLL_SIGNAL_FAULT;
+                 return;
+        }
+
+        p_set->RdyHeadPtr = (NET_SOCK *)0;
+        p_set->RdyTailPtr = (NET_SOCK *)0;
+        p_set->RdyNbr     =  0u;
+        p_set->SockNbr    =  0u;
+        p_set->Used       =  DEF_NO;
+        p_set->WaitPend   =  DEF_NO;
+
+        p_set++;
+    }
+#endif
+
                                                                 /* -------------- INIT RANDOM PORT NBR Q -------------- */
 #ifndef NET_SOCK_CFG_PORT_RANDOM_START
     NetSock_RandomPortNbrCur = (NET_PORT_NBR)NetUtil_RandomRangeGet(NET_SOCK_PORT_NBR_RANDOM_MIN,
@@ -3464,7 +3575,7 @@ NET_SOCK_RTN_CODE  NetSock_Conn (NET_SOCK_ID         sock_id,
 
 #ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
         case NET_SOCK_TYPE_STREAM:
-             rtn_code = NetSock_ConnHandlerStream(sock_id, p_sock, p_addr_remote, p_err);
+             rtn_code = NetSock_ConnHandlerStream(sock_id, p_sock, p_addr_remote, DEF_NULL, 0u, DEF_NULL, p_err);
 
 #ifdef  NET_SECURE_MODULE_EN
              if (rtn_code != NET_SOCK_BSD_ERR_CONN) {
@@ -4048,6 +4159,10 @@ void  NetSock_ConnSignalClose (NET_SOCK_ID   sock_id,
 *
 *               (6) On ANY error(s) after the transport connection is allocated, the transport connection
 *                   MUST be freed.
+*
+*               (7) TCP Fast Open configured on the socket is applied to the listening TCP connection so
+*                   that it is inherited by every connection accepted on it (see 'NetSock_CfgFastOpen()
+*                   Note #3b').
 *********************************************************************************************************
 */
 
@@ -4166,6 +4281,19 @@ NET_SOCK_RTN_CODE  NetSock_Listen (NET_SOCK_ID       sock_id,
       *p_err = NET_SOCK_ERR_NONE;
    }
 
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+   if ((*p_err == NET_SOCK_ERR_NONE) &&                         /* Cfg TCP Fast Open (see Note #7).                     */
+       (DEF_BIT_IS_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_FAST_OPEN) == DEF_YES)) {
+      (void)NetTCP_ConnCfgFastOpenEnHandler((NET_TCP_CONN_ID)conn_id_transport,
+                                                             DEF_ENABLED,
+                                                            &err);
+       if (err != NET_TCP_ERR_NONE) {                           /* If any errs, free transport conn (see Note #6).      */
+           NetTCP_ConnFree((NET_TCP_CONN_ID)conn_id_transport);
+          *p_err = NET_SOCK_ERR_CONN_FAIL;
+       }
+   }
+#endif
+
 #else
    (void)&conn_id_transport;                                    /* Prevent 'variable unused' compiler warnings.         */
    (void)&err;
@@ -5054,7 +5182,7 @@ exit_release:
 
 NET_SOCK_RTN_CODE  NetSock_RxDataFrom (NET_SOCK_ID          sock_id,
                                        void                *p_data_buf,
-                                       CPU_INT16U           data_buf_len,
+                                       CPU_INT32U           data_buf_len,
                                        NET_SOCK_API_FLAGS   flags,
                                        NET_SOCK_ADDR       *p_addr_remote,
                                        NET_SOCK_ADDR_LEN   *p_addr_len,
@@ -5146,8 +5274,9 @@ NET_SOCK_RTN_CODE  NetSock_RxDataFrom (NET_SOCK_ID          sock_id,
                                                                 /* -------------- VALIDATE/RX SOCK DATA --------------- */
    rtn_code = NetSock_RxDataHandler((NET_SOCK_ID        )sock_id,
                                     (void              *)p_data_buf,
-                                    (CPU_INT16U         )data_buf_len,
+                                    (CPU_INT32U         )data_buf_len,
                                     (NET_SOCK_API_FLAGS )flags,
+                                    (CPU_BOOLEAN        )DEF_NO,
                                     (NET_SOCK_ADDR     *)p_addr_remote,
                                     (NET_SOCK_ADDR_LEN *)p_addr_len,
                                     (void              *)p_ip_opts_buf,
@@ -5317,7 +5446,7 @@ exit:
 
 NET_SOCK_RTN_CODE  NetSock_RxData (NET_SOCK_ID          sock_id,
                                    void                *p_data_buf,
-                                   CPU_INT16U           data_buf_len,
+                                   CPU_INT32U           data_buf_len,
                                    NET_SOCK_API_FLAGS   flags,
                                    NET_ERR             *p_err)
 {
@@ -5339,8 +5468,9 @@ NET_SOCK_RTN_CODE  NetSock_RxData (NET_SOCK_ID          sock_id,
                                                                 /* -------------- VALIDATE/RX SOCK DATA --------------- */
     rtn_code = NetSock_RxDataHandler((NET_SOCK_ID        )sock_id,
                                      (void              *)p_data_buf,
-                                     (CPU_INT16U         )data_buf_len,
+                                     (CPU_INT32U         )data_buf_len,
                                      (NET_SOCK_API_FLAGS )flags,
+                                     (CPU_BOOLEAN        )DEF_NO,
                                      (NET_SOCK_ADDR     *)0,
                                      (NET_SOCK_ADDR_LEN *)0,
                                      (void              *)0,
@@ -5376,6 +5506,7 @@ exit_lock_fault:
 *
 *                                   NET_SOCK_FLAG_NONE              No socket flags selected.
 *                                   NET_SOCK_FLAG_TX_NO_BLOCK       Transmit socket data without blocking.
+*                                   NET_SOCK_FLAG_TX_MORE           More stream data follows; do NOT push.
 *
 *               p_addr_remote    Pointer to destination address buffer (see Note #5);
 *                                   required for datagram sockets, optional for stream sockets.
@@ -5530,7 +5661,7 @@ exit_lock_fault:
 
 NET_SOCK_RTN_CODE  NetSock_TxDataTo (NET_SOCK_ID          sock_id,
                                      void                *p_data,
-                                     CPU_INT16U           data_len,
+                                     CPU_INT32U           data_len,
                                      NET_SOCK_API_FLAGS   flags,
                                      NET_SOCK_ADDR       *p_addr_remote,
                                      NET_SOCK_ADDR_LEN    addr_len,
@@ -5548,8 +5679,9 @@ NET_SOCK_RTN_CODE  NetSock_TxDataTo (NET_SOCK_ID          sock_id,
                                                                 /* --------------- VALIDATE/TX APP DATA --------------- */
     rtn_code = NetSock_TxDataHandler((NET_SOCK_ID       )sock_id,
                                      (void             *)p_data,
-                                     (CPU_INT16U        )data_len,
+                                     (CPU_INT32U        )data_len,
                                      (NET_SOCK_API_FLAGS)flags,
+                                     (NET_SOCK_API_FLAGS)NET_SOCK_FLAG_NONE,
                                      (NET_SOCK_ADDR    *)p_addr_remote,
                                      (NET_SOCK_ADDR_LEN )addr_len,
                                      (NET_ERR          *)p_err);
@@ -5579,6 +5711,7 @@ NET_SOCK_RTN_CODE  NetSock_TxDataTo (NET_SOCK_ID          sock_id,
 *
 *                                   NET_SOCK_FLAG_NONE              No socket flags selected.
 *                                   NET_SOCK_FLAG_TX_NO_BLOCK       Transmit socket data without blocking.
+*                                   NET_SOCK_FLAG_TX_MORE           More stream data follows; do NOT push.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
@@ -5719,7 +5852,7 @@ NET_SOCK_RTN_CODE  NetSock_TxDataTo (NET_SOCK_ID          sock_id,
 
 NET_SOCK_RTN_CODE  NetSock_TxData (NET_SOCK_ID          sock_id,
                                    void                *p_data,
-                                   CPU_INT16U           data_len,
+                                   CPU_INT32U           data_len,
                                    NET_SOCK_API_FLAGS   flags,
                                    NET_ERR             *p_err)
 {
@@ -5735,8 +5868,9 @@ NET_SOCK_RTN_CODE  NetSock_TxData (NET_SOCK_ID          sock_id,
                                                                 /* --------------- VALIDATE/TX APP DATA --------------- */
     rtn_code = NetSock_TxDataHandler((NET_SOCK_ID       )sock_id,
                                      (void             *)p_data,
-                                     (CPU_INT16U        )data_len,
+                                     (CPU_INT32U        )data_len,
                                      (NET_SOCK_API_FLAGS)flags,
+                                     (NET_SOCK_API_FLAGS)NET_SOCK_FLAG_NONE,
                                      (NET_SOCK_ADDR    *)0,
                                      (NET_SOCK_ADDR_LEN )0,
                                      (NET_ERR          *)p_err);
@@ -5747,1149 +5881,2948 @@ NET_SOCK_RTN_CODE  NetSock_TxData (NET_SOCK_ID          sock_id,
 
 /*
 *********************************************************************************************************
-*                                           NetSock_Sel()
-*
-* Description : (1) Check multiple sockets for available resources &/or operations :
-*
-*                   (a) Acquire network lock
-*                   (b) Check sockets for available resources &/or operations :
-*                       (1) Validate socket descriptors' sockets
-*                       (2) Check    sockets for available resources &/or operations        See Note #3b2
-*                       (3) Prepare  sockets for wait on appropriate socket events
-*
-*                   (c) Handle timeout :                                                    See Note #3b3
-*                       (1) Prepare timeout
-*                       (2) Handle  time delay, if any
+*                                         NetSock_RxDataVec()
 *
-*                   (d) Wait on socket descriptor events :
-*                       (1) Demultiplex ready socket event(s) to appropriate socket descriptor(s)
-*
-*                   (e) Release network lock
+* Description : (1) Receive data from a socket into a data vector :
 *
+*                   (a) Acquire  network lock
+*                   (b) Validate data vector & remote address buffer
+*                   (c) Receive  socket data directly into the data vector                  See Note #3
+*                   (d) Release  network lock
 *
-* Argument(s) : sock_nbr_max        Maximum number of socket descriptors/handle identifiers in the socket
-*                                       descriptor sets (see Note #3b1).
+*                   See also 'NetSock_RxDataHandler()  Note #1'.
 *
-*               p_sock_desc_rd       Pointer to a set of socket descriptors/handle identifiers to :
 *
-*                                       (a) Check for available read  operation(s) [see Note #3b2A1].
+* Argument(s) : sock_id             Socket descriptor/handle identifier of socket to receive data.
 *
-*                                       (b) (1) Return the actual socket descriptors/handle identifiers
-*                                                   ready for available read  operation(s), if NO error(s)
-*                                                   [see Note #3b2B1a1];
-*                                           (2) Return the initial, non-modified set of socket descriptors/
-*                                                   handle identifiers, on any error(s) [see Note #3c2A];
-*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
-*                                                   if any timeout expires (see Note #3c2B).
+*               p_vec               Pointer to an array of data vector elements that will receive the socket's
+*                                       received data, in order.
 *
-*               p_sock_desc_wr       Pointer to a set of socket descriptors/handle identifiers to :
+*               vec_nbr             Number of data vector elements (see Note #2).
 *
-*                                       (a) Check for available write operation(s) [see Note #3b2A2].
+*               flags               Flags to select receive options; bit-field flags logically OR'd :
 *
-*                                       (b) (1) Return the actual socket descriptors/handle identifiers
-*                                                   ready for available write operation(s), if NO error(s)
-*                                                   [see Note #3b2B1a1];
-*                                           (2) Return the initial, non-modified set of socket descriptors/
-*                                                   handle identifiers, on any error(s) [see Note #3c2A];
-*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
-*                                                   if any timeout expires (see Note #3c2B).
+*                                       NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                       NET_SOCK_FLAG_RX_DATA_PEEK      Receive socket data without consuming
+*                                                                           the socket data; i.e. socket data
+*                                                                           NOT removed from application receive
+*                                                                           queue(s).
+*                                       NET_SOCK_FLAG_RX_NO_BLOCK       Receive socket data without blocking.
 *
-*               p_sock_desc_err      Pointer to a set of socket descriptors/handle identifiers to :
+*               p_addr_remote       Pointer to an address buffer that will receive the socket address structure
+*                                       with the received data's remote address, if available; NULL otherwise.
 *
-*                                       (a) Check for any error(s) &/or exception(s) [see Note #3b2A3].
+*               p_addr_len          Pointer to a variable to ... :
 *
-*                                       (b) (1) Return the actual socket descriptors/handle identifiers
-*                                                   flagged with any error(s) &/or exception(s), if NO
-*                                                   non-descriptor-related error(s) [see Note #3b2B1a1];
-*                                           (2) Return the initial, non-modified set of socket descriptors/
-*                                                   handle identifiers, on any error(s) [see Note #3c2A];
-*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
-*                                                   if any timeout expires (see Note #3c2B).
+*                                       (a) Pass the size of the address buffer pointed to by 'p_addr_remote'.
+*                                       (b) (1) Return the actual size of socket address structure with the
+*                                                   received data's remote address, if NO error(s);
+*                                           (2) Return 0,                           otherwise.
 *
-*               p_timeout           Pointer to a timeout (see Note #3b3).
+*                                   Required ONLY if 'p_addr_remote' is available.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_SOCK_ERR_NONE               Socket descriptors successfully checked for
-*                                                                   available resources &/or operations;
-*                                                                   check return value for the number of
-*                                                                   ready socket descriptors with available
-*                                                                   resources &/or operations.
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_vec'/'p_addr_len' passed a NULL
+*                                                                       pointer.
+*                               NET_SOCK_ERR_INVALID_ADDR_LEN       Invalid socket address structure length.
 *
-*                               NET_SOCK_ERR_TIMEOUT            Socket descriptors NOT ready within timeout
-*                                                                   (see Note #3b3A1a2).
+*                                                                   ---- RETURNED BY NetSock_DataVecLenGet() : ----
+*                               NET_SOCK_ERR_INVALID_ARG            Invalid number of data vector elements.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Invalid data vector total length.
 *
-*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
-*                               NET_SOCK_ERR_INVALID_DESC       Invalid socket descriptor/number.
-*                               NET_SOCK_ERR_INVALID_TIMEOUT    Invalid timeout.
+*                                                                   ---- RETURNED BY NetSock_RxDataHandler() : ----
+*                               NET_SOCK_ERR_NONE                   Socket data successfully received; check return
+*                                                                       value for number of data octets received.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Socket data vector insufficient size; some, but
+*                                                                       not all, socket data deframed into data
+*                                                                       vector.
+*                               NET_SOCK_ERR_INVALID_OP             Invalid socket operation (see Note #4).
 *
-*                                                               - RETURNED BY NetSock_SelDescHandlerRd() : --
-*                                                               - RETURNED BY NetSock_SelDescHandlerWr() : --
-*                                                               - RETURNED BY NetSock_SelDescHandlerErr() : -
-*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
-*                               NET_SOCK_ERR_INVALID_TYPE       Invalid socket type.
-*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*                               See also 'NetSock_RxData()  Return error codes'.
 *
-*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
-*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : -----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
 *
-* Return(s)   : Number of socket descriptors with available resources &/or operations, if any     (see Note #3c1A1).
+* Return(s)   : Number of positive data octets received, if NO error(s).
 *
-*               NET_SOCK_BSD_RTN_CODE_TIMEOUT,                                         on timeout (see Note #3c1B).
+*               NET_SOCK_BSD_RTN_CODE_CONN_CLOSED,       if socket connection closed.
 *
-*               NET_SOCK_BSD_ERR_SEL,                                                  otherwise  (see Note #3c1A2a).
+*               NET_SOCK_BSD_ERR_RX,                     otherwise.
 *
-* Caller(s)   : select().
+* Caller(s)   : recvmsg().
 *
 *               This function is a network protocol suite application programming interface (API) function
 *               & MAY be called by application function(s).
 *
-* Note(s)     : (2) NetSock_Sel() blocked until network initialization completes.
+* Note(s)     : (2) The number of data vector elements MUST be between 1 & NET_SOCK_CFG_DATA_VEC_NBR_MAX.
 *
-*               (3) (a) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*               (3) Received data fills each data vector element in order, exactly as if the data vector
+*                   were one contiguous buffer of the vector's total length.  Datagram & stream semantics
+*                   are identical to NetSock_RxData(); see 'NetSock_RxData()  Note #3'.
 *
-*                       (1) (A) "select() ... shall support" the following file descriptor types :
+*               (4) Secure sockets do NOT support vectored receives; see 'NetSock_RxDataHandler()
+*                   Note #11b'.
+*********************************************************************************************************
+*/
+
+NET_SOCK_RTN_CODE  NetSock_RxDataVec (NET_SOCK_ID          sock_id,
+                                      NET_SOCK_DATA_VEC   *p_vec,
+                                      CPU_INT16U           vec_nbr,
+                                      NET_SOCK_API_FLAGS   flags,
+                                      NET_SOCK_ADDR       *p_addr_remote,
+                                      NET_SOCK_ADDR_LEN   *p_addr_len,
+                                      NET_ERR             *p_err)
+{
+    NET_BUF_DATA_VEC_CURSOR  cursor;
+    CPU_INT16U               data_len;
+    NET_SOCK_RTN_CODE        rtn_code = NET_SOCK_BSD_ERR_RX;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+#endif
+
+    Net_GlobalLockAcquire((void *)&NetSock_RxDataVec, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
+
+                                                                /* --------------- VALIDATE RX ADDR BUF --------------- */
+    if (p_addr_remote != (NET_SOCK_ADDR *)0) {
+        if (p_addr_len == (NET_SOCK_ADDR_LEN *)0) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+           *p_err = NET_ERR_FAULT_NULL_PTR;
+            goto exit_release;
+        }
+        if (*p_addr_len < (NET_SOCK_ADDR_LEN)NET_SOCK_ADDR_SIZE) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidAddrLenCtr);
+           *p_err = NET_SOCK_ERR_INVALID_ADDR_LEN;
+            goto exit_release;
+        }
+       *p_addr_len = 0;                                         /* Cfg dflt addr len for err.                           */
+    }
+
+                                                                /* --------------- VALIDATE RX DATA VEC --------------- */
+    data_len = NetSock_DataVecLenGet(p_vec, vec_nbr, p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         goto exit_release;
+    }
+
+    cursor.VecPtr = p_vec;
+    cursor.VecNbr = vec_nbr;
+    cursor.VecIx  = 0u;
+                                                                /* -------------- VALIDATE/RX SOCK DATA --------------- */
+    rtn_code = NetSock_RxDataHandler((NET_SOCK_ID        )sock_id,
+                                     (void              *)&cursor,
+                                     (CPU_INT16U         )data_len,
+                                     (NET_SOCK_API_FLAGS )flags,
+                                     (CPU_BOOLEAN        )DEF_YES,
+                                     (NET_SOCK_ADDR     *)p_addr_remote,
+                                     (NET_SOCK_ADDR_LEN *)p_addr_len,
+                                     (void              *)0,
+                                     (CPU_INT08U         )0u,
+                                     (CPU_INT08U        *)0,
+                                     (NET_ERR           *)p_err);
+
+exit_release:
+    Net_GlobalLockRelease();
+
+exit_lock_fault:
+    return (rtn_code);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetSock_TxDataVec()
 *
-*                               (1) "regular files,"                        ...
-*                               (2) "terminal and pseudo-terminal devices," ...
-*                               (3) "STREAMS-based files,"                  ...
-*                               (4) "FIFOs,"                                ...
-*                               (5) "pipes,"                                ...
-*                               (6) "sockets."
+* Description : (1) Transmit data from a data vector through a socket :
 *
-*                           (B) "The behavior of ... select() on ... other types of ... file descriptors
-*                                ... is unspecified."
+*                   (a) Validate data vector
+*                   (b) Transmit socket data directly from the data vector                  See Note #3
 *
-*                       (2) Network Socket Layer supports BSD 4.x select() functionality with the following
-*                           restrictions/constraints :
+*                   See also 'NetSock_TxDataHandler()  Note #1'.
 *
-*                           (A) ONLY supports the following file descriptor types :
-*                               (1) Sockets
 *
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to transmit data.
 *
-*                   (b) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*               p_vec           Pointer to an array of data vector elements with the application data to
+*                                   transmit, in order.
 *
-*                       (1) (A) "The 'nfds' argument ('sock_nbr_max') specifies the range of descriptors to be
-*                                tested.  The first 'nfds' descriptors shall be checked in each set; that is,
-*                                the [following] descriptors ... in the descriptor sets shall be examined" :
+*               vec_nbr         Number of data vector elements (see Note #2).
 *
-*                               (1) "from zero" ...
-*                               (2) "through nfds-1."
+*               flags           Flags to select transmit options; bit-field flags logically OR'd :
 *
-*                           (B) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                               6th Printing, Section 6.3, Page 163 states that :
+*                                   NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                   NET_SOCK_FLAG_TX_NO_BLOCK       Transmit socket data without blocking.
+*                                   NET_SOCK_FLAG_TX_MORE           More stream data follows; do NOT push.
 *
-*                               (1) ... since "descriptors start at 0" ...
+*               p_addr_remote   Pointer to destination address buffer, if available; NULL for connected sockets.
 *
-*                               (2) "the ['nfds'] argument" specifies :
-*                                   (a) "the number of descriptors," ...
-*                                   (b) "not the largest value."
+*               addr_len        Length of  destination address buffer (in octets).
 *
-*                       (2) "The select() function shall ... examine the file descriptor sets whose addresses
-*                            are passed in the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'), and
-*                            'errorfds' ('p_sock_desc_err') parameters to see whether some of their descriptors
-*                            are ready for reading, are ready for writing, or have an exceptional condition
-*                            pending, respectively."
+*               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                           (A) (1) (a) "If the 'readfds'  argument ('p_sock_desc_rd')  is not a null pointer,
-*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
-*                                        input specifies the file descriptors to be checked for being ready
-*                                        to read,  and on output indicates which file descriptors are ready
-*                                        to read."
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_vec' passed a NULL pointer.
 *
-*                                   (b) "A descriptor shall be considered ready for reading when a call to
-*                                        an input function ... would not block, whether or not the function
-*                                        would transfer data successfully.  (The function might return data,
-*                                        an end-of-file indication, or an error other than one indicating
-*                                        that it is blocked, and in each of these cases the descriptor shall
-*                                        be considered ready for reading.)" :
+*                                                                   ---- RETURNED BY NetSock_DataVecLenGet() : ----
+*                               NET_SOCK_ERR_INVALID_ARG            Invalid number of data vector elements.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Invalid data vector total length.
 *
-*                                       (1) "If the socket is currently listening, then it shall be marked
-*                                            as readable if an incoming connection request has been received,
-*                                            and a call to the accept() function shall complete without
-*                                            blocking."
+*                                                                   ----- RETURNED BY NetSock_TxDataHandler() : -----
+*                               NET_SOCK_ERR_NONE                   Socket data successfully transmitted; check
+*                                                                       return value for number of data octets
+*                                                                       transmitted.
+*                               NET_SOCK_ERR_INVALID_OP             Invalid socket operation (see Note #4).
 *
-*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                                       6th Printing, Section 6.3, Pages 164-165 states that "a socket is ready
-*                                       for reading if any of the following ... conditions is true" :
+*                               See also 'NetSock_TxDataTo()  Return error codes'.
 *
-*                                       (1) "A read operation on the socket will not block and will return a
-*                                            value greater than 0 (i.e., the data that is ready to be read)."
+* Return(s)   : Number of positive data octets transmitted, if NO error(s).
 *
-*                                       (2) "The read half of the connection is closed (i.e., a TCP connection
-*                                            that has received a FIN).  A read operation ... will not block and
-*                                            will return 0 (i.e., EOF)."
+*               NET_SOCK_BSD_RTN_CODE_CONN_CLOSED,          if socket connection closed.
 *
-*                                       (3) "The socket is a listening socket and the number of completed
-*                                            connections is nonzero.  An accept() on the listening socket
-*                                            will ... not block."
+*               NET_SOCK_BSD_ERR_TX,                        otherwise.
 *
-*                                       (4) "A socket error is pending.  A read operation on the socket will
-*                                            not block and will return an error (-1) with 'errno' set to the
-*                                            specific error condition."
+* Caller(s)   : sendmsg().
 *
-*                                           (A) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1,
-*                                               3rd Edition, 6th Printing, Section 6.3, Page 165 states "that
-*                                               when an error occurs on a socket, it is [also] marked as both
-*                                               readable and writeable by select()".
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
 *
-*                                               See also Notes #3b2A2c4A & #3b2A3d.
+* Note(s)     : (2) The number of data vector elements MUST be between 1 & NET_SOCK_CFG_DATA_VEC_NBR_MAX.
 *
-*                               (2) (a) "If the 'writefds' argument ('p_sock_desc_wr')  is not a null pointer,
-*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
-*                                        input specifies the file descriptors to be checked for being ready
-*                                        to write, and on output indicates which file descriptors are ready
-*                                        to write."
+*               (3) (a) The data vector is transmitted as if it were one contiguous buffer of the vector's
+*                       total length.  For datagram-type sockets, the entire data vector is transmitted as
+*                       a single datagram; for stream-type sockets, small data vector elements are coalesced
+*                       into full-sized segments.
 *
-*                                   (b) "A descriptor shall be considered ready for writing when a call to
-*                                        an output function ... would not block, whether or not the function
-*                                        would transfer data successfully" :
+*                   (b) Application data is copied directly from the data vector elements into the transport
+*                       layer's transmit buffers; NO intermediate contiguous buffer is required.
 *
-*                                       (1) "If a non-blocking call to the connect() function has been made
-*                                            for a socket, and the connection attempt has either succeeded
-*                                            or failed leaving a pending error, the socket shall be marked
-*                                            as writable."
+*               (4) Secure sockets do NOT support vectored transmits; see 'NetSock_TxDataHandler()
+*                   Note #7d'.
+*********************************************************************************************************
+*/
+
+NET_SOCK_RTN_CODE  NetSock_TxDataVec (NET_SOCK_ID          sock_id,
+                                      NET_SOCK_DATA_VEC   *p_vec,
+                                      CPU_INT16U           vec_nbr,
+                                      NET_SOCK_API_FLAGS   flags,
+                                      NET_SOCK_ADDR       *p_addr_remote,
+                                      NET_SOCK_ADDR_LEN    addr_len,
+                                      NET_ERR             *p_err)
+{
+    NET_BUF_DATA_VEC_CURSOR  cursor;
+    CPU_INT16U               data_len;
+    NET_SOCK_RTN_CODE        rtn_code;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+#endif
+                                                                /* --------------- VALIDATE TX DATA VEC --------------- */
+    data_len = NetSock_DataVecLenGet(p_vec, vec_nbr, p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         return (NET_SOCK_BSD_ERR_TX);
+    }
+
+    cursor.VecPtr = p_vec;
+    cursor.VecNbr = vec_nbr;
+    cursor.VecIx  = 0u;
+                                                                /* --------------- VALIDATE/TX APP DATA --------------- */
+    rtn_code = NetSock_TxDataHandler((NET_SOCK_ID       )sock_id,
+                                     (void             *)&cursor,
+                                     (CPU_INT16U        )data_len,
+                                     (NET_SOCK_API_FLAGS)flags,
+                                     (NET_SOCK_API_FLAGS)NET_SOCK_FLAG_DATA_VEC,
+                                     (NET_SOCK_ADDR    *)p_addr_remote,
+                                     (NET_SOCK_ADDR_LEN )addr_len,
+                                     (NET_ERR          *)p_err);
+
+    return (rtn_code);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetSock_RxDataMsgs()
 *
-*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                                       6th Printing, Section 6.3, Page 165 states that "a socket is ready for
-*                                       writing if any of the following ... conditions is true" :
+* Description : (1) Receive multiple datagrams from a datagram-type socket :
 *
-*                                       (1) "A write operation will not block and will return a positive value
-*                                            (e.g., the number of bytes accepted by the transport layer)."
+*                   (a) Acquire  network lock
+*                   (b) Validate socket & messages
+*                   (c) Receive  one datagram into each message's data vector               See Note #3
+*                   (d) Release  network lock
 *
-*                                       (2) "The write half of the connection is closed."
 *
-*                                       (3) "A socket using a non-blocking connect() has completed the
-*                                            connection, or the connect() has failed."
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to receive data.
 *
-*                                       (4) "A socket error is pending.  A write operation on the socket will
-*                                            not block and will return an error (-1) with 'errno' set to the
-*                                            specific error condition."
+*               p_msgs          Pointer to an array of messages; each message's data vector receives one
+*                                   datagram (see Note #2).
 *
-*                                           (A) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1,
-*                                               3rd Edition, 6th Printing, Section 6.3, Page 165 states "that
-*                                               when an error occurs on a socket, it is [also] marked as both
-*                                               readable and writeable by select()".
+*               msg_nbr         Number of messages (see Note #2a).
 *
-*                                               See also Notes #3b2A1c4A & #3b2A3d.
+*               flags           Flags to select receive options; bit-field flags logically OR'd :
 *
-*                               (3) (a) "If the 'errorfds' argument ('p_sock_desc_err') is not a null pointer,
-*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
-*                                        input specifies the file descriptors to be checked for error
-*                                        conditions pending, and on output indicates which file descriptors
-*                                        have error conditions pending."
+*                                   NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                   NET_SOCK_FLAG_RX_NO_BLOCK       Receive socket data without blocking.
 *
-*                                   (b) "A file descriptor ... shall be considered to have an exceptional
-*                                        condition pending ... as noted below" :
+*               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                                       (1) (A) "A socket ... receive operation ... [that] would return
-*                                                out-of-band data without blocking."
-*                                           (B) "A socket ... [with] out-of-band data ... present in the
-*                                                receive queue."
+*                               NET_SOCK_ERR_NONE                   At least one datagram successfully received;
+*                                                                       check return value for number of messages
+*                                                                       received.
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_msgs' passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_ARG            Invalid number of messages.
+*                               NET_SOCK_ERR_INVALID_FLAG           Invalid socket flags.
+*                               NET_SOCK_ERR_INVALID_TYPE           Invalid socket type (see Note #2b).
+*                               NET_SOCK_ERR_INVALID_ADDR_LEN       Invalid socket address structure length.
 *
-*                                           Out-of-band data NOT supported (see 'net_tcp.h  Note #1b').
+*                                                                   -------- RETURNED BY NetSock_IsUsed() : ---------
+*                               NET_INIT_ERR_NOT_COMPLETED          Network initialization NOT complete.
+*                               NET_SOCK_ERR_INVALID_SOCK           Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED               Socket NOT currently used.
 *
-*                                       (2) "If a socket has a pending error."
+*                                                                   ---- RETURNED BY NetSock_DataVecLenGet() : ----
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Invalid data vector total length.
 *
-*                                       (3) "Other circumstances under which a socket may be considered to
-*                                            have an exceptional condition pending are protocol-specific
-*                                            and implementation-defined."
+*                                                                   - RETURNED BY NetSock_RxDataHandlerDatagram() : -
+*                               NET_SOCK_ERR_RX_Q_EMPTY             Socket receive queue empty.
 *
-*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                                       6th Printing, Section 6.3, Page 165 states that "a socket has an
-*                                       exception condition pending if ... any of the following ... conditions
-*                                       is true" :
+*                               See also 'NetSock_RxData()  Return error codes'.
 *
-*                                       (1) (A) "Out-of-band data for the socket" is currently available; ...
-*                                           (B) "Or the socket is still at the out-of-band mark."
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : -----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
 *
-*                                           Out-of-band data NOT supported (see 'net_tcp.h  Note #1b').
+* Return(s)   : Number of messages received, if NO error(s).
 *
-*                                   (d) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                                       6th Printing, Section 6.3, Page 165 states "that when an error occurs on
-*                                       a socket, it is [also] marked as both readable and writeable by select()".
+*               NET_SOCK_BSD_ERR_RX,          otherwise.
 *
-*                                       See also Notes #3b2A1c4A & #3b2A2c4A.
+* Caller(s)   : recvmmsg().
 *
-*                           (B) (1) (a) "Upon successful completion, ... select() ... shall" :
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
 *
-*                                       (1) "modify the objects pointed to by the 'readfds' ('p_sock_desc_rd'),
-*                                            'writefds' ('p_sock_desc_wr'), and 'errorfds' ('p_sock_desc_err')
-*                                            arguments to indicate which file descriptors are ready for
-*                                            reading, ready for writing, or have an error condition pending,
-*                                            respectively," ...
+* Note(s)     : (2) (a) The number of messages MUST be between 1 & NET_SOCK_CFG_MSG_NBR_MAX.
 *
-*                                       (2) "and shall return the total number of ready descriptors in all
-*                                            the output sets."
+*                   (b) Only datagram-type sockets are supported; stream-type sockets have no message
+*                       boundaries to batch on.
 *
-*                                            See also Note #3c1A1.
+*                   (c) For each message, the application configures 'VecPtr'/'VecNbr' &, if the datagram's
+*                       remote address is required, 'AddrPtr'/'AddrLen'.  On return, 'DataLen' holds the
+*                       received datagram length & 'Flags' holds NET_SOCK_FLAG_RX_DATA_TRUNC if the datagram
+*                       did NOT fit in the message's data vector.
 *
-*                                   (b) (1) "For each file descriptor less than nfds ('sock_nbr_max'), the
-*                                            corresponding bit shall be set on successful completion" :
+*               (3) (a) The network lock is acquired & the socket is validated once for the whole batch.
 *
-*                                           (A) "if it was set on input" ...
-*                                           (B) "and the associated condition is true for that file descriptor."
+*                   (b) Only the first datagram receive may block.  Further datagrams are received ONLY
+*                       while datagrams remain queued on the socket; i.e. the batch never waits for more
+*                       datagrams once at least one datagram has been received.
 *
-*                                       (2) Conversely, "for each file descriptor ... the corresponding bit
-*                                           shall be ... [clear] ... on ... completion" :
+*                   (c) Peeking is NOT supported since every message would receive the same datagram.
 *
-*                                           (A) If it was clear on input;                                         ...
-*                                           (B) If the associated condition is NOT true for that file descriptor; ...
-*                                           (C) Or it was set on input, but any timeout occurs (see Note #3c2B).
+*               (4) If an error occurs after at least one datagram has been received, the number of
+*                   datagrams already received is returned with NO error; the error is reported by the next
+*                   receive call.
+*********************************************************************************************************
+*/
+
+NET_SOCK_RTN_CODE  NetSock_RxDataMsgs (NET_SOCK_ID          sock_id,
+                                       NET_SOCK_MSG        *p_msgs,
+                                       CPU_INT16U           msg_nbr,
+                                       NET_SOCK_API_FLAGS   flags,
+                                       NET_ERR             *p_err)
+{
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    NET_SOCK_FLAGS           flag_mask;
+#endif
+    NET_SOCK                *p_sock;
+    NET_SOCK_MSG            *p_msg;
+    NET_SOCK_ADDR_LEN       *p_addr_len;
+    NET_BUF_DATA_VEC_CURSOR  cursor;
+    NET_SOCK_API_FLAGS       flags_msg;
+    CPU_INT16U               data_len;
+    CPU_INT16U               msg_ix;
+    NET_SOCK_RTN_CODE        rtn_code;
+    NET_SOCK_RTN_CODE        msg_ctr;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+                                                                /* ---------------- VALIDATE RX MSGS ------------------ */
+    if (p_msgs == (NET_SOCK_MSG *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (NET_SOCK_BSD_ERR_RX);
+    }
+                                                                /* ----------------- VALIDATE RX FLAGS ---------------- */
+    flag_mask = NET_SOCK_FLAG_NONE        |
+                NET_SOCK_FLAG_RX_NO_BLOCK;                      /* See Note #3c.                                        */
+    if (((NET_SOCK_FLAGS)flags & (NET_SOCK_FLAGS)~flag_mask) != NET_SOCK_FLAG_NONE) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidFlagsCtr);
+       *p_err =  NET_SOCK_ERR_INVALID_FLAG;
+        return (NET_SOCK_BSD_ERR_RX);
+    }
+#endif
+    if ((msg_nbr < 1u) ||                                       /* See Note #2a.                                        */
+        (msg_nbr > NET_SOCK_CFG_MSG_NBR_MAX)) {
+       *p_err =  NET_SOCK_ERR_INVALID_ARG;
+        return (NET_SOCK_BSD_ERR_RX);
+    }
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_RxDataMsgs, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         return (NET_SOCK_BSD_ERR_RX);
+    }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* ---------------- VALIDATE SOCK USED ---------------- */
+   (void)NetSock_IsUsed(sock_id, p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         msg_ctr = NET_SOCK_BSD_ERR_RX;
+         goto exit_release;
+    }
+#endif
+
+    p_sock = &NetSock_Tbl[sock_id];
+    if (p_sock->SockType != NET_SOCK_TYPE_DATAGRAM) {           /* See Note #2b.                                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidSockTypeCtr);
+       *p_err   = NET_SOCK_ERR_INVALID_TYPE;
+        msg_ctr = NET_SOCK_BSD_ERR_RX;
+        goto exit_release;
+    }
+
+
+                                                                /* ------------------- RX SOCK MSGS ------------------- */
+    flags_msg = flags;
+    DEF_BIT_SET(flags_msg, NET_SOCK_FLAG_DATA_VEC);
+    msg_ctr   = 0;
+
+    for (msg_ix = 0u; msg_ix < msg_nbr; msg_ix++) {
+        p_msg = &p_msgs[msg_ix];
+
+        if (msg_ix > 0u) {                                      /* See Note #3b.                                        */
+            if (p_sock->RxQ_Head == (NET_BUF *)0) {
+                break;
+            }
+            DEF_BIT_SET(flags_msg, NET_SOCK_FLAG_RX_NO_BLOCK);
+        }
+
+        p_msg->DataLen = 0u;
+        p_msg->Flags   = NET_SOCK_FLAG_NONE;
+
+        p_addr_len = (NET_SOCK_ADDR_LEN *)0;
+        if (p_msg->AddrPtr != (NET_SOCK_ADDR *)0) {
+            if (p_msg->AddrLen < (NET_SOCK_ADDR_LEN)NET_SOCK_ADDR_SIZE) {
+                NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidAddrLenCtr);
+               *p_err = NET_SOCK_ERR_INVALID_ADDR_LEN;
+                break;
+            }
+            p_addr_len = &p_msg->AddrLen;
+        }
+
+        data_len = NetSock_DataVecLenGet(p_msg->VecPtr, p_msg->VecNbr, p_err);
+        if (*p_err != NET_SOCK_ERR_NONE) {
+            break;
+        }
+
+        cursor.VecPtr = p_msg->VecPtr;
+        cursor.VecNbr = p_msg->VecNbr;
+        cursor.VecIx  = 0u;
+
+        rtn_code = NetSock_RxDataHandlerDatagram((NET_SOCK_ID        )sock_id,
+                                                 (NET_SOCK          *)p_sock,
+                                                 (void              *)&cursor,
+                                                 (CPU_INT16U         )data_len,
+                                                 (NET_SOCK_API_FLAGS )flags_msg,
+                                                 (NET_SOCK_ADDR     *)p_msg->AddrPtr,
+                                                 (NET_SOCK_ADDR_LEN *)p_addr_len,
+                                                 (void              *)0,
+                                                 (CPU_INT08U         )0u,
+                                                 (CPU_INT08U        *)0,
+                                                 (NET_ERR           *)p_err);
+        if (rtn_code < 1) {
+            break;
+        }
+
+        p_msg->DataLen = (CPU_INT16U)rtn_code;
+        if (*p_err == NET_SOCK_ERR_INVALID_DATA_SIZE) {         /* If datagram trunc'd, ...                             */
+            p_msg->Flags = NET_SOCK_FLAG_RX_DATA_TRUNC;         /* ... flag msg (see Note #2c).                         */
+        }
+        msg_ctr++;
+    }
+
+    if (msg_ctr > 0) {                                          /* See Note #4.                                         */
+       *p_err   = NET_SOCK_ERR_NONE;
+    } else {
+        msg_ctr = NET_SOCK_BSD_ERR_RX;
+    }
+
+
+exit_release:
+    Net_GlobalLockRelease();
+
+    return (msg_ctr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetSock_TxDataMsgs()
 *
-*                               (2) select() can NOT absolutely guarantee that descriptors returned as ready
-*                                   will still be ready during subsequent operations since any higher priority
-*                                   tasks or processes may asynchronously consume the descriptors' operations
-*                                   &/or resources.  This can occur since select() functionality & subsequent
-*                                   operations are NOT atomic operations protected by network, file system,
-*                                   or operating system mechanisms.
+* Description : (1) Transmit multiple datagrams through a datagram-type socket :
 *
-*                                   However, as long as no higher priority tasks or processes access any of
-*                                   the same descriptors, then a single task or process can assume that all
-*                                   descriptors returned as ready by select() will still be ready during
-*                                   subsequent operations.
+*                   (a) Acquire  network lock
+*                   (b) Validate socket & messages
+*                   (c) Transmit each message's data vector as one datagram                 See Note #3
+*                   (d) Release  network lock
 *
-*                       (3) (A) "The 'timeout' parameter ('ptimeout') controls how long ... select() ... shall
-*                                take before timing out."
 *
-*                               (1) (a) "If the 'timeout' parameter ('ptimeout') is not a null pointer, it
-*                                        specifies a maximum interval to wait for the selection to complete."
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to transmit data.
 *
-*                                       (1) "If none of the selected descriptors are ready for the requested
-*                                            operation, ... select() ... shall block until at least one of the
-*                                            requested operations becomes ready ... or ... until the timeout
-*                                            occurs."
+*               p_msgs          Pointer to an array of messages; each message's data vector is transmitted
+*                                   as one datagram (see Note #2).
 *
-*                                       (2) "If the specified time interval expires without any requested
-*                                            operation becoming ready, the function shall return."
+*               msg_nbr         Number of messages (see Note #2a).
 *
-*                                       (3) "To effect a poll, the 'timeout' parameter ('ptimeout') should not be
-*                                            a null pointer, and should point to a zero-valued timespec structure
-*                                            ('NET_SOCK_TIMEOUT')."
+*               flags           Flags to select transmit options; bit-field flags logically OR'd :
 *
-*                                   (b) (1) (A) "If the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'),
-*                                                and 'errorfds' ('p_sock_desc_err') arguments are"                ...
-*                                               (1) "all null pointers"                                          ...
-*                                               (2) [or all null-valued (i.e. no file descriptors set)]          ...
-*                                           (B) "and the 'timeout' argument ('ptimeout') is not a null pointer," ...
+*                                   NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                   NET_SOCK_FLAG_TX_NO_BLOCK       Transmit socket data without blocking.
 *
-*                                       (2) ... then "select() ... shall block for the time specified".
+*               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               (2) "If the 'timeout' parameter ('ptimeout') is a null pointer, then the call to
-*                                    ... select() shall block indefinitely until at least one descriptor meets the
-*                                    specified criteria."
-*
-*                                   (a) (1) Although IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION'
-*                                           states that select() may "block indefinitely until ... one of the
-*                                           requested operations becomes ready ... or until interrupted by a signal",
-*                                           it does NOT explicity specify how to handle the case where the descriptor
-*                                           arguments & the timeout parameter argument are all NULL pointers.
-*
-*                                           Therefore, it seems reasonable that select() should "block indefinitely
-*                                           ... until interrupted by a signal" if the descriptor arguments & the
-*                                           timeout parameter argument are all NULL pointers.
-*
-*                                       (2) However, since inter-process signals are NOT currently supported, it
-*                                           does NOT seem reasonable to block a task or process indefinitely (i.e.
-*                                           forever) if the descriptor arguments & the timeout parameter argument
-*                                           are all NULL pointers.  Instead, an 'invalid timeout interval' error
-*                                           should be returned.
-*
-*                                           See also Note #3d2B.
-*
-*                           (B) (1) "For the select() function, the timeout period is given ... in an argument
-*                                   ('ptimeout') of type struct 'timeval' ('NET_SOCK_TIMEOUT')" ... :
-*
-*                                   (a) "in seconds" ...
-*                                   (b) "and microseconds."
-*
-*                               (2) (a) (1) "Implementations may place limitations on the maximum timeout interval
-*                                            supported" :
-*
-*                                           (A) "All implementations shall support a maximum timeout interval of
-*                                                at least 31 days."
-*
-*                                               (1) However, since maximum timeout interval values are dependent
-*                                                   on the specific OS implementation; a maximum timeout interval
-*                                                   can NOT be guaranteed.
-*
-*                                           (B) "If the 'timeout' argument ('ptimeout') specifies a timeout interval
-*                                                greater than the implementation-defined maximum value, the maximum
-*                                                value shall be used as the actual timeout value."
-*
-*                                       (2) "Implementations may also place limitations on the granularity of
-*                                            timeout intervals" :
-*
-*                                           (A) "If the requested 'timeout' interval requires a finer granularity
-*                                                than the implementation supports, the actual timeout interval
-*                                                shall be rounded up to the next supported value."
-*
-*                                   (b) Operating systems may have different minimum/maximum ranges & resolutions
-*                                       for timeouts while pending or waiting on an operating system resource to
-*                                       become available (see Note #3b3A1a) versus time delays for suspending a
-*                                       task or process that is NOT pending or waiting for an operating system
-*                                       resource (see Note #3b3A1b).
-*
-*                   (c) (1) (A) IEEE Std 1003.1, 2004 Edition, Section 'select() : RETURN VALUE' states that :
-*
-*                               (1) "Upon successful completion, ... select() ... shall return the total
-*                                    number of bits set in the bit masks."
-*
-*                               (2) (a) "Otherwise, -1 shall be returned," ...
-*                                   (b) "and 'errno' shall be set to indicate the error."
-*                                       'errno' NOT currently supported (see 'net_bsd.h  Note #1b').
-*
-*                           (B) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                               6th Printing, Section 6.3, Page 161 states that BSD select() function
-*                               "returns ... 0 on timeout".
-*
-*                       (2) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
-*
-*                           (A) "On failure, the objects pointed to by the 'readfds' ('p_sock_desc_rd'),
-*                                'writefds' ('p_sock_desc_wr'), and 'errorfds' ('p_sock_desc_err') arguments
-*                                shall not be modified."
-*
-*                               (1) Since 'p_sock_desc_rd', 'p_sock_desc_wr', & 'p_sock_desc_err' arguments
-*                                   are both input & output arguments; their input values, prior to use,
-*                                   MUST be copied to return their initial input values PRIOR to all other
-*                                   validation or function handling in case of any error(s).
-*
-*                           (B) "If the 'timeout' interval expires without the specified condition being
-*                                true for any of the specified file descriptors, the objects pointed to
-*                                by the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'), and
-*                                'errorfds' ('p_sock_desc_err') arguments shall have all bits set to 0."
+*                               NET_SOCK_ERR_NONE                   At least one datagram successfully
+*                                                                       transmitted; check return value for
+*                                                                       number of messages transmitted.
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_msgs' passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_ARG            Invalid number of messages.
+*                               NET_SOCK_ERR_INVALID_FLAG           Invalid socket flags.
+*                               NET_SOCK_ERR_INVALID_TYPE           Invalid socket type (see Note #2b).
 *
-*                   (d) IEEE Std 1003.1, 2004 Edition, Section 'select() : ERRORS' states that "under the
-*                       following conditions, ... select() shall fail and set 'errno' to" :
+*                                                                   -------- RETURNED BY NetSock_IsUsed() : ---------
+*                               NET_INIT_ERR_NOT_COMPLETED          Network initialization NOT complete.
+*                               NET_SOCK_ERR_INVALID_SOCK           Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED               Socket NOT currently used.
 *
-*                       (1) "[EBADF] - One or more of the file descriptor sets specified a file descriptor
-*                            that is not a valid open file descriptor."
+*                                                                   ---- RETURNED BY NetSock_DataVecLenGet() : ----
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Invalid data vector total length.
 *
-*                       (2) "[EINVAL]" -
+*                                                                   --- RETURNED BY NetSock_IsValidAddrRemote() : ----
+*                               NET_SOCK_ERR_INVALID_FAMILY         Invalid socket protocol/address family.
+*                               NET_SOCK_ERR_INVALID_ADDR           Invalid socket address.
+*                               NET_SOCK_ERR_INVALID_ADDR_LEN       Invalid socket address structure length.
 *
-*                           (A) "The 'nfds' argument ('sock_nbr_max') is" :
-*                               (1) "less than 0 or" ...
-*                               (2) "greater than FD_SETSIZE."
+*                               See also 'NetSock_TxDataTo()  Return error codes'.
 *
-*                               See also Note #3b1.
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : -----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
 *
-*                           (B) "An invalid timeout interval was specified."
+* Return(s)   : Number of messages transmitted, if NO error(s).
 *
-*                               See also Note #3b3.
+*               NET_SOCK_BSD_ERR_TX,             otherwise.
 *
-*                           'errno' NOT currently supported (see 'net_bsd.h  Note #1b').
+* Caller(s)   : sendmmsg().
 *
-*               (4) A socket events table lists requested socket or connection ID numbers/handle identifiers
-*                   & their respective socket event operations.
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
 *
-*                   (a) Socket event tables are terminated with NULL table entry values.
+* Note(s)     : (2) (a) The number of messages MUST be between 1 & NET_SOCK_CFG_MSG_NBR_MAX.
 *
-*                   (b) (1) NET_SOCK_CFG_SEL_NBR_EVENTS_MAX configures socket event tables' maximum number
-*                           of socket events/operations.
+*                   (b) Only datagram-type sockets are supported.
 *
-*                       (2) This value is used to declare the size of the socket events tables.  Note that
-*                           one additional table entry is added for a terminating NULL table entry at a
-*                           maximum table index 'NET_SOCK_CFG_SEL_NBR_EVENTS_MAX' (see Note #4a).
+*                   (c) For each message, the application configures 'VecPtr'/'VecNbr' &, for sockets NOT
+*                       connected to a remote address, 'AddrPtr'/'AddrLen'.  On return, 'DataLen' holds the
+*                       transmitted datagram length.
 *
-*               (5) Since datagram-type sockets typically never wait on transmit operations, no socket
-*                   event should wait on datagram-type socket transmit operations or transmit errors.
+*               (3) The network lock is acquired & the socket is validated once for the whole batch; each
+*                   datagram is then gathered directly from its data vector into a transmit buffer.
 *
-*                   See also 'NetSock_IsRdyTxDatagram()            Note #3'
-*                          & 'NetSock_SelDescHandlerErrDatagram()  Note #4'.
+*               (4) If an error occurs after at least one datagram has been transmitted, the number of
+*                   datagrams already transmitted is returned with NO error; the application SHOULD retry
+*                   the remaining messages.
 *********************************************************************************************************
 */
-#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
-NET_SOCK_RTN_CODE  NetSock_Sel (NET_SOCK_QTY       sock_nbr_max,
-                                NET_SOCK_DESC     *p_sock_desc_rd,
-                                NET_SOCK_DESC     *p_sock_desc_wr,
-                                NET_SOCK_DESC     *p_sock_desc_err,
-                                NET_SOCK_TIMEOUT  *p_timeout,
-                                NET_ERR           *p_err)
-{
-    NET_SOCK_SEL_OBJ   *p_sel_obj = DEF_NULL;
-    KAL_SEM_HANDLE      task_sem;
-    NET_SOCK           *p_sock;
-    NET_SOCK_ID         sock_id;
-    NET_SOCK_ID         cnt_sock_id;                            /* Used for modification purposes within for loop       */
-    NET_SOCK_QTY        sock_nbr_max_actual;
-    NET_SOCK_RTN_CODE   sock_nbr_rdy;
-    NET_SOCK_DESC       sock_desc_rtn_rd;
-    NET_SOCK_DESC       sock_desc_rtn_wr;
-    NET_SOCK_DESC       sock_desc_rtn_err;
-    CPU_BOOLEAN         sock_desc_used_rd;
-    CPU_BOOLEAN         sock_desc_used_wr;
-    CPU_BOOLEAN         sock_desc_used_err;
-    NET_SOCK_SEL_OBJ   *p_sel_obj_cur  = DEF_NULL;
-    NET_SOCK_SEL_OBJ   *p_sel_obj_next = DEF_NULL;
-    CPU_INT32U          timeout_sec;
-    CPU_INT32U          timeout_us;
-    CPU_INT32U          timeout_ms;
-    LIB_ERR             lib_err;
-    KAL_ERR             err_kal;
-    KAL_ERR             err_kal_del;
-    NET_ERR             err;
 
+NET_SOCK_RTN_CODE  NetSock_TxDataMsgs (NET_SOCK_ID          sock_id,
+                                       NET_SOCK_MSG        *p_msgs,
+                                       CPU_INT16U           msg_nbr,
+                                       NET_SOCK_API_FLAGS   flags,
+                                       NET_ERR             *p_err)
+{
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    NET_SOCK_FLAGS           flag_mask;
+    CPU_BOOLEAN              valid;
+#endif
+    NET_SOCK                *p_sock;
+    NET_SOCK_MSG            *p_msg;
+    NET_BUF_DATA_VEC_CURSOR  cursor;
+    NET_SOCK_API_FLAGS       flags_msg;
+    CPU_INT16U               data_len;
+    CPU_INT16U               msg_ix;
+    NET_SOCK_RTN_CODE        rtn_code;
+    NET_SOCK_RTN_CODE        msg_ctr;
 
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
                                                                 /* --------------- VALIDATE RTN ERR PTR --------------- */
-    if (p_err == DEF_NULL) {
+    if (p_err == (NET_ERR *)0) {
         CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
     }
-                                                                /* -------------- VALIDATE MAX SOCK DESC -------------- */
-#if (NET_SOCK_DESC_NBR_MIN_DESC > DEF_INT_16U_MIN_VAL)
-    if (sock_nbr_max < NET_SOCK_DESC_NBR_MIN_DESC) {            /* If max nbr sock desc < min, ...                      */
-       *p_err =  NET_SOCK_ERR_INVALID_DESC;                     /* ... rtn err (see Note #3d2A1).                       */
-        goto exit_lock_fault;
-    }
-#endif
-    if (sock_nbr_max > NET_SOCK_DESC_NBR_MAX_DESC) {            /* If max nbr sock desc > max (see Note #3b1B2a),       */
-       *p_err =  NET_SOCK_ERR_INVALID_DESC;                     /* ... rtn err (see Note #3d2A2).                       */
-        goto exit_lock_fault;
+                                                                /* ---------------- VALIDATE TX MSGS ------------------ */
+    if (p_msgs == (NET_SOCK_MSG *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (NET_SOCK_BSD_ERR_TX);
     }
-
-                                                                /* ----------------- VALIDATE TIMEOUT ----------------- */
-    if (p_timeout != DEF_NULL) {
-        if (p_timeout->timeout_sec < 0) {
-           *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
-            goto exit_lock_fault;
-        }
-        if (p_timeout->timeout_us  < 0) {
-           *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
-            goto exit_lock_fault;
-        }
+                                                                /* ---------------- VALIDATE TX FLAGS ----------------- */
+    flag_mask = NET_SOCK_FLAG_NONE       |
+                NET_SOCK_FLAG_TX_NO_BLOCK;
+    if (((NET_SOCK_FLAGS)flags & (NET_SOCK_FLAGS)~flag_mask) != NET_SOCK_FLAG_NONE) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidFlagsCtr);
+       *p_err =  NET_SOCK_ERR_INVALID_FLAG;
+        return (NET_SOCK_BSD_ERR_TX);
     }
 #endif
-
+    if ((msg_nbr < 1u) ||                                       /* See Note #2a.                                        */
+        (msg_nbr > NET_SOCK_CFG_MSG_NBR_MAX)) {
+       *p_err =  NET_SOCK_ERR_INVALID_ARG;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
 
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
-    Net_GlobalLockAcquire((void *)&NetSock_Sel, p_err);
+    Net_GlobalLockAcquire((void *)&NetSock_TxDataMsgs, p_err);
     if (*p_err != NET_ERR_NONE) {
-         goto exit_lock_fault;
+         return (NET_SOCK_BSD_ERR_TX);
     }
 
-#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit (see Note #2).            */
-       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
-        goto exit_err_sel;
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* ---------------- VALIDATE SOCK USED ---------------- */
+   (void)NetSock_IsUsed(sock_id, p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         msg_ctr = NET_SOCK_BSD_ERR_TX;
+         goto exit_release;
     }
 #endif
 
+    p_sock = &NetSock_Tbl[sock_id];
+    if (p_sock->SockType != NET_SOCK_TYPE_DATAGRAM) {           /* See Note #2b.                                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidSockTypeCtr);
+       *p_err   = NET_SOCK_ERR_INVALID_TYPE;
+        msg_ctr = NET_SOCK_BSD_ERR_TX;
+        goto exit_release;
+    }
 
 
-                                                                /* ---- VALIDATE / CHK / CFG SOCK DESC(S) FOR RDY ----- */
-    sock_nbr_max_actual = DEF_MIN(sock_nbr_max, NET_SOCK_DESC_NBR_MAX_DESC);
+                                                                /* ------------------- TX SOCK MSGS ------------------- */
+    flags_msg = flags;
+    DEF_BIT_SET(flags_msg, NET_SOCK_FLAG_DATA_VEC);
+    msg_ctr   = 0;
 
-    if (sock_nbr_max_actual > 0) {
-        if (p_sock_desc_rd != DEF_NULL) {
-            NET_SOCK_DESC_COPY(&sock_desc_rtn_rd,  p_sock_desc_rd);
-        } else {
-            NET_SOCK_DESC_INIT(&sock_desc_rtn_rd);
-        }
+    for (msg_ix = 0u; msg_ix < msg_nbr; msg_ix++) {
+        p_msg          = &p_msgs[msg_ix];
+        p_msg->DataLen =  0u;
+        p_msg->Flags   =  NET_SOCK_FLAG_NONE;
 
-        if (p_sock_desc_wr != DEF_NULL) {
-            NET_SOCK_DESC_COPY(&sock_desc_rtn_wr,  p_sock_desc_wr);
-        } else {
-            NET_SOCK_DESC_INIT(&sock_desc_rtn_wr);
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+        if (p_msg->AddrPtr != (NET_SOCK_ADDR *)0) {
+            valid = NetSock_IsValidAddrRemote(p_msg->AddrPtr, p_msg->AddrLen, p_sock, p_err);
+            if (valid != DEF_YES) {
+                break;
+            }
         }
+#endif
 
-        if (p_sock_desc_err != DEF_NULL) {
-            NET_SOCK_DESC_COPY(&sock_desc_rtn_err,  p_sock_desc_err);
-        } else {
-            NET_SOCK_DESC_INIT(&sock_desc_rtn_err);
+        data_len = NetSock_DataVecLenGet(p_msg->VecPtr, p_msg->VecNbr, p_err);
+        if (*p_err != NET_SOCK_ERR_NONE) {
+            break;
         }
 
-        sock_nbr_rdy = NetSock_SelDescHandler(sock_nbr_max_actual,
-                                             &sock_desc_rtn_rd,
-                                             &sock_desc_rtn_wr,
-                                             &sock_desc_rtn_err,
-                                              p_err);
-
-        switch (*p_err) {
-            case NET_INIT_ERR_NOT_COMPLETED:
-            case NET_SOCK_ERR_INVALID_TYPE:
-            case NET_SOCK_ERR_INVALID_SOCK:
-            case NET_SOCK_ERR_NOT_USED:
-                 Net_GlobalLockRelease();
-                 return (NET_SOCK_BSD_ERR_SEL);
-                 break;
+        cursor.VecPtr = p_msg->VecPtr;
+        cursor.VecNbr = p_msg->VecNbr;
+        cursor.VecIx  = 0u;
+
+        rtn_code = NetSock_TxDataHandlerDatagram((NET_SOCK_ID       )sock_id,
+                                                 (NET_SOCK         *)p_sock,
+                                                 (void             *)&cursor,
+                                                 (CPU_INT16U        )data_len,
+                                                 (NET_SOCK_API_FLAGS)flags_msg,
+                                                 (NET_SOCK_ADDR    *)p_msg->AddrPtr,
+                                                 (NET_ERR          *)p_err);
+        if (rtn_code < 1) {
+            break;
+        }
 
+        p_msg->DataLen = (CPU_INT16U)rtn_code;
+        msg_ctr++;
+    }
 
-            default:
-                 break;
-        }
+    if (msg_ctr > 0) {                                          /* See Note #4.                                         */
+       *p_err   = NET_SOCK_ERR_NONE;
     } else {
-        sock_nbr_rdy = 0;
+        msg_ctr = NET_SOCK_BSD_ERR_TX;
     }
 
-    if (sock_nbr_rdy != 0) {                                    /* If any     sock desc's rdy,                  ..      */
-                                                                /* .. rtn rdy sock desc's (see Note #3b2B1a1) & ..      */
-        if (p_sock_desc_rd != DEF_NULL) {
-            NET_SOCK_DESC_COPY(p_sock_desc_rd,  &sock_desc_rtn_rd );
-        }
 
-        if (p_sock_desc_wr != DEF_NULL) {
-            NET_SOCK_DESC_COPY(p_sock_desc_wr,  &sock_desc_rtn_wr );
-        }
+exit_release:
+    Net_GlobalLockRelease();
+
+    return (msg_ctr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetSock_TxDataRef()
+*
+* Description : (1) Transmit application data through a socket without copying it (zero-copy) :
+*
+*                   (a) Validate transmit reference
+*                   (b) Transmit socket data by reference                                   See Note #3
+*                   (c) Release  transmit reference's guard reference                       See Note #4
+*
+*                   See also 'NetSock_TxDataHandler()  Note #1'.
+*
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to transmit data.
+*
+*               p_data          Pointer to application data to transmit (see Note #2a).
+*
+*               data_len        Length of  application data to transmit (in octets).
+*
+*               flags           Flags to select transmit options; bit-field flags logically OR'd :
+*
+*                                   NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                   NET_SOCK_FLAG_TX_NO_BLOCK       Transmit socket data without blocking.
+*                                   NET_SOCK_FLAG_TX_MORE           More stream data follows; do NOT push.
+*
+*               p_addr_remote   Pointer to destination address buffer, if available; NULL for connected sockets.
+*
+*               addr_len        Length of  destination address buffer (in octets).
+*
+*               p_ref           Pointer to transmit reference with the application's completion callback
+*                                   (see Note #2b).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_ref' passed a NULL pointer.
+*                               NET_ERR_FAULT_NULL_FNCT             Transmit reference's callback is NULL.
+*
+*                                                                   ----- RETURNED BY NetSock_TxDataHandler() : -----
+*                               NET_SOCK_ERR_NONE                   Socket data successfully transmitted; check
+*                                                                       return value for number of data octets
+*                                                                       transmitted.
+*                               NET_SOCK_ERR_INVALID_OP             Invalid socket operation (see Note #5).
+*
+*                               See also 'NetSock_TxDataTo()  Return error codes'.
+*
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : -----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
+*
+* Return(s)   : Number of positive data octets transmitted, if NO error(s).
+*
+*               NET_SOCK_BSD_RTN_CODE_CONN_CLOSED,          if socket connection closed.
+*
+*               NET_SOCK_BSD_ERR_TX,                        otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (2) (a) The application MUST NOT modify or free the application data until the transmit
+*                       reference's callback is called.
+*
+*                   (b) The application configures the transmit reference's 'FnctPtr' & 'FnctArgPtr' before
+*                       each call; the transmit reference MUST remain valid until its callback is called.
+*
+*               (3) (a) The transport layer's transmit buffers reference the application data instead of
+*                       copying it.  Datagram data is released once transmitted; stream data is released
+*                       once acknowledged by the remote host.
+*
+*                   (b) If the network interface does NOT support gather transmits, the data is copied
+*                       just before device transmit (see 'NetIF_TxPkt()  Note #5').
+*
+*               (4) The transmit reference holds a guard reference for the duration of this call so that
+*                   its callback is called exactly once -- when the last transmit buffer releases the
+*                   application data, or before returning if no buffer references it -- even on error.
+*                   Only if the network lock can NOT be re-acquired is the callback NOT called.
+*
+*                   See also 'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES  Note #2'.
+*
+*               (5) Secure sockets do NOT support zero-copy transmits; see 'NetSock_TxDataHandler()
+*                   Note #7d'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+NET_SOCK_RTN_CODE  NetSock_TxDataRef (NET_SOCK_ID          sock_id,
+                                      void                *p_data,
+                                      CPU_INT16U           data_len,
+                                      NET_SOCK_API_FLAGS   flags,
+                                      NET_SOCK_ADDR       *p_addr_remote,
+                                      NET_SOCK_ADDR_LEN    addr_len,
+                                      NET_SOCK_TX_REF     *p_ref,
+                                      NET_ERR             *p_err)
+{
+    NET_BUF_DATA_EXT_CURSOR  cursor;
+    NET_SOCK_RTN_CODE        rtn_code;
+    NET_ERR                  err;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+#endif
+                                                                /* ---------------- VALIDATE TX REF ------------------- */
+    if (p_ref == (NET_SOCK_TX_REF *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+    if (p_ref->FnctPtr == (NET_BUF_DATA_EXT_FNCT)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err =  NET_ERR_FAULT_NULL_FNCT;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+
+    p_ref->RefCtr   = 1u;                                       /* Hold guard ref (see Note #4).                        */
+    cursor.DataPtr  = (CPU_INT08U *)p_data;
+    cursor.RefPtr   = p_ref;
+                                                                /* --------------- VALIDATE/TX APP DATA --------------- */
+    rtn_code = NetSock_TxDataHandler((NET_SOCK_ID       )sock_id,
+                                     (void             *)&cursor,
+                                     (CPU_INT16U        )data_len,
+                                     (NET_SOCK_API_FLAGS)flags,
+                                     (NET_SOCK_API_FLAGS)NET_SOCK_FLAG_DATA_EXT,
+                                     (NET_SOCK_ADDR    *)p_addr_remote,
+                                     (NET_SOCK_ADDR_LEN )addr_len,
+                                     (NET_ERR          *)p_err);
+
+                                                                /* ------------- RELEASE GUARD TX REF ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_TxDataRef, &err);
+    if (err != NET_ERR_NONE) {                                  /* If lock NOT acquired, ...                            */
+       *p_err = err;                                            /* ... guard ref can NOT be released.                   */
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+
+    NetBuf_DataExtRefRelease(p_ref);                            /* Call ref's callback if NO bufs ref data.             */
+
+    Net_GlobalLockRelease();
+
+    return (rtn_code);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_TxFile()
+*
+* Description : (1) Transmit file data through a stream-type socket without an application buffer :
+*
+*                   (a) Validate file & file read function
+*                   (b) Transmit file data read directly into transport transmit buffers    See Note #3
+*
+*                   See also 'NetSock_TxDataHandler()  Note #1'.
+*
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to transmit data.
+*
+*               p_file          Pointer to file to transmit, opened for reading & positioned at the first
+*                                   octet to transmit (see Note #2a).
+*
+*               rd_fnct         Pointer to file read function (see Note #2b).
+*
+*               len             Number of file octets to transmit.
+*
+*               flags           Flags to select transmit options; bit-field flags logically OR'd :
+*
+*                                   NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                   NET_SOCK_FLAG_TX_NO_BLOCK       Transmit socket data without blocking.
+*                                   NET_SOCK_FLAG_TX_MORE           More stream data follows; do NOT push.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_file' passed a NULL pointer.
+*                               NET_ERR_FAULT_NULL_FNCT             Argument 'rd_fnct' passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Invalid file data length.
+*                               NET_SOCK_ERR_TX_FILE_RD             File read failed (see Note #5).
+*
+*                                                                   ----- RETURNED BY NetSock_TxDataHandler() : -----
+*                               NET_SOCK_ERR_NONE                   File data successfully transmitted; check
+*                                                                       return value for number of file octets
+*                                                                       transmitted.
+*                               NET_SOCK_ERR_INVALID_TYPE           Invalid socket type (see Note #2c).
+*                               NET_SOCK_ERR_INVALID_OP             Invalid socket operation (see Note #2c).
+*
+*                               See also 'NetSock_TxData()  Return error codes'.
+*
+* Return(s)   : Number of positive file octets transmitted, if NO error(s).
+*
+*               NET_SOCK_BSD_RTN_CODE_CONN_CLOSED,          if socket connection closed.
+*
+*               NET_SOCK_BSD_ERR_TX,                        otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (2) (a) File data is read sequentially from the file's current position; on return, the file
+*                       is positioned after the last octet transmitted.
+*
+*                   (b) The file read function's signature matches NetFS_FileRd() so that network file
+*                       system files may be transmitted directly (see 'net_buf.h  NETWORK BUFFER FILE DATA
+*                       DATA TYPES').  It is called with the network lock held & MUST NOT call any network
+*                       protocol suite function.
+*
+*                   (c) Only non-secure stream-type sockets are supported.
+*
+*               (3) (a) File data is read directly into TCP segment buffers sized to the connection's
+*                       maximum segment size; NO intermediate application buffer is required.
+*
+*                   (b) Each transmit reads ahead as much file data as the connection's remaining transmit
+*                       window permits; 'len' is transmitted in successive transmits of at most 65535
+*                       octets each.
+*
+*               (4) (a) A blocking socket transmits ALL 'len' octets unless an error occurs.
+*
+*                   (b) A non-blocking socket (or a transmit with NET_SOCK_FLAG_TX_NO_BLOCK) returns as soon
+*                       as the transmit window or network buffers are exhausted; the application SHOULD call
+*                       NetSock_TxFile() again with the remaining length once the socket is writable.
+*
+*               (5) On a file read error, NET_SOCK_ERR_TX_FILE_RD is returned even if some file data was
+*                   transmitted.  The file position is then undefined & the application SHOULD abort the
+*                   transfer.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_TX_FILE_MODULE_EN
+NET_SOCK_RTN_CODE  NetSock_TxFile (NET_SOCK_ID                 sock_id,
+                                   void                       *p_file,
+                                   NET_BUF_DATA_FILE_RD_FNCT   rd_fnct,
+                                   CPU_INT32U                  len,
+                                   NET_SOCK_API_FLAGS          flags,
+                                   NET_ERR                    *p_err)
+{
+    NET_BUF_DATA_FILE_CURSOR  cursor;
+    CPU_INT32U                len_rem;
+    CPU_INT16U                len_tx;
+    NET_SOCK_RTN_CODE         len_tot;
+    NET_SOCK_RTN_CODE         rtn_code;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+#endif
+                                                                /* ------------------ VALIDATE FILE ------------------- */
+    if (p_file == (void *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+    if (rd_fnct == (NET_BUF_DATA_FILE_RD_FNCT)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err =  NET_ERR_FAULT_NULL_FNCT;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+    if ((len < 1u) ||
+        (len > (CPU_INT32U)NET_SOCK_DATA_SIZE_MAX)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.TxInvalidSizeCtr);
+       *p_err =  NET_SOCK_ERR_INVALID_DATA_SIZE;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+
+    cursor.FilePtr = p_file;
+    cursor.RdFnct  = rd_fnct;
+    cursor.RdErr   = DEF_NO;
+
+                                                                /* ------------------- TX FILE DATA ------------------- */
+    len_rem  = len;
+    len_tot  = 0;
+    rtn_code = NET_SOCK_BSD_ERR_TX;
+
+    while (len_rem > 0u) {                                      /* Tx file data in 16-bit len chunks (see Note #3b).    */
+        len_tx   = (CPU_INT16U)DEF_MIN(len_rem, DEF_INT_16U_MAX_VAL);
+        rtn_code =  NetSock_TxDataHandler((NET_SOCK_ID       )sock_id,
+                                          (void             *)&cursor,
+                                          (CPU_INT16U        )len_tx,
+                                          (NET_SOCK_API_FLAGS)flags,
+                                          (NET_SOCK_API_FLAGS)NET_SOCK_FLAG_DATA_FILE,
+                                          (NET_SOCK_ADDR    *)0,
+                                          (NET_SOCK_ADDR_LEN )0,
+                                          (NET_ERR          *)p_err);
+        if (rtn_code < 1) {
+            break;
+        }
+
+        len_tot += rtn_code;
+        len_rem -= (CPU_INT32U)rtn_code;
+
+        if (rtn_code < (NET_SOCK_RTN_CODE)len_tx) {             /* If tx win/bufs exhausted, rtn (see Note #4b).        */
+            break;
+        }
+    }
+
+    if (cursor.RdErr == DEF_YES) {                              /* See Note #5.                                         */
+       *p_err =  NET_SOCK_ERR_TX_FILE_RD;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+
+    if (len_tot > 0) {                                          /* Rtn file data tx'd, if any.                          */
+       *p_err =  NET_SOCK_ERR_NONE;
+        return (len_tot);
+    }
+
+    return (rtn_code);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Sel()
+*
+* Description : (1) Check multiple sockets for available resources &/or operations :
+*
+*                   (a) Acquire network lock
+*                   (b) Check sockets for available resources &/or operations :
+*                       (1) Validate socket descriptors' sockets
+*                       (2) Check    sockets for available resources &/or operations        See Note #3b2
+*                       (3) Prepare  sockets for wait on appropriate socket events
+*
+*                   (c) Handle timeout :                                                    See Note #3b3
+*                       (1) Prepare timeout
+*                       (2) Handle  time delay, if any
+*
+*                   (d) Wait on socket descriptor events :
+*                       (1) Demultiplex ready socket event(s) to appropriate socket descriptor(s)
+*
+*                   (e) Release network lock
+*
+*
+* Argument(s) : sock_nbr_max        Maximum number of socket descriptors/handle identifiers in the socket
+*                                       descriptor sets (see Note #3b1).
+*
+*               p_sock_desc_rd       Pointer to a set of socket descriptors/handle identifiers to :
+*
+*                                       (a) Check for available read  operation(s) [see Note #3b2A1].
+*
+*                                       (b) (1) Return the actual socket descriptors/handle identifiers
+*                                                   ready for available read  operation(s), if NO error(s)
+*                                                   [see Note #3b2B1a1];
+*                                           (2) Return the initial, non-modified set of socket descriptors/
+*                                                   handle identifiers, on any error(s) [see Note #3c2A];
+*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
+*                                                   if any timeout expires (see Note #3c2B).
+*
+*               p_sock_desc_wr       Pointer to a set of socket descriptors/handle identifiers to :
+*
+*                                       (a) Check for available write operation(s) [see Note #3b2A2].
+*
+*                                       (b) (1) Return the actual socket descriptors/handle identifiers
+*                                                   ready for available write operation(s), if NO error(s)
+*                                                   [see Note #3b2B1a1];
+*                                           (2) Return the initial, non-modified set of socket descriptors/
+*                                                   handle identifiers, on any error(s) [see Note #3c2A];
+*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
+*                                                   if any timeout expires (see Note #3c2B).
+*
+*               p_sock_desc_err      Pointer to a set of socket descriptors/handle identifiers to :
+*
+*                                       (a) Check for any error(s) &/or exception(s) [see Note #3b2A3].
+*
+*                                       (b) (1) Return the actual socket descriptors/handle identifiers
+*                                                   flagged with any error(s) &/or exception(s), if NO
+*                                                   non-descriptor-related error(s) [see Note #3b2B1a1];
+*                                           (2) Return the initial, non-modified set of socket descriptors/
+*                                                   handle identifiers, on any error(s) [see Note #3c2A];
+*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
+*                                                   if any timeout expires (see Note #3c2B).
+*
+*               p_timeout           Pointer to a timeout (see Note #3b3).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket descriptors successfully checked for
+*                                                                   available resources &/or operations;
+*                                                                   check return value for the number of
+*                                                                   ready socket descriptors with available
+*                                                                   resources &/or operations.
+*
+*                               NET_SOCK_ERR_TIMEOUT            Socket descriptors NOT ready within timeout
+*                                                                   (see Note #3b3A1a2).
+*
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_SOCK_ERR_INVALID_DESC       Invalid socket descriptor/number.
+*                               NET_SOCK_ERR_INVALID_TIMEOUT    Invalid timeout.
+*
+*                                                               - RETURNED BY NetSock_SelDescHandlerRd() : --
+*                                                               - RETURNED BY NetSock_SelDescHandlerWr() : --
+*                                                               - RETURNED BY NetSock_SelDescHandlerErr() : -
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_INVALID_TYPE       Invalid socket type.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : Number of socket descriptors with available resources &/or operations, if any     (see Note #3c1A1).
+*
+*               NET_SOCK_BSD_RTN_CODE_TIMEOUT,                                         on timeout (see Note #3c1B).
+*
+*               NET_SOCK_BSD_ERR_SEL,                                                  otherwise  (see Note #3c1A2a).
+*
+* Caller(s)   : select().
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (2) NetSock_Sel() blocked until network initialization completes.
+*
+*               (3) (a) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*
+*                       (1) (A) "select() ... shall support" the following file descriptor types :
+*
+*                               (1) "regular files,"                        ...
+*                               (2) "terminal and pseudo-terminal devices," ...
+*                               (3) "STREAMS-based files,"                  ...
+*                               (4) "FIFOs,"                                ...
+*                               (5) "pipes,"                                ...
+*                               (6) "sockets."
+*
+*                           (B) "The behavior of ... select() on ... other types of ... file descriptors
+*                                ... is unspecified."
+*
+*                       (2) Network Socket Layer supports BSD 4.x select() functionality with the following
+*                           restrictions/constraints :
+*
+*                           (A) ONLY supports the following file descriptor types :
+*                               (1) Sockets
+*
+*
+*                   (b) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*
+*                       (1) (A) "The 'nfds' argument ('sock_nbr_max') specifies the range of descriptors to be
+*                                tested.  The first 'nfds' descriptors shall be checked in each set; that is,
+*                                the [following] descriptors ... in the descriptor sets shall be examined" :
+*
+*                               (1) "from zero" ...
+*                               (2) "through nfds-1."
+*
+*                           (B) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                               6th Printing, Section 6.3, Page 163 states that :
+*
+*                               (1) ... since "descriptors start at 0" ...
+*
+*                               (2) "the ['nfds'] argument" specifies :
+*                                   (a) "the number of descriptors," ...
+*                                   (b) "not the largest value."
+*
+*                       (2) "The select() function shall ... examine the file descriptor sets whose addresses
+*                            are passed in the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'), and
+*                            'errorfds' ('p_sock_desc_err') parameters to see whether some of their descriptors
+*                            are ready for reading, are ready for writing, or have an exceptional condition
+*                            pending, respectively."
+*
+*                           (A) (1) (a) "If the 'readfds'  argument ('p_sock_desc_rd')  is not a null pointer,
+*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
+*                                        input specifies the file descriptors to be checked for being ready
+*                                        to read,  and on output indicates which file descriptors are ready
+*                                        to read."
+*
+*                                   (b) "A descriptor shall be considered ready for reading when a call to
+*                                        an input function ... would not block, whether or not the function
+*                                        would transfer data successfully.  (The function might return data,
+*                                        an end-of-file indication, or an error other than one indicating
+*                                        that it is blocked, and in each of these cases the descriptor shall
+*                                        be considered ready for reading.)" :
+*
+*                                       (1) "If the socket is currently listening, then it shall be marked
+*                                            as readable if an incoming connection request has been received,
+*                                            and a call to the accept() function shall complete without
+*                                            blocking."
+*
+*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                                       6th Printing, Section 6.3, Pages 164-165 states that "a socket is ready
+*                                       for reading if any of the following ... conditions is true" :
+*
+*                                       (1) "A read operation on the socket will not block and will return a
+*                                            value greater than 0 (i.e., the data that is ready to be read)."
+*
+*                                       (2) "The read half of the connection is closed (i.e., a TCP connection
+*                                            that has received a FIN).  A read operation ... will not block and
+*                                            will return 0 (i.e., EOF)."
+*
+*                                       (3) "The socket is a listening socket and the number of completed
+*                                            connections is nonzero.  An accept() on the listening socket
+*                                            will ... not block."
+*
+*                                       (4) "A socket error is pending.  A read operation on the socket will
+*                                            not block and will return an error (-1) with 'errno' set to the
+*                                            specific error condition."
+*
+*                                           (A) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1,
+*                                               3rd Edition, 6th Printing, Section 6.3, Page 165 states "that
+*                                               when an error occurs on a socket, it is [also] marked as both
+*                                               readable and writeable by select()".
+*
+*                                               See also Notes #3b2A2c4A & #3b2A3d.
+*
+*                               (2) (a) "If the 'writefds' argument ('p_sock_desc_wr')  is not a null pointer,
+*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
+*                                        input specifies the file descriptors to be checked for being ready
+*                                        to write, and on output indicates which file descriptors are ready
+*                                        to write."
+*
+*                                   (b) "A descriptor shall be considered ready for writing when a call to
+*                                        an output function ... would not block, whether or not the function
+*                                        would transfer data successfully" :
+*
+*                                       (1) "If a non-blocking call to the connect() function has been made
+*                                            for a socket, and the connection attempt has either succeeded
+*                                            or failed leaving a pending error, the socket shall be marked
+*                                            as writable."
+*
+*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                                       6th Printing, Section 6.3, Page 165 states that "a socket is ready for
+*                                       writing if any of the following ... conditions is true" :
+*
+*                                       (1) "A write operation will not block and will return a positive value
+*                                            (e.g., the number of bytes accepted by the transport layer)."
+*
+*                                       (2) "The write half of the connection is closed."
+*
+*                                       (3) "A socket using a non-blocking connect() has completed the
+*                                            connection, or the connect() has failed."
+*
+*                                       (4) "A socket error is pending.  A write operation on the socket will
+*                                            not block and will return an error (-1) with 'errno' set to the
+*                                            specific error condition."
+*
+*                                           (A) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1,
+*                                               3rd Edition, 6th Printing, Section 6.3, Page 165 states "that
+*                                               when an error occurs on a socket, it is [also] marked as both
+*                                               readable and writeable by select()".
+*
+*                                               See also Notes #3b2A1c4A & #3b2A3d.
+*
+*                               (3) (a) "If the 'errorfds' argument ('p_sock_desc_err') is not a null pointer,
+*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
+*                                        input specifies the file descriptors to be checked for error
+*                                        conditions pending, and on output indicates which file descriptors
+*                                        have error conditions pending."
+*
+*                                   (b) "A file descriptor ... shall be considered to have an exceptional
+*                                        condition pending ... as noted below" :
+*
+*                                       (1) (A) "A socket ... receive operation ... [that] would return
+*                                                out-of-band data without blocking."
+*                                           (B) "A socket ... [with] out-of-band data ... present in the
+*                                                receive queue."
+*
+*                                           Out-of-band data NOT supported (see 'net_tcp.h  Note #1b').
+*
+*                                       (2) "If a socket has a pending error."
+*
+*                                       (3) "Other circumstances under which a socket may be considered to
+*                                            have an exceptional condition pending are protocol-specific
+*                                            and implementation-defined."
+*
+*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                                       6th Printing, Section 6.3, Page 165 states that "a socket has an
+*                                       exception condition pending if ... any of the following ... conditions
+*                                       is true" :
+*
+*                                       (1) (A) "Out-of-band data for the socket" is currently available; ...
+*                                           (B) "Or the socket is still at the out-of-band mark."
+*
+*                                           Out-of-band data NOT supported (see 'net_tcp.h  Note #1b').
+*
+*                                   (d) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                                       6th Printing, Section 6.3, Page 165 states "that when an error occurs on
+*                                       a socket, it is [also] marked as both readable and writeable by select()".
+*
+*                                       See also Notes #3b2A1c4A & #3b2A2c4A.
+*
+*                           (B) (1) (a) "Upon successful completion, ... select() ... shall" :
+*
+*                                       (1) "modify the objects pointed to by the 'readfds' ('p_sock_desc_rd'),
+*                                            'writefds' ('p_sock_desc_wr'), and 'errorfds' ('p_sock_desc_err')
+*                                            arguments to indicate which file descriptors are ready for
+*                                            reading, ready for writing, or have an error condition pending,
+*                                            respectively," ...
+*
+*                                       (2) "and shall return the total number of ready descriptors in all
+*                                            the output sets."
+*
+*                                            See also Note #3c1A1.
+*
+*                                   (b) (1) "For each file descriptor less than nfds ('sock_nbr_max'), the
+*                                            corresponding bit shall be set on successful completion" :
+*
+*                                           (A) "if it was set on input" ...
+*                                           (B) "and the associated condition is true for that file descriptor."
+*
+*                                       (2) Conversely, "for each file descriptor ... the corresponding bit
+*                                           shall be ... [clear] ... on ... completion" :
+*
+*                                           (A) If it was clear on input;                                         ...
+*                                           (B) If the associated condition is NOT true for that file descriptor; ...
+*                                           (C) Or it was set on input, but any timeout occurs (see Note #3c2B).
+*
+*                               (2) select() can NOT absolutely guarantee that descriptors returned as ready
+*                                   will still be ready during subsequent operations since any higher priority
+*                                   tasks or processes may asynchronously consume the descriptors' operations
+*                                   &/or resources.  This can occur since select() functionality & subsequent
+*                                   operations are NOT atomic operations protected by network, file system,
+*                                   or operating system mechanisms.
+*
+*                                   However, as long as no higher priority tasks or processes access any of
+*                                   the same descriptors, then a single task or process can assume that all
+*                                   descriptors returned as ready by select() will still be ready during
+*                                   subsequent operations.
+*
+*                       (3) (A) "The 'timeout' parameter ('ptimeout') controls how long ... select() ... shall
+*                                take before timing out."
+*
+*                               (1) (a) "If the 'timeout' parameter ('ptimeout') is not a null pointer, it
+*                                        specifies a maximum interval to wait for the selection to complete."
+*
+*                                       (1) "If none of the selected descriptors are ready for the requested
+*                                            operation, ... select() ... shall block until at least one of the
+*                                            requested operations becomes ready ... or ... until the timeout
+*                                            occurs."
+*
+*                                       (2) "If the specified time interval expires without any requested
+*                                            operation becoming ready, the function shall return."
+*
+*                                       (3) "To effect a poll, the 'timeout' parameter ('ptimeout') should not be
+*                                            a null pointer, and should point to a zero-valued timespec structure
+*                                            ('NET_SOCK_TIMEOUT')."
+*
+*                                   (b) (1) (A) "If the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'),
+*                                                and 'errorfds' ('p_sock_desc_err') arguments are"                ...
+*                                               (1) "all null pointers"                                          ...
+*                                               (2) [or all null-valued (i.e. no file descriptors set)]          ...
+*                                           (B) "and the 'timeout' argument ('ptimeout') is not a null pointer," ...
+*
+*                                       (2) ... then "select() ... shall block for the time specified".
+*
+*                               (2) "If the 'timeout' parameter ('ptimeout') is a null pointer, then the call to
+*                                    ... select() shall block indefinitely until at least one descriptor meets the
+*                                    specified criteria."
+*
+*                                   (a) (1) Although IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION'
+*                                           states that select() may "block indefinitely until ... one of the
+*                                           requested operations becomes ready ... or until interrupted by a signal",
+*                                           it does NOT explicity specify how to handle the case where the descriptor
+*                                           arguments & the timeout parameter argument are all NULL pointers.
+*
+*                                           Therefore, it seems reasonable that select() should "block indefinitely
+*                                           ... until interrupted by a signal" if the descriptor arguments & the
+*                                           timeout parameter argument are all NULL pointers.
+*
+*                                       (2) However, since inter-process signals are NOT currently supported, it
+*                                           does NOT seem reasonable to block a task or process indefinitely (i.e.
+*                                           forever) if the descriptor arguments & the timeout parameter argument
+*                                           are all NULL pointers.  Instead, an 'invalid timeout interval' error
+*                                           should be returned.
+*
+*                                           See also Note #3d2B.
+*
+*                           (B) (1) "For the select() function, the timeout period is given ... in an argument
+*                                   ('ptimeout') of type struct 'timeval' ('NET_SOCK_TIMEOUT')" ... :
+*
+*                                   (a) "in seconds" ...
+*                                   (b) "and microseconds."
+*
+*                               (2) (a) (1) "Implementations may place limitations on the maximum timeout interval
+*                                            supported" :
+*
+*                                           (A) "All implementations shall support a maximum timeout interval of
+*                                                at least 31 days."
+*
+*                                               (1) However, since maximum timeout interval values are dependent
+*                                                   on the specific OS implementation; a maximum timeout interval
+*                                                   can NOT be guaranteed.
+*
+*                                           (B) "If the 'timeout' argument ('ptimeout') specifies a timeout interval
+*                                                greater than the implementation-defined maximum value, the maximum
+*                                                value shall be used as the actual timeout value."
+*
+*                                       (2) "Implementations may also place limitations on the granularity of
+*                                            timeout intervals" :
+*
+*                                           (A) "If the requested 'timeout' interval requires a finer granularity
+*                                                than the implementation supports, the actual timeout interval
+*                                                shall be rounded up to the next supported value."
+*
+*                                   (b) Operating systems may have different minimum/maximum ranges & resolutions
+*                                       for timeouts while pending or waiting on an operating system resource to
+*                                       become available (see Note #3b3A1a) versus time delays for suspending a
+*                                       task or process that is NOT pending or waiting for an operating system
+*                                       resource (see Note #3b3A1b).
+*
+*                   (c) (1) (A) IEEE Std 1003.1, 2004 Edition, Section 'select() : RETURN VALUE' states that :
+*
+*                               (1) "Upon successful completion, ... select() ... shall return the total
+*                                    number of bits set in the bit masks."
+*
+*                               (2) (a) "Otherwise, -1 shall be returned," ...
+*                                   (b) "and 'errno' shall be set to indicate the error."
+*                                       'errno' NOT currently supported (see 'net_bsd.h  Note #1b').
+*
+*                           (B) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                               6th Printing, Section 6.3, Page 161 states that BSD select() function
+*                               "returns ... 0 on timeout".
+*
+*                       (2) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*
+*                           (A) "On failure, the objects pointed to by the 'readfds' ('p_sock_desc_rd'),
+*                                'writefds' ('p_sock_desc_wr'), and 'errorfds' ('p_sock_desc_err') arguments
+*                                shall not be modified."
+*
+*                               (1) Since 'p_sock_desc_rd', 'p_sock_desc_wr', & 'p_sock_desc_err' arguments
+*                                   are both input & output arguments; their input values, prior to use,
+*                                   MUST be copied to return their initial input values PRIOR to all other
+*                                   validation or function handling in case of any error(s).
+*
+*                           (B) "If the 'timeout' interval expires without the specified condition being
+*                                true for any of the specified file descriptors, the objects pointed to
+*                                by the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'), and
+*                                'errorfds' ('p_sock_desc_err') arguments shall have all bits set to 0."
+*
+*                   (d) IEEE Std 1003.1, 2004 Edition, Section 'select() : ERRORS' states that "under the
+*                       following conditions, ... select() shall fail and set 'errno' to" :
+*
+*                       (1) "[EBADF] - One or more of the file descriptor sets specified a file descriptor
+*                            that is not a valid open file descriptor."
+*
+*                       (2) "[EINVAL]" -
+*
+*                           (A) "The 'nfds' argument ('sock_nbr_max') is" :
+*                               (1) "less than 0 or" ...
+*                               (2) "greater than FD_SETSIZE."
+*
+*                               See also Note #3b1.
+*
+*                           (B) "An invalid timeout interval was specified."
+*
+*                               See also Note #3b3.
+*
+*                           'errno' NOT currently supported (see 'net_bsd.h  Note #1b').
+*
+*               (4) A socket events table lists requested socket or connection ID numbers/handle identifiers
+*                   & their respective socket event operations.
+*
+*                   (a) Socket event tables are terminated with NULL table entry values.
+*
+*                   (b) (1) NET_SOCK_CFG_SEL_NBR_EVENTS_MAX configures socket event tables' maximum number
+*                           of socket events/operations.
+*
+*                       (2) This value is used to declare the size of the socket events tables.  Note that
+*                           one additional table entry is added for a terminating NULL table entry at a
+*                           maximum table index 'NET_SOCK_CFG_SEL_NBR_EVENTS_MAX' (see Note #4a).
+*
+*               (5) Since datagram-type sockets typically never wait on transmit operations, no socket
+*                   event should wait on datagram-type socket transmit operations or transmit errors.
+*
+*                   See also 'NetSock_IsRdyTxDatagram()            Note #3'
+*                          & 'NetSock_SelDescHandlerErrDatagram()  Note #4'.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+NET_SOCK_RTN_CODE  NetSock_Sel (NET_SOCK_QTY       sock_nbr_max,
+                                NET_SOCK_DESC     *p_sock_desc_rd,
+                                NET_SOCK_DESC     *p_sock_desc_wr,
+                                NET_SOCK_DESC     *p_sock_desc_err,
+                                NET_SOCK_TIMEOUT  *p_timeout,
+                                NET_ERR           *p_err)
+{
+    NET_SOCK_SEL_OBJ   *p_sel_obj = DEF_NULL;
+    KAL_SEM_HANDLE      task_sem;
+    NET_SOCK           *p_sock;
+    NET_SOCK_ID         sock_id;
+    NET_SOCK_ID         cnt_sock_id;                            /* Used for modification purposes within for loop       */
+    NET_SOCK_QTY        sock_nbr_max_actual;
+    NET_SOCK_RTN_CODE   sock_nbr_rdy;
+    NET_SOCK_DESC       sock_desc_rtn_rd;
+    NET_SOCK_DESC       sock_desc_rtn_wr;
+    NET_SOCK_DESC       sock_desc_rtn_err;
+    CPU_BOOLEAN         sock_desc_used_rd;
+    CPU_BOOLEAN         sock_desc_used_wr;
+    CPU_BOOLEAN         sock_desc_used_err;
+    NET_SOCK_SEL_OBJ   *p_sel_obj_cur  = DEF_NULL;
+    NET_SOCK_SEL_OBJ   *p_sel_obj_next = DEF_NULL;
+    CPU_INT32U          timeout_sec;
+    CPU_INT32U          timeout_us;
+    CPU_INT32U          timeout_ms;
+    LIB_ERR             lib_err;
+    KAL_ERR             err_kal;
+    KAL_ERR             err_kal_del;
+    NET_ERR             err;
+
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+                                                                /* -------------- VALIDATE MAX SOCK DESC -------------- */
+#if (NET_SOCK_DESC_NBR_MIN_DESC > DEF_INT_16U_MIN_VAL)
+    if (sock_nbr_max < NET_SOCK_DESC_NBR_MIN_DESC) {            /* If max nbr sock desc < min, ...                      */
+       *p_err =  NET_SOCK_ERR_INVALID_DESC;                     /* ... rtn err (see Note #3d2A1).                       */
+        goto exit_lock_fault;
+    }
+#endif
+    if (sock_nbr_max > NET_SOCK_DESC_NBR_MAX_DESC) {            /* If max nbr sock desc > max (see Note #3b1B2a),       */
+       *p_err =  NET_SOCK_ERR_INVALID_DESC;                     /* ... rtn err (see Note #3d2A2).                       */
+        goto exit_lock_fault;
+    }
+
+                                                                /* ----------------- VALIDATE TIMEOUT ----------------- */
+    if (p_timeout != DEF_NULL) {
+        if (p_timeout->timeout_sec < 0) {
+           *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
+            goto exit_lock_fault;
+        }
+        if (p_timeout->timeout_us  < 0) {
+           *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
+            goto exit_lock_fault;
+        }
+    }
+#endif
+
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_Sel, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit (see Note #2).            */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        goto exit_err_sel;
+    }
+#endif
+
+
+
+                                                                /* ---- VALIDATE / CHK / CFG SOCK DESC(S) FOR RDY ----- */
+    sock_nbr_max_actual = DEF_MIN(sock_nbr_max, NET_SOCK_DESC_NBR_MAX_DESC);
+
+    if (sock_nbr_max_actual > 0) {
+        if (p_sock_desc_rd != DEF_NULL) {
+            NET_SOCK_DESC_COPY(&sock_desc_rtn_rd,  p_sock_desc_rd);
+        } else {
+            NET_SOCK_DESC_INIT(&sock_desc_rtn_rd);
+        }
+
+        if (p_sock_desc_wr != DEF_NULL) {
+            NET_SOCK_DESC_COPY(&sock_desc_rtn_wr,  p_sock_desc_wr);
+        } else {
+            NET_SOCK_DESC_INIT(&sock_desc_rtn_wr);
+        }
+
+        if (p_sock_desc_err != DEF_NULL) {
+            NET_SOCK_DESC_COPY(&sock_desc_rtn_err,  p_sock_desc_err);
+        } else {
+            NET_SOCK_DESC_INIT(&sock_desc_rtn_err);
+        }
+
+        sock_nbr_rdy = NetSock_SelDescHandler(sock_nbr_max_actual,
+                                             &sock_desc_rtn_rd,
+                                             &sock_desc_rtn_wr,
+                                             &sock_desc_rtn_err,
+                                              p_err);
+
+        switch (*p_err) {
+            case NET_INIT_ERR_NOT_COMPLETED:
+            case NET_SOCK_ERR_INVALID_TYPE:
+            case NET_SOCK_ERR_INVALID_SOCK:
+            case NET_SOCK_ERR_NOT_USED:
+                 Net_GlobalLockRelease();
+                 return (NET_SOCK_BSD_ERR_SEL);
+                 break;
+
+
+            default:
+                 break;
+        }
+    } else {
+        sock_nbr_rdy = 0;
+    }
+
+    if (sock_nbr_rdy != 0) {                                    /* If any     sock desc's rdy,                  ..      */
+                                                                /* .. rtn rdy sock desc's (see Note #3b2B1a1) & ..      */
+        if (p_sock_desc_rd != DEF_NULL) {
+            NET_SOCK_DESC_COPY(p_sock_desc_rd,  &sock_desc_rtn_rd );
+        }
+
+        if (p_sock_desc_wr != DEF_NULL) {
+            NET_SOCK_DESC_COPY(p_sock_desc_wr,  &sock_desc_rtn_wr );
+        }
+
+        if (p_sock_desc_err != DEF_NULL) {
+            NET_SOCK_DESC_COPY(p_sock_desc_err, &sock_desc_rtn_err);
+        }
+
+       *p_err =   NET_SOCK_ERR_NONE;
+        goto exit_release;
+    }
+
+
+                                                                /* ---------- CFG TIMEOUT / HANDLE TIME DLY ----------- */
+    if (p_timeout != DEF_NULL) {                                /* If avail, cfg timeout vals    (see Note #3b3A1),     */
+        timeout_sec = (CPU_INT32U)p_timeout->timeout_sec;
+        timeout_us  = (CPU_INT32U)p_timeout->timeout_us;
+    } else {                                                    /* .. else  cfg timeout to block (see Note #3b3A2).     */
+        timeout_sec = NET_TMR_TIME_INFINITE;
+        timeout_us  = NET_TMR_TIME_INFINITE;
+    }
+
+
+    if ((timeout_sec == 0) && (timeout_us == 0)) {              /* If timeout = 0, handle as non-blocking poll ..       */
+                                                                /* .. timeout (see Note #3b3A1a3).                      */
+
+                                                                /* Zero-clr rtn sock desc's (see Note #3c2B).           */
+                                                                /* Clr because no sock is ready at this point.          */
+        if (p_sock_desc_rd != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_rd );
+        }
+
+        if (p_sock_desc_wr != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_wr );
+        }
 
         if (p_sock_desc_err != DEF_NULL) {
-            NET_SOCK_DESC_COPY(p_sock_desc_err, &sock_desc_rtn_err);
+            NET_SOCK_DESC_INIT(p_sock_desc_err);
+        }
+
+       *p_err = NET_SOCK_ERR_TIMEOUT;
+        goto exit_err_timeout;
+    }
+
+
+    if (sock_nbr_max < 1) {                                     /* If NO sock events cfg'd to wait on ...               */
+
+        Net_GlobalLockRelease();
+        if (p_timeout == DEF_NULL) {                            /* ... & NO timeout req'd,            ...               */
+           *p_err = NET_SOCK_ERR_INVALID_TIMEOUT;               /* ... rtn err (see Note #3b3A2a2).                     */
+            sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
+            goto exit;
+        }
+
+        Net_TimeDly(timeout_sec, timeout_us, &err);             /* Else dly for timeout (see Note #3b3A1b2).            */
+        switch (err) {
+            case NET_ERR_NONE:
+            case NET_ERR_TIME_DLY_MAX:
+                 break;
+
+            case NET_ERR_TIME_DLY_FAULT:
+            case NET_ERR_INVALID_TIME:
+            default:
+                *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
+                 sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
+                 goto exit;
+        }
+                                                                /* Zero-clr rtn sock desc's (see Note #3c2B).           */
+        if (p_sock_desc_rd != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_rd );
+        }
+
+        if (p_sock_desc_wr != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_wr );
+        }
+
+        if (p_sock_desc_err != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_err);
         }
 
-       *p_err =   NET_SOCK_ERR_NONE;
-        goto exit_release;
+       *p_err = NET_SOCK_ERR_TIMEOUT;
+        sock_nbr_rdy = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
+        goto exit;
+    }
+
+
+
+    task_sem  =  KAL_SemCreate((const  CPU_CHAR  *)"Net Sock Sel Task",
+                                                    DEF_NULL,
+                                                   &err_kal);
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_MEM_ALLOC:
+             *p_err = NET_ERR_FAULT_MEM_ALLOC;
+              goto exit_err_sel;
+
+        case KAL_ERR_ISR:
+        case KAL_ERR_INVALID_ARG:
+        case KAL_ERR_CREATE:
+        default:
+           *p_err = NET_SOCK_ERR_SEL_SIGNAL_FAULT;
+            goto exit_err_sel;
+
+    }
+
+
+    for (sock_id = 0; sock_id < sock_nbr_max; sock_id++) {
+         p_sock = &NetSock_Tbl[sock_id];
+                                                                /* Null argument checks - Set for Read/Write or Error   */
+         if (p_sock_desc_rd != DEF_NULL) {
+             sock_desc_used_rd = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_rd);
+         } else {
+             sock_desc_used_rd = DEF_NO;
+         }
+
+         if (p_sock_desc_wr != DEF_NULL) {
+             sock_desc_used_wr = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_wr);
+         } else {
+             sock_desc_used_wr = DEF_NO;
+         }
+
+         if (p_sock_desc_err != DEF_NULL) {
+             sock_desc_used_err = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_err);
+         } else {
+             sock_desc_used_err = DEF_NO;
+         }
+
+
+         if ((sock_desc_used_rd  == DEF_YES) ||
+             (sock_desc_used_wr  == DEF_YES) ||
+             (sock_desc_used_err == DEF_YES)) {
+
+             p_sel_obj = (NET_SOCK_SEL_OBJ *)Mem_DynPoolBlkGet(&NetSock_SelObjPool, &lib_err);
+             if (p_sel_obj == DEF_NULL) {
+                cnt_sock_id = sock_id - 1;
+
+                while (cnt_sock_id >= 0) {
+                    NET_SOCK_SEL_OBJ  *p_sel_obj_to_free;
+
+
+                    sock_desc_used_rd  = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_rd);
+                    sock_desc_used_wr  = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_wr);
+                    sock_desc_used_err = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_err);
+
+                    if ((sock_desc_used_rd  == DEF_YES) ||
+                        (sock_desc_used_wr  == DEF_YES) ||
+                        (sock_desc_used_err == DEF_YES)) {
+
+                        p_sock                = &NetSock_Tbl[cnt_sock_id];
+                        p_sel_obj_to_free     =  p_sock->SelObjTailPtr;
+                        p_sock->SelObjTailPtr =  p_sel_obj_to_free->ObjPrevPtr;
+
+                        Mem_DynPoolBlkFree(&NetSock_SelObjPool, p_sel_obj_to_free, &lib_err);
+                    }
+
+                    cnt_sock_id--;
+                }
+
+                 KAL_SemDel(task_sem, &err_kal_del);
+                *p_err = NET_ERR_FAULT_MEM_ALLOC;
+                 goto exit_err_sel;
+             }
+
+             p_sel_obj->SockSelPendingFlags = NET_SOCK_SEL_EVENT_FLAG_NONE;
+
+             if (sock_desc_used_rd == DEF_YES) {
+                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_RD;
+             }
+
+             if (sock_desc_used_wr == DEF_YES) {
+                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_WR;
+             }
+
+             if (sock_desc_used_err == DEF_YES) {
+                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_ERR;
+             }
+
+             p_sel_obj->SockSelTaskSignalObj = task_sem;
+             p_sel_obj->ObjPrevPtr           = p_sock->SelObjTailPtr;
+             p_sock->SelObjTailPtr           = p_sel_obj;
+         }
+    }
+
+
+    timeout_ms = NetUtil_TimeSec_uS_To_ms(timeout_sec, timeout_us);
+    if (timeout_ms == NET_TMR_TIME_INFINITE) {
+        timeout_ms =  KAL_TIMEOUT_INFINITE;
+    }
+
+                                                                /* ------ WAIT ON MULTIPLE SOCK DESC'S / EVENTS ------- */
+    Net_GlobalLockRelease();
+
+    KAL_SemPend(task_sem, KAL_OPT_PEND_NONE, timeout_ms, &err_kal);
+    Net_GlobalLockAcquire((void *)&NetSock_Sel, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        *p_err  = err;                                          /* Rtn err from Net_GlobalLockAcquire().                */
+         goto exit_lock_fault;
+    }
+
+
+    for (sock_id = 0; sock_id < sock_nbr_max; sock_id++) {
+         p_sock = &NetSock_Tbl[sock_id];
+
+         if (p_sock->SelObjTailPtr != DEF_NULL) {               /* Remove p_sel_obj from Socket Select objects list     */
+
+             p_sel_obj_cur  = p_sock->SelObjTailPtr;
+             p_sel_obj_next = DEF_NULL;
+
+             while (p_sel_obj_cur != DEF_NULL) {
+                 NET_SOCK_SEL_OBJ  *p_sel_obj_prev = p_sel_obj_cur->ObjPrevPtr;
+
+
+                 if (p_sel_obj_cur->SockSelTaskSignalObj.SemObjPtr == task_sem.SemObjPtr) {
+                     NET_SOCK_SEL_OBJ   *p_sel_obj_to_free  = DEF_NULL;
+
+
+                     if (p_sock->SelObjTailPtr == p_sel_obj_cur) {
+                         p_sock->SelObjTailPtr  = p_sel_obj_prev;
+
+                     } else if (p_sel_obj_next != DEF_NULL) {
+                         p_sel_obj_next->ObjPrevPtr = p_sel_obj_prev;
+                     } else {
+                                                                /* Empty Else Statement                                 */
+                     }
+
+                     p_sel_obj_to_free = p_sel_obj_cur;
+                     p_sel_obj_cur  = p_sel_obj_cur->ObjPrevPtr;
+
+                     Mem_DynPoolBlkFree(&NetSock_SelObjPool, p_sel_obj_to_free, &lib_err);
+
+                 } else {
+                     p_sel_obj_next = p_sel_obj_cur;
+                     p_sel_obj_cur  = p_sel_obj_cur->ObjPrevPtr;
+                 }
+             }
+         }
+    }
+
+
+    KAL_SemDel(task_sem, &err_kal_del);
+   (void)&err_kal_del;
+
+
+
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_TIMEOUT:
+             if (p_sock_desc_rd != DEF_NULL) {
+                 NET_SOCK_DESC_INIT(p_sock_desc_rd );
+             }
+
+             if (p_sock_desc_wr != DEF_NULL) {
+                 NET_SOCK_DESC_INIT(p_sock_desc_wr );
+             }
+
+             if (p_sock_desc_err != DEF_NULL) {
+                 NET_SOCK_DESC_INIT(p_sock_desc_err);
+             }
+            *p_err = NET_SOCK_ERR_TIMEOUT;
+             goto exit_err_timeout;
+
+        case KAL_ERR_WOULD_BLOCK:
+        case KAL_ERR_ISR:
+        case KAL_ERR_ABORT:
+        case KAL_ERR_OS:
+        default:
+             goto exit_err_sel;
     }
 
 
-                                                                /* ---------- CFG TIMEOUT / HANDLE TIME DLY ----------- */
-    if (p_timeout != DEF_NULL) {                                /* If avail, cfg timeout vals    (see Note #3b3A1),     */
-        timeout_sec = (CPU_INT32U)p_timeout->timeout_sec;
-        timeout_us  = (CPU_INT32U)p_timeout->timeout_us;
-    } else {                                                    /* .. else  cfg timeout to block (see Note #3b3A2).     */
-        timeout_sec = NET_TMR_TIME_INFINITE;
-        timeout_us  = NET_TMR_TIME_INFINITE;
+
+    if (p_sock_desc_rd != DEF_NULL) {
+        NET_SOCK_DESC_COPY(&sock_desc_rtn_rd, p_sock_desc_rd);
+    } else {
+        NET_SOCK_DESC_INIT(&sock_desc_rtn_rd);
     }
 
+    if (p_sock_desc_wr != DEF_NULL) {
+        NET_SOCK_DESC_COPY(&sock_desc_rtn_wr, p_sock_desc_wr);
+    } else {
+        NET_SOCK_DESC_INIT(&sock_desc_rtn_wr);
+    }
 
-    if ((timeout_sec == 0) && (timeout_us == 0)) {              /* If timeout = 0, handle as non-blocking poll ..       */
-                                                                /* .. timeout (see Note #3b3A1a3).                      */
+    if (p_sock_desc_err != DEF_NULL) {
+        NET_SOCK_DESC_COPY(&sock_desc_rtn_err, p_sock_desc_err);
+    } else {
+        NET_SOCK_DESC_INIT(&sock_desc_rtn_err);
+    }
 
-                                                                /* Zero-clr rtn sock desc's (see Note #3c2B).           */
-                                                                /* Clr because no sock is ready at this point.          */
-        if (p_sock_desc_rd != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_rd );
-        }
 
-        if (p_sock_desc_wr != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_wr );
-        }
+    sock_nbr_rdy = NetSock_SelDescHandler(sock_nbr_max_actual,
+                                         &sock_desc_rtn_rd,
+                                         &sock_desc_rtn_wr,
+                                         &sock_desc_rtn_err,
+                                          p_err);
+    if (p_sock_desc_rd != DEF_NULL) {
+        NET_SOCK_DESC_COPY(p_sock_desc_rd, &sock_desc_rtn_rd);
+    }
 
-        if (p_sock_desc_err != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_err);
-        }
+    if (p_sock_desc_wr != DEF_NULL) {
+        NET_SOCK_DESC_COPY(p_sock_desc_wr,  &sock_desc_rtn_wr );
+    }
 
-       *p_err = NET_SOCK_ERR_TIMEOUT;
-        goto exit_err_timeout;
+    if (p_sock_desc_err != DEF_NULL) {
+        NET_SOCK_DESC_COPY(p_sock_desc_err, &sock_desc_rtn_err);
     }
 
+   *p_err = NET_SOCK_ERR_NONE;
 
-    if (sock_nbr_max < 1) {                                     /* If NO sock events cfg'd to wait on ...               */
+    goto exit_release;
 
-        Net_GlobalLockRelease();
-        if (p_timeout == DEF_NULL) {                            /* ... & NO timeout req'd,            ...               */
-           *p_err = NET_SOCK_ERR_INVALID_TIMEOUT;               /* ... rtn err (see Note #3b3A2a2).                     */
-            sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
-            goto exit;
-        }
 
-        Net_TimeDly(timeout_sec, timeout_us, &err);             /* Else dly for timeout (see Note #3b3A1b2).            */
-        switch (err) {
-            case NET_ERR_NONE:
-            case NET_ERR_TIME_DLY_MAX:
-                 break;
+exit_lock_fault:
+    return (NET_SOCK_BSD_ERR_SEL);
 
-            case NET_ERR_TIME_DLY_FAULT:
-            case NET_ERR_INVALID_TIME:
-            default:
-                *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
-                 sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
-                 goto exit;
-        }
-                                                                /* Zero-clr rtn sock desc's (see Note #3c2B).           */
-        if (p_sock_desc_rd != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_rd );
-        }
+exit_err_timeout:
+    sock_nbr_rdy = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
+    goto exit_release;
 
-        if (p_sock_desc_wr != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_wr );
-        }
+exit_err_sel:
+    sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
 
-        if (p_sock_desc_err != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_err);
-        }
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+   Net_GlobalLockRelease();
 
-       *p_err = NET_SOCK_ERR_TIMEOUT;
-        sock_nbr_rdy = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
+exit:
+   return (sock_nbr_rdy);                                       /* Rtn nbr rdy sock desc's (see Note #3c1A1).           */
+}
+#endif
+
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_SelAbort()
+*
+* Description : Abort (unblock) all tasks that are pending on a particular socket using the select.
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to abort the select.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                                 NET_SOCK_ERR_NONE              No error
+*
+*                                 NET_SOCK_ERR_INVALID_ARG       Invalid socket ID
+*                                 NET_SOCK_ERR_NONE_AVAIL        No task pending on the socket.
+*                                 NET_SOCK_ERR_INVALID_FLAG      No 'select' pend flag is set.
+*                                 NET_SOCK_ERR_SEL_SIGNAL_FAULT  Internal error.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : None.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+void  NetSock_SelAbort (NET_SOCK_ID   sock_id,
+                        NET_ERR      *p_err)
+{
+    NET_SOCK           *p_sock;
+    NET_SOCK_SEL_OBJ   *p_sel_obj;
+    CPU_BOOLEAN         post_success;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+#endif
+
+    p_sock = NetSock_GetObj(sock_id);
+    if (p_sock == DEF_NULL) {
+       *p_err = NET_SOCK_ERR_INVALID_ARG;
+        goto exit;
+    }
+
+    p_sel_obj = p_sock->SelObjTailPtr;
+    if (p_sel_obj == DEF_NULL) {
+       *p_err = NET_SOCK_ERR_NONE_AVAIL;
+        goto exit;
+    }
+
+    if (p_sel_obj->SockSelPendingFlags == NET_SOCK_SEL_EVENT_FLAG_NONE) {
+       *p_err = NET_SOCK_ERR_INVALID_FLAG;
         goto exit;
     }
 
+    post_success = NetSock_SelPost(p_sock, NET_SOCK_EVENT_TYPE_SEL_ABORT);
 
+   *p_err        = (post_success == DEF_OK) ?
+                   (NET_SOCK_ERR_NONE)      :
+                   (NET_SOCK_ERR_SEL_SIGNAL_FAULT);
 
-    task_sem  =  KAL_SemCreate((const  CPU_CHAR  *)"Net Sock Sel Task",
-                                                    DEF_NULL,
-                                                   &err_kal);
-    switch (err_kal) {
-        case KAL_ERR_NONE:
-             break;
+exit:
+    return;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         NetSock_PollCreate()
+*
+* Description : Allocate a socket event poll set.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Poll set successfully allocated.
+*                               NET_SOCK_ERR_POLL_NONE_AVAIL    NO poll sets available.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : Poll set identifier,  if NO error(s).
+*
+*               NET_SOCK_POLL_ID_NONE, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) Poll set signals are created once in NetSock_Init(); allocating a poll set only resets
+*                   its ready list & signal.
+*********************************************************************************************************
+*/
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+NET_SOCK_POLL_ID  NetSock_PollCreate (NET_ERR  *p_err)
+{
+    NET_SOCK_POLL_SET  *p_set;
+    NET_SOCK_POLL_ID    poll_id;
+    KAL_ERR             err_kal;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(NET_SOCK_POLL_ID_NONE);
+    }
+#endif
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_PollCreate, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        return (NET_SOCK_POLL_ID_NONE);
+    }
+
+                                                                /* ------------------ GET POLL SET -------------------- */
+    for (poll_id = 0; poll_id < NET_SOCK_CFG_EVENT_POLL_NBR; poll_id++) {
+        p_set = &NetSock_PollSetTbl[poll_id];
+        if (p_set->Used == DEF_NO) {
+            break;
+        }
+    }
+
+    if (poll_id >= NET_SOCK_CFG_EVENT_POLL_NBR) {
+        poll_id = NET_SOCK_POLL_ID_NONE;
+       *p_err   = NET_SOCK_ERR_POLL_NONE_AVAIL;
+        goto exit_release;
+    }
+                                                                /* ------------------ INIT POLL SET ------------------- */
+    p_set->RdyHeadPtr = DEF_NULL;
+    p_set->RdyTailPtr = DEF_NULL;
+    p_set->RdyNbr     = 0;
+    p_set->SockNbr    = 0;
+    p_set->WaitPend   = DEF_NO;
+    p_set->Used       = DEF_YES;
+
+    KAL_SemSet(p_set->SignalObj, 0u, &err_kal);                 /* Clr stale signals (see Note #1).                     */
+   (void)&err_kal;
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+
+    return (poll_id);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_PollClose()
+*
+* Description : Free a socket event poll set, unregistering ALL of its sockets.
+*
+* Argument(s) : poll_id     Poll set identifier returned by NetSock_PollCreate().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Poll set successfully freed.
+*                               NET_SOCK_ERR_POLL_INVALID_ID    Invalid poll set identifier.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) A task waiting on the poll set in NetSock_PollWait() is aborted.
+*********************************************************************************************************
+*/
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+void  NetSock_PollClose (NET_SOCK_POLL_ID   poll_id,
+                         NET_ERR           *p_err)
+{
+    NET_SOCK_POLL_SET  *p_set;
+    NET_SOCK           *p_sock;
+    NET_SOCK_QTY        i;
+    KAL_ERR             err_kal;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
 
-        case KAL_ERR_MEM_ALLOC:
-             *p_err = NET_ERR_FAULT_MEM_ALLOC;
-              goto exit_err_sel;
+    if ((poll_id <  0) ||
+        (poll_id >= NET_SOCK_CFG_EVENT_POLL_NBR)) {
+       *p_err = NET_SOCK_ERR_POLL_INVALID_ID;
+        return;
+    }
 
-        case KAL_ERR_ISR:
-        case KAL_ERR_INVALID_ARG:
-        case KAL_ERR_CREATE:
-        default:
-           *p_err = NET_SOCK_ERR_SEL_SIGNAL_FAULT;
-            goto exit_err_sel;
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_PollClose, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        return;
+    }
 
+    p_set = &NetSock_PollSetTbl[poll_id];
+    if (p_set->Used != DEF_YES) {
+       *p_err = NET_SOCK_ERR_POLL_INVALID_ID;
+        goto exit_release;
     }
 
+                                                                /* ------------- UNREGISTER ALL POLL SOCKS ------------ */
+    p_sock = &NetSock_Tbl[0];
+    for (i = 0; i < NET_SOCK_NBR_SOCK; i++) {
+        if (p_sock->PollID == poll_id) {
+            NetSock_PollUnreg(p_sock);
+        }
+        p_sock++;
+    }
 
-    for (sock_id = 0; sock_id < sock_nbr_max; sock_id++) {
-         p_sock = &NetSock_Tbl[sock_id];
-                                                                /* Null argument checks - Set for Read/Write or Error   */
-         if (p_sock_desc_rd != DEF_NULL) {
-             sock_desc_used_rd = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_rd);
-         } else {
-             sock_desc_used_rd = DEF_NO;
-         }
+    p_set->Used = DEF_NO;
+    if (p_set->WaitPend == DEF_YES) {                           /* Abort waiting task (see Note #1).                    */
+        KAL_SemPendAbort(p_set->SignalObj, &err_kal);
+       (void)&err_kal;
+    }
 
-         if (p_sock_desc_wr != DEF_NULL) {
-             sock_desc_used_wr = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_wr);
-         } else {
-             sock_desc_used_wr = DEF_NO;
-         }
+   *p_err = NET_SOCK_ERR_NONE;
 
-         if (p_sock_desc_err != DEF_NULL) {
-             sock_desc_used_err = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_err);
-         } else {
-             sock_desc_used_err = DEF_NO;
-         }
 
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+}
+#endif
 
-         if ((sock_desc_used_rd  == DEF_YES) ||
-             (sock_desc_used_wr  == DEF_YES) ||
-             (sock_desc_used_err == DEF_YES)) {
 
-             p_sel_obj = (NET_SOCK_SEL_OBJ *)Mem_DynPoolBlkGet(&NetSock_SelObjPool, &lib_err);
-             if (p_sel_obj == DEF_NULL) {
-                cnt_sock_id = sock_id - 1;
+/*
+*********************************************************************************************************
+*                                           NetSock_PollCtl()
+*
+* Description : (1) Register, modify or unregister a socket's events of interest in a socket event poll set :
+*
+*                   (a) NET_SOCK_POLL_OP_ADD    Register   socket with poll set
+*                   (b) NET_SOCK_POLL_OP_MOD    Modify     socket's events of interest
+*                   (c) NET_SOCK_POLL_OP_DEL    Unregister socket from poll set
+*
+*
+* Argument(s) : poll_id     Poll set identifier returned by NetSock_PollCreate().
+*
+*               op          Poll set operation (see Note #1).
+*
+*               sock_id     Socket descriptor/handle identifier of socket to (un)register.
+*
+*               events      Events of interest (see 'net_sock.h  NETWORK SOCKET EVENT POLL DATA TYPES
+*                               Note #2') :
+*
+*                               NET_SOCK_SEL_EVENT_FLAG_RD      Socket ready to read.
+*                               NET_SOCK_SEL_EVENT_FLAG_WR      Socket ready to write.
+*                               NET_SOCK_SEL_EVENT_FLAG_ERR     Socket error/closed.
+*                               NET_SOCK_POLL_EVENT_FLAG_EDGE   Report events edge-triggered.
+*
+*               p_data      Pointer to application data returned with the socket's events (optional).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Poll set successfully updated.
+*                               NET_SOCK_ERR_POLL_INVALID_ID    Invalid poll set identifier.
+*                               NET_SOCK_ERR_POLL_SOCK_REG      Socket already registered with a poll set.
+*                               NET_SOCK_ERR_POLL_SOCK_NOT_REG  Socket NOT registered with poll set.
+*                               NET_SOCK_ERR_INVALID_FLAG       Invalid events of interest.
+*                               NET_SOCK_ERR_INVALID_OP         Invalid poll set operation.
+*
+*                                                               ------ RETURNED BY NetSock_IsUsed() : -------
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : epoll_ctl(),
+*               Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (2) Unlike NetSock_Sel(), which links & unlinks a select object on every socket of interest
+*                   for every call, a socket is registered with a poll set ONCE & its readiness is then pushed
+*                   onto the poll set's ready list by NetSock_SelPost() as socket events occur.  Waiting on
+*                   a poll set is therefore proportional to the number of ready sockets only.
+*
+*               (3) A socket may be registered with at most one poll set at a time.  Closing a socket
+*                   unregisters it from its poll set.
+*
+*               (4) A socket that is already ready when registered or modified is placed on the ready list
+*                   immediately so that its current state is reported by the next NetSock_PollWait().
+*********************************************************************************************************
+*/
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+void  NetSock_PollCtl (NET_SOCK_POLL_ID          poll_id,
+                       NET_SOCK_POLL_OP          op,
+                       NET_SOCK_ID               sock_id,
+                       NET_SOCK_SEL_EVENT_FLAG   events,
+                       void                     *p_data,
+                       NET_ERR                  *p_err)
+{
+    NET_SOCK_POLL_SET        *p_set;
+    NET_SOCK                 *p_sock;
+    NET_SOCK_SEL_EVENT_FLAG   events_rdy;
+    CPU_BOOLEAN               sock_used;
 
-                while (cnt_sock_id >= 0) {
-                    NET_SOCK_SEL_OBJ  *p_sel_obj_to_free;
 
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
 
-                    sock_desc_used_rd  = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_rd);
-                    sock_desc_used_wr  = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_wr);
-                    sock_desc_used_err = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_err);
+    if ((poll_id <  0) ||
+        (poll_id >= NET_SOCK_CFG_EVENT_POLL_NBR)) {
+       *p_err = NET_SOCK_ERR_POLL_INVALID_ID;
+        return;
+    }
 
-                    if ((sock_desc_used_rd  == DEF_YES) ||
-                        (sock_desc_used_wr  == DEF_YES) ||
-                        (sock_desc_used_err == DEF_YES)) {
+    if ((op != NET_SOCK_POLL_OP_DEL) &&
+       ((events & NET_SOCK_SEL_EVENT_FLAG_MASK) == NET_SOCK_SEL_EVENT_FLAG_NONE)) {
+       *p_err = NET_SOCK_ERR_INVALID_FLAG;
+        return;
+    }
 
-                        p_sock                = &NetSock_Tbl[cnt_sock_id];
-                        p_sel_obj_to_free     =  p_sock->SelObjTailPtr;
-                        p_sock->SelObjTailPtr =  p_sel_obj_to_free->ObjPrevPtr;
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_PollCtl, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        return;
+    }
 
-                        Mem_DynPoolBlkFree(&NetSock_SelObjPool, p_sel_obj_to_free, &lib_err);
-                    }
+    p_set = &NetSock_PollSetTbl[poll_id];
+    if (p_set->Used != DEF_YES) {
+       *p_err = NET_SOCK_ERR_POLL_INVALID_ID;
+        goto exit_release;
+    }
 
-                    cnt_sock_id--;
-                }
+    sock_used = NetSock_IsUsed(sock_id, p_err);
+    if (sock_used != DEF_YES) {
+        goto exit_release;
+    }
 
-                 KAL_SemDel(task_sem, &err_kal_del);
-                *p_err = NET_ERR_FAULT_MEM_ALLOC;
-                 goto exit_err_sel;
+    p_sock = &NetSock_Tbl[sock_id];
+
+                                                                /* --------------- HANDLE POLL SET OP ----------------- */
+    switch (op) {
+        case NET_SOCK_POLL_OP_ADD:
+             if (p_sock->PollID != NET_SOCK_POLL_ID_NONE) {     /* See Note #3.                                         */
+                *p_err = NET_SOCK_ERR_POLL_SOCK_REG;
+                 goto exit_release;
              }
+             p_sock->PollID = poll_id;
+             p_set->SockNbr++;
+             break;
 
-             p_sel_obj->SockSelPendingFlags = NET_SOCK_SEL_EVENT_FLAG_NONE;
 
-             if (sock_desc_used_rd == DEF_YES) {
-                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_RD;
+        case NET_SOCK_POLL_OP_MOD:
+             if (p_sock->PollID != poll_id) {
+                *p_err = NET_SOCK_ERR_POLL_SOCK_NOT_REG;
+                 goto exit_release;
              }
+             break;
 
-             if (sock_desc_used_wr == DEF_YES) {
-                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_WR;
-             }
 
-             if (sock_desc_used_err == DEF_YES) {
-                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_ERR;
+        case NET_SOCK_POLL_OP_DEL:
+             if (p_sock->PollID != poll_id) {
+                *p_err = NET_SOCK_ERR_POLL_SOCK_NOT_REG;
+                 goto exit_release;
              }
-
-             p_sel_obj->SockSelTaskSignalObj = task_sem;
-             p_sel_obj->ObjPrevPtr           = p_sock->SelObjTailPtr;
-             p_sock->SelObjTailPtr           = p_sel_obj;
-         }
-    }
+             NetSock_PollUnreg(p_sock);
+            *p_err = NET_SOCK_ERR_NONE;
+             goto exit_release;
 
 
-    timeout_ms = NetUtil_TimeSec_uS_To_ms(timeout_sec, timeout_us);
-    if (timeout_ms == NET_TMR_TIME_INFINITE) {
-        timeout_ms =  KAL_TIMEOUT_INFINITE;
+        default:
+            *p_err = NET_SOCK_ERR_INVALID_OP;
+             goto exit_release;
     }
 
-                                                                /* ------ WAIT ON MULTIPLE SOCK DESC'S / EVENTS ------- */
-    Net_GlobalLockRelease();
+    p_sock->PollEventsCfgd   = events & (NET_SOCK_SEL_EVENT_FLAG_MASK | NET_SOCK_POLL_EVENT_FLAG_EDGE);
+    p_sock->PollEventsPosted = NET_SOCK_SEL_EVENT_FLAG_NONE;
+    p_sock->PollDataPtr      = p_data;
 
-    KAL_SemPend(task_sem, KAL_OPT_PEND_NONE, timeout_ms, &err_kal);
-    Net_GlobalLockAcquire((void *)&NetSock_Sel, p_err);
-    if (*p_err != NET_ERR_NONE) {
-        *p_err  = err;                                          /* Rtn err from Net_GlobalLockAcquire().                */
-         goto exit_lock_fault;
+    events_rdy = NetSock_PollRdyGet(p_sock);                    /* If sock already rdy, ...                             */
+    if (events_rdy != NET_SOCK_SEL_EVENT_FLAG_NONE) {
+        NetSock_PollPost(p_sock, events_rdy);                   /* ... post to poll set (see Note #4).                  */
     }
 
+   *p_err = NET_SOCK_ERR_NONE;
 
-    for (sock_id = 0; sock_id < sock_nbr_max; sock_id++) {
-         p_sock = &NetSock_Tbl[sock_id];
 
-         if (p_sock->SelObjTailPtr != DEF_NULL) {               /* Remove p_sel_obj from Socket Select objects list     */
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+}
+#endif
 
-             p_sel_obj_cur  = p_sock->SelObjTailPtr;
-             p_sel_obj_next = DEF_NULL;
 
-             while (p_sel_obj_cur != DEF_NULL) {
-                 NET_SOCK_SEL_OBJ  *p_sel_obj_prev = p_sel_obj_cur->ObjPrevPtr;
+/*
+*********************************************************************************************************
+*                                          NetSock_PollWait()
+*
+* Description : (1) Wait for events on the sockets registered with a socket event poll set :
+*
+*                   (a) Drain  poll set ready list                                  See Note #2
+*                   (b) Wait   for ready list post, if NO socket ready              See Note #4
+*
+*
+* Argument(s) : poll_id         Poll set identifier returned by NetSock_PollCreate().
+*
+*               p_events        Pointer to array that will receive the ready sockets' events.
+*
+*               events_nbr_max  Maximum number of events to return in 'p_events'.
+*
+*               timeout_ms      Timeout value :
+*
+*                                   0                       Do NOT wait; return immediately.
+*                                   NET_TMR_TIME_INFINITE   Wait forever.
+*                                   Any other value         Wait up to 'timeout_ms' milliseconds.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_SOCK_ERR_NONE               Ready socket events returned.
+*                                   NET_SOCK_ERR_TIMEOUT            NO socket ready before timeout.
+*                                   NET_SOCK_ERR_POLL_INVALID_ID    Invalid poll set identifier.
+*                                   NET_SOCK_ERR_INVALID_ARG        Invalid events array/size.
+*                                   NET_SOCK_ERR_POLL_SIGNAL_FAULT  Poll set signal fault or abort.
+*
+*                                                                   --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                                   NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : Number of ready socket events returned, if NO error(s) & at least one socket ready.
+*
+*               NET_SOCK_BSD_RTN_CODE_TIMEOUT,          if timeout occurred before any socket ready.
+*
+*               NET_SOCK_BSD_ERR_SEL,                   otherwise.
+*
+* Caller(s)   : epoll_wait(),
+*               Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (2) Only sockets on the ready list are examined; each socket's current readiness is checked
+*                   with the same handlers as NetSock_Sel() & masked with its events of interest.  At most
+*                   the number of sockets on the ready list at entry are examined so that no socket is
+*                   reported twice in one call.
+*
+*               (3) (a) Level-triggered sockets (default) that are reported remain on the ready list & are
+*                       re-checked on the next call until they are no longer ready.
+*
+*                   (b) Edge-triggered sockets (NET_SOCK_POLL_EVENT_FLAG_EDGE) are removed from the ready
+*                       list once reported & are NOT reported again until a new event is posted.
+*
+*               (4) The poll set signal is cleared before waiting & posted only while a task waits on the
+*                   poll set, so a wakeup is NOT consumed by events that were already drained.  After a
+*                   wakeup the ready list is drained once more; if still NO socket is ready, the timeout
+*                   is returned.
+*********************************************************************************************************
+*/
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+NET_SOCK_RTN_CODE  NetSock_PollWait (NET_SOCK_POLL_ID      poll_id,
+                                     NET_SOCK_POLL_EVENT  *p_events,
+                                     NET_SOCK_QTY          events_nbr_max,
+                                     CPU_INT32U            timeout_ms,
+                                     NET_ERR              *p_err)
+{
+    NET_SOCK_POLL_SET  *p_set;
+    NET_SOCK_QTY        events_nbr;
+    CPU_INT32U          timeout_kal;
+    KAL_ERR             err_kal;
 
 
-                 if (p_sel_obj_cur->SockSelTaskSignalObj.SemObjPtr == task_sem.SemObjPtr) {
-                     NET_SOCK_SEL_OBJ   *p_sel_obj_to_free  = DEF_NULL;
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(NET_SOCK_BSD_ERR_SEL);
+    }
+#endif
 
+    if ((poll_id <  0) ||
+        (poll_id >= NET_SOCK_CFG_EVENT_POLL_NBR)) {
+       *p_err = NET_SOCK_ERR_POLL_INVALID_ID;
+        return (NET_SOCK_BSD_ERR_SEL);
+    }
 
-                     if (p_sock->SelObjTailPtr == p_sel_obj_cur) {
-                         p_sock->SelObjTailPtr  = p_sel_obj_prev;
+    if ((p_events       == DEF_NULL) ||
+        (events_nbr_max <  1)) {
+       *p_err = NET_SOCK_ERR_INVALID_ARG;
+        return (NET_SOCK_BSD_ERR_SEL);
+    }
 
-                     } else if (p_sel_obj_next != DEF_NULL) {
-                         p_sel_obj_next->ObjPrevPtr = p_sel_obj_prev;
-                     } else {
-                                                                /* Empty Else Statement                                 */
-                     }
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_PollWait, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        return (NET_SOCK_BSD_ERR_SEL);
+    }
 
-                     p_sel_obj_to_free = p_sel_obj_cur;
-                     p_sel_obj_cur  = p_sel_obj_cur->ObjPrevPtr;
+    p_set = &NetSock_PollSetTbl[poll_id];
+    if (p_set->Used != DEF_YES) {
+       *p_err = NET_SOCK_ERR_POLL_INVALID_ID;
+        events_nbr = NET_SOCK_BSD_ERR_SEL;
+        goto exit_release;
+    }
 
-                     Mem_DynPoolBlkFree(&NetSock_SelObjPool, p_sel_obj_to_free, &lib_err);
+                                                                /* ---------------- DRAIN POLL RDY LIST --------------- */
+    events_nbr = NetSock_PollRdyDrain(p_set, p_events, events_nbr_max);
+    if (events_nbr > 0) {
+       *p_err = NET_SOCK_ERR_NONE;
+        goto exit_release;
+    }
 
-                 } else {
-                     p_sel_obj_next = p_sel_obj_cur;
-                     p_sel_obj_cur  = p_sel_obj_cur->ObjPrevPtr;
-                 }
-             }
-         }
+    if (timeout_ms == 0u) {                                     /* If NO timeout, rtn immediately.                      */
+       *p_err      = NET_SOCK_ERR_TIMEOUT;
+        events_nbr = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
+        goto exit_release;
     }
 
+                                                                /* ---------------- WAIT ON POLL SET ------------------ */
+    timeout_kal = (timeout_ms == NET_TMR_TIME_INFINITE) ? KAL_TIMEOUT_INFINITE : timeout_ms;
 
-    KAL_SemDel(task_sem, &err_kal_del);
-   (void)&err_kal_del;
+    KAL_SemSet(p_set->SignalObj, 0u, &err_kal);                 /* See Note #4.                                         */
+    p_set->WaitPend = DEF_YES;
+
+    Net_GlobalLockRelease();
+
+    KAL_SemPend(p_set->SignalObj, KAL_OPT_PEND_NONE, timeout_kal, &err_kal);
 
+    Net_GlobalLockAcquire((void *)&NetSock_PollWait, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        return (NET_SOCK_BSD_ERR_SEL);
+    }
 
+    p_set->WaitPend = DEF_NO;
 
     switch (err_kal) {
         case KAL_ERR_NONE:
              break;
 
-        case KAL_ERR_TIMEOUT:
-             if (p_sock_desc_rd != DEF_NULL) {
-                 NET_SOCK_DESC_INIT(p_sock_desc_rd );
-             }
-
-             if (p_sock_desc_wr != DEF_NULL) {
-                 NET_SOCK_DESC_INIT(p_sock_desc_wr );
-             }
 
-             if (p_sock_desc_err != DEF_NULL) {
-                 NET_SOCK_DESC_INIT(p_sock_desc_err);
-             }
-            *p_err = NET_SOCK_ERR_TIMEOUT;
-             goto exit_err_timeout;
+        case KAL_ERR_TIMEOUT:
+            *p_err      = NET_SOCK_ERR_TIMEOUT;
+             events_nbr = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
+             goto exit_release;
 
+
+        case KAL_ERR_ABORT:                                     /* Poll set closed while waiting.                       */
         case KAL_ERR_WOULD_BLOCK:
         case KAL_ERR_ISR:
-        case KAL_ERR_ABORT:
         case KAL_ERR_OS:
         default:
-             goto exit_err_sel;
-    }
-
-
-
-    if (p_sock_desc_rd != DEF_NULL) {
-        NET_SOCK_DESC_COPY(&sock_desc_rtn_rd, p_sock_desc_rd);
-    } else {
-        NET_SOCK_DESC_INIT(&sock_desc_rtn_rd);
+            *p_err      = NET_SOCK_ERR_POLL_SIGNAL_FAULT;
+             events_nbr = NET_SOCK_BSD_ERR_SEL;
+             goto exit_release;
     }
 
-    if (p_sock_desc_wr != DEF_NULL) {
-        NET_SOCK_DESC_COPY(&sock_desc_rtn_wr, p_sock_desc_wr);
-    } else {
-        NET_SOCK_DESC_INIT(&sock_desc_rtn_wr);
+    if (p_set->Used != DEF_YES) {
+       *p_err      = NET_SOCK_ERR_POLL_INVALID_ID;
+        events_nbr = NET_SOCK_BSD_ERR_SEL;
+        goto exit_release;
     }
 
-    if (p_sock_desc_err != DEF_NULL) {
-        NET_SOCK_DESC_COPY(&sock_desc_rtn_err, p_sock_desc_err);
+    events_nbr = NetSock_PollRdyDrain(p_set, p_events, events_nbr_max);
+    if (events_nbr > 0) {
+       *p_err      = NET_SOCK_ERR_NONE;
     } else {
-        NET_SOCK_DESC_INIT(&sock_desc_rtn_err);
+       *p_err      = NET_SOCK_ERR_TIMEOUT;                      /* See Note #4.                                         */
+        events_nbr = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
     }
 
 
-    sock_nbr_rdy = NetSock_SelDescHandler(sock_nbr_max_actual,
-                                         &sock_desc_rtn_rd,
-                                         &sock_desc_rtn_wr,
-                                         &sock_desc_rtn_err,
-                                          p_err);
-    if (p_sock_desc_rd != DEF_NULL) {
-        NET_SOCK_DESC_COPY(p_sock_desc_rd, &sock_desc_rtn_rd);
-    }
-
-    if (p_sock_desc_wr != DEF_NULL) {
-        NET_SOCK_DESC_COPY(p_sock_desc_wr,  &sock_desc_rtn_wr );
-    }
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
 
-    if (p_sock_desc_err != DEF_NULL) {
-        NET_SOCK_DESC_COPY(p_sock_desc_err, &sock_desc_rtn_err);
-    }
+    return (events_nbr);
+}
+#endif
 
-   *p_err = NET_SOCK_ERR_NONE;
 
-    goto exit_release;
+/*
+*********************************************************************************************************
+*                                          NetSock_AppPostRx()
+*
+* Description : Signal application layer that something happen on a connection.
+*
+* Argument(s) : conn_id_app     Connection handle identifier of socket to signal.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetSock_GetConnTransport().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+#ifdef NET_SOCK_TYPE_STREAM_MODULE_EN
+static  void  NetSock_AppPostRx (NET_CONN_ID  conn_id_app)
+{
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+    NET_SOCK    *p_sock;
 
+    if (conn_id_app == NET_CONN_ID_NONE) {
+        return;
+    }
 
-exit_lock_fault:
-    return (NET_SOCK_BSD_ERR_SEL);
+    p_sock = &NetSock_Tbl[conn_id_app];
+   (void)NetSock_SelPost(p_sock, NET_SOCK_EVENT_TYPE_RX);
+#endif
+}
+#endif
 
-exit_err_timeout:
-    sock_nbr_rdy = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
-    goto exit_release;
 
-exit_err_sel:
-    sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
+/*
+*********************************************************************************************************
+*                                          NetSock_AppPostTx()
+*
+* Description : Signal application layer that something happen on a connection.
+*
+* Argument(s) : conn_id_app     Connection handle identifier of socket to signal.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetSock_GetConnTransport().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+#ifdef NET_SOCK_TYPE_STREAM_MODULE_EN
+static  void  NetSock_AppPostTx (NET_CONN_ID  conn_id_app)
+{
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+    NET_SOCK    *p_sock;
 
-exit_release:
-                                                                /* ----------------- RELEASE NET LOCK ----------------- */
-   Net_GlobalLockRelease();
+    if (conn_id_app == NET_CONN_ID_NONE) {
+        return;
+    }
 
-exit:
-   return (sock_nbr_rdy);                                       /* Rtn nbr rdy sock desc's (see Note #3c1A1).           */
+    p_sock = &NetSock_Tbl[conn_id_app];
+   (void)NetSock_SelPost(p_sock, NET_SOCK_EVENT_TYPE_TX);
+#endif
 }
 #endif
 
 
-
 /*
 *********************************************************************************************************
-*                                          NetSock_SelAbort()
-*
-* Description : Abort (unblock) all tasks that are pending on a particular socket using the select.
+*                                           NetSock_SelPost()
 *
-* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to abort the select.
+* Description : Signal select pending object that something happened on the connection.
 *
-*               p_err       Pointer to variable that will receive the return error code from this function :
+* Argument(s) : sem      Semaphore signal object.
 *
-*                                 NET_SOCK_ERR_NONE              No error
+* Return(s)   : DEF_OK   if post to semaphore was successful.
 *
-*                                 NET_SOCK_ERR_INVALID_ARG       Invalid socket ID
-*                                 NET_SOCK_ERR_NONE_AVAIL        No task pending on the socket.
-*                                 NET_SOCK_ERR_INVALID_FLAG      No 'select' pend flag is set.
-*                                 NET_SOCK_ERR_SEL_SIGNAL_FAULT  Internal error.
+*               DEF_FAIL in case of an internal error.
 *
-* Return(s)   : None.
+* Caller(s)   : NetSock_AppPost(),
+*               NetSock_ConnAcceptQ_Abort(),
+*               NetSock_ConnAcceptQ_Signal(),
+*               NetSock_ConnCloseAbort(),
+*               NetSock_ConnCloseSignal(),
+*               NetSock_ConnReqAbort(),
+*               NetSock_ConnReqSignal(),
+*               NetSock_RxQ_Abort(),
+*               NetSock_RxQ_Signal().
+*               NetSock_SelAbort().
 *
-* Caller(s)   : None.
+* Note(s)     : (1) At least one of the socket's Select Pending Flags (.SockSelPendingFlags) must be set
+*                   in order to properly post to the KAL_SemPend() call in NetSock_Sel().
 *
-* Note(s)     : None.
+*               (2) Socket events are also posted to the socket's event poll set, if any, regardless of
+*                   any task pending in NetSock_Sel(); see 'NetSock_PollCtl()  Note #2'.
 *********************************************************************************************************
 */
 #if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
-void  NetSock_SelAbort (NET_SOCK_ID   sock_id,
-                        NET_ERR      *p_err)
+static  CPU_BOOLEAN  NetSock_SelPost (NET_SOCK             *p_sock,
+                                      NET_SOCK_EVENT_TYPE   event)
 {
-    NET_SOCK           *p_sock;
-    NET_SOCK_SEL_OBJ   *p_sel_obj;
-    CPU_BOOLEAN         post_success;
+    NET_SOCK_SEL_EVENT_FLAG   flags_mask   = NET_SOCK_SEL_EVENT_FLAG_NONE;
+    NET_SOCK_SEL_OBJ         *p_sel_obj    = p_sock->SelObjTailPtr;
+    CPU_BOOLEAN               post_success = DEF_FAIL;
 
 
-#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
-    if (p_err == DEF_NULL) {
-        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    switch (event) {
+        case NET_SOCK_EVENT_TYPE_CONN_REQ_SIGNAL:
+        case NET_SOCK_EVENT_TYPE_CONN_ACCEPT_SIGNAL:
+             flags_mask = NET_SOCK_SEL_EVENT_FLAG_RD
+                        | NET_SOCK_SEL_EVENT_FLAG_WR;
+             break;
+
+        case NET_SOCK_EVENT_TYPE_CONN_ACCEPT_ABORT:
+        case NET_SOCK_EVENT_TYPE_CONN_CLOSE_SIGNAL:
+        case NET_SOCK_EVENT_TYPE_CONN_REQ_ABORT:
+        case NET_SOCK_EVENT_TYPE_CONN_CLOSE_ABORT:
+        case NET_SOCK_EVENT_TYPE_SEL_ABORT:
+             flags_mask = NET_SOCK_SEL_EVENT_FLAG_RD
+                        | NET_SOCK_SEL_EVENT_FLAG_WR
+                        | NET_SOCK_SEL_EVENT_FLAG_ERR;
+              break;
+
+        case NET_SOCK_EVENT_TYPE_RX_ABORT:
+             flags_mask = NET_SOCK_SEL_EVENT_FLAG_RD
+                        | NET_SOCK_SEL_EVENT_FLAG_ERR;
+             break;
+
+        case NET_SOCK_EVENT_TYPE_RX:
+             flags_mask = NET_SOCK_SEL_EVENT_FLAG_RD;
+             break;
+
+        case NET_SOCK_EVENT_TYPE_TX:
+             flags_mask = NET_SOCK_SEL_EVENT_FLAG_WR;
+             break;
+
+        default:
+             break;
     }
+
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+    NetSock_PollPost(p_sock, flags_mask);                       /* See Note #2.                                         */
 #endif
 
-    p_sock = NetSock_GetObj(sock_id);
-    if (p_sock == DEF_NULL) {
-       *p_err = NET_SOCK_ERR_INVALID_ARG;
-        goto exit;
+    while (p_sel_obj != DEF_NULL) {
+        if ((p_sel_obj->SockSelPendingFlags & flags_mask) > 0) {/* See Note 1.                                          */
+            KAL_ERR  err_kal;
+
+
+            KAL_SemPost(p_sel_obj->SockSelTaskSignalObj, KAL_OPT_PEND_NONE, &err_kal);
+            if (err_kal == KAL_ERR_NONE) {
+                post_success = DEF_OK;
+            }
+        }
+
+        p_sel_obj = p_sel_obj->ObjPrevPtr;
     }
 
-    p_sel_obj = p_sock->SelObjTailPtr;
-    if (p_sel_obj == DEF_NULL) {
-       *p_err = NET_SOCK_ERR_NONE_AVAIL;
-        goto exit;
+    return (post_success);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_PollPost()
+*
+* Description : Post socket events to the socket's event poll set.
+*
+* Argument(s) : p_sock      Pointer to socket.
+*               ------      Argument validated in caller(s).
+*
+*               flags_mask  Socket events that occurred.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetSock_SelPost(),
+*               NetSock_PollCtl().
+*
+* Note(s)     : (1) The socket is appended to the poll set's ready list only if any posted event is an event
+*                   of interest & the socket is NOT already on the ready list.  The poll set signal is posted
+*                   only while a task waits on the poll set (see 'NetSock_PollWait()  Note #4').
+*********************************************************************************************************
+*/
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+static  void  NetSock_PollPost (NET_SOCK                 *p_sock,
+                                NET_SOCK_SEL_EVENT_FLAG   flags_mask)
+{
+    NET_SOCK_POLL_SET        *p_set;
+    NET_SOCK_SEL_EVENT_FLAG   events;
+    KAL_ERR                   err_kal;
+
+
+    if (p_sock->PollID == NET_SOCK_POLL_ID_NONE) {
+        return;
     }
 
-    if (p_sel_obj->SockSelPendingFlags == NET_SOCK_SEL_EVENT_FLAG_NONE) {
-       *p_err = NET_SOCK_ERR_INVALID_FLAG;
-        goto exit;
+    events = flags_mask & p_sock->PollEventsCfgd & NET_SOCK_SEL_EVENT_FLAG_MASK;
+    if (events == NET_SOCK_SEL_EVENT_FLAG_NONE) {               /* See Note #1.                                         */
+        return;
     }
 
-    post_success = NetSock_SelPost(p_sock, NET_SOCK_EVENT_TYPE_SEL_ABORT);
+    p_sock->PollEventsPosted |= events;
 
-   *p_err        = (post_success == DEF_OK) ?
-                   (NET_SOCK_ERR_NONE)      :
-                   (NET_SOCK_ERR_SEL_SIGNAL_FAULT);
+    p_set = &NetSock_PollSetTbl[p_sock->PollID];
+    if (p_sock->PollRdyListed != DEF_YES) {                     /* Append sock to rdy list.                             */
+        p_sock->PollRdyNextPtr = DEF_NULL;
+        if (p_set->RdyTailPtr == DEF_NULL) {
+            p_set->RdyHeadPtr                 = p_sock;
+        } else {
+            p_set->RdyTailPtr->PollRdyNextPtr = p_sock;
+        }
+        p_set->RdyTailPtr     = p_sock;
+        p_set->RdyNbr++;
+        p_sock->PollRdyListed = DEF_YES;
+    }
 
-exit:
-    return;
+    if (p_set->WaitPend == DEF_YES) {
+        p_set->WaitPend = DEF_NO;
+        KAL_SemPost(p_set->SignalObj, KAL_OPT_PEND_NONE, &err_kal);
+       (void)&err_kal;
+    }
 }
 #endif
 
 
 /*
 *********************************************************************************************************
-*                                          NetSock_AppPostRx()
+*                                         NetSock_PollRdyGet()
 *
-* Description : Signal application layer that something happen on a connection.
+* Description : Get a socket's current readiness for its events of interest.
 *
-* Argument(s) : conn_id_app     Connection handle identifier of socket to signal.
+* Argument(s) : p_sock      Pointer to socket.
+*               ------      Argument validated in caller(s).
 *
-* Return(s)   : none.
+* Return(s)   : Socket events of interest currently ready.
 *
-* Caller(s)   : NetSock_GetConnTransport().
+* Caller(s)   : NetSock_PollCtl(),
+*               NetSock_PollRdyDrain().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Readiness is determined by the same handlers as NetSock_Sel(); see 'NetSock_Sel()
+*                   Note #3b'.
 *********************************************************************************************************
 */
-#ifdef NET_SOCK_TYPE_STREAM_MODULE_EN
-static  void  NetSock_AppPostRx (NET_CONN_ID  conn_id_app)
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+static  NET_SOCK_SEL_EVENT_FLAG  NetSock_PollRdyGet (NET_SOCK  *p_sock)
 {
-#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
-    NET_SOCK    *p_sock;
+    NET_SOCK_SEL_EVENT_FLAG  events_rdy;
+    CPU_BOOLEAN              sock_rdy;
+    NET_ERR                  err;
+
+
+    events_rdy = NET_SOCK_SEL_EVENT_FLAG_NONE;
+
+    if (DEF_BIT_IS_SET(p_sock->PollEventsCfgd, NET_SOCK_SEL_EVENT_FLAG_RD) == DEF_YES) {
+        sock_rdy = NetSock_SelDescHandlerRd(p_sock->ID, &err);
+        if (sock_rdy == DEF_YES) {
+            DEF_BIT_SET(events_rdy, NET_SOCK_SEL_EVENT_FLAG_RD);
+        }
+    }
+
+    if (DEF_BIT_IS_SET(p_sock->PollEventsCfgd, NET_SOCK_SEL_EVENT_FLAG_WR) == DEF_YES) {
+        sock_rdy = NetSock_SelDescHandlerWr(p_sock->ID, &err);
+        if (sock_rdy == DEF_YES) {
+            DEF_BIT_SET(events_rdy, NET_SOCK_SEL_EVENT_FLAG_WR);
+        }
+    }
 
-    if (conn_id_app == NET_CONN_ID_NONE) {
-        return;
+    if (DEF_BIT_IS_SET(p_sock->PollEventsCfgd, NET_SOCK_SEL_EVENT_FLAG_ERR) == DEF_YES) {
+        sock_rdy = NetSock_SelDescHandlerErr(p_sock->ID, &err);
+        if (sock_rdy == DEF_YES) {
+            DEF_BIT_SET(events_rdy, NET_SOCK_SEL_EVENT_FLAG_ERR);
+        }
     }
 
-    p_sock = &NetSock_Tbl[conn_id_app];
-   (void)NetSock_SelPost(p_sock, NET_SOCK_EVENT_TYPE_RX);
-#endif
+    return (events_rdy);
 }
 #endif
 
 
 /*
 *********************************************************************************************************
-*                                          NetSock_AppPostTx()
+*                                        NetSock_PollRdyDrain()
 *
-* Description : Signal application layer that something happen on a connection.
+* Description : Drain a socket event poll set's ready list into an events array.
 *
-* Argument(s) : conn_id_app     Connection handle identifier of socket to signal.
+* Argument(s) : p_set           Pointer to poll set.
+*               -----           Argument validated in caller(s).
 *
-* Return(s)   : none.
+*               p_events        Pointer to array that will receive the ready sockets' events.
+*               --------        Argument validated in caller(s).
 *
-* Caller(s)   : NetSock_GetConnTransport().
+*               events_nbr_max  Maximum number of events to return in 'p_events'.
 *
-* Note(s)     : none.
+* Return(s)   : Number of ready socket events returned.
+*
+* Caller(s)   : NetSock_PollWait().
+*
+* Note(s)     : (1) See 'NetSock_PollWait()  Notes #2 & #3'.
 *********************************************************************************************************
 */
-#ifdef NET_SOCK_TYPE_STREAM_MODULE_EN
-static  void  NetSock_AppPostTx (NET_CONN_ID  conn_id_app)
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+static  NET_SOCK_QTY  NetSock_PollRdyDrain (NET_SOCK_POLL_SET    *p_set,
+                                            NET_SOCK_POLL_EVENT  *p_events,
+                                            NET_SOCK_QTY          events_nbr_max)
 {
-#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
-    NET_SOCK    *p_sock;
+    NET_SOCK                 *p_sock;
+    NET_SOCK_SEL_EVENT_FLAG   events_rdy;
+    NET_SOCK_QTY              events_nbr;
+    NET_SOCK_QTY              sock_nbr_chk;
+    CPU_BOOLEAN               edge;
+
+
+    events_nbr   = 0;
+    sock_nbr_chk = p_set->RdyNbr;                               /* Chk only socks listed at entry (see Note #1).        */
+
+    while ((sock_nbr_chk > 0) &&
+           (events_nbr   < events_nbr_max)) {
+                                                                /* Unlink sock from head of rdy list.                   */
+        p_sock            = p_set->RdyHeadPtr;
+        p_set->RdyHeadPtr = p_sock->PollRdyNextPtr;
+        if (p_set->RdyHeadPtr == DEF_NULL) {
+            p_set->RdyTailPtr = DEF_NULL;
+        }
+        p_set->RdyNbr--;
+        p_sock->PollRdyNextPtr = DEF_NULL;
+        p_sock->PollRdyListed  = DEF_NO;
+        sock_nbr_chk--;
+
+        events_rdy               = NetSock_PollRdyGet(p_sock);
+        p_sock->PollEventsPosted = NET_SOCK_SEL_EVENT_FLAG_NONE;
+        if (events_rdy == NET_SOCK_SEL_EVENT_FLAG_NONE) {
+            continue;
+        }
 
-    if (conn_id_app == NET_CONN_ID_NONE) {
-        return;
+        p_events->SockID  = p_sock->ID;
+        p_events->Events  = events_rdy;
+        p_events->DataPtr = p_sock->PollDataPtr;
+        p_events++;
+        events_nbr++;
+
+        edge = DEF_BIT_IS_SET(p_sock->PollEventsCfgd, NET_SOCK_POLL_EVENT_FLAG_EDGE);
+        if (edge == DEF_NO) {                                   /* Re-append level-triggered sock to rdy list.          */
+            if (p_set->RdyTailPtr == DEF_NULL) {
+                p_set->RdyHeadPtr                 = p_sock;
+            } else {
+                p_set->RdyTailPtr->PollRdyNextPtr = p_sock;
+            }
+            p_set->RdyTailPtr     = p_sock;
+            p_set->RdyNbr++;
+            p_sock->PollRdyListed = DEF_YES;
+        }
     }
 
-    p_sock = &NetSock_Tbl[conn_id_app];
-   (void)NetSock_SelPost(p_sock, NET_SOCK_EVENT_TYPE_TX);
-#endif
+    return (events_nbr);
 }
 #endif
 
 
 /*
 *********************************************************************************************************
-*                                           NetSock_SelPost()
-*
-* Description : Signal select pending object that something happened on the connection.
+*                                         NetSock_PollUnreg()
 *
-* Argument(s) : sem      Semaphore signal object.
+* Description : Unregister a socket from its socket event poll set.
 *
-* Return(s)   : DEF_OK   if post to semaphore was successful.
+* Argument(s) : p_sock      Pointer to socket.
+*               ------      Argument validated in caller(s).
 *
-*               DEF_FAIL in case of an internal error.
+* Return(s)   : none.
 *
-* Caller(s)   : NetSock_AppPost(),
-*               NetSock_ConnAcceptQ_Abort(),
-*               NetSock_ConnAcceptQ_Signal(),
-*               NetSock_ConnCloseAbort(),
-*               NetSock_ConnCloseSignal(),
-*               NetSock_ConnReqAbort(),
-*               NetSock_ConnReqSignal(),
-*               NetSock_RxQ_Abort(),
-*               NetSock_RxQ_Signal().
-*               NetSock_SelAbort().
+* Caller(s)   : NetSock_Free(),
+*               NetSock_PollClose(),
+*               NetSock_PollCtl().
 *
-* Note(s)     : (1) At least one of the socket's Select Pending Flags (.SockSelPendingFlags) must be set
-*                   in order to properly post to the KAL_SemPend() call in NetSock_Sel().
+* Note(s)     : none.
 *********************************************************************************************************
 */
-#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
-static  CPU_BOOLEAN  NetSock_SelPost (NET_SOCK             *p_sock,
-                                      NET_SOCK_EVENT_TYPE   event)
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+static  void  NetSock_PollUnreg (NET_SOCK  *p_sock)
 {
-    NET_SOCK_SEL_EVENT_FLAG   flags_mask   = NET_SOCK_SEL_EVENT_FLAG_NONE;
-    NET_SOCK_SEL_OBJ         *p_sel_obj    = p_sock->SelObjTailPtr;
-    CPU_BOOLEAN               post_success = DEF_FAIL;
-
-
-    if (p_sel_obj == DEF_NULL) {
-        goto exit;
-    }
-
-
-    switch (event) {
-        case NET_SOCK_EVENT_TYPE_CONN_REQ_SIGNAL:
-        case NET_SOCK_EVENT_TYPE_CONN_ACCEPT_SIGNAL:
-             flags_mask = NET_SOCK_SEL_EVENT_FLAG_RD
-                        | NET_SOCK_SEL_EVENT_FLAG_WR;
-             break;
-
-        case NET_SOCK_EVENT_TYPE_CONN_ACCEPT_ABORT:
-        case NET_SOCK_EVENT_TYPE_CONN_CLOSE_SIGNAL:
-        case NET_SOCK_EVENT_TYPE_CONN_REQ_ABORT:
-        case NET_SOCK_EVENT_TYPE_CONN_CLOSE_ABORT:
-        case NET_SOCK_EVENT_TYPE_SEL_ABORT:
-             flags_mask = NET_SOCK_SEL_EVENT_FLAG_RD
-                        | NET_SOCK_SEL_EVENT_FLAG_WR
-                        | NET_SOCK_SEL_EVENT_FLAG_ERR;
-              break;
-
-        case NET_SOCK_EVENT_TYPE_RX_ABORT:
-             flags_mask = NET_SOCK_SEL_EVENT_FLAG_RD
-                        | NET_SOCK_SEL_EVENT_FLAG_ERR;
-             break;
-
-        case NET_SOCK_EVENT_TYPE_RX:
-             flags_mask = NET_SOCK_SEL_EVENT_FLAG_RD;
-             break;
+    NET_SOCK_POLL_SET  *p_set;
+    NET_SOCK           *p_sock_prev;
+    NET_SOCK           *p_sock_cur;
 
-        case NET_SOCK_EVENT_TYPE_TX:
-             flags_mask = NET_SOCK_SEL_EVENT_FLAG_WR;
-             break;
 
-        default:
-             break;
+    if (p_sock->PollID == NET_SOCK_POLL_ID_NONE) {
+        return;
     }
 
+    p_set = &NetSock_PollSetTbl[p_sock->PollID];
 
-    while (p_sel_obj != DEF_NULL) {
-        if ((p_sel_obj->SockSelPendingFlags & flags_mask) > 0) {/* See Note 1.                                          */
-            KAL_ERR  err_kal;
-
+    if (p_sock->PollRdyListed == DEF_YES) {                     /* Unlink sock from rdy list.                           */
+        p_sock_prev = DEF_NULL;
+        p_sock_cur  = p_set->RdyHeadPtr;
+        while ((p_sock_cur != DEF_NULL) &&
+               (p_sock_cur != p_sock)) {
+            p_sock_prev = p_sock_cur;
+            p_sock_cur  = p_sock_cur->PollRdyNextPtr;
+        }
 
-            KAL_SemPost(p_sel_obj->SockSelTaskSignalObj, KAL_OPT_PEND_NONE, &err_kal);
-            if (err_kal == KAL_ERR_NONE) {
-                post_success = DEF_OK;
+        if (p_sock_cur != DEF_NULL) {
+            if (p_sock_prev == DEF_NULL) {
+                p_set->RdyHeadPtr           = p_sock->PollRdyNextPtr;
+            } else {
+                p_sock_prev->PollRdyNextPtr = p_sock->PollRdyNextPtr;
             }
+            if (p_set->RdyTailPtr == p_sock) {
+                p_set->RdyTailPtr           = p_sock_prev;
+            }
+            p_set->RdyNbr--;
         }
+    }
 
-        p_sel_obj = p_sel_obj->ObjPrevPtr;
+    if (p_set->SockNbr > 0) {
+        p_set->SockNbr--;
     }
 
-exit:
-    return (post_success);
+    p_sock->PollID           = NET_SOCK_POLL_ID_NONE;
+    p_sock->PollEventsCfgd   = NET_SOCK_SEL_EVENT_FLAG_NONE;
+    p_sock->PollEventsPosted = NET_SOCK_SEL_EVENT_FLAG_NONE;
+    p_sock->PollRdyListed    = DEF_NO;
+    p_sock->PollRdyNextPtr   = DEF_NULL;
+    p_sock->PollDataPtr      = DEF_NULL;
 }
 #endif
 
@@ -7016,35 +8949,235 @@ exit_release:
                                                                /* ----------------- RELEASE NET LOCK ----------------- */
    Net_GlobalLockRelease();
 
-   return (rtn_val);
+   return (rtn_val);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetSock_BlockGet()
+*
+* Description : Get the blocking mode configuration of the specified socket.
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to get option from.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE       Operation was successful.
+*
+*                               ------------ RETURNED BY NetSock_IsUsed() ------------
+*                               See NetSock_IsUsed() for additional return error codes.
+*
+* Return(s)   : NET_SOCK_BLOCK_SEL_NO_BLOCK : Socket is in none blocking mode.
+*               NET_SOCK_BLOCK_SEL_BLOCK    : Socket is in blocking mode.
+*               NET_SOCK_BLOCK_SEL_NONE     : Error in operation.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetSock_BlockGet() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access is
+*                   asynchronous to other network protocol tasks.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  NetSock_BlockGet (NET_SOCK_ID   sock_id,
+                              NET_ERR      *p_err)
+{
+    NET_SOCK     *p_sock;
+    CPU_BOOLEAN   is_no_block;
+    CPU_INT08U    block;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+#endif
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_CfgBlock, p_err);     /* See Note #2b.                                        */
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* ---------------- VALIDATE SOCK USED ---------------- */
+   (void)NetSock_IsUsed(sock_id, p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         block = NET_SOCK_BLOCK_SEL_NONE;
+         goto exit_release;
+    }
+#endif
+
+                                                                /* --------------- CFG SOCK BLOCK MODE ---------------- */
+    p_sock = &NetSock_Tbl[sock_id];
+
+    is_no_block = DEF_BIT_IS_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_NO_BLOCK);
+    if (is_no_block == DEF_YES) {
+        block = NET_SOCK_BLOCK_SEL_NO_BLOCK;
+    } else {
+        block = NET_SOCK_BLOCK_SEL_BLOCK;
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+    goto exit_release;
+
+
+exit_lock_fault:
+    return (NET_SOCK_BLOCK_SEL_NONE);
+
+exit_release:
+                                                                  /* ----------------- RELEASE NET LOCK ----------------- */
+      Net_GlobalLockRelease();
+
+   return (block);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetSock_CfgTxCork()
+*
+* Description : (1) Configure socket's TCP connection transmit cork :
+*
+*                   (a) Acquire   network lock                                          See Note #2
+*                   (b) Configure socket's TCP connection transmit cork                 See Note #3
+*                   (c) Release   network lock
+*
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to configure transmit cork.
+*
+*               cork_en     Desired value for socket transmit cork :
+*
+*                               DEF_ENABLED                     Socket transmits ONLY full-sized segments.
+*                               DEF_DISABLED                    Socket pushes held & all further data.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket transmit cork successfully configured.
+*
+*                                                               ---- RETURNED BY NetSock_CfgTxCorkHandler() : ----
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*                               NET_SOCK_ERR_INVALID_PROTOCOL   Socket does NOT use TCP.
+*                               NET_SOCK_ERR_INVALID_TYPE       Socket is NOT a stream-type socket.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   socket transmit cork successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetSock_CfgTxCork() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access is
+*                   asynchronous to other network protocol tasks.
+*
+*               (3) (a) A corked socket transmits ONLY full-sized segments; the application MUST uncork the
+*                       socket to push the remaining data (see 'net_tcp.c  NetTCP_ConnCfgTxCorkEnHandler()
+*                       Note #3').
+*
+*                   (b) To hold back a single transmit, set NET_SOCK_FLAG_TX_MORE on that transmit instead
+*                       (see 'NetSock_TxDataHandler()  Note #3b').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+CPU_BOOLEAN  NetSock_CfgTxCork (NET_SOCK_ID   sock_id,
+                                CPU_BOOLEAN   cork_en,
+                                NET_ERR      *p_err)
+{
+    CPU_BOOLEAN  rtn_val;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+#endif
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_CfgTxCork, p_err);   /* See Note #2b.                                        */
+    if (*p_err != NET_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+    rtn_val = NetSock_CfgTxCorkHandler(sock_id,                 /* ---------------- CFG SOCK TX CORK ------------------ */
+                                       cork_en,
+                                       p_err);
+
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+
+    return (rtn_val);
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                      NetSock_BlockGet()
+*                                       NetSock_CfgTxPaceRate()
 *
-* Description : Get the blocking mode configuration of the specified socket.
+* Description : (1) Configure socket's TCP connection transmit pacing rate :
 *
-* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to get option from.
+*                   (a) Acquire   network lock                                          See Note #2
+*                   (b) Configure socket's TCP connection transmit pacing rate          See Note #3
+*                   (c) Release   network lock
 *
-*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_SOCK_ERR_NONE       Operation was successful.
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to configure transmit pacing rate.
 *
-*                               ------------ RETURNED BY NetSock_IsUsed() ------------
-*                               See NetSock_IsUsed() for additional return error codes.
+*               rate_max    Desired value for socket transmit pacing rate :
 *
-* Return(s)   : NET_SOCK_BLOCK_SEL_NO_BLOCK : Socket is in none blocking mode.
-*               NET_SOCK_BLOCK_SEL_BLOCK    : Socket is in blocking mode.
-*               NET_SOCK_BLOCK_SEL_NONE     : Error in operation.
+*                               NET_TCP_TX_PACE_RATE_NONE       Socket transmit pacing disabled.
+*                               NET_TCP_TX_PACE_RATE_AUTO       Socket paced by its TCP connection's
+*                                                                   congestion window & round-trip time.
+*                               Any other value                 Maximum socket transmit pacing rate
+*                                                                   (in octets per second).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket transmit pacing rate successfully configured.
+*
+*                                                               -- RETURNED BY NetSock_CfgTxPaceRateHandler() : --
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*                               NET_SOCK_ERR_INVALID_PROTOCOL   Socket does NOT use TCP.
+*                               NET_SOCK_ERR_INVALID_TYPE       Socket is NOT a stream-type socket.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   socket transmit pacing rate successfully configured.
+*
+*               DEF_FAIL, otherwise.
 *
 * Caller(s)   : Application.
 *
 *               This function is a network protocol suite application programming interface (API) function
 *               & MAY be called by application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetSock_BlockGet() is called by application function(s) & ... :
+* Note(s)     : (2) NetSock_CfgTxPaceRate() is called by application function(s) & ... :
 *
 *                   (a) MUST NOT be called with the global network lock already acquired; ...
 *                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
@@ -7052,62 +9185,42 @@ exit_release:
 *
 *                   This is required since an application's network protocol suite API function access is
 *                   asynchronous to other network protocol tasks.
+*
+*               (3) See 'net_tcp.c  NetTCP_ConnCfgTxPaceRateHandler()  Note #3'.
 *********************************************************************************************************
 */
 
-CPU_INT08U  NetSock_BlockGet (NET_SOCK_ID   sock_id,
-                              NET_ERR      *p_err)
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+CPU_BOOLEAN  NetSock_CfgTxPaceRate (NET_SOCK_ID   sock_id,
+                                    CPU_INT32U    rate_max,
+                                    NET_ERR      *p_err)
 {
-    NET_SOCK     *p_sock;
-    CPU_BOOLEAN   is_no_block;
-    CPU_INT08U    block;
+    CPU_BOOLEAN  rtn_val;
 
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
                                                                 /* --------------- VALIDATE RTN ERR PTR --------------- */
-    if (p_err == DEF_NULL) {
+    if (p_err == (NET_ERR *)0) {
         CPU_SW_EXCEPTION(DEF_FAIL);
     }
 #endif
 
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
-    Net_GlobalLockAcquire((void *)&NetSock_CfgBlock, p_err);     /* See Note #2b.                                        */
+    Net_GlobalLockAcquire((void *)&NetSock_CfgTxPaceRate, p_err); /* See Note #2b.                                      */
     if (*p_err != NET_ERR_NONE) {
-         goto exit_lock_fault;
-    }
-
-
-#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* ---------------- VALIDATE SOCK USED ---------------- */
-   (void)NetSock_IsUsed(sock_id, p_err);
-    if (*p_err != NET_SOCK_ERR_NONE) {
-         block = NET_SOCK_BLOCK_SEL_NONE;
-         goto exit_release;
-    }
-#endif
-
-                                                                /* --------------- CFG SOCK BLOCK MODE ---------------- */
-    p_sock = &NetSock_Tbl[sock_id];
-
-    is_no_block = DEF_BIT_IS_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_NO_BLOCK);
-    if (is_no_block == DEF_YES) {
-        block = NET_SOCK_BLOCK_SEL_NO_BLOCK;
-    } else {
-        block = NET_SOCK_BLOCK_SEL_BLOCK;
+        return (DEF_FAIL);
     }
 
-   *p_err = NET_SOCK_ERR_NONE;
-    goto exit_release;
-
+    rtn_val = NetSock_CfgTxPaceRateHandler(                       sock_id,
+                                           (NET_TCP_TX_PACE_RATE)rate_max,
+                                           p_err);
 
-exit_lock_fault:
-    return (NET_SOCK_BLOCK_SEL_NONE);
-
-exit_release:
-                                                                  /* ----------------- RELEASE NET LOCK ----------------- */
-      Net_GlobalLockRelease();
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
 
-   return (block);
+    return (rtn_val);
 }
+#endif
 
 
 /*
@@ -7180,6 +9293,198 @@ CPU_BOOLEAN  NetSock_CfgIF (NET_SOCK_ID   sock_id,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetSock_CfgReusePort()
+*
+* Description : (1) Configure socket to share its local port with other sockets :
+*
+*                   (a) Acquire   network lock                                          See Note #2
+*                   (b) Configure socket local port sharing
+*                   (c) Release   network lock
+*
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to configure local port sharing.
+*
+*               reuse_port  Desired value for socket local port sharing :
+*
+*                               DEF_ENABLED                     Socket local port MAY     be shared.
+*                               DEF_DISABLED                    Socket local port MAY NOT be shared.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket local port sharing successfully configured.
+*
+*                                                               - RETURNED BY NetSock_CfgReusePortHandler() : -
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*                               NET_SOCK_ERR_INVALID_STATE      Invalid socket state.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   socket local port sharing successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetSock_CfgReusePort() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access is
+*                   asynchronous to other network protocol tasks.
+*
+*               (3) (a) Local port sharing MUST be configured BEFORE the socket is bound.  Sockets bound to
+*                       the same local address MUST ALL be configured to share their local port.
+*
+*                   (b) New connection requests & received datagrams are distributed across the sharing
+*                       sockets by a hash of the remote address so that each socket, &/or the task that
+*                       owns it, may accept & handle its own connections without waking the others (see
+*                       'net_conn.h  NETWORK CONNECTION FLAG DEFINES  Note #1').
+*
+*                   (c) Sharing sockets SHOULD be listening before connection requests are received; a
+*                       request distributed to a sharing socket that is NOT yet listening is refused.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN
+CPU_BOOLEAN  NetSock_CfgReusePort (NET_SOCK_ID   sock_id,
+                                   CPU_BOOLEAN   reuse_port,
+                                   NET_ERR      *p_err)
+{
+    CPU_BOOLEAN  rtn_val;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+#endif
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_CfgReusePort, p_err);/* See Note #2b.                                        */
+    if (*p_err != NET_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+    rtn_val = NetSock_CfgReusePortHandler(sock_id,              /* ------------- CFG SOCK LOCAL PORT SHARE ------------ */
+                                          reuse_port,
+                                          p_err);
+
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+
+    return (rtn_val);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetSock_CfgFastOpen()
+*
+* Description : (1) Configure socket's TCP Fast Open :
+*
+*                   (a) Acquire   network lock                                          See Note #2
+*                   (b) Configure socket TCP Fast Open
+*                   (c) Release   network lock
+*
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to configure TCP Fast Open.
+*
+*               fast_open   Desired value for socket TCP Fast Open :
+*
+*                               DEF_ENABLED                     Socket TCP Fast Open ENABLED.
+*                               DEF_DISABLED                    Socket TCP Fast Open DISABLED.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket TCP Fast Open successfully configured.
+*
+*                                                               - RETURNED BY NetSock_CfgFastOpenHandler() : -
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*                               NET_SOCK_ERR_INVALID_STATE      Invalid socket state.
+*                               NET_SOCK_ERR_INVALID_TYPE       Socket is NOT a stream-type socket.
+*                               NET_SOCK_ERR_INVALID_PROTOCOL   Socket does NOT use TCP.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   socket TCP Fast Open successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetSock_CfgFastOpen() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access is
+*                   asynchronous to other network protocol tasks.
+*
+*               (3) (a) TCP Fast Open MUST be configured BEFORE the socket connects or listens; the setting
+*                       is applied to the socket's TCP connection when the connection is opened.
+*
+*                   (b) A listening socket with TCP Fast Open enabled issues cookies to requesting clients &
+*                       accepts data carried on connection requests that present a valid cookie (see
+*                       'net_tcp.c  NetTCP_RxPktConnHandlerListen()  Note #10').
+*
+*                   (c) A client socket with TCP Fast Open enabled MAY carry data on its connection request
+*                       when data is transmitted on the CLOSED socket with a remote address (see
+*                       'NetSock_TxDataHandler()  Note #9').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+CPU_BOOLEAN  NetSock_CfgFastOpen (NET_SOCK_ID   sock_id,
+                                  CPU_BOOLEAN   fast_open,
+                                  NET_ERR      *p_err)
+{
+    CPU_BOOLEAN  rtn_val;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+#endif
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_CfgFastOpen, p_err); /* See Note #2b.                                        */
+    if (*p_err != NET_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+    rtn_val = NetSock_CfgFastOpenHandler(sock_id,               /* --------------- CFG SOCK TCP FAST OPEN ------------- */
+                                         fast_open,
+                                         p_err);
+
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+
+    return (rtn_val);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         NetSock_CfgSecure()
@@ -8141,6 +10446,20 @@ exit:
 *                       NET_SOCK_OPT_TCP_KEEP_IDLE      NET_TCP_TIMEOUT_SEC   TCP keep alive timeout       value (in seconds)
 *                       NET_SOCK_OPT_TCP_KEEP_INTVL     NET_TCP_TIMEOUT_SEC   TCP keep alive probe re-transmit timeout
 *                                                                                                          value (in seconds)
+*
+*                       NET_SOCK_OPT_TCP_CORK           CPU_BOOLEAN           TCP connection transmit cork status:
+*                                                                                 DEF_ENABLED
+*                                                                                 DEF_DISABLED
+*
+*                       NET_SOCK_OPT_TCP_MAX_PACING_RATE
+*                                                       NET_TCP_TX_PACE_RATE  TCP connection transmit pacing rate
+*                                                                                 (in octets per second):
+*                                                                                 NET_TCP_TX_PACE_RATE_NONE
+*                                                                                 NET_TCP_TX_PACE_RATE_AUTO
+*
+*                       NET_SOCK_OPT_TCP_FAST_OPEN      CPU_BOOLEAN           Socket TCP Fast Open status:
+*                                                                             DEF_ENABLED
+*                                                                             DEF_DISABLED
 *********************************************************************************************************
 */
 
@@ -8165,6 +10484,9 @@ NET_SOCK_RTN_CODE  NetSock_OptGet (NET_SOCK_ID         sock_id,
    NET_CONN_ID         conn_id_tcp;
    NET_TCP_CONN       *p_conn;
    CPU_BOOLEAN         is_used;
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+   CPU_BOOLEAN         fast_open;
 #endif
    NET_SOCK_RTN_CODE   rtn_code;
    NET_IF_NBR          if_nbr;
@@ -8204,6 +10526,15 @@ NET_SOCK_RTN_CODE  NetSock_OptGet (NET_SOCK_ID         sock_id,
        case NET_SOCK_OPT_TCP_KEEP_CNT:
        case NET_SOCK_OPT_TCP_KEEP_IDLE:
        case NET_SOCK_OPT_TCP_KEEP_INTVL:
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+       case NET_SOCK_OPT_TCP_CORK:
+#endif
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+       case NET_SOCK_OPT_TCP_MAX_PACING_RATE:
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+       case NET_SOCK_OPT_TCP_FAST_OPEN:
+#endif
             if (level != NET_SOCK_PROTOCOL_TCP) {
                *p_err =  NET_SOCK_ERR_INVALID_OPT_LEVEL;
                 goto exit_lock_fault;                           /* Sock opt incompatible with protocol level.           */
@@ -8345,15 +10676,58 @@ NET_SOCK_RTN_CODE  NetSock_OptGet (NET_SOCK_ID         sock_id,
             }
 
             Mem_Copy(             p_opt_val,
-                     (void     *)&if_nbr,
+                     (void     *)&if_nbr,
+                     (CPU_SIZE_T)*p_opt_len);
+
+           *p_err = NET_SOCK_ERR_NONE;
+            break;
+
+#ifdef  NET_TCP_MODULE_EN
+       case NET_SOCK_OPT_TCP_NO_DELAY:                          /* ---------------- TCP-LEVEL OPTIONS ----------------- */
+            if (*p_opt_len < (CPU_INT32S)sizeof(CPU_BOOLEAN)) {
+                *p_err = NET_SOCK_ERR_INVALID_OPT_LEN;
+                 goto exit_err_opt_get;
+            }
+
+            if (!is_used) {
+                goto exit_err_opt_get;
+            }
+            p_conn    = &NetTCP_ConnTbl[conn_id_tcp];
+           *p_opt_len =  sizeof(CPU_BOOLEAN);
+
+            Mem_Copy(             p_opt_val,
+                     (void     *)&p_conn->TxWinSizeNagleEn,
+                     (CPU_SIZE_T)*p_opt_len);
+
+           *p_err = NET_SOCK_ERR_NONE;
+            break;
+
+
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+       case NET_SOCK_OPT_TCP_CORK:
+            if (*p_opt_len < (CPU_INT32S)sizeof(CPU_BOOLEAN)) {
+                *p_err = NET_SOCK_ERR_INVALID_OPT_LEN;
+                 goto exit_err_opt_get;
+            }
+
+            if (!is_used) {
+                goto exit_err_opt_get;
+            }
+            p_conn    = &NetTCP_ConnTbl[conn_id_tcp];
+           *p_opt_len =  sizeof(CPU_BOOLEAN);
+
+            Mem_Copy(             p_opt_val,
+                     (void     *)&p_conn->TxCorkEn,
                      (CPU_SIZE_T)*p_opt_len);
 
            *p_err = NET_SOCK_ERR_NONE;
             break;
+#endif
 
-#ifdef  NET_TCP_MODULE_EN
-       case NET_SOCK_OPT_TCP_NO_DELAY:                          /* ---------------- TCP-LEVEL OPTIONS ----------------- */
-            if (*p_opt_len < (CPU_INT32S)sizeof(CPU_BOOLEAN)) {
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+       case NET_SOCK_OPT_TCP_MAX_PACING_RATE:
+            if (*p_opt_len < (CPU_INT32S)sizeof(NET_TCP_TX_PACE_RATE)) {
                 *p_err = NET_SOCK_ERR_INVALID_OPT_LEN;
                  goto exit_err_opt_get;
             }
@@ -8362,14 +10736,34 @@ NET_SOCK_RTN_CODE  NetSock_OptGet (NET_SOCK_ID         sock_id,
                 goto exit_err_opt_get;
             }
             p_conn    = &NetTCP_ConnTbl[conn_id_tcp];
-           *p_opt_len =  sizeof(CPU_BOOLEAN);
+           *p_opt_len =  sizeof(NET_TCP_TX_PACE_RATE);
 
             Mem_Copy(             p_opt_val,
-                     (void     *)&p_conn->TxWinSizeNagleEn,
+                     (void     *)&p_conn->TxPaceRateCfgd,
+                     (CPU_SIZE_T)*p_opt_len);
+
+           *p_err = NET_SOCK_ERR_NONE;
+            break;
+#endif
+
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+       case NET_SOCK_OPT_TCP_FAST_OPEN:                         /* Cfg'd on sock, NOT on TCP conn ...                   */
+            if (*p_opt_len < (CPU_INT32S)sizeof(CPU_BOOLEAN)) {
+                *p_err = NET_SOCK_ERR_INVALID_OPT_LEN;
+                 goto exit_err_opt_get;
+            }
+
+           *p_opt_len =  sizeof(CPU_BOOLEAN);
+            fast_open = (DEF_BIT_IS_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_FAST_OPEN)) ? DEF_ENABLED
+                                                                                        : DEF_DISABLED;
+            Mem_Copy(             p_opt_val,                    /* ... since conn MAY NOT yet be opened.                */
+                     (void     *)&fast_open,
                      (CPU_SIZE_T)*p_opt_len);
 
            *p_err = NET_SOCK_ERR_NONE;
             break;
+#endif
 
 
        case NET_SOCK_OPT_TCP_KEEP_CNT:
@@ -14023,6 +16417,10 @@ exit_release:
 *
 *                           See 'net_sock.c  Note #1d1'.
 *
+*                   (c) However, sockets configured to share their local port (SO_REUSEPORT) MAY bind the
+*                       same local address as other half connections also configured to share their local
+*                       port (see 'NetSock_CfgReusePort()  Note #3').
+*
 *                   See also 'NetSock_ConnHandlerAddrRemoteValidate()  Note #5'.
 *********************************************************************************************************
 */
@@ -14408,6 +16806,13 @@ static  NET_SOCK_RTN_CODE  NetSock_BindHandler (NET_SOCK_ID         sock_id,
              if (p_addr_remote != (CPU_INT08U *)0) {             /* ... but remote addr avail (see Note #8b2), ...       */
                  break;                                         /* ... allow valid bind.                                */
              }
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN
+                                                                /* If both socks share local port (see Note #8c), ...   */
+             if ((DEF_BIT_IS_SET(p_sock->Flags,                  NET_SOCK_FLAG_SOCK_REUSE_PORT) == DEF_YES) &&
+                 (DEF_BIT_IS_SET(NetConn_Tbl[conn_id_srch].Flags, NET_CONN_FLAG_REUSE_PORT)     == DEF_YES)) {
+                 break;                                         /* ... allow valid bind.                                */
+             }
+#endif
                                                                 /* 'break' intentionally omitted; MUST execute the ...  */
                                                                 /* ... following case : 'NET_CONN_ERR_CONN_FULL'.       */
 
@@ -14470,6 +16875,14 @@ static  NET_SOCK_RTN_CODE  NetSock_BindHandler (NET_SOCK_ID         sock_id,
         return (NET_SOCK_BSD_ERR_BIND);
     }
 
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN                           /* Mark sock conn's local port shared (see Note #8c).   */
+    if (DEF_BIT_IS_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_REUSE_PORT) == DEF_YES) {
+        DEF_BIT_SET(NetConn_Tbl[conn_id].Flags, NET_CONN_FLAG_REUSE_PORT);
+    } else {
+        DEF_BIT_CLR(NetConn_Tbl[conn_id].Flags, NET_CONN_FLAG_REUSE_PORT);
+    }
+#endif
+
     NetConn_ListAdd(conn_id, &err);                             /* Add    sock conn into conn list (see Note #8b).      */
     if (err != NET_CONN_ERR_NONE) {
         NetSock_CloseSock(p_sock, DEF_YES, DEF_YES);
@@ -14640,7 +17053,7 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerDatagram (NET_SOCK_ID     sock_id,
 *                   (b) Prepare  socket connection address(s)
 *                   (c) Initiate transport layer connection :
 *                       (1) Get      transport connection
-*                       (2) Transmit transport connection request
+*                       (2) Transmit transport connection request                       See Note #5
 *                       (3) Wait on  transport connection to connect
 *
 *
@@ -14653,6 +17066,14 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerDatagram (NET_SOCK_ID     sock_id,
 *               p_addr_remote    Pointer to socket address structure.
 *               -------------    Argument checked   in NetSock_Conn().
 *
+*               p_data           Pointer to application data to transmit with the connection request, if any
+*                                    (see Note #5).
+*
+*               data_len         Length  of application data to transmit with the connection request (in octets).
+*
+*               p_data_len_txd   Pointer to variable that will receive the number of application data octets
+*                                    transmitted with the connection request, if NOT NULL.
+*
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_SOCK_ERR_NONE                   Socket successfully connected.
@@ -14700,7 +17121,8 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerDatagram (NET_SOCK_ID     sock_id,
 *
 *               NET_SOCK_BSD_ERR_CONN, otherwise.
 *
-* Caller(s)   : NetSock_Conn().
+* Caller(s)   : NetSock_Conn(),
+*               NetSock_TxDataHandler().
 *
 * Note(s)     : (2) (a) For stream-type sockets, the remote address MUST be static.  In other words,
 *                       a stream-type socket MUST be connected to & use the same remote address for
@@ -14733,6 +17155,15 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerDatagram (NET_SOCK_ID     sock_id,
 *                   See also  Note #1a,
 *                            'NetSock_SelDescHandlerWrStream()   Note #3',
 *                          & 'NetSock_SelDescHandlerErrStream()  Note #3'.
+*
+*               (5) (a) If TCP Fast Open is configured on the socket, it is applied to the transport
+*                       connection before the connection request is transmitted (see 'NetSock_CfgFastOpen()
+*                       Note #3').
+*
+*                   (b) Application data is ONLY transmitted with the connection request if the TCP
+*                       connection holds a cached Fast Open cookie for the remote host; otherwise NO data
+*                       is transmitted & the caller MUST transmit the data once connected (see 'net_tcp.c
+*                       NetTCP_TxConnReq()  Note #3').
 *********************************************************************************************************
 */
 
@@ -14740,6 +17171,9 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerDatagram (NET_SOCK_ID     sock_id,
 static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerStream (NET_SOCK_ID     sock_id,
                                                       NET_SOCK       *p_sock,
                                                       NET_SOCK_ADDR  *p_addr_remote,
+                                                      void           *p_data,
+                                                      CPU_INT16U      data_len,
+                                                      CPU_INT16U     *p_data_len_txd,
                                                       NET_ERR        *p_err)
 {
 #ifdef  NET_IPv4_MODULE_EN
@@ -14756,10 +17190,15 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerStream (NET_SOCK_ID     sock_id,
     CPU_BOOLEAN        addr_remote_validate;
     NET_CONN_ID        conn_id;
     NET_CONN_ID        conn_id_transport;
+    CPU_INT16U         data_len_txd;
     NET_SOCK_RTN_CODE  rtn_code;
     NET_ERR            err;
 
 
+    if (p_data_len_txd != (CPU_INT16U *)0) {
+       *p_data_len_txd  = 0u;
+    }
+
                                                                 /* ------------- VALIDATE SOCK CONN STATE ------------- */
     switch (p_sock->State) {
         case NET_SOCK_STATE_FREE:
@@ -14905,13 +17344,24 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerStream (NET_SOCK_ID     sock_id,
         }
     }
 
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    if (DEF_BIT_IS_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_FAST_OPEN) == DEF_YES) {
+       (void)NetTCP_ConnCfgFastOpenEnHandler(conn_id_transport, DEF_ENABLED, p_err);
+        if (*p_err != NET_TCP_ERR_NONE) {                       /* See Note #5a.                                        */
+             NetSock_CloseSock(p_sock, DEF_YES, DEF_YES);
+             return (NET_SOCK_BSD_ERR_CONN);
+        }
+    }
+#endif
+
 
                                                                 /* --------------- INIT TRANSPORT CONN ---------------- */
+    data_len_txd = 0u;
 #ifdef  NET_TCP_MODULE_EN
     switch (p_addr_remote->AddrFamily) {
 #ifdef  NET_IPv4_MODULE_EN
         case NET_SOCK_ADDR_FAMILY_IP_V4:
-             NetTCP_TxConnReq(conn_id_transport, &err);
+             data_len_txd = NetTCP_TxConnReq(conn_id_transport, p_data, data_len, &err);
              switch (err) {
                  case NET_TCP_ERR_NONE:
                      *p_err = NET_SOCK_ERR_NONE;
@@ -14944,7 +17394,7 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerStream (NET_SOCK_ID     sock_id,
 
 #ifdef  NET_IPv6_MODULE_EN
         case NET_SOCK_ADDR_FAMILY_IP_V6:
-             NetTCP_TxConnReq(conn_id_transport, &err);
+             data_len_txd = NetTCP_TxConnReq(conn_id_transport, p_data, data_len, &err);
              switch (err) {
                  case NET_TCP_ERR_NONE:
                      *p_err = NET_SOCK_ERR_NONE;
@@ -14981,6 +17431,8 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerStream (NET_SOCK_ID     sock_id,
         }
 #else
         (void)&conn_id_transport;                               /* Prevent 'variable unused' compiler warning.          */
+        (void)&p_data;
+        (void)&data_len;
         *p_err =  NET_ERR_TX;
 #endif
 
@@ -15003,6 +17455,11 @@ static  NET_SOCK_RTN_CODE  NetSock_ConnHandlerStream (NET_SOCK_ID     sock_id,
 
 
 
+    if (p_data_len_txd != (CPU_INT16U *)0) {                    /* Rtn nbr of octets txd with conn req (see Note #5b).  */
+       *p_data_len_txd  = data_len_txd;
+    }
+
+
                                                                 /* -------------- WAIT ON TRANSPORT CONN -------------- */
     rtn_code = NetSock_ConnHandlerStreamWait(sock_id, p_sock, p_err);
 
@@ -15177,6 +17634,7 @@ exit_release:
 *                   (b) Prepare  socket for remote connection :
 *                       (1) Bind to local address, if necessary
 *                   (c) Add remote address into socket connection
+*                   (d) Check TCP time-wait connections                             See Note #2
 *
 *
 * Argument(s) : sock_id         Socket descriptor/handle identifier of socket to connect.
@@ -15211,6 +17669,10 @@ exit_release:
 *                                                                   - RETURNED BY NetSock_ConnHandlerAddrRemoteValidate() : -
 *                               NET_SOCK_ERR_CONN_IN_USE            Socket connection already in use.
 *
+*                                                                   --- RETURNED BY NetSock_ConnHandlerAddrTimeWait() : ----
+*                               NET_SOCK_ERR_CONN_IN_USE            Socket connection held by TCP time-wait
+*                                                                       connection.
+*
 *                                                                   --- RETURNED BY NetSock_ConnHandlerAddrLocalBind() : ----
 *                               NET_ERR_FAULT_NULL_PTR               Argument(s) passed a NULL pointer.
 *                               NET_SOCK_ERR_NOT_USED               Socket NOT currently used.
@@ -15247,7 +17709,14 @@ exit_release:
 * Caller(s)   : NetSock_ConnHandlerDatagram(),
 *               NetSock_ConnHandlerStream().
 *
-* Note(s)     : none.
+* Note(s)     : (2) (a) A compacted TCP TIME-WAIT connection is NOT held by ANY network connection & is
+*                       thus NOT found by any connection address search.  Therefore, a TCP socket's local
+*                       & remote addresses MUST also be searched in the TCP time-wait table so that they
+*                       are NOT re-used within 2MSL (see 'net_tcp.h  TCP TIME-WAIT DEFINES  Note #4').
+*
+*                   (b) If the socket was bound to a random local port by this connection request,
+*                       another random local port is selected; otherwise, the connection request fails
+*                       but the socket is NOT closed.
 *********************************************************************************************************
 */
 
@@ -15258,6 +17727,10 @@ static  void  NetSock_ConnHandlerAddr (NET_SOCK_ID     sock_id,
                                        CPU_BOOLEAN     addr_over_wr,
                                        NET_ERR        *p_err)
 {
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+    CPU_BOOLEAN  port_random;
+#endif
+
 
                                                                 /* ---------- VALIDATE SOCK CONN REMOTE ADDR ---------- */
     if (addr_validate == DEF_YES) {
@@ -15268,11 +17741,17 @@ static  void  NetSock_ConnHandlerAddr (NET_SOCK_ID     sock_id,
     }
 
                                                                 /* ----------- PREPARE SOCK FOR REMOTE CONN ----------- */
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+    port_random = DEF_NO;
+#endif
     if (p_sock->State == NET_SOCK_STATE_CLOSED) {                /* If sock closed, bind to local addr.                  */
         NetSock_ConnHandlerAddrLocalBind(sock_id, p_addr_remote, p_err);
         if (*p_err != NET_SOCK_ERR_NONE) {
              return;
         }
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+        port_random = DEF_YES;                                  /* Local port sel'd by stack (see Note #2b).            */
+#endif
     }
                                                                 /* ----------- ADD REMOTE ADDR TO SOCK CONN ----------- */
                                                                 /* Set sock's remote addr.                              */
@@ -15281,6 +17760,15 @@ static  void  NetSock_ConnHandlerAddr (NET_SOCK_ID     sock_id,
          return;
     }
 
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN                             /* ------------ CHK TCP TIME-WAIT CONNS ------------- */
+    if (p_sock->Protocol == NET_SOCK_PROTOCOL_TCP) {            /* See Note #2.                                         */
+        NetSock_ConnHandlerAddrTimeWait(p_sock, port_random, p_err);
+        if (*p_err != NET_SOCK_ERR_NONE) {
+             return;
+        }
+    }
+#endif
+
 
    *p_err = NET_SOCK_ERR_NONE;
 }
@@ -15810,6 +18298,154 @@ static  void  NetSock_ConnHandlerAddrRemoteSet (NET_SOCK       *p_sock,
 }
 
 
+/*
+*********************************************************************************************************
+*                                  NetSock_ConnHandlerAddrTimeWait()
+*
+* Description : (1) Check a connecting TCP socket's addresses against the TCP time-wait connections :
+*
+*                   (a) Search TCP time-wait connections for socket's local & remote addresses
+*                   (b) Select another random local port, if allowed                See Note #2
+*
+*
+* Argument(s) : p_sock          Pointer to socket.
+*               ------          Argument validated in NetSock_Conn().
+*
+*               port_random     Indicate whether socket's local port was randomly selected :
+*
+*                                   DEF_NO                      Local port configured by application.
+*                                   DEF_YES                     Local port randomly selected.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE                   Socket addresses NOT held by ANY TCP
+*                                                                       time-wait connection.
+*                               NET_SOCK_ERR_CONN_IN_USE            Socket connection held by TCP time-wait
+*                                                                       connection.
+*                               NET_SOCK_ERR_INVALID_FAMILY         Invalid socket protocol/address family.
+*                               NET_SOCK_ERR_CONN_FAIL              Socket connection operation(s) failed.
+*
+*                                                                   -- RETURNED BY NetConn_AddrLocalGet() : --
+*                               NET_ERR_FAULT_NULL_FNCT               Argument(s) passed a NULL pointer.
+*                               NET_CONN_ERR_NOT_USED               Network connection NOT currently used.
+*                               NET_CONN_ERR_INVALID_CONN           Invalid network connection number.
+*                               NET_CONN_ERR_INVALID_ADDR_LEN       Invalid network connection address length.
+*                               NET_CONN_ERR_ADDR_NOT_USED          Network connection address NOT in use.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetSock_ConnHandlerAddr().
+*
+* Note(s)     : (2) (a) A randomly selected local port is replaced by another random local port, at most
+*                       NET_SOCK_CONN_TIME_WAIT_RETRY_MAX times.  The socket connection is re-inserted
+*                       into the connection list for its new local address (see 'NetSock_BindHandler()
+*                       Note #8b').
+*
+*                   (b) A local port configured by the application is NEVER replaced.
+*
+*               (3) Socket connection addresses MUST be maintained in network-order.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  void  NetSock_ConnHandlerAddrTimeWait (NET_SOCK     *p_sock,
+                                               CPU_BOOLEAN   port_random,
+                                               NET_ERR      *p_err)
+{
+    CPU_INT08U          addr_local[NET_SOCK_ADDR_LEN_MAX];
+    NET_CONN_ADDR_LEN   addr_local_len;
+    NET_CONN_ID         conn_id;
+    NET_IF_NBR          if_nbr;
+    NET_PROTOCOL_TYPE   protocol;
+    NET_PORT_NBR        port_nbr_host;
+    NET_PORT_NBR        port_nbr_net;
+    CPU_INT08U          retry_cnt;
+    CPU_BOOLEAN         time_wait;
+    NET_ERR             err;
+
+
+    switch (p_sock->ProtocolFamily) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_SOCK_PROTOCOL_FAMILY_IP_V4:
+             protocol = NET_PROTOCOL_TYPE_TCP_V4;
+             break;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_SOCK_PROTOCOL_FAMILY_IP_V6:
+             protocol = NET_PROTOCOL_TYPE_TCP_V6;
+             break;
+#endif
+
+        default:
+             NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidFamilyCtr);
+            *p_err = NET_SOCK_ERR_INVALID_FAMILY;
+             return;
+    }
+
+    conn_id   = p_sock->ID_Conn;
+    retry_cnt = 0u;
+                                                                /* ------------ SRCH TCP TIME-WAIT CONNS ------------- */
+    time_wait = NetTCP_ConnTimeWaitIsUsed(conn_id);
+    while (time_wait == DEF_YES) {
+                                                                /* If local port cfg'd by app (see Note #2b) ...        */
+        if ((port_random != DEF_YES) ||                         /* ... or random port retries exhausted,     ...        */
+            (retry_cnt   >= NET_SOCK_CONN_TIME_WAIT_RETRY_MAX)) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidConnInUseCtr);
+           *p_err = NET_SOCK_ERR_CONN_IN_USE;                   /* ... rtn err.                                         */
+            return;
+        }
+                                                                /* ------------ SEL NEW RANDOM LOCAL PORT ------------- */
+        port_nbr_host = NetSock_RandomPortNbrGet(protocol, p_err);
+        if (*p_err != NET_SOCK_ERR_NONE) {
+             return;
+        }
+        port_nbr_net  = NET_UTIL_HOST_TO_NET_16(port_nbr_host);
+
+        addr_local_len = sizeof(addr_local);
+        NetConn_AddrLocalGet(conn_id, &addr_local[0], &addr_local_len, p_err);
+        if (*p_err != NET_CONN_ERR_NONE) {
+             return;
+        }
+                                                                /* Set new port in local addr (see Note #3).            */
+        NET_UTIL_VAL_COPY_16(&addr_local[NET_SOCK_ADDR_IP_IX_PORT], &port_nbr_net);
+
+        if_nbr = NetConn_IF_NbrGet(conn_id, &err);
+        if (err != NET_CONN_ERR_NONE) {
+           *p_err = NET_SOCK_ERR_CONN_FAIL;
+            return;
+        }
+
+        NetConn_ListUnlink(conn_id, &err);                      /* Re-insert sock conn into conn list (see Note #2a).   */
+        if (err != NET_CONN_ERR_NONE) {
+            NetSock_CloseSock(p_sock, DEF_YES, DEF_YES);
+           *p_err = NET_SOCK_ERR_CONN_FAIL;
+            return;
+        }
+
+        NetConn_AddrLocalSet(conn_id, if_nbr, &addr_local[0], addr_local_len, DEF_YES, &err);
+        if (err != NET_CONN_ERR_NONE) {
+            NetSock_CloseSock(p_sock, DEF_YES, DEF_YES);
+           *p_err = NET_SOCK_ERR_CONN_FAIL;
+            return;
+        }
+
+        NetConn_ListAdd(conn_id, &err);
+        if (err != NET_CONN_ERR_NONE) {
+            NetSock_CloseSock(p_sock, DEF_YES, DEF_YES);
+           *p_err = NET_SOCK_ERR_CONN_FAIL;
+            return;
+        }
+
+        retry_cnt++;
+        time_wait = NetTCP_ConnTimeWaitIsUsed(conn_id);
+    }
+
+
+   *p_err = NET_SOCK_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                     NetSock_ConnAcceptQ_Init()
@@ -16369,6 +19005,91 @@ static  CPU_BOOLEAN  NetSock_ConnAcceptQ_ConnID_Remove (NET_SOCK     *p_sock,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                       NetSock_DataVecLenGet()
+*
+* Description : Validate a socket data vector & get its total data length.
+*
+*
+* Argument(s) : p_vec       Pointer to an array of data vector elements.
+*
+*               vec_nbr     Number of data vector elements.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE                   Data vector successfully validated.
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_vec' or a data vector element's
+*                                                                       data pointer passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_ARG            Invalid number of data vector elements.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Data vector total length is zero or greater
+*                                                                       than the maximum socket data length
+*                                                                       (see Note #1).
+*
+* Return(s)   : Data vector total length (in octets), if NO error(s).
+*
+*               0,                                    otherwise.
+*
+* Caller(s)   : NetSock_RxDataVec(),
+*               NetSock_TxDataVec().
+*
+* Note(s)     : (1) Socket transmit & receive lengths are limited to 16-bit values; a data vector whose
+*                   total length exceeds DEF_INT_16U_MAX_VAL is rejected rather than silently truncated.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NetSock_DataVecLenGet (NET_SOCK_DATA_VEC  *p_vec,
+                                           CPU_INT16U          vec_nbr,
+                                           NET_ERR            *p_err)
+{
+    CPU_INT32U  data_len;
+    CPU_INT16U  vec_ix;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_vec == (NET_SOCK_DATA_VEC *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (0u);
+    }
+#endif
+    if ((vec_nbr < 1u) ||
+        (vec_nbr > NET_SOCK_CFG_DATA_VEC_NBR_MAX)) {
+       *p_err =  NET_SOCK_ERR_INVALID_ARG;
+        return (0u);
+    }
+
+    data_len = 0u;
+    for (vec_ix = 0u; vec_ix < vec_nbr; vec_ix++) {
+        if (p_vec[vec_ix].DataLen < 1u) {                       /* Skip empty vec elems.                                */
+            continue;
+        }
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+        if (p_vec[vec_ix].DataPtr == (void *)0) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+           *p_err =  NET_ERR_FAULT_NULL_PTR;
+            return (0u);
+        }
+#endif
+        data_len += p_vec[vec_ix].DataLen;
+    }
+
+    if (data_len < 1u) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullSizeCtr);
+       *p_err =  NET_SOCK_ERR_INVALID_DATA_SIZE;
+        return (0u);
+    }
+    if (data_len > DEF_INT_16U_MAX_VAL) {                       /* See Note #1.                                         */
+       *p_err =  NET_SOCK_ERR_INVALID_DATA_SIZE;
+        return (0u);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return ((CPU_INT16U)data_len);
+}
+
+
 /*
 *********************************************************************************************************
 *                                       NetSock_RxDataHandler()
@@ -16399,6 +19120,11 @@ static  CPU_BOOLEAN  NetSock_ConnAcceptQ_ConnID_Remove (NET_SOCK     *p_sock,
 *                                                                           queue(s).
 *                                       NET_SOCK_FLAG_RX_NO_BLOCK       Receive socket data without blocking.
 *
+*               data_vec            Indicate whether 'p_data_buf' points to a data vector cursor (see Note #11) :
+*
+*                                       DEF_YES                         'p_data_buf' points to a data vector cursor.
+*                                       DEF_NO                          'p_data_buf' points to an application buffer.
+*
 *               p_addr_remote       Pointer to an address buffer that will receive the socket address structure
 *               -------------           with the received data's remote address (see Note #4), if NO error(s).
 *
@@ -16585,13 +19311,34 @@ static  CPU_BOOLEAN  NetSock_ConnAcceptQ_ConnID_Remove (NET_SOCK     *p_sock,
 *                   included as an extra precaution in case 'SockType' is incorrectly modified.
 *
 *              (10) IP options arguments may NOT be necessary (remove if unnecessary).
+*
+*              (11) (a) Vectored receives pass a data vector cursor as 'p_data_buf' & the data vector's total
+*                       length as 'data_buf_len'; the transport layer scatters received data directly into the
+*                       data vector (see 'net_buf.h  NETWORK BUFFER DATA VECTOR DATA TYPES').
+*
+*                       The internal NET_SOCK_FLAG_DATA_VEC flag is set ONLY after the application receive
+*                       flags are validated, so applications can NOT request it directly.
+*
+*                   (b) Secure sockets decrypt into contiguous buffers & do NOT support vectored receives.
+*
+*              (12) (a) Datagrams are at most 65535 octets; a larger datagram receive buffer length is limited
+*                       to 65535 octets without truncating any datagram.
+*
+*                   (b) Stream-type receive buffers larger than 65535 octets are filled in successive receives
+*                       of at most 65535 octets each.  Only the first receive MAY block; remaining receives
+*                       return ONLY data already queued on the socket.  Data peeked with NET_SOCK_FLAG_RX_DATA_PEEK
+*                       is NOT consumed & is thus limited to a single 65535-octet receive.
+*
+*                   (c) If any data is received, the total received data length is returned even if a
+*                       later chunked receive fails or finds the receive queue empty.
 *********************************************************************************************************
 */
 
 static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
                                                   void                *p_data_buf,
-                                                  CPU_INT16U           data_buf_len,
+                                                  CPU_INT32U           data_buf_len,
                                                   NET_SOCK_API_FLAGS   flags,
+                                                  CPU_BOOLEAN          data_vec,
                                                   NET_SOCK_ADDR       *p_addr_remote,
                                                   NET_SOCK_ADDR_LEN   *p_addr_len,
                                                   void                *p_ip_opts_buf,
@@ -16604,6 +19351,11 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
 #endif
 #ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
     CPU_BOOLEAN         secure;
+    CPU_INT08U         *p_data_rx;
+    CPU_INT32U          data_len_rem;
+    CPU_INT16U          data_len_rx;
+    NET_SOCK_RTN_CODE   data_len_tot;
+    NET_SOCK_API_FLAGS  flags_rx;
 #endif
     NET_SOCK           *p_sock;
     NET_SOCK_RTN_CODE   rtn_code;
@@ -16635,6 +19387,9 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
     }
 #endif
 
+    if (data_vec == DEF_YES) {                                  /* See Note #11a.                                       */
+        DEF_BIT_SET(flags, NET_SOCK_FLAG_DATA_VEC);
+    }
 
 
 
@@ -16650,11 +19405,11 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
     p_sock = &NetSock_Tbl[sock_id];
 
     switch (p_sock->SockType) {
-        case NET_SOCK_TYPE_DATAGRAM:
+        case NET_SOCK_TYPE_DATAGRAM:                            /* Lim buf len to max datagram len (see Note #12a).     */
              rtn_code = NetSock_RxDataHandlerDatagram((NET_SOCK_ID        )sock_id,
                                                       (NET_SOCK          *)p_sock,
                                                       (void              *)p_data_buf,
-                                                      (CPU_INT16U         )data_buf_len,
+                                                      (CPU_INT16U         )DEF_MIN(data_buf_len, DEF_INT_16U_MAX_VAL),
                                                       (NET_SOCK_API_FLAGS )flags,
                                                       (NET_SOCK_ADDR     *)p_addr_remote,
                                                       (NET_SOCK_ADDR_LEN *)p_addr_len,
@@ -16673,20 +19428,49 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
              secure = DEF_NO;
 #endif
              if (secure  != DEF_YES) {
-                 rtn_code = NetSock_RxDataHandlerStream((NET_SOCK_ID        )sock_id,
-                                                        (NET_SOCK          *)p_sock,
-                                                        (void              *)p_data_buf,
-                                                        (CPU_INT16U         )data_buf_len,
-                                                        (NET_SOCK_API_FLAGS )flags,
-                                                        (NET_SOCK_ADDR     *)p_addr_remote,
-                                                        (NET_SOCK_ADDR_LEN *)p_addr_len,
-                                                        (NET_ERR           *)p_err);
+                 p_data_rx    = (CPU_INT08U *)p_data_buf;
+                 data_len_rem =  data_buf_len;
+                 data_len_tot =  0;
+                 flags_rx     =  flags;
+
+                 do {                                           /* Rx data in 16-bit len chunks (see Note #12b).        */
+                     data_len_rx = (CPU_INT16U)DEF_MIN(data_len_rem, DEF_INT_16U_MAX_VAL);
+                     rtn_code    =  NetSock_RxDataHandlerStream((NET_SOCK_ID        )sock_id,
+                                                                (NET_SOCK          *)p_sock,
+                                                                (void              *)p_data_rx,
+                                                                (CPU_INT16U         )data_len_rx,
+                                                                (NET_SOCK_API_FLAGS )flags_rx,
+                                                                (NET_SOCK_ADDR     *)p_addr_remote,
+                                                                (NET_SOCK_ADDR_LEN *)p_addr_len,
+                                                                (NET_ERR           *)p_err);
+                     if (rtn_code < 1) {
+                         break;
+                     }
+
+                     data_len_tot += rtn_code;
+                     data_len_rem -= (CPU_INT32U)rtn_code;
+                     p_data_rx    += rtn_code;
+                                                                /* Rx rem'ing chunks ONLY from q'd data.                */
+                     DEF_BIT_SET(flags_rx, NET_SOCK_FLAG_RX_NO_BLOCK);
+
+                 } while ((data_len_rem >  0u)                                          &&
+                          (rtn_code     == (NET_SOCK_RTN_CODE)data_len_rx)              &&
+                          (DEF_BIT_IS_CLR(flags, NET_SOCK_FLAG_RX_DATA_PEEK) == DEF_YES));
+
+                 if (data_len_tot > 0) {                        /* Rtn data rx'd, if any (see Note #12c).               */
+                    *p_err    = NET_SOCK_ERR_NONE;
+                     rtn_code = data_len_tot;
+                 }
              }
-#ifdef  NET_SECURE_MODULE_EN                                    /* If sock secure, rx data via secure handler.          */
-               else {
+#ifdef  NET_SECURE_MODULE_EN
+               else if (data_vec == DEF_YES) {                  /* See Note #11b.                                       */
+                *p_err    = NET_SOCK_ERR_INVALID_OP;
+                 rtn_code = NET_SOCK_BSD_ERR_RX;
+
+             } else {                                           /* If sock secure, rx data via secure handler.          */
                  rtn_code = NetSecure_SockRxDataHandler((NET_SOCK *)p_sock,
                                                         (void     *)p_data_buf,
-                                                        (CPU_INT16U)data_buf_len,
+                                                        (CPU_INT16U)DEF_MIN(data_buf_len, DEF_INT_16U_MAX_VAL),
                                                         (NET_ERR  *)p_err);
              }
 #endif
@@ -17113,6 +19897,9 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandlerDatagram (NET_SOCK_ID          s
              if (peek == DEF_YES) {
                  DEF_BIT_SET(flags_transport, NET_UDP_FLAG_RX_DATA_PEEK);
              }
+             if (DEF_BIT_IS_SET((NET_SOCK_FLAGS)flags, NET_SOCK_FLAG_DATA_VEC) == DEF_YES) {
+                 DEF_BIT_SET(flags_transport, NET_UDP_FLAG_RX_DATA_VEC);
+             }
 
              data_len_tot = NetUDP_RxAppData((NET_BUF     *) p_buf_head,
                                              (void        *) p_data_buf,
@@ -17597,6 +20384,9 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
              if (peek  == DEF_YES) {
                  DEF_BIT_SET(flags_transport, NET_TCP_FLAG_RX_DATA_PEEK);
              }
+             if (DEF_BIT_IS_SET((NET_SOCK_FLAGS)flags, NET_SOCK_FLAG_DATA_VEC) == DEF_YES) {
+                 DEF_BIT_SET(flags_transport, NET_TCP_FLAG_RX_DATA_VEC);
+             }
 
              data_len_tot = NetTCP_RxAppData(conn_id_transport,
                                              p_data_buf,
@@ -17721,6 +20511,14 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
 *
 *                                   NET_SOCK_FLAG_NONE              No socket flags selected.
 *                                   NET_SOCK_FLAG_TX_NO_BLOCK       Transmit socket data without blocking.
+*                                   NET_SOCK_FLAG_TX_MORE           More stream data follows; do NOT push.
+*
+*               flags_int       Internal flags to describe 'p_data' (see Note #7) :
+*
+*                                   NET_SOCK_FLAG_NONE              'p_data' points to application data.
+*                                   NET_SOCK_FLAG_DATA_VEC          'p_data' points to a data vector cursor.
+*                                   NET_SOCK_FLAG_DATA_EXT          'p_data' points to an external data cursor.
+*                                   NET_SOCK_FLAG_DATA_FILE         'p_data' points to a file data cursor.
 *
 *               p_addr_remote    Pointer to destination address buffer (see Note #4).
 *
@@ -17797,7 +20595,10 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
 *               NET_SOCK_BSD_ERR_TX,                        otherwise                   (see Note #5a2A).
 *
 * Caller(s)   : NetSock_TxDataTo(),
-*               NetSock_TxData().
+*               NetSock_TxData(),
+*               NetSock_TxDataVec(),
+*               NetSock_TxDataRef(),
+*               NetSock_TxFile().
 *
 * Note(s)     : (2) (a) (1) (A) Datagram-type sockets transmit & receive all data atomically -- i.e. every
 *                               single, complete datagram transmitted MUST be received as a single, complete
@@ -17835,9 +20636,13 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
 *                   See also 'NetSock_TxDataHandlerDatagram()  Note #2',
 *                          & 'NetSock_TxDataHandlerStream()    Note #3'.
 *
-*               (3) Only some socket transmit flag options are implemented.  If other flag options are
-*                   requested, NetSock_TxData() handler function(s) abort & return appropriate error codes
-*                   so that requested flag options are NOT silently ignored.
+*               (3) (a) Only some socket transmit flag options are implemented.  If other flag options are
+*                       requested, NetSock_TxData() handler function(s) abort & return appropriate error codes
+*                       so that requested flag options are NOT silently ignored.
+*
+*                   (b) NET_SOCK_FLAG_TX_MORE is implemented ONLY if TCP transmit cork is enabled (see 'net_tcp.c
+*                       NetTCP_ConnCfgTxCorkEnHandler()  Note #3') & applies ONLY to stream-type sockets; it is
+*                       ignored for datagram-type sockets since each datagram is transmitted atomically.
 *
 *               (4) (a) Socket address structure 'AddrFamily' member MUST be configured in host-order &
 *                       MUST NOT be converted to/from network-order.
@@ -17881,13 +20686,54 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
 *
 *               (6) Default case already invalidated in NetSock_Open().  However, the default case is
 *                   included as an extra precaution in case 'SockType' is incorrectly modified.
+*
+*               (7) (a) Vectored transmits pass a data vector cursor as 'p_data' & the data vector's total
+*                       length as 'data_len'; the transport layer gathers the data directly from the data
+*                       vector into its transmit buffers (see 'net_buf.h  NETWORK BUFFER DATA VECTOR DATA
+*                       TYPES').
+*
+*                   (b) Zero-copy transmits pass an external data cursor as 'p_data'; the transport layer
+*                       transmit buffers reference the application data in place (see 'net_buf.h  NETWORK
+*                       BUFFER EXTERNAL DATA REFERENCE DATA TYPES').
+*
+*                   (c) The internal flags are set ONLY after the application transmit flags are validated,
+*                       so applications can NOT request them directly.
+*
+*                   (d) Secure sockets encrypt from contiguous buffers & do NOT support vectored, zero-copy,
+*                       or file transmits.
+*
+*                   (e) File transmits pass a file data cursor as 'p_data' & are supported ONLY on stream-
+*                       type sockets (see 'net_buf.h  NETWORK BUFFER FILE DATA DATA TYPES').
+*
+*               (8) (a) Datagrams are at most 65535 octets; a larger datagram transmit is NOT transmitted &
+*                       NET_SOCK_ERR_INVALID_DATA_SIZE error is returned (see also Note #2a1B).
+*
+*                   (b) Stream-type data longer than 65535 octets is transmitted in successive transmits of
+*                       at most 65535 octets each, until ALL data is transmitted or a transmit is partial
+*                       (see Note #2a2A2).  Internal data cursors (see Note #7) are always passed with a
+*                       length of at most 65535 octets & are thus never advanced by this handler.
+*
+*                   (c) If any data is transmitted, the total transmitted data length is returned even if a
+*                       later chunked transmit fails.
+*
+*               (9) (a) If TCP Fast Open is configured on a CLOSED or BOUND stream-type socket & a remote address
+*                       is specified, the socket is connected to the remote address & the first data octets
+*                       are transmitted with the connection request (see 'NetSock_CfgFastOpen()  Note #3c').
+*
+*                   (b) If NO data octets are transmitted with the connection request (see 'NetSock_ConnHandlerStream()
+*                       Note #5b'), the data is transmitted normally once the socket is connected.
+*
+*                   (c) If the connection is still in progress when the socket does NOT block, the number of data
+*                       octets transmitted with the connection request is returned, if any; otherwise the socket
+*                       connection in progress error is returned.
 **********************************************************************************************************
 */
 
 static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
                                                   void                *p_data,
-                                                  CPU_INT16U           data_len,
+                                                  CPU_INT32U           data_len,
                                                   NET_SOCK_API_FLAGS   flags,
+                                                  NET_SOCK_API_FLAGS   flags_int,
                                                   NET_SOCK_ADDR       *p_addr_remote,
                                                   NET_SOCK_ADDR_LEN    addr_len,
                                                   NET_ERR             *p_err)
@@ -17898,6 +20744,14 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
 #endif
 #ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
    CPU_BOOLEAN         secure;
+   CPU_INT08U         *p_data_tx;
+   CPU_INT32U          data_len_rem;
+   CPU_INT16U          data_len_tx;
+   NET_SOCK_RTN_CODE   data_len_tot;
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+   CPU_INT16U          data_len_conn;
+   CPU_BOOLEAN         fast_open;
 #endif
    NET_SOCK           *p_sock;
    NET_SOCK_RTN_CODE   rtn_code;
@@ -17922,7 +20776,10 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
                                                                 /* ---------------- VALIDATE TX FLAGS ----------------- */
    flag_mask = NET_SOCK_FLAG_NONE       |
                NET_SOCK_FLAG_TX_NO_BLOCK;
-                                                                /* If any invalid flags req'd, rtn err (see Note #3).   */
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+   DEF_BIT_SET(flag_mask, NET_SOCK_FLAG_TX_MORE);               /* See Note #3b.                                        */
+#endif
+                                                                /* If any invalid flags req'd, rtn err (see Note #3a).  */
    if (((NET_SOCK_FLAGS)flags & (NET_SOCK_FLAGS)~flag_mask) != NET_SOCK_FLAG_NONE) {
        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidFlagsCtr);
       *p_err =  NET_SOCK_ERR_INVALID_FLAG;
@@ -17930,6 +20787,8 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
    }
 #endif
 
+   DEF_BIT_SET(flags, flags_int);                               /* See Note #7c.                                        */
+
 
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
    Net_GlobalLockAcquire((void *)&NetSock_TxDataHandler, p_err);
@@ -17963,6 +20822,18 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
                                                                 /* ------------------- TX SOCK DATA ------------------- */
    switch (p_sock->SockType) {
        case NET_SOCK_TYPE_DATAGRAM:
+            if (flags_int == NET_SOCK_FLAG_DATA_FILE) {         /* See Note #7e.                                        */
+                NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidSockTypeCtr);
+               *p_err    = NET_SOCK_ERR_INVALID_TYPE;
+                rtn_code = NET_SOCK_BSD_ERR_TX;
+                break;
+            }
+            if (data_len > DEF_INT_16U_MAX_VAL) {               /* See Note #8a.                                        */
+                NET_CTR_ERR_INC(Net_ErrCtrs.Sock.TxInvalidSizeCtr);
+               *p_err    = NET_SOCK_ERR_INVALID_DATA_SIZE;
+                rtn_code = NET_SOCK_BSD_ERR_TX;
+                break;
+            }
             rtn_code = NetSock_TxDataHandlerDatagram((NET_SOCK_ID       )sock_id,
                                                      (NET_SOCK         *)p_sock,
                                                      (void             *)p_data,
@@ -17980,22 +20851,91 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
 #else
             secure = DEF_NO;
 #endif
-            if (secure  != DEF_YES) {
-                rtn_code = NetSock_TxDataHandlerStream((NET_SOCK_ID       )sock_id,
-                                                       (NET_SOCK         *)p_sock,
-                                                       (void             *)p_data,
-                                                       (CPU_INT16U        )data_len,
-                                                       (NET_SOCK_API_FLAGS)flags,
-                                                       (NET_ERR          *)p_err);
+#ifdef  NET_SECURE_MODULE_EN
+            if ((secure    == DEF_YES) &&
+                (flags_int != NET_SOCK_FLAG_NONE)) {            /* See Note #7d.                                        */
+               *p_err    = NET_SOCK_ERR_INVALID_OP;
+                rtn_code = NET_SOCK_BSD_ERR_TX;
+                break;
             }
-#ifdef  NET_SECURE_MODULE_EN                                    /* If sock secure, tx data via secure handler.          */
-              else {
-                rtn_code = NetSecure_SockTxDataHandler((NET_SOCK *)p_sock,
-                                                       (void     *)p_data,
-                                                       (CPU_INT16U)data_len,
-                                                       (NET_ERR  *)p_err);
+#endif
+
+            p_data_tx    = (CPU_INT08U *)p_data;
+            data_len_rem =  data_len;
+            data_len_tot =  0;
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+            fast_open = DEF_BIT_IS_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_FAST_OPEN);
+            if ((fast_open      == DEF_YES)                 &&  /* If TCP Fast Open conn req'd (see Note #9a), ...      */
+                (p_addr_remote  != (NET_SOCK_ADDR *)0)      &&
+                (secure         != DEF_YES)                 &&
+                (flags_int      == NET_SOCK_FLAG_NONE)      &&
+               ((p_sock->State  == NET_SOCK_STATE_CLOSED)   ||
+                (p_sock->State  == NET_SOCK_STATE_BOUND))) {
+                data_len_tx = (CPU_INT16U)DEF_MIN(data_len_rem, DEF_INT_16U_MAX_VAL);
+                                                                /* ... conn sock & tx data with conn req.               */
+                rtn_code    =  NetSock_ConnHandlerStream(sock_id,
+                                                         p_sock,
+                                                         p_addr_remote,
+                                                         p_data_tx,
+                                                         data_len_tx,
+                                                        &data_len_conn,
+                                                         p_err);
+                if (rtn_code != NET_SOCK_BSD_ERR_NONE) {
+                    if ((*p_err         == NET_SOCK_ERR_CONN_IN_PROGRESS) &&
+                        ( data_len_conn >  0u)) {               /* See Note #9c.                                        */
+                       *p_err    = NET_SOCK_ERR_NONE;
+                        rtn_code = (NET_SOCK_RTN_CODE)data_len_conn;
+                    } else {
+                        rtn_code = NET_SOCK_BSD_ERR_TX;
+                    }
+                    break;
+                }
+
+                data_len_tot  = (NET_SOCK_RTN_CODE)data_len_conn;
+                data_len_rem -= (CPU_INT32U)data_len_conn;
+                p_data_tx    += data_len_conn;
+                if (data_len_rem == 0u) {                       /* If ALL data tx'd with conn req, rtn data tx'd.       */
+                   *p_err    = NET_SOCK_ERR_NONE;
+                    rtn_code = data_len_tot;
+                    break;
+                }
+            }                                                   /* Else tx data normally (see Note #9b).                */
+#endif
+
+            do {                                                /* Tx data in 16-bit len chunks (see Note #8b).         */
+                data_len_tx = (CPU_INT16U)DEF_MIN(data_len_rem, DEF_INT_16U_MAX_VAL);
+                if (secure  != DEF_YES) {
+                    rtn_code = NetSock_TxDataHandlerStream((NET_SOCK_ID       )sock_id,
+                                                           (NET_SOCK         *)p_sock,
+                                                           (void             *)p_data_tx,
+                                                           (CPU_INT16U        )data_len_tx,
+                                                           (NET_SOCK_API_FLAGS)flags,
+                                                           (NET_ERR          *)p_err);
+                }
+#ifdef  NET_SECURE_MODULE_EN
+                  else {                                        /* If sock secure, tx data via secure handler.          */
+                    rtn_code = NetSecure_SockTxDataHandler((NET_SOCK *)p_sock,
+                                                           (void     *)p_data_tx,
+                                                           (CPU_INT16U)data_len_tx,
+                                                           (NET_ERR  *)p_err);
+                }
+#endif
+                if (rtn_code < 1) {
+                    break;
+                }
+
+                data_len_tot += rtn_code;
+                data_len_rem -= (CPU_INT32U)rtn_code;
+                p_data_tx    += rtn_code;
+
+            } while ((data_len_rem >  0u) &&                    /* Stop if tx win/bufs exhausted.                       */
+                     (rtn_code     == (NET_SOCK_RTN_CODE)data_len_tx));
+
+            if (data_len_tot > 0) {                             /* Rtn data tx'd, if any (see Note #8c).                */
+               *p_err    = NET_SOCK_ERR_NONE;
+                rtn_code = data_len_tot;
             }
-#endif
             break;
 #endif
 
@@ -18555,6 +21495,12 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          s
              if (block == DEF_YES) {
                  DEF_BIT_SET(flags_transport, NET_UDP_FLAG_TX_BLOCK);
              }
+             if (DEF_BIT_IS_SET((NET_SOCK_FLAGS)flags, NET_SOCK_FLAG_DATA_VEC) == DEF_YES) {
+                 DEF_BIT_SET(flags_transport, NET_UDP_FLAG_TX_DATA_VEC);
+             }
+             if (DEF_BIT_IS_SET((NET_SOCK_FLAGS)flags, NET_SOCK_FLAG_DATA_EXT) == DEF_YES) {
+                 DEF_BIT_SET(flags_transport, NET_UDP_FLAG_TX_DATA_EXT);
+             }
 
              switch (p_sock->ProtocolFamily) {
 #ifdef  NET_IPv4_MODULE_EN
@@ -19017,6 +21963,20 @@ NET_SOCK_RTN_CODE  NetSock_TxDataHandlerStream (NET_SOCK_ID          sock_id,
              if (block == DEF_YES) {
                  DEF_BIT_SET(flags_transport, NET_TCP_FLAG_TX_BLOCK);
              }
+             if (DEF_BIT_IS_SET((NET_SOCK_FLAGS)flags, NET_SOCK_FLAG_DATA_VEC) == DEF_YES) {
+                 DEF_BIT_SET(flags_transport, NET_TCP_FLAG_TX_DATA_VEC);
+             }
+             if (DEF_BIT_IS_SET((NET_SOCK_FLAGS)flags, NET_SOCK_FLAG_DATA_EXT) == DEF_YES) {
+                 DEF_BIT_SET(flags_transport, NET_TCP_FLAG_TX_DATA_EXT);
+             }
+             if (DEF_BIT_IS_SET((NET_SOCK_FLAGS)flags, NET_SOCK_FLAG_DATA_FILE) == DEF_YES) {
+                 DEF_BIT_SET(flags_transport, NET_TCP_FLAG_TX_DATA_FILE);
+             }
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+             if (DEF_BIT_IS_SET((NET_SOCK_FLAGS)flags, NET_SOCK_FLAG_TX_MORE) == DEF_YES) {
+                 DEF_BIT_SET(flags_transport, NET_TCP_FLAG_TX_MORE);
+             }
+#endif
 
              data_len_tot = NetTCP_TxConnAppData((NET_TCP_CONN_ID) conn_id_transport,
                                                  (void          *) p_data,
@@ -21900,6 +24860,10 @@ static  void  NetSock_Free (NET_SOCK  *p_sock)
     p_sock->SecureSession = (void *)0;                          /* Clr secure session.                                  */
 #endif
 
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+    NetSock_PollUnreg(p_sock);                                  /* Unregister sock from poll set.                       */
+#endif
+
     p_sock->State = NET_SOCK_STATE_FREE;                        /* Set sock as freed/NOT used.                          */
     DEF_BIT_CLR(p_sock->Flags, NET_SOCK_FLAG_SOCK_USED);
     p_sock->ShutdownMode = NET_SOCK_SHUTDOWN_MODE_NONE;
@@ -22097,6 +25061,14 @@ static  void  NetSock_Clr (NET_SOCK  *p_sock)
     p_sock->NextPtr             = (NET_SOCK         *)0;
 #if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
     p_sock->SelObjTailPtr       = (NET_SOCK_SEL_OBJ *)0;
+#endif
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+    p_sock->PollID              =  NET_SOCK_POLL_ID_NONE;
+    p_sock->PollEventsCfgd      =  NET_SOCK_SEL_EVENT_FLAG_NONE;
+    p_sock->PollEventsPosted    =  NET_SOCK_SEL_EVENT_FLAG_NONE;
+    p_sock->PollRdyListed       =  DEF_NO;
+    p_sock->PollRdyNextPtr      = (NET_SOCK         *)0;
+    p_sock->PollDataPtr         = (void             *)0;
 #endif
     p_sock->RxQ_Head            = (NET_BUF          *)0;
     p_sock->RxQ_Tail            = (NET_BUF          *)0;
@@ -22623,6 +25595,10 @@ exit:
 *                       NET_SOCK_OPT_SOCK_TX_TIMEOUT    CPU_INT32U            TCP connection transmit queue timeout value
 *                       NET_SOCK_OPT_SOCK_RX_TIMEOUT    CPU_INT32U            TCP connection receive  queue timeout value
 *
+*                       NET_SOCK_OPT_SOCK_REUSE_PORT    CPU_BOOLEAN           Socket local port sharing (see Note #4):
+*                                                                                 DEF_ENABLED
+*                                                                                 DEF_DISABLED
+*
 *                   (b) Level NET_SOCK_PROTOCOL_IP:
 *
 *                       Option name                     Returned data type    Option decription
@@ -22644,6 +25620,28 @@ exit:
 *                       NET_SOCK_OPT_TCP_KEEP_IDLE      NET_TCP_TIMEOUT_SEC   TCP keep alive timeout       value (in seconds)
 *                       NET_SOCK_OPT_TCP_KEEP_INTVL     NET_TCP_TIMEOUT_SEC   TCP keep alive probe re-transmit timeout
 *                                                                                                          value (in seconds)
+*
+*                       NET_SOCK_OPT_TCP_CORK           CPU_BOOLEAN           TCP connection transmit cork status:
+*                                                                                 DEF_ENABLED
+*                                                                                 DEF_DISABLED
+*
+*                       NET_SOCK_OPT_TCP_MAX_PACING_RATE
+*                                                       NET_TCP_TX_PACE_RATE  TCP connection transmit pacing rate
+*                                                                                 (in octets per second):
+*                                                                                 NET_TCP_TX_PACE_RATE_NONE
+*                                                                                 NET_TCP_TX_PACE_RATE_AUTO
+*
+*                       NET_SOCK_OPT_TCP_FAST_OPEN      CPU_BOOLEAN           Socket TCP Fast Open (see Note #5):
+*                                                                             DEF_ENABLED
+*                                                                             DEF_DISABLED
+*
+*               (4) NET_SOCK_OPT_SOCK_REUSE_PORT MUST be set BEFORE the socket is bound & is therefore
+*                   configured for any socket type, independent of any transport connection (see
+*                   'NetSock_CfgReusePort()  Note #3').
+*
+*               (5) NET_SOCK_OPT_TCP_FAST_OPEN MUST be set BEFORE the socket connects or listens & is
+*                   therefore configured on the socket, independent of any TCP connection (see
+*                   'NetSock_CfgFastOpen()  Note #3').
 *********************************************************************************************************
 */
 
@@ -22689,6 +25687,15 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
         case NET_SOCK_OPT_TCP_KEEP_CNT:
         case NET_SOCK_OPT_TCP_KEEP_IDLE:
         case NET_SOCK_OPT_TCP_KEEP_INTVL:
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+        case NET_SOCK_OPT_TCP_CORK:
+#endif
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+        case NET_SOCK_OPT_TCP_MAX_PACING_RATE:
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+        case NET_SOCK_OPT_TCP_FAST_OPEN:
+#endif
              if (level != NET_SOCK_PROTOCOL_TCP) {
                 *p_err =   NET_SOCK_ERR_INVALID_OPT_LEVEL;
                  goto exit_lock_fault;                          /* Sock opt incompatible with protocol level.           */
@@ -22701,6 +25708,9 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
         case NET_SOCK_OPT_SOCK_TX_TIMEOUT:
         case NET_SOCK_OPT_SOCK_RX_TIMEOUT:
         case NET_SOCK_OPT_SOCK_KEEP_ALIVE:
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN
+        case NET_SOCK_OPT_SOCK_REUSE_PORT:
+#endif
              if (level != NET_SOCK_PROTOCOL_SOCK) {
                 *p_err =   NET_SOCK_ERR_INVALID_OPT_LEVEL;
                  goto exit_lock_fault;                          /* Sock opt incompatible with protocol level.           */
@@ -22737,6 +25747,40 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
 
     p_sock = &NetSock_Tbl[sock_id];
 
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN
+    if (opt_name == NET_SOCK_OPT_SOCK_REUSE_PORT) {             /* Cfg'd before bind (see Note #4) ...                  */
+        if (opt_len != sizeof(CPU_BOOLEAN)) {
+           *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+            goto exit_err_opt_set;
+        }
+
+       (void)NetSock_CfgReusePortHandler(sock_id,              /* ... for ALL sock types.                              */
+                                       *(const CPU_BOOLEAN *)p_opt_val,
+                                         p_err);
+        if (*p_err != NET_SOCK_ERR_NONE) {
+            goto exit_err_opt_set;
+        }
+        goto exit_err_none;
+    }
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    if (opt_name == NET_SOCK_OPT_TCP_FAST_OPEN) {               /* Cfg'd before conn (see Note #5).                     */
+        if (opt_len != sizeof(CPU_BOOLEAN)) {
+           *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+            goto exit_err_opt_set;
+        }
+
+       (void)NetSock_CfgFastOpenHandler(sock_id,
+                                      *(const CPU_BOOLEAN *)p_opt_val,
+                                        p_err);
+        if (*p_err != NET_SOCK_ERR_NONE) {
+            goto exit_err_opt_set;
+        }
+        goto exit_err_none;
+    }
+#endif
+
     switch (p_sock->SockType) {
 #ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
         case NET_SOCK_TYPE_STREAM:
@@ -22770,15 +25814,45 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
                               break;
 
 
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+                         case NET_SOCK_OPT_TCP_CORK:
+                              if (opt_len != sizeof(CPU_BOOLEAN)) {
+                                 *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+                                  break;
+                              }
+
+                              p_bool_val = (CPU_BOOLEAN *)p_opt_val;
+                             (void)NetSock_CfgTxCorkHandler(sock_id,
+                                                           *p_bool_val,
+                                                            p_err);
+                              break;
+#endif
+
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+                         case NET_SOCK_OPT_TCP_MAX_PACING_RATE:
+                              if (opt_len != sizeof(NET_TCP_TX_PACE_RATE)) {
+                                 *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+                                  break;
+                              }
+
+                              p_int32u_val = (CPU_INT32U *)p_opt_val;
+                             (void)NetSock_CfgTxPaceRateHandler(                       sock_id,
+                                                                (NET_TCP_TX_PACE_RATE)*p_int32u_val,
+                                                                                        p_err);
+                              break;
+#endif
+
+
                          case NET_SOCK_OPT_SOCK_TX_BUF_SIZE:
                               if (opt_len != sizeof(NET_TCP_WIN_SIZE)) {
                                  *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
                                   break;
                               }
 
-                              p_int16u_val = (CPU_INT16U *)p_opt_val;
+                              p_int32u_val = (CPU_INT32U *)p_opt_val;
                              (void)NetTCP_ConnCfgTxWinSizeHandler(                   conn_id_transport,
-                                                                  (NET_TCP_WIN_SIZE)*p_int16u_val,
+                                                                  (NET_TCP_WIN_SIZE)*p_int32u_val,
                                                                                      p_err);
                               if (*p_err == NET_TCP_ERR_NONE) {
                                   *p_err  = NET_SOCK_ERR_NONE;
@@ -22808,9 +25882,9 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
                                   break;
                               }
 
-                              p_int16u_val = (CPU_INT16U *)p_opt_val;
+                              p_int32u_val = (CPU_INT32U *)p_opt_val;
                              (void)NetTCP_ConnCfgRxWinSizeHandler(                   conn_id_transport,
-                                                                  (NET_TCP_WIN_SIZE)*p_int16u_val,
+                                                                  (NET_TCP_WIN_SIZE)*p_int32u_val,
                                                                                      p_err);
                               if (*p_err == NET_TCP_ERR_NONE) {
                                   *p_err  = NET_SOCK_ERR_NONE;
@@ -23011,73 +26085,281 @@ exit_err_opt_set:
    rtn_code = NET_SOCK_BSD_ERR_OPT_SET;
    goto exit_release;
 
-exit_err_none:
-    rtn_code = NET_SOCK_BSD_ERR_NONE;
+exit_err_none:
+    rtn_code = NET_SOCK_BSD_ERR_NONE;
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+
+
+    return (rtn_code);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NetSock_CfgTxNagleEnHandler()
+*
+* Description : (1) Configure Scoket's TCP connection's transmit Nagle algorithm enable.
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of the socket to configure the Nagle
+*               -------     TCP transmission algorithm enable.
+*
+*               nagle_en    Desired state the Nagle algorithm enable.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Nagle algorithm enable successfully set.
+*
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization not completed.
+*                               NET_SOCK_ERR_INVALID_SOCK       Socket ID invalid.
+*                               NET_SOCK_ERR_NOT_USED           Socket ID not used.
+*                               NET_SOCK_ERR_INVALID_PROTOCOL   Socket does not use TCP.
+*                               NET_SOCK_ERR_INVALID_TYPE       Socket is not of the right type.
+*
+* Return(s)   : DEF_OK,   If the Nagle algorithm was successfully set,
+*
+*               DEF_FAIL, Otherwise.
+*
+* Caller(s)   : NetSock_OptSet(),
+*               NetSock_CfgTxNagle().
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetSock_CfgTxNagleEnHandler() is called by application function(s) & ... :
+*
+*                   (a) MUST be called with the global network lock already acquired; ...
+*
+*                   This is required since an application's network protocol suite API function access
+*                   is asynchronous to other network protocol tasks.
+*
+*                   See also 'NetTCP_ConnCfgTxNagleEnHandler()'.
+*
+*               (3) RFC #1122, Section 4.2.3.4 also states that "a TCP SHOULD implement the Nagle
+*                   Algorithm ... However, there MUST be a way for an application to disable the
+*                   Nagle algorithm on an individual connection".
+*
+*                   See also 'NetTCP_TxConnTxQ()  Note #6'.
+*********************************************************************************************************
+*/
+#ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
+static  CPU_BOOLEAN  NetSock_CfgTxNagleEnHandler (NET_SOCK_ID   sock_id,
+                                                  CPU_BOOLEAN   nagle_en,
+                                                  NET_ERR      *p_err)
+{
+    NET_SOCK     *p_sock;
+    NET_CONN_ID   conn_id;
+    NET_CONN_ID   conn_id_transport;
+    NET_ERR       err;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* ---------------- VALIDATE SOCK USED ---------------- */
+   (void)NetSock_IsUsed(sock_id, p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         return (DEF_FAIL);
+    }
+#endif
+
+
+                                                                /* --------------- CFG TCP TX NAGLE EN ---------------- */
+    p_sock = &NetSock_Tbl[sock_id];
+
+    switch (p_sock->SockType) {
+#ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
+        case NET_SOCK_TYPE_STREAM:
+             switch (p_sock->Protocol) {
+#ifdef  NET_TCP_MODULE_EN
+                 case NET_SOCK_PROTOCOL_TCP:
+                      conn_id           = p_sock->ID_Conn;
+                      conn_id_transport = NetConn_ID_TransportGet(conn_id, p_err);
+                      if (*p_err != NET_CONN_ERR_NONE) {
+                           return (DEF_FAIL);
+                      }
+
+                     (void)NetTCP_ConnIsUsed((NET_TCP_CONN_ID)conn_id_transport,
+                                                              p_err);
+                      if (*p_err != NET_TCP_ERR_NONE) {
+                           return (DEF_FAIL);
+                      }
+
+                     (void)NetTCP_ConnCfgTxNagleEnHandler((NET_TCP_CONN_ID) conn_id_transport,
+                                                                            nagle_en,
+                                                                           &err);
+                     *p_err = (err == NET_TCP_ERR_NONE) ? NET_SOCK_ERR_NONE : err;
+                      break;
+#endif
+
+
+                 case NET_SOCK_PROTOCOL_NONE:
+                 default:
+                      NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidProtocolCtr);
+                     *p_err = NET_SOCK_ERR_INVALID_PROTOCOL;
+                      return (DEF_FAIL);
+             }
+             break;
+#endif
+
+
+        case NET_SOCK_TYPE_NONE:
+        case NET_SOCK_TYPE_DATAGRAM:
+        case NET_SOCK_TYPE_FAULT:
+        default:
+             NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidSockTypeCtr);
+            *p_err = NET_SOCK_ERR_INVALID_TYPE;
+             break;
+    }
+
+   (void)&conn_id;                                              /* Prevent possible 'variable unused' warnings.         */
+   (void)&conn_id_transport;
+   (void)&err;
+
+    if(*p_err == NET_SOCK_ERR_INVALID_TYPE) {
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                      NetSock_CfgTxCorkHandler()
+*
+* Description : Configure socket's TCP connection transmit cork.
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to configure transmit cork.
+*
+*               cork_en     Desired value for socket transmit cork.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket transmit cork successfully configured.
+*                               NET_SOCK_ERR_INVALID_PROTOCOL   Socket does NOT use TCP.
+*                               NET_SOCK_ERR_INVALID_TYPE       Socket is NOT a stream-type socket.
+*
+*                                                               ------ RETURNED BY NetSock_IsUsed() : -------
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*
+* Return(s)   : DEF_OK,   socket transmit cork successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetSock_CfgTxCork(),
+*               NetSock_OptSet().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : NetSock_CfgTxCorkHandler() is called by network protocol suite function(s) & MUST be called
+*               with the global network lock already acquired.
+*
+*               See also 'NetSock_CfgTxCork()  Note #2'
+*                      & 'net_tcp.c  NetTCP_ConnCfgTxCorkEnHandler()'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+static  CPU_BOOLEAN  NetSock_CfgTxCorkHandler (NET_SOCK_ID   sock_id,
+                                               CPU_BOOLEAN   cork_en,
+                                               NET_ERR      *p_err)
+{
+    NET_SOCK     *p_sock;
+    NET_CONN_ID   conn_id_transport;
+    CPU_BOOLEAN   rtn_val;
+    NET_ERR       err;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* ---------------- VALIDATE SOCK USED ---------------- */
+   (void)NetSock_IsUsed(sock_id, p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         return (DEF_FAIL);
+    }
+#endif
+
+                                                                /* ---------------- CFG TCP TX CORK EN ---------------- */
+    p_sock = &NetSock_Tbl[sock_id];
+
+    if (p_sock->SockType != NET_SOCK_TYPE_STREAM) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidSockTypeCtr);
+       *p_err = NET_SOCK_ERR_INVALID_TYPE;
+        return (DEF_FAIL);
+    }
+
+    if (p_sock->Protocol != NET_SOCK_PROTOCOL_TCP) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidProtocolCtr);
+       *p_err = NET_SOCK_ERR_INVALID_PROTOCOL;
+        return (DEF_FAIL);
+    }
+
+    conn_id_transport = NetConn_ID_TransportGet(p_sock->ID_Conn, p_err);
+    if (*p_err != NET_CONN_ERR_NONE) {
+         return (DEF_FAIL);
+    }
 
-exit_release:
-                                                                /* ----------------- RELEASE NET LOCK ----------------- */
-    Net_GlobalLockRelease();
+   (void)NetTCP_ConnIsUsed((NET_TCP_CONN_ID)conn_id_transport, p_err);
+    if (*p_err != NET_TCP_ERR_NONE) {
+         return (DEF_FAIL);
+    }
 
+    rtn_val = NetTCP_ConnCfgTxCorkEnHandler((NET_TCP_CONN_ID) conn_id_transport,
+                                                              cork_en,
+                                                             &err);
+   *p_err   = (err == NET_TCP_ERR_NONE) ? NET_SOCK_ERR_NONE : err;
 
-    return (rtn_code);
+    return (rtn_val);
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                     NetSock_CfgTxNagleEnHandler()
+*                                    NetSock_CfgTxPaceRateHandler()
 *
-* Description : (1) Configure Scoket's TCP connection's transmit Nagle algorithm enable.
+* Description : Configure socket's TCP connection transmit pacing rate.
 *
-* Argument(s) : sock_id     Socket descriptor/handle identifier of the socket to configure the Nagle
-*               -------     TCP transmission algorithm enable.
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to configure transmit pacing rate.
 *
-*               nagle_en    Desired state the Nagle algorithm enable.
+*               rate_max    Desired value for socket transmit pacing rate (see 'NetSock_CfgTxPaceRate()').
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_SOCK_ERR_NONE               Nagle algorithm enable successfully set.
-*
-*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization not completed.
-*                               NET_SOCK_ERR_INVALID_SOCK       Socket ID invalid.
-*                               NET_SOCK_ERR_NOT_USED           Socket ID not used.
-*                               NET_SOCK_ERR_INVALID_PROTOCOL   Socket does not use TCP.
-*                               NET_SOCK_ERR_INVALID_TYPE       Socket is not of the right type.
-*
-* Return(s)   : DEF_OK,   If the Nagle algorithm was successfully set,
-*
-*               DEF_FAIL, Otherwise.
-*
-* Caller(s)   : NetSock_OptSet(),
-*               NetSock_CfgTxNagle().
+*                               NET_SOCK_ERR_NONE               Socket transmit pacing rate successfully configured.
+*                               NET_SOCK_ERR_INVALID_PROTOCOL   Socket does NOT use TCP.
+*                               NET_SOCK_ERR_INVALID_TYPE       Socket is NOT a stream-type socket.
 *
-*               This function is a network protocol suite application programming interface (API) function
-*               & MAY be called by application function(s) [see also Note #2].
+*                                                               ------ RETURNED BY NetSock_IsUsed() : -------
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
 *
-* Note(s)     : (2) NetSock_CfgTxNagleEnHandler() is called by application function(s) & ... :
+* Return(s)   : DEF_OK,   socket transmit pacing rate successfully configured.
 *
-*                   (a) MUST be called with the global network lock already acquired; ...
+*               DEF_FAIL, otherwise.
 *
-*                   This is required since an application's network protocol suite API function access
-*                   is asynchronous to other network protocol tasks.
+* Caller(s)   : NetSock_CfgTxPaceRate(),
+*               NetSock_OptSet().
 *
-*                   See also 'NetTCP_ConnCfgTxNagleEnHandler()'.
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
 *
-*               (3) RFC #1122, Section 4.2.3.4 also states that "a TCP SHOULD implement the Nagle
-*                   Algorithm ... However, there MUST be a way for an application to disable the
-*                   Nagle algorithm on an individual connection".
+* Note(s)     : NetSock_CfgTxPaceRateHandler() is called by network protocol suite function(s) & MUST be
+*               called with the global network lock already acquired.
 *
-*                   See also 'NetTCP_TxConnTxQ()  Note #6'.
+*               See also 'NetSock_CfgTxPaceRate()  Note #2'
+*                      & 'net_tcp.c  NetTCP_ConnCfgTxPaceRateHandler()'.
 *********************************************************************************************************
 */
-#ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
-static  CPU_BOOLEAN  NetSock_CfgTxNagleEnHandler (NET_SOCK_ID   sock_id,
-                                                  CPU_BOOLEAN   nagle_en,
-                                                  NET_ERR      *p_err)
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+static  CPU_BOOLEAN  NetSock_CfgTxPaceRateHandler (NET_SOCK_ID            sock_id,
+                                                   NET_TCP_TX_PACE_RATE   rate_max,
+                                                   NET_ERR               *p_err)
 {
     NET_SOCK     *p_sock;
-    NET_CONN_ID   conn_id;
     NET_CONN_ID   conn_id_transport;
+    CPU_BOOLEAN   rtn_val;
     NET_ERR       err;
 
 
@@ -23088,67 +26370,41 @@ static  CPU_BOOLEAN  NetSock_CfgTxNagleEnHandler (NET_SOCK_ID   sock_id,
     }
 #endif
 
-
-                                                                /* --------------- CFG TCP TX NAGLE EN ---------------- */
+                                                                /* --------------- CFG TCP TX PACE RATE --------------- */
     p_sock = &NetSock_Tbl[sock_id];
 
-    switch (p_sock->SockType) {
-#ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
-        case NET_SOCK_TYPE_STREAM:
-             switch (p_sock->Protocol) {
-#ifdef  NET_TCP_MODULE_EN
-                 case NET_SOCK_PROTOCOL_TCP:
-                      conn_id           = p_sock->ID_Conn;
-                      conn_id_transport = NetConn_ID_TransportGet(conn_id, p_err);
-                      if (*p_err != NET_CONN_ERR_NONE) {
-                           return (DEF_FAIL);
-                      }
-
-                     (void)NetTCP_ConnIsUsed((NET_TCP_CONN_ID)conn_id_transport,
-                                                              p_err);
-                      if (*p_err != NET_TCP_ERR_NONE) {
-                           return (DEF_FAIL);
-                      }
-
-                     (void)NetTCP_ConnCfgTxNagleEnHandler((NET_TCP_CONN_ID) conn_id_transport,
-                                                                            nagle_en,
-                                                                           &err);
-                     *p_err = (err == NET_TCP_ERR_NONE) ? NET_SOCK_ERR_NONE : err;
-                      break;
-#endif
-
-
-                 case NET_SOCK_PROTOCOL_NONE:
-                 default:
-                      NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidProtocolCtr);
-                     *p_err = NET_SOCK_ERR_INVALID_PROTOCOL;
-                      return (DEF_FAIL);
-             }
-             break;
-#endif
-
+    if (p_sock->SockType != NET_SOCK_TYPE_STREAM) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidSockTypeCtr);
+       *p_err = NET_SOCK_ERR_INVALID_TYPE;
+        return (DEF_FAIL);
+    }
 
-        case NET_SOCK_TYPE_NONE:
-        case NET_SOCK_TYPE_DATAGRAM:
-        case NET_SOCK_TYPE_FAULT:
-        default:
-             NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidSockTypeCtr);
-            *p_err = NET_SOCK_ERR_INVALID_TYPE;
-             break;
+    if (p_sock->Protocol != NET_SOCK_PROTOCOL_TCP) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidProtocolCtr);
+       *p_err = NET_SOCK_ERR_INVALID_PROTOCOL;
+        return (DEF_FAIL);
     }
 
-   (void)&conn_id;                                              /* Prevent possible 'variable unused' warnings.         */
-   (void)&conn_id_transport;
-   (void)&err;
+    conn_id_transport = NetConn_ID_TransportGet(p_sock->ID_Conn, p_err);
+    if (*p_err != NET_CONN_ERR_NONE) {
+         return (DEF_FAIL);
+    }
 
-    if(*p_err == NET_SOCK_ERR_INVALID_TYPE) {
-        return (DEF_FAIL);
+   (void)NetTCP_ConnIsUsed((NET_TCP_CONN_ID)conn_id_transport, p_err);
+    if (*p_err != NET_TCP_ERR_NONE) {
+         return (DEF_FAIL);
     }
 
-    return (DEF_OK);
+    rtn_val = NetTCP_ConnCfgTxPaceRateHandler((NET_TCP_CONN_ID) conn_id_transport,
+                                                                rate_max,
+                                                               &err);
+   *p_err   = (err == NET_TCP_ERR_NONE) ? NET_SOCK_ERR_NONE : err;
+
+    return (rtn_val);
 }
 #endif
 
+
 /*
 *********************************************************************************************************
 *                                     NetSock_CfgIF_Handler()
@@ -23235,6 +26491,208 @@ static  CPU_BOOLEAN  NetSock_CfgIF_Handler (NET_SOCK_ID   sock_id,
 }
 
 
+/*
+*********************************************************************************************************
+*                                    NetSock_CfgReusePortHandler()
+*
+* Description : Configure socket to share its local port with other sockets.
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to configure local port sharing.
+*
+*               reuse_port  Desired value for socket local port sharing :
+*
+*                               DEF_ENABLED                     Socket local port MAY     be shared.
+*                               DEF_DISABLED                    Socket local port MAY NOT be shared.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket local port sharing successfully configured.
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
+*                               NET_SOCK_ERR_INVALID_STATE      Invalid socket state (see Note #1).
+*
+*                                                               ------ RETURNED BY NetSock_IsUsed() : -------
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*
+* Return(s)   : DEF_OK,   socket local port sharing successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetSock_CfgReusePort(),
+*               NetSock_OptSet().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : NetSock_CfgReusePortHandler() is called by network protocol suite function(s)
+*               & MUST be called with the global network lock already acquired.
+*
+*               See also 'NetSock_CfgReusePort()  Note #2'.
+*
+*               (1) Local port sharing MUST be configured BEFORE the socket is bound (see 'NetSock_CfgReusePort()
+*                   Note #3a').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN
+static  CPU_BOOLEAN  NetSock_CfgReusePortHandler (NET_SOCK_ID   sock_id,
+                                                  CPU_BOOLEAN   reuse_port,
+                                                  NET_ERR      *p_err)
+{
+    NET_SOCK  *p_sock;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* ------------- VALIDATE NET INIT IS DONE ------------ */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        return (DEF_FAIL);
+    }
+
+   (void)NetSock_IsUsed(sock_id, p_err);                        /* ---------------- VALIDATE SOCK USED ---------------- */
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         return (DEF_FAIL);
+    }
+#endif
+
+                                                                /* --------------- VALIDATE SOCK STATE ---------------- */
+    p_sock = &NetSock_Tbl[sock_id];
+    if (p_sock->State != NET_SOCK_STATE_CLOSED) {               /* If sock already bound, ...                           */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidStateCtr);
+       *p_err = NET_SOCK_ERR_INVALID_STATE;                     /* ... rtn err (see Note #1).                           */
+        return (DEF_FAIL);
+    }
+
+                                                                /* ------------- CFG SOCK LOCAL PORT SHARE ------------ */
+    if (reuse_port == DEF_ENABLED) {
+        DEF_BIT_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_REUSE_PORT);
+    } else {
+        DEF_BIT_CLR(p_sock->Flags, NET_SOCK_FLAG_SOCK_REUSE_PORT);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetSock_CfgFastOpenHandler()
+*
+* Description : Configure socket's TCP Fast Open.
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to configure TCP Fast Open.
+*
+*               fast_open   Desired value for socket TCP Fast Open :
+*
+*                               DEF_ENABLED                     Socket TCP Fast Open ENABLED.
+*                               DEF_DISABLED                    Socket TCP Fast Open DISABLED.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket TCP Fast Open successfully configured.
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
+*                               NET_SOCK_ERR_INVALID_STATE      Invalid socket state (see Note #1).
+*                               NET_SOCK_ERR_INVALID_TYPE       Socket is NOT a stream-type socket.
+*                               NET_SOCK_ERR_INVALID_PROTOCOL   Socket does NOT use TCP.
+*                               NET_SOCK_ERR_INVALID_ARG        Invalid TCP Fast Open value.
+*
+*                                                               ------ RETURNED BY NetSock_IsUsed() : -------
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*
+* Return(s)   : DEF_OK,   socket TCP Fast Open successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetSock_CfgFastOpen(),
+*               NetSock_OptSet().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : NetSock_CfgFastOpenHandler() is called by network protocol suite function(s)
+*               & MUST be called with the global network lock already acquired.
+*
+*               See also 'NetSock_CfgFastOpen()  Note #2'.
+*
+*               (1) TCP Fast Open MUST be configured BEFORE the socket connects or listens (see
+*                   'NetSock_CfgFastOpen()  Note #3a').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  CPU_BOOLEAN  NetSock_CfgFastOpenHandler (NET_SOCK_ID   sock_id,
+                                                 CPU_BOOLEAN   fast_open,
+                                                 NET_ERR      *p_err)
+{
+    NET_SOCK  *p_sock;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* ------------- VALIDATE NET INIT IS DONE ------------ */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        return (DEF_FAIL);
+    }
+
+   (void)NetSock_IsUsed(sock_id, p_err);                        /* ---------------- VALIDATE SOCK USED ---------------- */
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         return (DEF_FAIL);
+    }
+#endif
+
+    switch (fast_open) {                                        /* ------------ VALIDATE TCP FAST OPEN VAL ------------ */
+        case DEF_ENABLED:
+        case DEF_DISABLED:
+             break;
+
+
+        default:
+            *p_err = NET_SOCK_ERR_INVALID_ARG;
+             return (DEF_FAIL);
+    }
+
+    p_sock = &NetSock_Tbl[sock_id];
+
+    if (p_sock->SockType != NET_SOCK_TYPE_STREAM) {             /* ---------------- VALIDATE SOCK TYPE ---------------- */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidSockTypeCtr);
+       *p_err = NET_SOCK_ERR_INVALID_TYPE;
+        return (DEF_FAIL);
+    }
+
+    if (p_sock->Protocol != NET_SOCK_PROTOCOL_TCP) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidProtocolCtr);
+       *p_err = NET_SOCK_ERR_INVALID_PROTOCOL;
+        return (DEF_FAIL);
+    }
+
+    switch (p_sock->State) {                                    /* --------------- VALIDATE SOCK STATE ---------------- */
+        case NET_SOCK_STATE_CLOSED:
+        case NET_SOCK_STATE_BOUND:
+             break;
+
+
+        default:                                                /* If sock already conn'd or listening, ...             */
+             NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidStateCtr);
+            *p_err = NET_SOCK_ERR_INVALID_STATE;                /* ... rtn err (see Note #1).                           */
+             return (DEF_FAIL);
+    }
+
+                                                                /* --------------- CFG SOCK TCP FAST OPEN ------------- */
+    if (fast_open == DEF_ENABLED) {
+        DEF_BIT_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_FAST_OPEN);
+    } else {
+        DEF_BIT_CLR(p_sock->Flags, NET_SOCK_FLAG_SOCK_FAST_OPEN);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (DEF_OK);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
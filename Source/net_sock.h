@@ -264,6 +264,8 @@
 #define  NET_SOCK_FLAG_SOCK_NO_BLOCK              MSG_DONTWAIT  /* Sock blocking DISABLED.                              */
 #define  NET_SOCK_FLAG_SOCK_SECURE                DEF_BIT_09    /* Sock security ENABLED.                               */
 #define  NET_SOCK_FLAG_SOCK_SECURE_NEGO           DEF_BIT_10
+#define  NET_SOCK_FLAG_SOCK_REUSE_PORT            DEF_BIT_11    /* Sock local port shared (SO_REUSEPORT).               */
+#define  NET_SOCK_FLAG_SOCK_FAST_OPEN             DEF_BIT_12    /* Sock TCP Fast Open ENABLED (TCP_FASTOPEN).           */
 
 
 /*
@@ -398,10 +400,16 @@
 #define  NET_SOCK_FLAG_NONE                       NET_SOCK_FLAG_SOCK_NONE
 
 #define  NET_SOCK_FLAG_RX_DATA_PEEK               MSG_PEEK
+#define  NET_SOCK_FLAG_RX_DATA_TRUNC              MSG_TRUNC     /* Rtn'd ONLY; see 'NET_SOCK_MSG  Note #2'.             */
 
 #define  NET_SOCK_FLAG_NO_BLOCK                   MSG_DONTWAIT
 #define  NET_SOCK_FLAG_RX_NO_BLOCK                NET_SOCK_FLAG_NO_BLOCK
 #define  NET_SOCK_FLAG_TX_NO_BLOCK                NET_SOCK_FLAG_NO_BLOCK
+#define  NET_SOCK_FLAG_TX_MORE                    MSG_MORE      /* More tx data follows; do NOT push (TCP ONLY).        */
+
+#define  NET_SOCK_FLAG_DATA_VEC                   DEF_BIT_14    /* Internal ONLY; app data is a data vec cursor.        */
+#define  NET_SOCK_FLAG_DATA_EXT                   DEF_BIT_13    /* Internal ONLY; app data is an ext data cursor.       */
+#define  NET_SOCK_FLAG_DATA_FILE                  DEF_BIT_12    /* Internal ONLY; app data is a file data cursor.       */
 
 
 /*
@@ -639,11 +647,15 @@ typedef  enum  net_sock_opt_name {
     NET_SOCK_OPT_SOCK_TYPE                   = SO_TYPE,
     NET_SOCK_OPT_SOCK_KEEP_ALIVE             = SO_KEEPALIVE,
     NET_SOCK_OPT_SOCK_ACCEPT_CONN            = SO_ACCEPTCONN,
+    NET_SOCK_OPT_SOCK_REUSE_PORT             = SO_REUSEPORT,
 
     NET_SOCK_OPT_TCP_NO_DELAY                = TCP_NODELAY,
     NET_SOCK_OPT_TCP_KEEP_CNT                = TCP_KEEPCNT,
     NET_SOCK_OPT_TCP_KEEP_IDLE               = TCP_KEEPIDLE,
     NET_SOCK_OPT_TCP_KEEP_INTVL              = TCP_KEEPINTVL,
+    NET_SOCK_OPT_TCP_CORK                    = TCP_CORK,
+    NET_SOCK_OPT_TCP_MAX_PACING_RATE         = TCP_MAX_PACING_RATE,
+    NET_SOCK_OPT_TCP_FAST_OPEN               = TCP_FASTOPEN,
 
     NET_SOCK_OPT_IP_TOS                      = IP_TOS,
     NET_SOCK_OPT_IP_TTL                      = IP_TTL,
@@ -814,6 +826,95 @@ typedef  CPU_INT08U  NET_SOCK_SEL_EVENT_FLAG;
 #define  NET_SOCK_SEL_EVENT_FLAG_WR             DEF_BIT_01
 #define  NET_SOCK_SEL_EVENT_FLAG_ERR            DEF_BIT_02
 
+#define  NET_SOCK_SEL_EVENT_FLAG_MASK          (NET_SOCK_SEL_EVENT_FLAG_RD | \
+                                                NET_SOCK_SEL_EVENT_FLAG_WR | \
+                                                NET_SOCK_SEL_EVENT_FLAG_ERR)
+
+
+/*
+*********************************************************************************************************
+*                                NETWORK SOCKET EVENT POLL DATA TYPES
+*
+* Note(s) : (1) Socket event poll sets hold a persistent set of sockets of interest; see 'net_sock.c
+*               NetSock_PollCtl()  Note #2'.
+*
+*           (2) Events of interest are configured with the NET_SOCK_SEL_EVENT_FLAG_?? flags, optionally
+*               combined with NET_SOCK_POLL_EVENT_FLAG_EDGE to select edge-triggered readiness; see
+*               'net_sock.c  NetSock_PollWait()  Note #3'.
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT16S  NET_SOCK_POLL_ID;
+
+#define  NET_SOCK_POLL_ID_NONE                            -1
+
+typedef  CPU_INT08U  NET_SOCK_POLL_OP;
+
+#define  NET_SOCK_POLL_OP_ADD                             1u    /* Register   sock with    poll set.                    */
+#define  NET_SOCK_POLL_OP_MOD                             2u    /* Modify     sock events  of interest.                 */
+#define  NET_SOCK_POLL_OP_DEL                             3u    /* Unregister sock from    poll set.                    */
+
+#define  NET_SOCK_POLL_EVENT_FLAG_EDGE         DEF_BIT_07       /* Edge-triggered readiness (see Note #2).              */
+
+
+typedef  struct  net_sock_poll_event {                                  /* Rdy sock rtn'd by NetSock_PollWait().        */
+    NET_SOCK_ID                 SockID;                                 /* Rdy sock id.                                 */
+    NET_SOCK_SEL_EVENT_FLAG     Events;                                 /* Rdy events.                                  */
+    void                       *DataPtr;                                /* App data ptr cfg'd by NetSock_PollCtl().     */
+} NET_SOCK_POLL_EVENT;
+
+
+/*
+*********************************************************************************************************
+*                                  NETWORK SOCKET DATA VECTOR DATA TYPE
+*
+* Note(s) : (1) Socket data vectors describe application data scattered across several application buffers
+*               for NetSock_TxDataVec() & NetSock_RxDataVec(); see 'net_buf.h  NETWORK BUFFER DATA VECTOR
+*               DATA TYPES'.
+*
+*           (2) A data vector's total length MUST NOT exceed the maximum socket data length (65535 octets).
+*********************************************************************************************************
+*/
+
+typedef  NET_BUF_DATA_VEC  NET_SOCK_DATA_VEC;
+
+
+/*
+*********************************************************************************************************
+*                                    NETWORK SOCKET MESSAGE DATA TYPE
+*
+* Note(s) : (1) Socket messages describe one datagram each for NetSock_TxDataMsgs() & NetSock_RxDataMsgs().
+*
+*           (2) 'DataLen' & 'Flags' are returned by the socket layer; 'Flags' returns
+*               NET_SOCK_FLAG_RX_DATA_TRUNC if a received datagram did NOT fit in the message's data vector.
+*********************************************************************************************************
+*/
+
+typedef  struct  net_sock_msg {
+    NET_SOCK_DATA_VEC          *VecPtr;                                 /* Ptr to msg data vec.                         */
+    CPU_INT16U                  VecNbr;                                 /* Nbr of msg data vec elements.                */
+    NET_SOCK_ADDR              *AddrPtr;                                /* Ptr to msg remote addr (optional).           */
+    NET_SOCK_ADDR_LEN           AddrLen;                                /* Len of msg remote addr.                      */
+    CPU_INT16U                  DataLen;                                /* Msg data len   (see Note #2).                */
+    NET_SOCK_API_FLAGS          Flags;                                  /* Msg data flags (see Note #2).                */
+} NET_SOCK_MSG;
+
+
+/*
+*********************************************************************************************************
+*                               NETWORK SOCKET TRANSMIT REFERENCE DATA TYPE
+*
+* Note(s) : (1) Socket transmit references describe application data transmitted in place by
+*               NetSock_TxDataRef(); see 'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES'.
+*
+*           (2) The application configures 'FnctPtr' & 'FnctArgPtr'; 'RefCtr' is managed by the stack.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+typedef  NET_BUF_DATA_EXT_REF  NET_SOCK_TX_REF;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -865,6 +966,15 @@ struct  net_sock {
     NET_SOCK_SEL_OBJ           *SelObjTailPtr;
 #endif
 
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+    NET_SOCK_POLL_ID            PollID;                                 /* Poll set sock is registered with.            */
+    NET_SOCK_SEL_EVENT_FLAG     PollEventsCfgd;                         /* Poll events of interest.                     */
+    NET_SOCK_SEL_EVENT_FLAG     PollEventsPosted;                       /* Poll events posted since last wait.          */
+    CPU_BOOLEAN                 PollRdyListed;                          /* Indicates if sock is on poll set rdy list.   */
+    NET_SOCK                   *PollRdyNextPtr;                         /* Ptr to NEXT sock on poll set rdy list.       */
+    void                       *PollDataPtr;                            /* App data ptr rtn'd with poll events.         */
+#endif
+
     KAL_SEM_HANDLE              RxQ_SignalObj;
     CPU_INT32U                  RxQ_SignalTimeout_ms;
 
@@ -928,6 +1038,20 @@ struct  net_sock {
 };
 
 
+                                                                        /* ----------- NET SOCK EVENT POLL SET -------- */
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+typedef  struct  net_sock_poll_set {
+    KAL_SEM_HANDLE              SignalObj;                              /* Signal for task waiting on poll set.         */
+    NET_SOCK                   *RdyHeadPtr;                             /* Ptr to head of rdy sock list.                */
+    NET_SOCK                   *RdyTailPtr;                             /* Ptr to tail of rdy sock list.                */
+    NET_SOCK_QTY                RdyNbr;                                 /* Nbr of socks on rdy list.                    */
+    NET_SOCK_QTY                SockNbr;                                /* Nbr of socks registered.                     */
+    CPU_BOOLEAN                 Used;                                   /* Indicates if poll set is allocated.          */
+    CPU_BOOLEAN                 WaitPend;                               /* Indicates if a task is waiting on poll set.  */
+} NET_SOCK_POLL_SET;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                  NETWORK SOCKET TIMEOUT DATA TYPE
@@ -1210,7 +1334,7 @@ NET_SOCK_ID         NetSock_Accept                       (       NET_SOCK_ID
 
 NET_SOCK_RTN_CODE   NetSock_RxDataFrom                   (       NET_SOCK_ID                    sock_id,
                                                                  void                          *pdata_buf,
-                                                                 CPU_INT16U                     data_buf_len,
+                                                                 CPU_INT32U                     data_buf_len,
                                                                  NET_SOCK_API_FLAGS             flags,
                                                                  NET_SOCK_ADDR                 *paddr_remote,
                                                                  NET_SOCK_ADDR_LEN             *paddr_len,
@@ -1222,14 +1346,14 @@ NET_SOCK_RTN_CODE   NetSock_RxDataFrom                   (       NET_SOCK_ID
 
 NET_SOCK_RTN_CODE   NetSock_RxData                       (       NET_SOCK_ID                    sock_id,
                                                                  void                          *pdata_buf,
-                                                                 CPU_INT16U                     data_buf_len,
+                                                                 CPU_INT32U                     data_buf_len,
                                                                  NET_SOCK_API_FLAGS             flags,
                                                                  NET_ERR                       *p_err);
 
 
 NET_SOCK_RTN_CODE   NetSock_TxDataTo                     (       NET_SOCK_ID                    sock_id,
                                                                  void                          *p_data,
-                                                                 CPU_INT16U                     data_len,
+                                                                 CPU_INT32U                     data_len,
                                                                  NET_SOCK_API_FLAGS             flags,
                                                                  NET_SOCK_ADDR                 *paddr_remote,
                                                                  NET_SOCK_ADDR_LEN              addr_len,
@@ -1237,10 +1361,62 @@ NET_SOCK_RTN_CODE   NetSock_TxDataTo                     (       NET_SOCK_ID
 
 
 NET_SOCK_RTN_CODE   NetSock_TxData                       (       NET_SOCK_ID                    sock_id,
+                                                                 void                          *p_data,
+                                                                 CPU_INT32U                     data_len,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_ERR                       *p_err);
+
+
+NET_SOCK_RTN_CODE   NetSock_RxDataVec                    (       NET_SOCK_ID                    sock_id,
+                                                                 NET_SOCK_DATA_VEC             *p_vec,
+                                                                 CPU_INT16U                     vec_nbr,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_SOCK_ADDR                 *p_addr_remote,
+                                                                 NET_SOCK_ADDR_LEN             *p_addr_len,
+                                                                 NET_ERR                       *p_err);
+
+
+NET_SOCK_RTN_CODE   NetSock_TxDataVec                    (       NET_SOCK_ID                    sock_id,
+                                                                 NET_SOCK_DATA_VEC             *p_vec,
+                                                                 CPU_INT16U                     vec_nbr,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_SOCK_ADDR                 *p_addr_remote,
+                                                                 NET_SOCK_ADDR_LEN              addr_len,
+                                                                 NET_ERR                       *p_err);
+
+
+NET_SOCK_RTN_CODE   NetSock_RxDataMsgs                   (       NET_SOCK_ID                    sock_id,
+                                                                 NET_SOCK_MSG                  *p_msgs,
+                                                                 CPU_INT16U                     msg_nbr,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_ERR                       *p_err);
+
+
+NET_SOCK_RTN_CODE   NetSock_TxDataMsgs                   (       NET_SOCK_ID                    sock_id,
+                                                                 NET_SOCK_MSG                  *p_msgs,
+                                                                 CPU_INT16U                     msg_nbr,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_ERR                       *p_err);
+
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+NET_SOCK_RTN_CODE   NetSock_TxDataRef                    (       NET_SOCK_ID                    sock_id,
                                                                  void                          *p_data,
                                                                  CPU_INT16U                     data_len,
                                                                  NET_SOCK_API_FLAGS             flags,
+                                                                 NET_SOCK_ADDR                 *p_addr_remote,
+                                                                 NET_SOCK_ADDR_LEN              addr_len,
+                                                                 NET_SOCK_TX_REF               *p_ref,
                                                                  NET_ERR                       *p_err);
+#endif
+
+#ifdef  NET_SOCK_TX_FILE_MODULE_EN
+NET_SOCK_RTN_CODE   NetSock_TxFile                       (       NET_SOCK_ID                    sock_id,
+                                                                 void                          *p_file,
+                                                                 NET_BUF_DATA_FILE_RD_FNCT      rd_fnct,
+                                                                 CPU_INT32U                     len,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_ERR                       *p_err);
+#endif
 
 #if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
 NET_SOCK_RTN_CODE   NetSock_Sel                          (       NET_SOCK_QTY                   sock_nbr_max,
@@ -1255,6 +1431,26 @@ void                NetSock_SelAbort                     (       NET_SOCK_ID
                                                                  NET_ERR                       *p_err);
 #endif /* NET_SOCK_CFG_SEL_EN */
 
+#ifdef  NET_SOCK_EVENT_POLL_MODULE_EN
+NET_SOCK_POLL_ID    NetSock_PollCreate                   (       NET_ERR                       *p_err);
+
+void                NetSock_PollClose                    (       NET_SOCK_POLL_ID               poll_id,
+                                                                 NET_ERR                       *p_err);
+
+void                NetSock_PollCtl                      (       NET_SOCK_POLL_ID               poll_id,
+                                                                 NET_SOCK_POLL_OP               op,
+                                                                 NET_SOCK_ID                    sock_id,
+                                                                 NET_SOCK_SEL_EVENT_FLAG        events,
+                                                                 void                          *p_data,
+                                                                 NET_ERR                       *p_err);
+
+NET_SOCK_RTN_CODE   NetSock_PollWait                     (       NET_SOCK_POLL_ID               poll_id,
+                                                                 NET_SOCK_POLL_EVENT           *p_events,
+                                                                 NET_SOCK_QTY                   events_nbr_max,
+                                                                 CPU_INT32U                     timeout_ms,
+                                                                 NET_ERR                       *p_err);
+#endif /* NET_SOCK_EVENT_POLL_MODULE_EN */
+
 CPU_BOOLEAN         NetSock_IsConn                       (       NET_SOCK_ID                    sock_id,
                                                                  NET_ERR                       *p_err);
 
@@ -1309,6 +1505,12 @@ CPU_BOOLEAN         NetSock_CfgIF                        (       NET_SOCK_ID
                                                                  NET_IF_NBR                     if_nbr,
                                                                  NET_ERR                       *p_err);
 
+#ifdef  NET_SOCK_REUSE_PORT_MODULE_EN                                                   /* Cfg sock local port sharing. */
+CPU_BOOLEAN         NetSock_CfgReusePort                 (       NET_SOCK_ID                    sock_id,
+                                                                 CPU_BOOLEAN                    reuse_port,
+                                                                 NET_ERR                       *p_err);
+#endif
+
                                                                                         /* Cfg sock rx Q size.          */
 CPU_BOOLEAN         NetSock_CfgRxQ_Size                  (       NET_SOCK_ID                    sock_id,
                                                                  NET_SOCK_DATA_SIZE             size,
@@ -1332,6 +1534,24 @@ NET_SOCK_Q_SIZE     NetSock_CfgConnChildQ_SizeGet        (       NET_SOCK_ID
 CPU_BOOLEAN         NetSock_CfgTxNagle                   (       NET_SOCK_ID                    sock_id,
                                                                  CPU_BOOLEAN                    nagle_en,
                                                                  NET_ERR                       *p_err);
+
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+CPU_BOOLEAN         NetSock_CfgTxCork                    (       NET_SOCK_ID                    sock_id,
+                                                                 CPU_BOOLEAN                    cork_en,
+                                                                 NET_ERR                       *p_err);
+#endif
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+CPU_BOOLEAN         NetSock_CfgTxPaceRate                (       NET_SOCK_ID                    sock_id,
+                                                                 CPU_INT32U                     rate_max,
+                                                                 NET_ERR                       *p_err);
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+CPU_BOOLEAN         NetSock_CfgFastOpen                  (       NET_SOCK_ID                    sock_id,
+                                                                 CPU_BOOLEAN                    fast_open,
+                                                                 NET_ERR                       *p_err);
+#endif
 #ifdef  NET_IPv4_MODULE_EN
                                                                                         /* Cfg sock tx IP TOS.          */
 CPU_BOOLEAN         NetSock_CfgTxIP_TOS                  (       NET_SOCK_ID                    sock_id,
@@ -1660,6 +1880,24 @@ CPU_INT32U          NetSock_ConnCloseTimeoutGet_ms   (NET_SOCK     *p_sock,
 #endif
 
 
+#if    ((NET_SOCK_CFG_EVENT_POLL_EN != DEF_DISABLED) && \
+        (NET_SOCK_CFG_EVENT_POLL_EN != DEF_ENABLED ))
+#error  "NET_SOCK_CFG_EVENT_POLL_EN           illegally #define'd in 'net_cfg.h'"
+#error  "                                     [MUST be  DEF_DISABLED]           "
+#error  "                                     [     ||  DEF_ENABLED ]           "
+
+#elif  ((NET_SOCK_CFG_EVENT_POLL_EN == DEF_ENABLED) && \
+        (NET_SOCK_CFG_SEL_EN        != DEF_ENABLED))
+#error  "NET_SOCK_CFG_EVENT_POLL_EN           illegally #define'd in 'net_cfg.h'"
+#error  "                                     [MUST be  DEF_DISABLED when       ]"
+#error  "                                     [NET_SOCK_CFG_SEL_EN DEF_DISABLED ]"
+
+#elif   (NET_SOCK_CFG_EVENT_POLL_NBR < 1u)
+#error  "NET_SOCK_CFG_EVENT_POLL_NBR          illegally #define'd in 'net_cfg.h'"
+#error  "                                     [MUST be  >= 1]                   "
+#endif
+
+
 #ifndef  NET_SOCK_CFG_RX_Q_SIZE_OCTET
 #error  "NET_SOCK_CFG_RX_Q_SIZE_OCTET               not #define'd in 'net_cfg.h'  "
 #error  "                                     [MUST be  >= NET_SOCK_DATA_SIZE_MIN]"
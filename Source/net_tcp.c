@@ -73,7 +73,9 @@
 #include  "../IP/IPv6/net_icmpv6.h"
 #endif
 
-#ifdef  NET_TCP_CFG_RANDOM_ISN_GEN
+#if (defined(NET_TCP_CFG_RANDOM_ISN_GEN)  || \
+     defined(NET_TCP_SYN_CACHE_MODULE_EN) || \
+     defined(NET_TCP_FAST_OPEN_MODULE_EN))
 #include  "../Modules/Common/net_md5.h"
 #endif
 
@@ -106,10 +108,31 @@
 #define  NET_TCP_RX_Q_NAME               "Net TCP Rx Q signal"
 #define  NET_TCP_TX_Q_NAME               "Net TCP Tx Q signal"
 
-#ifdef   NET_TCP_CFG_RANDOM_ISN_GEN
+#if (defined(NET_TCP_CFG_RANDOM_ISN_GEN)  || \
+     defined(NET_TCP_SYN_CACHE_MODULE_EN) || \
+     defined(NET_TCP_FAST_OPEN_MODULE_EN))
 #define  NET_TCP_SECRET_KEY_SIZE                            4u  /* Nbr of 32-bit integers that comprise ISN secret key. */
 #endif
 
+#ifdef  NET_TCP_ISN_SIPHASH_MODULE_EN
+#define  NET_TCP_ISN_KEY_SIZE                               2u  /* Nbr of 64-bit integers that comprise ISN hash key.   */
+
+#define  NET_TCP_ISN_REKEY_TIME_MS                     (NET_TCP_DFLT_ISN_REKEY_TIME_SEC * DEF_TIME_NBR_mS_PER_SEC)
+
+                                                                /* SipHash-2-4 init & final vals.                       */
+#define  NET_TCP_ISN_SIPHASH_INIT_V0                  (((CPU_INT64U)0x736F6D65u << 32u) | (CPU_INT64U)0x70736575u)
+#define  NET_TCP_ISN_SIPHASH_INIT_V1                  (((CPU_INT64U)0x646F7261u << 32u) | (CPU_INT64U)0x6E646F6Du)
+#define  NET_TCP_ISN_SIPHASH_INIT_V2                  (((CPU_INT64U)0x6C796765u << 32u) | (CPU_INT64U)0x6E657261u)
+#define  NET_TCP_ISN_SIPHASH_INIT_V3                  (((CPU_INT64U)0x74656462u << 32u) | (CPU_INT64U)0x79746573u)
+#define  NET_TCP_ISN_SIPHASH_FINAL_V2                     0xFFu
+
+#define  NET_TCP_ISN_SIPHASH_C_ROUNDS                       2u  /* Nbr of compression   rounds per msg blk.             */
+#define  NET_TCP_ISN_SIPHASH_D_ROUNDS                       4u  /* Nbr of finalization  rounds.                         */
+#define  NET_TCP_ISN_SIPHASH_BLK_LEN                        8u  /* Msg blk len (in octets).                             */
+
+#define  NET_TCP_ISN_SIPHASH_ROTL(val, bits)          (((val) << (bits)) | ((val) >> (64u - (bits))))
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -182,6 +205,7 @@
 #define  NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN              DEF_BIT_07
 #define  NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY               DEF_BIT_08
 #define  NET_TCP_CONN_CLOSE_TMR_RE_TX                    DEF_BIT_09
+#define  NET_TCP_CONN_CLOSE_TMR_TX_PACE                  DEF_BIT_10
 
 #define  NET_TCP_CONN_CLOSE_TMR_ALL                     (NET_TCP_CONN_CLOSE_TMR_NONE          | \
                                                          NET_TCP_CONN_CLOSE_TMR_TIMEOUT       | \
@@ -189,7 +213,8 @@
                                                          NET_TCP_CONN_CLOSE_TMR_TX_SILLY_WIN  | \
                                                          NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN   | \
                                                          NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY    | \
-                                                         NET_TCP_CONN_CLOSE_TMR_RE_TX         )
+                                                         NET_TCP_CONN_CLOSE_TMR_RE_TX         | \
+                                                         NET_TCP_CONN_CLOSE_TMR_TX_PACE       )
 
 #define  NET_TCP_CONN_CLOSE_TMR_MASK                     NET_TCP_CONN_CLOSE_TMR_ALL
 
@@ -208,6 +233,7 @@
 #define  NET_TCP_CONN_FREE_TMR_TX_ZERO_WIN               NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN
 #define  NET_TCP_CONN_FREE_TMR_TX_ACK_DLY                NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY
 #define  NET_TCP_CONN_FREE_TMR_RE_TX                     NET_TCP_CONN_CLOSE_TMR_RE_TX
+#define  NET_TCP_CONN_FREE_TMR_TX_PACE                   NET_TCP_CONN_CLOSE_TMR_TX_PACE
 #define  NET_TCP_CONN_FREE_TMR_ALL                       NET_TCP_CONN_CLOSE_TMR_ALL
 #define  NET_TCP_CONN_FREE_TMR_MASK                      NET_TCP_CONN_CLOSE_TMR_MASK
 
@@ -304,7 +330,13 @@ typedef  NET_TCP_CLOSE_CODE  NET_TCP_FREE_CODE;
 
 static  NET_TCP_SEQ_NBR   NetTCP_TxSeqNbrCtr;                   /* Global tx seq nbr ctr.                               */
 
-#ifdef  NET_TCP_CFG_RANDOM_ISN_GEN
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+static  NET_TCP_WIN_SIZE  NetTCP_RxWinTuneTot;                  /* Tot rx win growth of ALL TCP conns (in octets).      */
+#endif
+
+#if (defined(NET_TCP_CFG_RANDOM_ISN_GEN)  || \
+     defined(NET_TCP_SYN_CACHE_MODULE_EN) || \
+     defined(NET_TCP_FAST_OPEN_MODULE_EN))
 static  NET_MD5_CONTEXT   NetTCP_ISN_MD5_Handle;
                                                                 /* 128-bit secret obtained at start-up (See RFC #6528). */
 static  CPU_INT32U        NetTCP_ISN_SecretKey[NET_TCP_SECRET_KEY_SIZE];
@@ -318,6 +350,54 @@ typedef struct            net_tcp_isn_five_tuple {
 } NET_TCP_ISN_FIVE_TUPLE;
 #endif
 
+#ifdef  NET_TCP_ISN_SIPHASH_MODULE_EN                           /* 128-bit ISN hash key (see 'net_tcp.h  TCP ISN ...    */
+                                                                /* ... SIPHASH DEFINES  Note #1').                      */
+static  CPU_INT64U        NetTCP_ISN_Key[NET_TCP_ISN_KEY_SIZE];
+static  NET_TS_MS         NetTCP_ISN_KeyTS_ms;                  /* TS ISN hash key gen'd (in ms).                       */
+#endif
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+                                                                /* TCP SYN cache tbl.                                   */
+static  NET_TCP_SYN_CACHE_ENTRY  NetTCP_SynCacheTbl[NET_TCP_DFLT_SYN_CACHE_NBR_ENTRY];
+
+                                                                /* SYN cookie max seg sizes, in ascending order.  First */
+                                                                /* val is small so that a remote max seg size is NOT    */
+                                                                /* rounded up to a larger max seg size.                 */
+static  const  NET_TCP_SEG_SIZE  NetTCP_SynCookieMaxSegSizeTbl[NET_TCP_SYN_COOKIE_MSS_NBR] = {
+      88u,
+     216u,
+     536u,
+    1220u,
+    1360u,
+    1440u,
+    1460u,
+    8960u
+};
+
+typedef struct            net_tcp_syn_cookie_tuple {
+        CPU_INT08U        AddrLocal [NET_CONN_ADDR_LEN_MAX];
+        CPU_INT08U        AddrRemote[NET_CONN_ADDR_LEN_MAX];
+        NET_TCP_SEQ_NBR   RxSeqNbrSync;
+        CPU_INT32U        TS_Ctr;
+        CPU_INT32U        Secret[NET_TCP_SECRET_KEY_SIZE];
+} NET_TCP_SYN_COOKIE_TUPLE;
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+                                                                /* TCP Fast Open client cookie cache tbl.               */
+static  NET_TCP_FAST_OPEN_CACHE_ENTRY  NetTCP_FastOpenCacheTbl[NET_TCP_DFLT_FAST_OPEN_CACHE_NBR_ENTRY];
+#endif
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+                                                                /* TCP path MTU cache tbl.                              */
+static  NET_TCP_PATH_MTU_CACHE_ENTRY   NetTCP_PathMTU_CacheTbl[NET_TCP_DFLT_PATH_MTU_CACHE_NBR_ENTRY];
+#endif
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+                                                                /* TCP time-wait tbl.                                   */
+static  NET_TCP_TIME_WAIT_ENTRY        NetTCP_TimeWaitTbl[NET_TCP_DFLT_TIME_WAIT_NBR_ENTRY];
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -352,6 +432,21 @@ static  CPU_BOOLEAN         NetTCP_RxPktValidateOptMaxSegSize     (NET_BUF_HDR
                                                                    CPU_INT08U            *p_opt_len,
                                                                    NET_ERR               *p_err);
 
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+static  CPU_BOOLEAN         NetTCP_RxPktValidateOptWinScale       (NET_BUF_HDR           *p_buf_hdr,
+                                                                   CPU_INT08U            *p_opt,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   NET_ERR               *p_err);
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  CPU_BOOLEAN         NetTCP_RxPktValidateOptFastOpen       (NET_BUF_HDR           *p_buf_hdr,
+                                                                   CPU_INT08U            *p_opt,
+                                                                   CPU_INT16U             opt_ix,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   NET_ERR               *p_err);
+#endif
+
 
 
 static  void                NetTCP_RxPktDemuxSeg                  (NET_BUF               *p_buf,
@@ -370,6 +465,61 @@ static  void                NetTCP_RxPktConnHandlerListen         (NET_TCP_CONN
                                                                    NET_BUF_HDR           *p_buf_hdr,
                                                                    NET_ERR               *p_err);
 
+static  NET_TCP_CONN       *NetTCP_RxPktConnHandlerListenClone    (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF_HDR           *p_buf_hdr,
+                                                                   NET_CONN_ID           *p_conn_id_app,
+                                                                   NET_ERR               *p_err);
+
+#ifdef  NET_IP_MODULE_EN
+static  void                NetTCP_RxPktConnAddrsGet              (NET_BUF_HDR           *p_buf_hdr,
+                                                                   CPU_INT08U            *p_addr_local,
+                                                                   CPU_INT08U            *p_addr_remote);
+#endif
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  void                NetTCP_SynCacheRxSync                 (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF_HDR           *p_buf_hdr,
+                                                                   NET_ERR               *p_err);
+
+static  CPU_BOOLEAN         NetTCP_SynCacheRxAck                  (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF               *p_buf,
+                                                                   NET_BUF_HDR           *p_buf_hdr,
+                                                                   NET_ERR               *p_err);
+
+static  NET_TCP_SYN_CACHE_ENTRY  *NetTCP_SynCacheSrch             (NET_TCP_CONN          *p_conn,
+                                                                   CPU_INT08U            *p_addr_local,
+                                                                   CPU_INT08U            *p_addr_remote,
+                                                                   NET_TS_MS              ts_ms);
+
+static  NET_TCP_SYN_CACHE_ENTRY  *NetTCP_SynCacheGet              (NET_TS_MS              ts_ms);
+
+static  NET_TCP_SEQ_NBR     NetTCP_SynCookieGet                   (CPU_INT08U            *p_addr_local,
+                                                                   CPU_INT08U            *p_addr_remote,
+                                                                   NET_TCP_SEQ_NBR        seq_nbr_sync,
+                                                                   NET_TCP_SEG_SIZE       max_seg_size,
+                                                                   NET_TS_MS              ts_ms);
+
+static  NET_TCP_SEG_SIZE    NetTCP_SynCookieChk                   (CPU_INT08U            *p_addr_local,
+                                                                   CPU_INT08U            *p_addr_remote,
+                                                                   NET_TCP_SEQ_NBR        seq_nbr_sync,
+                                                                   NET_TCP_SEQ_NBR        cookie,
+                                                                   NET_TS_MS              ts_ms);
+
+static  CPU_INT32U          NetTCP_SynCookieHashGet               (CPU_INT08U            *p_addr_local,
+                                                                   CPU_INT08U            *p_addr_remote,
+                                                                   NET_TCP_SEQ_NBR        seq_nbr_sync,
+                                                                   CPU_INT32U             ts_ctr);
+#endif
+
+#ifdef  NET_TCP_ISN_SIPHASH_MODULE_EN
+static  void                NetTCP_ISN_KeyGen                     (void);
+
+static  CPU_INT64U          NetTCP_ISN_SipHash                    (CPU_INT08U            *p_data,
+                                                                   CPU_INT16U             data_len);
+
+static  void                NetTCP_ISN_SipHashRound               (CPU_INT64U            *p_v);
+#endif
+
 static  void                NetTCP_RxPktConnHandlerSyncRxd        (NET_TCP_CONN          *p_conn,
                                                                    NET_BUF               *p_buf,
                                                                    NET_BUF_HDR           *p_buf_hdr,
@@ -380,6 +530,58 @@ static  void                NetTCP_RxPktConnHandlerSyncTxd        (NET_TCP_CONN
                                                                    NET_BUF_HDR           *p_buf_hdr,
                                                                    NET_ERR               *p_err);
 
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+static  void                NetTCP_RxConnWinScaleCfg              (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF_HDR           *p_buf_hdr);
+#endif
+
+#ifdef  NET_TCP_ECN_MODULE_EN
+static  void                NetTCP_RxConnECN_Cfg                  (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF_HDR           *p_buf_hdr);
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  CPU_BOOLEAN         NetTCP_RxConnFastOpenChk              (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF               *p_buf,
+                                                                   NET_BUF_HDR           *p_buf_hdr);
+
+static  CPU_BOOLEAN         NetTCP_RxConnFastOpenCfg              (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF               *p_buf,
+                                                                   NET_BUF_HDR           *p_buf_hdr,
+                                                                   NET_TCP_ACK_CODE       ack_code);
+
+static  void                NetTCP_FastOpenCookieGet              (CPU_INT08U            *p_addr_remote,
+                                                                   CPU_INT08U            *p_cookie);
+
+static  NET_TCP_FAST_OPEN_CACHE_ENTRY  *NetTCP_FastOpenCacheSrch  (CPU_INT08U            *p_addr_remote);
+
+static  void                NetTCP_FastOpenCacheUpdate            (CPU_INT08U            *p_addr_remote,
+                                                                   CPU_INT08U            *p_cookie,
+                                                                   CPU_INT08U             cookie_len);
+#endif
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void                NetTCP_RxPathMTU_Handler              (NET_CONN_FAMILY        family,
+                                                                   NET_CONN_PROTOCOL_IX   protocol_ix,
+                                                                   CPU_INT08U            *p_addr_local,
+                                                                   CPU_INT08U            *p_addr_remote,
+                                                                   NET_CONN_ADDR_LEN      addr_len,
+                                                                   NET_TCP_HDR           *p_tcp_hdr,
+                                                                   CPU_INT32U             mtu);
+#endif
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  CPU_BOOLEAN         NetTCP_RxPktTimeWait                  (NET_BUF_HDR           *p_buf_hdr,
+                                                                   NET_CONN_FAMILY        family,
+                                                                   CPU_INT08U            *p_addr_local,
+                                                                   CPU_INT08U            *p_addr_remote);
+
+static  NET_TCP_TIME_WAIT_ENTRY  *NetTCP_TimeWaitSrch             (NET_CONN_FAMILY        family,
+                                                                   CPU_INT08U            *p_addr_local,
+                                                                   CPU_INT08U            *p_addr_remote,
+                                                                   NET_TS_MS              ts_ms);
+#endif
+
 static  void                NetTCP_RxPktConnHandlerConn           (NET_TCP_CONN          *p_conn,
                                                                    NET_BUF               *p_buf,
                                                                    NET_BUF_HDR           *p_buf_hdr,
@@ -422,6 +624,12 @@ static  void                NetTCP_RxPktConnHandlerSeg            (NET_TCP_CONN
                                                                    NET_BUF_HDR           *p_buf_hdr,
                                                                    NET_ERR               *p_err);
 
+#ifdef  NET_TCP_ECN_MODULE_EN
+static  void                NetTCP_RxPktConnHandlerECN            (NET_TCP_CONN          *p_conn,
+                                                                   NET_TCP_ACK_CODE       ack_code,
+                                                                   NET_BUF_HDR           *p_buf_hdr);
+#endif
+
 
 
 static  void                NetTCP_RxPktConnHandlerCfgConn        (NET_TCP_CONN          *p_conn);
@@ -499,6 +707,15 @@ static  void                NetTCP_RxConnWinSizeHandler           (NET_TCP_CONN
                                                                    CPU_INT16U             nbr_buf,
                                                                    NET_TCP_WIN_CODE       win_update_code);
 
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+static  void                NetTCP_RxConnWinSizeTune              (NET_TCP_CONN          *p_conn,
+                                                                   NET_TCP_WIN_SIZE       data_len);
+
+static  void                NetTCP_RxConnWinSizeTuneRTT           (NET_TCP_CONN          *p_conn);
+
+static  void                NetTCP_RxConnWinSizeTuneRelease       (NET_TCP_CONN          *p_conn);
+#endif
+
 
 
                                                                 /* --------------------- TX FNCTS --------------------- */
@@ -556,8 +773,17 @@ static  void                NetTCP_TxConnWinSizeZeroWinTimeout    (void
 static  void                NetTCP_TxConnSync                     (NET_TCP_CONN          *p_conn,
                                                                    NET_BUF_HDR           *p_buf_hdr,
                                                                    NET_TCP_CONN_STATE     state,
+                                                                   void                  *p_data,
+                                                                   CPU_INT16U             data_len_req,
                                                                    NET_ERR               *p_err);
 
+static  NET_TCP_WIN_SIZE    NetTCP_TxConnWinSizeHdrGet            (NET_TCP_CONN          *p_conn,
+                                                                   NET_TCP_FLAGS          flags_tcp);
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+static  CPU_INT08U          NetTCP_ConnWinScaleCalc               (NET_TCP_WIN_SIZE       win_size);
+#endif
+
 static  void                NetTCP_TxConnClose                    (NET_TCP_CONN          *p_conn,
                                                                    NET_TCP_CONN_STATE     state,
                                                                    NET_ERR               *p_err);
@@ -574,6 +800,10 @@ static  void                NetTCP_TxConnAckDlyReset              (NET_TCP_CONN
 
 static  void                NetTCP_TxConnAckDlyTimeout            (void                  *p_conn_timeout);
 
+#ifdef  NET_TCP_ACK_ADAPT_MODULE_EN
+static  CPU_INT16U          NetTCP_TxConnAckDlyCntTh              (NET_TCP_CONN          *p_conn);
+#endif
+
 
 static  void                NetTCP_TxConnReset                    (NET_TCP_CONN          *p_conn,
                                                                    NET_BUF_HDR           *p_buf_hdr,
@@ -581,6 +811,21 @@ static  void                NetTCP_TxConnReset                    (NET_TCP_CONN
                                                                    NET_TCP_CLOSE_CODE     close_code,
                                                                    NET_ERR               *p_err);
 
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  void                NetTCP_TxSynCacheSync                 (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF_HDR           *p_buf_hdr,
+                                                                   NET_TCP_SEQ_NBR        seq_nbr,
+                                                                   CPU_BOOLEAN            win_scale_en,
+                                                                   CPU_BOOLEAN            ecn_en,
+                                                                   NET_ERR               *p_err);
+#endif
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  void                NetTCP_TxTimeWaitAck                  (NET_TCP_TIME_WAIT_ENTRY  *p_entry,
+                                                                   NET_BUF_HDR           *p_buf_hdr,
+                                                                   NET_ERR               *p_err);
+#endif
+
 
 static  void                NetTCP_TxConnProbe                    (NET_TCP_CONN          *p_conn,
                                                                    CPU_BOOLEAN            tx_probe_data_octet,
@@ -614,6 +859,10 @@ static  void                NetTCP_TxConnTxQ_TimeoutIdleClr       (NET_TCP_CONN
 
 static  void                NetTCP_TxConnTxQ_TimeoutSillyWin      (void                  *p_conn_timeout);
 
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+static  void                NetTCP_TxConnTxQ_TimeoutPace          (void                  *p_conn_timeout);
+#endif
+
 
 
 static  void                NetTCP_TxConnReTxQ                    (NET_TCP_CONN          *p_conn,
@@ -629,6 +878,36 @@ static  void                NetTCP_TxConnReTxQ_TimeoutSet         (NET_TCP_CONN
                                                                    NET_TCP_CLOSE_CODE     close_code,
                                                                    NET_ERR               *p_err);
 
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+static  void                NetTCP_TxConnReTxQ_IdxAdd             (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF               *p_seg);
+
+static  void                NetTCP_TxConnReTxQ_IdxBuild           (NET_TCP_CONN          *p_conn);
+
+static  NET_BUF            *NetTCP_TxConnReTxQ_IdxRemove          (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF_HDR           *p_buf_hdr,
+                                                                   NET_BUF              **p_seg_prev,
+                                                                   NET_TCP_WIN_SIZE      *p_seg_len_data);
+#endif
+
+#ifdef  NET_TCP_RACK_MODULE_EN
+static  void                NetTCP_TxConnRACK_Update              (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF_HDR           *p_seg_hdr,
+                                                                   NET_TCP_TX_RTT_TS_MS   ts_rxd_ms);
+
+static  void                NetTCP_TxConnRACK_DetectLoss          (NET_TCP_CONN          *p_conn,
+                                                                   NET_TCP_TX_RTT_TS_MS   ts_rxd_ms,
+                                                                   NET_ERR               *p_err);
+
+static  NET_TMR_TICK        NetTCP_TxConnTLP_TimeoutGet           (NET_TCP_CONN          *p_conn,
+                                                                   CPU_BOOLEAN            re_tx_q_timeout);
+#endif
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+static  NET_TMR_TICK        NetTCP_TxConnTxPaceDlyGet             (NET_TCP_CONN          *p_conn,
+                                                                   NET_TCP_SEG_SIZE       seg_len);
+#endif
+
 
 
 static  void                NetTCP_TxConnPrepareSegAddrs          (NET_TCP_CONN          *p_conn,
@@ -727,6 +1006,22 @@ static  void                NetTCP_TxPktValidateOptMaxSegSize     (void
                                                                    void                 **p_opt_next,
                                                                    NET_TCP_FLAGS          flags_tcp,
                                                                    NET_ERR               *p_err);
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+static  void                NetTCP_TxPktValidateOptWinScale       (void                  *p_opt_tcp,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_TCP_FLAGS          flags_tcp,
+                                                                   NET_ERR               *p_err);
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  void                NetTCP_TxPktValidateOptFastOpen       (void                  *p_opt_tcp,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_TCP_FLAGS          flags_tcp,
+                                                                   NET_ERR               *p_err);
+#endif
 #endif
 
 
@@ -778,6 +1073,22 @@ static  void                NetTCP_TxPktPrepareOptMaxSegSize      (void
                                                                    void                 **p_opt_next,
                                                                    NET_ERR               *p_err);
 
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+static  void                NetTCP_TxPktPrepareOptWinScale        (void                  *p_opts_tcp,
+                                                                   CPU_INT08U            *p_opt_hdr,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_ERR               *p_err);
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  void                NetTCP_TxPktPrepareOptFastOpen        (void                  *p_opts_tcp,
+                                                                   CPU_INT08U            *p_opt_hdr,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_ERR               *p_err);
+#endif
+
 static  void                NetTCP_TxPktPrepareHdr                (NET_BUF               *p_buf,
                                                                    NET_BUF_HDR           *p_buf_hdr,
                                                                    CPU_INT16U             tcp_hdr_len_tot,
@@ -811,6 +1122,33 @@ static  void                NetTCP_ConnCfg                        (NET_TCP_CONN
 
 static  void                NetTCP_ConnCfgMaxSegSize              (NET_TCP_CONN          *p_conn);
 
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void                NetTCP_ConnPathMTU_Init               (NET_TCP_CONN          *p_conn);
+
+static  void                NetTCP_ConnPathMTU_Set                (NET_TCP_CONN          *p_conn,
+                                                                   CPU_INT32U             mtu);
+
+static  void                NetTCP_ConnPathMTU_BlackHole          (NET_TCP_CONN          *p_conn,
+                                                                   NET_TCP_SEG_SIZE       seg_len_data);
+
+static  void                NetTCP_ConnPathMTU_Age                (NET_TCP_CONN          *p_conn);
+
+static  CPU_INT16U          NetTCP_ConnPathMTU_HdrSizeGet         (NET_TCP_CONN          *p_conn,
+                                                                   CPU_INT32U            *p_mtu_min);
+
+static  NET_TCP_PATH_MTU_CACHE_ENTRY  *NetTCP_PathMTU_CacheSrch   (CPU_INT08U            *p_addr_remote);
+
+static  void                NetTCP_PathMTU_CacheUpdate            (CPU_INT08U            *p_addr_remote,
+                                                                   NET_TCP_SEG_SIZE       max_seg_size,
+                                                                   NET_TS_MS              ts_ms);
+#endif
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  void                NetTCP_ConnTimeWaitCompact            (NET_TCP_CONN          *p_conn);
+
+static  NET_TCP_TIME_WAIT_ENTRY  *NetTCP_TimeWaitGet              (NET_TS_MS              ts_ms);
+#endif
+
 
 
 static  void                NetTCP_ConnIdleTimeout                (void                  *p_conn_timeout);
@@ -899,12 +1237,20 @@ void  NetTCP_Init (NET_ERR  *p_err)
 
                                                                 /* --------------- PERFORM TCP/BSP INIT --------------- */
     NetTCP_TxSeqNbrCtr = NetUtil_InitSeqNbrGet();               /* Init tx seq nbr ctr. User must increment every 4 uS. */
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+    NetTCP_RxWinTuneTot = 0u;                                   /* Init tot rx win growth.                              */
+#endif
 
-#ifdef  NET_TCP_CFG_RANDOM_ISN_GEN                              /* Populate secret key. (See RFC #6528).                */
+#if (defined(NET_TCP_CFG_RANDOM_ISN_GEN)  || \
+     defined(NET_TCP_SYN_CACHE_MODULE_EN) || \
+     defined(NET_TCP_FAST_OPEN_MODULE_EN))                      /* Populate secret key. (See RFC #6528).                */
     for (int i = 0; i < (sizeof(NetTCP_ISN_SecretKey) / sizeof(CPU_INT32U)); i++) {
          NetTCP_ISN_SecretKey[i] = NetUtil_RandomRangeGet(0u, DEF_INT_32U_MAX_VAL);
     }
 #endif
+#ifdef  NET_TCP_ISN_SIPHASH_MODULE_EN
+    NetTCP_ISN_KeyGen();                                        /* Gen ISN hash key.                                    */
+#endif
 
                                                                 /* ------------- INIT TCP CONN POOL/STATS ------------- */
     NetTCP_ConnPoolPtr = DEF_NULL;                              /* Init-clr TCP conn pool (see Note #2b).               */
@@ -993,6 +1339,31 @@ void  NetTCP_Init (NET_ERR  *p_err)
     }
 
 
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN                             /* ---------------- INIT TCP SYN CACHE ---------------- */
+    for (i = 0; i < (NET_TCP_CONN_QTY)NET_TCP_DFLT_SYN_CACHE_NBR_ENTRY; i++) {
+        NetTCP_SynCacheTbl[i].ConnID_Listen = NET_TCP_CONN_ID_NONE;  /* Init each SYN cache entry as free.              */
+    }
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN                             /* ------------- INIT TCP FAST OPEN CACHE ------------- */
+    for (i = 0; i < (NET_TCP_CONN_QTY)NET_TCP_DFLT_FAST_OPEN_CACHE_NBR_ENTRY; i++) {
+        NetTCP_FastOpenCacheTbl[i].CookieLen = NET_TCP_FAST_OPEN_COOKIE_LEN_NONE;   /* Init each cache entry as free.   */
+    }
+#endif
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN                              /* -------------- INIT TCP PATH MTU CACHE ------------- */
+    for (i = 0; i < (NET_TCP_CONN_QTY)NET_TCP_DFLT_PATH_MTU_CACHE_NBR_ENTRY; i++) {
+        NetTCP_PathMTU_CacheTbl[i].MaxSegSize = NET_TCP_MAX_SEG_SIZE_NONE;          /* Init each cache entry as free.   */
+    }
+#endif
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN                             /* ---------------- INIT TCP TIME-WAIT ---------------- */
+    for (i = 0; i < (NET_TCP_CONN_QTY)NET_TCP_DFLT_TIME_WAIT_NBR_ENTRY; i++) {
+        NetTCP_TimeWaitTbl[i].Family = NET_CONN_FAMILY_NONE;    /* Init each time-wait entry as free.                   */
+    }
+#endif
+
+
    *p_err = NET_TCP_ERR_NONE;
 
 exit:
@@ -1950,6 +2321,15 @@ void  NetTCP_Rx (NET_BUF  *p_buf,
              break;
 
 
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+        case NET_TCP_ERR_CONN_DATA_NONE:                        /* Pkt handled by time-wait entry ...                   */
+             NetTCP_RxPktFree(p_buf);                           /* ... (see 'NetTCP_RxPktDemuxSeg()  Note #4').         */
+             NET_CTR_STAT_INC(Net_StatCtrs.TCP.RxSegCompCtr);
+            *p_err = NET_TCP_ERR_NONE;
+             return;
+#endif
+
+
         case NET_CONN_ERR_INVALID_FAMILY:
         case NET_CONN_ERR_INVALID_CONN:
         case NET_ERR_RX_DEST:
@@ -1990,6 +2370,125 @@ void  NetTCP_Rx (NET_BUF  *p_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetTCP_RxPathMTU_IPv4()
+*
+* Description : Handle a path MTU reported by an ICMPv4 'Fragmentation Needed' message for a transmitted
+*               TCP segment.
+*
+* Argument(s) : addr_src        Source      IPv4 address of the quoted TCP segment.
+*
+*               addr_dest       Destination IPv4 address of the quoted TCP segment.
+*
+*               p_tcp_hdr       Pointer to the quoted TCP segment's header (see Note #1).
+*
+*               mtu             Path MTU reported by the ICMPv4 message (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetICMPv4_RxMsgErrDemux().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) ONLY the quoted TCP segment's ports & sequence number are accessed since an ICMP error
+*                   message is ONLY guaranteed to quote the first 64 bits of the segment's header (see
+*                   RFC #1122, Section 3.2.2).
+*
+*               (2) See 'net_tcp.h  TCP PATH MTU DISCOVERY DEFINES  Note #1'.
+*********************************************************************************************************
+*/
+
+#if (defined(NET_TCP_PATH_MTU_MODULE_EN) && \
+     defined(NET_IPv4_MODULE_EN))
+void  NetTCP_RxPathMTU_IPv4 (NET_IPv4_ADDR   addr_src,
+                             NET_IPv4_ADDR   addr_dest,
+                             NET_TCP_HDR    *p_tcp_hdr,
+                             CPU_INT32U      mtu)
+{
+    CPU_INT08U  addr_local [NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U  addr_remote[NET_CONN_ADDR_LEN_MAX];
+
+
+    Mem_Clr(&addr_local[0],  NET_CONN_ADDR_LEN_MAX);
+    Mem_Clr(&addr_remote[0], NET_CONN_ADDR_LEN_MAX);
+                                                                /* Cfg srch local  addr as quoted seg src  addr.        */
+    Mem_Copy(&addr_local [NET_CONN_ADDR_IP_IX_PORT], &p_tcp_hdr->PortSrc,  NET_CONN_ADDR_IP_LEN_PORT);
+    NET_UTIL_VAL_COPY_SET_NET_32(&addr_local [NET_CONN_ADDR_IP_V4_IX_ADDR], &addr_src);
+                                                                /* Cfg srch remote addr as quoted seg dest addr.        */
+    Mem_Copy(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], &p_tcp_hdr->PortDest, NET_CONN_ADDR_IP_LEN_PORT);
+    NET_UTIL_VAL_COPY_SET_NET_32(&addr_remote[NET_CONN_ADDR_IP_V4_IX_ADDR], &addr_dest);
+
+    NetTCP_RxPathMTU_Handler(NET_CONN_FAMILY_IP_V4_SOCK,
+                             NET_CONN_PROTOCOL_IX_IP_V4_TCP,
+                            &addr_local[0],
+                            &addr_remote[0],
+                             NET_SOCK_ADDR_LEN_IP_V4,
+                             p_tcp_hdr,
+                             mtu);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_RxPathMTU_IPv6()
+*
+* Description : Handle a path MTU reported by an ICMPv6 'Packet Too Big' message for a transmitted TCP
+*               segment.
+*
+* Argument(s) : p_addr_src      Pointer to source      IPv6 address of the quoted TCP segment.
+*
+*               p_addr_dest     Pointer to destination IPv6 address of the quoted TCP segment.
+*
+*               p_tcp_hdr       Pointer to the quoted TCP segment's header (see 'NetTCP_RxPathMTU_IPv4()
+*                                   Note #1').
+*
+*               mtu             Path MTU reported by the ICMPv6 message (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetICMPv6_RxMsgErrDemux().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) See 'net_tcp.h  TCP PATH MTU DISCOVERY DEFINES  Note #1'.
+*********************************************************************************************************
+*/
+
+#if (defined(NET_TCP_PATH_MTU_MODULE_EN) && \
+     defined(NET_IPv6_MODULE_EN))
+void  NetTCP_RxPathMTU_IPv6 (NET_IPv6_ADDR  *p_addr_src,
+                             NET_IPv6_ADDR  *p_addr_dest,
+                             NET_TCP_HDR    *p_tcp_hdr,
+                             CPU_INT32U      mtu)
+{
+    CPU_INT08U  addr_local [NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U  addr_remote[NET_CONN_ADDR_LEN_MAX];
+
+
+    Mem_Clr(&addr_local[0],  NET_CONN_ADDR_LEN_MAX);
+    Mem_Clr(&addr_remote[0], NET_CONN_ADDR_LEN_MAX);
+                                                                /* Cfg srch local  addr as quoted seg src  addr.        */
+    Mem_Copy(&addr_local [NET_CONN_ADDR_IP_IX_PORT],    &p_tcp_hdr->PortSrc,  NET_CONN_ADDR_IP_LEN_PORT);
+    Mem_Copy(&addr_local [NET_CONN_ADDR_IP_V6_IX_ADDR],  p_addr_src,          NET_IPv6_ADDR_SIZE);
+                                                                /* Cfg srch remote addr as quoted seg dest addr.        */
+    Mem_Copy(&addr_remote[NET_CONN_ADDR_IP_IX_PORT],    &p_tcp_hdr->PortDest, NET_CONN_ADDR_IP_LEN_PORT);
+    Mem_Copy(&addr_remote[NET_CONN_ADDR_IP_V6_IX_ADDR],  p_addr_dest,         NET_IPv6_ADDR_SIZE);
+
+    NetTCP_RxPathMTU_Handler(NET_CONN_FAMILY_IP_V6_SOCK,
+                             NET_CONN_PROTOCOL_IX_IP_V6_TCP,
+                            &addr_local[0],
+                            &addr_remote[0],
+                             NET_SOCK_ADDR_LEN_IP_V6,
+                             p_tcp_hdr,
+                             mtu);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         NetTCP_RxAppData()
@@ -2017,6 +2516,8 @@ void  NetTCP_Rx (NET_BUF  *p_buf,
 *                                   NET_TCP_FLAG_RX_DATA_PEEK       Receive TCP application data without consuming
 *                                                                       the data; i.e. data NOT removed from TCP
 *                                                                       connection's application receive queue(s).
+*                                   NET_TCP_FLAG_RX_DATA_VEC        Receive TCP application data into a data
+*                                                                       vector cursor (see Note #8).
 *                                   NET_TCP_FLAG_RX_BLOCK           Receive TCP application data with blocking,
 *                                                                       if flag set; without blocking, if clear.
 *
@@ -2231,6 +2732,15 @@ void  NetTCP_Rx (NET_BUF  *p_buf,
 *                       application receive queue which also prevents the TCP connection from receiving
 *                       additional application data.  Thus exception handling code in the application layer
 *                       SHOULD eventually detect & close any TCP connection deadlocked due to internal errors.
+*
+*               (8) If NET_TCP_FLAG_RX_DATA_VEC is set, 'pdata_buf' points to a data vector cursor (see
+*                   'net_buf.h  NETWORK BUFFER DATA VECTOR DATA TYPES') & 'data_buf_len' is the total length
+*                   of the data vector; segment data is scattered directly into the data vector's application
+*                   buffers.
+*
+*               (9) If receive window auto-tuning is enabled, the TCP connection's configured receive window
+*                   size is tuned to the rate at which the application reads received data PRIOR to updating
+*                   the receive window (see 'NetTCP_RxConnWinSizeTune()  Note #2').
 *********************************************************************************************************
 */
 
@@ -2249,6 +2759,7 @@ CPU_INT16U  NetTCP_RxAppData (NET_TCP_CONN_ID   conn_id_tcp,
     CPU_BOOLEAN        q_closed_empty     = DEF_NO;
     CPU_BOOLEAN        q_prevly_empty     = DEF_NO;
     CPU_BOOLEAN        peek               = DEF_NO;
+    CPU_BOOLEAN        data_vec           = DEF_NO;
     CPU_BOOLEAN        frag_adv           = DEF_NO;
     NET_TCP_CONN      *p_conn             = DEF_NULL;
     NET_BUF           *p_buf_head         = DEF_NULL;
@@ -2388,6 +2899,7 @@ CPU_INT16U  NetTCP_RxAppData (NET_TCP_CONN_ID   conn_id_tcp,
     p_buf_seg          = (NET_BUF       *)p_buf_head;
     p_buf_seg_prev     = (NET_BUF       *)0;
     p_data            = (CPU_INT08U    *)pdata_buf;
+    data_vec          =  DEF_BIT_IS_SET(flags, NET_TCP_FLAG_RX_DATA_VEC);
     data_len_buf_rem  = (CPU_INT16U     )data_buf_len;
     data_len_tot      = (CPU_INT16U     )0u;
     p_buf_seg_next     = (NET_BUF       *)0;
@@ -2476,17 +2988,25 @@ CPU_INT16U  NetTCP_RxAppData (NET_TCP_CONN_ID   conn_id_tcp,
             data_ix_pkt  = (NET_BUF_SIZE)p_buf_frag_hdr->DataIx + data_ix_frag;
             data_ix_frag =  0u;
 
-            NetBuf_DataRd((NET_BUF    *) p_buf_frag,
-                          (NET_BUF_SIZE) data_ix_pkt,
-                          (NET_BUF_SIZE) data_len_pkt,
-                          (CPU_INT08U *) p_data,
-                          (NET_ERR    *)&err);
+            if (data_vec == DEF_YES) {                          /* See Note #8.                                         */
+                NetBuf_DataRdVec((NET_BUF                 *) p_buf_frag,
+                                 (NET_BUF_SIZE             ) data_ix_pkt,
+                                 (NET_BUF_SIZE             ) data_len_pkt,
+                                 (NET_BUF_DATA_VEC_CURSOR *) pdata_buf,
+                                 (NET_ERR                 *)&err);
+            } else {
+                NetBuf_DataRd((NET_BUF    *) p_buf_frag,
+                              (NET_BUF_SIZE) data_ix_pkt,
+                              (NET_BUF_SIZE) data_len_pkt,
+                              (CPU_INT08U *) p_data,
+                              (NET_ERR    *)&err);
+                p_data += data_len_pkt;                         /* MUST NOT cast ptr operand (see Note #5b).            */
+            }
             if ( err != NET_BUF_ERR_NONE) {                     /* See Note #6b.                                        */
                *p_err  = NET_TCP_ERR_CONN_FAIL;
                 return (0u);
             }
-                                                                /* Update data ptr & lens.                              */
-            p_data           +=             data_len_pkt;       /* MUST NOT cast ptr operand (see Note #5b).            */
+                                                                /* Update data lens.                                    */
             data_len_tot     += (CPU_INT16U)data_len_pkt;
             data_len_buf_rem -= (CPU_INT16U)data_len_pkt;
             seg_len_data_tot += (CPU_INT16U)data_len_pkt;
@@ -2583,6 +3103,9 @@ CPU_INT16U  NetTCP_RxAppData (NET_TCP_CONN_ID   conn_id_tcp,
         }
 
                                                                 /* ----------- UPDATE TCP CONN RX WIN SIZE ------------ */
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+        NetTCP_RxConnWinSizeTune(p_conn, data_len_tot);         /* Auto-tune TCP conn's rx win size (see Note #9).      */
+#endif
                                                                 /* Inc TCP conn's rx win size (see Note #6).            */
 #ifdef  NET_TCP_CFG_OLD_WINDOW_MGMT_EN
         NetTCP_RxConnWinSizeHandler(p_conn, DEF_NULL, data_len_tot, NET_TCP_CONN_RX_WIN_INC);
@@ -2626,6 +3149,11 @@ CPU_INT16U  NetTCP_RxAppData (NET_TCP_CONN_ID   conn_id_tcp,
 *
 * Argument(s) : conn_id_tcp     Handle identifier of TCP connection to transmit connection request.
 *
+*               p_data          Pointer to application data to transmit with the connection request, if any
+*                                   (see Note #3).
+*
+*               data_len        Length of application data (in octets).
+*
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_TCP_ERR_CONN_NOT_USED           TCP connection NOT currently used.
@@ -2651,7 +3179,9 @@ CPU_INT16U  NetTCP_RxAppData (NET_TCP_CONN_ID   conn_id_tcp,
 *                               NET_ERR_IF_LINK_DOWN                Network  interface link state down (i.e.
 *                                                                       NOT available for receive or transmit).
 *
-* Return(s)   : none.
+* Return(s)   : Number of data octets transmitted with connection request (see Note #3), if NO error(s).
+*
+*               0,                                                                       otherwise.
 *
 * Caller(s)   : NetSock_ConnHandlerStream().
 *
@@ -2660,20 +3190,28 @@ CPU_INT16U  NetTCP_RxAppData (NET_TCP_CONN_ID   conn_id_tcp,
 *
 * Note(s)     : (2) On ANY error(s), return error to TCP connection caller & allow caller to retry or close
 *                   connection(s) but do NOT close TCP connection.
+*
+*               (3) Application data is ONLY transmitted with the connection request if TCP Fast Open is
+*                   enabled on the TCP connection & a cookie is cached for the remote host; any remaining
+*                   application data MUST be transmitted once the connection is established (see
+*                   'NetTCP_TxConnSync()  Note #10').
 *********************************************************************************************************
 */
 
-void  NetTCP_TxConnReq (NET_TCP_CONN_ID   conn_id_tcp,
-                        NET_ERR          *p_err)
+CPU_INT16U  NetTCP_TxConnReq (NET_TCP_CONN_ID   conn_id_tcp,
+                              void             *p_data,
+                              CPU_INT16U        data_len,
+                              NET_ERR          *p_err)
 {
     NET_TCP_CONN        *p_conn;
     NET_TCP_CONN_STATE   state;
+    CPU_INT16U           data_len_txd;
 
 
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
    (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
     if (*p_err != NET_TCP_ERR_NONE) {
-         return;
+         return (0u);
     }
 #endif
 
@@ -2684,7 +3222,7 @@ void  NetTCP_TxConnReq (NET_TCP_CONN_ID   conn_id_tcp,
         case NET_TCP_CONN_STATE_FREE:
              NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
             *p_err = NET_TCP_ERR_CONN_NOT_USED;
-             return;
+             return (0u);
 
 
         case NET_TCP_CONN_STATE_CLOSED:
@@ -2706,7 +3244,7 @@ void  NetTCP_TxConnReq (NET_TCP_CONN_ID   conn_id_tcp,
         case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
              NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
             *p_err = NET_TCP_ERR_INVALID_CONN_OP;
-             return;
+             return (0u);
 
 
         case NET_TCP_CONN_STATE_NONE:
@@ -2717,7 +3255,7 @@ void  NetTCP_TxConnReq (NET_TCP_CONN_ID   conn_id_tcp,
                               (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_CONN_ALL);
              NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
             *p_err = NET_TCP_ERR_INVALID_CONN_STATE;
-             return;
+             return (0u);
     }
 #endif
 
@@ -2731,13 +3269,23 @@ void  NetTCP_TxConnReq (NET_TCP_CONN_ID   conn_id_tcp,
     NetTCP_TxConnSync((NET_TCP_CONN     *)p_conn,
                       (NET_BUF_HDR      *)0,
                       (NET_TCP_CONN_STATE)state,
+                      (void             *)p_data,
+                      (CPU_INT16U        )data_len,
                       (NET_ERR          *)p_err);
     if (*p_err != NET_TCP_ERR_NONE) {                           /* See Note #2.                                         */
-         return;
+         return (0u);
     }
 
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN                             /* Rtn data len tx'd with conn req (see Note #3).       */
+    data_len_txd = (CPU_INT16U)p_conn->TxFastOpenDataLen;
+#else
+    data_len_txd = 0u;
+#endif
+
 
    *p_err = NET_TCP_ERR_NONE;
+
+    return (data_len_txd);
 }
 
 
@@ -3068,6 +3616,14 @@ void  NetTCP_TxConnReqClose (NET_TCP_CONN_ID   conn_id_tcp,
 *               flags           Flags to select transmit options; bit-field flags logically OR'd :
 *               -----
 *                                   NET_TCP_FLAG_NONE               No       TCP transmit flags selected.
+*                                   NET_TCP_FLAG_TX_DATA_VEC        Transmit TCP application data from a data
+*                                                                       vector cursor (see Note #11).
+*                                   NET_TCP_FLAG_TX_DATA_EXT        Transmit TCP application data by reference
+*                                                                       from an external data cursor (see Note #12).
+*                                   NET_TCP_FLAG_TX_DATA_FILE       Transmit TCP application data read from a
+*                                                                       file data cursor (see Note #13).
+*                                   NET_TCP_FLAG_TX_MORE            More TCP application data follows; do NOT
+*                                                                       push transmit data (see Note #6c).
 *                                   NET_TCP_FLAG_TX_BLOCK           Transmit TCP application data with blocking,
 *                                                                       if flag set; without blocking, if clear.
 *
@@ -3281,6 +3837,11 @@ void  NetTCP_TxConnReqClose (NET_TCP_CONN_ID   conn_id_tcp,
 *                           (B) "Generally, an interactive application protocol must set the PUSH flag
 *                                at least in the last SEND call in each command or response sequence."
 *
+*                   (c) Transmit data is NOT pushed if NET_TCP_FLAG_TX_MORE is set or if the TCP connection
+*                       is corked (see 'NetTCP_ConnCfgTxCorkEnHandler()  Note #3'); the data is held in the
+*                       transmit queue, appended to by subsequent SENDs, & transmitted ONLY in full-sized
+*                       segments until a later SEND pushes it.
+*
 *               (7) Since pointer arithmetic is based on the specific pointer data type & inherent pointer
 *                   data type size, pointer arithmetic operands :
 *
@@ -3311,6 +3872,33 @@ void  NetTCP_TxConnReqClose (NET_TCP_CONN_ID   conn_id_tcp,
 *
 *                   See also 'NetTCP_TxConnTxQ()    Note #14'.
 *                          & 'NetTCP_TxConnReTxQ()  Note #11'.
+*
+*              (11) If NET_TCP_FLAG_TX_DATA_VEC is set, 'p_data' points to a data vector cursor (see
+*                   'net_buf.h  NETWORK BUFFER DATA VECTOR DATA TYPES') & the application data is gathered
+*                   directly from the data vector into the TCP segment buffer(s).  Since the entire data
+*                   vector is transmitted as one TCP send, small vector elements are coalesced into full-
+*                   sized segments rather than each being transmitted in its own segment.
+*
+*              (12) If NET_TCP_FLAG_TX_DATA_EXT is set, 'p_data' points to an external data cursor (see
+*                   'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES') :
+*
+*                   (a) Each new TCP segment buffer references its part of the application data in place
+*                       instead of copying it; the data is released when the segment is acknowledged.
+*
+*                   (b) Since a network buffer references at most one external data area, application
+*                       data is NOT appended onto the transmit queue's tail segment.
+*
+*                   See also 'NetTCP_TxConnReTxQ()  Note #12'.
+*
+*              (13) If NET_TCP_FLAG_TX_DATA_FILE is set, 'p_data' points to a file data cursor (see
+*                   'net_buf.h  NETWORK BUFFER FILE DATA DATA TYPES') :
+*
+*                   (a) File data is read directly into the TCP segment buffer(s), each sized to the
+*                       connection's maximum segment size & limited by the remaining transmit window.
+*
+*                   (b) A file read error leaves the transmit queue intact; NO further data is segmented
+*                       & the octets already segmented, if any, are returned.  The caller detects the
+*                       error from the cursor's latched file read error.
 *********************************************************************************************************
 */
 
@@ -3362,6 +3950,12 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
     CPU_BOOLEAN          tx_data                = DEF_NO;
     CPU_BOOLEAN          tx_err                 = DEF_NO;
     CPU_BOOLEAN          block                  = DEF_NO;
+    CPU_BOOLEAN          data_vec               = DEF_NO;
+    CPU_BOOLEAN          data_ext               = DEF_NO;
+    CPU_BOOLEAN          data_file              = DEF_NO;
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+    CPU_BOOLEAN          tx_push                = DEF_YES;
+#endif
     NET_TCP_SEQ_NBR      seq_nbr                = 0u;
     NET_PROTOCOL_TYPE    proto_type             = NET_PROTOCOL_TYPE_NONE;
     NET_ERR              err                    = NET_ERR_NONE;
@@ -3571,8 +4165,14 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
     p_buf_head   =  DEF_NULL;
     p_buf_tail   =  DEF_NULL;
     p_data_pkt   = (CPU_INT08U *)p_data;
+    data_vec     =  DEF_BIT_IS_SET(flags, NET_TCP_FLAG_TX_DATA_VEC);
+    data_ext     =  DEF_BIT_IS_SET(flags, NET_TCP_FLAG_TX_DATA_EXT);
+    data_file    =  DEF_BIT_IS_SET(flags, NET_TCP_FLAG_TX_DATA_FILE);
     tx_q_append  =  DEF_YES;
 
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN                              /* Age path max seg size (see 'net_tcp.h  TCP PATH MTU  */
+    NetTCP_ConnPathMTU_Age(p_conn);                             /* ... DISCOVERY DEFINES  Note #3b').                   */
+#endif
     data_len_mss =  p_conn->MaxSegSizeConn;
     data_len_rem =  data_len;
     data_len_tot =  0u;
@@ -3604,7 +4204,8 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
         }
 #endif
 
-        if (data_len_pkt_tail < buf_size_max_tail_data) {       /* ... & if avail data space on tx Q's tail seg, ...    */
+        if ((data_len_pkt_tail < buf_size_max_tail_data) &&     /* ... & if avail data space on tx Q's tail seg  ...    */
+            (data_ext          == DEF_NO)) {                    /* ... & app data NOT tx'd by ref (see Note #12b), ...  */
                                                                 /* ... append data on tx Q tail seg (see Note #6b1).    */
             data_ix_pkt      = data_ix_pkt_tail       + data_len_pkt_tail;
             data_len_pkt_rem = buf_size_max_tail_data - data_len_pkt_tail;
@@ -3613,8 +4214,21 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
             data_len_rem_min = DEF_MIN(data_len_pkt_rem, data_len_rem);
             data_len_pkt     = DEF_MIN(data_len_rem_min, p_conn->TxWinSizeCfgdRem);
 
-                                                                /* Wr app data into TCP tx buf.                         */
-            NetBuf_DataWr(p_buf, data_ix_pkt, data_len_pkt, p_data_pkt, &err);
+                                                                /* Wr app data into TCP tx buf (see Note #11).          */
+            if (data_vec == DEF_YES) {
+                NetBuf_DataWrVec(p_buf, data_ix_pkt, data_len_pkt, (NET_BUF_DATA_VEC_CURSOR *)p_data, &err);
+#ifdef  NET_SOCK_TX_FILE_MODULE_EN
+            } else if (data_file == DEF_YES) {                  /* Rd file data into TCP tx buf (see Note #13a).        */
+                NetBuf_DataWrFile(p_buf, data_ix_pkt, data_len_pkt, (NET_BUF_DATA_FILE_CURSOR *)p_data, &err);
+                if (err != NET_BUF_ERR_NONE) {                  /* File rd err does NOT corrupt tx Q (see Note #13b).   */
+                   *p_err = NET_TCP_ERR_NONE_AVAIL;
+                    return (0u);
+                }
+#endif
+            } else {
+                NetBuf_DataWr(p_buf, data_ix_pkt, data_len_pkt, p_data_pkt, &err);
+                p_data_pkt += data_len_pkt;                     /* MUST NOT cast ptr operand (see Note #7b).            */
+            }
             if ( err != NET_BUF_ERR_NONE) {                     /* If wr err, tx Q data corrupted; ...                  */
                                                                 /* ... close TCP conn (see Note #10a).                  */
                 NetTCP_ConnClose(p_conn, DEF_NULL, DEF_YES, NET_TCP_CONN_CLOSE_ALL);
@@ -3635,8 +4249,7 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
             p_buf_tail    = p_buf;
             tx_q_append   = DEF_NO;
 
-                                                                /* Update data ptr & lens.                              */
-            p_data_pkt   += data_len_pkt;                       /* MUST NOT cast ptr operand (see Note #7b).            */
+                                                                /* Update data lens.                                    */
             data_len_tot += data_len_pkt;
             data_len_rem -= data_len_pkt;
 
@@ -3715,8 +4328,20 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
         }
 
 
-        if (tx_err == DEF_NO) {                                 /* Wr app data into TCP tx buf.                         */
-            NetBuf_DataWr(p_buf, data_ix_pkt, data_len_pkt, p_data_pkt, &err);
+        if (tx_err == DEF_NO) {                                 /* Wr app data into TCP tx buf (see Note #11).          */
+            if (data_vec == DEF_YES) {
+                NetBuf_DataWrVec(p_buf, data_ix_pkt, data_len_pkt, (NET_BUF_DATA_VEC_CURSOR *)p_data, &err);
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+            } else if (data_ext == DEF_YES) {                   /* Ref app data from TCP tx buf (see Note #12a).        */
+                NetBuf_DataExtSet(p_buf, data_ix_pkt, data_len_pkt, (NET_BUF_DATA_EXT_CURSOR *)p_data, &err);
+#endif
+#ifdef  NET_SOCK_TX_FILE_MODULE_EN
+            } else if (data_file == DEF_YES) {                  /* Rd file data into TCP tx buf (see Note #13a).        */
+                NetBuf_DataWrFile(p_buf, data_ix_pkt, data_len_pkt, (NET_BUF_DATA_FILE_CURSOR *)p_data, &err);
+#endif
+            } else {
+                NetBuf_DataWr(p_buf, data_ix_pkt, data_len_pkt, p_data_pkt, &err);
+            }
             if (err != NET_BUF_ERR_NONE) {
                 NetTCP_TxPktDiscard(p_buf, &err);
                 tx_err = DEF_YES;
@@ -3780,7 +4405,11 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
             }
 
                                                                 /* Update data ptr & lens.                              */
-            p_data_pkt   += data_len_pkt;                       /* MUST NOT cast ptr operand (see Note #7b).            */
+            if ((data_vec  != DEF_YES) &&
+                (data_ext  != DEF_YES) &&
+                (data_file != DEF_YES)) {
+                p_data_pkt += data_len_pkt;                     /* MUST NOT cast ptr operand (see Note #7b).            */
+            }
             data_len_tot += data_len_pkt;
             data_len_rem -= data_len_pkt;
 
@@ -3801,7 +4430,16 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
         return (0u);
     }
 
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+    tx_push = DEF_BIT_IS_CLR(flags, NET_TCP_FLAG_TX_MORE);      /* If more tx data NOT to follow ...                    */
+    if ((tx_push          == DEF_YES) &&
+        (p_conn->TxCorkEn == DEF_DISABLED)) {                   /* ... & conn NOT corked (see Note #6c), ...            */
+                                                                /* ... set PUSH flag in last q'd tx seg.                */
+        DEF_BIT_SET(p_buf_hdr->TCP_Flags, NET_TCP_FLAG_TX_PUSH);
+    }
+#else
     DEF_BIT_SET(p_buf_hdr->TCP_Flags, NET_TCP_FLAG_TX_PUSH);    /* Set PUSH flag in last q'd tx seg (see Note #6b3B1b). */
+#endif
 
 
 
@@ -5319,6 +5957,9 @@ CPU_BOOLEAN  NetTCP_ConnCfgRxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
 
 
                                                                 /* ------------- CFG TCP CONN RX WIN SIZE ------------- */
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+    NetTCP_RxConnWinSizeTuneRelease(p_conn);                    /* Restart rx win auto-tuning from new rx win size.     */
+#endif
     p_conn->RxWinSizeCfgd = win_size;                           /* Cfg rx win size.                                     */
     NetTCP_RxConnWinSizeCfg(p_conn);                            /* Cfg rx win ctrls.                                    */
 
@@ -5776,6 +6417,668 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEnHandler (NET_TCP_CONN_ID   conn_id_tcp,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetTCP_ConnCfgTxCorkEn()
+*
+* Description : (1) Configure TCP connection's   transmit cork enable :
+*
+*                   (a) Acquire   network lock
+*                   (b) Validate  TCP connection used
+*                   (c) Configure TCP connection transmit cork enable                       See Note #3
+*                   (d) Release   network lock
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit cork enable.
+*
+*               cork_en         Desired value for TCP connection transmit cork enable :
+*
+*                                   DEF_ENABLED             TCP connections transmit ONLY full-sized data
+*                                                               segment(s) until uncorked.
+*
+*                                   DEF_DISABLED            TCP connections push transmit data segment(s)
+*                                                               at the end of each application transmit; any
+*                                                               corked transmit data is pushed immediately.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               -- RETURNED BY NetTCP_ConnCfgTxCorkEnHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection transmit cork enable successfully
+*                                                                   configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
+*
+*                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*
+*                                                               ------ RETURNED BY Net_GlobalLockAcquire() : -----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   TCP connection transmit cork enable successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgTxCorkEn() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access
+*                   is asynchronous to other network protocol tasks.
+*
+*                   See also 'NetTCP_ConnCfgTxCorkEnHandler()  Note #2'.
+*
+*               (3) See 'NetTCP_ConnCfgTxCorkEnHandler()  Note #3'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+CPU_BOOLEAN  NetTCP_ConnCfgTxCorkEn (NET_TCP_CONN_ID   conn_id_tcp,
+                                     CPU_BOOLEAN       cork_en,
+                                     NET_ERR          *p_err)
+{
+   CPU_BOOLEAN  cfg_valid;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+   if (p_err == (NET_ERR *)0) {
+       CPU_SW_EXCEPTION(DEF_FAIL);
+   }
+#endif
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+                                                                /* See Note #2b.                                        */
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxCorkEn, p_err);
+   if (*p_err != NET_ERR_NONE) {
+        goto exit_lock_fault;
+   }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+  (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+   if (*p_err != NET_TCP_ERR_NONE) {
+        goto exit_fail;
+   }
+#endif
+
+                                                                /* ------------- CFG TCP CONN TX CORK EN -------------- */
+   cfg_valid = NetTCP_ConnCfgTxCorkEnHandler(conn_id_tcp, cork_en, p_err);
+   goto exit_release;
+
+
+exit_lock_fault:
+   cfg_valid = DEF_FAIL;
+   goto exit;
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+exit_fail:
+   cfg_valid = DEF_FAIL;
+#endif
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+   Net_GlobalLockRelease();
+
+exit:
+   return (cfg_valid);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   NetTCP_ConnCfgTxCorkEnHandler()
+*
+* Description : (1) Configure TCP connection's   transmit cork enable :
+*
+*                   (a) Validate  TCP connection transmit cork enable configuration
+*                   (b) Configure TCP connection transmit cork enable                           See Note #3
+*                   (c) Push      TCP connection corked transmit data, if uncorked              See Note #3b
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit cork enable.
+*               -----------     Argument checked in NetTCP_ConnCfgTxCorkEn().
+*
+*               cork_en         Desired value for TCP connection transmit cork enable :
+*
+*                                   DEF_ENABLED             TCP connections transmit ONLY full-sized data
+*                                                               segment(s) until uncorked.
+*
+*                                   DEF_DISABLED            TCP connections push transmit data segment(s)
+*                                                               at the end of each application transmit; any
+*                                                               corked transmit data is pushed immediately.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP connection transmit cork enable
+*                                                                   successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
+*
+* Return(s)   : DEF_OK,   TCP connection transmit cork enable successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetTCP_ConnCfgTxCorkEn(),
+*               NetSock_CfgTxCorkHandler().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgTxCorkEnHandler() is called by network protocol suite function(s)
+*                   & MUST be called with the global network lock already acquired.
+*
+*                   See also 'NetTCP_ConnCfgTxCorkEn()  Note #2'.
+*
+*               (3) (a) While a TCP connection is corked, application transmit data is NOT pushed (see
+*                       'NetTCP_TxConnAppData()  Note #6c').  Transmit data is therefore packetized into
+*                       full-sized segments & ONLY full-sized segments are transmitted; the remaining
+*                       partial segment is held, without any timer, until more data is transmitted or
+*                       until the connection is uncorked or closed.
+*
+*                   (b) Uncorking a TCP connection pushes the last queued transmit segment & immediately
+*                       transmits any held transmit data allowed by the congestion controls.
+*
+*                   See also 'NetTCP_TxConnTxQ()  Note #7b2Ba4A1'.
+*
+*               (4) TCP connections' 'TxCorkEn' variables MUST ALWAYS be accessed with the global network
+*                   lock already acquired (see Note #2).
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+CPU_BOOLEAN  NetTCP_ConnCfgTxCorkEnHandler (NET_TCP_CONN_ID   conn_id_tcp,
+                                            CPU_BOOLEAN       cork_en,
+                                            NET_ERR          *p_err)
+{
+    NET_TCP_CONN  *p_conn;
+    NET_BUF_HDR   *p_buf_hdr_q_tail;
+    NET_ERR        err;
+
+
+                                                                /* ----------------- VALIDATE CORK EN ----------------- */
+    switch (cork_en) {
+        case DEF_ENABLED:
+        case DEF_DISABLED:
+             break;
+
+
+        default:
+            *p_err =  NET_TCP_ERR_INVALID_ARG;
+             return (DEF_FAIL);
+    }
+
+
+                                                                /* ------------- CFG TCP CONN TX CORK EN -------------- */
+    p_conn           = &NetTCP_ConnTbl[conn_id_tcp];
+    p_conn->TxCorkEn =  cork_en;
+
+                                                                /* ------------- PUSH CORKED TCP TX DATA -------------- */
+    if ((cork_en          == DEF_DISABLED) &&                   /* If conn uncorked  ...                                */
+        (p_conn->TxQ_Tail != DEF_NULL)) {                       /* ... & tx data q'd, ...                               */
+        p_buf_hdr_q_tail = &p_conn->TxQ_Tail->Hdr;              /* ... push last q'd tx seg (see Note #3b).             */
+        DEF_BIT_SET(p_buf_hdr_q_tail->TCP_Flags, NET_TCP_FLAG_TX_PUSH);
+
+        switch (p_conn->ConnState) {
+            case NET_TCP_CONN_STATE_CONN:
+            case NET_TCP_CONN_STATE_CLOSE_WAIT:
+                 NetTCP_TxConnTxQ(p_conn, 0, NET_TCP_CONN_TX_ACK_NONE, DEF_NO, NET_TCP_CONN_CLOSE_ALL, DEF_YES, &err);
+                 break;
+
+
+            default:                                            /* Q'd tx data tx'd when conn completes.                */
+                 break;
+        }
+    }
+
+
+   *p_err =  NET_TCP_ERR_NONE;
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_ConnCfgFastOpenEn()
+*
+* Description : (1) Configure TCP connection's   fast open enable :
+*
+*                   (a) Acquire   network lock
+*                   (b) Validate  TCP connection used
+*                   (c) Configure TCP connection fast open enable                           See Note #3
+*                   (d) Release   network lock
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure fast open enable.
+*
+*               fast_open_en    Desired value for TCP connection fast open enable :
+*
+*                                   DEF_ENABLED             TCP connection requests & accepts data in
+*                                                               synchronization segments.
+*
+*                                   DEF_DISABLED            TCP connection does NOT use TCP Fast Open.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               - RETURNED BY NetTCP_ConnCfgFastOpenEnHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection fast open enable successfully
+*                                                                   configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
+*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
+*
+*                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*
+*                                                               ------ RETURNED BY Net_GlobalLockAcquire() : -----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   TCP connection fast open enable successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgFastOpenEn() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access
+*                   is asynchronous to other network protocol tasks.
+*
+*                   See also 'NetTCP_ConnCfgFastOpenEnHandler()  Note #2'.
+*
+*               (3) See 'NetTCP_ConnCfgFastOpenEnHandler()  Note #3'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+CPU_BOOLEAN  NetTCP_ConnCfgFastOpenEn (NET_TCP_CONN_ID   conn_id_tcp,
+                                       CPU_BOOLEAN       fast_open_en,
+                                       NET_ERR          *p_err)
+{
+   CPU_BOOLEAN  cfg_valid;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+   if (p_err == (NET_ERR *)0) {
+       CPU_SW_EXCEPTION(DEF_FAIL);
+   }
+#endif
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+                                                                /* See Note #2b.                                        */
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgFastOpenEn, p_err);
+   if (*p_err != NET_ERR_NONE) {
+        goto exit_lock_fault;
+   }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+  (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+   if (*p_err != NET_TCP_ERR_NONE) {
+        goto exit_fail;
+   }
+#endif
+
+                                                                /* ------------ CFG TCP CONN FAST OPEN EN ------------- */
+   cfg_valid = NetTCP_ConnCfgFastOpenEnHandler(conn_id_tcp, fast_open_en, p_err);
+   goto exit_release;
+
+
+exit_lock_fault:
+   cfg_valid = DEF_FAIL;
+   goto exit;
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+exit_fail:
+   cfg_valid = DEF_FAIL;
+#endif
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+   Net_GlobalLockRelease();
+
+exit:
+   return (cfg_valid);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_ConnCfgFastOpenEnHandler()
+*
+* Description : (1) Configure TCP connection's   fast open enable :
+*
+*                   (a) Validate  TCP connection fast open enable configuration
+*                   (b) Configure TCP connection fast open enable                               See Note #3
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure fast open enable.
+*               -----------     Argument checked in NetTCP_ConnCfgFastOpenEn().
+*
+*               fast_open_en    Desired value for TCP connection fast open enable :
+*
+*                                   DEF_ENABLED             TCP connection requests & accepts data in
+*                                                               synchronization segments.
+*
+*                                   DEF_DISABLED            TCP connection does NOT use TCP Fast Open.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP connection fast open enable
+*                                                                   successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
+*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state (see Note #3b).
+*
+* Return(s)   : DEF_OK,   TCP connection fast open enable successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetTCP_ConnCfgFastOpenEn(),
+*               NetSock_ConnHandlerStream(),
+*               NetSock_Listen().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgFastOpenEnHandler() is called by network protocol suite function(s)
+*                   & MUST be called with the global network lock already acquired.
+*
+*                   See also 'NetTCP_ConnCfgFastOpenEn()  Note #2'.
+*
+*               (3) (a) TCP Fast Open is negotiated during the three-way handshake (see 'net_tcp.h  TCP
+*                       FAST OPEN DEFINES  Note #1') :
+*
+*                       (1) Active  opens cache & transmit the remote host's cookie.
+*                       (2) Passive opens issue & validate cookies; connections cloned from a LISTEN-state
+*                           connection inherit its fast open enable.
+*
+*                   (b) TCP Fast Open MUST be configured BEFORE the TCP connection is opened, i.e. while
+*                       the connection is in the CLOSED or LISTEN state.
+*
+*               (4) TCP connections' 'FastOpenEn' variables MUST ALWAYS be accessed with the global network
+*                   lock already acquired (see Note #2).
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+CPU_BOOLEAN  NetTCP_ConnCfgFastOpenEnHandler (NET_TCP_CONN_ID   conn_id_tcp,
+                                              CPU_BOOLEAN       fast_open_en,
+                                              NET_ERR          *p_err)
+{
+    NET_TCP_CONN  *p_conn;
+
+
+                                                                /* --------------- VALIDATE FAST OPEN EN -------------- */
+    switch (fast_open_en) {
+        case DEF_ENABLED:
+        case DEF_DISABLED:
+             break;
+
+
+        default:
+            *p_err =  NET_TCP_ERR_INVALID_ARG;
+             return (DEF_FAIL);
+    }
+
+    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+                                                                /* ------------- VALIDATE TCP CONN STATE -------------- */
+    switch (p_conn->ConnState) {
+        case NET_TCP_CONN_STATE_CLOSED:
+        case NET_TCP_CONN_STATE_LISTEN:
+             break;
+
+
+        default:                                                /* See Note #3b.                                        */
+            *p_err =  NET_TCP_ERR_INVALID_CONN_STATE;
+             return (DEF_FAIL);
+    }
+
+
+                                                                /* ------------ CFG TCP CONN FAST OPEN EN ------------- */
+    p_conn->FastOpenEn = fast_open_en;
+
+
+   *p_err =  NET_TCP_ERR_NONE;
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_ConnCfgTxPaceRate()
+*
+* Description : (1) Configure TCP connection's   transmit pacing rate :
+*
+*                   (a) Acquire   network lock
+*                   (b) Validate  TCP connection used
+*                   (c) Configure TCP connection transmit pacing rate                       See Note #3
+*                   (d) Release   network lock
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit pacing rate.
+*
+*               rate_max        Desired value for TCP connection transmit pacing rate :
+*
+*                                   NET_TCP_TX_PACE_RATE_NONE   TCP connection transmit pacing disabled.
+*
+*                                   NET_TCP_TX_PACE_RATE_AUTO   TCP connection paced by its congestion
+*                                                                   window & round-trip time ONLY.
+*
+*                                   Any other value             Maximum TCP connection transmit pacing
+*                                                                   rate (in octets per second).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               - RETURNED BY NetTCP_ConnCfgTxPaceRateHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection transmit pacing rate successfully
+*                                                                   configured.
+*
+*                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*
+*                                                               ------ RETURNED BY Net_GlobalLockAcquire() : -----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   TCP connection transmit pacing rate successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgTxPaceRate() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access
+*                   is asynchronous to other network protocol tasks.
+*
+*                   See also 'NetTCP_ConnCfgTxPaceRateHandler()  Note #2'.
+*
+*               (3) See 'NetTCP_ConnCfgTxPaceRateHandler()  Note #3'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+CPU_BOOLEAN  NetTCP_ConnCfgTxPaceRate (NET_TCP_CONN_ID        conn_id_tcp,
+                                       NET_TCP_TX_PACE_RATE   rate_max,
+                                       NET_ERR               *p_err)
+{
+   CPU_BOOLEAN  cfg_valid;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+   if (p_err == (NET_ERR *)0) {
+       CPU_SW_EXCEPTION(DEF_FAIL);
+   }
+#endif
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+                                                                /* See Note #2b.                                        */
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxPaceRate, p_err);
+   if (*p_err != NET_ERR_NONE) {
+        goto exit_lock_fault;
+   }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+  (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+   if (*p_err != NET_TCP_ERR_NONE) {
+        goto exit_fail;
+   }
+#endif
+
+                                                                /* ------------ CFG TCP CONN TX PACE RATE ------------- */
+   cfg_valid = NetTCP_ConnCfgTxPaceRateHandler(conn_id_tcp, rate_max, p_err);
+   goto exit_release;
+
+
+exit_lock_fault:
+   cfg_valid = DEF_FAIL;
+   goto exit;
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+exit_fail:
+   cfg_valid = DEF_FAIL;
+#endif
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+   Net_GlobalLockRelease();
+
+exit:
+   return (cfg_valid);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_ConnCfgTxPaceRateHandler()
+*
+* Description : (1) Configure TCP connection's   transmit pacing rate :
+*
+*                   (a) Configure TCP connection transmit pacing rate                           See Note #3
+*                   (b) Transmit  TCP connection transmit queue, if pacing disabled             See Note #3c
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit pacing rate.
+*               -----------     Argument checked in NetTCP_ConnCfgTxPaceRate().
+*
+*               rate_max        Desired value for TCP connection transmit pacing rate :
+*
+*                                   NET_TCP_TX_PACE_RATE_NONE   TCP connection transmit pacing disabled.
+*
+*                                   NET_TCP_TX_PACE_RATE_AUTO   TCP connection paced by its congestion
+*                                                                   window & round-trip time ONLY.
+*
+*                                   Any other value             Maximum TCP connection transmit pacing
+*                                                                   rate (in octets per second).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP connection transmit pacing rate
+*                                                                   successfully configured.
+*
+* Return(s)   : DEF_OK,   TCP connection transmit pacing rate successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetTCP_ConnCfgTxPaceRate(),
+*               NetSock_CfgTxPaceRateHandler().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgTxPaceRateHandler() is called by network protocol suite function(s)
+*                   & MUST be called with the global network lock already acquired.
+*
+*                   See also 'NetTCP_ConnCfgTxPaceRate()  Note #2'.
+*
+*               (3) (a) A paced TCP connection transmits its transmit queue segments no faster than its
+*                       pacing rate (see 'net_tcp.h  TCP TRANSMIT PACING DEFINES  Note #1').
+*
+*                   (b) Maximum rates lower than one octet per millisecond are rounded up to one octet per
+*                       millisecond (see 'net_tcp.h  TCP TRANSMIT PACING DATA TYPES  Note #1').
+*
+*                   (c) Disabling transmit pacing frees the TCP connection's transmit queue pacing timer &
+*                       immediately transmits any transmit data allowed by the congestion controls.
+*
+*                   (d) Transmit pacing is configured on a listen TCP connection for ALL connections it
+*                       accepts (see 'NetTCP_ConnCopy()').
+*
+*               (4) TCP connections' transmit pacing variables MUST ALWAYS be accessed with the global
+*                   network lock already acquired (see Note #2).
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+CPU_BOOLEAN  NetTCP_ConnCfgTxPaceRateHandler (NET_TCP_CONN_ID        conn_id_tcp,
+                                              NET_TCP_TX_PACE_RATE   rate_max,
+                                              NET_ERR               *p_err)
+{
+    NET_TCP_CONN  *p_conn;
+    NET_ERR        err;
+
+
+                                                                /* ------------ CFG TCP CONN TX PACE RATE ------------- */
+    p_conn                 = &NetTCP_ConnTbl[conn_id_tcp];
+    p_conn->TxPaceRateCfgd =  rate_max;
+
+    if (rate_max != NET_TCP_TX_PACE_RATE_NONE) {
+       *p_err =  NET_TCP_ERR_NONE;
+        return (DEF_OK);
+    }
+
+                                                                /* --------------- TX PACED TCP TX DATA --------------- */
+    p_conn->TxPaceRate_ms = NET_TCP_TX_PACE_RATE_NONE;
+
+    if (p_conn->TxQ_PaceTmr != DEF_NULL) {                      /* If tx Q paced (see Note #3c), ...                    */
+        NetTmr_Free(p_conn->TxQ_PaceTmr);                       /* ... free tx Q pacing tmr ...                         */
+        p_conn->TxQ_PaceTmr  = DEF_NULL;
+
+        switch (p_conn->ConnState) {                            /* ... & tx Q data.                                     */
+            case NET_TCP_CONN_STATE_CONN:
+            case NET_TCP_CONN_STATE_CLOSE_WAIT:
+                 NetTCP_TxConnTxQ(p_conn, 0, NET_TCP_CONN_TX_ACK_NONE, DEF_NO, NET_TCP_CONN_CLOSE_ALL, DEF_YES, &err);
+                 break;
+
+
+            default:
+                 break;
+        }
+    }
+
+
+   *p_err =  NET_TCP_ERR_NONE;
+
+    return (DEF_OK);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                 NetTCP_ConnCfgTxAckImmedRxdPushEn()
@@ -6121,7 +7424,7 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxAckDlyTimeoutHandler (NET_TCP_CONN_ID      conn_id_
 
 
                                                                 /* --------- CFG TCP CONN TX ACK DLY TIMEOUT ---------- */
-    timeout_tick = (timeout_ms * NET_TMR_TIME_TICK_PER_SEC) / DEF_TIME_NBR_mS_PER_SEC;
+    timeout_tick = (timeout_ms * NET_TCP_TMR_TICK_PER_SEC) / DEF_TIME_NBR_mS_PER_SEC;
     if (timeout_tick < 1) {                                     /* If < 1 tick, ...                                     */
         timeout_tick = 1u;                                      /* ... set at least 1 tick (see Note #3b).              */
     }
@@ -7345,6 +8648,69 @@ CPU_BOOLEAN  NetTCP_ConnIsUsed (NET_TCP_CONN_ID   conn_id_tcp,
 }
 
 
+/*
+*********************************************************************************************************
+*                                     NetTCP_ConnTimeWaitIsUsed()
+*
+* Description : Check if a compacted TIME-WAIT connection holds a network connection's local & remote
+*               addresses.
+*
+* Argument(s) : conn_id     Handle identifier of network connection to check.
+*
+* Return(s)   : DEF_YES, if an unexpired time-wait entry holds the connection addresses.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetSock_ConnHandlerAddrTimeWait().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (1) A compacted TIME-WAIT connection's addresses are NOT held by ANY network connection;
+*                   new connections MUST thus also be checked against the time-wait table to preserve
+*                   the TIME-WAIT state (see 'net_tcp.h  TCP TIME-WAIT DEFINES  Note #4').
+*
+*               (2) NetTCP_ConnTimeWaitIsUsed() MUST be called with the global network lock already
+*                   acquired.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+CPU_BOOLEAN  NetTCP_ConnTimeWaitIsUsed (NET_CONN_ID  conn_id)
+{
+    CPU_INT08U                addr_local[NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U                addr_remote[NET_CONN_ADDR_LEN_MAX];
+    NET_CONN_ADDR_LEN         addr_len;
+    NET_CONN                 *p_net_conn;
+    NET_TCP_TIME_WAIT_ENTRY  *p_entry;
+    NET_TS_MS                 ts_ms;
+    CPU_BOOLEAN               used;
+    NET_ERR                   err;
+
+                                                                /* ----------------- GET CONN ADDRS ------------------- */
+    addr_len = NET_CONN_ADDR_LEN_MAX;
+    NetConn_AddrLocalGet(conn_id, &addr_local[0], &addr_len, &err);
+    if (err != NET_CONN_ERR_NONE) {
+        return (DEF_NO);
+    }
+
+    addr_len = NET_CONN_ADDR_LEN_MAX;
+    NetConn_AddrRemoteGet(conn_id, &addr_remote[0], &addr_len, &err);
+    if (err != NET_CONN_ERR_NONE) {
+        return (DEF_NO);
+    }
+
+                                                                /* -------------- SRCH TIME-WAIT ENTRIES -------------- */
+    p_net_conn = &NetConn_Tbl[conn_id];
+    ts_ms      =  NetUtil_TS_Get_ms();
+    p_entry    =  NetTCP_TimeWaitSrch(p_net_conn->Family, &addr_local[0], &addr_remote[0], ts_ms);
+    used       = (p_entry != DEF_NULL) ? DEF_YES : DEF_NO;
+
+    return (used);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      NetTCP_ConnPoolStatGet()
@@ -7484,6 +8850,100 @@ NET_TCP_CONN_STATE  NetTCP_ConnStateGet (NET_TCP_CONN_ID  conn_id)
     return (state);
 }
 
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_ConnTxPaceStatGet()
+*
+* Description : Get TCP connection's transmit pacing statistics.
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to get transmit pacing statistics.
+*
+*               p_stat          Pointer to variable that will receive the TCP connection's transmit pacing
+*                                   statistics.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP connection transmit pacing statistics
+*                                                                   successfully returned.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_stat' passed a NULL pointer.
+*
+*                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*
+*                                                               ------ RETURNED BY Net_GlobalLockAcquire() : -----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   TCP connection transmit pacing statistics successfully returned.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) The current pacing rate is NET_TCP_TX_PACE_RATE_NONE if the TCP connection is NOT
+*                   currently paced (see 'net_tcp.h  TCP TRANSMIT PACING DEFINES  Note #1b').
+*
+*               (2) The current pacing rate, burst size & tokens are updated ONLY as the TCP connection's
+*                   transmit queue is transmitted.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+CPU_BOOLEAN  NetTCP_ConnTxPaceStatGet (NET_TCP_CONN_ID        conn_id_tcp,
+                                       NET_TCP_TX_PACE_STAT  *p_stat,
+                                       NET_ERR               *p_err)
+{
+    NET_TCP_CONN  *p_conn;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* ------------------ VALIDATE PTRS ------------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION(DEF_FAIL);
+    }
+
+    if (p_stat == (NET_TCP_TX_PACE_STAT *)0) {
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (DEF_FAIL);
+    }
+#endif
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetTCP_ConnTxPaceStatGet, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+                                                                /* -------------- VALIDATE TCP CONN USED -------------- */
+   (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+    if (*p_err != NET_TCP_ERR_NONE) {
+        Net_GlobalLockRelease();
+        return (DEF_FAIL);
+    }
+
+                                                                /* --------------- GET TCP TX PACE STATS -------------- */
+    p_conn           = &NetTCP_ConnTbl[conn_id_tcp];
+
+    p_stat->RateCfgd =  p_conn->TxPaceRateCfgd;
+    p_stat->RateCur  = (p_conn->TxPaceRate_ms < (DEF_INT_32U_MAX_VAL / DEF_TIME_NBR_mS_PER_SEC))
+                     ?  p_conn->TxPaceRate_ms * DEF_TIME_NBR_mS_PER_SEC
+                     :  DEF_INT_32U_MAX_VAL;
+    p_stat->Burst    =  p_conn->TxPaceBurst;
+    p_stat->Tokens   =  p_conn->TxPaceTokens;
+    p_stat->DlyCtr   =  p_conn->TxPaceDlyCtr;
+
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+
+   *p_err =  NET_TCP_ERR_NONE;
+
+    return (DEF_OK);
+}
+#endif
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -7733,6 +9193,10 @@ static  void  NetTCP_RxPktValidateBuf (NET_BUF_HDR  *p_buf_hdr,
 *                       to TCP from the IP layer, TCP MUST ignore options that it does not understand".
 *
 *                       NOT currently implemented. #### NET-814
+*
+*               (9) The received window field is stored unscaled; it is scaled by the connection's
+*                   negotiated transmit window scale once the segment is demultiplexed to a connection
+*                   (see 'NetTCP_RxPktConnHandler()  Note #7').
 *********************************************************************************************************
 */
 
@@ -7752,6 +9216,7 @@ static  void  NetTCP_RxPktValidate (NET_BUF      *p_buf,
     CPU_INT16U           tcp_hdr_len;
     CPU_INT16U           tcp_tot_len;
     CPU_INT16U           tcp_data_len;
+    CPU_INT16U           win_size_hdr;
     NET_TCP_HDR_FLAGS    tcp_flags;
     CPU_BOOLEAN          tcp_flags_reserved;
     CPU_BOOLEAN          tcp_chk_sum_valid;
@@ -7897,7 +9362,8 @@ static  void  NetTCP_RxPktValidate (NET_BUF      *p_buf,
                                                                 /* See Notes #1c & #3.                                  */
     NET_UTIL_VAL_COPY_GET_NET_32(&p_buf_hdr->TCP_SeqNbr,  &p_tcp_hdr->SeqNbr);
     NET_UTIL_VAL_COPY_GET_NET_32(&p_buf_hdr->TCP_AckNbr,  &p_tcp_hdr->AckNbr);
-    NET_UTIL_VAL_COPY_GET_NET_16(&p_buf_hdr->TCP_WinSize, &p_tcp_hdr->WinSize);
+    NET_UTIL_VAL_COPY_GET_NET_16(&win_size_hdr,           &p_tcp_hdr->WinSize);
+    p_buf_hdr->TCP_WinSize = (NET_TCP_WIN_SIZE)win_size_hdr;    /* Scaled by conn's tx win scale (see Note #9).         */
 
     p_buf_hdr->TransportHdrLen  = tcp_hdr_len_tot;
     tcp_data_len                = tcp_tot_len - p_buf_hdr->TransportHdrLen;
@@ -8031,6 +9497,13 @@ static  void  NetTCP_RxPktValidateOpt (NET_BUF_HDR  *p_buf_hdr,
     CPU_INT08U    opt_list_len_rem;
     CPU_INT08U    opt_len;
     CPU_INT08U    opt_nbr_max_seg_size;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    CPU_INT08U    opt_nbr_win_scale;
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    CPU_INT08U    opt_nbr_fast_open;
+    CPU_INT16U    opt_ix;
+#endif
     CPU_BOOLEAN   opt_err;
     CPU_BOOLEAN   opt_list_end;
 
@@ -8056,6 +9529,12 @@ static  void  NetTCP_RxPktValidateOpt (NET_BUF_HDR  *p_buf_hdr,
     opt_err              =  DEF_NO;
     opt_list_end         =  DEF_NO;
     opt_nbr_max_seg_size =  0u;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    opt_nbr_win_scale    =  0u;
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    opt_nbr_fast_open    =  0u;
+#endif
 
     p_opts                = (CPU_INT08U *)&p_tcp_hdr->Opts[0];
     opt_list_len_rem     =  opt_list_len_size;
@@ -8095,14 +9574,59 @@ static  void  NetTCP_RxPktValidateOpt (NET_BUF_HDR  *p_buf_hdr,
 
                  opt_err = NetTCP_RxPktValidateOptMaxSegSize(p_buf_hdr, p_opts, &opt_len, p_err);
                  break;
+
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+            case NET_TCP_HDR_OPT_WIN_SCALE:                     /* ------------------ WIN SCALE OPT ------------------- */
+                 if (opt_list_end != DEF_NO) {                  /* If opt found AFTER end of opt list, rtn err.         */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_END;
+                     return;
+                 }
+                 if (opt_nbr_win_scale > 0) {                   /* If > 1 win scale opt,               rtn err.         */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_NBR;
+                     return;
+                 }
+                 opt_nbr_win_scale++;
+
+                 opt_err = NetTCP_RxPktValidateOptWinScale(p_buf_hdr, p_opts, &opt_len, p_err);
+                 break;
+#endif
+
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+            case NET_TCP_HDR_OPT_FAST_OPEN:                     /* ------------------ FAST OPEN OPT ------------------- */
+                 if (opt_list_end != DEF_NO) {                  /* If opt found AFTER end of opt list, rtn err.         */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_END;
+                     return;
+                 }
+                 if (opt_nbr_fast_open > 0) {                   /* If > 1 fast open opt,               rtn err.         */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_NBR;
+                     return;
+                 }
+                 opt_nbr_fast_open++;
+                                                                /* Calc opt ix in pkt buf.                              */
+                 opt_ix  = (CPU_INT16U)(p_buf_hdr->TransportHdrIx + NET_TCP_HDR_OPT_IX +
+                                       (opt_list_len_size - opt_list_len_rem));
+                 opt_err =  NetTCP_RxPktValidateOptFastOpen(p_buf_hdr, p_opts, opt_ix, &opt_len, p_err);
+                 break;
+#endif
                                                                 /* --------------- UNSUPPORTED TCP OPTS --------------- */
                                                                 /* See Notes #1b & #2b2.                                */
+#ifndef NET_TCP_WIN_SCALE_MODULE_EN
             case NET_TCP_HDR_OPT_WIN_SCALE:
+#endif
             case NET_TCP_HDR_OPT_SACK_PERMIT:
             case NET_TCP_HDR_OPT_SACK:
             case NET_TCP_HDR_OPT_ECHO_REQ:
             case NET_TCP_HDR_OPT_ECHO_REPLY:
             case NET_TCP_HDR_OPT_TS:
+#ifndef NET_TCP_FAST_OPEN_MODULE_EN
+            case NET_TCP_HDR_OPT_FAST_OPEN:
+#endif
             default:                                            /* ----------------- INVALID TCP OPTS ----------------- */
                  opt_len = *(p_opts + 1);                       /* Ignore unknown opts      (see Note #2b2).            */
                  if (opt_len < NET_TCP_HDR_OPT_LEN_MIN_LEN) {   /* If opt len < min opt len (see Note #2b3), rtn err.   */
@@ -8208,6 +9732,146 @@ static  CPU_BOOLEAN  NetTCP_RxPktValidateOptMaxSegSize (NET_BUF_HDR  *p_buf_hdr,
 }
 
 
+/*
+*********************************************************************************************************
+*                                  NetTCP_RxPktValidateOptWinScale()
+*
+* Description : Validate & process received TCP Window Scale option.
+*
+* Argument(s) : p_buf_hdr    Pointer to network buffer header that received TCP packet.
+*               --------    Argument validated in NetTCP_Rx().
+*
+*               p_opt        Pointer to Window Scale option.
+*               ----        Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_opt_len    Pointer to variable that will receive the TCP option length (in octets).
+*               --------    Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP option validated & processed.
+*                               NET_TCP_ERR_INVALID_OPT_LEN     Invalid TCP option length.
+*
+* Return(s)   : DEF_NO,  NO Window Scale option error.
+*
+*               DEF_YES, otherwise.
+*
+* Caller(s)   : NetTCP_RxPktValidateOpt().
+*
+* Note(s)     : (1) See 'net_tcp.h  TCP WINDOW SIZE DEFINES  Note #2' for TCP Window Scale option summary.
+*
+*               (2) RFC #7323, Section 2.3 states that if "a Window Scale option is received with a
+*                   shift.cnt value larger than 14, the TCP SHOULD log the error but MUST use 14 instead
+*                   of the specified value".
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+static  CPU_BOOLEAN  NetTCP_RxPktValidateOptWinScale (NET_BUF_HDR  *p_buf_hdr,
+                                                      CPU_INT08U   *p_opt,
+                                                      CPU_INT08U   *p_opt_len,
+                                                      NET_ERR      *p_err)
+{
+    CPU_INT08U  win_scale;
+
+
+   *p_opt_len = NET_TCP_HDR_OPT_LEN_WIN_SCALE;
+
+    p_opt++;
+    if (*p_opt != *p_opt_len) {                                 /* If opt len != win scale opt len, rtn err.            */
+         NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+        *p_err  = NET_TCP_ERR_INVALID_OPT_LEN;
+         return (DEF_YES);
+    }
+
+    p_opt++;
+    win_scale = *p_opt;
+    if (win_scale > NET_TCP_WIN_SCALE_MAX) {                    /* Clip win scale to max (see Note #2).                 */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+        win_scale = NET_TCP_WIN_SCALE_MAX;
+    }
+
+    p_buf_hdr->TCP_WinScale = win_scale;
+
+   *p_err                   = NET_TCP_ERR_NONE;
+
+    return (DEF_NO);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_RxPktValidateOptFastOpen()
+*
+* Description : Validate & process received TCP Fast Open option.
+*
+* Argument(s) : p_buf_hdr    Pointer to network buffer header that received TCP packet.
+*               --------    Argument validated in NetTCP_Rx().
+*
+*               p_opt        Pointer to TCP Fast Open option.
+*               ----        Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               opt_ix       Index of TCP Fast Open option in packet buffer.
+*
+*               p_opt_len    Pointer to variable that will receive the TCP option length (in octets).
+*               --------    Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP option validated & processed.
+*                               NET_TCP_ERR_INVALID_OPT_LEN     Invalid TCP option length.
+*
+* Return(s)   : DEF_NO,  NO TCP Fast Open option error.
+*
+*               DEF_YES, otherwise.
+*
+* Caller(s)   : NetTCP_RxPktValidateOpt().
+*
+* Note(s)     : (1) See 'net_tcp.h  TCP FAST OPEN DEFINES' for TCP Fast Open option summary.
+*
+*               (2) RFC #7413, Section 4.1.1 specifies a cookie length of 4 to 16 octets; an empty cookie
+*                   requests a cookie (see 'net_tcp.h  TCP FAST OPEN DEFINES  Note #1a').  Options with
+*                   any other cookie length are ignored.
+*
+*               (3) The cookie is NOT copied from the packet buffer; ONLY its index & length are recorded.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  CPU_BOOLEAN  NetTCP_RxPktValidateOptFastOpen (NET_BUF_HDR  *p_buf_hdr,
+                                                      CPU_INT08U   *p_opt,
+                                                      CPU_INT16U    opt_ix,
+                                                      CPU_INT08U   *p_opt_len,
+                                                      NET_ERR      *p_err)
+{
+    CPU_INT08U  cookie_len;
+
+
+    p_opt++;
+   *p_opt_len = *p_opt;
+    if (*p_opt_len < NET_TCP_HDR_OPT_LEN_MIN_LEN) {             /* If opt len < min opt len, rtn err.                   */
+         NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+        *p_err  = NET_TCP_ERR_INVALID_OPT_LEN;
+         return (DEF_YES);
+    }
+
+    cookie_len = *p_opt_len - NET_TCP_HDR_OPT_LEN_MIN_LEN;
+    if ((cookie_len == NET_TCP_FAST_OPEN_COOKIE_LEN_REQ) ||     /* If valid cookie len (see Note #2), ...               */
+       ((cookie_len >= NET_TCP_FAST_OPEN_COOKIE_LEN_MIN) &&
+        (cookie_len <= NET_TCP_FAST_OPEN_COOKIE_LEN_MAX))) {
+                                                                /* ... record cookie (see Note #3).                     */
+        p_buf_hdr->TCP_FastOpenCookieLen = cookie_len;
+        p_buf_hdr->TCP_FastOpenCookieIx  = opt_ix + NET_TCP_HDR_OPT_LEN_MIN_LEN;
+    }
+
+   *p_err = NET_TCP_ERR_NONE;
+
+    return (DEF_NO);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       NetTCP_RxPktDemuxSeg()
@@ -8230,6 +9894,8 @@ static  CPU_BOOLEAN  NetTCP_RxPktValidateOptMaxSegSize (NET_BUF_HDR  *p_buf_hdr,
 *
 *                               NET_TCP_ERR_NONE                Received packet successfully demultiplexed
 *                                                                   to appropriate TCP connection.
+*                               NET_TCP_ERR_CONN_DATA_NONE      Received packet successfully handled by a
+*                                                                   time-wait entry (see Note #4).
 *                               NET_CONN_ERR_INVALID_FAMILY     Invalid network connection family.
 *                               NET_CONN_ERR_INVALID_CONN       Invalid network connection number(s).
 *                               NET_ERR_RX_DEST                 Invalid destination; no connection available
@@ -8252,6 +9918,10 @@ static  CPU_BOOLEAN  NetTCP_RxPktValidateOptMaxSegSize (NET_BUF_HDR  *p_buf_hdr,
 *                       "if, in the destination host, the IP module cannot deliver the datagram because
 *                       the indicated ... process port is not active, the destination host may send a
 *                       destination unreachable message to the source host".
+*
+*               (4) Packets received for a compacted TIME-WAIT connection are handled by its time-wait entry
+*                   ONLY if NO complete TCP connection is found (see 'net_tcp.h  TCP TIME-WAIT DEFINES
+*                   Note #2').
 *********************************************************************************************************
 */
 
@@ -8267,6 +9937,9 @@ static  void  NetTCP_RxPktDemuxSeg (NET_BUF      *p_buf,
     NET_CONN_ID            conn_id           = NET_CONN_ID_NONE;
     NET_CONN_ID            conn_id_transport = NET_CONN_ID_NONE;
     NET_CONN_ID            conn_id_app       = NET_CONN_ID_NONE;
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+    CPU_BOOLEAN            time_wait;
+#endif
     NET_ERR                err;
 
                                                                 /* ------- SRCH CONN LIST FOR PKT/CONN ADDR(S) -------- */
@@ -8320,6 +9993,17 @@ static  void  NetTCP_RxPktDemuxSeg (NET_BUF      *p_buf,
                           &conn_id_transport,
                           &conn_id_app,
                           &err);
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+    if (err != NET_CONN_ERR_CONN_FULL) {                        /* If NO complete TCP conn found, ...                   */
+        time_wait = NetTCP_RxPktTimeWait(p_buf_hdr, family, &addr_local[0], &addr_remote[0]);
+        if (time_wait == DEF_YES) {                             /* ... & pkt handled by time-wait entry, ...            */
+           *p_err = NET_TCP_ERR_CONN_DATA_NONE;                 /* ... rtn w/o demux (see Note #4).                     */
+            return;
+        }
+    }
+#endif
+
     switch (err) {
         case NET_CONN_ERR_CONN_FULL:                            /* Complete TCP conn found.                             */
              p_buf_hdr->ConnType = NET_CONN_TYPE_CONN_FULL;
@@ -8466,6 +10150,13 @@ static  void  NetTCP_RxPktDemuxSeg (NET_BUF      *p_buf,
 *                   connection is closed" and "The process can no longer issue any of the read functions
 *                   on the socket. Any data received after this call for a TCP socket is acknowledged and
 *                   silently discarded.
+*
+*               (7) Once window scaling is negotiated, the window field of every received non-SYN segment
+*                   is scaled by the remote host's advertised window scale (see 'net_tcp.h  TCP WINDOW
+*                   SIZE DEFINES  Note #2').
+*
+*               (8) A TCP connection in the TIME-WAIT state is compacted into a time-wait entry ONLY after
+*                   the received segment is acknowledged (see 'net_tcp.h  TCP TIME-WAIT DEFINES  Note #1').
 *********************************************************************************************************
 */
 
@@ -8491,6 +10182,13 @@ static  void  NetTCP_RxPktConnHandler (NET_BUF      *p_buf,
                                                                 /* ------------ DEMUX TCP PKT TO TCP CONN ------------- */
     p_conn = &NetTCP_ConnTbl[conn_id_tcp];
 
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN                             /* Scale rx'd win size (see Note #7).                   */
+    if ((p_conn->WinScaleEn    == DEF_YES) &&
+        (p_buf_hdr->TCP_SegSync == DEF_NO)) {
+         p_buf_hdr->TCP_WinSize <<= p_conn->TxWinScale;
+    }
+#endif
+
     switch (p_conn->ConnState) {
         case NET_TCP_CONN_STATE_FREE:
              NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
@@ -9040,7 +10738,817 @@ static  void  NetTCP_RxPktConnHandler (NET_BUF      *p_buf,
             *p_err = NET_TCP_ERR_INVALID_CONN_STATE;
              return;
     }
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+    if (p_conn->ConnState == NET_TCP_CONN_STATE_TIME_WAIT) {    /* Compact time-wait conn (see Note #8).                */
+        NetTCP_ConnTimeWaitCompact(p_conn);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_RxConnWinScaleCfg()
+*
+* Description : Configure TCP connection's window scaling from a received synchronization segment.
+*
+* Argument(s) : p_conn      Pointer to TCP connection.
+*               ------      Argument validated in NetTCP_RxPktConnHandlerListen(),
+*                                                 NetTCP_RxPktConnHandlerSyncTxd().
+*
+*               p_buf_hdr   Pointer to received synchronization segment's network buffer header.
+*               ---------   Argument validated in NetTCP_Rx().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerListen(),
+*               NetTCP_RxPktConnHandlerSyncTxd().
+*
+* Note(s)     : (1) RFC #7323, Section 2.2 states that window scaling is enabled in both directions ONLY
+*                   if BOTH hosts send a Window Scale option in their SYN segments.  If the remote host
+*                   did NOT send a Window Scale option, both window scales are cleared.
+*
+*               (2) (a) For passive opens, the local receive window scale is calculated when the remote
+*                       host's SYN offers window scaling.
+*
+*                   (b) For active opens, the local receive window scale was already advertised in the
+*                       transmitted SYN & MUST NOT be changed (see 'NetTCP_TxConnSync()  Note #8a').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+static  void  NetTCP_RxConnWinScaleCfg (NET_TCP_CONN  *p_conn,
+                                        NET_BUF_HDR   *p_buf_hdr)
+{
+    if (p_buf_hdr->TCP_WinScale == NET_TCP_WIN_SCALE_NONE) {    /* If NO win scale opt rx'd, ...                        */
+        p_conn->WinScaleEn = DEF_NO;                            /* ... dis win scaling (see Note #1).                   */
+        p_conn->RxWinScale = NET_TCP_WIN_SCALE_MIN;
+        p_conn->TxWinScale = NET_TCP_WIN_SCALE_MIN;
+        return;
+    }
+
+    if (p_conn->WinScaleEn != DEF_YES) {                        /* See Note #2a.                                        */
+        p_conn->RxWinScale  = NetTCP_ConnWinScaleCalc(p_conn->RxWinSizeCfgd);
+        p_conn->WinScaleEn  = DEF_YES;
+    }
+    p_conn->TxWinScale = p_buf_hdr->TCP_WinScale;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_RxConnECN_Cfg()
+*
+* Description : Configure TCP connection's explicit congestion notification from a received synchronization
+*               segment.
+*
+* Argument(s) : p_conn      Pointer to TCP connection.
+*               ------      Argument validated in NetTCP_RxPktConnHandlerListen(),
+*                                                 NetTCP_RxPktConnHandlerSyncTxd().
+*
+*               p_buf_hdr   Pointer to received synchronization segment's network buffer header.
+*               ---------   Argument validated in NetTCP_Rx().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerListen(),
+*               NetTCP_RxPktConnHandlerSyncTxd().
+*
+* Note(s)     : (1) (a) A SYN requests ECN with BOTH the ECE & CWR flags set (see 'net_tcp.h  TCP ECN
+*                       DEFINES  Note #1b').
+*
+*                   (b) A SYN/ACK accepts ECN with the ECE flag set & the CWR flag clear, but ONLY if ECN
+*                       was offered in the transmitted SYN (see 'net_tcp.h  TCP ECN DEFINES  Note #1a').
+*
+*               (2) Any ECN state from a previous incarnation of the TCP connection is cleared.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_ECN_MODULE_EN
+static  void  NetTCP_RxConnECN_Cfg (NET_TCP_CONN  *p_conn,
+                                    NET_BUF_HDR   *p_buf_hdr)
+{
+    CPU_BOOLEAN  ecn_echo;
+    CPU_BOOLEAN  ecn_cwr;
+
+
+    ecn_echo = DEF_BIT_IS_SET(p_buf_hdr->TCP_HdrLen_Flags, NET_TCP_HDR_FLAG_ECE);
+    ecn_cwr  = DEF_BIT_IS_SET(p_buf_hdr->TCP_HdrLen_Flags, NET_TCP_HDR_FLAG_CWR);
+
+    if (p_buf_hdr->TCP_SegAck == DEF_NO) {                      /* If SYN rx'd, en ECN if req'd (see Note #1a).         */
+        p_conn->ECN_En = ((ecn_echo == DEF_YES) &&
+                          (ecn_cwr  == DEF_YES)) ? DEF_YES : DEF_NO;
+    } else {                                                    /* If SYN/ACK rx'd, en ECN if accepted (see Note #1b).  */
+        p_conn->ECN_En = ((p_conn->ECN_En == DEF_YES) &&
+                          (ecn_echo       == DEF_YES) &&
+                          (ecn_cwr        == DEF_NO )) ? DEF_YES : DEF_NO;
+    }
+                                                                /* Clr ECN state (see Note #2).                         */
+    p_conn->RxECN_EchoReqd = DEF_NO;
+    p_conn->TxECN_CWR_Reqd = DEF_NO;
+    p_conn->TxECN_Recovery = DEF_NO;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_RxConnFastOpenChk()
+*
+* Description : Check a received TCP Fast Open connection request's cookie.
+*
+* Argument(s) : p_conn      Pointer to TCP listen connection.
+*               ------      Argument validated in NetTCP_RxPktConnHandlerListen().
+*
+*               p_buf       Pointer to network buffer that received the synchronization segment.
+*               -----       Argument checked   in NetTCP_Rx().
+*
+*               p_buf_hdr   Pointer to received synchronization segment's network buffer header.
+*               ---------   Argument validated in NetTCP_Rx().
+*
+* Return(s)   : DEF_YES, if the received cookie is valid.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerListen().
+*
+* Note(s)     : (1) Synchronization segment data is accepted ONLY with a valid cookie; otherwise, any
+*                   data is discarded & MUST be re-transmitted by the remote host once the connection is
+*                   established (see 'net_tcp.h  TCP FAST OPEN DEFINES  Note #1c').
+*
+*               (2) If TCP Fast Open is NOT enabled on the TCP listen connection, synchronization segment
+*                   data is handled as specified by RFC #793.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  CPU_BOOLEAN  NetTCP_RxConnFastOpenChk (NET_TCP_CONN  *p_conn,
+                                               NET_BUF       *p_buf,
+                                               NET_BUF_HDR   *p_buf_hdr)
+{
+    CPU_INT08U   addr_local [NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U   addr_remote[NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U   cookie[NET_TCP_FAST_OPEN_COOKIE_LEN];
+    CPU_BOOLEAN  valid;
+
+
+    if (p_conn->FastOpenEn != DEF_ENABLED) {                    /* See Note #2.                                         */
+        return (DEF_NO);
+    }
+
+    valid = DEF_NO;
+    if (p_buf_hdr->TCP_FastOpenCookieLen == NET_TCP_FAST_OPEN_COOKIE_LEN) {
+        NetTCP_RxPktConnAddrsGet(p_buf_hdr, &addr_local[0], &addr_remote[0]);
+        NetTCP_FastOpenCookieGet(&addr_remote[0], &cookie[0]);
+        valid = Mem_Cmp(&cookie[0],
+                        &p_buf->DataPtr[p_buf_hdr->TCP_FastOpenCookieIx],
+                         NET_TCP_FAST_OPEN_COOKIE_LEN);
+        Mem_Clr(&cookie[0], sizeof(cookie));
+    }
+
+    if (valid != DEF_YES) {                                     /* Discard sync seg data (see Note #1).                 */
+        p_buf_hdr->TCP_SegLenInit -= p_buf_hdr->TCP_SegLenData;
+        p_buf_hdr->TCP_SegLen     -= p_buf_hdr->TCP_SegLenData;
+        p_buf_hdr->TCP_SegLenData  = 0u;
+    }
+
+    return (valid);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_RxConnFastOpenCfg()
+*
+* Description : Configure TCP Fast Open from a received synchronization/acknowledgement segment.
+*
+* Argument(s) : p_conn      Pointer to TCP connection.
+*               ------      Argument validated in NetTCP_RxPktConnHandlerSyncTxd().
+*
+*               p_buf       Pointer to network buffer that received the synchronization segment.
+*               -----       Argument checked   in NetTCP_Rx().
+*
+*               p_buf_hdr   Pointer to received synchronization segment's network buffer header.
+*               ---------   Argument validated in NetTCP_Rx().
+*
+*               ack_code    Received segment's acknowledgement code.
+*
+* Return(s)   : DEF_YES, if un-acknowledged synchronization segment data MUST be re-transmitted.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerSyncTxd().
+*
+* Note(s)     : (1) A cookie received from the remote host is cached for subsequent connection requests
+*                   (see 'net_tcp.h  TCP FAST OPEN DEFINES  Note #1a').
+*
+*               (2) If the remote host does NOT acknowledge ALL of the synchronization segment's data,
+*                   the synchronization segment in the re-transmit queue is converted to a data segment
+*                   holding the un-acknowledged data (see 'net_tcp.h  TCP FAST OPEN DEFINES  Note #1b').
+*
+*                   The TCP connection's un-acknowledged sequence numbers are advanced to the received
+*                   acknowledgement so that the converted segment is NOT handled as acknowledged.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  CPU_BOOLEAN  NetTCP_RxConnFastOpenCfg (NET_TCP_CONN      *p_conn,
+                                               NET_BUF           *p_buf,
+                                               NET_BUF_HDR       *p_buf_hdr,
+                                               NET_TCP_ACK_CODE   ack_code)
+{
+    CPU_INT08U         addr_local [NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U         addr_remote[NET_CONN_ADDR_LEN_MAX];
+    NET_BUF           *p_seg;
+    NET_BUF_HDR       *p_seg_hdr;
+    NET_TCP_SEG_SIZE   data_len_ackd;
+    NET_TCP_SEG_SIZE   data_len_ackd_align;
+
+
+    if (p_conn->FastOpenEn != DEF_ENABLED) {
+        return (DEF_NO);
+    }
+                                                                /* ------------------- CACHE COOKIE ------------------- */
+    if ((p_buf_hdr->TCP_FastOpenCookieLen != NET_TCP_FAST_OPEN_COOKIE_LEN_NONE) &&
+        (p_buf_hdr->TCP_FastOpenCookieLen != NET_TCP_FAST_OPEN_COOKIE_LEN_REQ )) {
+        NetTCP_RxPktConnAddrsGet(p_buf_hdr, &addr_local[0], &addr_remote[0]);
+        Mem_Clr(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], NET_CONN_ADDR_IP_LEN_PORT);
+        NetTCP_FastOpenCacheUpdate(&addr_remote[0],             /* See Note #1.                                         */
+                                   &p_buf->DataPtr[p_buf_hdr->TCP_FastOpenCookieIx],
+                                    p_buf_hdr->TCP_FastOpenCookieLen);
+    }
+
+                                                                /* ------------- HANDLE UN-ACK'D SYNC DATA ------------ */
+    if ((ack_code                  != NET_TCP_CONN_RX_ACK_VALID) ||
+        (p_conn->TxFastOpenDataLen == 0u)) {
+        return (DEF_NO);
+    }
+
+    p_seg = p_conn->ReTxQ_Head;
+    if (p_seg == DEF_NULL) {
+        p_conn->TxFastOpenDataLen = 0u;
+        return (DEF_NO);
+    }
+    p_seg_hdr = &p_seg->Hdr;
+                                                                /* If ALL sync seg data ack'd, ...                      */
+    if ((p_seg_hdr->TCP_SegSync != DEF_YES) ||
+        (p_buf_hdr->TCP_AckNbr  == (p_conn->TxSeqNbrSync + p_seg_hdr->TCP_SegLen))) {
+        p_conn->TxFastOpenDataLen = 0u;                         /* ... NO re-tx req'd.                                  */
+        return (DEF_NO);
+    }
+                                                                /* Convert sync seg to data seg (see Note #2).          */
+    data_len_ackd       = (NET_TCP_SEG_SIZE)(p_buf_hdr->TCP_AckNbr - (p_conn->TxSeqNbrSync + NET_TCP_SEG_LEN_SYNC));
+                                                                /* Align partial ack to word boundary ...               */
+                                                                /* ... (see 'NetTCP_RxPktConnHandlerReTxQ()  Note #6'). */
+    data_len_ackd_align = data_len_ackd - (data_len_ackd % sizeof(CPU_ALIGN));
+
+    p_seg_hdr->DataIx         += data_len_ackd_align;
+    p_seg_hdr->DataLen        -= data_len_ackd_align;
+    p_seg_hdr->TotLen         -= data_len_ackd_align;
+
+    p_seg_hdr->TCP_SeqNbr      =  p_conn->TxSeqNbrSync + NET_TCP_SEG_LEN_SYNC + data_len_ackd_align;
+    p_seg_hdr->TCP_SegLenData  =  p_conn->TxFastOpenDataLen - data_len_ackd_align;
+    p_seg_hdr->TCP_SegLen      =  p_seg_hdr->TCP_SegLenData;
+    p_seg_hdr->TCP_SegSync     =  DEF_NO;
+    p_seg_hdr->TCP_SegAck      =  DEF_YES;
+    p_seg_hdr->TCP_Flags       = (NET_TCP_FLAGS)(NET_TCP_FLAG_TX_ACK | NET_TCP_FLAG_TX_PUSH);
+    p_seg_hdr->TCP_SegReTxCtr  =  0u;
+
+    p_conn->TxSeqNbrUnAckd           = p_buf_hdr->TCP_AckNbr;
+    p_conn->TxSeqNbrUnReTxd          = p_buf_hdr->TCP_AckNbr;
+    p_conn->TxSeqNbrUnAckdAlignDelta = data_len_ackd - data_len_ackd_align;
+    p_conn->TxFastOpenDataLen        = 0u;
+
+    return (DEF_YES);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_FastOpenCookieGet()
+*
+* Description : Get TCP Fast Open cookie for a remote host.
+*
+* Argument(s) : p_addr_remote   Pointer to remote host's connection address.
+*
+*               p_cookie        Pointer to memory buffer that will receive the cookie (see Note #1).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxConnFastOpenChk(),
+*               NetTCP_TxConnSync().
+*
+* Note(s)     : (1) The cookie is the first 'NET_TCP_FAST_OPEN_COOKIE_LEN' octets of the MD5 digest of the
+*                   remote host's address & the secret key; the remote host's port is excluded (see
+*                   'net_tcp.h  TCP FAST OPEN DEFINES  Note #2').
+*
+*               (2) The secret key & MD5 context are shared with the initial sequence number generator
+*                   (see 'NetTCP_ConnFiveTupleSeqNbrGet()').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  void  NetTCP_FastOpenCookieGet (CPU_INT08U  *p_addr_remote,
+                                        CPU_INT08U  *p_cookie)
+{
+    NET_TCP_ISN_FIVE_TUPLE  cookie_tuple;
+    CPU_INT08U              hash_output[16u];
+
+
+    Mem_Clr(&cookie_tuple, sizeof(cookie_tuple));
+
+    Mem_Copy(&cookie_tuple.Remote_IP[0], p_addr_remote, NET_CONN_ADDR_LEN_MAX);
+    Mem_Clr(&cookie_tuple.Remote_IP[NET_CONN_ADDR_IP_IX_PORT], NET_CONN_ADDR_IP_LEN_PORT);
+    Mem_Copy(cookie_tuple.Secret,                               /* Load secret key (see Note #2).                       */
+            &NetTCP_ISN_SecretKey,
+             sizeof(NetTCP_ISN_SecretKey));
+
+    NetMD5_Init(&NetTCP_ISN_MD5_Handle);
+    NetMD5_Update(              &NetTCP_ISN_MD5_Handle,
+                  (CPU_INT08U *)&cookie_tuple,
+                                 sizeof(NET_TCP_ISN_FIVE_TUPLE));
+
+    NetMD5_Final(hash_output, &NetTCP_ISN_MD5_Handle);
+                                                                /* Truncate hash to cookie len (see Note #1).           */
+    Mem_Copy(p_cookie, &hash_output[0], NET_TCP_FAST_OPEN_COOKIE_LEN);
+
+    Mem_Clr(&NetTCP_ISN_MD5_Handle, sizeof(NET_MD5_CONTEXT));
+    Mem_Clr(&cookie_tuple,          sizeof(cookie_tuple));
+    Mem_Clr(&hash_output[0],        sizeof(hash_output));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_FastOpenCacheSrch()
+*
+* Description : Search TCP Fast Open cookie cache for a remote host's cookie.
+*
+* Argument(s) : p_addr_remote   Pointer to remote host's connection address, with port cleared.
+*
+* Return(s)   : Pointer to cookie cache entry, if found.
+*
+*               Pointer to NULL,               otherwise.
+*
+* Caller(s)   : NetTCP_FastOpenCacheUpdate(),
+*               NetTCP_TxConnSync().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  NET_TCP_FAST_OPEN_CACHE_ENTRY  *NetTCP_FastOpenCacheSrch (CPU_INT08U  *p_addr_remote)
+{
+    NET_TCP_FAST_OPEN_CACHE_ENTRY  *p_entry;
+    CPU_BOOLEAN                     found;
+    CPU_INT16U                      ix;
+
+
+    for (ix = 0u; ix < NET_TCP_DFLT_FAST_OPEN_CACHE_NBR_ENTRY; ix++) {
+        p_entry = &NetTCP_FastOpenCacheTbl[ix];
+        if (p_entry->CookieLen != NET_TCP_FAST_OPEN_COOKIE_LEN_NONE) {
+            found = Mem_Cmp(&p_entry->AddrRemote[0], p_addr_remote, NET_CONN_ADDR_LEN_MAX);
+            if (found == DEF_YES) {
+                return (p_entry);
+            }
+        }
+    }
+
+    return (DEF_NULL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_FastOpenCacheUpdate()
+*
+* Description : Cache a remote host's TCP Fast Open cookie.
+*
+* Argument(s) : p_addr_remote   Pointer to remote host's connection address, with port cleared.
+*
+*               p_cookie        Pointer to cookie.
+*
+*               cookie_len      Length of cookie (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxConnFastOpenCfg().
+*
+* Note(s)     : (1) If the remote host is NOT cached & NO cache entry is free, the least recently updated
+*                   cache entry is replaced.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  void  NetTCP_FastOpenCacheUpdate (CPU_INT08U  *p_addr_remote,
+                                          CPU_INT08U  *p_cookie,
+                                          CPU_INT08U   cookie_len)
+{
+    NET_TCP_FAST_OPEN_CACHE_ENTRY  *p_entry;
+    NET_TCP_FAST_OPEN_CACHE_ENTRY  *p_entry_oldest;
+    NET_TS_MS                       ts_ms;
+    NET_TS_MS                       age_ms;
+    NET_TS_MS                       age_ms_max;
+    CPU_INT16U                      ix;
+
+
+    ts_ms   = NetUtil_TS_Get_ms();
+    p_entry = NetTCP_FastOpenCacheSrch(p_addr_remote);
+
+    if (p_entry == DEF_NULL) {                                  /* If remote host NOT cached, ...                       */
+        p_entry_oldest = &NetTCP_FastOpenCacheTbl[0];
+        age_ms_max     =  0u;
+        for (ix = 0u; ix < NET_TCP_DFLT_FAST_OPEN_CACHE_NBR_ENTRY; ix++) {
+            p_entry = &NetTCP_FastOpenCacheTbl[ix];
+            if (p_entry->CookieLen == NET_TCP_FAST_OPEN_COOKIE_LEN_NONE) {
+                p_entry_oldest = p_entry;                       /* ... get free entry ...                               */
+                break;
+            }
+            age_ms = ts_ms - p_entry->TS_ms;
+            if (age_ms >= age_ms_max) {
+                age_ms_max     = age_ms;
+                p_entry_oldest = p_entry;
+            }
+        }
+        p_entry = p_entry_oldest;                               /* ... or oldest entry (see Note #1).                   */
+    }
+
+    Mem_Copy(&p_entry->AddrRemote[0], p_addr_remote, NET_CONN_ADDR_LEN_MAX);
+    Mem_Copy(&p_entry->Cookie[0],     p_cookie,      cookie_len);
+    p_entry->CookieLen = cookie_len;
+    p_entry->TS_ms     = ts_ms;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_RxPathMTU_Handler()
+*
+* Description : Demultiplex a reported path MTU to the TCP connection that transmitted the quoted segment.
+*
+* Argument(s) : family          Connection family.
+*
+*               protocol_ix     Connection protocol index.
+*
+*               p_addr_local    Pointer to local  connection address, as quoted segment's source      address.
+*
+*               p_addr_remote   Pointer to remote connection address, as quoted segment's destination address.
+*
+*               addr_len        Length of connection addresses (in octets).
+*
+*               p_tcp_hdr       Pointer to the quoted TCP segment's header.
+*
+*               mtu             Reported path MTU (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPathMTU_IPv4(),
+*               NetTCP_RxPathMTU_IPv6().
+*
+* Note(s)     : (1) Reported path MTUs are ignored unless the quoted segment's sequence number is currently
+*                   un-acknowledged by a complete TCP connection (see 'net_tcp.h  TCP PATH MTU DISCOVERY
+*                   DEFINES  Note #1a').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void  NetTCP_RxPathMTU_Handler (NET_CONN_FAMILY        family,
+                                        NET_CONN_PROTOCOL_IX   protocol_ix,
+                                        CPU_INT08U            *p_addr_local,
+                                        CPU_INT08U            *p_addr_remote,
+                                        NET_CONN_ADDR_LEN      addr_len,
+                                        NET_TCP_HDR           *p_tcp_hdr,
+                                        CPU_INT32U             mtu)
+{
+    NET_TCP_CONN     *p_conn;
+    NET_TCP_SEQ_NBR   seq_nbr;
+    NET_TCP_SEQ_NBR   seq_offset;
+    NET_TCP_SEQ_NBR   seq_win;
+    NET_CONN_ID       conn_id_transport;
+    NET_CONN_ID       conn_id_app;
+    NET_ERR           err;
+
+
+    conn_id_transport = NET_CONN_ID_NONE;
+    conn_id_app       = NET_CONN_ID_NONE;
+   (void)NetConn_Srch(family,                                   /* Srch for TCP conn.                                   */
+                      protocol_ix,
+                      p_addr_local,
+                      p_addr_remote,
+                      addr_len,
+                     &conn_id_transport,
+                     &conn_id_app,
+                     &err);
+    if (err != NET_CONN_ERR_CONN_FULL) {                        /* If NO complete TCP conn found, ignore MTU.           */
+        return;
+    }
+    if ((conn_id_transport < NET_TCP_CONN_ID_MIN) ||
+        (conn_id_transport > NET_TCP_CONN_ID_MAX)) {
+        return;
+    }
+
+    p_conn = &NetTCP_ConnTbl[conn_id_transport];
+    if (p_conn->ConnState == NET_TCP_CONN_STATE_FREE) {
+        return;
+    }
+                                                                /* Chk quoted seq nbr is un-ack'd (see Note #1).        */
+    seq_nbr    = (NET_TCP_SEQ_NBR)NET_UTIL_VAL_GET_NET_32(&p_tcp_hdr->SeqNbr);
+    seq_offset = (NET_TCP_SEQ_NBR)(seq_nbr              - p_conn->TxSeqNbrUnAckd);
+    seq_win    = (NET_TCP_SEQ_NBR)(p_conn->TxSeqNbrNext - p_conn->TxSeqNbrUnAckd);
+    if (seq_offset >= seq_win) {
+        return;
+    }
+
+    NetTCP_ConnPathMTU_Set(p_conn, mtu);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_PathMTU_CacheSrch()
+*
+* Description : Search TCP path MTU cache for a remote host's path maximum segment size.
+*
+* Argument(s) : p_addr_remote   Pointer to remote host's connection address, with port cleared.
+*
+* Return(s)   : Pointer to path MTU cache entry, if found.
+*
+*               Pointer to NULL,                 otherwise.
+*
+* Caller(s)   : NetTCP_PathMTU_CacheUpdate(),
+*               NetTCP_ConnPathMTU_Init().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  NET_TCP_PATH_MTU_CACHE_ENTRY  *NetTCP_PathMTU_CacheSrch (CPU_INT08U  *p_addr_remote)
+{
+    NET_TCP_PATH_MTU_CACHE_ENTRY  *p_entry;
+    CPU_BOOLEAN                    found;
+    CPU_INT16U                     ix;
+
+
+    for (ix = 0u; ix < NET_TCP_DFLT_PATH_MTU_CACHE_NBR_ENTRY; ix++) {
+        p_entry = &NetTCP_PathMTU_CacheTbl[ix];
+        if (p_entry->MaxSegSize != NET_TCP_MAX_SEG_SIZE_NONE) {
+            found = Mem_Cmp(&p_entry->AddrRemote[0], p_addr_remote, NET_CONN_ADDR_LEN_MAX);
+            if (found == DEF_YES) {
+                return (p_entry);
+            }
+        }
+    }
+
+    return (DEF_NULL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_PathMTU_CacheUpdate()
+*
+* Description : Cache a remote host's path maximum segment size.
+*
+* Argument(s) : p_addr_remote   Pointer to remote host's connection address, with port cleared.
+*
+*               max_seg_size    Path maximum segment size (in octets).
+*
+*               ts_ms           Timestamp path maximum segment size reduced (in ms).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_ConnPathMTU_Set().
+*
+* Note(s)     : (1) If the remote host is NOT cached & NO cache entry is free, the least recently updated
+*                   cache entry is replaced.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void  NetTCP_PathMTU_CacheUpdate (CPU_INT08U        *p_addr_remote,
+                                          NET_TCP_SEG_SIZE   max_seg_size,
+                                          NET_TS_MS          ts_ms)
+{
+    NET_TCP_PATH_MTU_CACHE_ENTRY  *p_entry;
+    NET_TCP_PATH_MTU_CACHE_ENTRY  *p_entry_oldest;
+    NET_TS_MS                      age_ms;
+    NET_TS_MS                      age_ms_max;
+    CPU_INT16U                     ix;
+
+
+    p_entry = NetTCP_PathMTU_CacheSrch(p_addr_remote);
+
+    if (p_entry == DEF_NULL) {                                  /* If remote host NOT cached, ...                       */
+        p_entry_oldest = &NetTCP_PathMTU_CacheTbl[0];
+        age_ms_max     =  0u;
+        for (ix = 0u; ix < NET_TCP_DFLT_PATH_MTU_CACHE_NBR_ENTRY; ix++) {
+            p_entry = &NetTCP_PathMTU_CacheTbl[ix];
+            if (p_entry->MaxSegSize == NET_TCP_MAX_SEG_SIZE_NONE) {
+                p_entry_oldest = p_entry;                       /* ... get free entry ...                               */
+                break;
+            }
+            age_ms = ts_ms - p_entry->TS_ms;
+            if (age_ms >= age_ms_max) {
+                age_ms_max     = age_ms;
+                p_entry_oldest = p_entry;
+            }
+        }
+        p_entry = p_entry_oldest;                               /* ... or oldest entry (see Note #1).                   */
+    }
+
+    Mem_Copy(&p_entry->AddrRemote[0], p_addr_remote, NET_CONN_ADDR_LEN_MAX);
+    p_entry->MaxSegSize = max_seg_size;
+    p_entry->TS_ms      = ts_ms;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_RxPktTimeWait()
+*
+* Description : (1) Handle TCP packet received for a compacted TIME-WAIT connection :
+*
+*                   (a) Search time-wait table for received packet's connection addresses
+*                   (b) Handle received reset                                           See Note #2a
+*                   (c) Handle received connection request                              See Note #2b
+*                   (d) Acknowledge any other received segment                          See Note #2c
+*
+*
+* Argument(s) : p_buf_hdr       Pointer to network buffer header that received TCP packet.
+*               ---------       Argument validated in NetTCP_Rx().
+*
+*               family          Received packet's network connection family.
+*
+*               p_addr_local    Pointer to connection local  address.
+*
+*               p_addr_remote   Pointer to connection remote address.
+*
+* Return(s)   : DEF_YES, if received TCP packet handled by a time-wait entry.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetTCP_RxPktDemuxSeg().
+*
+* Note(s)     : (2) See 'net_tcp.h  TCP TIME-WAIT DEFINES  Note #2'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  CPU_BOOLEAN  NetTCP_RxPktTimeWait (NET_BUF_HDR      *p_buf_hdr,
+                                           NET_CONN_FAMILY   family,
+                                           CPU_INT08U       *p_addr_local,
+                                           CPU_INT08U       *p_addr_remote)
+{
+    NET_TCP_TIME_WAIT_ENTRY  *p_entry;
+    NET_TS_MS                 ts_ms;
+    NET_ERR                   err;
+
+
+    ts_ms   = NetUtil_TS_Get_ms();
+    p_entry = NetTCP_TimeWaitSrch(family, p_addr_local, p_addr_remote, ts_ms);
+    if (p_entry == DEF_NULL) {                                  /* If NO time-wait entry found, demux pkt.              */
+        return (DEF_NO);
+    }
+
+    if (p_buf_hdr->TCP_SegReset == DEF_YES) {                   /* If reset rx'd           ...                          */
+        if (p_buf_hdr->TCP_SeqNbr == p_entry->RxSeqNbrNext) {   /* ... with next rx seq nbr, ...                        */
+            p_entry->Family = NET_CONN_FAMILY_NONE;             /* ... free entry (see Note #2a).                       */
+        }
+        return (DEF_YES);
+    }
+
+    if ((p_buf_hdr->TCP_SegSync == DEF_YES) &&                  /* If conn req rx'd with greater seq nbr, ...           */
+        (p_buf_hdr->TCP_SegAck  == DEF_NO ) &&
+        ((CPU_INT32S)(p_buf_hdr->TCP_SeqNbr - p_entry->RxSeqNbrNext) > 0)) {
+        p_entry->Family = NET_CONN_FAMILY_NONE;                 /* ... free entry & demux pkt (see Note #2b).           */
+        return (DEF_NO);
+    }
+
+    if ((p_buf_hdr->TCP_SegSync  == DEF_NO) &&                  /* Discard ack-only segs (see Note #2c).                */
+        (p_buf_hdr->TCP_SegClose == DEF_NO) &&
+        (p_buf_hdr->TCP_SegLen   == 0u    )) {
+        return (DEF_YES);
+    }
+
+    if (p_buf_hdr->TCP_SegClose == DEF_YES) {                   /* If fin re-tx'd, restart 2MSL timeout (see Note #2c). */
+        p_entry->TS_ms = ts_ms;
+    }
+
+    NetTCP_TxTimeWaitAck(p_entry, p_buf_hdr, &err);            /* Tx ack (see Note #2c).                               */
+   (void)&err;                                                  /* Ignore transitory tx err(s).                         */
+
+    return (DEF_YES);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetTCP_TimeWaitSrch()
+*
+* Description : Search time-wait table for a compacted TIME-WAIT connection.
+*
+* Argument(s) : family          Connection family.
+*
+*               p_addr_local    Pointer to connection local  address.
+*
+*               p_addr_remote   Pointer to connection remote address.
+*
+*               ts_ms           Current time stamp (in milliseconds).
+*
+* Return(s)   : Pointer to time-wait entry, if found.
+*
+*               Pointer to NULL,            otherwise.
+*
+* Caller(s)   : NetTCP_RxPktTimeWait(),
+*               NetTCP_ConnTimeWaitIsUsed().
+*
+* Note(s)     : (1) Expired time-wait entries are freed while searching (see 'net_tcp.h  TCP TIME-WAIT
+*                   DEFINES  Note #3').
+*
+*               (2) ONLY the port numbers & addresses are compared since any other connection address
+*                   fields (e.g. IPv6 flow information) are NOT set by ALL callers.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  NET_TCP_TIME_WAIT_ENTRY  *NetTCP_TimeWaitSrch (NET_CONN_FAMILY   family,
+                                                       CPU_INT08U       *p_addr_local,
+                                                       CPU_INT08U       *p_addr_remote,
+                                                       NET_TS_MS         ts_ms)
+{
+    NET_TCP_TIME_WAIT_ENTRY  *p_entry;
+    CPU_BOOLEAN               found;
+    CPU_INT16U                addr_ix;
+    CPU_INT16U                addr_len;
+    CPU_INT16U                i;
+
+
+    switch (family) {                                           /* Get addr fields to cmp (see Note #2).                */
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_CONN_FAMILY_IP_V4_SOCK:
+             addr_ix  = NET_CONN_ADDR_IP_V4_IX_ADDR;
+             addr_len = NET_CONN_ADDR_IP_V4_LEN_ADDR;
+             break;
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_CONN_FAMILY_IP_V6_SOCK:
+             addr_ix  = NET_CONN_ADDR_IP_V6_IX_ADDR;
+             addr_len = NET_CONN_ADDR_IP_V6_LEN_ADDR;
+             break;
+#endif
+
+        default:
+             return (DEF_NULL);
+    }
+
+    p_entry = &NetTCP_TimeWaitTbl[0];
+    for (i = 0u; i < NET_TCP_DFLT_TIME_WAIT_NBR_ENTRY; i++) {
+        if (p_entry->Family != NET_CONN_FAMILY_NONE) {
+            if ((NET_TS_MS)(ts_ms - p_entry->TS_ms) >= p_entry->Timeout_ms) {
+                p_entry->Family = NET_CONN_FAMILY_NONE;         /* Free expired entry (see Note #1).                    */
+
+            } else if (p_entry->Family == family) {
+                found = Mem_Cmp(&p_entry->AddrLocal[NET_CONN_ADDR_IP_IX_PORT],
+                                &p_addr_local[NET_CONN_ADDR_IP_IX_PORT],
+                                 NET_CONN_ADDR_IP_LEN_PORT);
+                if (found == DEF_YES) {
+                    found = Mem_Cmp(&p_entry->AddrLocal[addr_ix], &p_addr_local[addr_ix], addr_len);
+                }
+                if (found == DEF_YES) {
+                    found = Mem_Cmp(&p_entry->AddrRemote[NET_CONN_ADDR_IP_IX_PORT],
+                                    &p_addr_remote[NET_CONN_ADDR_IP_IX_PORT],
+                                     NET_CONN_ADDR_IP_LEN_PORT);
+                }
+                if (found == DEF_YES) {
+                    found = Mem_Cmp(&p_entry->AddrRemote[addr_ix], &p_addr_remote[addr_ix], addr_len);
+                }
+                if (found == DEF_YES) {
+                    return (p_entry);
+                }
+            } else {
+                                                                /* Empty Else Statement                                 */
+            }
+        }
+        p_entry++;
+    }
+
+    return (DEF_NULL);
 }
+#endif
 
 
 /*
@@ -9060,13 +11568,7 @@ static  void  NetTCP_RxPktConnHandler (NET_BUF      *p_buf,
 *                   (c) Prepare/configure TCP connection :
 *
 *                       (1) Clone new TCP connection from current TCP listen connection,    See Note #5a
-*                               if half-connection :
-*
-*                           (A) Get  connections
-*                           (B) Set  connection  identification handles
-*                           (C) Set  connection  addresses
-*                           (D) Add  connection  into connection list
-*                           (E) Copy connection  from half-connection
+*                               if half-connection                                          See Note #9
 *
 *                       (2) Reconfigure current TCP listen connection,                      See Note #5b
 *                               if full-connection
@@ -9280,6 +11782,34 @@ static  void  NetTCP_RxPktConnHandler (NET_BUF      *p_buf,
 *
 *               (8) TCP connection timeout for LISTEN state is implemented by TCP connection retransmission
 *                   function(s) (see 'NetTCP_TxConnReTxQ()  Note #3c').
+*
+*               (9) If the TCP SYN cache is enabled, connection requests to a LISTEN-state half-connection
+*                   are NOT cloned until the three-way handshake completes (see 'net_tcp.h  TCP SYN CACHE
+*                   DEFINES  Note #1') :
+*
+*                   (a) Received synchronization segments are cached & answered statelessly.
+*
+*                       See also 'NetTCP_SynCacheRxSync()'.
+*
+*                   (b) Received acknowledgement segments that complete a cached connection request clone
+*                       a new connection in the SYN-RECEIVED state to handle the acknowledgement; all other
+*                       acknowledgement segments are handled as described in Note #2b.
+*
+*                       See also 'NetTCP_SynCacheRxAck()'.
+*
+*               (10) If TCP Fast Open is enabled on the LISTEN-state connection (see 'net_tcp.h  TCP FAST OPEN
+*                    DEFINES  Note #1c') :
+*
+*                    (a) Received synchronization segment data is accepted ONLY with a valid cookie.
+*
+*                        See also 'NetTCP_RxConnFastOpenChk()'.
+*
+*                    (b) Connection requests with a valid cookie bypass the TCP SYN cache so that their data
+*                        is available once the connection is accepted (see 'net_tcp.h  TCP FAST OPEN DEFINES
+*                        Note #4').  Cookies are therefore ONLY issued for connection requests NOT handled by
+*                        the TCP SYN cache.
+*
+*                    (c) Connection requests without a valid cookie are answered with a new cookie.
 *********************************************************************************************************
 */
 
@@ -9288,27 +11818,36 @@ static  void  NetTCP_RxPktConnHandlerListen (NET_TCP_CONN  *p_conn,
                                              NET_BUF_HDR   *p_buf_hdr,
                                              NET_ERR       *p_err)
 {
-    CPU_INT08U             addr_local[NET_CONN_ADDR_LEN_MAX];
-    CPU_INT08U             addr_remote[NET_CONN_ADDR_LEN_MAX];
     CPU_BOOLEAN            q_avail           = DEF_NO;
     NET_TCP_SEG_SIZE       mss_dflt_tx       = 0u;
     NET_TCP_SEQ_CODE       seq_code          = 0u;
     NET_TCP_ACK_CODE       ack_code          = 0u;
     NET_TCP_RESET_CODE     reset_code        = 0u;
-    NET_IF_NBR             if_nbr            = NET_IF_NBR_NONE;
-    NET_CONN_FAMILY        conn_family       = NET_CONN_FAMILY_NONE;
-    NET_CONN_PROTOCOL_IX   conn_protocol_ix  = NET_CONN_PROTOCOL_IX_NONE;
-    NET_CONN_ID            conn_id           = NET_CONN_ID_NONE;
     NET_CONN_ID            conn_id_clone     = NET_CONN_ID_NONE;
     NET_CONN_ID            conn_id_clone_app = NET_CONN_ID_NONE;
-    NET_TCP_CONN_ID        conn_id_clone_tcp = NET_CONN_ID_NONE;
-    NET_TCP_CONN          *p_conn_clone      = DEF_NULL;
     NET_TCP_CONN          *p_conn_tx_sync    = DEF_NULL;
     NET_TCP_CONN_STATE     state             = NET_TCP_CONN_STATE_NONE;
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+    CPU_BOOLEAN            syn_cache         = DEF_NO;
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    CPU_BOOLEAN            fast_open         = DEF_NO;
+#endif
     NET_ERR                err               = NET_ERR_NONE;
     NET_ERR                err_rtn           = NET_TCP_ERR_NONE;
 
 
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN                             /* ------------- CHK TCP SYN CACHE CONN REQ ----------- */
+    if ((p_buf_hdr->ConnType     != NET_CONN_TYPE_CONN_FULL) && /* If ack rx'd on half-conn, ...                        */
+        (p_buf_hdr->TCP_SegAck   == DEF_YES) &&
+        (p_buf_hdr->TCP_SegSync  == DEF_NO ) &&
+        (p_buf_hdr->TCP_SegReset == DEF_NO )) {
+        if (NetTCP_SynCacheRxAck(p_conn, p_buf, p_buf_hdr, p_err) == DEF_YES) {
+            return;                                             /* ... & cached conn req completed (see Note #9b).      */
+        }
+    }
+#endif
+
                                                                 /* -------------- VALIDATE RX'D TCP PKT --------------- */
                                                                 /* Chk for rx'd fin/close.                              */
     if (p_buf_hdr->TCP_SegClose != DEF_NO) {                    /* If invalid   fin/close rx'd, ...                     */
@@ -9351,6 +11890,10 @@ static  void  NetTCP_RxPktConnHandlerListen (NET_TCP_CONN  *p_conn,
     p_buf_hdr->TCP_SegLenInit += NET_TCP_SEG_LEN_SYNC;
     p_buf_hdr->TCP_SegLen     += NET_TCP_SEG_LEN_SYNC;
 
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN                             /* Chk TFO cookie (see Note #10a).                      */
+    fast_open = NetTCP_RxConnFastOpenChk(p_conn, p_buf, p_buf_hdr);
+#endif
+
 
 
                                                                 /* -------------- CHK TCP CONN LISTEN Q --------------- */
@@ -9365,159 +11908,29 @@ static  void  NetTCP_RxPktConnHandlerListen (NET_TCP_CONN  *p_conn,
     }
 
 
-
-                                                                /* ----------------- PREPARE TCP CONN ----------------- */
-    if (p_buf_hdr->ConnType != NET_CONN_TYPE_CONN_FULL) {       /* If pkt demux'd to half-conn, clone new conn          */
-                                                                /* .. from LISTEN    half-conn (see Note #5a).          */
-                                                                /* -------------------- GET CONNS --------------------- */
-
-        conn_id_clone_tcp =  NetTCP_ConnGet(p_conn->FnctAppPostRx,
-                                            p_conn->FnctAppPostTx,
-                                           &err);
-        if ( err != NET_TCP_ERR_NONE) {                         /* See Note #6a.                                        */
-           *p_err  = NET_TCP_ERR_NONE_AVAIL;
-            return;
-        }
-        p_conn_clone = &NetTCP_ConnTbl[conn_id_clone_tcp];
-
-
-#ifdef  NET_IP_MODULE_EN
-        if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
-#ifdef  NET_IPv4_MODULE_EN
-            conn_family      =  NET_CONN_FAMILY_IP_V4_SOCK;
-            conn_protocol_ix =  NET_CONN_PROTOCOL_IX_IP_V4_TCP;
-#endif
-        } else {
-#ifdef  NET_IPv6_MODULE_EN
-            conn_family      =  NET_CONN_FAMILY_IP_V6_SOCK;
-            conn_protocol_ix =  NET_CONN_PROTOCOL_IX_IP_V6_TCP;
-#endif
-        }
-#else                                                           /* See Notes #4 & #6d.                                  */
-        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_YES, NET_TCP_CONN_CLOSE_ALL);
-       *p_err = NET_CONN_ERR_INVALID_FAMILY;
-        return;
-#endif
-
-        conn_id_clone = NetConn_Get(conn_family, conn_protocol_ix, &err);
-        if ( err != NET_CONN_ERR_NONE) {                        /* See Note #6b.                                        */
-            NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
-           *p_err  = NET_TCP_ERR_NONE_AVAIL;
-            return;
-        }
-
-
-                                                                /* SET CONN IDs                                         */
-        p_conn_clone->ID_Conn = conn_id_clone;
-        NetConn_ID_TransportSet((NET_CONN_ID) conn_id_clone,
-                                (NET_CONN_ID) conn_id_clone_tcp,
-                                (NET_ERR   *)&err);
-        if ( err != NET_CONN_ERR_NONE) {                        /* See Note #6c.                                        */
-            NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
-           *p_err  = NET_TCP_ERR_CONN_FAIL;
-            return;
-        }
-
-
-        conn_id           = p_conn->ID_Conn;
-        conn_id_clone_app = NetConn_ID_AppGet((NET_CONN_ID) conn_id, /* Get half-conn's app conn id & ...               */
-                                              (NET_ERR   *)&err);
-        if ( err != NET_CONN_ERR_NONE) {                        /* See Note #6c.                                        */
-            NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
-           *p_err  = NET_TCP_ERR_CONN_FAIL;
-            return;
-        }
-        if (conn_id_clone_app == NET_CONN_ID_NONE) {
-           *p_err  = NET_TCP_ERR_INVALID_CONN_ID;
-            return;
-        }
-
-        NetConn_ID_AppCloneSet((NET_CONN_ID) conn_id_clone,     /* ... set as cloned conn's      ...                    */
-                               (NET_CONN_ID) conn_id_clone_app, /* ... app conn clone id (see Note #5a2A1).             */
-                               (NET_ERR   *)&err);
-        if ( err != NET_CONN_ERR_NONE) {                        /* See Note #6c.                                        */
-            NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
-           *p_err  = NET_TCP_ERR_CONN_FAIL;
-            return;
-        }
-
-
-                                                                /* ------------------ CFG CONN ADDRS ------------------ */
-#ifdef  NET_IP_MODULE_EN
-
-        Mem_Clr((void     *)&addr_local,
-                (CPU_SIZE_T) NET_CONN_ADDR_LEN_MAX);
-
-        Mem_Clr((void     *)&addr_remote,
-                (CPU_SIZE_T) NET_CONN_ADDR_LEN_MAX);
-
-        if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
-#ifdef  NET_IPv4_MODULE_EN
-                                                                /* Cfg local  addr as pkt dest addr.                    */
-            NET_UTIL_VAL_COPY_SET_NET_16(&addr_local [NET_CONN_ADDR_IP_IX_PORT], &p_buf_hdr->TransportPortDest);
-            NET_UTIL_VAL_COPY_SET_NET_32(&addr_local [NET_CONN_ADDR_IP_V4_IX_ADDR], &p_buf_hdr->IP_AddrDest);
-                                                                /* Cfg remote addr as pkt src  addr.                    */
-            NET_UTIL_VAL_COPY_SET_NET_16(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], &p_buf_hdr->TransportPortSrc);
-            NET_UTIL_VAL_COPY_SET_NET_32(&addr_remote[NET_CONN_ADDR_IP_V4_IX_ADDR], &p_buf_hdr->IP_AddrSrc);
-#endif
-        } else {
-#ifdef  NET_IPv6_MODULE_EN
-                                                                /* Cfg local  addr as pkt dest addr.                    */
-            NET_UTIL_VAL_COPY_SET_NET_16(&addr_local [NET_CONN_ADDR_IP_IX_PORT], &p_buf_hdr->TransportPortDest);
-            Mem_Copy(&addr_local [NET_CONN_ADDR_IP_V6_IX_ADDR], &p_buf_hdr->IPv6_AddrDest, NET_IPv6_ADDR_SIZE);
-                                                                /* Cfg remote addr as pkt src  addr.                    */
-            NET_UTIL_VAL_COPY_SET_NET_16(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], &p_buf_hdr->TransportPortSrc);
-            Mem_Copy(&addr_remote [NET_CONN_ADDR_IP_V6_IX_ADDR], &p_buf_hdr->IPv6_AddrSrc, NET_IPv6_ADDR_SIZE);
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN                             /* ------------- CACHE TCP CONN HALF-CONN ------------- */
+    syn_cache = (p_buf_hdr->ConnType != NET_CONN_TYPE_CONN_FULL) ? DEF_YES : DEF_NO;
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    if (fast_open == DEF_YES) {                                 /* Bypass SYN cache for TFO conn (see Note #10b).       */
+        syn_cache = DEF_NO;
+    }
 #endif
-        }
-
-#else                                                           /* See Notes #4 & #6d.                                  */
-        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_YES, NET_TCP_CONN_CLOSE_ALL);
-       *p_err = NET_CONN_ERR_INVALID_FAMILY;
+    if (syn_cache == DEF_YES) {                                 /* If pkt demux'd to half-conn, ...                     */
+        NetTCP_SynCacheRxSync(p_conn, p_buf_hdr, p_err);        /* ... cache conn req (see Note #9a).                   */
         return;
+    }
 #endif
 
-        if_nbr = p_buf_hdr->IF_Nbr;
-        NetConn_AddrLocalSet(conn_id_clone,
-                             if_nbr,
-                            &addr_local[0],
-                             NET_CONN_ADDR_LEN_MAX,
-                             DEF_NO,
-                            &err);
-        if ( err != NET_CONN_ERR_NONE) {                        /* See Note #6c.                                        */
-            NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
-           *p_err  = NET_TCP_ERR_CONN_FAIL;
-            return;
-        }
-
-        NetConn_AddrRemoteSet(conn_id_clone,
-                             &addr_remote[0],
-                              NET_CONN_ADDR_LEN_MAX,
-                              DEF_NO,
-                             &err);
-        if ( err != NET_CONN_ERR_NONE) {                        /* See Note #6c.                                        */
-            NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
-           *p_err  = NET_TCP_ERR_CONN_FAIL;
-            return;
-        }
 
 
-        NetConn_ListAdd(conn_id_clone, &err);                   /* Add conn into conn list.                             */
-        if ( err != NET_CONN_ERR_NONE) {                        /* See Note #6c.                                        */
-            NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
-           *p_err  = NET_TCP_ERR_CONN_FAIL;
+                                                                /* ----------------- PREPARE TCP CONN ----------------- */
+    if (p_buf_hdr->ConnType != NET_CONN_TYPE_CONN_FULL) {       /* If pkt demux'd to half-conn, clone new conn          */
+                                                                /* .. from LISTEN    half-conn (see Note #5a).          */
+        p_conn_tx_sync = NetTCP_RxPktConnHandlerListenClone(p_conn, p_buf_hdr, &conn_id_clone_app, p_err);
+        if (p_conn_tx_sync == DEF_NULL) {
             return;
         }
-
-
-                                                                /* Copy half-conn state to full conn.                   */
-        NetTCP_ConnCopy(p_conn_clone, p_conn);
-
-
-#ifndef  NET_TCP_CFG_OLD_WINDOW_MGMT_EN
-        NetTCP_RxConnWinSizeHandler(p_conn_clone, DEF_NULL, 0, NET_TCP_CONN_RX_WIN_ZERO);
-#endif
-        p_conn_tx_sync = p_conn_clone;
+        conn_id_clone = p_conn_tx_sync->ID_Conn;
 
 
     } else {                                                    /* Else conn to listen TCP conn (see Note #5b).         */
@@ -9570,12 +11983,25 @@ static  void  NetTCP_RxPktConnHandlerListen (NET_TCP_CONN  *p_conn,
                                      ?  p_buf_hdr->TCP_MaxSegSize
                                      :  mss_dflt_tx;
 
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN                             /* Cfg win scaling as offered by remote host.           */
+    NetTCP_RxConnWinScaleCfg(p_conn_tx_sync, p_buf_hdr);
+#endif
+#ifdef  NET_TCP_ECN_MODULE_EN                                   /* Cfg ECN         as req'd   by remote host.           */
+    NetTCP_RxConnECN_Cfg(p_conn_tx_sync, p_buf_hdr);
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN                             /* Tx TFO cookie, if NO valid cookie rx'd ...           */
+                                                                /* ... (see Note #10c).                                 */
+    p_conn_tx_sync->TxFastOpenCookieReqd = ((p_conn_tx_sync->FastOpenEn        == DEF_ENABLED) &&
+                                            (p_buf_hdr->TCP_FastOpenCookieLen != NET_TCP_FAST_OPEN_COOKIE_LEN_NONE) &&
+                                            (fast_open                        == DEF_NO)) ? DEF_YES : DEF_NO;
+#endif
+
     state                     = p_conn_tx_sync->ConnState;
     p_conn_tx_sync->ConnState = NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE;
 
 
                                                                 /* ----------------- TX TCP CONN SYNC ----------------- */
-    NetTCP_TxConnSync(p_conn_tx_sync, p_buf_hdr, state, p_err);
+    NetTCP_TxConnSync(p_conn_tx_sync, p_buf_hdr, state, DEF_NULL, 0u, p_err);
     if (*p_err != NET_TCP_ERR_NONE) {                           /* See Note #6d.                                        */
          NetTCP_ConnClose(p_conn_tx_sync, p_buf_hdr, p_conn_tx_sync->ConnCloseAppFlag, NET_TCP_CONN_CLOSE_ALL);
          return;
@@ -9591,6 +12017,860 @@ static  void  NetTCP_RxPktConnHandlerListen (NET_TCP_CONN  *p_conn,
 }
 
 
+/*
+*********************************************************************************************************
+*                                NetTCP_RxPktConnHandlerListenClone()
+*
+* Description : (1) Clone new TCP connection from TCP listen half-connection :
+*
+*                   (a) Get  connections
+*                   (b) Set  connection  identification handles
+*                   (c) Set  connection  addresses
+*                   (d) Add  connection  into connection list
+*                   (e) Copy connection  from half-connection
+*
+*
+* Argument(s) : p_conn          Pointer to TCP listen half-connection.
+*               ------          Argument validated in NetTCP_RxPktConnHandler().
+*
+*               p_buf_hdr       Pointer to network buffer header that received TCP packet.
+*               ---------       Argument validated in NetTCP_Rx().
+*
+*               p_conn_id_app   Pointer to variable that will receive the listen half-connection's application
+*               -------------       connection handle identifier (see Note #2).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_TCP_ERR_NONE                TCP connection successfully cloned.
+*                                   NET_TCP_ERR_NONE_AVAIL          NO available TCP/network connections.
+*                                   NET_TCP_ERR_CONN_FAIL           TCP connection operation(s) failed.
+*                                   NET_TCP_ERR_INVALID_CONN_ID     Invalid application connection id.
+*                                   NET_CONN_ERR_INVALID_FAMILY     Invalid network connection family.
+*
+* Return(s)   : Pointer to cloned TCP connection, if NO error(s).
+*
+*               Pointer to NULL,                  otherwise.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerListen(),
+*               NetTCP_SynCacheRxAck().
+*
+* Note(s)     : (2) See 'NetTCP_RxPktConnHandlerListen()  Note #5a'.
+*
+*               (3) See 'NetTCP_RxPktConnHandlerListen()  Note #4'.
+*
+*               (4) On ANY TCP connection clone error(s), network resources MUST be appropriately freed
+*                   (see 'NetTCP_RxPktConnHandlerListen()  Note #6').
+*********************************************************************************************************
+*/
+
+static  NET_TCP_CONN  *NetTCP_RxPktConnHandlerListenClone (NET_TCP_CONN  *p_conn,
+                                                           NET_BUF_HDR   *p_buf_hdr,
+                                                           NET_CONN_ID   *p_conn_id_app,
+                                                           NET_ERR       *p_err)
+{
+#ifdef  NET_IP_MODULE_EN
+    CPU_INT08U             addr_local[NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U             addr_remote[NET_CONN_ADDR_LEN_MAX];
+    NET_IF_NBR             if_nbr            = NET_IF_NBR_NONE;
+#endif
+    NET_CONN_FAMILY        conn_family       = NET_CONN_FAMILY_NONE;
+    NET_CONN_PROTOCOL_IX   conn_protocol_ix  = NET_CONN_PROTOCOL_IX_NONE;
+    NET_CONN_ID            conn_id           = NET_CONN_ID_NONE;
+    NET_CONN_ID            conn_id_clone     = NET_CONN_ID_NONE;
+    NET_CONN_ID            conn_id_clone_app = NET_CONN_ID_NONE;
+    NET_TCP_CONN_ID        conn_id_clone_tcp = NET_CONN_ID_NONE;
+    NET_TCP_CONN          *p_conn_clone      = DEF_NULL;
+    NET_ERR                err               = NET_ERR_NONE;
+
+
+                                                                /* -------------------- GET CONNS --------------------- */
+    conn_id_clone_tcp =  NetTCP_ConnGet(p_conn->FnctAppPostRx,
+                                        p_conn->FnctAppPostTx,
+                                       &err);
+    if ( err != NET_TCP_ERR_NONE) {                             /* See Note #4.                                         */
+       *p_err  = NET_TCP_ERR_NONE_AVAIL;
+        return (DEF_NULL);
+    }
+    p_conn_clone = &NetTCP_ConnTbl[conn_id_clone_tcp];
+
+
+#ifdef  NET_IP_MODULE_EN
+    if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
+#ifdef  NET_IPv4_MODULE_EN
+        conn_family      =  NET_CONN_FAMILY_IP_V4_SOCK;
+        conn_protocol_ix =  NET_CONN_PROTOCOL_IX_IP_V4_TCP;
+#endif
+    } else {
+#ifdef  NET_IPv6_MODULE_EN
+        conn_family      =  NET_CONN_FAMILY_IP_V6_SOCK;
+        conn_protocol_ix =  NET_CONN_PROTOCOL_IX_IP_V6_TCP;
+#endif
+    }
+#else                                                           /* See Notes #3 & #4.                                   */
+    NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_YES, NET_TCP_CONN_CLOSE_ALL);
+   *p_err = NET_CONN_ERR_INVALID_FAMILY;
+    return (DEF_NULL);
+#endif
+
+    conn_id_clone = NetConn_Get(conn_family, conn_protocol_ix, &err);
+    if ( err != NET_CONN_ERR_NONE) {                            /* See Note #4.                                         */
+        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
+       *p_err  = NET_TCP_ERR_NONE_AVAIL;
+        return (DEF_NULL);
+    }
+
+
+                                                                /* SET CONN IDs                                         */
+    p_conn_clone->ID_Conn = conn_id_clone;
+    NetConn_ID_TransportSet((NET_CONN_ID) conn_id_clone,
+                            (NET_CONN_ID) conn_id_clone_tcp,
+                            (NET_ERR   *)&err);
+    if ( err != NET_CONN_ERR_NONE) {                            /* See Note #4.                                         */
+        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
+       *p_err  = NET_TCP_ERR_CONN_FAIL;
+        return (DEF_NULL);
+    }
+
+
+    conn_id           = p_conn->ID_Conn;
+    conn_id_clone_app = NetConn_ID_AppGet((NET_CONN_ID) conn_id, /* Get half-conn's app conn id & ...                   */
+                                          (NET_ERR   *)&err);
+    if ( err != NET_CONN_ERR_NONE) {                            /* See Note #4.                                         */
+        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
+       *p_err  = NET_TCP_ERR_CONN_FAIL;
+        return (DEF_NULL);
+    }
+    if (conn_id_clone_app == NET_CONN_ID_NONE) {
+       *p_err  = NET_TCP_ERR_INVALID_CONN_ID;
+        return (DEF_NULL);
+    }
+
+    NetConn_ID_AppCloneSet((NET_CONN_ID) conn_id_clone,         /* ... set as cloned conn's      ...                    */
+                           (NET_CONN_ID) conn_id_clone_app,     /* ... app conn clone id (see Note #2).                 */
+                           (NET_ERR   *)&err);
+    if ( err != NET_CONN_ERR_NONE) {                            /* See Note #4.                                         */
+        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
+       *p_err  = NET_TCP_ERR_CONN_FAIL;
+        return (DEF_NULL);
+    }
+
+
+                                                                /* ------------------ CFG CONN ADDRS ------------------ */
+#ifdef  NET_IP_MODULE_EN
+    NetTCP_RxPktConnAddrsGet(p_buf_hdr, &addr_local[0], &addr_remote[0]);
+
+    if_nbr = p_buf_hdr->IF_Nbr;
+    NetConn_AddrLocalSet(conn_id_clone,
+                         if_nbr,
+                        &addr_local[0],
+                         NET_CONN_ADDR_LEN_MAX,
+                         DEF_NO,
+                        &err);
+    if ( err != NET_CONN_ERR_NONE) {                            /* See Note #4.                                         */
+        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
+       *p_err  = NET_TCP_ERR_CONN_FAIL;
+        return (DEF_NULL);
+    }
+
+    NetConn_AddrRemoteSet(conn_id_clone,
+                         &addr_remote[0],
+                          NET_CONN_ADDR_LEN_MAX,
+                          DEF_NO,
+                         &err);
+    if ( err != NET_CONN_ERR_NONE) {                            /* See Note #4.                                         */
+        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
+       *p_err  = NET_TCP_ERR_CONN_FAIL;
+        return (DEF_NULL);
+    }
+#endif
+
+
+    NetConn_ListAdd(conn_id_clone, &err);                       /* Add conn into conn list.                             */
+    if ( err != NET_CONN_ERR_NONE) {                            /* See Note #4.                                         */
+        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, DEF_NO, NET_TCP_CONN_CLOSE_ALL);
+       *p_err  = NET_TCP_ERR_CONN_FAIL;
+        return (DEF_NULL);
+    }
+
+
+                                                                /* Copy half-conn state to full conn.                   */
+    NetTCP_ConnCopy(p_conn_clone, p_conn);
+
+
+#ifndef  NET_TCP_CFG_OLD_WINDOW_MGMT_EN
+    NetTCP_RxConnWinSizeHandler(p_conn_clone, DEF_NULL, 0, NET_TCP_CONN_RX_WIN_ZERO);
+#endif
+
+
+   *p_conn_id_app = conn_id_clone_app;
+   *p_err         = NET_TCP_ERR_NONE;
+
+    return (p_conn_clone);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_RxPktConnAddrsGet()
+*
+* Description : Get TCP connection addresses from a received TCP packet.
+*
+* Argument(s) : p_buf_hdr       Pointer to network buffer header that received TCP packet.
+*               ---------       Argument validated in NetTCP_Rx().
+*
+*               p_addr_local    Pointer to buffer that will receive the connection local  address, configured
+*               ------------        as the received packet's destination address & port.
+*
+*               p_addr_remote   Pointer to buffer that will receive the connection remote address, configured
+*               -------------       as the received packet's source      address & port.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerListenClone(),
+*               NetTCP_SynCacheRxSync(),
+*               NetTCP_SynCacheRxAck().
+*
+* Note(s)     : (1) Address buffers MUST be at least NET_CONN_ADDR_LEN_MAX octets.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_IP_MODULE_EN
+static  void  NetTCP_RxPktConnAddrsGet (NET_BUF_HDR  *p_buf_hdr,
+                                        CPU_INT08U   *p_addr_local,
+                                        CPU_INT08U   *p_addr_remote)
+{
+    Mem_Clr((void     *)p_addr_local,
+            (CPU_SIZE_T)NET_CONN_ADDR_LEN_MAX);
+
+    Mem_Clr((void     *)p_addr_remote,
+            (CPU_SIZE_T)NET_CONN_ADDR_LEN_MAX);
+
+    if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
+#ifdef  NET_IPv4_MODULE_EN
+                                                                /* Cfg local  addr as pkt dest addr.                    */
+        NET_UTIL_VAL_COPY_SET_NET_16(&p_addr_local [NET_CONN_ADDR_IP_IX_PORT], &p_buf_hdr->TransportPortDest);
+        NET_UTIL_VAL_COPY_SET_NET_32(&p_addr_local [NET_CONN_ADDR_IP_V4_IX_ADDR], &p_buf_hdr->IP_AddrDest);
+                                                                /* Cfg remote addr as pkt src  addr.                    */
+        NET_UTIL_VAL_COPY_SET_NET_16(&p_addr_remote[NET_CONN_ADDR_IP_IX_PORT], &p_buf_hdr->TransportPortSrc);
+        NET_UTIL_VAL_COPY_SET_NET_32(&p_addr_remote[NET_CONN_ADDR_IP_V4_IX_ADDR], &p_buf_hdr->IP_AddrSrc);
+#endif
+    } else {
+#ifdef  NET_IPv6_MODULE_EN
+                                                                /* Cfg local  addr as pkt dest addr.                    */
+        NET_UTIL_VAL_COPY_SET_NET_16(&p_addr_local [NET_CONN_ADDR_IP_IX_PORT], &p_buf_hdr->TransportPortDest);
+        Mem_Copy(&p_addr_local [NET_CONN_ADDR_IP_V6_IX_ADDR], &p_buf_hdr->IPv6_AddrDest, NET_IPv6_ADDR_SIZE);
+                                                                /* Cfg remote addr as pkt src  addr.                    */
+        NET_UTIL_VAL_COPY_SET_NET_16(&p_addr_remote[NET_CONN_ADDR_IP_IX_PORT], &p_buf_hdr->TransportPortSrc);
+        Mem_Copy(&p_addr_remote[NET_CONN_ADDR_IP_V6_IX_ADDR], &p_buf_hdr->IPv6_AddrSrc, NET_IPv6_ADDR_SIZE);
+#endif
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_SynCacheRxSync()
+*
+* Description : (1) Cache TCP connection request received by a LISTEN-state half-connection :
+*
+*                   (a) Get  SYN cache entry                                            See Note #2
+*                   (b) Get  SYN cookie initial send sequence number
+*                   (c) Transmit TCP connection synchronization                         See Note #3
+*
+*
+* Argument(s) : p_conn       Pointer to TCP listen half-connection.
+*               ------       Argument validated in NetTCP_RxPktConnHandler().
+*
+*               p_buf_hdr    Pointer to network buffer header that received TCP packet.
+*               ---------    Argument validated in NetTCP_Rx().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_CONN_DATA_NONE          Received packet successfully handled; but NO
+*                                                                       data queued to receive queue(s).
+*
+*                                                                   -- RETURNED BY NetTCP_TxSynCacheSync() : --
+*                               NET_TCP_ERR_NONE_AVAIL              Resources NOT available.
+*                               NET_TCP_ERR_CONN_FAIL               TCP connection operation(s) failed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerListen().
+*
+* Note(s)     : (2) (a) A re-transmitted connection request re-uses its SYN cache entry & initial send
+*                       sequence number.
+*
+*                   (b) If NO SYN cache entry is available, the connection request is handled ONLY by its
+*                       SYN cookie (see 'net_tcp.h  TCP SYN CACHE DEFINES  Note #2').
+*
+*               (3) Any data received in the synchronization segment is NOT acknowledged & MUST be
+*                   re-transmitted by the remote host once the connection is established.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  void  NetTCP_SynCacheRxSync (NET_TCP_CONN  *p_conn,
+                                     NET_BUF_HDR   *p_buf_hdr,
+                                     NET_ERR       *p_err)
+{
+    CPU_INT08U                addr_local [NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U                addr_remote[NET_CONN_ADDR_LEN_MAX];
+    NET_TCP_SYN_CACHE_ENTRY  *p_entry;
+    NET_TCP_SEQ_NBR           seq_nbr_sync;
+    NET_TCP_SEQ_NBR           seq_nbr;
+    NET_TCP_SEG_SIZE          max_seg_size;
+    CPU_BOOLEAN               win_scale_en;
+    CPU_BOOLEAN               ecn_en;
+    NET_TS_MS                 ts_ms;
+
+
+    NetTCP_RxPktConnAddrsGet(p_buf_hdr, &addr_local[0], &addr_remote[0]);
+
+    ts_ms        = NetUtil_TS_Get_ms();
+    seq_nbr_sync = p_buf_hdr->TCP_SeqNbr;
+                                                                /* Get remote max seg size (see ...                     */
+    max_seg_size = p_buf_hdr->TCP_MaxSegSize;                   /* ... 'NetTCP_RxPktConnHandlerListen()  Note #7').     */
+    if (max_seg_size == NET_TCP_MAX_SEG_SIZE_NONE) {
+#ifdef  NET_IPv6_MODULE_EN
+        if (DEF_BIT_IS_SET(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME) == DEF_YES) {
+            max_seg_size = NET_TCP_MAX_SEG_SIZE_DFLT_V6;
+        }
+#endif
+#ifdef  NET_IPv4_MODULE_EN
+        if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME) == DEF_YES) {
+            max_seg_size = NET_TCP_MAX_SEG_SIZE_DFLT_V4;
+        }
+#endif
+    }
+
+
+                                                                /* --------------- GET SYN CACHE ENTRY ---------------- */
+    p_entry = NetTCP_SynCacheSrch(p_conn, &addr_local[0], &addr_remote[0], ts_ms);
+    if ((p_entry               != DEF_NULL) &&                  /* If conn req re-tx'd, ...                             */
+        (p_entry->RxSeqNbrSync == seq_nbr_sync)) {
+        seq_nbr = p_entry->TxSeqNbrSync;                        /* ... re-use sync seq nbr (see Note #2a).              */
+
+    } else {
+        if (p_entry == DEF_NULL) {
+            p_entry  = NetTCP_SynCacheGet(ts_ms);               /* May be NULL (see Note #2b).                          */
+        }
+        seq_nbr = NetTCP_SynCookieGet(&addr_local[0],
+                                      &addr_remote[0],
+                                       seq_nbr_sync,
+                                       max_seg_size,
+                                       ts_ms);
+
+        if (p_entry != DEF_NULL) {                              /* Cfg SYN cache entry.                                 */
+            p_entry->ConnID_Listen    = p_conn->ID;
+            p_entry->IF_Nbr           = p_buf_hdr->IF_Nbr;
+            Mem_Copy(&p_entry->AddrLocal[0],  &addr_local[0],  NET_CONN_ADDR_LEN_MAX);
+            Mem_Copy(&p_entry->AddrRemote[0], &addr_remote[0], NET_CONN_ADDR_LEN_MAX);
+            p_entry->RxSeqNbrSync     = seq_nbr_sync;
+            p_entry->TxSeqNbrSync     = seq_nbr;
+            p_entry->MaxSegSizeRemote = max_seg_size;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+            p_entry->TxWinScale       = p_buf_hdr->TCP_WinScale;
+#endif
+#ifdef  NET_TCP_ECN_MODULE_EN                                   /* See 'net_tcp.h  TCP ECN DEFINES  Note #1b'.          */
+            p_entry->ECN_En           = DEF_BIT_IS_SET(p_buf_hdr->TCP_HdrLen_Flags, (NET_TCP_HDR_FLAG_ECE |
+                                                                                      NET_TCP_HDR_FLAG_CWR));
+#endif
+            p_entry->TS_ms            = ts_ms;
+        }
+    }
+
+    win_scale_en = DEF_NO;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN                             /* Offer win scale ONLY if cached ...                   */
+    if ((p_entry             != DEF_NULL) &&                    /* ... (see 'net_tcp.h  TCP SYN CACHE DEFINES  Note #2c'*/
+        (p_entry->TxWinScale != NET_TCP_WIN_SCALE_NONE)) {
+         win_scale_en = DEF_YES;
+    }
+#endif
+
+    ecn_en = DEF_NO;
+#ifdef  NET_TCP_ECN_MODULE_EN                                   /* Accept ECN ONLY if cached ...                        */
+    if (p_entry != DEF_NULL) {                                  /* ... (see 'net_tcp.h  TCP ECN DEFINES  Note #1c').    */
+        ecn_en = p_entry->ECN_En;
+    }
+#endif
+
+
+                                                                /* ----------------- TX TCP CONN SYNC ----------------- */
+    NetTCP_TxSynCacheSync(p_conn, p_buf_hdr, seq_nbr, win_scale_en, ecn_en, p_err);
+    if (*p_err != NET_TCP_ERR_NONE) {
+         return;
+    }
+
+
+   *p_err = NET_TCP_ERR_CONN_DATA_NONE;                         /* See Note #3.                                         */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_SynCacheRxAck()
+*
+* Description : (1) Complete TCP connection request cached by a LISTEN-state half-connection :
+*
+*                   (a) Validate received acknowledgement against :
+*                       (1) SYN cache entry                                             See Note #2a
+*                       (2) SYN cookie                                                  See Note #2b
+*
+*                   (b) Check if TCP connection listen queue is available
+*                   (c) Clone & configure new TCP connection in SYN-RECEIVED state      See Note #3
+*                   (d) Handle received TCP segment in SYN-RECEIVED state
+*
+*
+* Argument(s) : p_conn       Pointer to TCP listen half-connection.
+*               ------       Argument validated in NetTCP_RxPktConnHandler().
+*
+*               p_buf        Pointer to network buffer that received TCP packet.
+*               -----        Argument checked   in NetTCP_Rx().
+*
+*               p_buf_hdr    Pointer to network buffer header that received TCP packet.
+*               ---------    Argument validated in NetTCP_Rx().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_CONN_LISTEN_Q_MAX       TCP listen queue NOT available.
+*                               NET_TCP_ERR_CONN_FAIL               TCP connection operation(s) failed.
+*
+*                                                                   - RETURNED BY NetTCP_RxPktConnHandlerListenClone() : -
+*                                                                   -- RETURNED BY NetTCP_RxPktConnHandlerSyncRxd() : ----
+*                                                                   -------- RETURNED BY NetSock_ConnChildAdd() : --------
+*
+* Return(s)   : DEF_YES, if received TCP packet completes a cached TCP connection request.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerListen().
+*
+* Note(s)     : (2) (a) The received acknowledgement completes a SYN cache entry if it acknowledges the
+*                       entry's initial send sequence number.
+*
+*                   (b) Otherwise, the received acknowledgement MUST acknowledge a valid SYN cookie (see
+*                       'net_tcp.h  TCP SYN CACHE DEFINES  Note #2').
+*
+*               (3) The cloned TCP connection is configured as if the synchronization segment had been
+*                   transmitted by the TCP connection itself (see 'NetTCP_TxConnSync()  Note #5a'); except
+*                   that the synchronization segment is NOT queued to the re-transmit queue.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  CPU_BOOLEAN  NetTCP_SynCacheRxAck (NET_TCP_CONN  *p_conn,
+                                           NET_BUF       *p_buf,
+                                           NET_BUF_HDR   *p_buf_hdr,
+                                           NET_ERR       *p_err)
+{
+    CPU_INT08U                addr_local [NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U                addr_remote[NET_CONN_ADDR_LEN_MAX];
+    NET_TCP_SYN_CACHE_ENTRY  *p_entry;
+    NET_TCP_CONN             *p_conn_clone;
+    NET_CONN_ID               conn_id_clone_app;
+    NET_TCP_SEQ_NBR           seq_nbr_sync;
+    NET_TCP_SEQ_NBR           seq_nbr;
+    NET_TCP_SEG_SIZE          max_seg_size;
+    NET_PROTOCOL_TYPE         protocol;
+    CPU_INT16U                payload_max;
+    CPU_BOOLEAN               q_avail;
+    NET_TS_MS                 ts_ms;
+    NET_ERR                   err;
+
+
+    NetTCP_RxPktConnAddrsGet(p_buf_hdr, &addr_local[0], &addr_remote[0]);
+
+    ts_ms        =  NetUtil_TS_Get_ms();
+    seq_nbr_sync = (p_buf_hdr->TCP_SeqNbr - NET_TCP_SEG_LEN_SYNC);
+    seq_nbr      = (p_buf_hdr->TCP_AckNbr - NET_TCP_SEG_LEN_SYNC);
+
+
+                                                                /* ------------- VALIDATE CACHED CONN REQ ------------- */
+    p_entry = NetTCP_SynCacheSrch(p_conn, &addr_local[0], &addr_remote[0], ts_ms);
+    if ((p_entry               != DEF_NULL)     &&              /* If SYN cache entry ack'd, ...                        */
+        (p_entry->RxSeqNbrSync == seq_nbr_sync) &&
+        (p_entry->TxSeqNbrSync == seq_nbr)) {
+        max_seg_size = p_entry->MaxSegSizeRemote;               /* ... get cached conn params (see Note #2a).           */
+
+    } else {                                                    /* Else chk SYN cookie (see Note #2b).                  */
+        p_entry      = DEF_NULL;
+        max_seg_size = NetTCP_SynCookieChk(&addr_local[0],
+                                           &addr_remote[0],
+                                            seq_nbr_sync,
+                                            seq_nbr,
+                                            ts_ms);
+        if (max_seg_size == NET_TCP_MAX_SEG_SIZE_NONE) {        /* If NO valid SYN cookie ack'd, ...                    */
+            return (DEF_NO);                                    /* ... handle as LISTEN-state ack.                      */
+        }
+    }
+
+
+                                                                /* -------------- CHK TCP CONN LISTEN Q --------------- */
+    q_avail = NetTCP_RxPktConnHandlerListenQ_IsAvail(p_conn, p_err);
+    if (*p_err != NET_TCP_ERR_NONE) {
+         return (DEF_YES);
+    }
+    if (q_avail != DEF_YES) {                                   /* If TCP listen Q NOT avail, ignore TCP pkt.           */
+       *p_err = NET_TCP_ERR_CONN_LISTEN_Q_MAX;
+        return (DEF_YES);
+    }
+
+
+                                                                /* ----------------- PREPARE TCP CONN ----------------- */
+    p_conn_clone = NetTCP_RxPktConnHandlerListenClone(p_conn, p_buf_hdr, &conn_id_clone_app, p_err);
+    if (p_conn_clone == DEF_NULL) {
+        return (DEF_YES);
+    }
+
+    if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
+        protocol = NET_PROTOCOL_TYPE_TCP_V4;
+    } else {
+        protocol = NET_PROTOCOL_TYPE_TCP_V6;
+    }
+
+    payload_max = NetIF_GetPayloadTxMax(p_buf_hdr->IF_Nbr, protocol, &err);
+    if (err != NET_IF_ERR_NONE) {
+        NetTCP_ConnClose(p_conn_clone, p_buf_hdr, p_conn_clone->ConnCloseAppFlag, NET_TCP_CONN_CLOSE_ALL);
+       *p_err = NET_TCP_ERR_CONN_FAIL;
+        return (DEF_YES);
+    }
+
+                                                                /* Update TCP conn rx seq nbrs (see Note #3).           */
+    p_conn_clone->RxSeqNbrSync          = (NET_TCP_SEQ_NBR) seq_nbr_sync;
+    p_conn_clone->RxSeqNbrNext          = (NET_TCP_SEQ_NBR)(seq_nbr_sync + NET_TCP_SEG_LEN_SYNC);
+    p_conn_clone->RxQ_State             =  NET_TCP_RX_Q_STATE_SYNC;
+                                                                /* Update TCP conn tx seq nbrs.                         */
+    p_conn_clone->TxSeqNbrSync          = (NET_TCP_SEQ_NBR) seq_nbr;
+    p_conn_clone->TxSeqNbrNext          = (NET_TCP_SEQ_NBR)(seq_nbr + NET_TCP_SEG_LEN_SYNC);
+    p_conn_clone->TxSeqNbrNextQ         = (NET_TCP_SEQ_NBR) p_conn_clone->TxSeqNbrNext;
+    p_conn_clone->TxSeqNbrUnAckdPrev    = (NET_TCP_SEQ_NBR) p_conn_clone->TxSeqNbrUnAckd;
+    p_conn_clone->TxSeqNbrUnAckd        = (NET_TCP_SEQ_NBR) p_conn_clone->TxSeqNbrSync;
+    p_conn_clone->TxSeqNbrUnReTxd       = (NET_TCP_SEQ_NBR) p_conn_clone->TxSeqNbrUnAckd;
+
+    p_conn_clone->MaxSegSizeLocalActual =  payload_max;
+    p_conn_clone->MaxSegSizeRemote      =  max_seg_size;
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN                             /* Cfg win scaling as cached.                           */
+    if ((p_entry             != DEF_NULL) &&
+        (p_entry->TxWinScale != NET_TCP_WIN_SCALE_NONE)) {
+        p_conn_clone->WinScaleEn   =  DEF_YES;
+        p_conn_clone->RxWinScale   =  NetTCP_ConnWinScaleCalc(p_conn_clone->RxWinSizeCfgd);
+        p_conn_clone->TxWinScale   =  p_entry->TxWinScale;
+        p_buf_hdr->TCP_WinSize   <<=  p_conn_clone->TxWinScale; /* Scale rx'd win size.                                 */
+    } else {
+        p_conn_clone->WinScaleEn   =  DEF_NO;
+        p_conn_clone->RxWinScale   =  NET_TCP_WIN_SCALE_MIN;
+        p_conn_clone->TxWinScale   =  NET_TCP_WIN_SCALE_MIN;
+    }
+#endif
+#ifdef  NET_TCP_ECN_MODULE_EN                                   /* Cfg ECN as cached.                                   */
+    p_conn_clone->ECN_En = (p_entry != DEF_NULL) ? p_entry->ECN_En : DEF_NO;
+#endif
+
+    p_conn_clone->ConnState = NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE;
+
+    if (p_entry != DEF_NULL) {                                  /* Free SYN cache entry.                                */
+        p_entry->ConnID_Listen = NET_TCP_CONN_ID_NONE;
+    }
+
+    NetSock_ConnChildAdd(conn_id_clone_app, p_conn_clone->ID_Conn, p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+         NetTCP_ConnClose(p_conn_clone, p_buf_hdr, p_conn_clone->ConnCloseAppFlag, NET_TCP_CONN_CLOSE_ALL);
+         return (DEF_YES);
+    }
+
+
+                                                                /* ----------------- HANDLE RX'D SEG ------------------ */
+    NetTCP_RxPktConnHandlerSyncRxd(p_conn_clone, p_buf, p_buf_hdr, p_err);
+
+    return (DEF_YES);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetTCP_SynCacheSrch()
+*
+* Description : Search SYN cache for a TCP listen half-connection's cached connection request.
+*
+* Argument(s) : p_conn          Pointer to TCP listen half-connection.
+*               ------          Argument validated in NetTCP_RxPktConnHandler().
+*
+*               p_addr_local    Pointer to connection local  address.
+*
+*               p_addr_remote   Pointer to connection remote address.
+*
+*               ts_ms           Current time stamp (in milliseconds).
+*
+* Return(s)   : Pointer to SYN cache entry, if found.
+*
+*               Pointer to NULL,            otherwise.
+*
+* Caller(s)   : NetTCP_SynCacheRxSync(),
+*               NetTCP_SynCacheRxAck().
+*
+* Note(s)     : (1) Expired SYN cache entries are freed while searching (see 'net_tcp.h  TCP SYN CACHE
+*                   DEFINES  Note #3').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  NET_TCP_SYN_CACHE_ENTRY  *NetTCP_SynCacheSrch (NET_TCP_CONN  *p_conn,
+                                                       CPU_INT08U    *p_addr_local,
+                                                       CPU_INT08U    *p_addr_remote,
+                                                       NET_TS_MS      ts_ms)
+{
+    NET_TCP_SYN_CACHE_ENTRY  *p_entry;
+    CPU_BOOLEAN               found;
+    CPU_INT16U                i;
+
+
+    p_entry = &NetTCP_SynCacheTbl[0];
+    for (i = 0u; i < NET_TCP_DFLT_SYN_CACHE_NBR_ENTRY; i++) {
+        if (p_entry->ConnID_Listen != NET_TCP_CONN_ID_NONE) {
+            if ((NET_TS_MS)(ts_ms - p_entry->TS_ms) >= NET_TCP_SYN_CACHE_TIMEOUT_MS) {
+                p_entry->ConnID_Listen = NET_TCP_CONN_ID_NONE;  /* Free expired entry (see Note #1).                    */
+
+            } else if (p_entry->ConnID_Listen == p_conn->ID) {
+                found = Mem_Cmp(&p_entry->AddrLocal[0], p_addr_local, NET_CONN_ADDR_LEN_MAX);
+                if (found == DEF_YES) {
+                    found = Mem_Cmp(&p_entry->AddrRemote[0], p_addr_remote, NET_CONN_ADDR_LEN_MAX);
+                }
+                if (found == DEF_YES) {
+                    return (p_entry);
+                }
+            } else {
+                                                                /* Empty Else Statement                                 */
+            }
+        }
+        p_entry++;
+    }
+
+    return (DEF_NULL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetTCP_SynCacheGet()
+*
+* Description : Get a free SYN cache entry.
+*
+* Argument(s) : ts_ms       Current time stamp (in milliseconds).
+*
+* Return(s)   : Pointer to free or expired SYN cache entry, if available.
+*
+*               Pointer to NULL,                            otherwise.
+*
+* Caller(s)   : NetTCP_SynCacheRxSync().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  NET_TCP_SYN_CACHE_ENTRY  *NetTCP_SynCacheGet (NET_TS_MS  ts_ms)
+{
+    NET_TCP_SYN_CACHE_ENTRY  *p_entry;
+    CPU_INT16U                i;
+
+
+    p_entry = &NetTCP_SynCacheTbl[0];
+    for (i = 0u; i < NET_TCP_DFLT_SYN_CACHE_NBR_ENTRY; i++) {
+        if ((p_entry->ConnID_Listen == NET_TCP_CONN_ID_NONE) ||
+            ((NET_TS_MS)(ts_ms - p_entry->TS_ms) >= NET_TCP_SYN_CACHE_TIMEOUT_MS)) {
+            return (p_entry);
+        }
+        p_entry++;
+    }
+
+    return (DEF_NULL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetTCP_SynCookieGet()
+*
+* Description : Get SYN cookie for a TCP connection request.
+*
+* Argument(s) : p_addr_local    Pointer to connection local  address.
+*
+*               p_addr_remote   Pointer to connection remote address.
+*
+*               seq_nbr_sync    Remote host's initial sequence number.
+*
+*               max_seg_size    Remote host's maximum segment size.
+*
+*               ts_ms           Current time stamp (in milliseconds).
+*
+* Return(s)   : SYN cookie initial send sequence number (see 'net_tcp.h  TCP SYN CACHE DEFINES  Note #2a').
+*
+* Caller(s)   : NetTCP_SynCacheRxSync().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  NET_TCP_SEQ_NBR  NetTCP_SynCookieGet (CPU_INT08U        *p_addr_local,
+                                              CPU_INT08U        *p_addr_remote,
+                                              NET_TCP_SEQ_NBR    seq_nbr_sync,
+                                              NET_TCP_SEG_SIZE   max_seg_size,
+                                              NET_TS_MS          ts_ms)
+{
+    CPU_INT32U       ts_ctr;
+    CPU_INT32U       hash;
+    CPU_INT08U       mss_ix;
+    CPU_INT08U       i;
+    NET_TCP_SEQ_NBR  cookie;
+
+                                                                /* Get largest tbl max seg size <= remote max seg size. */
+    mss_ix = 0u;
+    for (i = 1u; i < NET_TCP_SYN_COOKIE_MSS_NBR; i++) {
+        if (NetTCP_SynCookieMaxSegSizeTbl[i] > max_seg_size) {
+            break;
+        }
+        mss_ix = i;
+    }
+
+    ts_ctr = (CPU_INT32U)(ts_ms / NET_TCP_SYN_COOKIE_PERIOD_MS);
+    hash   =  NetTCP_SynCookieHashGet(p_addr_local, p_addr_remote, seq_nbr_sync, ts_ctr);
+
+    cookie = (NET_TCP_SEQ_NBR)(( hash                                   & NET_TCP_SYN_COOKIE_HASH_MASK) |
+                               ((ts_ctr & NET_TCP_SYN_COOKIE_TS_MASK)  << NET_TCP_SYN_COOKIE_TS_SHIFT)  |
+                               ( mss_ix                                 & NET_TCP_SYN_COOKIE_MSS_MASK));
+
+    return (cookie);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetTCP_SynCookieChk()
+*
+* Description : Validate SYN cookie acknowledged by a TCP connection request's final acknowledgement.
+*
+* Argument(s) : p_addr_local    Pointer to connection local  address.
+*
+*               p_addr_remote   Pointer to connection remote address.
+*
+*               seq_nbr_sync    Remote host's initial sequence number.
+*
+*               cookie          Acknowledged initial send sequence number.
+*
+*               ts_ms           Current time stamp (in milliseconds).
+*
+* Return(s)   : Remote host's maximum segment size encoded in SYN cookie, if SYN cookie valid.
+*
+*               NET_TCP_MAX_SEG_SIZE_NONE,                                otherwise.
+*
+* Caller(s)   : NetTCP_SynCacheRxAck().
+*
+* Note(s)     : (1) The SYN cookie's time counter is recovered from the current time counter for each of
+*                   the last NET_TCP_SYN_COOKIE_AGE_MAX periods (see 'net_tcp.h  TCP SYN CACHE DEFINES
+*                   Note #2b').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  NET_TCP_SEG_SIZE  NetTCP_SynCookieChk (CPU_INT08U        *p_addr_local,
+                                               CPU_INT08U        *p_addr_remote,
+                                               NET_TCP_SEQ_NBR    seq_nbr_sync,
+                                               NET_TCP_SEQ_NBR    cookie,
+                                               NET_TS_MS          ts_ms)
+{
+    CPU_INT32U  ts_ctr;
+    CPU_INT32U  ts_ctr_cookie;
+    CPU_INT32U  hash;
+    CPU_INT32U  age;
+
+
+    ts_ctr_cookie = ((cookie >> NET_TCP_SYN_COOKIE_TS_SHIFT) & NET_TCP_SYN_COOKIE_TS_MASK);
+    ts_ctr        =  (CPU_INT32U)(ts_ms / NET_TCP_SYN_COOKIE_PERIOD_MS);
+
+    for (age = 0u; age < NET_TCP_SYN_COOKIE_AGE_MAX; age++) {   /* Recover cookie's time ctr (see Note #1).             */
+        if (((ts_ctr - age) & NET_TCP_SYN_COOKIE_TS_MASK) == ts_ctr_cookie) {
+            hash = NetTCP_SynCookieHashGet(p_addr_local, p_addr_remote, seq_nbr_sync, (ts_ctr - age));
+            if ((hash & NET_TCP_SYN_COOKIE_HASH_MASK) == (cookie & NET_TCP_SYN_COOKIE_HASH_MASK)) {
+                return (NetTCP_SynCookieMaxSegSizeTbl[cookie & NET_TCP_SYN_COOKIE_MSS_MASK]);
+            }
+        }
+    }
+
+    return (NET_TCP_MAX_SEG_SIZE_NONE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_SynCookieHashGet()
+*
+* Description : Get SYN cookie hash of a TCP connection request.
+*
+* Argument(s) : p_addr_local    Pointer to connection local  address.
+*
+*               p_addr_remote   Pointer to connection remote address.
+*
+*               seq_nbr_sync    Remote host's initial sequence number.
+*
+*               ts_ctr          SYN cookie time counter.
+*
+* Return(s)   : Lower 4 octets of the MD5 digest of the connection request & secret key.
+*
+* Caller(s)   : NetTCP_SynCookieGet(),
+*               NetTCP_SynCookieChk().
+*
+* Note(s)     : (1) The secret key & MD5 context are shared with the initial sequence number generator
+*                   (see 'NetTCP_ConnFiveTupleSeqNbrGet()').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  CPU_INT32U  NetTCP_SynCookieHashGet (CPU_INT08U       *p_addr_local,
+                                             CPU_INT08U       *p_addr_remote,
+                                             NET_TCP_SEQ_NBR   seq_nbr_sync,
+                                             CPU_INT32U        ts_ctr)
+{
+    NET_TCP_SYN_COOKIE_TUPLE  cookie_tuple;
+    CPU_INT08U                hash_output[16u];
+    CPU_INT32U                hash;
+
+
+    Mem_Clr(&cookie_tuple, sizeof(cookie_tuple));
+
+    Mem_Copy(&cookie_tuple.AddrLocal[0],  p_addr_local,  NET_CONN_ADDR_LEN_MAX);
+    Mem_Copy(&cookie_tuple.AddrRemote[0], p_addr_remote, NET_CONN_ADDR_LEN_MAX);
+    cookie_tuple.RxSeqNbrSync = seq_nbr_sync;
+    cookie_tuple.TS_Ctr       = ts_ctr;
+    Mem_Copy(cookie_tuple.Secret,                               /* Load secret key (see Note #1).                       */
+            &NetTCP_ISN_SecretKey,
+             sizeof(NetTCP_ISN_SecretKey));
+
+    NetMD5_Init(&NetTCP_ISN_MD5_Handle);
+    NetMD5_Update(              &NetTCP_ISN_MD5_Handle,
+                  (CPU_INT08U *)&cookie_tuple,
+                                 sizeof(NET_TCP_SYN_COOKIE_TUPLE));
+
+    NetMD5_Final(hash_output, &NetTCP_ISN_MD5_Handle);
+
+    Mem_Copy(&hash, &hash_output[0], sizeof(hash));             /* Get lower 4 octets of the hash.                      */
+
+    Mem_Clr(&NetTCP_ISN_MD5_Handle, sizeof(NET_MD5_CONTEXT));
+    Mem_Clr(&cookie_tuple,          sizeof(cookie_tuple));
+
+    return (hash);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                  NetTCP_RxPktConnHandlerSyncRxd()
@@ -10281,6 +13561,10 @@ static  void  NetTCP_RxPktConnHandlerSyncRxd (NET_TCP_CONN  *p_conn,
 *               (5) Some  transitory errors were ignored &/or not returned from previous handler function(s).
 *                   These transitory errors are included for completeness & as an extra precaution in case
 *                   these transitory errors are returned by handler function(s).
+*
+*               (6) If TCP Fast Open is enabled, a cookie received from the remote host is cached & any
+*                   synchronization segment data NOT acknowledged by the remote host is re-transmitted once
+*                   the connection is established (see 'NetTCP_RxConnFastOpenCfg()  Note #2').
 *********************************************************************************************************
 */
 
@@ -10296,6 +13580,9 @@ static  void  NetTCP_RxPktConnHandlerSyncTxd (NET_TCP_CONN  *p_conn,
     NET_TCP_FREE_CODE   free_code;
     NET_TCP_CONN_STATE  state;
     NET_TMR_TICK        timeout_tick;
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    CPU_BOOLEAN         re_tx;
+#endif
     NET_ERR             err;
     NET_ERR             err_rtn;
 
@@ -10381,6 +13668,17 @@ static  void  NetTCP_RxPktConnHandlerSyncTxd (NET_TCP_CONN  *p_conn,
                              ?  p_buf_hdr->TCP_MaxSegSize
                              :  mss_dflt_tx;
 
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN                             /* Cfg win scaling as negotiated with remote host.      */
+    NetTCP_RxConnWinScaleCfg(p_conn, p_buf_hdr);
+#endif
+#ifdef  NET_TCP_ECN_MODULE_EN                                   /* Cfg ECN         as negotiated with remote host.      */
+    NetTCP_RxConnECN_Cfg(p_conn, p_buf_hdr);
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN                             /* Cfg TFO         as answered   by remote host ...     */
+                                                                /* ... (see Note #6).                                   */
+    re_tx = NetTCP_RxConnFastOpenCfg(p_conn, p_buf, p_buf_hdr, ack_code);
+#endif
+
 
                                                                 /* ----------------- HANDLE RX'D SEG ------------------ */
     NetTCP_RxPktConnHandlerSeg(p_conn, ack_code, p_buf, p_buf_hdr, &err_rtn);
@@ -10500,8 +13798,14 @@ static  void  NetTCP_RxPktConnHandlerSyncTxd (NET_TCP_CONN  *p_conn,
                  return;
         }
 
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+        if (re_tx == DEF_YES) {                                 /* Re-tx un-ack'd TFO data (see Note #6).               */
+            NetTCP_TxConnReTxQ(p_conn, DEF_NO, NET_TCP_CONN_CLOSE_ALL, &err);
+        }
+#endif
+
     } else {                                                    /* Else tx TCP conn sync/ack (see Note #2c3B2).         */
-        NetTCP_TxConnSync(p_conn, p_buf_hdr, state, &err);
+        NetTCP_TxConnSync(p_conn, p_buf_hdr, state, DEF_NULL, 0u, &err);
         if ( err != NET_TCP_ERR_NONE) {
             NetTCP_ConnClose(p_conn, p_buf_hdr, p_conn->ConnCloseAppFlag, NET_TCP_CONN_CLOSE_ALL);
            *p_err  = NET_TCP_ERR_CONN_CLOSE;
@@ -10785,6 +14089,10 @@ static  void  NetTCP_RxPktConnHandlerSyncTxd (NET_TCP_CONN  *p_conn,
 *               (4) Some  transitory errors were ignored &/or not returned from previous handler function(s).
 *                   These transitory errors are included for completeness & as an extra precaution in case
 *                   these transitory errors are returned by handler function(s).
+*
+*               (5) ECN is handled prior to the received segment so that any acknowledgement transmitted
+*                   while handling the segment already echoes a received Congestion Experienced codepoint
+*                   (see 'NetTCP_RxPktConnHandlerECN()  Note #1').
 *********************************************************************************************************
 */
 
@@ -10898,6 +14206,10 @@ static  void  NetTCP_RxPktConnHandlerConn (NET_TCP_CONN  *p_conn,
 
 
     if (keep_alive_rx == DEF_NO) {
+#ifdef  NET_TCP_ECN_MODULE_EN
+                                                                /* Handle rx'd ECN (see Note #5).                       */
+        NetTCP_RxPktConnHandlerECN(p_conn, ack_code, p_buf_hdr);
+#endif
                                                                 /* ----------------- HANDLE RX'D SEG ------------------ */
         NetTCP_RxPktConnHandlerSeg(p_conn, ack_code, p_buf, p_buf_hdr, &err_rtn);
         switch (err_rtn) {
@@ -13590,6 +16902,8 @@ static  void  NetTCP_RxPktConnHandlerTimeWait (NET_TCP_CONN  *p_conn,
 *               (4) Some  transitory errors were ignored &/or not returned from previous handler function(s).
 *                   These transitory errors are included for completeness & as an extra precaution in case
 *                   these transitory errors are returned by handler function(s).
+*
+*               (5) See 'NetTCP_RxPktConnHandlerConn()  Note #5'.
 *********************************************************************************************************
 */
 
@@ -13694,6 +17008,10 @@ static  void  NetTCP_RxPktConnHandlerCloseWait (NET_TCP_CONN  *p_conn,
 
 
 
+#ifdef  NET_TCP_ECN_MODULE_EN
+                                                                /* Handle rx'd ECN (see Note #5).                       */
+    NetTCP_RxPktConnHandlerECN(p_conn, ack_code, p_buf_hdr);
+#endif
                                                                 /* ----------------- HANDLE RX'D SEG ------------------ */
     NetTCP_RxPktConnHandlerSeg(p_conn, ack_code, p_buf, p_buf_hdr, &err_rtn);
     switch (err_rtn) {
@@ -14756,14 +18074,97 @@ static  void  NetTCP_RxPktConnHandlerSeg (NET_TCP_CONN      *p_conn,
 }
 
 
+/*
+*********************************************************************************************************
+*                                    NetTCP_RxPktConnHandlerECN()
+*
+* Description : Handle TCP connection's Explicit Congestion Notification for a received TCP packet :
+*
+*                   (a) Update received Congestion Experienced echo state          See Note #1
+*                   (b) Handle received ECN-Echo                                   See Note #2
+*
+*
+* Argument(s) : p_conn      Pointer to TCP connection.
+*               ------      Argument validated in NetTCP_RxPktConnHandler().
+*
+*               ack_code    Acknowledgement code for received TCP packet.
+*
+*               p_buf_hdr   Pointer to network buffer header that received TCP packet.
+*               ---------   Argument validated in NetTCP_RxPktConnHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerConn(),
+*               NetTCP_RxPktConnHandlerCloseWait().
+*
+* Note(s)     : (1) (a) A received CWR flag ends the echo of any previously received Congestion Experienced
+*                       codepoint.
+*
+*                   (b) A received Congestion Experienced codepoint (re-)starts the ECN-Echo of all transmitted
+*                       segments.  Since a CE codepoint received on the same segment as a CWR flag indicates
+*                       new congestion, the CWR flag is handled first.
+*
+*                   See also 'net_tcp.h  TCP ECN DEFINES  Note #2'.
+*
+*               (2) A received ECN-Echo on an acceptable acknowledgement reduces the TCP connection's
+*                   congestion window (see 'NetTCP_TxConnWinSizeHandlerCongCtrl()  Note #4').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_ECN_MODULE_EN
+static  void  NetTCP_RxPktConnHandlerECN (NET_TCP_CONN      *p_conn,
+                                          NET_TCP_ACK_CODE   ack_code,
+                                          NET_BUF_HDR       *p_buf_hdr)
+{
+    CPU_BOOLEAN  ecn_echo;
+    CPU_BOOLEAN  ecn_cwr;
+    NET_ERR      err;
+
+
+    if (p_conn->ECN_En != DEF_YES) {                            /* If ECN NOT negotiated, rtn.                          */
+        return;
+    }
+
+    ecn_echo = DEF_BIT_IS_SET(p_buf_hdr->TCP_HdrLen_Flags, NET_TCP_HDR_FLAG_ECE);
+    ecn_cwr  = DEF_BIT_IS_SET(p_buf_hdr->TCP_HdrLen_Flags, NET_TCP_HDR_FLAG_CWR);
+
+    if (ecn_cwr == DEF_YES) {                                   /* If CWR rx'd, end CE echo (see Note #1a).             */
+        p_conn->RxECN_EchoReqd = DEF_NO;
+    }
+    if (p_buf_hdr->IP_ECN == NET_IP_ECN_CE) {                   /* If CE  rx'd, echo CE     (see Note #1b).             */
+        p_conn->RxECN_EchoReqd = DEF_YES;
+    }
+
+    if (ecn_echo == DEF_YES) {                                  /* If ECE rx'd, ..                                      */
+        switch (ack_code) {
+            case NET_TCP_CONN_RX_ACK_VALID:
+            case NET_TCP_CONN_RX_ACK_DUP:                       /* .. reduce cong win (see Note #2).                    */
+                 NetTCP_TxConnWinSizeHandlerCongCtrl(p_conn,
+                                                     p_buf_hdr,
+                                                     ack_code,
+                                                     0u,
+                                                     NET_TCP_CONN_TX_WIN_ECN_ECHO,
+                                                    &err);
+                 break;
+
+
+            default:
+                 break;
+        }
+    }
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                  NetTCP_RxPktConnHandlerCfgConn()
 *
 * Description : (1) Configure TCP connection's controls on transition to connected state(s) :
 *
-*                   (a) Configure TCP connection maximum segment size control(s)
-*                   (b) Configure TCP connection window size controls
+*                   (a) Initialize TCP connection path   maximum segment size from path MTU cache
+*                   (b) Configure  TCP connection maximum segment size control(s)
+*                   (c) Configure  TCP connection window size controls
 *
 *
 * Argument(s) : p_conn       Pointer to a TCP connection.
@@ -14784,6 +18185,10 @@ static  void  NetTCP_RxPktConnHandlerCfgConn (NET_TCP_CONN  *p_conn)
 {
     NET_TCP_CFG_CODE  cfg_code;
 
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+    NetTCP_ConnPathMTU_Init(p_conn);                            /* Init path max seg size (see Note #1a).               */
+#endif
                                                                 /* Cfg conn (see Note #1).                              */
     cfg_code = NET_TCP_CONN_CFG_NONE              |
                NET_TCP_CONN_CFG_MAX_SEG_SIZE_CONN |
@@ -15231,6 +18636,10 @@ static  void  NetTCP_RxPktConnHandlerRxQ_Sync (NET_TCP_CONN  *p_conn,
 *                   See also 'NetTCP_RxAppData()                 Note #6',
 *                            'NetTCP_RxPktConnHandlerRxQ_Sync()  Note #5',
 *                          & 'NetTCP_RxConnWinSizeHandler()      Note #2a'.
+*
+*               (7) Out-of-order segments also (re-)enter the TCP connection's quick-ack mode so that every
+*                   following data segment is immediately acknowledged (see 'net_tcp.h  TCP ADAPTIVE ACK
+*                   DEFINES  Note #1b').
 *********************************************************************************************************
 */
 
@@ -15460,6 +18869,9 @@ static  void  NetTCP_RxPktConnHandlerRxQ_Conn (NET_TCP_CONN  *p_conn,
         if (p_conn->RxQ_State != NET_TCP_RX_Q_STATE_SYNC) {     /* ... in non-sync state,                       ...     */
                                                                 /* ... req immed TCP conn ack tx (see Note #5c).        */
             p_buf_hdr->TCP_SegAckTxReqCode = NET_TCP_CONN_TX_ACK_IMMED;
+#ifdef  NET_TCP_ACK_ADAPT_MODULE_EN                             /* ... & enter quick-ack mode    (see Note #7).         */
+            p_conn->TxAckQuickCnt          = NET_TCP_ACK_QUICK_CNT;
+#endif
         }
     }
 
@@ -15808,6 +19220,9 @@ static  void  NetTCP_RxPktConnHandlerRxQ_AppData (NET_TCP_CONN  *p_conn,
 
 
     p_conn->RxSeqNbrNext = seq_nbr;                             /* Update next expected rx seq.                         */
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+    NetTCP_RxConnWinSizeTuneRTT(p_conn);                        /* Update rx RTT for rx win auto-tuning.                */
+#endif
     if (p_conn->RxQ_State == NET_TCP_RX_Q_STATE_CLOSING) {
         if (p_conn->RxSeqNbrNext == p_conn->RxSeqNbrLast) {     /* If last seq rx'd, close TCP conn rx.                 */
             p_conn->RxQ_State = NET_TCP_RX_Q_STATE_CLOSED;
@@ -16411,6 +19826,24 @@ static  void  NetTCP_RxPktConnHandlerTxWinRemote (NET_TCP_CONN      *p_conn,
 *                           following unsigned arithmetic comparison MUST be true :
 *
 *                               (A) (SEG.ACK - ReTxQ.UnReTxdSeqNbr)  <=  (SND.NXT - ReTxQ.UnReTxdSeqNbr)
+*
+*              (10) (a) RACK is updated from each fully acknowledged re-transmit queue segment; the segment
+*                       at the head of the re-transmit queue is then re-transmitted if RACK deems it lost.
+*
+*                   (b) Any acknowledgement of new data ends the TCP connection's tail loss probe episode.
+*
+*                   See also 'net_tcp.h  TCP RACK-TLP DEFINES  Notes #1 & #2b'.
+*
+*              (11) If the re-transmit queue index is enabled :
+*
+*                   (a) Fully acknowledged indexed segments are located by binary search rather than by
+*                       walking the re-transmit queue (see 'NetTCP_TxConnReTxQ_IdxRemove()  Note #1').  Any
+*                       segments NOT indexed are then walked as before.
+*
+*                   (b) Once ALL indexed segments of an overflowed index are acknowledged, the index is
+*                       rebuilt from the remaining re-transmit queue segments.
+*
+*                   See also 'net_tcp.h  TCP RE-TRANSMIT QUEUE INDEX DEFINES'.
 *********************************************************************************************************
 */
 
@@ -16434,9 +19867,9 @@ static  void  NetTCP_RxPktConnHandlerReTxQ (NET_TCP_CONN      *p_conn,
     NET_TCP_SEQ_NBR        seq_nbr_next               = 0u;
     NET_TCP_SEQ_NBR        seq_nbr                    = 0u;
     NET_TCP_SEG_SIZE       seg_len                    = 0u;
-    NET_TCP_SEG_SIZE       seg_len_tot                = 0u;
+    NET_TCP_WIN_SIZE       seg_len_tot                = 0u;
     NET_TCP_SEG_SIZE       seg_len_data               = 0u;
-    NET_TCP_SEG_SIZE       seg_len_data_tot           = 0u;
+    NET_TCP_WIN_SIZE       seg_len_data_tot           = 0u;
     NET_TCP_TX_RTT_TS_MS   seg_rtt_ts_txd_ms          = 0u;
     NET_TCP_TX_RTT_TS_MS   seg_rtt_ts_rxd_ms          = 0u;
     CPU_BOOLEAN            segs_re_txd                = DEF_NO;
@@ -16596,6 +20029,24 @@ static  void  NetTCP_RxPktConnHandlerReTxQ (NET_TCP_CONN      *p_conn,
     seqs_ackd        =  DEF_NO;
     done             =  DEF_NO;
 
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+    if (p_conn->ReTxQ_IdxNbr > 0u) {                            /* If re-tx Q idx'd, srch idx for fully ack'd segs ...  */
+                                                                /* ... (see Note #11a).                                 */
+        p_buf_q = NetTCP_TxConnReTxQ_IdxRemove(p_conn, p_buf_hdr, &p_buf_q_prev, &seg_len_data_tot);
+        if (p_buf_q != p_buf_q_head) {                          /* If ANY segs fully ack'd, ...                         */
+            p_conn->TxSeqNbrUnAckdAlignDelta = 0u;
+            seqs_ackd                        = DEF_YES;
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+            if (p_buf_q != DEF_NULL) {                          /* ... resume seq chk @ first seg NOT fully ack'd.      */
+                p_buf_q_hdr = &p_buf_q->Hdr;
+                seq_nbr_cur =  p_buf_q_hdr->TCP_SeqNbr;
+            }
+            seq_nbr_delta = 0u;
+#endif
+        }
+    }
+#endif
+
     while ((p_buf_q != DEF_NULL) &&                             /* While NOT @ re-tx Q tail, ...                        */
            (done    ==  DEF_NO)) {                              /* ... srch for ack'd tx segs to remove (see Note #2c2).*/
 
@@ -16630,6 +20081,9 @@ static  void  NetTCP_RxPktConnHandlerReTxQ (NET_TCP_CONN      *p_conn,
         seq_delta_next = (p_conn->TxSeqNbrNext - seq_nbr_next);
 
         if (ack_delta_next <= seq_delta_next) {                 /* If seg fully acks cur re-tx Q seg (see Note #9b1A),  */
+#ifdef  NET_TCP_RACK_MODULE_EN                                  /* ... update RACK from ack'd seg (see Note #10a),      */
+            NetTCP_TxConnRACK_Update(p_conn, p_buf_q_hdr, p_buf_hdr->TCP_RTT_TS_Rxd_ms);
+#endif
             p_buf_q_prev                     = p_buf_q;
             p_buf_q                          = p_buf_q_next;    /* ... adv to next re-tx Q seg.                         */
             p_conn->TxSeqNbrUnAckdAlignDelta = 0u;
@@ -16738,6 +20192,24 @@ static  void  NetTCP_RxPktConnHandlerReTxQ (NET_TCP_CONN      *p_conn,
         (void)NetTCP_TxPktFree(p_buf_q_head);                   /* Free ALL fully ack'd seg pkt buf(s).                 */
     }
 
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+    if ((p_conn->ReTxQ_IdxOvf == DEF_YES) &&                    /* If re-tx Q idx ovf'd & ALL idx'd segs ack'd, ...     */
+        (p_conn->ReTxQ_IdxNbr <  1u)) {
+        NetTCP_TxConnReTxQ_IdxBuild(p_conn);                    /* ... re-build idx (see Note #11b).                    */
+    }
+#endif
+
+
+#ifdef  NET_TCP_RACK_MODULE_EN
+    if (seqs_ackd == DEF_YES) {                                 /* If ANY re-tx Q seq(s) ack'd, ...                     */
+        p_conn->TxTLP_Txd = DEF_NO;                             /* ... end TLP episode    (see Note #10b) ...           */
+                                                                /* ... & chk re-tx Q head lost (see Note #10a).         */
+        NetTCP_TxConnRACK_DetectLoss(p_conn, p_buf_hdr->TCP_RTT_TS_Rxd_ms, p_err);
+        if (*p_err != NET_TCP_ERR_NONE) {
+             return;
+        }
+    }
+#endif
 
     if (tmr_update == DEF_YES) {                                /* Update re-tx Q tmr.                                  */
         NetTCP_TxConnReTxQ_TimeoutSet(p_conn, DEF_NO, NET_TCP_CONN_CLOSE_ALL, p_err);
@@ -18664,6 +22136,256 @@ static  void  NetTCP_RxConnWinSizeHandler (NET_TCP_CONN      *p_conn,
 }
 
 
+/*
+*********************************************************************************************************
+*                                     NetTCP_RxConnWinSizeTune()
+*
+* Description : (1) Auto-tune TCP connection's configured receive window size :
+*
+*                   (a) Update    receive data octets read by the application
+*                   (b) Calculate target receive window size                                See Note #2
+*                   (c) Limit     target receive window size :
+*                       (1) To connection's configured & maximum receive window sizes
+*                       (2) To global maximum receive window growth
+*                       (3) On low receive buffer pool
+*                   (d) Update    TCP connection's receive window controls
+*
+*
+* Argument(s) : p_conn       Pointer to a TCP connection.
+*               -----       Argument validated in NetTCP_RxAppData().
+*
+*               data_len    Number of receive data octets read by the application.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxAppData().
+*
+* Note(s)     : (2) See 'net_tcp.h  TCP RECEIVE WINDOW AUTO-TUNING DEFINES  Note #2'.
+*
+*               (3) See 'net_tcp.h  TCP RECEIVE WINDOW AUTO-TUNING DEFINES  Note #3'.
+*
+*               (4) The receive window size MUST NOT be tuned above the largest window size that can be
+*                   advertised with the connection's receive window scale (see 'net_tcp.h  TCP WINDOW
+*                   SIZE DEFINES  Note #2').
+*
+*               (5) (a) Receive window size increases are immediately available to the calculated receive
+*                       window size.
+*
+*                   (b) Receive window size decreases are NOT applied to the calculated receive window size
+*                       but as received data is queued (see 'NetTCP_RxConnWinSizeHandler()  Note #5').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+static  void  NetTCP_RxConnWinSizeTune (NET_TCP_CONN      *p_conn,
+                                        NET_TCP_WIN_SIZE   data_len)
+{
+    NET_BUF_POOLS       *p_pools;
+    NET_STAT_POOL       *p_stat_pool;
+    NET_IF_NBR           if_nbr;
+    NET_TS_MS            ts_ms;
+    NET_TCP_TIMEOUT_MS   rtt_ms;
+    NET_TCP_WIN_SIZE     win_size_max;
+    NET_TCP_WIN_SIZE     win_size_tune;
+    NET_TCP_WIN_SIZE     win_size_avail;
+    NET_TCP_WIN_SIZE     win_size_delta;
+    NET_TCP_WIN_SIZE     rx_win_size_th;
+    CPU_BOOLEAN          pool_low;
+    NET_ERR              err;
+
+
+    ts_ms = NetUtil_TS_Get_ms();
+    if (p_conn->RxWinTuneBase == NET_TCP_WIN_SIZE_NONE) {       /* On first tune, save cfg'd rx win size.               */
+        p_conn->RxWinTuneBase  = p_conn->RxWinSizeCfgd;
+        p_conn->RxWinTuneRdCtr = 0u;
+        p_conn->RxWinTuneTS_ms = ts_ms;
+    }
+
+                                                                /* ------------------ UPDATE RD CTR ------------------- */
+    p_conn->RxWinTuneRdCtr += data_len;
+
+    if (p_conn->RxWinTuneRTT_ms != NET_TCP_RX_WIN_TUNE_RTT_NONE) {
+        rtt_ms = p_conn->RxWinTuneRTT_ms;                       /* Get rx RTT ...                                       */
+    } else if (p_conn->TxRTT_Avg_ms != NET_TCP_TX_RTT_NONE) {
+        rtt_ms = p_conn->TxRTT_Avg_ms;                          /* ... or tx RTT ...                                    */
+    } else {
+        rtt_ms = NET_TCP_RX_WIN_TUNE_RTT_DFLT_MS;               /* ... or dflt RTT (see Note #2).                       */
+    }
+    rtt_ms = DEF_MAX(rtt_ms, NET_TCP_RX_WIN_TUNE_RTT_MIN_MS);
+
+    if ((NET_TS_MS)(ts_ms - p_conn->RxWinTuneTS_ms) < rtt_ms) { /* If tune interval NOT elapsed, ...                    */
+        return;                                                 /* ... wait for more rd data.                           */
+    }
+
+
+                                                                /* ---------------- CALC TARGET RX WIN ---------------- */
+    win_size_max = NET_TCP_DFLT_RX_WIN_AUTO_TUNE_MAX_OCTET;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN                             /* Lim to scaled hdr win size (see Note #4).            */
+    win_size_max = DEF_MIN(win_size_max, ((NET_TCP_WIN_SIZE)NET_TCP_WIN_SIZE_HDR_MAX << p_conn->RxWinScale));
+#else
+    win_size_max = DEF_MIN(win_size_max, NET_TCP_WIN_SIZE_HDR_MAX);
+#endif
+    win_size_max = DEF_MAX(win_size_max, p_conn->RxWinTuneBase);
+
+    if (p_conn->RxWinTuneRdCtr > (win_size_max / NET_TCP_RX_WIN_TUNE_SCALAR)) {
+        win_size_tune = win_size_max;
+    } else {
+        win_size_tune = p_conn->RxWinTuneRdCtr * NET_TCP_RX_WIN_TUNE_SCALAR;
+    }
+    win_size_tune = DEF_MAX(win_size_tune, p_conn->RxWinTuneBase);
+
+    p_conn->RxWinTuneRdCtr = 0u;                                /* Start next tune interval.                            */
+    p_conn->RxWinTuneTS_ms = ts_ms;
+
+
+                                                                /* ------------------ CHK RX BUF POOL ----------------- */
+    pool_low = DEF_NO;
+    if_nbr   = NetConn_IF_NbrGet(p_conn->ID_Conn, &err);
+    if (err == NET_CONN_ERR_NONE) {
+        p_pools     =  NetBuf_PoolsGet(if_nbr);
+        p_stat_pool = &p_pools->RxBufLargeStatPool;
+        if (p_stat_pool->EntriesAvail < ((p_stat_pool->EntriesTot * NET_TCP_RX_WIN_TUNE_POOL_LOW_NUMER) /
+                                                                    NET_TCP_RX_WIN_TUNE_POOL_LOW_DENOM)) {
+            pool_low = DEF_YES;                                 /* See Note #3.                                         */
+        }
+    }
+
+
+                                                                /* ------------------ LIM TARGET RX WIN --------------- */
+    if (win_size_tune > p_conn->RxWinSizeCfgd) {
+        if (pool_low == DEF_YES) {                              /* Do NOT grow rx win on low rx buf pool.               */
+            return;
+        }
+                                                                /* Lim rx win growth to global max.                     */
+        win_size_delta = win_size_tune - p_conn->RxWinSizeCfgd;
+        win_size_avail = (NetTCP_RxWinTuneTot < NET_TCP_DFLT_RX_WIN_AUTO_TUNE_TOT_MAX_OCTET)
+                       ? (NET_TCP_DFLT_RX_WIN_AUTO_TUNE_TOT_MAX_OCTET - NetTCP_RxWinTuneTot)
+                       :  0u;
+        win_size_delta = DEF_MIN(win_size_delta, win_size_avail);
+        if (win_size_delta < 1) {
+            return;
+        }
+
+        NetTCP_RxWinTuneTot += win_size_delta;
+        if (p_conn->RxWinSizeCalcd <= p_conn->RxWinSizeCfgd) {  /* See Note #5a.                                        */
+            p_conn->RxWinSizeCalcd += win_size_delta;
+        }
+        p_conn->RxWinSizeCfgd += win_size_delta;
+
+    } else if (win_size_tune < p_conn->RxWinSizeCfgd) {
+        if (pool_low != DEF_YES) {                              /* Shrink rx win ONLY on low rx buf pool.               */
+            return;
+        }
+
+        win_size_delta         = p_conn->RxWinSizeCfgd - win_size_tune;
+        NetTCP_RxWinTuneTot   -= win_size_delta;
+        p_conn->RxWinSizeCfgd  = win_size_tune;                 /* See Note #5b.                                        */
+
+    } else {
+        return;
+    }
+
+                                                                /* Cfg silly win min th (see 'NetTCP_RxConnWinSizeCfg() */
+                                                                /* Note #3a').                                          */
+    rx_win_size_th            = (p_conn->RxWinSizeCfgd * NET_TCP_RX_SILLY_WIN_NUMER) / NET_TCP_RX_SILLY_WIN_DENOM;
+    p_conn->RxWinSizeUpdateTh =  DEF_MIN(p_conn->MaxSegSizeConn, rx_win_size_th);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_RxConnWinSizeTuneRTT()
+*
+* Description : Measure TCP connection's receive round-trip time for receive window auto-tuning.
+*
+* Argument(s) : p_conn       Pointer to a TCP connection.
+*               -----       Argument validated in NetTCP_RxPktConnHandlerRxQ_AppData().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerRxQ_AppData().
+*
+* Note(s)     : (1) (a) The receive round-trip time is measured as the time to receive one advertised
+*                       receive window of data, which approximates the sender's round-trip time while the
+*                       sender is limited by the receive window.
+*
+*                   (b) Since the sender may NOT always be limited by the receive window, decreasing
+*                       measurements are applied immediately while increasing measurements are averaged.
+*
+*               (2) See 'net_tcp.h  TCP RECEIVE WINDOW AUTO-TUNING DEFINES  Note #2c'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+static  void  NetTCP_RxConnWinSizeTuneRTT (NET_TCP_CONN  *p_conn)
+{
+    NET_TS_MS           ts_ms;
+    NET_TCP_TIMEOUT_MS  rtt_ms;
+
+
+    ts_ms = NetUtil_TS_Get_ms();
+
+    if (p_conn->RxWinTuneRTT_SeqNbr != NET_TCP_SEQ_NBR_NONE) {
+                                                                /* If rx win NOT yet rx'd, ...                          */
+        if ((CPU_INT32S)(p_conn->RxSeqNbrNext - p_conn->RxWinTuneRTT_SeqNbr) < 0) {
+            return;                                             /* ... continue measurement.                            */
+        }
+
+        rtt_ms = (NET_TCP_TIMEOUT_MS)(ts_ms - p_conn->RxWinTuneRTT_TS_ms);
+        if (rtt_ms > 0u) {
+            if ((p_conn->RxWinTuneRTT_ms == NET_TCP_RX_WIN_TUNE_RTT_NONE) ||
+                (p_conn->RxWinTuneRTT_ms  > rtt_ms)) {          /* See Note #1b.                                        */
+                p_conn->RxWinTuneRTT_ms  =  rtt_ms;
+            } else {
+                p_conn->RxWinTuneRTT_ms += (rtt_ms - p_conn->RxWinTuneRTT_ms) / NET_TCP_RX_WIN_TUNE_RTT_AVG_DENOM;
+            }
+        }
+    }
+                                                                /* Start next measurement (see Note #1a).               */
+    p_conn->RxWinTuneRTT_SeqNbr = p_conn->RxSeqNbrNext + p_conn->RxWinSizeActual;
+    p_conn->RxWinTuneRTT_TS_ms  = ts_ms;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_RxConnWinSizeTuneRelease()
+*
+* Description : Release TCP connection's auto-tuned receive window growth.
+*
+* Argument(s) : p_conn       Pointer to a TCP connection.
+*               -----       Argument validated in NetTCP_ConnFreeHandler(),
+*                                                 NetTCP_ConnCfgRxWinSizeHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_ConnFreeHandler(),
+*               NetTCP_ConnCfgRxWinSizeHandler().
+*
+* Note(s)     : (1) The connection's receive window growth is returned to the global maximum receive window
+*                   growth & auto-tuning restarts from the connection's next configured receive window size.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+static  void  NetTCP_RxConnWinSizeTuneRelease (NET_TCP_CONN  *p_conn)
+{
+    if (p_conn->RxWinTuneBase == NET_TCP_WIN_SIZE_NONE) {       /* If rx win NOT tuned, nothing to release.             */
+        return;
+    }
+
+    if (p_conn->RxWinSizeCfgd > p_conn->RxWinTuneBase) {        /* Release rx win growth (see Note #1).                 */
+        NetTCP_RxWinTuneTot -= (p_conn->RxWinSizeCfgd - p_conn->RxWinTuneBase);
+    }
+
+    p_conn->RxWinTuneBase  = NET_TCP_WIN_SIZE_NONE;
+    p_conn->RxWinTuneRdCtr = 0u;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      NetTCP_TxConnWinSizeCfg()
@@ -19435,6 +23157,19 @@ static  void  NetTCP_TxConnWinSizeHandlerCfgd (NET_TCP_CONN      *p_conn,
 *                       probe segments".
 *
 *                       See also 'NetTCP_TxConnWinSizeZeroWinHandler()  Note #1'.
+*
+*               (4) (a) RFC #3168, Section 6.1.2 states that "the TCP source ... SHOULD react to [an ECN-Echo]
+*                       as it would to a dropped packet" but "SHOULD NOT ... reduce the congestion window in
+*                       response to [an ECN-Echo] ... more than once per window of data".
+*
+*                   (b) Therefore, the congestion window is reduced ONLY on the first ECN-Echo received after
+*                       the previous reduction's recovery sequence number has been acknowledged.  The CWR flag
+*                       is then requested on the next new data segment transmitted.
+*
+*                   (c) If the TCP connection is already in fast recovery, the congestion window was already
+*                       reduced for this window of data; ONLY the CWR flag is requested.
+*
+*                   See also 'net_tcp.h  TCP ECN DEFINES  Note #3'.
 *********************************************************************************************************
 */
 
@@ -19448,6 +23183,10 @@ static  void  NetTCP_TxConnWinSizeHandlerCongCtrl (NET_TCP_CONN      *p_conn,
     CPU_BOOLEAN       ack_dup;
     NET_TCP_WIN_SIZE  tx_win_size_remote_actual;
     NET_TCP_WIN_SIZE  tx_win_size_remote_actual_min;
+#ifdef  NET_TCP_ECN_MODULE_EN
+    NET_TCP_SEQ_NBR   ack_delta_next;
+    NET_TCP_SEQ_NBR   seq_delta_recover;
+#endif
 
 
     switch (win_update_code) {
@@ -19636,6 +23375,34 @@ static  void  NetTCP_TxConnWinSizeHandlerCongCtrl (NET_TCP_CONN      *p_conn,
              break;
 
 
+#ifdef  NET_TCP_ECN_MODULE_EN
+        case NET_TCP_CONN_TX_WIN_ECN_ECHO:                      /* ---------------- ECN CONG RESPONSE ----------------- */
+             if (p_conn->TxECN_Recovery == DEF_YES) {           /* If prev reduction's win ack'd, end recovery.         */
+                 ack_delta_next    = p_conn->TxSeqNbrNext - p_conn->TxSeqNbrUnAckd;
+                 seq_delta_recover = p_conn->TxSeqNbrNext - p_conn->TxECN_RecoverSeqNbr;
+                 if (ack_delta_next <= seq_delta_recover) {
+                     p_conn->TxECN_Recovery = DEF_NO;
+                 }
+             }
+
+             if (p_conn->TxECN_Recovery == DEF_YES) {           /* Reduce cong win once per win (see Note #4b).         */
+                 break;
+             }
+                                                                /* If NOT in fast recovery (see Note #4c), ..           */
+             if (p_conn->TxWinRxdAckDupCtr < NET_TCP_FAST_RE_TX_ACK_DUP_TH) {
+                 NetTCP_TxConnWinSizeCalcSlowStartTh(p_conn);   /* .. calc slow start th                 ..             */
+                                                                /* .. & set cong win to slow start th.                  */
+                 NetTCP_TxConnWinSizeCongSet(p_conn, NET_TCP_CONN_TX_WIN_CONG_SET_SLOW_START);
+                 NetTCP_TxConnWinSizeUpdateAvail(p_conn);       /* Update avail tx win (see Note #2b3).                 */
+             }
+
+             p_conn->TxECN_Recovery      = DEF_YES;
+             p_conn->TxECN_RecoverSeqNbr = p_conn->TxSeqNbrNext;
+             p_conn->TxECN_CWR_Reqd      = DEF_YES;             /* Req CWR on next new data seg.                        */
+             break;
+#endif
+
+
         case NET_TCP_CONN_TX_WIN_INC:
              if (win_update_size < 1) {                         /* If NO win update, do NOT update win.                 */
                  break;
@@ -20100,6 +23867,7 @@ static  void  NetTCP_TxConnWinSizeDupAckCtrlUpdate (NET_TCP_CONN  *p_conn,
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing                timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_KEEP_ALIVE       Close connection keep-alive             timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TIMEOUT          Close connection                        timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
@@ -20252,7 +24020,7 @@ static  void  NetTCP_TxConnWinSizeZeroWinHandler (NET_TCP_CONN        *p_conn,
                                 (NET_ERR          *)&err);      /* Ignore transitory tx err(s).                         */
                                                                 /* ... & calc next timeout (see Note #1b2).             */
              timeout_ms   =  (NET_TCP_TIMEOUT_MS)NetTCP_TxConnRTO_CalcBackOff(p_conn, p_conn->TxWinZeroWinTimeout_ms);
-             timeout_tick = ((NET_TMR_TICK      )timeout_ms * NET_TMR_TIME_TICK_PER_SEC) / DEF_TIME_NBR_mS_PER_SEC;
+             timeout_tick = ((NET_TMR_TICK      )timeout_ms * NET_TCP_TMR_TICK_PER_SEC) / DEF_TIME_NBR_mS_PER_SEC;
              tmr_update   =   DEF_YES;
              break;
     }
@@ -20260,10 +24028,10 @@ static  void  NetTCP_TxConnWinSizeZeroWinHandler (NET_TCP_CONN        *p_conn,
 
     if (tmr_update == DEF_YES) {                                /* If tx probe tmr update req'd, ...                    */
                                                                 /* ... get tx zero win probe tmr.                       */
-        p_conn->TxQ_ZeroWinTmr = NetTmr_Get((CPU_FNCT_PTR )&NetTCP_TxConnWinSizeZeroWinTimeout,
-                                            (void        *) p_conn,
-                                            (NET_TMR_TICK ) timeout_tick,
-                                            (NET_ERR     *)&err);
+        p_conn->TxQ_ZeroWinTmr = NET_TCP_TMR_GET((CPU_FNCT_PTR )&NetTCP_TxConnWinSizeZeroWinTimeout,
+                                                 (void        *) p_conn,
+                                                 (NET_TMR_TICK ) timeout_tick,
+                                                 (NET_ERR     *)&err);
 
         if (err == NET_TMR_ERR_NONE) {                          /* If NO err(s), cfg tx zero win probe timeout.         */
             p_conn->TxWinZeroWinTimeout_ms = timeout_ms;
@@ -20443,6 +24211,106 @@ static  void  NetTCP_TxConnWinSizeZeroWinTimeout (void  *p_conn_timeout)
 }
 
 
+/*
+*********************************************************************************************************
+*                                     NetTCP_TxConnWinSizeHdrGet()
+*
+* Description : Get TCP connection's receive window size to advertise in a transmitted segment header.
+*
+* Argument(s) : p_conn      Pointer to TCP connection.
+*               ------      Argument validated in NetTCP_TxConnSync(),
+*                                                 NetTCP_TxConnAck(),
+*                                                 NetTCP_TxConnProbe(),
+*                                                 NetTCP_TxConnTxQ(),
+*                                                 NetTCP_TxConnReTxQ().
+*
+*               flags_tcp   TCP transmit flags of the segment to transmit.
+*
+* Return(s)   : TCP receive window size, scaled & limited to the TCP header window field.
+*
+* Caller(s)   : NetTCP_TxConnSync(),
+*               NetTCP_TxConnAck(),
+*               NetTCP_TxConnProbe(),
+*               NetTCP_TxConnTxQ(),
+*               NetTCP_TxConnReTxQ().
+*
+* Note(s)     : (1) The window advertised in SYN segments is NEVER scaled (see 'net_tcp.h  TCP WINDOW SIZE
+*                   DEFINES  Note #2c').  All other segments advertise the receive window shifted right by
+*                   the connection's negotiated receive window scale.
+*
+*               (2) Any receive window size that does NOT fit in the TCP header window field is advertised
+*                   as the maximum header window size.
+*********************************************************************************************************
+*/
+
+static  NET_TCP_WIN_SIZE  NetTCP_TxConnWinSizeHdrGet (NET_TCP_CONN   *p_conn,
+                                                      NET_TCP_FLAGS   flags_tcp)
+{
+    NET_TCP_WIN_SIZE  win_size;
+
+
+    win_size = p_conn->RxWinSizeActual;
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    if ((p_conn->WinScaleEn == DEF_YES) &&                      /* Scale non-SYN win size (see Note #1).                */
+        (DEF_BIT_IS_CLR(flags_tcp, NET_TCP_FLAG_TX_SYNC) == DEF_YES)) {
+         win_size >>= p_conn->RxWinScale;
+    }
+#else
+   (void)&flags_tcp;
+#endif
+
+    if (win_size > NET_TCP_WIN_SIZE_HDR_MAX) {                  /* Lim to hdr win size (see Note #2).                   */
+        win_size = NET_TCP_WIN_SIZE_HDR_MAX;
+    }
+
+    return (win_size);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_ConnWinScaleCalc()
+*
+* Description : Calculate the receive window scale required to advertise a receive window size.
+*
+* Argument(s) : win_size    Receive window size to advertise (in octets).
+*
+* Return(s)   : Smallest window scale shift that fits the window size in the TCP header window field,
+*                   limited to the maximum window scale.
+*
+* Caller(s)   : NetTCP_RxConnWinScaleCfg(),
+*               NetTCP_TxConnSync().
+*
+* Note(s)     : (1) See 'net_tcp.h  TCP WINDOW SIZE DEFINES  Note #2b'.
+*
+*               (2) Since the window scale is negotiated ONLY on SYN segments, the window scale for an
+*                   auto-tuned receive window is calculated for the maximum auto-tuned receive window size
+*                   (see 'NetTCP_RxConnWinSizeTune()  Note #4').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+static  CPU_INT08U  NetTCP_ConnWinScaleCalc (NET_TCP_WIN_SIZE  win_size)
+{
+    CPU_INT08U  win_scale;
+
+
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+    win_size  = DEF_MAX(win_size, NET_TCP_DFLT_RX_WIN_AUTO_TUNE_MAX_OCTET);    /* See Note #2.                         */
+#endif
+
+    win_scale = NET_TCP_WIN_SCALE_MIN;
+    while (((win_size >> win_scale) > NET_TCP_WIN_SIZE_HDR_MAX) &&
+            (win_scale              < NET_TCP_WIN_SCALE_MAX)) {
+        win_scale++;                                            /* See Note #1.                                         */
+    }
+
+    return (win_scale);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         NetTCP_TxConnSync()
@@ -20520,34 +24388,39 @@ static  void  NetTCP_TxConnWinSizeZeroWinTimeout (void  *p_conn_timeout)
 *                   See also 'NetTCP_TxConnClose()  Note #2'.
 *
 *
-* Argument(s) : p_conn      Pointer to a TCP connection.
-*               -----       Argument validated in NetTCP_TxConnReq(),
-*                                                 NetTCP_RxPktConnHandlerListen().
+* Argument(s) : p_conn          Pointer to a TCP connection.
+*               -----           Argument validated in NetTCP_TxConnReq(),
+*                                                     NetTCP_RxPktConnHandlerListen().
 *
-*               p_buf_hdr   Pointer to network buffer header that received TCP packet.
+*               p_buf_hdr       Pointer to network buffer header that received TCP packet.
 *
-*               state       Current TCP connection state at time of connection request.
+*               state           Current TCP connection state at time of connection request.
 *
-*               p_err       Pointer to variable that will receive the return error code from this function :
+*               p_data          Pointer to application data to transmit with the synchronization, if any
+*                                   (see Note #10b).
 *
-*                               NET_TCP_ERR_NONE                    TCP connection synchronization successfully
-*                                                                       transmitted.
-*                               NET_TCP_ERR_CONN_NOT_USED           TCP connection NOT currently used.
-*                               NET_TCP_ERR_CONN_FAULT              TCP connection fault; connection(s) aborted.
-*                               NET_TCP_ERR_INVALID_CONN_STATE      Invalid TCP connection state.
-*                               NET_TCP_ERR_INVALID_CONN_OP         Invalid TCP connection operation.
-*                               NET_TCP_ERR_NONE_AVAIL              Resources NOT available.
+*               data_len_req    Length of application data to transmit with the synchronization (in octets).
 *
-*                                                                   - RETURNED BY NetTCP_TxConnPrepareSegAddrs() : -
-*                               NET_CONN_ERR_INVALID_FAMILY         Invalid     connection family.
-*                               NET_CONN_ERR_INVALID_ADDR           Invalid TCP connection address.
-*                               NET_CONN_ERR_INVALID_ADDR_LEN       Invalid TCP connection address length.
+*               p_err           Pointer to variable that will receive the return error code from this function :
 *
-*                                                                   ----- RETURNED BY NetTCP_TxPktHandler() : ------
-*                               NET_TCP_ERR_TX_PKT                  TCP transmit packet error.
-*                               NET_ERR_IF_LOOPBACK_DIS             Loopback interface disabled.
-*                               NET_ERR_IF_LINK_DOWN                Network  interface link state down (i.e.
-*                                                                       NOT available for receive or transmit).
+*                                   NET_TCP_ERR_NONE                    TCP connection synchronization successfully
+*                                                                           transmitted.
+*                                   NET_TCP_ERR_CONN_NOT_USED           TCP connection NOT currently used.
+*                                   NET_TCP_ERR_CONN_FAULT              TCP connection fault; connection(s) aborted.
+*                                   NET_TCP_ERR_INVALID_CONN_STATE      Invalid TCP connection state.
+*                                   NET_TCP_ERR_INVALID_CONN_OP         Invalid TCP connection operation.
+*                                   NET_TCP_ERR_NONE_AVAIL              Resources NOT available.
+*
+*                                                                       - RETURNED BY NetTCP_TxConnPrepareSegAddrs() : -
+*                                   NET_CONN_ERR_INVALID_FAMILY         Invalid     connection family.
+*                                   NET_CONN_ERR_INVALID_ADDR           Invalid TCP connection address.
+*                                   NET_CONN_ERR_INVALID_ADDR_LEN       Invalid TCP connection address length.
+*
+*                                                                       ----- RETURNED BY NetTCP_TxPktHandler() : ------
+*                                   NET_TCP_ERR_TX_PKT                  TCP transmit packet error.
+*                                   NET_ERR_IF_LOOPBACK_DIS             Loopback interface disabled.
+*                                   NET_ERR_IF_LINK_DOWN                Network  interface link state down (i.e.
+*                                                                           NOT available for receive or transmit).
 *
 * Return(s)   : none.
 *
@@ -20587,12 +24460,41 @@ static  void  NetTCP_TxConnWinSizeZeroWinTimeout (void  *p_conn_timeout)
 *                   See also 'NetTCP_RxPktConnHandlerSyncTxd()  Note #2c3B2'.
 *
 *               (7) IP transmit options currently NOT implemented      See 'net_tcp.h  Note #1d'
+*
+*               (8) RFC #7323, Section 2.2 states that a TCP "MAY send a Window Scale option in an initial
+*                   <SYN> segment" but "MAY send a Window Scale option in a <SYN,ACK> segment only if a
+*                   Window Scale option was received in the initial <SYN> segment".
+*
+*                   (a) Active opens always offer window scaling.
+*                   (b) Passive opens offer window scaling ONLY if the remote host offered it (see
+*                       'NetTCP_RxConnWinScaleCfg()').
+*
+*               (9) (a) Active opens always offer explicit congestion notification.
+*                   (b) Passive opens accept explicit congestion notification ONLY if the remote host
+*                       requested it (see 'NetTCP_RxConnECN_Cfg()').
+*
+*                   See also 'net_tcp.h  TCP ECN DEFINES  Note #1'.
+*
+*              (10) If TCP Fast Open is enabled on the TCP connection (see 'net_tcp.h  TCP FAST OPEN
+*                   DEFINES  Note #1') :
+*
+*                   (a) Active opens request a cookie if NO cookie is cached for the remote host.
+*
+*                   (b) Active opens with a cached cookie transmit the cookie & up to one default maximum
+*                       segment size of application data in the synchronization segment.
+*
+*                   (c) Passive opens transmit a new cookie if requested by the remote host (see
+*                       'NetTCP_RxPktConnHandlerListen()  Note #10c').
+*
+*                   (d) Synchronization segment data is re-used on re-transmission (see Note #6).
 *********************************************************************************************************
 */
 
 static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
                                  NET_BUF_HDR         *p_buf_hdr,
                                  NET_TCP_CONN_STATE   state,
+                                 void                *p_data,
+                                 CPU_INT16U           data_len_req,
                                  NET_ERR             *p_err)
 {
 #ifdef  NET_IPv4_MODULE_EN
@@ -20627,6 +24529,21 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
     CPU_INT16U                     payload_max;
     NET_TCP_OPT_CFG_MAX_SEG_SIZE  *p_opt_cfg_max_seg_size;
     NET_TCP_OPT_CFG_MAX_SEG_SIZE   opt_cfg_max_seg_size;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    NET_TCP_OPT_CFG_WIN_SCALE      opt_cfg_win_scale;
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    NET_TCP_OPT_CFG_FAST_OPEN      opt_cfg_fast_open;
+    NET_TCP_FAST_OPEN_CACHE_ENTRY *p_cache_entry;
+    NET_BUF                       *pseg_sync_prev;
+    CPU_INT08U                     cookie[NET_TCP_FAST_OPEN_COOKIE_LEN_MAX];
+    CPU_INT08U                     cookie_len;
+    CPU_INT08U                     addr_local [NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U                     addr_remote[NET_CONN_ADDR_LEN_MAX];
+    NET_CONN_ADDR_LEN              addr_len;
+    NET_TCP_SEG_SIZE               data_len_max;
+#endif
+    CPU_INT16U                     opt_len;
     NET_TCP_FLAGS                  flags_tcp;
     NET_PROTOCOL_TYPE              proto_type = NET_PROTOCOL_TYPE_NONE;
     NET_ERR                        err;
@@ -20708,9 +24625,92 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
              return;
     }
 
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN                             /* Prepare TFO cookie & data (see Note #10).            */
+    cookie_len     = NET_TCP_FAST_OPEN_COOKIE_LEN_NONE;
+    pseg_sync_prev = DEF_NULL;
+    switch (state) {
+        case NET_TCP_CONN_STATE_CLOSED:
+             p_conn->TxFastOpenDataLen = 0u;
+             if (p_conn->FastOpenEn != DEF_ENABLED) {
+                 break;
+             }
+
+             Mem_Clr(&addr_remote[0], NET_CONN_ADDR_LEN_MAX);
+             addr_len = sizeof(addr_remote);
+             NetConn_AddrRemoteGet(conn_id, &addr_remote[0], &addr_len, &err);
+             if (err != NET_CONN_ERR_NONE) {
+                 break;
+             }
+             Mem_Clr(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], NET_CONN_ADDR_IP_LEN_PORT);
+
+             p_cache_entry = NetTCP_FastOpenCacheSrch(&addr_remote[0]);
+             if (p_cache_entry == DEF_NULL) {                   /* Req cookie, if NONE cached (see Note #10a).          */
+                 cookie_len = NET_TCP_FAST_OPEN_COOKIE_LEN_REQ;
+                 break;
+             }
+                                                                /* Else tx cached cookie & data (see Note #10b).        */
+             cookie_len = p_cache_entry->CookieLen;
+             Mem_Copy(&cookie[0], &p_cache_entry->Cookie[0], cookie_len);
+
+             if (p_data != DEF_NULL) {                          /* Lim data to dflt max seg size.                       */
+                 data_len_max = NET_TCP_MAX_SEG_SIZE_DFLT;
+#ifdef  NET_IPv4_MODULE_EN
+                 if (proto_type == NET_PROTOCOL_TYPE_TCP_V4) {
+                     data_len_max = NET_TCP_MAX_SEG_SIZE_DFLT_V4;
+                 }
+#endif
+                 data_len = DEF_MIN(data_len_req, data_len_max);
+             }
+             break;
+
+
+        case NET_TCP_CONN_STATE_LISTEN:                         /* Tx new cookie, if req'd (see Note #10c).             */
+             if ((p_conn->TxFastOpenCookieReqd == DEF_YES) &&
+                 (p_buf_hdr                    != DEF_NULL)) {
+                 NetTCP_RxPktConnAddrsGet(p_buf_hdr, &addr_local[0], &addr_remote[0]);
+                 NetTCP_FastOpenCookieGet(&addr_remote[0], &cookie[0]);
+                 cookie_len = NET_TCP_FAST_OPEN_COOKIE_LEN;
+             }
+             break;
+
+
+        case NET_TCP_CONN_STATE_SYNC_TXD:                       /* Re-use prev sync seg data (see Note #10d).           */
+             if ((p_conn->TxFastOpenDataLen >  0u) &&
+                 (p_conn->ReTxQ_Head        != DEF_NULL)) {
+                 pseg_sync_prev = p_conn->ReTxQ_Head;
+                 data_len       = p_conn->TxFastOpenDataLen;
+             }
+             break;
+
+
+        default:
+             break;
+    }
+#else
+   (void)&p_data;                                               /* Prevent 'variable unused' compiler warnings.         */
+   (void)&data_len_req;
+#endif
+
+    opt_len = NET_TCP_HDR_OPT_LEN_MAX_SEG_SIZE;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    if (state == NET_TCP_CONN_STATE_CLOSED) {                   /* For active open, offer win scale (see Note #8).      */
+        p_conn->WinScaleEn = DEF_YES;
+        p_conn->RxWinScale = NetTCP_ConnWinScaleCalc(p_conn->RxWinSizeCfgd);
+    }
+    if (p_conn->WinScaleEn == DEF_YES) {                        /* Incl win scale opt padded to opt word size.          */
+        opt_len += NET_TCP_HDR_OPT_SIZE_WORD;
+    }
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    if (cookie_len != NET_TCP_FAST_OPEN_COOKIE_LEN_NONE) {      /* Incl TFO opt padded to opt word size.                */
+        opt_len += NET_TCP_HDR_OPT_LEN_MIN_LEN + cookie_len;
+        opt_len += (NET_TCP_HDR_OPT_SIZE_WORD - (opt_len % NET_TCP_HDR_OPT_SIZE_WORD)) % NET_TCP_HDR_OPT_SIZE_WORD;
+    }
+#endif
+
     data_ix = 0u;
 
-    NetTCP_GetTxDataIx(if_nbr, proto_type, 4u, data_len, p_conn, &data_ix, p_err);
+    NetTCP_GetTxDataIx(if_nbr, proto_type, opt_len, data_len, p_conn, &data_ix, p_err);
     pseg_sync = NetBuf_Get(if_nbr, NET_TRANSACTION_TX, data_len, data_ix, &data_ix_offset, NET_BUF_FLAG_NONE, &err);
     if ( err != NET_BUF_ERR_NONE) {                             /* See Note #5b1.                                       */
        *p_err  = NET_TCP_ERR_NONE_AVAIL;
@@ -20719,6 +24719,21 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
 
     data_ix       += data_ix_offset;
     pseg_sync_hdr  = &pseg_sync->Hdr;
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN                             /* Wr TFO data into TCP tx buf (see Note #10).          */
+    if (data_len > 0u) {
+        if (pseg_sync_prev != DEF_NULL) {
+            NetBuf_DataRd(pseg_sync_prev, pseg_sync_prev->Hdr.DataIx, data_len, &pseg_sync->DataPtr[data_ix], &err);
+        } else {
+            NetBuf_DataWr(pseg_sync, data_ix, data_len, (CPU_INT08U *)p_data, &err);
+        }
+        if ( err != NET_BUF_ERR_NONE) {                         /* See Note #5b1.                                       */
+            NetBuf_Free(pseg_sync);
+           *p_err  = NET_TCP_ERR_CONN_FAULT;
+            return;
+        }
+    }
+#endif
                                                                 /* ----------------- PREPARE TCP HDR ------------------ */
                                                                 /* Prepare seg addrs.                                   */
     if (p_buf_hdr != DEF_NULL) {                                /* If TCP pkt rx'd, cfg TCP tx                ...       */
@@ -20799,9 +24814,22 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
     if (state != NET_TCP_CONN_STATE_CLOSED) {                   /* For non-CLOSED state, ...                            */
         DEF_BIT_SET(flags_tcp, NET_TCP_FLAG_TX_ACK);            /* ... tx ACK.                                          */
     }
+    if (data_len > 0u) {                                        /* For TFO data, tx PUSH (see Note #10b).               */
+        DEF_BIT_SET(flags_tcp, NET_TCP_FLAG_TX_PUSH);
+    }
+#ifdef  NET_TCP_ECN_MODULE_EN
+    if (state == NET_TCP_CONN_STATE_CLOSED) {                   /* For active open, offer ECN (see Note #9a).           */
+        p_conn->ECN_En = DEF_YES;
+        DEF_BIT_SET(flags_tcp, (NET_TCP_FLAG_TX_ECN_ECHO | NET_TCP_FLAG_TX_CWR));
+    } else if (p_conn->ECN_En == DEF_YES) {                     /* Else accept ECN, if req'd (see Note #9b).            */
+        DEF_BIT_SET(flags_tcp, NET_TCP_FLAG_TX_ECN_ECHO);
+    } else {
+                                                                /* Empty Else Statement                                 */
+    }
+#endif
 
                                                                 /* Prepare TCP rx win size.                             */
-    win_size = p_conn->RxWinSizeActual;
+    win_size = NetTCP_TxConnWinSizeHdrGet(p_conn, flags_tcp);
 
 
 
@@ -20827,6 +24855,24 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
     p_opt_cfg_max_seg_size->MaxSegSize =  p_conn->MaxSegSizeLocalActual;
     p_opt_cfg_max_seg_size->NextOptPtr =  DEF_NULL;
 
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN                             /* Prepare TCP win scale opt (see Note #8).             */
+    if (p_conn->WinScaleEn == DEF_YES) {
+        opt_cfg_win_scale.Type             =  NET_TCP_OPT_TYPE_WIN_SCALE;
+        opt_cfg_win_scale.WinScale         =  p_conn->RxWinScale;
+        opt_cfg_win_scale.NextOptPtr       =  DEF_NULL;
+        p_opt_cfg_max_seg_size->NextOptPtr = &opt_cfg_win_scale;
+    }
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN                             /* Prepare TCP fast open opt (see Note #10).            */
+    if (cookie_len != NET_TCP_FAST_OPEN_COOKIE_LEN_NONE) {
+        opt_cfg_fast_open.Type             =  NET_TCP_OPT_TYPE_FAST_OPEN;
+        opt_cfg_fast_open.CookieLen        =  cookie_len;
+        opt_cfg_fast_open.CookiePtr        = &cookie[0];
+        opt_cfg_fast_open.NextOptPtr       =  p_opt_cfg_max_seg_size->NextOptPtr;
+        p_opt_cfg_max_seg_size->NextOptPtr = &opt_cfg_fast_open;
+    }
+#endif
+
     if (DEF_BIT_IS_CLR(pseg_sync_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
 #ifdef  NET_IPv4_MODULE_EN
                                                                 /* Prepare IP params.                                   */
@@ -20876,10 +24922,10 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
     pseg_sync_hdr->TransportPortSrc          = (NET_PORT_NBR )src_port;
     pseg_sync_hdr->TransportPortDest         = (NET_PORT_NBR )dest_port;
 
-    pseg_sync_hdr->TCP_SegLenInit           = (NET_TCP_SEG_SIZE)NET_TCP_SEG_LEN_SYNC;
+    pseg_sync_hdr->TCP_SegLenInit           = (NET_TCP_SEG_SIZE)(NET_TCP_SEG_LEN_SYNC + data_len);
     pseg_sync_hdr->TCP_SegLen               = (NET_TCP_SEG_SIZE)pseg_sync_hdr->TCP_SegLenInit;
     pseg_sync_hdr->TCP_SegLenLast           = (NET_TCP_SEG_SIZE)pseg_sync_hdr->TCP_SegLenInit;
-    pseg_sync_hdr->TCP_SegLenData           = (NET_TCP_SEG_SIZE)0u;
+    pseg_sync_hdr->TCP_SegLenData           = (NET_TCP_SEG_SIZE)data_len;
     pseg_sync_hdr->TCP_SegSync              = (CPU_BOOLEAN     )DEF_YES;
     pseg_sync_hdr->TCP_SegClose             = (CPU_BOOLEAN     )DEF_NO;
     pseg_sync_hdr->TCP_SegAck               = (CPU_BOOLEAN     )DEF_BIT_IS_SET(flags_tcp, NET_TCP_FLAG_TX_ACK);
@@ -20904,6 +24950,9 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
     NetTCP_ConnFreeBufQ(&p_conn->ReTxQ_Head, &p_conn->ReTxQ_Tail); /* Free re-tx Q (see Note #6c).                      */
     p_conn->ReTxQ_Head         =  pseg_sync;
     p_conn->ReTxQ_Tail         =  pseg_sync;
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+    NetTCP_TxConnReTxQ_IdxBuild(p_conn);                        /* Re-build re-tx Q idx.                                */
+#endif
                                                                 /* Update TCP conn seq nbrs (see Notes #2 & #3).        */
     p_conn->TxSeqNbrSync       = (NET_TCP_SEQ_NBR) seq_nbr;
     p_conn->TxSeqNbrNext       = (NET_TCP_SEQ_NBR)(seq_nbr + pseg_sync_hdr->TCP_SegLen);
@@ -20911,6 +24960,9 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
     p_conn->TxSeqNbrUnAckdPrev = (NET_TCP_SEQ_NBR) p_conn->TxSeqNbrUnAckd;
     p_conn->TxSeqNbrUnAckd     = (NET_TCP_SEQ_NBR) p_conn->TxSeqNbrSync;
     p_conn->TxSeqNbrUnReTxd    = (NET_TCP_SEQ_NBR) p_conn->TxSeqNbrUnAckd;
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    p_conn->TxFastOpenDataLen  = (NET_TCP_SEG_SIZE) data_len;
+#endif
 
 
 
@@ -21449,6 +25501,7 @@ static  void  NetTCP_TxConnClose (NET_TCP_CONN        *p_conn,
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing                timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
@@ -21788,6 +25841,21 @@ static  void  NetTCP_TxConnClose (NET_TCP_CONN        *p_conn,
 *
 *                   (a) For any network resources NOT linked to the TCP connection, each network resource
 *                       MUST be freed by appropriate function(s).
+*
+*              (11) While a received Congestion Experienced codepoint remains unacknowledged by the remote
+*                   host's CWR, every transmitted acknowledgement carries the ECE flag.
+*
+*                   See also 'net_tcp.h  TCP ECN DEFINES  Note #2'.
+*
+*              (12) If adaptive acknowledgements are enabled :
+*
+*                   (a) While the connection is in quick-ack mode, every received data segment is
+*                       immediately acknowledged.
+*
+*                   (b) Otherwise, the delayed acknowledgement segment count threshold is calculated from
+*                       the connection's receive window (see 'NetTCP_TxConnAckDlyCntTh()  Note #1').
+*
+*                   See also 'net_tcp.h  TCP ADAPTIVE ACK DEFINES'.
 *********************************************************************************************************
 */
 
@@ -21819,6 +25887,7 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
     CPU_BOOLEAN              tx_ack;
     CPU_BOOLEAN              tmr_free;
     CPU_BOOLEAN              push_avail;
+    CPU_INT16U               ack_dly_cnt_th;
     NET_TMR_TICK             timeout_tick;
     NET_BUF_SIZE             data_len;
     NET_BUF_SIZE             data_ix;
@@ -21936,23 +26005,43 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
                           break;
                       }
 
+#ifdef  NET_TCP_ACK_ADAPT_MODULE_EN
+                      if ((p_buf_hdr             != DEF_NULL) &&
+                          (p_conn->TxAckQuickCnt >  0u)) {      /* If quick-ack mode, ...                               */
+                          p_conn->TxAckQuickCnt--;
+                          NET_CTR_STAT_INC(Net_StatCtrs.TCP.TxSegConnAckQuickCtr);
+                          tx_ack = DEF_YES;                     /* ... tx TCP conn ack (see Note #12a).                 */
+                          break;
+                      }
+
+                      ack_dly_cnt_th = NetTCP_TxConnAckDlyCntTh(p_conn);    /* See Note #12b.                           */
+#else
+                      ack_dly_cnt_th = NET_TCP_ACK_DLY_CNT_TH;
+#endif
+
                       p_conn->TxAckDlyCnt++;                    /* If ack dly cnt >= th, ...                            */
-                      if (p_conn->TxAckDlyCnt >= NET_TCP_ACK_DLY_CNT_TH) {
+                      if (p_conn->TxAckDlyCnt >= ack_dly_cnt_th) {
                           tx_ack = DEF_YES;                     /* ... tx TCP conn ack (see Note #6a1B).                */
                           break;
                       }
 
                       if (p_conn->TxAckDlyTmr != DEF_NULL) {    /* If ack dly tmr prev'ly started, ...                  */
+#ifdef  NET_TCP_ACK_ADAPT_MODULE_EN
+                          NET_CTR_STAT_INC(Net_StatCtrs.TCP.RxSegAckDlydCtr);
+#endif
                          *p_err = NET_TCP_ERR_CONN_ACK_DLYD;    /* ... continue ack dly (see Note #6a2A).               */
                           return;
                       }
 
                       timeout_tick        = p_conn->TxAckDlyTimeout_tick;
-                      p_conn->TxAckDlyTmr = NetTmr_Get((CPU_FNCT_PTR )&NetTCP_TxConnAckDlyTimeout,
-                                                       (void        *) p_conn,
-                                                       (NET_TMR_TICK ) timeout_tick,
-                                                       (NET_ERR     *)&err);
+                      p_conn->TxAckDlyTmr = NET_TCP_TMR_GET((CPU_FNCT_PTR )&NetTCP_TxConnAckDlyTimeout,
+                                                            (void        *) p_conn,
+                                                            (NET_TMR_TICK ) timeout_tick,
+                                                            (NET_ERR     *)&err);
                       if ( err == NET_TMR_ERR_NONE) {           /* If ack dly tmr avail, ...                            */
+#ifdef  NET_TCP_ACK_ADAPT_MODULE_EN
+                          NET_CTR_STAT_INC(Net_StatCtrs.TCP.RxSegAckDlydCtr);
+#endif
                          *p_err = NET_TCP_ERR_CONN_ACK_DLYD;    /* ... start ack dly (see Note #6a2A).                  */
                           return;
 
@@ -22268,9 +26357,14 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
                                                                 /* Prepare TCP tx flags (see Note #1b2C).               */
     flags_tcp = NET_TCP_FLAG_NONE  |
                 NET_TCP_FLAG_TX_ACK;
+#ifdef  NET_TCP_ECN_MODULE_EN
+    if (p_conn->RxECN_EchoReqd == DEF_YES) {                    /* Set ECE while CE echo reqd (see Note #11).          */
+        DEF_BIT_SET(flags_tcp, NET_TCP_FLAG_TX_ECN_ECHO);
+    }
+#endif
 
                                                                 /* Prepare TCP win size.                                */
-    win_size  = p_conn->RxWinSizeActual;
+    win_size  = NetTCP_TxConnWinSizeHdrGet(p_conn, flags_tcp);
 
 
 
@@ -22418,6 +26512,51 @@ static  void  NetTCP_TxConnAckDlyReset (NET_TCP_CONN  *p_conn,
 }
 
 
+/*
+*********************************************************************************************************
+*                                     NetTCP_TxConnAckDlyCntTh()
+*
+* Description : Calculate TCP connection's delayed acknowledgement segment count threshold.
+*
+* Argument(s) : p_conn       Pointer to TCP connection.
+*               -----       Argument validated in NetTCP_TxConnAck().
+*
+* Return(s)   : Number of received data segments to acknowledge with a single delayed acknowledgement.
+*
+* Caller(s)   : NetTCP_TxConnAck().
+*
+* Note(s)     : (1) The threshold is calculated from the connection's configured receive window size (see
+*                   'net_tcp.h  TCP ADAPTIVE ACK DEFINES  Note #2').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_ACK_ADAPT_MODULE_EN
+static  CPU_INT16U  NetTCP_TxConnAckDlyCntTh (NET_TCP_CONN  *p_conn)
+{
+    NET_TCP_WIN_SIZE  win_segs;
+    CPU_INT16U        cnt_th;
+
+
+    if (p_conn->MaxSegSizeConn < 1) {                           /* If conn MSS NOT yet avail, ...                       */
+        return (NET_TCP_ACK_DLY_CNT_TH);                        /* ... rtn dflt ack dly cnt th.                         */
+    }
+                                                                /* Calc nbr of max segs per rx win quarter.             */
+    win_segs =  p_conn->RxWinSizeCfgd / p_conn->MaxSegSizeConn;
+    win_segs = (win_segs / NET_TCP_ACK_DECIMATION_WIN_DIV);
+
+    if (win_segs < NET_TCP_ACK_DLY_CNT_TH) {                    /* Lim th to min ack dly cnt th ...                     */
+        cnt_th = NET_TCP_ACK_DLY_CNT_TH;
+    } else if (win_segs > NET_TCP_ACK_DECIMATION_CNT_MAX) {     /* ... & to max ack decimation cnt.                     */
+        cnt_th = NET_TCP_ACK_DECIMATION_CNT_MAX;
+    } else {
+        cnt_th = (CPU_INT16U)win_segs;
+    }
+
+    return (cnt_th);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    NetTCP_TxConnAckDlyTimeout()
@@ -22602,6 +26741,7 @@ static  void  NetTCP_TxConnAckDlyTimeout (void  *p_conn_timeout)
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing                timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
@@ -23381,6 +27521,419 @@ static  void  NetTCP_TxConnReset (NET_TCP_CONN        *p_conn,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetTCP_TxSynCacheSync()
+*
+* Description : (1) Prepare & transmit a TCP connection synchronization for a cached connection request :
+*
+*                   (a) Get  buffer
+*                   (b) Prepare TCP segment :
+*                       (1) Addresses                                                   See Note #2
+*                       (2) Sequence & acknowledgement numbers
+*                       (3) Options                                                     See Note #3
+*                   (c) Transmit TCP segment                                            See Note #4
+*
+*
+* Argument(s) : p_conn          Pointer to TCP listen half-connection.
+*               ------          Argument validated in NetTCP_RxPktConnHandler().
+*
+*               p_buf_hdr       Pointer to network buffer header that received TCP packet.
+*               ---------       Argument validated in NetTCP_Rx().
+*
+*               seq_nbr         Initial send sequence number.
+*
+*               win_scale_en    Indicate whether to offer the window scale option :
+*
+*                                   DEF_YES                         Offer     window scale option.
+*                                   DEF_NO                          Do NOT offer window scale option.
+*
+*               ecn_en          Indicate whether to accept explicit congestion notification (see Note #5) :
+*
+*                                   DEF_YES                         Accept     ECN.
+*                                   DEF_NO                          Do NOT accept ECN.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_TCP_ERR_NONE                TCP connection synchronization successfully
+*                                                                       transmitted.
+*                                   NET_TCP_ERR_NONE_AVAIL          NO available buffers to transmit TCP
+*                                                                       connection synchronization.
+*                                   NET_TCP_ERR_CONN_FAIL           TCP connection operation(s) failed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_SynCacheRxSync().
+*
+* Note(s)     : (2) Source & destination addresses are swapped from the received TCP packet since NO TCP
+*                   connection is allocated for a cached connection request (see 'net_tcp.h  TCP SYN CACHE
+*                   DEFINES  Note #1').
+*
+*               (3) The maximum segment size & window scale options are prepared as by NetTCP_TxConnSync()
+*                   (see 'NetTCP_TxConnSync()  Notes #4 & #8').
+*
+*               (4) The synchronization segment is NOT queued for retransmission; the remote host re-transmits
+*                   its connection request instead (see 'net_tcp.h  TCP SYN CACHE DEFINES  Note #3a').
+*
+*                   Therefore, the network buffer MUST be freed by lower layer(s).
+*
+*               (5) See 'net_tcp.h  TCP ECN DEFINES  Notes #1b & #1c'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+static  void  NetTCP_TxSynCacheSync (NET_TCP_CONN     *p_conn,
+                                     NET_BUF_HDR      *p_buf_hdr,
+                                     NET_TCP_SEQ_NBR   seq_nbr,
+                                     CPU_BOOLEAN       win_scale_en,
+                                     CPU_BOOLEAN       ecn_en,
+                                     NET_ERR          *p_err)
+{
+#ifdef  NET_IPv4_MODULE_EN
+    NET_IPv4_TTL                   TTL;
+    NET_IPv4_TOS                   TOS;
+    NET_IPv4_FLAGS                 flags_ipv4;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+    NET_IPv6_TRAFFIC_CLASS         traffic_class;
+    NET_IPv6_FLOW_LABEL            flow_label;
+    NET_IPv6_HOP_LIM               hop_lim;
+    NET_IPv6_FLAGS                 flags_ipv6;
+#endif
+    NET_IF_NBR                     if_nbr;
+    NET_CONN_ID                    conn_id;
+    NET_BUF_SIZE                   data_len;
+    NET_BUF_SIZE                   data_ix;
+    NET_BUF_SIZE                   data_ix_offset;
+    NET_BUF                       *pseg_sync;
+    NET_BUF_HDR                   *pseg_sync_hdr;
+    NET_TCP_SEQ_NBR                ack_nbr;
+    NET_TCP_WIN_SIZE               win_size;
+    NET_TCP_FLAGS                  flags_tcp;
+    NET_PROTOCOL_TYPE              proto_type;
+    NET_TCP_OPT_CFG_MAX_SEG_SIZE   opt_cfg_max_seg_size;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    NET_TCP_OPT_CFG_WIN_SCALE      opt_cfg_win_scale;
+#endif
+    CPU_INT16U                     opt_len;
+    CPU_INT16U                     payload_max;
+    NET_ERR                        err;
+
+
+                                                                /* --------------------- GET BUF ---------------------- */
+    if_nbr  = p_buf_hdr->IF_Nbr;
+    conn_id = p_conn->ID_Conn;
+
+    if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
+        proto_type = NET_PROTOCOL_TYPE_TCP_V4;
+    } else {
+        proto_type = NET_PROTOCOL_TYPE_TCP_V6;
+    }
+
+    opt_len = NET_TCP_HDR_OPT_LEN_MAX_SEG_SIZE;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    if (win_scale_en == DEF_YES) {                              /* Incl win scale opt padded to opt word size.          */
+        opt_len += NET_TCP_HDR_OPT_SIZE_WORD;
+    }
+#else
+   (void)&win_scale_en;                                         /* Prevent 'variable unused' compiler warning.          */
+#endif
+
+    data_len = NET_TCP_DATA_LEN_TX_SYNC;
+    data_ix  = 0u;
+
+    NetTCP_GetTxDataIx(if_nbr, proto_type, opt_len, data_len, p_conn, &data_ix, p_err);
+    switch (*p_err) {                                           /* Rtn err if tx data ix NOT avail.                     */
+        case NET_IPv4_ERR_NONE:
+        case NET_IPv6_ERR_NONE:
+             break;
+
+
+        default:
+            *p_err = NET_TCP_ERR_CONN_FAIL;
+             return;
+    }
+
+    pseg_sync = NetBuf_Get(if_nbr, NET_TRANSACTION_TX, data_len, data_ix, &data_ix_offset, NET_BUF_FLAG_NONE, &err);
+    if ( err != NET_BUF_ERR_NONE) {
+       *p_err  = NET_TCP_ERR_NONE_AVAIL;
+        return;
+    }
+
+    data_ix       += data_ix_offset;
+    pseg_sync_hdr  = &pseg_sync->Hdr;
+
+    payload_max = NetIF_GetPayloadTxMax(if_nbr, proto_type, &err);
+    if (err != NET_IF_ERR_NONE) {
+        NetBuf_Free(pseg_sync);
+       *p_err = NET_TCP_ERR_CONN_FAIL;
+        return;
+    }
+
+
+                                                                /* ----------------- PREPARE TCP HDR ------------------ */
+    ack_nbr   = (NET_TCP_SEQ_NBR)(p_buf_hdr->TCP_SeqNbr + NET_TCP_SEG_LEN_SYNC);
+
+    flags_tcp =  NET_TCP_FLAG_NONE    |
+                 NET_TCP_FLAG_TX_SYNC |
+                 NET_TCP_FLAG_TX_ACK;
+#ifdef  NET_TCP_ECN_MODULE_EN
+    if (ecn_en == DEF_YES) {                                    /* Accept ECN (see Note #5).                            */
+        DEF_BIT_SET(flags_tcp, NET_TCP_FLAG_TX_ECN_ECHO);
+    }
+#else
+   (void)&ecn_en;                                               /* Prevent 'variable unused' compiler warning.          */
+#endif
+
+    win_size  =  NetTCP_TxConnWinSizeHdrGet(p_conn, flags_tcp);
+
+                                                                /* Prepare TCP opts (see Note #3).                      */
+    opt_cfg_max_seg_size.Type       =  NET_TCP_OPT_TYPE_MAX_SEG_SIZE;
+    opt_cfg_max_seg_size.MaxSegSize =  payload_max;
+    opt_cfg_max_seg_size.NextOptPtr =  DEF_NULL;
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    if (win_scale_en == DEF_YES) {
+        opt_cfg_win_scale.Type          =  NET_TCP_OPT_TYPE_WIN_SCALE;
+        opt_cfg_win_scale.WinScale      =  NetTCP_ConnWinScaleCalc(p_conn->RxWinSizeCfgd);
+        opt_cfg_win_scale.NextOptPtr    =  DEF_NULL;
+        opt_cfg_max_seg_size.NextOptPtr = &opt_cfg_win_scale;
+    }
+#endif
+
+                                                                /* Init buf ctrls.                                      */
+    pseg_sync_hdr->DataIx       = (CPU_INT16U  )data_ix;
+    pseg_sync_hdr->DataLen      = (NET_BUF_SIZE)data_len;
+    pseg_sync_hdr->TotLen       = (NET_BUF_SIZE)pseg_sync_hdr->DataLen;
+
+    pseg_sync_hdr->TCP_SegSync  =  DEF_YES;
+    pseg_sync_hdr->TCP_SegClose =  DEF_NO;
+    pseg_sync_hdr->TCP_SegAck   =  DEF_YES;
+    pseg_sync_hdr->TCP_SegReset =  DEF_NO;
+
+    pseg_sync_hdr->TCP_Flags    =  flags_tcp;
+
+
+                                                                /* --------------- TX TCP CONN SYNC SEG --------------- */
+    if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
+#ifdef  NET_IPv4_MODULE_EN
+        NetConn_IPv4TxParamsGet(conn_id, &flags_ipv4, &TOS, &TTL, &err);
+        if ( err != NET_CONN_ERR_NONE) {
+            NetBuf_Free(pseg_sync);
+           *p_err  = NET_TCP_ERR_CONN_FAIL;
+            return;
+        }
+
+        pseg_sync_hdr->ProtocolHdrType          = NET_PROTOCOL_TYPE_TCP_V4;
+        pseg_sync_hdr->ProtocolHdrTypeTransport = NET_PROTOCOL_TYPE_TCP_V4;
+
+        NetTCP_TxPktHandlerIPv4(pseg_sync,                      /* Swap rx'd pkt addrs (see Note #2).                   */
+                                p_buf_hdr->IP_AddrDest,
+                                p_buf_hdr->TransportPortDest,
+                                p_buf_hdr->IP_AddrSrc,
+                                p_buf_hdr->TransportPortSrc,
+                                seq_nbr,
+                                ack_nbr,
+                                win_size,
+                                TOS,
+                                TTL,
+                                flags_tcp,
+                                flags_ipv4,
+                               &opt_cfg_max_seg_size,
+                                DEF_NULL,
+                               &err);                           /* Ignore transitory tx err(s).                         */
+#endif
+    } else {
+#ifdef  NET_IPv6_MODULE_EN
+        NetConn_IPv6TxParamsGet(conn_id, &traffic_class, &flow_label, &hop_lim, &flags_ipv6, &err);
+        if ( err != NET_CONN_ERR_NONE) {
+            NetBuf_Free(pseg_sync);
+           *p_err  = NET_TCP_ERR_CONN_FAIL;
+            return;
+        }
+
+        DEF_BIT_SET(pseg_sync_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME);
+        pseg_sync_hdr->ProtocolHdrType          = NET_PROTOCOL_TYPE_TCP_V6;
+        pseg_sync_hdr->ProtocolHdrTypeTransport = NET_PROTOCOL_TYPE_TCP_V6;
+
+        NetTCP_TxPktHandlerIPv6(pseg_sync,                      /* Swap rx'd pkt addrs (see Note #2).                   */
+                               &p_buf_hdr->IPv6_AddrDest,
+                                p_buf_hdr->TransportPortDest,
+                               &p_buf_hdr->IPv6_AddrSrc,
+                                p_buf_hdr->TransportPortSrc,
+                                seq_nbr,
+                                ack_nbr,
+                                win_size,
+                                traffic_class,
+                                flow_label,
+                                hop_lim,
+                                flags_tcp,
+                               &opt_cfg_max_seg_size,
+                               &err);                           /* Ignore transitory tx err(s).                         */
+#endif
+    }
+
+                                                                /* Tx buf freed by lower layer(s) [see Note #4].        */
+    NET_CTR_STAT_INC(Net_StatCtrs.TCP.TxSegConnSyncCtr);
+
+
+   *p_err = NET_TCP_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_TxTimeWaitAck()
+*
+* Description : (1) Prepare & transmit a TCP acknowledgement for a compacted TIME-WAIT connection :
+*
+*                   (a) Get  buffer
+*                   (b) Prepare TCP segment :
+*                       (1) Addresses                                                   See Note #2
+*                       (2) Sequence & acknowledgement numbers                          See Note #3
+*                   (c) Transmit TCP segment                                            See Note #4
+*
+*
+* Argument(s) : p_entry         Pointer to time-wait entry.
+*               -------         Argument validated in NetTCP_RxPktTimeWait().
+*
+*               p_buf_hdr       Pointer to network buffer header that received TCP packet.
+*               ---------       Argument validated in NetTCP_Rx().
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_TCP_ERR_NONE                TCP acknowledgement successfully transmitted.
+*                                   NET_TCP_ERR_NONE_AVAIL          NO available buffers to transmit TCP
+*                                                                       acknowledgement.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktTimeWait().
+*
+* Note(s)     : (2) Source & destination addresses are swapped from the received TCP packet since the TCP
+*                   connection was freed when compacted (see 'net_tcp.h  TCP TIME-WAIT DEFINES  Note #1').
+*
+*               (3) The acknowledgement acknowledges the remote FIN as by the TIME-WAIT state &
+*                   advertises the receive window saved when the connection was compacted :
+*
+*                       <SEQ=TxSeqNbrNext> <ACK=RxSeqNbrNext> <WND=RxWinSizeHdr> <CTL=ACK>
+*
+*               (4) The acknowledgement is NOT queued for retransmission; the network buffer MUST be freed by
+*                   lower layer(s).
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  void  NetTCP_TxTimeWaitAck (NET_TCP_TIME_WAIT_ENTRY  *p_entry,
+                                    NET_BUF_HDR              *p_buf_hdr,
+                                    NET_ERR                  *p_err)
+{
+    NET_IF_NBR          if_nbr;
+    NET_BUF_SIZE        data_len;
+    NET_BUF_SIZE        data_ix;
+    NET_BUF_SIZE        data_ix_offset;
+    NET_BUF            *pseg_ack;
+    NET_BUF_HDR        *pseg_ack_hdr;
+    NET_TCP_FLAGS       flags_tcp;
+    NET_PROTOCOL_TYPE   proto_type;
+    NET_ERR             err;
+
+
+                                                                /* --------------------- GET BUF ---------------------- */
+    if_nbr = p_buf_hdr->IF_Nbr;
+
+    if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
+        proto_type = NET_PROTOCOL_TYPE_TCP_V4;
+    } else {
+        proto_type = NET_PROTOCOL_TYPE_TCP_V6;
+    }
+
+    data_len = NET_TCP_DATA_LEN_TX_ACK;
+    data_ix  = 0u;
+
+    NetTCP_GetTxDataIx(if_nbr, proto_type, 0u, data_len, DEF_NULL, &data_ix, p_err);
+    pseg_ack = NetBuf_Get(if_nbr, NET_TRANSACTION_TX, data_len, data_ix, &data_ix_offset, NET_BUF_FLAG_NONE, &err);
+    if ( err != NET_BUF_ERR_NONE) {
+       *p_err  = NET_TCP_ERR_NONE_AVAIL;
+        return;
+    }
+
+    data_ix      += data_ix_offset;
+    pseg_ack_hdr  = &pseg_ack->Hdr;
+
+
+                                                                /* ----------------- PREPARE TCP HDR ------------------ */
+    flags_tcp = NET_TCP_FLAG_NONE |
+                NET_TCP_FLAG_TX_ACK;
+
+                                                                /* Init buf ctrls.                                      */
+    pseg_ack_hdr->DataIx       = (CPU_INT16U  )data_ix;
+    pseg_ack_hdr->DataLen      = (NET_BUF_SIZE)data_len;
+    pseg_ack_hdr->TotLen       = (NET_BUF_SIZE)pseg_ack_hdr->DataLen;
+
+    pseg_ack_hdr->TCP_SegSync  =  DEF_NO;
+    pseg_ack_hdr->TCP_SegClose =  DEF_NO;
+    pseg_ack_hdr->TCP_SegAck   =  DEF_YES;
+    pseg_ack_hdr->TCP_SegReset =  DEF_NO;
+
+    pseg_ack_hdr->TCP_Flags    =  flags_tcp;
+
+
+                                                                /* ------------------ TX TCP ACK SEG ------------------ */
+    if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
+#ifdef  NET_IPv4_MODULE_EN
+        pseg_ack_hdr->ProtocolHdrType          = NET_PROTOCOL_TYPE_TCP_V4;
+        pseg_ack_hdr->ProtocolHdrTypeTransport = NET_PROTOCOL_TYPE_TCP_V4;
+
+        NetTCP_TxPktHandlerIPv4(pseg_ack,                       /* Swap rx'd pkt addrs (see Note #2).                   */
+                                p_buf_hdr->IP_AddrDest,
+                                p_buf_hdr->TransportPortDest,
+                                p_buf_hdr->IP_AddrSrc,
+                                p_buf_hdr->TransportPortSrc,
+                                p_entry->TxSeqNbrNext,          /* See Note #3.                                         */
+                                p_entry->RxSeqNbrNext,
+                                p_entry->RxWinSizeHdr,
+                                NET_IPv4_TOS_DFLT,
+                                NET_IPv4_TTL_DFLT,
+                                flags_tcp,
+                                NET_IPv4_FLAG_NONE,
+                                DEF_NULL,
+                                DEF_NULL,
+                               &err);                           /* Ignore transitory tx err(s).                         */
+#endif
+    } else {
+#ifdef  NET_IPv6_MODULE_EN
+        DEF_BIT_SET(pseg_ack_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME);
+        pseg_ack_hdr->ProtocolHdrType          = NET_PROTOCOL_TYPE_TCP_V6;
+        pseg_ack_hdr->ProtocolHdrTypeTransport = NET_PROTOCOL_TYPE_TCP_V6;
+
+        NetTCP_TxPktHandlerIPv6(pseg_ack,                       /* Swap rx'd pkt addrs (see Note #2).                   */
+                               &p_buf_hdr->IPv6_AddrDest,
+                                p_buf_hdr->TransportPortDest,
+                               &p_buf_hdr->IPv6_AddrSrc,
+                                p_buf_hdr->TransportPortSrc,
+                                p_entry->TxSeqNbrNext,          /* See Note #3.                                         */
+                                p_entry->RxSeqNbrNext,
+                                p_entry->RxWinSizeHdr,
+                                NET_IPv6_TRAFFIC_CLASS_DFLT,
+                                NET_IPv6_FLOW_LABEL_DFLT,
+                                NET_IPv6_HOP_LIM_DFLT,
+                                flags_tcp,
+                                DEF_NULL,
+                               &err);                           /* Ignore transitory tx err(s).                         */
+#endif
+    }
+
+                                                                /* Tx buf freed by lower layer(s) [see Note #4].        */
+    NET_CTR_STAT_INC(Net_StatCtrs.TCP.TxSegConnAckCtr);
+
+
+   *p_err = NET_TCP_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        NetTCP_TxConnProbe()
@@ -23422,6 +27975,7 @@ static  void  NetTCP_TxConnReset (NET_TCP_CONN        *p_conn,
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing                timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
@@ -23771,7 +28325,7 @@ static  void  NetTCP_TxConnProbe (NET_TCP_CONN        *p_conn,
                 NET_TCP_FLAG_TX_ACK;
 
                                                                 /* Prepare TCP win size.                                */
-    win_size  = p_conn->RxWinSizeActual;
+    win_size  = NetTCP_TxConnWinSizeHdrGet(p_conn, flags_tcp);
 
                                                                 /* Prepare IP params.                                   */
     if (DEF_BIT_IS_CLR(pseg_probe_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
@@ -23900,6 +28454,7 @@ static  void  NetTCP_TxConnProbe (NET_TCP_CONN        *p_conn,
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing                timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
@@ -24326,6 +28881,7 @@ static  void  NetTCP_TxConnKeepAliveReset (NET_TCP_CONN  *p_conn)
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing                timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
@@ -24679,6 +29235,32 @@ static  void  NetTCP_TxConnKeepAliveReset (NET_TCP_CONN  *p_conn)
 *
 *                   See also 'NetTCP_TxConnAppData()  Note #10'
 *                          & 'NetTCP_TxConnReTxQ()    Note #11'.
+*
+*              (15) If TCP transmit pacing is enabled (see 'net_tcp.h  TCP TRANSMIT PACING DEFINES') :
+*
+*                   (a) Each transmitted segment consumes its data length from the TCP connection's pacing
+*                       tokens.
+*
+*                   (b) A segment that exceeds the available pacing tokens is delayed on the transmit queue
+*                       pacing timer until enough tokens accumulate (see 'NetTCP_TxConnTxQ_TimeoutPace()').
+*
+*                   (c) However, if NO network timer is available to delay the segment, the segment is
+*                       immediately transmitted.
+*
+*              (16) If ECN is negotiated on the TCP connection (see 'net_tcp.h  TCP ECN DEFINES') :
+*
+*                   (a) Segments carrying new data are transmitted with an ECN-Capable Transport codepoint
+*                       & the first such segment after a congestion window reduction carries the CWR flag.
+*
+*                   (b) Every segment carries the ECE flag while a received CE codepoint remains echoed.
+*
+*              (17) If path MTU discovery is enabled, IPv4 data segments that fit the TCP connection's maximum
+*                   segment size are transmitted with the IPv4 'Don't Fragment' flag set (see 'net_tcp.h
+*                   TCP PATH MTU DISCOVERY DEFINES  Note #1c').
+*
+*              (18) If the re-transmit queue index is enabled, each segment moved to the re-transmit queue is
+*                   also added to the TCP connection's re-transmit queue index (see 'net_tcp.h  TCP RE-TRANSMIT
+*                   QUEUE INDEX DEFINES  Note #1a').
 *********************************************************************************************************
 */
 
@@ -24946,7 +29528,7 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
                                                                 /* ... & tx Q tmr NOT yet cfg'd,                ...     */
                                         if (p_conn->TxQ_SillyWinTmr == DEF_NULL) {
                                             timeout_tick            =  p_conn->TxWinSillyWinTimeout_tick;
-                                            p_conn->TxQ_SillyWinTmr =  NetTmr_Get(        &NetTCP_TxConnTxQ_TimeoutSillyWin,
+                                            p_conn->TxQ_SillyWinTmr =  NET_TCP_TMR_GET(   &NetTCP_TxConnTxQ_TimeoutSillyWin,
                                                                                   (void *) p_conn,
                                                                                            timeout_tick,
                                                                                           &err);
@@ -24968,6 +29550,27 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
                     }
                 }
             }
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+            if (tx_seg == DEF_YES) {                            /* Chk tx pacing (see Note #15) :               ...     */
+                timeout_tick = NetTCP_TxConnTxPaceDlyGet(p_conn, pseg_hdr->TCP_SegLenData);
+                if (timeout_tick > 0u) {                        /* ... if seg exceeds pacing tokens,            ...     */
+                    if (p_conn->TxQ_PaceTmr == DEF_NULL) {      /* ... & tx Q pacing tmr NOT yet cfg'd,         ...     */
+                        p_conn->TxQ_PaceTmr =  NET_TCP_TMR_GET(   &NetTCP_TxConnTxQ_TimeoutPace,
+                                                          (void *) p_conn,
+                                                                   timeout_tick,
+                                                                  &err);
+                        if (err == NET_TMR_ERR_NONE) {          /* ... & tx Q pacing tmr avail,                 ...     */
+                            tx_seg = DEF_NO;                    /* ... dly  tx seg (see Note #15b);             ...     */
+                            p_conn->TxPaceDlyCtr++;
+                        }                                       /* ... else tx seg (see Note #15c).                     */
+
+                    } else {                                    /* Else  tx Q pacing tmr already cfg'd, ...             */
+                        tx_seg = DEF_NO;                        /* ... dly  tx seg (see Note #15b).                     */
+                    }
+                }
+            }
+#endif
         }
 
 
@@ -25005,6 +29608,9 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
                 p_conn->ReTxQ_Head                =  pseg;
                 p_conn->ReTxQ_Tail                =  pseg;
             }
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+            NetTCP_TxConnReTxQ_IdxAdd(p_conn, pseg);            /* Idx seg by seq nbr (see Note #18).                   */
+#endif
 
 
             if (p_conn->ReTxQ_Tmr == DEF_NULL) {                /* If unavail, get & update re-tx Q tmr.                */
@@ -25017,6 +29623,10 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
                                                                 /* ----------------- UPDATE TCP CONN ------------------ */
                                                                 /* Update TCP conn tx seq nbr(s).                       */
             p_conn->TxSeqNbrNext += pseg_hdr->TCP_SegLen;
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+                                                                /* Consume tx pacing tokens (see Note #15a).            */
+            p_conn->TxPaceTokens -= DEF_MIN(p_conn->TxPaceTokens, (CPU_INT32U)pseg_hdr->TCP_SegLenData);
+#endif
 
                                                                 /* Update TCP conn tx win ctrls.                        */
             NetTCP_TxConnWinSizeHandlerCongCtrl(p_conn,
@@ -25068,7 +29678,7 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
             flags_tcp = pseg_hdr->TCP_Flags;
 
                                                                 /* Prepare TCP win size.                                */
-            win_size  = p_conn->RxWinSizeActual;
+            win_size  = NetTCP_TxConnWinSizeHdrGet(p_conn, flags_tcp);
 
                                                                 /* Prepare IP params (see Note #9a).                    */
 
@@ -25081,6 +29691,12 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
                         *p_err  = NET_TCP_ERR_CONN_FAULT;
                          return;
                      }
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+                     if ((pseg_hdr->TCP_SegLenData >  0u) &&    /* Set DF on data segs that fit MSS (see Note #17).     */
+                         (pseg_hdr->TCP_SegLenData <= p_conn->MaxSegSizeConn)) {
+                         DEF_BIT_SET(flags_ipv4, NET_IPv4_FLAG_TX_DONT_FRAG);
+                     }
+#endif
                      break;
 #endif
 
@@ -25104,6 +29720,26 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
 
             }
 
+#ifdef  NET_TCP_ECN_MODULE_EN
+            if (p_conn->ECN_En == DEF_YES) {
+                if (pseg_hdr->TCP_SegLenData > 0u) {            /* Mark new data segs as ECT (see Note #16a).           */
+#ifdef  NET_IPv4_MODULE_EN
+                    TOS           |= NET_TCP_ECN_TX_ECT;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+                    traffic_class |= NET_TCP_ECN_TX_ECT;
+#endif
+                    if (p_conn->TxECN_CWR_Reqd == DEF_YES) {
+                        DEF_BIT_SET(flags_tcp, NET_TCP_FLAG_TX_CWR);
+                        p_conn->TxECN_CWR_Reqd = DEF_NO;
+                    }
+                }
+                if (p_conn->RxECN_EchoReqd == DEF_YES) {        /* See Note #16b.                                       */
+                    DEF_BIT_SET(flags_tcp, NET_TCP_FLAG_TX_ECN_ECHO);
+                }
+            }
+#endif
+
                                                                 /* Update TCP tx buf ctrls.                             */
             pseg_hdr->TCP_SeqNbrLast  = seq_nbr;
             pseg_hdr->TCP_AckNbrLast  = ack_nbr;
@@ -25290,6 +29926,14 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
         }
     }
 
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+    if ((p_conn->TxQ_Head    == DEF_NULL) &&                    /* If tx Q empty, ...                                   */
+        (p_conn->TxQ_PaceTmr != DEF_NULL)) {
+        NetTmr_Free(p_conn->TxQ_PaceTmr);                       /* ... free tx Q pacing tmr.                            */
+        p_conn->TxQ_PaceTmr  = DEF_NULL;
+    }
+#endif
+
 
 
    *p_err = err_rtn;                                            /* Rtn err from tx handler(s).                          */
@@ -25610,10 +30254,10 @@ static  void  NetTCP_TxConnTxQ_TimeoutIdleSet (NET_TCP_CONN  *p_conn)
     timeout_tick = p_conn->TxRTT_RTO_tick;                      /* Tx Q idle timeout = RTO (see Note #2a1).             */
     if (p_conn->TxQ_IdleTmr == DEF_NULL) {                      /* If       tx Q idle tmr NOT avail, ...                */
                                                                 /* ...  get tx Q idle tmr.                              */
-        p_conn->TxQ_IdleTmr  =  NetTmr_Get((CPU_FNCT_PTR )&NetTCP_TxConnTxQ_TimeoutIdle,
-                                           (void        *) p_conn,
-                                           (NET_TMR_TICK ) timeout_tick,
-                                           (NET_ERR     *)&err);
+        p_conn->TxQ_IdleTmr  =  NET_TCP_TMR_GET((CPU_FNCT_PTR )&NetTCP_TxConnTxQ_TimeoutIdle,
+                                                (void        *) p_conn,
+                                                (NET_TMR_TICK ) timeout_tick,
+                                                (NET_ERR     *)&err);
     } else {                                                    /* Else set tx Q idle tmr.                              */
         NetTmr_Set((NET_TMR    *) p_conn->TxQ_IdleTmr,
                    (CPU_FNCT_PTR)&NetTCP_TxConnTxQ_TimeoutIdle,
@@ -25881,10 +30525,10 @@ static  void  NetTCP_TxConnTxQ_TimeoutSillyWin (void  *p_conn_timeout)
                  case NET_TCP_TX_Q_STATE_SUSPEND:               /* See Note #5 & #5a.                                   */
                  case NET_TCP_TX_Q_STATE_CLOSING_SUSPEND:
                       timeout_tick            = (NET_TMR_TICK)1u;
-                      p_conn->TxQ_SillyWinTmr =  NetTmr_Get((CPU_FNCT_PTR )&NetTCP_TxConnTxQ_TimeoutSillyWin,
-                                                            (void        *) p_conn,
-                                                            (NET_TMR_TICK ) timeout_tick,
-                                                            (NET_ERR     *)&err);
+                      p_conn->TxQ_SillyWinTmr =  NET_TCP_TMR_GET((CPU_FNCT_PTR )&NetTCP_TxConnTxQ_TimeoutSillyWin,
+                                                                 (void        *) p_conn,
+                                                                 (NET_TMR_TICK ) timeout_tick,
+                                                                 (NET_ERR     *)&err);
                      (void)&err;                                /* Ignore transitory rsrc err(s) [see Note #5b].        */
                       return;
 
@@ -25923,6 +30567,154 @@ static  void  NetTCP_TxConnTxQ_TimeoutSillyWin (void  *p_conn_timeout)
 }
 
 
+/*
+*********************************************************************************************************
+*                                   NetTCP_TxConnTxQ_TimeoutPace()
+*
+* Description : (1) (a) Handle TCP connection's transmit queue pacing timeout ... :
+*
+*                       (1) Clear    TCP connection's transmit queue pacing timer           See Notes #3a1A & #3a2
+*                       (2) Transmit TCP connection's transmit data                         See Note  #2
+*
+*                   (b) ... for the following states :
+*
+*                       (1) ESTABLISHED
+*                       (2) FIN-WAIT-1
+*                       (3) CLOSING
+*                       (4) CLOSE-WAIT
+*                       (5) LAST-ACK
+*
+*
+* Argument(s) : p_conn_timeout       Pointer to TCP connection (see 'NetTCP_TxConnTxQ_TimeoutSillyWin()
+*                                        Note #3b').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Referenced in NetTCP_TxConnTxQ().
+*
+* Note(s)     : (2) The pacing timeout transmits the TCP connection's transmit queue segments delayed by
+*                   transmit pacing, as allowed by the pacing tokens accumulated since.
+*
+*                   See also 'NetTCP_TxConnTxQ()  Note #15b'.
+*
+*               (3) This function is a network timer callback function :
+*
+*                   (a) (1) For the following connection timer(s) ... :
+*
+*                           (A) TCP connection transmit queue pacing timer ('TxQ_PaceTmr')
+*
+*                       (2) (A) Clear the timer pointer ... :
+*                               (1) Cleared prior to next handler function(s); ...
+*                               (2) Cleared prior to invalid state fault exit.
+*
+*                           (B) but do NOT re-free the timer.
+*
+*                   (b) Do NOT set the following close timer flag(s) :
+*
+*                       (1) NET_TCP_CONN_CLOSE_TMR_TX_PACE
+*
+*               (4) See 'NetTCP_TxConnTxQ_TimeoutSillyWin()  Note #5'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+static  void  NetTCP_TxConnTxQ_TimeoutPace (void  *p_conn_timeout)
+{
+    NET_TCP_CONN        *p_conn;
+    NET_TCP_CLOSE_CODE   close_code;
+    NET_TMR_TICK         timeout_tick;
+    NET_ERR              err;
+
+
+    p_conn     = (NET_TCP_CONN *)p_conn_timeout;
+
+    close_code =  NET_TCP_CONN_CLOSE_ALL;
+    DEF_BIT_CLR(close_code, NET_TCP_CONN_CLOSE_TMR_TX_PACE);    /* See Note #3b1.                                       */
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* ---------------- VALIDATE TCP CONN ----------------- */
+    if (p_conn == DEF_NULL) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NullPtrCtr);
+        return;
+    }
+#endif
+
+    switch (p_conn->ConnState) {
+        case NET_TCP_CONN_STATE_FREE:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
+             return;
+
+
+        case NET_TCP_CONN_STATE_CLOSED:
+        case NET_TCP_CONN_STATE_LISTEN:
+        case NET_TCP_CONN_STATE_SYNC_RXD:
+        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
+        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
+        case NET_TCP_CONN_STATE_SYNC_TXD:
+        case NET_TCP_CONN_STATE_FIN_WAIT_2:
+        case NET_TCP_CONN_STATE_TIME_WAIT:
+        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
+             p_conn->TxQ_PaceTmr = DEF_NULL;                    /* See Note #3a2A2.                                     */
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
+             return;
+
+
+        case NET_TCP_CONN_STATE_CONN:                           /* See Note #1.                                         */
+        case NET_TCP_CONN_STATE_FIN_WAIT_1:
+        case NET_TCP_CONN_STATE_CLOSING:
+        case NET_TCP_CONN_STATE_CLOSE_WAIT:
+        case NET_TCP_CONN_STATE_LAST_ACK:
+             switch (p_conn->TxQ_State) {
+                 case NET_TCP_TX_Q_STATE_CONN:
+                 case NET_TCP_TX_Q_STATE_CLOSING:
+                      break;
+
+
+                 case NET_TCP_TX_Q_STATE_SUSPEND:               /* See Note #4.                                         */
+                 case NET_TCP_TX_Q_STATE_CLOSING_SUSPEND:
+                      timeout_tick        = (NET_TMR_TICK)1u;
+                      p_conn->TxQ_PaceTmr =  NET_TCP_TMR_GET((CPU_FNCT_PTR )&NetTCP_TxConnTxQ_TimeoutPace,
+                                                             (void        *) p_conn,
+                                                             (NET_TMR_TICK ) timeout_tick,
+                                                             (NET_ERR     *)&err);
+                     (void)&err;                                /* Ignore transitory rsrc err(s) [see Note #4].         */
+                      return;
+
+
+                 case NET_TCP_TX_Q_STATE_NONE:
+                 case NET_TCP_TX_Q_STATE_CLOSED:
+                 case NET_TCP_TX_Q_STATE_CLOSED_SUSPEND:
+                 default:
+                      p_conn->TxQ_PaceTmr = DEF_NULL;           /* See Note #3a2A2.                                     */
+                      return;
+             }
+             break;
+
+
+        case NET_TCP_CONN_STATE_NONE:
+        default:
+             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                              (NET_BUF_HDR      *)0,
+                              (CPU_BOOLEAN       )DEF_YES,
+                              (NET_TCP_CLOSE_CODE)close_code);
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
+             return;
+    }
+
+
+                                                                /* -------- HANDLE TCP CONN TX Q PACING TIMEOUT ------- */
+    p_conn->TxQ_PaceTmr = DEF_NULL;                             /* Clr tx Q pacing tmr (see Note #3a2A1).               */
+
+    NetTCP_TxConnTxQ(p_conn,                                    /* Tx Q data           (see Note #2).                   */
+                     0,
+                     NET_TCP_CONN_TX_ACK_NONE,
+                     DEF_NO,
+                     close_code,
+                     DEF_NO,
+                    &err);                                      /* Ignore ALL tx err(s), transitory or fatal.           */
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        NetTCP_TxConnReTxQ()
@@ -25987,6 +30779,7 @@ static  void  NetTCP_TxConnTxQ_TimeoutSillyWin (void  *p_conn_timeout)
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing                timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
@@ -26296,6 +31089,22 @@ static  void  NetTCP_TxConnTxQ_TimeoutSillyWin (void  *p_conn_timeout)
 *
 *                   See also 'NetTCP_TxConnAppData()  Note #10'
 *                          & 'NetTCP_TxConnTxQ()      Note #14'.
+*
+*              (12) A segment that references external application data (see 'NetTCP_TxConnAppData()
+*                   Note #12') is copied into its network buffer before re-transmission.  A partially-
+*                   acknowledged segment's data index no longer matches the referenced data & the
+*                   re-transmit data move (see Note #8b2B1b) requires the data in the buffer.  Since
+*                   re-transmits are infrequent, the copy also releases the application's data early.
+*
+*              (13) If path MTU discovery is enabled (see 'net_tcp.h  TCP PATH MTU DISCOVERY DEFINES') :
+*
+*                   (a) A segment re-transmitted on repeated re-transmit queue timeouts reduces the TCP
+*                       connection's path maximum segment size (see 'net_tcp.h  TCP PATH MTU DISCOVERY
+*                       DEFINES  Note #2').
+*
+*                   (b) A segment larger than the TCP connection's reduced maximum segment size is re-
+*                       transmitted WITHOUT the IPv4 'Don't Fragment' flag; all other IPv4 data segments
+*                       are re-transmitted with the IPv4 'Don't Fragment' flag set.
 *********************************************************************************************************
 */
 
@@ -26344,6 +31153,9 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
     CPU_BOOLEAN              seg_chngd;
     CPU_BOOLEAN              seg_updated;
     CPU_BOOLEAN              seg_data_moved;
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+    CPU_BOOLEAN              seg_path_mtu;
+#endif
     CPU_BOOLEAN              tx_lock;
     NET_PROTOCOL_TYPE        proto_type = NET_PROTOCOL_TYPE_NONE;
     NET_ERR                  err;
@@ -26377,6 +31189,12 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
 #if 0                                                           /* Implemented with backoff     (see Note #2b2A2).      */
                                                                 /* ... & reset RTT ctrls        (see Note #2b2A2).      */
         NetTCP_TxConnRTT_RTO_Calc(p_conn, NET_TCP_CONN_TX_RTT_RESET,   NET_TCP_TX_RTT_NONE, NET_TCP_TX_RTT_NONE);
+#endif
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+                                                                /* ... & chk path MTU black hole (see Note #13a).       */
+        if (pseg_hdr->TCP_SegReTxCtr == NET_TCP_PATH_MTU_BLACK_HOLE_RE_TX_TH) {
+            NetTCP_ConnPathMTU_BlackHole(p_conn, pseg_hdr->TCP_SegLenData);
+        }
 #endif
     }
                                                                 /* Update re-tx Q tmr (see Note #2b1A1).                */
@@ -26408,6 +31226,21 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
         return;
     }
 
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+                                                                /* --------------- COPY RE-TX SEG'S DATA -------------- */
+    if (pseg_hdr->DataExtRefPtr != DEF_NULL) {                  /* If seg refs ext app data, ...                        */
+        NetBuf_DataExtCopy(pseg, &err);                         /* ... copy data into seg buf (see Note #12).           */
+        if (err != NET_BUF_ERR_NONE) {                          /* See Note #11a.                                       */
+            NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                             (NET_BUF_HDR      *)0,
+                             (CPU_BOOLEAN       )DEF_YES,
+                             (NET_TCP_CLOSE_CODE)close_code);
+           *p_err = NET_TCP_ERR_CONN_FAULT;
+            return;
+        }
+    }
+#endif
+
     conn_id = p_conn->ID_Conn;
     if_nbr  = NetConn_IF_NbrGet(conn_id, &err);
     if ((err    != NET_CONN_ERR_NONE) &&
@@ -26514,7 +31347,7 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
 
     seg_len     = pseg_hdr->TCP_SegLen;
                                                                 /* Prepare TCP win size.                                */
-    win_size    = p_conn->RxWinSizeActual;
+    win_size    = NetTCP_TxConnWinSizeHdrGet(p_conn, pseg_hdr->TCP_Flags);
 
                                                                 /* Chk for re-tx seg update (see Note #7).              */
     seg_updated = ((pseg_hdr->TCP_SeqNbrLast  != seq_nbr ) ||
@@ -26525,6 +31358,13 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
     seg_chngd   = ((seg_updated    != DEF_NO) ||
                    (seg_data_moved != DEF_NO)) ? DEF_YES : DEF_NO;
 
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN                              /* Chk for seg > path MSS (see Note #13b).              */
+    seg_path_mtu = (pseg_hdr->TCP_SegLenData > p_conn->MaxSegSizeConn) ? DEF_YES : DEF_NO;
+    if (seg_path_mtu != DEF_NO) {
+        seg_chngd = DEF_YES;
+    }
+#endif
+
 
     if (seg_chngd != DEF_NO) {                                  /* If chng'd, prepare seg for re-tx (see Note #1c2).    */
                                                                 /* Prepare TCP seg addrs.                               */
@@ -26558,6 +31398,12 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
                *p_err  = NET_TCP_ERR_CONN_FAULT;
                 return;
             }
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+            if ((pseg_hdr->TCP_SegLenData > 0u) &&              /* Set DF on data segs that fit MSS (see Note #13b).    */
+                (seg_path_mtu             == DEF_NO)) {
+                DEF_BIT_SET(flags_ipv4, NET_IPv4_FLAG_TX_DONT_FRAG);
+            }
+#endif
 #endif
         } else {
 #ifdef  NET_IPv6_MODULE_EN
@@ -26777,6 +31623,16 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
 *                            'NetTCP_TxConnTxQ_TimeoutIdle()        Note #5',
 *                            'NetTCP_TxConnTxQ_TimeoutSillyWin()    Note #5',
 *                          & 'NetTCP_TxConnWinSizeZeroWinTimeout()  Note #5'.
+*
+*               (6) If the re-transmit queue timer was armed with the tail loss probe timeout, a tail loss
+*                   probe is transmitted instead :
+*
+*                   (a) The segment at the head of the re-transmit queue is re-transmitted WITHOUT backing
+*                       off the re-transmit timeout NOR reducing the transmit congestion window.
+*
+*                   (b) The re-transmit queue timer is re-armed with the re-transmit timeout.
+*
+*                   See also 'net_tcp.h  TCP RACK-TLP DEFINES  Note #2'.
 *********************************************************************************************************
 */
 
@@ -26792,254 +31648,875 @@ static  void  NetTCP_TxConnReTxQ_Timeout (void  *p_conn_timeout)
     close_code =  NET_TCP_CONN_CLOSE_ALL;
     DEF_BIT_CLR(close_code, NET_TCP_CONN_CLOSE_TMR_RE_TX);      /* See Note #4b1.                                       */
 
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* ---------------- VALIDATE TCP CONN ----------------- */
-    if (p_conn == DEF_NULL) {
-        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NullPtrCtr);
-        return;
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* ---------------- VALIDATE TCP CONN ----------------- */
+    if (p_conn == DEF_NULL) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NullPtrCtr);
+        return;
+    }
+
+    switch (p_conn->ConnState) {
+        case NET_TCP_CONN_STATE_FREE:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
+             return;
+
+
+        case NET_TCP_CONN_STATE_CLOSED:
+        case NET_TCP_CONN_STATE_LISTEN:
+        case NET_TCP_CONN_STATE_FIN_WAIT_2:
+        case NET_TCP_CONN_STATE_TIME_WAIT:
+        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
+             p_conn->ReTxQ_Tmr = DEF_NULL;                      /* See Note #4a2A2.                                     */
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
+             return;
+
+
+        case NET_TCP_CONN_STATE_SYNC_RXD:                       /* See Note #1b1.                                       */
+        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
+        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
+        case NET_TCP_CONN_STATE_SYNC_TXD:
+             switch (p_conn->TxQ_State) {
+                 case NET_TCP_TX_Q_STATE_CLOSED:
+                      break;
+
+
+                 case NET_TCP_TX_Q_STATE_NONE:
+                 case NET_TCP_TX_Q_STATE_CONN:
+                 case NET_TCP_TX_Q_STATE_SUSPEND:
+                 case NET_TCP_TX_Q_STATE_CLOSING:
+                 case NET_TCP_TX_Q_STATE_CLOSING_SUSPEND:
+                 case NET_TCP_TX_Q_STATE_CLOSED_SUSPEND:
+                 default:
+                      p_conn->ReTxQ_Tmr = DEF_NULL;             /* See Note #4a2A2.                                     */
+                      return;
+             }
+             break;
+
+
+        case NET_TCP_CONN_STATE_CONN:                           /* See Note #1b2.                                       */
+        case NET_TCP_CONN_STATE_FIN_WAIT_1:
+        case NET_TCP_CONN_STATE_CLOSING:
+        case NET_TCP_CONN_STATE_CLOSE_WAIT:
+        case NET_TCP_CONN_STATE_LAST_ACK:
+             switch (p_conn->TxQ_State) {
+                 case NET_TCP_TX_Q_STATE_CONN:
+                 case NET_TCP_TX_Q_STATE_SUSPEND:               /* See Note #5.                                         */
+                 case NET_TCP_TX_Q_STATE_CLOSING:
+                 case NET_TCP_TX_Q_STATE_CLOSING_SUSPEND:
+                      break;
+
+
+                 case NET_TCP_TX_Q_STATE_NONE:
+                 case NET_TCP_TX_Q_STATE_CLOSED:
+                 case NET_TCP_TX_Q_STATE_CLOSED_SUSPEND:
+                 default:
+                      p_conn->ReTxQ_Tmr = DEF_NULL;             /* See Note #4a2A2.                                     */
+                      return;
+             }
+             break;
+
+
+        case NET_TCP_CONN_STATE_NONE:
+        default:
+             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                              (NET_BUF_HDR      *)0,
+                              (CPU_BOOLEAN       )DEF_YES,
+                              (NET_TCP_CLOSE_CODE)close_code);
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
+             return;
+    }
+#endif
+
+
+                                                                /* --------- HANDLE TCP CONN RE-TX Q TIMEOUT ---------- */
+    p_conn->ReTxQ_Tmr = DEF_NULL;                               /* Clr    re-tx Q tmr (see Note #4a2A1).                */
+
+#ifdef  NET_TCP_RACK_MODULE_EN
+    if (p_conn->TxTLP_Armed == DEF_YES) {                       /* If TLP timeout, ...                                  */
+        p_conn->TxTLP_Armed = DEF_NO;
+        p_conn->TxTLP_Txd   = DEF_YES;
+        NetTCP_TxConnReTxQ(p_conn, DEF_NO, close_code, &err);   /* ... tx TLP probe   (see Note #6).                    */
+       (void)&err;                                              /* Ignore ALL re-tx err(s), transitory or fatal.        */
+        return;
+    }
+#endif
+
+    NetTCP_TxConnReTxQ(p_conn, DEF_YES, close_code, &err);      /* Handle re-tx Q     (see Note #2).                    */
+   (void)&err;                                                  /* Ignore ALL re-tx err(s), transitory or fatal.        */
+}
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_TxConnReTxQ_TimeoutSet()
+*
+* Description : (1) (a) Set TCP connection's re-transmit queue timer for the following synchronization/
+*                       connected states :
+*
+*                       (1) CLOSED
+*                       (2) LISTEN
+*                       (3) SYN-RECEIVED
+*                       (4) SYN-SENT
+*                       (5) ESTABLISHED
+*                       (6) FIN-WAIT-1
+*                       (7) CLOSING
+*                       (8) CLOSE-WAIT
+*                       (9) LAST-ACK
+*
+*                           (A) (1) RFC #793, Section 3.9 'Event Processing : USER TIMEOUT : RETRANSMISSION
+*                               TIMEOUT' reiterates that "for any state if the retransmission timeout expires
+*                               on a segment in the retransmission queue ... reinitialize the retransmission
+*                               timer".
+*
+*                   (b) However, since a TCP connection's transmit & re-transmit queue SHOULD be closed for
+*                       the following states, it does NOT seem reasonable to set or reset a TCP connection's
+*                       re-transmit queue timer for these states :
+*
+*                       (1) FIN-WAIT-2
+*                       (2) TIME-WAIT
+*
+*
+* Argument(s) : p_conn               Pointer to a TCP connection.
+*               -----               Argument validated in NetTCP_TxConnSync(),
+*                                                         NetTCP_TxConnTxQ(),
+*                                                         NetTCP_TxConnReTxQ(),
+*                                                         NetTCP_RxPktConnHandlerReTxQ().
+*
+*               re_tx_q_timeout     Indicate whether the TCP connection re-transmit queue timed out :
+*
+*                                       DEF_NO                      TCP connection re-transmit queue did
+*                                                                       NOT time  out.
+*                                       DEF_YES                     TCP connection re-transmit queue
+*                                                                           timed out.
+*
+*               close_code      Select which close action(s) to perform; bit-field flags logically OR'd :
+*
+*                                   NET_TCP_CONN_CLOSE_NONE                 Perform NO  close actions.
+*                                   NET_TCP_CONN_CLOSE_ALL                  Perform ALL close actions.
+*
+*                                   NET_TCP_CONN_CLOSE_CONN_TX_RESET        Perform close connection transmit reset.
+*                                   NET_TCP_CONN_CLOSE_CONN_ALL             Perform ALL   connection close    actions.
+*
+*                                   NET_TCP_CONN_CLOSE_TMR_TIMEOUT          Close connection                        timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_IDLE          Close    transmit idle                  timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_SILLY_WIN     Close    transmit silly window persist  timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing                timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
+*
+*                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                    TCP connection re-transmit queue timer
+*                                                                       successfully set.
+*                               NET_TCP_ERR_CONN_NOT_USED           TCP connection NOT currently used.
+*                               NET_TCP_ERR_CONN_FAULT              TCP connection fault; connection(s) aborted.
+*                               NET_TCP_ERR_INVALID_CONN_STATE      Invalid TCP connection state.
+*                               NET_TCP_ERR_INVALID_CONN_OP         Invalid TCP connection operation.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnSync(),
+*               NetTCP_TxConnTxQ(),
+*               NetTCP_TxConnReTxQ(),
+*               NetTCP_RxPktConnHandlerReTxQ().
+*
+* Note(s)     : (2) If RACK-TLP is enabled, the re-transmit queue timer MAY be armed with the shorter tail
+*                   loss probe timeout (see 'NetTCP_TxConnTLP_TimeoutGet()  Note #1').
+*********************************************************************************************************
+*/
+
+static  void  NetTCP_TxConnReTxQ_TimeoutSet (NET_TCP_CONN        *p_conn,
+                                             CPU_BOOLEAN          re_tx_q_timeout,
+                                             NET_TCP_CLOSE_CODE   close_code,
+                                             NET_ERR             *p_err)
+{
+    NET_TMR_TICK  timeout_tick;
+    NET_ERR       err;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* ------------- VALIDATE TCP CONN STATE -------------- */
+    switch (p_conn->ConnState) {
+        case NET_TCP_CONN_STATE_FREE:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
+            *p_err = NET_TCP_ERR_CONN_NOT_USED;
+             return;
+
+
+        case NET_TCP_CONN_STATE_FIN_WAIT_2:                     /* See Note #1b.                                        */
+        case NET_TCP_CONN_STATE_TIME_WAIT:
+        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
+            *p_err = NET_TCP_ERR_INVALID_CONN_OP;
+             return;
+
+
+        case NET_TCP_CONN_STATE_CLOSED:                         /* See Note #1a.                                        */
+        case NET_TCP_CONN_STATE_LISTEN:
+        case NET_TCP_CONN_STATE_SYNC_RXD:
+        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
+        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
+        case NET_TCP_CONN_STATE_SYNC_TXD:
+        case NET_TCP_CONN_STATE_CONN:
+        case NET_TCP_CONN_STATE_FIN_WAIT_1:
+        case NET_TCP_CONN_STATE_CLOSING:
+        case NET_TCP_CONN_STATE_CLOSE_WAIT:
+        case NET_TCP_CONN_STATE_LAST_ACK:
+             break;
+
+
+        case NET_TCP_CONN_STATE_NONE:
+        default:
+             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                              (NET_BUF_HDR      *)0,
+                              (CPU_BOOLEAN       )DEF_YES,
+                              (NET_TCP_CLOSE_CODE)close_code);
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
+            *p_err = NET_TCP_ERR_INVALID_CONN_STATE;
+             return;
+    }
+#endif
+
+
+                                                                /* ------------- SET TCP CONN RE-TX Q TMR ------------- */
+#ifdef  NET_TCP_RACK_MODULE_EN                                  /* Get re-tx Q timeout (see Note #2).                   */
+    timeout_tick = NetTCP_TxConnTLP_TimeoutGet(p_conn, re_tx_q_timeout);
+#else
+    timeout_tick = p_conn->TxRTT_RTO_tick;
+#endif
+
+    if ((p_conn->ReTxQ_Tmr != DEF_NULL) &&                      /* If re-tx Q tmr avail  ..                             */
+        (re_tx_q_timeout  ==  DEF_NO)) {                        /* .. but NOT timed out, ..                             */
+        NetTmr_Set((NET_TMR    *) p_conn->ReTxQ_Tmr,            /* .. reset re-tx Q tmr.                                */
+                   (CPU_FNCT_PTR)&NetTCP_TxConnReTxQ_Timeout,
+                   (NET_TMR_TICK) timeout_tick,
+                   (NET_ERR    *)&err);
+    } else {                                                    /* Else get re-tx Q tmr.                                */
+        p_conn->ReTxQ_Tmr = NET_TCP_TMR_GET((CPU_FNCT_PTR )&NetTCP_TxConnReTxQ_Timeout,
+                                           (void        *) p_conn,
+                                           (NET_TMR_TICK ) timeout_tick,
+                                           (NET_ERR     *)&err);
+    }
+
+    if (err != NET_TMR_ERR_NONE) {
+        NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                         (NET_BUF_HDR      *)0,
+                         (CPU_BOOLEAN       )p_conn->ConnCloseAppFlag,
+                         (NET_TCP_CLOSE_CODE)close_code);
+       *p_err = NET_TCP_ERR_CONN_FAULT;
+        return;
+    }
+
+
+   *p_err = NET_TCP_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_TxConnReTxQ_IdxAdd()
+*
+* Description : Add a segment to the tail of TCP connection's re-transmit queue index.
+*
+* Argument(s) : p_conn       Pointer to TCP connection.
+*               -----       Argument validated in NetTCP_TxConnTxQ(),
+*                                                 NetTCP_TxConnReTxQ_IdxBuild().
+*
+*               p_seg        Pointer to segment appended to TCP connection's re-transmit queue.
+*               -----       Argument validated in NetTCP_TxConnTxQ(),
+*                                                 NetTCP_TxConnReTxQ_IdxBuild().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnTxQ(),
+*               NetTCP_TxConnReTxQ_IdxBuild().
+*
+* Note(s)     : (1) If the re-transmit queue index is full, the segment & ALL subsequent segments are NOT
+*                   indexed until the index is rebuilt (see 'net_tcp.h  TCP RE-TRANSMIT QUEUE INDEX DEFINES
+*                   Note #3').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+static  void  NetTCP_TxConnReTxQ_IdxAdd (NET_TCP_CONN  *p_conn,
+                                         NET_BUF       *p_seg)
+{
+    NET_BUF_HDR  *p_seg_hdr;
+    CPU_INT32U    ix;
+
+
+    if ((p_conn->ReTxQ_IdxOvf == DEF_YES) ||                    /* If idx ovf'd or full, ...                            */
+        (p_conn->ReTxQ_IdxNbr >= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY)) {
+         p_conn->ReTxQ_IdxOvf  = DEF_YES;                       /* ... do NOT idx seg (see Note #1).                    */
+         return;
+    }
+
+    ix = (CPU_INT32U)p_conn->ReTxQ_IdxHead + (CPU_INT32U)p_conn->ReTxQ_IdxNbr;
+    if (ix >= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY) {
+        ix -= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY;
+    }
+
+    p_seg_hdr                      = &p_seg->Hdr;
+    p_conn->ReTxQ_Idx[ix].SegPtr    =  p_seg;
+    p_conn->ReTxQ_Idx[ix].SeqNbrEnd =  p_seg_hdr->TCP_SeqNbr + p_seg_hdr->TCP_SegLen;
+    p_conn->ReTxQ_IdxNbr++;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_TxConnReTxQ_IdxBuild()
+*
+* Description : (Re-)build TCP connection's re-transmit queue index from its re-transmit queue.
+*
+* Argument(s) : p_conn       Pointer to TCP connection.
+*               -----       Argument validated in NetTCP_RxPktConnHandlerReTxQ(),
+*                                                 NetTCP_TxConnSync().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerReTxQ(),
+*               NetTCP_TxConnSync().
+*
+* Note(s)     : (1) Segments are indexed from the head of the re-transmit queue until the index is full
+*                   (see 'net_tcp.h  TCP RE-TRANSMIT QUEUE INDEX DEFINES  Note #3b').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+static  void  NetTCP_TxConnReTxQ_IdxBuild (NET_TCP_CONN  *p_conn)
+{
+    NET_BUF      *p_seg;
+    NET_BUF_HDR  *p_seg_hdr;
+
+
+    p_conn->ReTxQ_IdxHead = 0u;
+    p_conn->ReTxQ_IdxNbr  = 0u;
+    p_conn->ReTxQ_IdxOvf  = DEF_NO;
+
+    p_seg = p_conn->ReTxQ_Head;
+    while ((p_seg                != DEF_NULL) &&                /* Idx re-tx Q segs until idx full (see Note #1).       */
+           (p_conn->ReTxQ_IdxOvf == DEF_NO)) {
+        NetTCP_TxConnReTxQ_IdxAdd(p_conn, p_seg);
+        p_seg_hdr = &p_seg->Hdr;
+        p_seg     = p_seg_hdr->NextPrimListPtr;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_TxConnReTxQ_IdxRemove()
+*
+* Description : Remove fully acknowledged segments from TCP connection's re-transmit queue index.
+*
+* Argument(s) : p_conn          Pointer to TCP connection.
+*               -----          Argument validated in NetTCP_RxPktConnHandlerReTxQ().
+*
+*               p_buf_hdr       Pointer to received packet's network buffer header.
+*               ---------      Argument validated in NetTCP_RxPktConnHandlerReTxQ().
+*
+*               p_seg_prev      Pointer to variable that will receive the last fully acknowledged segment.
+*
+*               p_seg_len_data  Pointer to variable to increment by the fully acknowledged segments' data
+*                                   length.
+*
+* Return(s)   : Pointer to first re-transmit queue segment NOT fully acknowledged, if any.
+*
+*               Pointer to NULL,                                                   otherwise.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerReTxQ().
+*
+* Note(s)     : (1) Fully acknowledged segments are located by a binary search of the index entries' end
+*                   sequence numbers (see 'net_tcp.h  TCP RE-TRANSMIT QUEUE INDEX DEFINES  Note #2a').  An
+*                   entry's segment is fully acknowledged if :
+*
+*                       (SND.NXT - SEG.ACK)  <=  (SND.NXT - Entry.SeqNbrEnd)
+*
+*                   See also 'NetTCP_RxPktConnHandlerReTxQ()  Note #9b1'.
+*
+*               (2) Since ONLY the first indexed segment may carry a synchronization & ONLY the last segment
+*                   may carry a close, the fully acknowledged segments' data length is calculated from the
+*                   first & last fully acknowledged segments ONLY.  The data length spans ALL fully
+*                   acknowledged segments & MAY thus exceed the maximum segment size with scaled windows.
+*
+*               (3) The fully acknowledged segments are NOT unlinked from the re-transmit queue; the caller
+*                   unlinks & frees ALL fully acknowledged segments as a single list of segments.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+static  NET_BUF  *NetTCP_TxConnReTxQ_IdxRemove (NET_TCP_CONN       *p_conn,
+                                                NET_BUF_HDR        *p_buf_hdr,
+                                                NET_BUF           **p_seg_prev,
+                                                NET_TCP_WIN_SIZE   *p_seg_len_data)
+{
+    NET_TCP_SEQ_NBR    ack_delta_next;
+    NET_TCP_SEQ_NBR    seq_delta_next;
+    NET_TCP_WIN_SIZE   seg_len_data;
+    NET_BUF           *p_seg_first;
+    NET_BUF           *p_seg_last;
+    NET_BUF_HDR       *p_seg_first_hdr;
+    NET_BUF_HDR       *p_seg_last_hdr;
+    CPU_INT32U         ix;
+    CPU_INT32U         ix_lo;
+    CPU_INT32U         ix_hi;
+    CPU_INT32U         ix_mid;
+    CPU_INT32U         nbr_ackd;
+
+
+                                                                /* ------------ SRCH FOR FULLY ACK'D SEGS ------------- */
+    ack_delta_next = p_conn->TxSeqNbrNext - p_buf_hdr->TCP_AckNbr;
+    ix_lo          = 0u;
+    ix_hi          = p_conn->ReTxQ_IdxNbr;
+    while (ix_lo < ix_hi) {                                     /* Binary srch idx (see Note #1).                       */
+        ix_mid = ix_lo + ((ix_hi - ix_lo) / 2u);
+        ix     = p_conn->ReTxQ_IdxHead + ix_mid;
+        if (ix >= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY) {
+            ix -= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY;
+        }
+        seq_delta_next = p_conn->TxSeqNbrNext - p_conn->ReTxQ_Idx[ix].SeqNbrEnd;
+        if (ack_delta_next <= seq_delta_next) {                 /* If seg fully ack'd, srch upper half; ...             */
+            ix_lo = ix_mid + 1u;
+        } else {                                                /* ... else            srch lower half.                 */
+            ix_hi = ix_mid;
+        }
+    }
+
+    nbr_ackd = ix_lo;
+    if (nbr_ackd < 1u) {                                        /* If NO segs fully ack'd, rtn re-tx Q head.            */
+        return (p_conn->ReTxQ_Head);
+    }
+
+
+                                                                /* ------------- CALC ACK'D SEG DATA LEN -------------- */
+    ix = p_conn->ReTxQ_IdxHead + nbr_ackd - 1u;
+    if (ix >= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY) {
+        ix -= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY;
+    }
+    p_seg_first     =  p_conn->ReTxQ_Idx[p_conn->ReTxQ_IdxHead].SegPtr;
+    p_seg_first_hdr = &p_seg_first->Hdr;
+    p_seg_last      =  p_conn->ReTxQ_Idx[ix].SegPtr;
+    p_seg_last_hdr  = &p_seg_last->Hdr;
+                                                                /* See Note #2.                                         */
+    seg_len_data    = (NET_TCP_WIN_SIZE)(p_conn->ReTxQ_Idx[ix].SeqNbrEnd - p_seg_first_hdr->TCP_SeqNbr);
+    if (p_seg_first_hdr->TCP_SegSync == DEF_YES) {
+        if (seg_len_data >= NET_TCP_SEG_LEN_SYNC) {
+            seg_len_data -= NET_TCP_SEG_LEN_SYNC;
+        }
+    }
+    if (p_seg_last_hdr->TCP_SegClose == DEF_YES) {
+        if (seg_len_data >= NET_TCP_SEG_LEN_CLOSE) {
+            seg_len_data -= NET_TCP_SEG_LEN_CLOSE;
+        }
+    }
+   *p_seg_len_data += seg_len_data;
+
+
+#ifdef  NET_TCP_RACK_MODULE_EN                                  /* ----------- UPDATE RACK FROM ACK'D SEGS ------------ */
+    ix = p_conn->ReTxQ_IdxHead;
+    for (ix_mid = 0u; ix_mid < nbr_ackd; ix_mid++) {
+        NetTCP_TxConnRACK_Update(p_conn, &p_conn->ReTxQ_Idx[ix].SegPtr->Hdr, p_buf_hdr->TCP_RTT_TS_Rxd_ms);
+        ix++;
+        if (ix >= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY) {
+            ix = 0u;
+        }
+    }
+#endif
+
+
+                                                                /* -------------------- UPDATE IDX -------------------- */
+    ix = p_conn->ReTxQ_IdxHead + nbr_ackd;
+    if (ix >= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY) {
+        ix -= NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY;
+    }
+    p_conn->ReTxQ_IdxHead  = (CPU_INT16U)ix;
+    p_conn->ReTxQ_IdxNbr  -= (CPU_INT16U)nbr_ackd;
+
+   *p_seg_prev = p_seg_last;                                    /* See Note #3.                                         */
+
+    return (p_seg_last_hdr->NextPrimListPtr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_TxConnRACK_Update()
+*
+* Description : Update TCP connection's RACK controls from an acknowledged re-transmit queue segment.
+*
+* Argument(s) : p_conn      Pointer to a TCP connection.
+*               ------      Argument validated in NetTCP_RxPktConnHandlerReTxQ().
+*
+*               p_seg_hdr   Pointer to acknowledged re-transmit queue segment's network buffer header.
+*               ---------   Argument validated in NetTCP_RxPktConnHandlerReTxQ().
+*
+*               ts_rxd_ms   Receive timestamp of the acknowledgement (in milliseconds).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerReTxQ().
+*
+* Note(s)     : (1) RACK tracks the most recently SENT acknowledged segment, NOT the most recently
+*                   acknowledged segment (see 'net_tcp.h  TCP RACK-TLP DEFINES  Note #1a').
+*
+*               (2) (a) A segment's transmit timestamp is updated whenever the segment is re-transmitted.
+*
+*                   (b) Therefore, if a re-transmitted segment is acknowledged in less than the minimum
+*                       round-trip time, the acknowledgement is assumed to be for the segment's original
+*                       transmission & does NOT update RACK.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RACK_MODULE_EN
+static  void  NetTCP_TxConnRACK_Update (NET_TCP_CONN          *p_conn,
+                                        NET_BUF_HDR           *p_seg_hdr,
+                                        NET_TCP_TX_RTT_TS_MS   ts_rxd_ms)
+{
+    NET_TCP_TX_RTT_TS_MS  ts_txd_ms;
+    NET_TCP_TIMEOUT_MS    rtt_ms;
+
+
+    ts_txd_ms = p_seg_hdr->TCP_RTT_TS_Txd_ms;
+    rtt_ms    = (NET_TCP_TIMEOUT_MS)(ts_rxd_ms - ts_txd_ms);
+
+    if ((p_seg_hdr->TCP_SegReTxCtr >  0u) &&                    /* If re-tx'd seg ack'd before min RTT, ...             */
+        (rtt_ms                    <  p_conn->TxRACK_RTT_Min_ms)) {
+        return;                                                 /* ... do NOT update RACK (see Note #2b).               */
+    }
+
+    if ((p_conn->TxRACK_TS_ms != NET_TCP_RACK_TS_NONE) &&       /* If seg sent before RACK seg, ...                     */
+        ((CPU_INT32S)(ts_txd_ms - p_conn->TxRACK_TS_ms) < 0)) {
+        return;                                                 /* ... do NOT update RACK (see Note #1).                */
+    }
+
+    p_conn->TxRACK_TS_ms  = ts_txd_ms;
+    p_conn->TxRACK_RTT_ms = rtt_ms;
+
+    if ((p_conn->TxRACK_RTT_Min_ms == NET_TCP_TX_RTT_NONE) ||   /* Update min RTT.                                      */
+        (p_conn->TxRACK_RTT_Min_ms >  rtt_ms)) {
+         p_conn->TxRACK_RTT_Min_ms  = rtt_ms;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   NetTCP_TxConnRACK_DetectLoss()
+*
+* Description : (1) Detect & re-transmit a lost segment at the head of a TCP connection's re-transmit queue :
+*
+*                   (a) End RACK loss recovery, if all sequences up to the recovery point are acknowledged
+*                   (b) Check whether the head segment is lost                          See Note #2
+*                   (c) Reduce transmit congestion window, once per loss recovery       See Note #3
+*                   (d) Re-transmit the head segment
+*
+*
+* Argument(s) : p_conn      Pointer to a TCP connection.
+*               ------      Argument validated in NetTCP_RxPktConnHandlerReTxQ().
+*
+*               ts_rxd_ms   Receive timestamp of the acknowledgement (in milliseconds).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                Lost segment check successful.
+*
+*                                                               - RETURNED BY NetTCP_TxConnReTxQ() : -
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*                               NET_TCP_ERR_CONN_FAULT          TCP connection fault; connection(s) aborted.
+*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
+*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
+*                               NET_TCP_ERR_TX_PKT              Transmit packet error.
+*                               NET_TCP_ERR_RE_TX_SEG_TH        Re-transmit threshold exceeded; connection closed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerReTxQ().
+*
+* Note(s)     : (2) See 'net_tcp.h  TCP RACK-TLP DEFINES  Note #1b'.
+*
+*               (3) RACK only changes how losses are detected, NOT how the TCP connection responds to them.
+*                   The transmit congestion window is reduced as for fast re-transmit, but only once for
+*                   all segments lost from the same transmit window.
+*
+*                   See also 'NetTCP_TxConnWinSizeHandlerCongCtrl()  Note #2c2B1'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RACK_MODULE_EN
+static  void  NetTCP_TxConnRACK_DetectLoss (NET_TCP_CONN          *p_conn,
+                                            NET_TCP_TX_RTT_TS_MS   ts_rxd_ms,
+                                            NET_ERR               *p_err)
+{
+    NET_BUF_HDR           *p_seg_hdr;
+    NET_TCP_TX_RTT_TS_MS   ts_txd_ms;
+    NET_TCP_TIMEOUT_MS     reo_win_ms;
+    NET_TCP_SEQ_NBR        ack_delta_next;
+    NET_TCP_SEQ_NBR        seq_delta_recover;
+
+
+                                                                /* ------------- CHK END OF LOSS RECOVERY ------------- */
+    if (p_conn->TxRACK_Recovery == DEF_YES) {
+        ack_delta_next    = p_conn->TxSeqNbrNext - p_conn->TxSeqNbrUnAckd;
+        seq_delta_recover = p_conn->TxSeqNbrNext - p_conn->TxRACK_RecoverSeqNbr;
+        if (ack_delta_next <= seq_delta_recover) {              /* If recovery point ack'd, end recovery.               */
+            p_conn->TxRACK_Recovery = DEF_NO;
+        }
     }
 
-    switch (p_conn->ConnState) {
-        case NET_TCP_CONN_STATE_FREE:
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
-             return;
+                                                                /* ----------------- CHK HEAD SEG LOST ---------------- */
+   *p_err = NET_TCP_ERR_NONE;
 
+    if (p_conn->ReTxQ_Head == DEF_NULL) {
+        return;
+    }
+    if (p_conn->TxRACK_TS_ms == NET_TCP_RACK_TS_NONE) {
+        return;
+    }
 
-        case NET_TCP_CONN_STATE_CLOSED:
-        case NET_TCP_CONN_STATE_LISTEN:
-        case NET_TCP_CONN_STATE_FIN_WAIT_2:
-        case NET_TCP_CONN_STATE_TIME_WAIT:
-        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
-             p_conn->ReTxQ_Tmr = DEF_NULL;                      /* See Note #4a2A2.                                     */
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
-             return;
+    p_seg_hdr = &p_conn->ReTxQ_Head->Hdr;
+    ts_txd_ms =  p_seg_hdr->TCP_RTT_TS_Txd_ms;
+    if ((CPU_INT32S)(p_conn->TxRACK_TS_ms - ts_txd_ms) <= 0) {  /* If head seg NOT sent before RACK seg, NOT lost.      */
+        return;
+    }
 
+    reo_win_ms = p_conn->TxRACK_RTT_Min_ms / NET_TCP_RACK_REO_WIN_DIV;
+    if ((NET_TCP_TIMEOUT_MS)(ts_rxd_ms - ts_txd_ms) < (p_conn->TxRACK_RTT_ms + reo_win_ms)) {
+        return;                                                 /* If head seg NOT yet overdue, NOT lost.               */
+    }
 
-        case NET_TCP_CONN_STATE_SYNC_RXD:                       /* See Note #1b1.                                       */
-        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
-        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
-        case NET_TCP_CONN_STATE_SYNC_TXD:
-             switch (p_conn->TxQ_State) {
-                 case NET_TCP_TX_Q_STATE_CLOSED:
-                      break;
+                                                                /* -------------- REDUCE TX CONG WIN ------------------ */
+    if (p_conn->TxRACK_Recovery == DEF_NO) {                    /* If NOT in recovery (see Note #3), ...                */
+        NetTCP_TxConnWinSizeCalcSlowStartTh(p_conn);            /* ... calc slow start th ...                           */
+                                                                /* ... & set cong win to slow start th.                 */
+        NetTCP_TxConnWinSizeCongSet(p_conn, NET_TCP_CONN_TX_WIN_CONG_SET_SLOW_START);
+        NetTCP_TxConnWinSizeUpdateAvail(p_conn);
 
+        p_conn->TxRACK_Recovery      = DEF_YES;
+        p_conn->TxRACK_RecoverSeqNbr = p_conn->TxSeqNbrNext;
+    }
 
-                 case NET_TCP_TX_Q_STATE_NONE:
-                 case NET_TCP_TX_Q_STATE_CONN:
-                 case NET_TCP_TX_Q_STATE_SUSPEND:
-                 case NET_TCP_TX_Q_STATE_CLOSING:
-                 case NET_TCP_TX_Q_STATE_CLOSING_SUSPEND:
-                 case NET_TCP_TX_Q_STATE_CLOSED_SUSPEND:
-                 default:
-                      p_conn->ReTxQ_Tmr = DEF_NULL;             /* See Note #4a2A2.                                     */
-                      return;
-             }
+                                                                /* ----------------- RE-TX LOST SEG ------------------- */
+    NetTCP_TxConnReTxQ(p_conn, DEF_NO, NET_TCP_CONN_CLOSE_ALL, p_err);
+    switch (*p_err) {
+        case NET_TCP_ERR_NONE:
              break;
 
 
-        case NET_TCP_CONN_STATE_CONN:                           /* See Note #1b2.                                       */
-        case NET_TCP_CONN_STATE_FIN_WAIT_1:
-        case NET_TCP_CONN_STATE_CLOSING:
-        case NET_TCP_CONN_STATE_CLOSE_WAIT:
-        case NET_TCP_CONN_STATE_LAST_ACK:
-             switch (p_conn->TxQ_State) {
-                 case NET_TCP_TX_Q_STATE_CONN:
-                 case NET_TCP_TX_Q_STATE_SUSPEND:               /* See Note #5.                                         */
-                 case NET_TCP_TX_Q_STATE_CLOSING:
-                 case NET_TCP_TX_Q_STATE_CLOSING_SUSPEND:
-                      break;
-
-
-                 case NET_TCP_TX_Q_STATE_NONE:
-                 case NET_TCP_TX_Q_STATE_CLOSED:
-                 case NET_TCP_TX_Q_STATE_CLOSED_SUSPEND:
-                 default:
-                      p_conn->ReTxQ_Tmr = DEF_NULL;             /* See Note #4a2A2.                                     */
-                      return;
-             }
+        case NET_ERR_TX:                                        /* Ignore transitory re-tx err(s).                      */
+        case NET_ERR_IF_LINK_DOWN:
+        case NET_ERR_TX_BUF_LOCK:
+            *p_err = NET_TCP_ERR_NONE;
              break;
 
 
-        case NET_TCP_CONN_STATE_NONE:
+        case NET_TCP_ERR_CONN_NOT_USED:
+        case NET_TCP_ERR_CONN_FAULT:
+        case NET_TCP_ERR_INVALID_CONN_STATE:
+        case NET_TCP_ERR_INVALID_CONN_OP:
+        case NET_TCP_ERR_TX_PKT:
+        case NET_TCP_ERR_RE_TX_SEG_TH:
+        case NET_ERR_IF_LOOPBACK_DIS:
         default:
-             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
-                              (NET_BUF_HDR      *)0,
-                              (CPU_BOOLEAN       )DEF_YES,
-                              (NET_TCP_CLOSE_CODE)close_code);
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
-             return;
+             break;
     }
-#endif
-
-
-                                                                /* --------- HANDLE TCP CONN RE-TX Q TIMEOUT ---------- */
-    p_conn->ReTxQ_Tmr = DEF_NULL;                               /* Clr    re-tx Q tmr (see Note #4a2A1).                */
-
-    NetTCP_TxConnReTxQ(p_conn, DEF_YES, close_code, &err);      /* Handle re-tx Q     (see Note #2).                    */
-   (void)&err;                                                  /* Ignore ALL re-tx err(s), transitory or fatal.        */
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                  NetTCP_TxConnReTxQ_TimeoutSet()
+*                                    NetTCP_TxConnTLP_TimeoutGet()
 *
-* Description : (1) (a) Set TCP connection's re-transmit queue timer for the following synchronization/
-*                       connected states :
+* Description : Get TCP connection's re-transmit queue timeout, armed as tail loss probe timeout if shorter.
 *
-*                       (1) CLOSED
-*                       (2) LISTEN
-*                       (3) SYN-RECEIVED
-*                       (4) SYN-SENT
-*                       (5) ESTABLISHED
-*                       (6) FIN-WAIT-1
-*                       (7) CLOSING
-*                       (8) CLOSE-WAIT
-*                       (9) LAST-ACK
+* Argument(s) : p_conn              Pointer to a TCP connection.
+*               ------              Argument validated in NetTCP_TxConnReTxQ_TimeoutSet().
 *
-*                           (A) (1) RFC #793, Section 3.9 'Event Processing : USER TIMEOUT : RETRANSMISSION
-*                               TIMEOUT' reiterates that "for any state if the retransmission timeout expires
-*                               on a segment in the retransmission queue ... reinitialize the retransmission
-*                               timer".
+*               re_tx_q_timeout     Indicate whether the TCP connection re-transmit queue timed out.
 *
-*                   (b) However, since a TCP connection's transmit & re-transmit queue SHOULD be closed for
-*                       the following states, it does NOT seem reasonable to set or reset a TCP connection's
-*                       re-transmit queue timer for these states :
+* Return(s)   : Re-transmit queue timeout (in 'NET_TMR_TICK' ticks).
 *
-*                       (1) FIN-WAIT-2
-*                       (2) TIME-WAIT
+* Caller(s)   : NetTCP_TxConnReTxQ_TimeoutSet().
 *
+* Note(s)     : (1) A tail loss probe timeout is armed ONLY if :
 *
-* Argument(s) : p_conn               Pointer to a TCP connection.
-*               -----               Argument validated in NetTCP_TxConnSync(),
-*                                                         NetTCP_TxConnTxQ(),
-*                                                         NetTCP_TxConnReTxQ(),
-*                                                         NetTCP_RxPktConnHandlerReTxQ().
+*                   (a) the TCP connection is established                   &
+*                   (b) the re-transmit queue did NOT time out              &
+*                   (c) NO tail loss probe is outstanding                   &
+*                   (d) NO loss recovery is in progress                     &
+*                   (e) a smoothed round-trip time has been measured.
 *
-*               re_tx_q_timeout     Indicate whether the TCP connection re-transmit queue timed out :
+*               (2) See 'net_tcp.h  TCP RACK-TLP DEFINES  Note #2a'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RACK_MODULE_EN
+static  NET_TMR_TICK  NetTCP_TxConnTLP_TimeoutGet (NET_TCP_CONN  *p_conn,
+                                                   CPU_BOOLEAN    re_tx_q_timeout)
+{
+    NET_TCP_TIMEOUT_MS  pto_ms;
+    NET_TMR_TICK        pto_tick;
+    NET_TMR_TICK        timeout_tick;
+
+
+    timeout_tick        = p_conn->TxRTT_RTO_tick;
+    p_conn->TxTLP_Armed = DEF_NO;
+
+                                                                /* ------------------ CHK TLP ELIGIBLE ---------------- */
+    if ((p_conn->ConnState         != NET_TCP_CONN_STATE_CONN)        ||
+        (re_tx_q_timeout           != DEF_NO)                         ||
+        (p_conn->TxTLP_Txd         != DEF_NO)                         ||
+        (p_conn->TxRACK_Recovery   != DEF_NO)                         ||
+        (p_conn->TxWinRxdAckDupCtr >= NET_TCP_FAST_RE_TX_ACK_DUP_TH)  ||
+        (p_conn->TxRTT_RTO_State   != NET_TCP_TX_RTT_RTO_STATE_CALC)) {
+        return (timeout_tick);                                  /* See Note #1.                                         */
+    }
+
+                                                                /* ------------------- CALC TLP PTO ------------------- */
+    pto_ms = p_conn->TxRTT_Avg_ms * NET_TCP_TLP_PTO_RTT_SCALAR;
+    if (p_conn->ReTxQ_Head == p_conn->ReTxQ_Tail) {             /* If only one seg outstanding, ...                     */
+        pto_ms += NET_TCP_TLP_PTO_ACK_DLY_MS;                   /* ... add remote ack dly (see Note #2).                */
+    }
+
+    pto_tick = ((NET_TMR_TICK)pto_ms * NET_TCP_TMR_TICK_PER_SEC) / DEF_TIME_NBR_mS_PER_SEC;
+    if (pto_tick < 1) {
+        pto_tick = 1u;
+    }
+
+    if (pto_tick < timeout_tick) {                              /* If PTO < RTO, arm re-tx Q tmr with PTO.              */
+        timeout_tick        = pto_tick;
+        p_conn->TxTLP_Armed = DEF_YES;
+    }
+
+    return (timeout_tick);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_TxConnTxPaceDlyGet()
 *
-*                                       DEF_NO                      TCP connection re-transmit queue did
-*                                                                       NOT time  out.
-*                                       DEF_YES                     TCP connection re-transmit queue
-*                                                                           timed out.
+* Description : (1) Get TCP connection's transmit pacing delay for a transmit queue segment :
 *
-*               close_code      Select which close action(s) to perform; bit-field flags logically OR'd :
+*                   (a) Calculate TCP connection transmit pacing rate                   See Note #2
+*                   (b) Refill    TCP connection transmit pacing tokens                 See Note #3
+*                   (c) Calculate transmit pacing delay until enough tokens accumulate
 *
-*                                   NET_TCP_CONN_CLOSE_NONE                 Perform NO  close actions.
-*                                   NET_TCP_CONN_CLOSE_ALL                  Perform ALL close actions.
 *
-*                                   NET_TCP_CONN_CLOSE_CONN_TX_RESET        Perform close connection transmit reset.
-*                                   NET_TCP_CONN_CLOSE_CONN_ALL             Perform ALL   connection close    actions.
+* Argument(s) : p_conn      Pointer to a TCP connection.
+*               ------      Argument validated in NetTCP_TxConnTxQ().
 *
-*                                   NET_TCP_CONN_CLOSE_TMR_TIMEOUT          Close connection                        timer.
-*                                   NET_TCP_CONN_CLOSE_TMR_TX_IDLE          Close    transmit idle                  timer.
-*                                   NET_TCP_CONN_CLOSE_TMR_TX_SILLY_WIN     Close    transmit silly window persist  timer.
-*                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
-*                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
-*                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
-*                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
+*               seg_len     Data length of the transmit queue segment (in octets).
 *
-*                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
+* Return(s)   : Transmit pacing delay (in TCP timer ticks), if segment must be delayed.
 *
-*               p_err        Pointer to variable that will receive the return error code from this function :
+*               0,                                          otherwise.
 *
-*                               NET_TCP_ERR_NONE                    TCP connection re-transmit queue timer
-*                                                                       successfully set.
-*                               NET_TCP_ERR_CONN_NOT_USED           TCP connection NOT currently used.
-*                               NET_TCP_ERR_CONN_FAULT              TCP connection fault; connection(s) aborted.
-*                               NET_TCP_ERR_INVALID_CONN_STATE      Invalid TCP connection state.
-*                               NET_TCP_ERR_INVALID_CONN_OP         Invalid TCP connection operation.
+* Caller(s)   : NetTCP_TxConnTxQ().
 *
-* Return(s)   : none.
+* Note(s)     : (2) See 'net_tcp.h  TCP TRANSMIT PACING DEFINES  Note #1'.
 *
-* Caller(s)   : NetTCP_TxConnSync(),
-*               NetTCP_TxConnTxQ(),
-*               NetTCP_TxConnReTxQ(),
-*               NetTCP_RxPktConnHandlerReTxQ().
+*                   (a) The congestion window is divided before it is scaled by the pacing gain so that the
+*                       pacing rate does NOT overflow for large, scaled congestion windows.
 *
-* Note(s)     : none.
+*               (3) (a) See 'net_tcp.h  TCP TRANSMIT PACING DEFINES  Note #2'.
+*
+*                   (b) Tokens are refilled at most once per millisecond, so no fractional tokens are lost.
+*
+*                   (c) A full burst is restored, without multiplying the elapsed time, once enough time
+*                       has elapsed to refill it, so that the token calculation does NOT overflow.
 *********************************************************************************************************
 */
 
-static  void  NetTCP_TxConnReTxQ_TimeoutSet (NET_TCP_CONN        *p_conn,
-                                             CPU_BOOLEAN          re_tx_q_timeout,
-                                             NET_TCP_CLOSE_CODE   close_code,
-                                             NET_ERR             *p_err)
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+static  NET_TMR_TICK  NetTCP_TxConnTxPaceDlyGet (NET_TCP_CONN      *p_conn,
+                                                 NET_TCP_SEG_SIZE   seg_len)
 {
-    NET_TMR_TICK  timeout_tick;
-    NET_ERR       err;
-
-
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* ------------- VALIDATE TCP CONN STATE -------------- */
-    switch (p_conn->ConnState) {
-        case NET_TCP_CONN_STATE_FREE:
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
-            *p_err = NET_TCP_ERR_CONN_NOT_USED;
-             return;
-
-
-        case NET_TCP_CONN_STATE_FIN_WAIT_2:                     /* See Note #1b.                                        */
-        case NET_TCP_CONN_STATE_TIME_WAIT:
-        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
-            *p_err = NET_TCP_ERR_INVALID_CONN_OP;
-             return;
-
-
-        case NET_TCP_CONN_STATE_CLOSED:                         /* See Note #1a.                                        */
-        case NET_TCP_CONN_STATE_LISTEN:
-        case NET_TCP_CONN_STATE_SYNC_RXD:
-        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
-        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
-        case NET_TCP_CONN_STATE_SYNC_TXD:
-        case NET_TCP_CONN_STATE_CONN:
-        case NET_TCP_CONN_STATE_FIN_WAIT_1:
-        case NET_TCP_CONN_STATE_CLOSING:
-        case NET_TCP_CONN_STATE_CLOSE_WAIT:
-        case NET_TCP_CONN_STATE_LAST_ACK:
-             break;
+    NET_TCP_TX_PACE_RATE  rate_ms;
+    NET_TCP_TX_PACE_RATE  rate_max_ms;
+    CPU_INT32U            gain_pct;
+    CPU_INT32U            tokens_req;
+    CPU_INT32U            dly_ms;
+    NET_TS_MS             ts_ms;
+    NET_TS_MS             ts_delta_ms;
+    NET_TMR_TICK          dly_tick;
+
+
+    if (p_conn->TxPaceRateCfgd == NET_TCP_TX_PACE_RATE_NONE) {  /* If tx pacing dis'd, tx seg.                          */
+        p_conn->TxPaceRate_ms = NET_TCP_TX_PACE_RATE_NONE;
+        return (0u);
+    }
 
+                                                                /* --------------- CALC TX PACING RATE ---------------- */
+    rate_ms = NET_TCP_TX_PACE_RATE_NONE;
+    if ((p_conn->TxRTT_RTO_State == NET_TCP_TX_RTT_RTO_STATE_CALC) &&
+        (p_conn->TxRTT_Avg_ms    >  0u)) {                      /* If SRTT calc'd, pace by cong win / SRTT.             */
+        gain_pct = (p_conn->TxWinSizeCongCalcdActual < p_conn->TxWinSizeSlowStartTh) ? NET_TCP_TX_PACE_GAIN_SLOW_START_PCT
+                                                                                     : NET_TCP_TX_PACE_GAIN_CONG_AVOID_PCT;
+                                                                /* See Note #2a.                                        */
+        rate_ms  = ((p_conn->TxWinSizeCongCalcdActual / 100u) * gain_pct) / p_conn->TxRTT_Avg_ms;
+        if (rate_ms < 1u) {
+            rate_ms = 1u;
+        }
+    }
 
-        case NET_TCP_CONN_STATE_NONE:
-        default:
-             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
-                              (NET_BUF_HDR      *)0,
-                              (CPU_BOOLEAN       )DEF_YES,
-                              (NET_TCP_CLOSE_CODE)close_code);
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
-            *p_err = NET_TCP_ERR_INVALID_CONN_STATE;
-             return;
+    if (p_conn->TxPaceRateCfgd != NET_TCP_TX_PACE_RATE_AUTO) {  /* If max rate cfg'd, limit pacing rate.                */
+        rate_max_ms = p_conn->TxPaceRateCfgd / DEF_TIME_NBR_mS_PER_SEC;
+        if (rate_max_ms < 1u) {
+            rate_max_ms = 1u;
+        }
+        if ((rate_ms == NET_TCP_TX_PACE_RATE_NONE) ||
+            (rate_ms >  rate_max_ms)) {
+             rate_ms  = rate_max_ms;
+        }
     }
-#endif
 
+    p_conn->TxPaceRate_ms = rate_ms;
+    if (rate_ms == NET_TCP_TX_PACE_RATE_NONE) {                 /* If NO pacing rate avail, tx seg.                     */
+        return (0u);
+    }
 
-                                                                /* ------------- SET TCP CONN RE-TX Q TMR ------------- */
-    timeout_tick = p_conn->TxRTT_RTO_tick;
+                                                                /* -------------- REFILL TX PACING TOKENS ------------- */
+    p_conn->TxPaceBurst = (CPU_INT32U)p_conn->MaxSegSizeConn * NET_TCP_TX_PACE_BURST_SEG_NBR;
 
-    if ((p_conn->ReTxQ_Tmr != DEF_NULL) &&                      /* If re-tx Q tmr avail  ..                             */
-        (re_tx_q_timeout  ==  DEF_NO)) {                        /* .. but NOT timed out, ..                             */
-        NetTmr_Set((NET_TMR    *) p_conn->ReTxQ_Tmr,            /* .. reset re-tx Q tmr.                                */
-                   (CPU_FNCT_PTR)&NetTCP_TxConnReTxQ_Timeout,
-                   (NET_TMR_TICK) timeout_tick,
-                   (NET_ERR    *)&err);
-    } else {                                                    /* Else get re-tx Q tmr.                                */
-        p_conn->ReTxQ_Tmr = NetTmr_Get((CPU_FNCT_PTR )&NetTCP_TxConnReTxQ_Timeout,
-                                      (void        *) p_conn,
-                                      (NET_TMR_TICK ) timeout_tick,
-                                      (NET_ERR     *)&err);
+    ts_ms       = NetUtil_TS_Get_ms();
+    ts_delta_ms = ts_ms - p_conn->TxPaceTS_ms;
+    if (ts_delta_ms > 0u) {                                     /* See Note #3b.                                        */
+        p_conn->TxPaceTS_ms = ts_ms;
+        if (ts_delta_ms >= (p_conn->TxPaceBurst / rate_ms)) {   /* See Note #3c.                                        */
+            p_conn->TxPaceTokens  = p_conn->TxPaceBurst;
+        } else {
+            p_conn->TxPaceTokens += rate_ms * ts_delta_ms;
+            if (p_conn->TxPaceTokens > p_conn->TxPaceBurst) {
+                p_conn->TxPaceTokens = p_conn->TxPaceBurst;
+            }
+        }
     }
 
-    if (err != NET_TMR_ERR_NONE) {
-        NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
-                         (NET_BUF_HDR      *)0,
-                         (CPU_BOOLEAN       )p_conn->ConnCloseAppFlag,
-                         (NET_TCP_CLOSE_CODE)close_code);
-       *p_err = NET_TCP_ERR_CONN_FAULT;
-        return;
+                                                                /* --------------- CALC TX PACING DLY ----------------- */
+    tokens_req = DEF_MIN((CPU_INT32U)seg_len, p_conn->TxPaceBurst);
+    if (p_conn->TxPaceTokens >= tokens_req) {                   /* If enough tokens avail, tx seg.                      */
+        return (0u);
     }
 
+    dly_ms   = ((tokens_req - p_conn->TxPaceTokens) + (rate_ms - 1u)) / rate_ms;
+    dly_tick = (((NET_TMR_TICK)dly_ms * NET_TCP_TMR_TICK_PER_SEC) + (DEF_TIME_NBR_mS_PER_SEC - 1u))
+             /    DEF_TIME_NBR_mS_PER_SEC;
+    if (dly_tick < 1u) {
+        dly_tick = 1u;
+    }
 
-   *p_err = NET_TCP_ERR_NONE;
+    return (dly_tick);
 }
+#endif
 
 
 /*
@@ -27529,7 +33006,7 @@ static  void  NetTCP_TxConnRTO_CfgMaxTimeout (NET_TCP_CONN  *p_conn)
 static  void  NetTCP_TxConnRTO_CalcUpdate (NET_TCP_CONN  *p_conn)
 {
     p_conn->TxRTT_RTO_sec  =  (NET_TCP_TIMEOUT_SEC)(p_conn->TxRTT_RTO_ms / DEF_TIME_NBR_mS_PER_SEC);
-    p_conn->TxRTT_RTO_tick = ((NET_TMR_TICK       ) p_conn->TxRTT_RTO_ms * NET_TMR_TIME_TICK_PER_SEC) / DEF_TIME_NBR_mS_PER_SEC;
+    p_conn->TxRTT_RTO_tick = ((NET_TMR_TICK       ) p_conn->TxRTT_RTO_ms * NET_TCP_TMR_TICK_PER_SEC) / DEF_TIME_NBR_mS_PER_SEC;
 }
 
 
@@ -28078,6 +33555,8 @@ static  void  NetTCP_TxConnRTT_RTO_Calc (NET_TCP_CONN          *p_conn,
 *
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_FAST_OPEN       TCP Fast Open            options configuration.
 *
 *               p_opts_ip    Pointer to one or more IP  options configuration data structures
 *                               (see Note #2c & 'net_ip.h  IP HEADER OPTION CONFIGURATION DATA TYPES') :
@@ -28336,6 +33815,8 @@ static  void  NetTCP_TxPktHandlerIPv4 (NET_BUF           *p_buf,
 *
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_FAST_OPEN       TCP Fast Open            options configuration.
 *
 *               p_opts_ip    Pointer to one or more IP  options configuration data structures
 *                               (see Note #2c & 'net_ip.h  IP HEADER OPTION CONFIGURATION DATA TYPES') :
@@ -28583,11 +34064,15 @@ static  void  NetTCP_TxPktHandlerIPv6 (NET_BUF                 *p_buf,
 *                               NET_TCP_FLAG_TX_PUSH            Set TCP 'PUSH'   flag.
 *                               NET_TCP_FLAG_TX_ACK             Set TCP 'ACK'    flag.
 *                               NET_TCP_FLAG_TX_URGENT          Set TCP 'URGENT' flag.
+*                               NET_TCP_FLAG_TX_ECN_ECHO        Set TCP 'ECE'    flag.
+*                               NET_TCP_FLAG_TX_CWR             Set TCP 'CWR'    flag.
 *
 *               p_opts_tcp   Pointer to one or more TCP options configuration data structures :
 *
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_FAST_OPEN       TCP Fast Open            options configuration.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
@@ -28709,6 +34194,10 @@ static  void  NetTCP_TxPktValidate (NET_BUF_HDR       *p_buf_hdr,
                 NET_TCP_FLAG_TX_PUSH  |
                 NET_TCP_FLAG_TX_ACK   |
                 NET_TCP_FLAG_TX_URGENT;
+#ifdef  NET_TCP_ECN_MODULE_EN
+    DEF_BIT_SET(flag_mask, (NET_TCP_FLAG_TX_ECN_ECHO |
+                            NET_TCP_FLAG_TX_CWR));
+#endif
                                                                 /* If any invalid flags req'd, rtn err.                 */
     if ((flags_tcp & (NET_TCP_FLAGS)~flag_mask) != NET_TCP_FLAG_NONE) {
         NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrFlagsCtr);
@@ -28768,6 +34257,8 @@ static  void  NetTCP_TxPktValidate (NET_BUF_HDR       *p_buf_hdr,
 *
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_FAST_OPEN       TCP Fast Open            options configuration.
 *
 *               flags_tcp   Flags to select TCP transmit options; bit-field flags logically OR'd :
 *
@@ -28797,6 +34288,8 @@ static  void  NetTCP_TxPktValidate (NET_BUF_HDR       *p_buf_hdr,
 *                   of each of the following TCP options may be configured for any one TCP segment :
 *
 *                   (a) NET_TCP_OPT_TYPE_MAX_SEG_SIZE
+*                   (b) NET_TCP_OPT_TYPE_WIN_SCALE
+*                   (c) NET_TCP_OPT_TYPE_FAST_OPEN
 *********************************************************************************************************
 */
 
@@ -28808,6 +34301,12 @@ static  void  NetTCP_TxPktValidateOpt (void           *p_opts_tcp,
     CPU_INT08U         opt_len_size;
     CPU_INT08U         opt_len;
     CPU_INT08U         opt_nbr_max_seg_size;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    CPU_INT08U         opt_nbr_win_scale;
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    CPU_INT08U         opt_nbr_fast_open;
+#endif
     NET_TCP_OPT_TYPE  *p_opt_cfg_type;
     void              *p_opt_cfg;
     void              *p_opt_next;
@@ -28815,6 +34314,12 @@ static  void  NetTCP_TxPktValidateOpt (void           *p_opts_tcp,
 
     opt_len_size         = 0u;
     opt_nbr_max_seg_size = 0u;
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    opt_nbr_win_scale    = 0u;
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    opt_nbr_fast_open    = 0u;
+#endif
     p_opt_cfg             = p_opts_tcp;
 
     while (p_opt_cfg  != (void *)0) {
@@ -28830,9 +34335,41 @@ static  void  NetTCP_TxPktValidateOpt (void           *p_opts_tcp,
 
                  NetTCP_TxPktValidateOptMaxSegSize(p_opt_cfg, &opt_len, &p_opt_next, flags_tcp, p_err);
                  break;
+
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+            case NET_TCP_OPT_TYPE_WIN_SCALE:                    /* ------------------ WIN SCALE OPT ------------------- */
+                 if (opt_nbr_win_scale > 0) {                   /* If > 1 win scale opt,    rtn err.                    */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+                     return;
+                 }
+                 opt_nbr_win_scale++;
+
+                 NetTCP_TxPktValidateOptWinScale(p_opt_cfg, &opt_len, &p_opt_next, flags_tcp, p_err);
+                 break;
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+            case NET_TCP_OPT_TYPE_FAST_OPEN:                    /* ------------------ FAST OPEN OPT ------------------- */
+                 if (opt_nbr_fast_open > 0) {                   /* If > 1 fast open opt,    rtn err.                    */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+                     return;
+                 }
+                 opt_nbr_fast_open++;
+
+                 NetTCP_TxPktValidateOptFastOpen(p_opt_cfg, &opt_len, &p_opt_next, flags_tcp, p_err);
+                 break;
+#endif
                                                                 /* --------------- UNSUPPORTED TCP OPTS --------------- */
                                                                 /* See Note #3b.                                        */
+#ifndef NET_TCP_WIN_SCALE_MODULE_EN
             case NET_TCP_OPT_TYPE_WIN_SCALE:
+#endif
+#ifndef NET_TCP_FAST_OPEN_MODULE_EN
+            case NET_TCP_OPT_TYPE_FAST_OPEN:
+#endif
             case NET_TCP_OPT_TYPE_SACK_PERMIT:
             case NET_TCP_OPT_TYPE_SACK:
             case NET_TCP_OPT_TYPE_ECHO_REQ:
@@ -28953,6 +34490,185 @@ static  void  NetTCP_TxPktValidateOptMaxSegSize (void            *p_opt_tcp,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  NetTCP_TxPktValidateOptWinScale()
+*
+* Description : Validate TCP Window Scale option configuration.
+*
+*               (1) See 'net_tcp.h  TCP WINDOW SCALE OPTION CONFIGURATION DATA TYPE' for valid TCP Window
+*                   Scale option configuration.
+*
+*               (2) Return option values.
+*
+*
+* Argument(s) : p_opt_tcp    Pointer to TCP Window Scale option configuration data structure.
+*               --------    Argument checked   in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_len    Pointer to variable that will receive the TCP Window Scale option length
+*               --------        (in octets).
+*
+*                           Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               ---------   Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               flags_tcp   Flags to select TCP transmit options; bit-field flags logically OR'd :
+*
+*                               NET_TCP_FLAG_NONE               No  TCP transmit flags selected.
+*                               NET_TCP_FLAG_TX_FIN             Set TCP 'FIN'    flag.
+*                               NET_TCP_FLAG_TX_SYNC            Set TCP 'SYN'    flag.
+*                               NET_TCP_FLAG_TX_RESET           Set TCP 'RESET'  flag.
+*                               NET_TCP_FLAG_TX_PUSH            Set TCP 'PUSH'   flag.
+*                               NET_TCP_FLAG_TX_ACK             Set TCP 'ACK'    flag.
+*                               NET_TCP_FLAG_TX_URGENT          Set TCP 'URGENT' flag.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP Window Scale option configuration validated.
+*                               NET_TCP_ERR_INVALID_OPT_CFG     Invalid TCP option configuration.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktValidateOpt().
+*
+* Note(s)     : (3) RFC #7323, Section 2.2 states that the Window Scale option "MUST only be sent in a
+*                   <SYN> segment".
+*********************************************************************************************************
+*/
+
+#if ((NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED) && \
+     (defined(NET_TCP_WIN_SCALE_MODULE_EN)))
+static  void  NetTCP_TxPktValidateOptWinScale (void            *p_opt_tcp,
+                                               CPU_INT08U      *p_opt_len,
+                                               void           **p_opt_next,
+                                               NET_TCP_FLAGS    flags_tcp,
+                                               NET_ERR         *p_err)
+{
+    NET_TCP_OPT_CFG_WIN_SCALE  *p_opt_cfg_win_scale;
+    CPU_BOOLEAN                 flags_tcp_syn;
+
+
+    p_opt_cfg_win_scale = (NET_TCP_OPT_CFG_WIN_SCALE *)p_opt_tcp;
+
+
+                                                                /* ---------------- VALIDATE WIN SCALE ---------------- */
+    if (p_opt_cfg_win_scale->WinScale > NET_TCP_WIN_SCALE_MAX) {/* If win scale > max, rtn err.                         */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+        return;
+    }
+
+                                                                /* -------------- VALIDATE OPT CFG/CTRL --------------- */
+    flags_tcp_syn = DEF_BIT_IS_SET(flags_tcp, NET_TCP_HDR_FLAG_SYNC);
+    if (flags_tcp_syn != DEF_YES) {                             /* If 'SYN' bit NOT set, rtn err (see Note #3).         */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+        return;
+    }
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = NET_TCP_HDR_OPT_LEN_WIN_SCALE;
+   *p_opt_next = p_opt_cfg_win_scale->NextOptPtr;
+   *p_err      = NET_TCP_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_TxPktValidateOptFastOpen()
+*
+* Description : Validate TCP Fast Open option configuration.
+*
+*               (1) See 'net_tcp.h  TCP FAST OPEN OPTION CONFIGURATION DATA TYPE' for valid TCP Fast Open
+*                   option configuration.
+*
+*               (2) Return option values.
+*
+*
+* Argument(s) : p_opt_tcp    Pointer to TCP Fast Open option configuration data structure.
+*               --------    Argument checked   in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_len    Pointer to variable that will receive the TCP Fast Open option length
+*               --------        (in octets).
+*
+*                           Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               ---------   Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               flags_tcp   Flags to select TCP transmit options; bit-field flags logically OR'd :
+*
+*                               NET_TCP_FLAG_NONE               No  TCP transmit flags selected.
+*                               NET_TCP_FLAG_TX_FIN             Set TCP 'FIN'    flag.
+*                               NET_TCP_FLAG_TX_SYNC            Set TCP 'SYN'    flag.
+*                               NET_TCP_FLAG_TX_RESET           Set TCP 'RESET'  flag.
+*                               NET_TCP_FLAG_TX_PUSH            Set TCP 'PUSH'   flag.
+*                               NET_TCP_FLAG_TX_ACK             Set TCP 'ACK'    flag.
+*                               NET_TCP_FLAG_TX_URGENT          Set TCP 'URGENT' flag.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP Fast Open option configuration validated.
+*                               NET_TCP_ERR_INVALID_OPT_CFG     Invalid TCP option configuration.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktValidateOpt().
+*
+* Note(s)     : (3) RFC #7413, Section 4.1.1 states that the cookie "MUST be at least 4 bytes and at most
+*                   16 bytes"; a cookie request carries an empty cookie.
+*
+*               (4) The Fast Open option is ONLY valid in a <SYN> segment (see 'net_tcp.h  TCP FAST OPEN
+*                   DEFINES  Note #1').
+*********************************************************************************************************
+*/
+
+#if ((NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED) && \
+     (defined(NET_TCP_FAST_OPEN_MODULE_EN)))
+static  void  NetTCP_TxPktValidateOptFastOpen (void            *p_opt_tcp,
+                                               CPU_INT08U      *p_opt_len,
+                                               void           **p_opt_next,
+                                               NET_TCP_FLAGS    flags_tcp,
+                                               NET_ERR         *p_err)
+{
+    NET_TCP_OPT_CFG_FAST_OPEN  *p_opt_cfg_fast_open;
+    CPU_BOOLEAN                 flags_tcp_syn;
+
+
+    p_opt_cfg_fast_open = (NET_TCP_OPT_CFG_FAST_OPEN *)p_opt_tcp;
+
+
+                                                                /* ---------------- VALIDATE COOKIE ------------------- */
+    if (p_opt_cfg_fast_open->CookieLen != NET_TCP_FAST_OPEN_COOKIE_LEN_REQ) {
+        if ((p_opt_cfg_fast_open->CookieLen < NET_TCP_FAST_OPEN_COOKIE_LEN_MIN) ||
+            (p_opt_cfg_fast_open->CookieLen > NET_TCP_FAST_OPEN_COOKIE_LEN_MAX) ||
+            (p_opt_cfg_fast_open->CookiePtr == DEF_NULL)) {     /* If invalid cookie, rtn err (see Note #3).            */
+            NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+           *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+            return;
+        }
+    }
+
+                                                                /* -------------- VALIDATE OPT CFG/CTRL --------------- */
+    flags_tcp_syn = DEF_BIT_IS_SET(flags_tcp, NET_TCP_HDR_FLAG_SYNC);
+    if (flags_tcp_syn != DEF_YES) {                             /* If 'SYN' bit NOT set, rtn err (see Note #4).         */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+        return;
+    }
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = NET_TCP_HDR_OPT_LEN_MIN_LEN + p_opt_cfg_fast_open->CookieLen;
+   *p_opt_next = p_opt_cfg_fast_open->NextOptPtr;
+   *p_err      = NET_TCP_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           NetTCP_TxPktIPv4
@@ -29022,6 +34738,8 @@ static  void  NetTCP_TxPktValidateOptMaxSegSize (void            *p_opt_tcp,
 *               ---------
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_FAST_OPEN       TCP Fast Open            options configuration.
 *
 *                           Argument checked   in NetTCP_TxPktValidate().
 *
@@ -29214,6 +34932,8 @@ static  void  NetTCP_TxPktIPv4 (NET_BUF           *p_buf,
 *               ---------
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_FAST_OPEN       TCP Fast Open            options configuration.
 *
 *                           Argument checked   in NetTCP_TxPktValidate().
 *
@@ -29356,6 +35076,8 @@ static  void  NetTCP_TxPktIPv6 (NET_BUF                 *p_buf,
 *               ---------
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_FAST_OPEN       TCP Fast Open            options configuration.
 *
 *                           Argument checked   in NetTCP_TxPkt().
 *
@@ -29420,9 +35142,26 @@ static  CPU_INT08U  NetTCP_TxPktPrepareOpt (void        *p_opts_tcp,
             case NET_TCP_OPT_TYPE_MAX_SEG_SIZE:
                  NetTCP_TxPktPrepareOptMaxSegSize(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next, p_err);
                  break;
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+            case NET_TCP_OPT_TYPE_WIN_SCALE:
+                 NetTCP_TxPktPrepareOptWinScale(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next, p_err);
+                 break;
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+            case NET_TCP_OPT_TYPE_FAST_OPEN:
+                 NetTCP_TxPktPrepareOptFastOpen(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next, p_err);
+                 break;
+#endif
                                                                 /* --------------- UNSUPPORTED TCP OPTS --------------- */
                                                                 /* See Note #3b.                                        */
+#ifndef NET_TCP_WIN_SCALE_MODULE_EN
             case NET_TCP_OPT_TYPE_WIN_SCALE:
+#endif
+#ifndef NET_TCP_FAST_OPEN_MODULE_EN
+            case NET_TCP_OPT_TYPE_FAST_OPEN:
+#endif
             case NET_TCP_OPT_TYPE_SACK_PERMIT:
             case NET_TCP_OPT_TYPE_SACK:
             case NET_TCP_OPT_TYPE_ECHO_REQ:
@@ -29566,6 +35305,155 @@ static  void  NetTCP_TxPktPrepareOptMaxSegSize (void         *p_opts_tcp,
 }
 
 
+/*
+*********************************************************************************************************
+*                                  NetTCP_TxPktPrepareOptWinScale()
+*
+* Description : (1) Prepare TCP header with TCP Window Scale option :
+*
+*                   (a) Prepare TCP Window Scale option
+*                   (b) Return option values
+*
+*
+* Argument(s) : p_opts_tcp   Pointer to TCP Window Scale option configuration data structure.
+*               ---------   Argument checked   in NetTCP_TxPkt().
+*
+*               p_opt_hdr    Pointer to TCP transmit option buffer to prepare TCP Window Scale option.
+*               --------    Argument validated in NetTCP_TxPkt().
+*
+*               p_opt_len    Pointer to variable that will receive the returned TCP option length (in octets).
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP Window Scale option successfully prepared.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktPrepareOpt().
+*
+* Note(s)     : (2) See 'net_tcp.h  TCP WINDOW SIZE DEFINES  Note #2' for TCP Window Scale option summary.
+*
+*               (3) The 3-octet Window Scale option is padded to a TCP option word boundary by
+*                   NetTCP_TxPktPrepareOpt().
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+static  void  NetTCP_TxPktPrepareOptWinScale (void         *p_opts_tcp,
+                                              CPU_INT08U   *p_opt_hdr,
+                                              CPU_INT08U   *p_opt_len,
+                                              void        **p_opt_next,
+                                              NET_ERR      *p_err)
+{
+    NET_TCP_OPT_CFG_WIN_SCALE  *p_opt_cfg_win_scale;
+    CPU_INT08U                 *p_opt_cfg_hdr;
+    CPU_INT08U                  opt_len;
+
+
+                                                                /* -------------- PREPARE WIN SCALE OPT --------------- */
+    p_opt_cfg_win_scale = (NET_TCP_OPT_CFG_WIN_SCALE *)p_opts_tcp;
+    p_opt_cfg_hdr       =  p_opt_hdr;
+
+    opt_len             =  NET_TCP_HDR_OPT_LEN_WIN_SCALE;
+
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_WIN_SCALE;                  /* Prepare opt type.                                    */
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = opt_len;                                    /* Prepare opt len.                                     */
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = p_opt_cfg_win_scale->WinScale;              /* Prepare win scale shift.                             */
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = opt_len;
+   *p_opt_next = p_opt_cfg_win_scale->NextOptPtr;
+
+   *p_err      = NET_TCP_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_TxPktPrepareOptFastOpen()
+*
+* Description : (1) Prepare TCP header with TCP Fast Open option :
+*
+*                   (a) Prepare TCP Fast Open option
+*                   (b) Return option values
+*
+*
+* Argument(s) : p_opts_tcp   Pointer to TCP Fast Open option configuration data structure.
+*               ---------   Argument checked   in NetTCP_TxPkt().
+*
+*               p_opt_hdr    Pointer to TCP transmit option buffer to prepare TCP Fast Open option.
+*               --------    Argument validated in NetTCP_TxPkt().
+*
+*               p_opt_len    Pointer to variable that will receive the returned TCP option length (in octets).
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP Fast Open option successfully prepared.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktPrepareOpt().
+*
+* Note(s)     : (2) See 'net_tcp.h  TCP FAST OPEN DEFINES  Note #1' for TCP Fast Open option summary.
+*
+*               (3) The Fast Open option is padded to a TCP option word boundary by NetTCP_TxPktPrepareOpt().
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+static  void  NetTCP_TxPktPrepareOptFastOpen (void         *p_opts_tcp,
+                                              CPU_INT08U   *p_opt_hdr,
+                                              CPU_INT08U   *p_opt_len,
+                                              void        **p_opt_next,
+                                              NET_ERR      *p_err)
+{
+    NET_TCP_OPT_CFG_FAST_OPEN  *p_opt_cfg_fast_open;
+    CPU_INT08U                 *p_opt_cfg_hdr;
+    CPU_INT08U                  opt_len;
+
+
+                                                                /* -------------- PREPARE FAST OPEN OPT --------------- */
+    p_opt_cfg_fast_open = (NET_TCP_OPT_CFG_FAST_OPEN *)p_opts_tcp;
+    p_opt_cfg_hdr       =  p_opt_hdr;
+
+    opt_len             =  NET_TCP_HDR_OPT_LEN_MIN_LEN + p_opt_cfg_fast_open->CookieLen;
+
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_FAST_OPEN;                  /* Prepare opt type.                                    */
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = opt_len;                                    /* Prepare opt len.                                     */
+    p_opt_cfg_hdr++;
+                                                                /* Prepare cookie, if any.                              */
+    if (p_opt_cfg_fast_open->CookieLen > 0u) {
+        Mem_Copy(p_opt_cfg_hdr, p_opt_cfg_fast_open->CookiePtr, p_opt_cfg_fast_open->CookieLen);
+    }
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = opt_len;
+   *p_opt_next = p_opt_cfg_fast_open->NextOptPtr;
+
+   *p_err      = NET_TCP_ERR_NONE;
+}
+#endif
+
+
 
 /*
 *********************************************************************************************************
@@ -29728,6 +35616,7 @@ static  void  NetTCP_TxPktPrepareHdr (NET_BUF           *p_buf,
     NET_TCP_HDR_FLAGS     tcp_flags;
     NET_TCP_HDR_FLAGS     tcp_hdr_len_flags;
     CPU_INT16U            tcp_opt_ix;
+    CPU_INT16U            tcp_win_size;
     NET_CHK_SUM           tcp_chk_sum;
 
                                                                 /* ----------------- UPDATE BUF CTRLS ----------------- */
@@ -29776,7 +35665,8 @@ static  void  NetTCP_TxPktPrepareHdr (NET_BUF           *p_buf,
 
 
                                                                 /* ----------------- PREPARE TCP WIN ------------------ */
-    NET_UTIL_VAL_COPY_SET_NET_16(&p_tcp_hdr->WinSize, &win_size);
+    tcp_win_size = (CPU_INT16U)DEF_MIN(win_size, NET_TCP_WIN_SIZE_HDR_MAX);
+    NET_UTIL_VAL_COPY_SET_NET_16(&p_tcp_hdr->WinSize, &tcp_win_size);
 
 
                                                                 /* -------------- PREPARE TCP URGENT PTR -------------- */
@@ -30087,6 +35977,10 @@ static  void  NetTCP_ConnCfg (NET_TCP_CONN      *p_conn,
 *                   (c) TCP connection's maximum transmit remote window size ('TxWinSizeRemoteMax')
 *                           [see 'NetTCP_RxPktConnHandlerTxWinRemote()   Note  #1a2A'
 *                              & 'NetTCP_TxConnWinSizeHandlerCongCtrl()  Notes #3a2A & #3b']
+*
+*               (4) If path MTU discovery is enabled, the connection maximum segment size is limited to the
+*                   TCP connection's path maximum segment size (see 'net_tcp.h  TCP PATH MTU DISCOVERY
+*                   DEFINES  Note #1b').
 *********************************************************************************************************
 */
 
@@ -30104,7 +35998,409 @@ static  void  NetTCP_ConnCfgMaxSegSize (NET_TCP_CONN  *p_conn)
                                                                 /* Cfg conn max seg size    (see Note #1).              */
     p_conn->MaxSegSizeConn = (NET_TCP_SEG_SIZE)DEF_MIN(p_conn->MaxSegSizeLocalActual,
                                                        remote_max_seg_size);
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+    if (p_conn->MaxSegSizePath != NET_TCP_MAX_SEG_SIZE_NONE) {  /* Limit to path max seg size (see Note #4).            */
+        p_conn->MaxSegSizeConn = (NET_TCP_SEG_SIZE)DEF_MIN(p_conn->MaxSegSizeConn,
+                                                           p_conn->MaxSegSizePath);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_ConnPathMTU_Init()
+*
+* Description : Initialize TCP connection's path maximum segment size from the path MTU cache.
+*
+* Argument(s) : p_conn      Pointer to a TCP connection.
+*               ------      Argument validated in NetTCP_RxPktConnHandlerCfgConn().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerCfgConn().
+*
+* Note(s)     : (1) Expired cache entries are freed & NOT applied (see 'net_tcp.h  TCP PATH MTU DISCOVERY
+*                   DEFINES  Note #3a').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void  NetTCP_ConnPathMTU_Init (NET_TCP_CONN  *p_conn)
+{
+    NET_TCP_PATH_MTU_CACHE_ENTRY  *p_entry;
+    CPU_INT08U                     addr_remote[NET_CONN_ADDR_LEN_MAX];
+    NET_CONN_ADDR_LEN              addr_len;
+    NET_TS_MS                      age_ms;
+    NET_ERR                        err;
+
+
+    if (p_conn->MaxSegSizePath != NET_TCP_MAX_SEG_SIZE_NONE) {  /* If path max seg size already cfg'd, rtn.             */
+        return;
+    }
+
+    Mem_Clr(&addr_remote[0], NET_CONN_ADDR_LEN_MAX);
+    addr_len = sizeof(addr_remote);
+    NetConn_AddrRemoteGet(p_conn->ID_Conn, &addr_remote[0], &addr_len, &err);
+    if (err != NET_CONN_ERR_NONE) {
+        return;
+    }
+    Mem_Clr(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], NET_CONN_ADDR_IP_LEN_PORT);
+
+    p_entry = NetTCP_PathMTU_CacheSrch(&addr_remote[0]);
+    if (p_entry == DEF_NULL) {
+        return;
+    }
+
+    age_ms = NetUtil_TS_Get_ms() - p_entry->TS_ms;
+    if (age_ms >= NET_TCP_PATH_MTU_TIMEOUT_MS) {                /* Free expired entry (see Note #1).                    */
+        p_entry->MaxSegSize = NET_TCP_MAX_SEG_SIZE_NONE;
+        return;
+    }
+
+    p_conn->MaxSegSizePath = p_entry->MaxSegSize;
+    p_conn->PathMTU_TS_ms  = p_entry->TS_ms;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_ConnPathMTU_Set()
+*
+* Description : (1) Reduce TCP connection's path maximum segment size :
+*
+*                   (a) Calculate path maximum segment size from path MTU
+*                   (b) Configure TCP connection's maximum segment size
+*                   (c) Cache     path maximum segment size for remote host
+*
+*
+* Argument(s) : p_conn      Pointer to a TCP connection.
+*               ------      Argument validated in caller(s).
+*
+*               mtu         Path MTU (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPathMTU_Handler(),
+*               NetTCP_ConnPathMTU_BlackHole().
+*
+* Note(s)     : (2) The path maximum segment size is NEVER reduced below the default transmit maximum
+*                   segment size (see 'net_tcp.h  TCP PATH MTU DISCOVERY DEFINES  Note #1b').
+*
+*               (3) Path MTUs that do NOT reduce the TCP connection's maximum segment size are ignored.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void  NetTCP_ConnPathMTU_Set (NET_TCP_CONN  *p_conn,
+                                      CPU_INT32U     mtu)
+{
+    CPU_INT08U         addr_remote[NET_CONN_ADDR_LEN_MAX];
+    NET_CONN_ADDR_LEN  addr_len;
+    CPU_INT32U         mtu_min;
+    CPU_INT16U         hdr_size;
+    NET_TCP_SEG_SIZE   max_seg_size;
+    NET_ERR            err;
+
+                                                                /* ------------ CALC PATH MAX SEG SIZE ---------------- */
+    hdr_size = NetTCP_ConnPathMTU_HdrSizeGet(p_conn, &mtu_min);
+    if (hdr_size == 0u) {
+        return;
+    }
+
+    mtu = DEF_MAX(mtu, mtu_min);                                /* See Note #2.                                         */
+    if ((mtu - hdr_size) >= (CPU_INT32U)p_conn->MaxSegSizeConn) {
+        return;                                                 /* See Note #3.                                         */
+    }
+    max_seg_size = (NET_TCP_SEG_SIZE)(mtu - hdr_size);
+
+                                                                /* ------------- CFG CONN MAX SEG SIZE ---------------- */
+    p_conn->MaxSegSizePath = max_seg_size;
+    p_conn->PathMTU_TS_ms  = NetUtil_TS_Get_ms();
+    NetTCP_ConnCfg(p_conn, NET_TCP_CONN_CFG_MAX_SEG_SIZE_CONN);
+
+                                                                /* -------------- CACHE PATH MAX SEG SIZE ------------- */
+    Mem_Clr(&addr_remote[0], NET_CONN_ADDR_LEN_MAX);
+    addr_len = sizeof(addr_remote);
+    NetConn_AddrRemoteGet(p_conn->ID_Conn, &addr_remote[0], &addr_len, &err);
+    if (err != NET_CONN_ERR_NONE) {
+        return;
+    }
+    Mem_Clr(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], NET_CONN_ADDR_IP_LEN_PORT);
+
+    NetTCP_PathMTU_CacheUpdate(&addr_remote[0], max_seg_size, p_conn->PathMTU_TS_ms);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_ConnPathMTU_BlackHole()
+*
+* Description : Reduce TCP connection's path maximum segment size for a segment re-transmitted on
+*               repeated re-transmit timeouts.
+*
+* Argument(s) : p_conn          Pointer to a TCP connection.
+*               ------          Argument validated in NetTCP_TxConnReTxQ().
+*
+*               seg_len_data    Re-transmitted segment's data length (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnReTxQ().
+*
+* Note(s)     : (1) See 'net_tcp.h  TCP PATH MTU DISCOVERY DEFINES  Note #2'.
+*
+*               (2) Segments that already fit the default transmit maximum segment size are NOT lost to a
+*                   path MTU black hole.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void  NetTCP_ConnPathMTU_BlackHole (NET_TCP_CONN      *p_conn,
+                                            NET_TCP_SEG_SIZE   seg_len_data)
+{
+    CPU_INT32U  mtu_min;
+    CPU_INT32U  mtu_seg;
+    CPU_INT16U  hdr_size;
+
+
+    hdr_size = NetTCP_ConnPathMTU_HdrSizeGet(p_conn, &mtu_min);
+    if (hdr_size == 0u) {
+        return;
+    }
+
+    mtu_seg = (CPU_INT32U)seg_len_data + hdr_size;
+    if (mtu_seg <= mtu_min) {                                   /* See Note #2.                                         */
+        return;
+    }
+
+    if (mtu_seg > NET_TCP_PATH_MTU_BLACK_HOLE_MTU) {            /* Reduce path MTU to black hole MTU ...                */
+        NetTCP_ConnPathMTU_Set(p_conn, NET_TCP_PATH_MTU_BLACK_HOLE_MTU);
+    } else {                                                    /* ... or to min MTU (see Note #1).                     */
+        NetTCP_ConnPathMTU_Set(p_conn, mtu_min);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_ConnPathMTU_Age()
+*
+* Description : Clear TCP connection's expired path maximum segment size to probe for a larger path MTU.
+*
+* Argument(s) : p_conn      Pointer to a TCP connection.
+*               ------      Argument validated in NetTCP_TxConnAppData().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnAppData().
+*
+* Note(s)     : (1) See 'net_tcp.h  TCP PATH MTU DISCOVERY DEFINES  Note #3'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  void  NetTCP_ConnPathMTU_Age (NET_TCP_CONN  *p_conn)
+{
+    NET_TS_MS  age_ms;
+
+
+    if (p_conn->MaxSegSizePath == NET_TCP_MAX_SEG_SIZE_NONE) {
+        return;
+    }
+
+    age_ms = NetUtil_TS_Get_ms() - p_conn->PathMTU_TS_ms;
+    if (age_ms < NET_TCP_PATH_MTU_TIMEOUT_MS) {
+        return;
+    }
+
+    p_conn->MaxSegSizePath = NET_TCP_MAX_SEG_SIZE_NONE;         /* Probe larger path MTU (see Note #1).                 */
+    NetTCP_ConnCfg(p_conn, NET_TCP_CONN_CFG_MAX_SEG_SIZE_CONN);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   NetTCP_ConnPathMTU_HdrSizeGet()
+*
+* Description : Get TCP connection's minimum IP & TCP header size & minimum path MTU.
+*
+* Argument(s) : p_conn      Pointer to a TCP connection.
+*               ------      Argument validated in caller(s).
+*
+*               p_mtu_min   Pointer to variable that will receive the minimum path MTU (in octets).
+*
+* Return(s)   : Minimum IP & TCP header size (in octets), if NO error(s).
+*
+*               0,                                         otherwise.
+*
+* Caller(s)   : NetTCP_ConnPathMTU_Set(),
+*               NetTCP_ConnPathMTU_BlackHole().
+*
+* Note(s)     : (1) The minimum path MTU is the IP layer's default maximum datagram size (see 'net_tcp.h
+*                   TCP SEGMENT SIZE DEFINES  Note #1').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+static  CPU_INT16U  NetTCP_ConnPathMTU_HdrSizeGet (NET_TCP_CONN  *p_conn,
+                                                   CPU_INT32U    *p_mtu_min)
+{
+    NET_CONN    *p_net_conn;
+    CPU_INT16U   hdr_size;
+
+
+    p_net_conn = &NetConn_Tbl[p_conn->ID_Conn];
+
+    switch (p_net_conn->Family) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_SOCK_FAMILY_IP_V4:
+            *p_mtu_min = NET_IPv4_MAX_DATAGRAM_SIZE_DFLT;       /* See Note #1.                                         */
+             hdr_size  = NET_IPv4_HDR_SIZE_MIN + NET_TCP_HDR_SIZE_MIN;
+             break;
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_SOCK_FAMILY_IP_V6:
+            *p_mtu_min = NET_IPv6_MAX_DATAGRAM_SIZE_DFLT;       /* See Note #1.                                         */
+             hdr_size  = NET_IPv6_HDR_SIZE     + NET_TCP_HDR_SIZE_MIN;
+             break;
+#endif
+
+        default:
+            *p_mtu_min = 0u;
+             hdr_size  = 0u;
+             break;
+    }
+
+    return (hdr_size);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_ConnTimeWaitCompact()
+*
+* Description : (1) Compact a TCP connection in the TIME-WAIT state into a time-wait entry :
+*
+*                   (a) Get  time-wait entry                                            See Note #2
+*                   (b) Save connection addresses, sequence numbers, receive window & 2MSL timeout
+*                   (c) Close TCP connection                                            See Note #3
+*
+*
+* Argument(s) : p_conn      Pointer to TCP connection in the TIME-WAIT state.
+*               ------      Argument validated in NetTCP_RxPktConnHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandler().
+*
+* Note(s)     : (2) If the connection's maximum segment lifetime is zero or NO time-wait entry is available,
+*                   the connection remains in the TIME-WAIT state (see 'net_tcp.h  TCP TIME-WAIT DEFINES
+*                   Notes #1a & #1b').
+*
+*               (3) The TCP connection is closed as on expiry of its time-wait timer (see
+*                   'NetTCP_ConnIdleTimeout()').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  void  NetTCP_ConnTimeWaitCompact (NET_TCP_CONN  *p_conn)
+{
+    NET_TCP_TIME_WAIT_ENTRY  *p_entry;
+    NET_CONN                 *p_net_conn;
+    NET_CONN_ADDR_LEN         addr_len;
+    NET_TS_MS                 ts_ms;
+    NET_ERR                   err;
+
+
+    if (p_conn->TimeoutMaxSeg_sec == 0u) {                      /* See Note #2.                                         */
+        return;
+    }
+
+                                                                /* --------------- GET TIME-WAIT ENTRY ---------------- */
+    ts_ms   = NetUtil_TS_Get_ms();
+    p_entry = NetTCP_TimeWaitGet(ts_ms);
+    if (p_entry == DEF_NULL) {                                  /* See Note #2.                                         */
+        return;
+    }
+
+                                                                /* ------------ SAVE TCP CONN TIME-WAIT --------------- */
+    p_entry->Family = NET_CONN_FAMILY_NONE;
+
+    addr_len = NET_CONN_ADDR_LEN_MAX;
+    NetConn_AddrLocalGet(p_conn->ID_Conn, &p_entry->AddrLocal[0], &addr_len, &err);
+    if (err != NET_CONN_ERR_NONE) {
+        return;
+    }
+
+    addr_len = NET_CONN_ADDR_LEN_MAX;
+    NetConn_AddrRemoteGet(p_conn->ID_Conn, &p_entry->AddrRemote[0], &addr_len, &err);
+    if (err != NET_CONN_ERR_NONE) {
+        return;
+    }
+
+    p_net_conn            = &NetConn_Tbl[p_conn->ID_Conn];
+
+    p_entry->RxSeqNbrNext =  p_conn->RxSeqNbrNext;
+    p_entry->TxSeqNbrNext =  p_conn->TxSeqNbrNext;
+    p_entry->RxWinSizeHdr =  NetTCP_TxConnWinSizeHdrGet(p_conn, NET_TCP_FLAG_TX_ACK);
+    p_entry->TS_ms        =  ts_ms;
+    p_entry->Timeout_ms   = (NET_TS_MS)p_conn->TimeoutMaxSeg_sec * NET_TCP_CONN_TIMEOUT_MAX_SEG_SCALAR
+                          *  DEF_TIME_NBR_mS_PER_SEC;           /* 2MSL timeout (in ms).                                */
+    p_entry->Family       =  p_net_conn->Family;
+
+
+                                                                /* ------------------ CLOSE TCP CONN ------------------ */
+    NetTCP_ConnCloseHandler(p_conn, p_conn->ConnCloseAppFlag, NET_TCP_CONN_CLOSE_ALL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetTCP_TimeWaitGet()
+*
+* Description : Get a free time-wait entry.
+*
+* Argument(s) : ts_ms       Current time stamp (in milliseconds).
+*
+* Return(s)   : Pointer to free or expired time-wait entry, if available.
+*
+*               Pointer to NULL,                            otherwise.
+*
+* Caller(s)   : NetTCP_ConnTimeWaitCompact().
+*
+* Note(s)     : (1) Unexpired time-wait entries are NEVER replaced (see 'net_tcp.h  TCP TIME-WAIT DEFINES
+*                   Note #1b').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+static  NET_TCP_TIME_WAIT_ENTRY  *NetTCP_TimeWaitGet (NET_TS_MS  ts_ms)
+{
+    NET_TCP_TIME_WAIT_ENTRY  *p_entry;
+    CPU_INT16U                i;
+
+
+    p_entry = &NetTCP_TimeWaitTbl[0];
+    for (i = 0u; i < NET_TCP_DFLT_TIME_WAIT_NBR_ENTRY; i++) {
+        if ((p_entry->Family == NET_CONN_FAMILY_NONE) ||
+            ((NET_TS_MS)(ts_ms - p_entry->TS_ms) >= p_entry->Timeout_ms)) {
+            return (p_entry);
+        }
+        p_entry++;
+    }
+
+    return (DEF_NULL);
 }
+#endif
 
 
 /*
@@ -30329,6 +36625,7 @@ static  void  NetTCP_ConnIdleTimeout (void  *p_conn_timeout)
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgment delay timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                      timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing               timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                              timers.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
@@ -30476,6 +36773,7 @@ static  void  NetTCP_ConnClose (NET_TCP_CONN        *p_conn,
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ZERO_WIN      Close    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_TX_ACK_DLY       Close    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_RE_TX            Close re-transmit                       timer.
+*                                   NET_TCP_CONN_CLOSE_TMR_TX_PACE          Close    transmit pacing                timer.
 *                                   NET_TCP_CONN_CLOSE_TMR_ALL              Close ALL                               timers.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
@@ -30699,6 +36997,7 @@ static  void  NetTCP_ConnClosingTimeoutDataAvail (void  *p_conn_timeout)
 *                                   NET_TCP_CONN_FREE_TMR_TX_ZERO_WIN       Free    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_FREE_TMR_TX_ACK_DLY        Free    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_FREE_TMR_RE_TX             Free re-transmit                       timer.
+*                                   NET_TCP_CONN_FREE_TMR_TX_PACE           Free    transmit pacing                timer.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
 *
@@ -30729,6 +37028,10 @@ static  void  NetTCP_ConnFreeHandler (NET_TCP_CONN       *p_conn,
     NetTCP_ConnFreeBufQ(&p_conn->TxQ_Head          , &p_conn->TxQ_Tail          );
     NetTCP_ConnFreeBufQ(&p_conn->ReTxQ_Head        , &p_conn->ReTxQ_Tail        );
 
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+    NetTCP_RxConnWinSizeTuneRelease(p_conn);                    /* Release auto-tuned rx win growth.                    */
+#endif
+
 
     discard = DEF_NO;
 
@@ -30802,6 +37105,7 @@ static  void  NetTCP_ConnFreeHandler (NET_TCP_CONN       *p_conn,
 *                                   NET_TCP_CONN_FREE_TMR_TX_ZERO_WIN       Free    transmit zero  window persist  timer.
 *                                   NET_TCP_CONN_FREE_TMR_TX_ACK_DLY        Free    transmit acknowledgement delay timer.
 *                                   NET_TCP_CONN_FREE_TMR_RE_TX             Free re-transmit                       timer.
+*                                   NET_TCP_CONN_FREE_TMR_TX_PACE           Free    transmit pacing                timer.
 *
 *                               See also 'TCP CONNECTION CLOSE/FREE CODE DEFINES'.
 *
@@ -30869,6 +37173,16 @@ static  void  NetTCP_ConnFreeTmr (NET_TCP_CONN       *p_conn,
             p_conn->ReTxQ_Tmr  = DEF_NULL;
         }
     }
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+    free_tmr = DEF_BIT_IS_SET(free_code, NET_TCP_CONN_FREE_TMR_TX_PACE);
+    if (free_tmr == DEF_YES) {
+        if (p_conn->TxQ_PaceTmr != DEF_NULL) {
+            NetTmr_Free(p_conn->TxQ_PaceTmr);
+            p_conn->TxQ_PaceTmr  = DEF_NULL;
+        }
+    }
+#endif
 }
 
 
@@ -30994,6 +37308,10 @@ static  void  NetTCP_ConnClr (NET_TCP_CONN  *p_conn)
 #if 0                                                           /* See Note #1a.                                        */
     p_conn->MaxSegSizeConn               =  NET_TCP_MAX_SEG_SIZE_NONE;
 #endif
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+    p_conn->MaxSegSizePath               =  NET_TCP_MAX_SEG_SIZE_NONE;
+    p_conn->PathMTU_TS_ms                =  0u;
+#endif
 
     p_conn->RxSeqNbrSync                 =  NET_TCP_SEQ_NBR_NONE;
     p_conn->RxSeqNbrNext                 =  NET_TCP_SEQ_NBR_NONE;
@@ -31005,6 +37323,19 @@ static  void  NetTCP_ConnClr (NET_TCP_CONN  *p_conn)
     p_conn->RxWinSizeActual              =  p_conn->RxWinSizeCfgd;
     p_conn->RxWinSizeUpdateTh            =  NET_TCP_WIN_SIZE_NONE; /* See Note #1b1.                                    */
 #endif
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    p_conn->WinScaleEn                   =  DEF_NO;
+    p_conn->RxWinScale                   =  NET_TCP_WIN_SCALE_MIN;
+    p_conn->TxWinScale                   =  NET_TCP_WIN_SCALE_MIN;
+#endif
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+    p_conn->RxWinTuneBase                =  NET_TCP_WIN_SIZE_NONE;
+    p_conn->RxWinTuneRdCtr               =  0u;
+    p_conn->RxWinTuneTS_ms               =  0u;
+    p_conn->RxWinTuneRTT_SeqNbr          =  NET_TCP_SEQ_NBR_NONE;
+    p_conn->RxWinTuneRTT_TS_ms           =  0u;
+    p_conn->RxWinTuneRTT_ms              =  NET_TCP_RX_WIN_TUNE_RTT_NONE;
+#endif
 
     p_conn->RxQ_State                    =  NET_TCP_RX_Q_STATE_CLOSED;
     p_conn->RxQ_Transport_Head           =  DEF_NULL;
@@ -31031,9 +37362,12 @@ static  void  NetTCP_ConnClr (NET_TCP_CONN  *p_conn)
     p_conn->TxWinSizeRemoteActual        =  p_conn->TxWinSizeRemote;
     p_conn->TxWinSizeRemoteRem           =  p_conn->TxWinSizeRemote;
     p_conn->TxWinSizeNagleEn             =  DEF_ENABLED;        /* See Note #5.                                         */
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+    p_conn->TxCorkEn                     =  DEF_DISABLED;
+#endif
     p_conn->TxWinSillyWinTimeout_ms      =  NET_TCP_TX_SILLY_WIN_TIMEOUT_DFLT_MS; /* See Note #6.                       */
     p_conn->TxWinZeroWinTimeout_ms       =  0u;                 /* See Note #7.                                         */
-    p_conn->TxWinSillyWinTimeout_tick    =  (p_conn->TxWinSillyWinTimeout_ms * NET_TMR_TIME_TICK_PER_SEC)
+    p_conn->TxWinSillyWinTimeout_tick    =  (p_conn->TxWinSillyWinTimeout_ms * NET_TCP_TMR_TICK_PER_SEC)
                                                                              / DEF_TIME_NBR_mS_PER_SEC;
 #if 0                                                           /* See Note #1c.                                        */
     p_conn->TxWinSizeCfgdRem             =  p_conn->TxWinSizeCfgd;
@@ -31057,6 +37391,9 @@ static  void  NetTCP_ConnClr (NET_TCP_CONN  *p_conn)
 
     p_conn->TxAckDlyTmr                  =  DEF_NULL;
     p_conn->TxAckDlyCnt                  =  0u;
+#ifdef  NET_TCP_ACK_ADAPT_MODULE_EN
+    p_conn->TxAckQuickCnt                =  NET_TCP_ACK_QUICK_CNT;
+#endif
 
     p_conn->TxAckImmedRxdPushEn          =  DEF_ENABLED;        /* See Note #9.                                         */
 
@@ -31092,9 +37429,50 @@ static  void  NetTCP_ConnClr (NET_TCP_CONN  *p_conn)
     p_conn->TxQ_IdleTmr                  =  DEF_NULL;
     p_conn->TxQ_SillyWinTmr              =  DEF_NULL;
     p_conn->TxQ_ZeroWinTmr               =  DEF_NULL;
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+    p_conn->TxQ_PaceTmr                  =  DEF_NULL;
+#endif
     p_conn->ReTxQ_Head                   =  DEF_NULL;
     p_conn->ReTxQ_Tail                   =  DEF_NULL;
     p_conn->ReTxQ_Tmr                    =  DEF_NULL;
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+    p_conn->ReTxQ_IdxHead                =  0u;
+    p_conn->ReTxQ_IdxNbr                 =  0u;
+    p_conn->ReTxQ_IdxOvf                 =  DEF_NO;
+#endif
+
+#ifdef  NET_TCP_RACK_MODULE_EN
+    p_conn->TxRACK_TS_ms                 =  NET_TCP_RACK_TS_NONE;
+    p_conn->TxRACK_RTT_ms                =  NET_TCP_TX_RTT_NONE;
+    p_conn->TxRACK_RTT_Min_ms            =  NET_TCP_TX_RTT_NONE;
+    p_conn->TxRACK_Recovery              =  DEF_NO;
+    p_conn->TxRACK_RecoverSeqNbr         =  NET_TCP_SEQ_NBR_NONE;
+    p_conn->TxTLP_Armed                  =  DEF_NO;
+    p_conn->TxTLP_Txd                    =  DEF_NO;
+#endif
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+    p_conn->TxPaceRateCfgd               =  NET_TCP_TX_PACE_RATE_NONE;
+    p_conn->TxPaceRate_ms                =  NET_TCP_TX_PACE_RATE_NONE;
+    p_conn->TxPaceBurst                  =  0u;
+    p_conn->TxPaceTokens                 =  0u;
+    p_conn->TxPaceTS_ms                  =  0u;
+    p_conn->TxPaceDlyCtr                 =  0u;
+#endif
+
+#ifdef  NET_TCP_ECN_MODULE_EN
+    p_conn->ECN_En                       =  DEF_NO;
+    p_conn->RxECN_EchoReqd               =  DEF_NO;
+    p_conn->TxECN_CWR_Reqd               =  DEF_NO;
+    p_conn->TxECN_Recovery               =  DEF_NO;
+    p_conn->TxECN_RecoverSeqNbr          =  NET_TCP_SEQ_NBR_NONE;
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    p_conn->FastOpenEn                   =  DEF_DISABLED;
+    p_conn->TxFastOpenDataLen            =  0u;
+    p_conn->TxFastOpenCookieReqd         =  DEF_NO;
+#endif
 
 
 
@@ -31192,6 +37570,15 @@ static  void  NetTCP_ConnCopy (NET_TCP_CONN  *p_conn_dest,
 
     p_conn_dest->TxWinSizeCfgd               = p_conn_src->TxWinSizeCfgd;
     p_conn_dest->TxWinSizeNagleEn            = p_conn_src->TxWinSizeNagleEn;
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+    p_conn_dest->TxCorkEn                    = p_conn_src->TxCorkEn;
+#endif
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+    p_conn_dest->TxPaceRateCfgd              = p_conn_src->TxPaceRateCfgd;
+#endif
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    p_conn_dest->FastOpenEn                  = p_conn_src->FastOpenEn;
+#endif
 
     p_conn_dest->TxAckDlyTimeout_ms          = p_conn_src->TxAckDlyTimeout_ms;
     p_conn_dest->TxAckDlyTimeout_tick        = p_conn_src->TxAckDlyTimeout_tick;
@@ -31288,7 +37675,7 @@ static  void  NetTCP_ConnDiscard (NET_TCP_CONN  *p_conn)
 *********************************************************************************************************
 */
 
-#ifdef  NET_TCP_CFG_RANDOM_ISN_GEN
+#if (defined(NET_TCP_CFG_RANDOM_ISN_GEN) && !defined(NET_TCP_ISN_SIPHASH_MODULE_EN))
 NET_TCP_SEQ_NBR  NetTCP_ConnFiveTupleSeqNbrGet (NET_CONN  *p_conn)
 {
     NET_CONN_FAMILY          conn_family;
@@ -31376,6 +37763,264 @@ NET_TCP_SEQ_NBR  NetTCP_ConnFiveTupleSeqNbrGet (NET_CONN  *p_conn)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                    NetTCP_ConnFiveTupleSeqNbrGet()
+*
+* Description : (1) Get the initial sequence number for a new TCP connection just before a SYN is sent for
+*                   the first time in an active open OR just after a SYN is recived in a passive open.
+*
+* Argument(s) : p_conn       Pointer to valid Network Connection associated with the TCP Connection.
+*
+* Return(s)   : The sequence number as the following (see 'net_tcp.h  TCP ISN SIPHASH DEFINES  Note #1') :
+*
+*                              ISN = M + F(localip, localport, remoteip, remoteport, secretkey)
+*
+*               Where:
+*                              M = The value of a counter (NetTCP_TxSeqNbrCtr) maintained by the developer
+*                                  at the BSP level. The counter must be incremented by '1' every 4 uS.
+*
+*                              F = The lower 32 bits of a SipHash-2-4 hash of the four-tuple (localip,
+*                                  localport, remoteip, remoteport), keyed with the 128-bit ISN hash key.
+*
+* Caller(s)   :  via NET_TCP_TX_GET_SEQ_NBR() macro.
+*
+* Note(s)     : (2) The ISN hash key is lazily regenerated once NET_TCP_DFLT_ISN_REKEY_TIME_SEC seconds
+*                   have elapsed since it was last generated (see 'net_tcp.h  TCP ISN SIPHASH DEFINES
+*                   Note #2').
+*
+*               (3) The four-tuple is hashed in network order as received in the connection's addresses.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_ISN_SIPHASH_MODULE_EN
+NET_TCP_SEQ_NBR  NetTCP_ConnFiveTupleSeqNbrGet (NET_CONN  *p_conn)
+{
+    CPU_INT08U       hash_data[2u * NET_CONN_ADDR_LEN_MAX];
+    CPU_INT16U       hash_data_len;
+    CPU_INT16U       addr_ix;
+    CPU_INT16U       addr_len;
+    CPU_INT64U       hash;
+    NET_TCP_SEQ_NBR  seq_nbr;
+#if (NET_TCP_DFLT_ISN_REKEY_TIME_SEC > 0u)
+    NET_TS_MS        ts_ms;
+    NET_TS_MS        key_age_ms;
+
+                                                                /* --------------- REKEY ISN HASH KEY ----------------- */
+    ts_ms      =  NetUtil_TS_Get_ms();
+    key_age_ms = (NET_TS_MS)(ts_ms - NetTCP_ISN_KeyTS_ms);
+    if (key_age_ms >= NET_TCP_ISN_REKEY_TIME_MS) {              /* If key expired, ...                                  */
+        NetTCP_ISN_KeyGen();                                    /* ... regen key (see Note #2).                         */
+    }
+#endif
+
+                                                                /* --------------- GET CONN ADDR FIELDS --------------- */
+    switch (p_conn->Family) {
+#ifdef  NET_IPv4_MODULE_EN
+        case  NET_CONN_FAMILY_IP_V4_SOCK:
+              addr_ix  = NET_CONN_ADDR_IP_V4_IX_ADDR;
+              addr_len = NET_CONN_ADDR_IP_V4_LEN_ADDR;
+              break;
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+        case  NET_CONN_FAMILY_IP_V6_SOCK:
+              addr_ix  = NET_CONN_ADDR_IP_V6_IX_ADDR;
+              addr_len = NET_CONN_ADDR_IP_V6_LEN_ADDR;
+              break;
+#endif
+
+        default:                                                /* Shouldn't get here. Conn family validated by caller. */
+              addr_ix  = 0u;
+              addr_len = 0u;
+              break;
+    }
+
+                                                                /* ----------------- HASH FOUR-TUPLE ------------------ */
+    hash_data_len = 0u;                                         /* Load local  port & addr (see Note #3).               */
+    Mem_Copy(&hash_data[hash_data_len],
+             &p_conn->AddrLocal[NET_CONN_ADDR_IP_IX_PORT],
+              NET_CONN_ADDR_IP_LEN_PORT);
+    hash_data_len += NET_CONN_ADDR_IP_LEN_PORT;
+    Mem_Copy(&hash_data[hash_data_len],
+             &p_conn->AddrLocal[addr_ix],
+              addr_len);
+    hash_data_len += addr_len;
+                                                                /* Load remote port & addr.                             */
+    Mem_Copy(&hash_data[hash_data_len],
+             &p_conn->AddrRemote[NET_CONN_ADDR_IP_IX_PORT],
+              NET_CONN_ADDR_IP_LEN_PORT);
+    hash_data_len += NET_CONN_ADDR_IP_LEN_PORT;
+    Mem_Copy(&hash_data[hash_data_len],
+             &p_conn->AddrRemote[addr_ix],
+              addr_len);
+    hash_data_len += addr_len;
+
+    hash    =  NetTCP_ISN_SipHash(hash_data, hash_data_len);
+    seq_nbr = (NET_TCP_SEQ_NBR)hash + NetTCP_TxSeqNbrCtr;       /* Add lower 4 bytes of the hash to sequence nbr counter.*/
+
+    return (seq_nbr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         NetTCP_ISN_KeyGen()
+*
+* Description : Generate a new 128-bit ISN hash key.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_Init(),
+*               NetTCP_ConnFiveTupleSeqNbrGet().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_ISN_SIPHASH_MODULE_EN
+static  void  NetTCP_ISN_KeyGen (void)
+{
+    CPU_INT32U  key_hi;
+    CPU_INT32U  key_lo;
+    CPU_INT08U  i;
+
+
+    for (i = 0u; i < NET_TCP_ISN_KEY_SIZE; i++) {
+        key_hi            =  NetUtil_RandomRangeGet(0u, DEF_INT_32U_MAX_VAL);
+        key_lo            =  NetUtil_RandomRangeGet(0u, DEF_INT_32U_MAX_VAL);
+        NetTCP_ISN_Key[i] = ((CPU_INT64U)key_hi << 32u) | (CPU_INT64U)key_lo;
+    }
+
+    NetTCP_ISN_KeyTS_ms = NetUtil_TS_Get_ms();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetTCP_ISN_SipHash()
+*
+* Description : Calculate a SipHash-2-4 hash of data, keyed with the ISN hash key.
+*
+* Argument(s) : p_data      Pointer to data to hash.
+*
+*               data_len    Length  of data to hash (in octets).
+*
+* Return(s)   : 64-bit SipHash-2-4 hash.
+*
+* Caller(s)   : NetTCP_ConnFiveTupleSeqNbrGet().
+*
+* Note(s)     : (1) SipHash loads message blocks & the key as little-endian 64-bit integers, regardless
+*                   of the CPU's endianness.  The key is held as host integers & is thus used directly.
+*
+*               (2) The final message block is padded with zeros & carries the data length modulo 256
+*                   in its most significant octet.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_ISN_SIPHASH_MODULE_EN
+static  CPU_INT64U  NetTCP_ISN_SipHash (CPU_INT08U  *p_data,
+                                        CPU_INT16U   data_len)
+{
+    CPU_INT64U  v[4u];
+    CPU_INT64U  blk;
+    CPU_INT16U  blk_nbr;
+    CPU_INT16U  data_ix;
+    CPU_INT08U  blk_ix;
+    CPU_INT08U  rem_len;
+    CPU_INT08U  i;
+
+
+                                                                /* ------------------- INIT STATE --------------------- */
+    v[0] = NET_TCP_ISN_SIPHASH_INIT_V0 ^ NetTCP_ISN_Key[0];
+    v[1] = NET_TCP_ISN_SIPHASH_INIT_V1 ^ NetTCP_ISN_Key[1];
+    v[2] = NET_TCP_ISN_SIPHASH_INIT_V2 ^ NetTCP_ISN_Key[0];
+    v[3] = NET_TCP_ISN_SIPHASH_INIT_V3 ^ NetTCP_ISN_Key[1];
+
+                                                                /* ---------------- COMPRESS MSG BLKS ----------------- */
+    blk_nbr = data_len / NET_TCP_ISN_SIPHASH_BLK_LEN;
+    rem_len = data_len % NET_TCP_ISN_SIPHASH_BLK_LEN;
+    data_ix = 0u;
+    while (blk_nbr > 0u) {
+        blk = 0u;
+        for (blk_ix = NET_TCP_ISN_SIPHASH_BLK_LEN; blk_ix > 0u; blk_ix--) {
+            blk = (blk << 8u) | (CPU_INT64U)p_data[data_ix + blk_ix - 1u];
+        }                                                       /* Load blk as little-endian (see Note #1).             */
+
+        v[3] ^= blk;
+        for (i = 0u; i < NET_TCP_ISN_SIPHASH_C_ROUNDS; i++) {
+            NetTCP_ISN_SipHashRound(v);
+        }
+        v[0] ^= blk;
+
+        data_ix += NET_TCP_ISN_SIPHASH_BLK_LEN;
+        blk_nbr--;
+    }
+
+                                                                /* ----------------- COMPRESS LAST BLK ---------------- */
+    blk = (CPU_INT64U)(data_len & DEF_OCTET_MASK) << 56u;       /* See Note #2.                                         */
+    for (blk_ix = rem_len; blk_ix > 0u; blk_ix--) {
+        blk |= (CPU_INT64U)p_data[data_ix + blk_ix - 1u] << (8u * (blk_ix - 1u));
+    }
+
+    v[3] ^= blk;
+    for (i = 0u; i < NET_TCP_ISN_SIPHASH_C_ROUNDS; i++) {
+        NetTCP_ISN_SipHashRound(v);
+    }
+    v[0] ^= blk;
+
+                                                                /* --------------------- FINALIZE --------------------- */
+    v[2] ^= NET_TCP_ISN_SIPHASH_FINAL_V2;
+    for (i = 0u; i < NET_TCP_ISN_SIPHASH_D_ROUNDS; i++) {
+        NetTCP_ISN_SipHashRound(v);
+    }
+
+    return (v[0] ^ v[1] ^ v[2] ^ v[3]);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_ISN_SipHashRound()
+*
+* Description : Perform one SipHash round on the hash state.
+*
+* Argument(s) : p_v         Pointer to the four 64-bit SipHash state words.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_ISN_SipHash().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_ISN_SIPHASH_MODULE_EN
+static  void  NetTCP_ISN_SipHashRound (CPU_INT64U  *p_v)
+{
+    p_v[0] += p_v[1];
+    p_v[1]  = NET_TCP_ISN_SIPHASH_ROTL(p_v[1], 13u);
+    p_v[1] ^= p_v[0];
+    p_v[0]  = NET_TCP_ISN_SIPHASH_ROTL(p_v[0], 32u);
+    p_v[2] += p_v[3];
+    p_v[3]  = NET_TCP_ISN_SIPHASH_ROTL(p_v[3], 16u);
+    p_v[3] ^= p_v[2];
+    p_v[0] += p_v[3];
+    p_v[3]  = NET_TCP_ISN_SIPHASH_ROTL(p_v[3], 21u);
+    p_v[3] ^= p_v[0];
+    p_v[2] += p_v[1];
+    p_v[1]  = NET_TCP_ISN_SIPHASH_ROTL(p_v[1], 17u);
+    p_v[1] ^= p_v[2];
+    p_v[2]  = NET_TCP_ISN_SIPHASH_ROTL(p_v[2], 32u);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         NetUDP_GetTxDataIx()
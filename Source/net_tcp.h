@@ -36,6 +36,8 @@
 *
 *                    (1) Window Scale                                      RFC #1072, Section 2
 *                                                                          RFC #1323, Section 2
+*                            Supported ONLY if NET_TCP_CFG_WIN_SCALE_EN    RFC #7323, Section 2
+*                            is DEF_ENABLED
 *                    (2) Selective Acknowledgement (SACK)                  RFC #1072, Section 3
 *                                                                          RFC #2018
 *                                                                          RFC #2883
@@ -48,6 +50,8 @@
 *
 *                (e) ICMP-Error-Message-to-TCP-Connection                  RFC #1122, Section 4.2.3.9
 *                           Handling NOT currently supported #### NET-805
+*                           EXCEPT path MTU discovery messages            RFC #1191, Section 3
+*                           if NET_TCP_CFG_PATH_MTU_EN is DEF_ENABLED     RFC #8201, Section 4
 *
 *            (2) TCP Layer assumes/requires Network Socket Layer (see 'net_sock.h  MODULE  Note #1a2').
 *********************************************************************************************************
@@ -146,6 +150,74 @@
 #endif
 
 
+#ifdef   NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+#ifndef  NET_TCP_DFLT_RX_WIN_AUTO_TUNE_MAX_OCTET
+                                                                /* Configure TCP connections' max auto-tuned rx win.    */
+    #define  NET_TCP_DFLT_RX_WIN_AUTO_TUNE_MAX_OCTET     DEF_MIN((NET_TCP_DFLT_RX_WIN_SIZE_OCTET * 4u), \
+                                                                  NET_TCP_WIN_SIZE_MAX)
+#endif
+
+#ifndef  NET_TCP_DFLT_RX_WIN_AUTO_TUNE_TOT_MAX_OCTET
+                                                                /* Configure max rx win growth for ALL TCP conns.       */
+    #define  NET_TCP_DFLT_RX_WIN_AUTO_TUNE_TOT_MAX_OCTET NET_TCP_DFLT_RX_WIN_AUTO_TUNE_MAX_OCTET
+#endif
+#endif
+
+
+#ifdef   NET_TCP_SYN_CACHE_MODULE_EN
+#ifndef  NET_TCP_DFLT_SYN_CACHE_NBR_ENTRY
+                                                                /* Configure nbr of TCP SYN cache entries.              */
+    #define  NET_TCP_DFLT_SYN_CACHE_NBR_ENTRY           (NET_SOCK_CFG_SOCK_NBR_TCP * \
+                                                         NET_SOCK_CFG_CONN_ACCEPT_Q_SIZE_MAX)
+#endif
+#endif
+
+
+#ifdef   NET_TCP_FAST_OPEN_MODULE_EN
+#ifndef  NET_TCP_DFLT_FAST_OPEN_CACHE_NBR_ENTRY
+                                                                /* Configure nbr of TCP Fast Open client cache entries. */
+    #define  NET_TCP_DFLT_FAST_OPEN_CACHE_NBR_ENTRY            8u
+#endif
+#endif
+
+
+#ifdef   NET_TCP_PATH_MTU_MODULE_EN
+#ifndef  NET_TCP_DFLT_PATH_MTU_CACHE_NBR_ENTRY
+                                                                /* Configure nbr of TCP path MTU cache entries.         */
+    #define  NET_TCP_DFLT_PATH_MTU_CACHE_NBR_ENTRY             8u
+#endif
+
+#ifndef  NET_TCP_DFLT_PATH_MTU_TIMEOUT_SEC
+                                                                /* Configure TCP path MTU cache timeout (in secs).      */
+    #define  NET_TCP_DFLT_PATH_MTU_TIMEOUT_SEC               600u
+#endif
+#endif
+
+
+#ifdef   NET_TCP_TIME_WAIT_MODULE_EN
+#ifndef  NET_TCP_DFLT_TIME_WAIT_NBR_ENTRY
+                                                                /* Configure nbr of TCP time-wait tbl entries.          */
+    #define  NET_TCP_DFLT_TIME_WAIT_NBR_ENTRY                 16u
+#endif
+#endif
+
+
+#ifdef   NET_TCP_RE_TX_Q_IDX_MODULE_EN
+#ifndef  NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY
+                                                                /* Configure nbr of TCP re-tx Q idx entries per conn.   */
+    #define  NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY               32u
+#endif
+#endif
+
+
+#ifdef   NET_TCP_ISN_SIPHASH_MODULE_EN
+#ifndef  NET_TCP_DFLT_ISN_REKEY_TIME_SEC
+                                                                /* Configure TCP ISN hash key rekey time (in secs).     */
+    #define  NET_TCP_DFLT_ISN_REKEY_TIME_SEC                3600u
+#endif
+#endif
+
+
 
 #ifndef  NET_TCP_DFLT_TIMEOUT_CONN_MAX_SEG_SEC
                                                                 /* Configure TCP connections' default maximum ...       */
@@ -223,13 +295,23 @@
 * Note(s) : (1) See 'TCP HEADER  Note #2' for flag fields.
 *
 *           (2) Urgent pointer & data NOT supported (see 'net_tcp.h  Note #1b').
+*
+*           (3) The ECN-Echo (ECE) & Congestion Window Reduced (CWR) flags are taken from the reserved flag
+*               field (see RFC #3168, Section 6.1) & are reserved ONLY if TCP ECN is NOT enabled (see
+*               'TCP ECN DEFINES').
 *********************************************************************************************************
 */
 
 #define  NET_TCP_HDR_FLAG_MASK                        0x0FFFu
 
 #define  NET_TCP_HDR_FLAG_NONE                    DEF_BIT_NONE
+#ifdef  NET_TCP_ECN_MODULE_EN
+#define  NET_TCP_HDR_FLAG_RESERVED                    0x0F20u   /* MUST be '0' (see Note #3).                           */
+#else
 #define  NET_TCP_HDR_FLAG_RESERVED                    0x0FE0u   /* MUST be '0'.                                         */
+#endif
+#define  NET_TCP_HDR_FLAG_CWR                     DEF_BIT_07    /* See Note #3.                                         */
+#define  NET_TCP_HDR_FLAG_ECE                     DEF_BIT_06    /* See Note #3.                                         */
 #define  NET_TCP_HDR_FLAG_URGENT                  DEF_BIT_05    /* See Note #2.                                         */
 #define  NET_TCP_HDR_FLAG_ACK                     DEF_BIT_04
 #define  NET_TCP_HDR_FLAG_PUSH                    DEF_BIT_03
@@ -259,11 +341,19 @@
 #define  NET_TCP_FLAG_TX_PUSH                     NET_TCP_HDR_FLAG_PUSH
 #define  NET_TCP_FLAG_TX_ACK                      NET_TCP_HDR_FLAG_ACK
 #define  NET_TCP_FLAG_TX_URGENT                   NET_TCP_HDR_FLAG_URGENT
+                                                                /* Seg tx flags ONLY; NOT valid as app tx flags.        */
+#define  NET_TCP_FLAG_TX_ECN_ECHO                 NET_TCP_HDR_FLAG_ECE
+#define  NET_TCP_FLAG_TX_CWR                      NET_TCP_HDR_FLAG_CWR
 
+#define  NET_TCP_FLAG_TX_DATA_VEC                 DEF_BIT_06    /* Tx app data from data vec cursor.                    */
 #define  NET_TCP_FLAG_TX_BLOCK                    DEF_BIT_07
+#define  NET_TCP_FLAG_TX_DATA_EXT                 DEF_BIT_10    /* Tx app data by ref from ext data cursor.             */
+#define  NET_TCP_FLAG_TX_DATA_FILE                DEF_BIT_11    /* Tx app data rd from file data cursor.                */
+#define  NET_TCP_FLAG_TX_MORE                     DEF_BIT_12    /* More tx app data follows; do NOT push.               */
 
                                                                 /* ------------------ TCP RX  FLAGS ------------------- */
 #define  NET_TCP_FLAG_RX_DATA_PEEK                DEF_BIT_08
+#define  NET_TCP_FLAG_RX_DATA_VEC                 DEF_BIT_09    /* Rx app data into data vec cursor.                    */
 #define  NET_TCP_FLAG_RX_BLOCK                    DEF_BIT_15
 
 
@@ -399,13 +489,125 @@
 *               RFC #793, Section 3.7 'Data Communication : Managing the Window' states that for "the
 *               window ... there is an assumption that this is related to the currently available data
 *               buffer space available for this connection".
+*
+*           (2) (a) RFC #7323, Section 2.2 states that "the window field ... in a segment ... is
+*                   interpreted as a scaled value ... by shifting it left by Snd.Wind.Shift bits".
+*
+*               (b) RFC #7323, Section 2.3 states that "the maximum scale exponent is limited to 14 for
+*                   a maximum permissible receive window size of 1 GiB".
+*
+*               (c) Window scaling is negotiated ONLY on SYN segments; the window field in SYN segments
+*                   is NEVER scaled (see RFC #7323, Section 2.2).
+*
+*               (d) Without window scaling, TCP window sizes are limited to the 16-bit header field.
 *********************************************************************************************************
 */
 
 #define  NET_TCP_WIN_SIZE_NONE                             0
 
 #define  NET_TCP_WIN_SIZE_MIN                            NET_TCP_MAX_SEG_SIZE_MIN
+#ifdef   NET_TCP_WIN_SCALE_MODULE_EN                            /* See Note #2b.                                        */
+#define  NET_TCP_WIN_SIZE_MAX                          (DEF_INT_16U_MAX_VAL << NET_TCP_WIN_SCALE_MAX)
+#else                                                           /* See Note #2d.                                        */
 #define  NET_TCP_WIN_SIZE_MAX                            DEF_INT_16U_MAX_VAL
+#endif
+
+#define  NET_TCP_WIN_SIZE_HDR_MAX                        DEF_INT_16U_MAX_VAL
+
+#define  NET_TCP_WIN_SCALE_NONE                          DEF_INT_08U_MAX_VAL
+#define  NET_TCP_WIN_SCALE_MIN                             0u
+#define  NET_TCP_WIN_SCALE_MAX                            14u   /* See Note #2b.                                        */
+
+
+/*
+*********************************************************************************************************
+*                                TCP RECEIVE WINDOW AUTO-TUNING DEFINES
+*
+* Note(s) : (1) A fixed receive window limits a connection's throughput to one window per round-trip
+*               time.  To sustain the rate at which the application drains received data, a receive
+*               window SHOULD be at least twice the data drained per round-trip time, so the sender
+*               is NOT throttled while the application reads the previous window's data.
+*
+*           (2) (a) Each connection's configured receive window is re-evaluated once per round-trip
+*                   time, from the data octets read by the application during that interval :
+*
+*                       Target Window  =  Data Octets Read  *  NET_TCP_RX_WIN_TUNE_SCALAR
+*
+*               (b) The receive window is NEVER tuned below the connection's configured receive window
+*                   size NOR above the maximum auto-tuned receive window size.
+*
+*               (c) The round-trip time is measured by the receiver as the time to receive one receive
+*                   window of data; if NOT yet measured, the transmit smoothed round-trip time is used,
+*                   or a default round-trip time if NO round-trip time is available.
+*
+*           (3) The total receive window growth of ALL connections is bounded by the global maximum
+*               auto-tuned receive window size.  Also, while the receive buffer pool's available buffers
+*               are low, receive windows are NOT grown & are shrunk back towards their target windows.
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_RX_WIN_TUNE_SCALAR                        2    /* See Note #2a.                                        */
+
+#define  NET_TCP_RX_WIN_TUNE_RTT_NONE                      0u
+#define  NET_TCP_RX_WIN_TUNE_RTT_MIN_MS                   10u   /* See Note #2c.                                        */
+#define  NET_TCP_RX_WIN_TUNE_RTT_DFLT_MS                 100u
+#define  NET_TCP_RX_WIN_TUNE_RTT_AVG_DENOM                 8
+
+                                                                /* See Note #3.                                         */
+#define  NET_TCP_RX_WIN_TUNE_POOL_LOW_NUMER                1
+#define  NET_TCP_RX_WIN_TUNE_POOL_LOW_DENOM                4
+
+
+/*
+*********************************************************************************************************
+*                                       TCP SYN CACHE DEFINES
+*
+* Note(s) : (1) Connection requests received by a LISTEN-state half-connection are NOT allocated a TCP
+*               connection.  Instead, the request is held in a compact SYN cache entry & a stateless
+*               synchronization segment is transmitted; a TCP connection is allocated ONLY when the
+*               final acknowledgement of the three-way handshake is received.
+*
+*           (2) (a) The initial send sequence number (ISS) of every cached connection request is a SYN
+*                   cookie, so that handshakes can be completed even if the SYN cache is full :
+*
+*                   ISS  =  (Hash & NET_TCP_SYN_COOKIE_HASH_MASK)                                    |
+*                           ((Time Counter & NET_TCP_SYN_COOKIE_TS_MASK) << NET_TCP_SYN_COOKIE_TS_SHIFT) |
+*                            Max Seg Index
+*
+*                   where
+*                           Hash            MD5 hash of the connection addresses, the remote host's
+*                                               initial sequence number, the time counter & the secret
+*                                               key shared with the initial sequence number generator
+*                           Time Counter    Time stamp divided by NET_TCP_SYN_COOKIE_PERIOD_MS
+*                           Max Seg Index   Index of the largest maximum segment size cookie table value
+*                                               NOT greater than the remote host's maximum segment size
+*
+*               (b) SYN cookies are accepted for NET_TCP_SYN_COOKIE_AGE_MAX time counter periods.
+*
+*               (c) Connection options that do NOT fit in a SYN cookie (e.g. window scale) are negotiated
+*                   ONLY for connection requests held in the SYN cache.
+*
+*           (3) (a) SYN cache synchronization segments are NOT re-transmitted; a lost synchronization
+*                   segment is recovered when the remote host re-transmits its connection request.  Entries
+*                   older than the SYN cache timeout are re-used by subsequent connection requests.
+*
+*               (b) The SYN cache timeout MUST NOT be shorter than the SYN cookie lifetime.  Otherwise, a
+*                   final acknowledgement received after its entry expired would be completed by its SYN
+*                   cookie alone, without the options already offered to the remote host (see Note #2c).
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_SYN_COOKIE_PERIOD_MS                  64000u   /* See Note #2a.                                        */
+#define  NET_TCP_SYN_COOKIE_AGE_MAX                        2u   /* See Note #2b.                                        */
+                                                                /* See Note #3b.                                        */
+#define  NET_TCP_SYN_CACHE_TIMEOUT_MS                   (NET_TCP_SYN_COOKIE_PERIOD_MS * NET_TCP_SYN_COOKIE_AGE_MAX)
+
+#define  NET_TCP_SYN_COOKIE_HASH_MASK             0xFFFFFF00u
+#define  NET_TCP_SYN_COOKIE_TS_MASK                     0x1Fu
+#define  NET_TCP_SYN_COOKIE_TS_SHIFT                       3u
+#define  NET_TCP_SYN_COOKIE_MSS_MASK                    0x07u
+
+#define  NET_TCP_SYN_COOKIE_MSS_NBR                        8u   /* Nbr of max seg size cookie tbl vals.                 */
 
 
 /*
@@ -460,6 +662,8 @@
 *                   (5) TYPE =  6   Echo Request                See 'net_tcp.h  Note #1c3'
 *                   (6) TYPE =  7   Echo Reply                  See 'net_tcp.h  Note #1c3'
 *                   (7) TYPE =  8   Timestamp                   See 'net_tcp.h  Note #1c4'
+*                   (8) TYPE = 34   TCP Fast Open Cookie        See RFC #7413, Section 4.1.1;
+*                                                                   'TCP FAST OPEN DEFINES'
 *
 *           (3) TCP header allows for a maximum option list length of 40 octets :
 *
@@ -483,6 +687,7 @@
 #define  NET_TCP_HDR_OPT_ECHO_REQ                          6u
 #define  NET_TCP_HDR_OPT_ECHO_REPLY                        7u
 #define  NET_TCP_HDR_OPT_TS                                8u
+#define  NET_TCP_HDR_OPT_FAST_OPEN                        34u
 
 #define  NET_TCP_HDR_OPT_PAD                             NET_TCP_HDR_OPT_END_LIST
 
@@ -536,7 +741,8 @@ typedef  enum  net_tcp_opt_type {
     NET_TCP_OPT_TYPE_SACK,                                  /* See 'net_tcp.h  Note #1c2'.  */
     NET_TCP_OPT_TYPE_ECHO_REQ,                              /* See 'net_tcp.h  Note #1c3'.  */
     NET_TCP_OPT_TYPE_ECHO_REPLY,                            /* See 'net_tcp.h  Note #1c3'.  */
-    NET_TCP_OPT_TYPE_TS                                     /* See 'net_tcp.h  Note #1c4'.  */
+    NET_TCP_OPT_TYPE_TS,                                    /* See 'net_tcp.h  Note #1c4'.  */
+    NET_TCP_OPT_TYPE_FAST_OPEN                              /* See 'TCP FAST OPEN DEFINES'. */
 } NET_TCP_OPT_TYPE;
 
 
@@ -714,6 +920,7 @@ typedef  enum  net_tcp_opt_type {
 #define  NET_TCP_CONN_TX_WIN_SEG_RXD                     155u   /* Update  cur tx        win size based on rx'd seg.    */
 #define  NET_TCP_CONN_TX_WIN_TIMEOUT                     156u   /* Timeout cur tx        win size.                      */
 #define  NET_TCP_CONN_TX_WIN_REMOTE_UPDATE               157u   /* Update  cur tx remote win size.                      */
+#define  NET_TCP_CONN_TX_WIN_ECN_ECHO                    158u   /* Reduce  cur tx        win size on rx'd ECN echo.     */
 
 #define  NET_TCP_CONN_TX_WIN_CONG_INC_SLOW_START         160u   /* Inc         tx cong   win size based on slow start.  */
 #define  NET_TCP_CONN_TX_WIN_CONG_INC_CONG_AVOID         161u   /* Inc         tx cong   win size based on cong avoid.  */
@@ -1239,7 +1446,10 @@ typedef  enum  net_tcp_opt_type {
 #define  NET_TCP_TX_RTT_TS_NONE                            0
 
                                                                 /* RTT clk resolution (see Note #3b1A2).                */
-#if     (NET_TMR_TASK_PERIOD_mS > 0)
+#if     (defined(NET_TMR_HI_RES_MODULE_EN) && \
+         (NET_TMR_HI_RES_PERIOD_mS > 0))
+#define  NET_TCP_TX_RTT_TS_CLK_MS                        NET_TMR_HI_RES_PERIOD_mS
+#elif   (NET_TMR_TASK_PERIOD_mS > 0)
 #define  NET_TCP_TX_RTT_TS_CLK_MS                        NET_TMR_TASK_PERIOD_mS
 #else
 #define  NET_TCP_TX_RTT_TS_CLK_MS                        NET_TMR_TIME_TICK
@@ -1250,7 +1460,11 @@ typedef  enum  net_tcp_opt_type {
 
 #define  NET_TCP_TX_RTO_NONE                               0
 
+#ifdef   NET_TMR_HI_RES_MODULE_EN
+#define  NET_TCP_TX_RTO_MIN_TIMEOUT_MS                    30    /* RTO min timeout      =  30 ms   (see Note #3b1A1b).  */
+#else
 #define  NET_TCP_TX_RTO_MIN_TIMEOUT_MS                   100    /* RTO min timeout      = 100 ms   (see Note #3b1A1).   */
+#endif
 #define  NET_TCP_TX_RTO_MIN_TIMEOUT_MS_SCALED           (NET_TCP_TX_RTO_MIN_TIMEOUT_MS  * NET_TCP_TX_RTT_SCALE)
 
 
@@ -1271,6 +1485,396 @@ typedef  enum  net_tcp_opt_type {
 #define  NET_TCP_TX_RTT_RTO_STATE_RE_TX                   30u
 
 
+/*
+*********************************************************************************************************
+*                                          TCP TIMER DEFINES
+*
+* Note(s) : (1) (a) TCP retransmit, delayed acknowledgement, silly window, zero window & transmit queue idle
+*                   timers are allocated as high-resolution network timers, if enabled, so that their
+*                   timeouts are NOT rounded up to the network timer task period.
+*
+*                   See also 'net_tmr.c  NetTmr_GetHiRes()  Note #2'.
+*
+*               (b) TCP connection, user, MSL & FIN-WAIT-2 timeouts are in seconds & remain allocated as
+*                   network timer task timers.
+*
+*           (2) With high-resolution timers, the RTO lower bound is lowered to the lower end of the range
+*               used by modern TCP/IP implementations.
+*
+*               See also 'TCP ROUND-TRIP TIME (RTT) / RE-TRANSMIT TIMEOUT (RTO) DEFINES  Note #3b1A1b'.
+*********************************************************************************************************
+*/
+
+#ifdef   NET_TMR_HI_RES_MODULE_EN
+#define  NET_TCP_TMR_TICK_PER_SEC                        NET_TMR_HI_RES_TICK_PER_SEC
+
+#define  NET_TCP_TMR_GET(fnct, obj, time, p_err)         NetTmr_GetHiRes((fnct), (obj), (time), (p_err))
+#else
+#define  NET_TCP_TMR_TICK_PER_SEC                        NET_TMR_TIME_TICK_PER_SEC
+
+#define  NET_TCP_TMR_GET(fnct, obj, time, p_err)         NetTmr_Get((fnct), (obj), (time), (p_err))
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         TCP RACK-TLP DEFINES
+*
+* Note(s) : (1) RFC #8985, Abstract states that "RACK-TLP uses per-segment transmit timestamps ... Recent
+*               Acknowledgment (RACK) starts fast recovery quickly using time-based inferences derived from
+*               acknowledgment (ACK) feedback" :
+*
+*               (a) RACK.xmit_ts  =  transmit timestamp of the most recently sent segment that has been
+*                                        acknowledged (see 'TCP_RTT_TS_Txd_ms');
+*
+*                   RACK.rtt      =  round-trip time of that segment.
+*
+*               (b) The segment at the head of the re-transmit queue is lost if it was sent before
+*                   RACK.xmit_ts &
+*
+*                       Now  -  Segment.xmit_ts  >=  RACK.rtt  +  RACK.reo_wnd
+*
+*                   where RACK.reo_wnd = Minimum RTT / NET_TCP_RACK_REO_WIN_DIV.
+*
+*               (c) Since NO selective acknowledgements are supported, RACK detects segments lost after
+*                   later-sent re-transmitted segments are acknowledged (e.g. after a tail loss probe or
+*                   after several segments from one window are lost).
+*
+*           (2) RFC #8985, Abstract adds that "Tail Loss Probe (TLP) leverages RACK and sends a probe packet
+*               to trigger ACK feedback to avoid retransmission timeout (RTO) events" :
+*
+*               (a) The re-transmit queue timer is armed with the Probe Timeout (PTO) instead of the RTO,
+*                   if shorter :
+*
+*                       PTO  =  SRTT * NET_TCP_TLP_PTO_RTT_SCALAR
+*
+*                   (1) If only one segment is outstanding, the remote host's worst-case delayed
+*                       acknowledgement time, NET_TCP_TLP_PTO_ACK_DLY_MS, is added.
+*
+*               (b) At most one probe is outstanding until new data is acknowledged.  The probe
+*                   re-transmits the segment at the head of the re-transmit queue, which is the last
+*                   segment sent whenever only the tail of a window was lost.
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_RACK_TS_NONE                              0u
+#define  NET_TCP_RACK_REO_WIN_DIV                          4    /* See Note #1b.                                        */
+
+#define  NET_TCP_TLP_PTO_RTT_SCALAR                        2    /* See Note #2a.                                        */
+#define  NET_TCP_TLP_PTO_ACK_DLY_MS                      200    /* See Note #2a1.                                       */
+
+
+/*
+*********************************************************************************************************
+*                                     TCP TRANSMIT PACING DEFINES
+*
+* Note(s) : (1) (a) A paced TCP connection spreads its transmit queue segments over each round-trip time
+*                   instead of transmitting them back-to-back as soon as the transmit windows open :
+*
+*                       Pacing rate  =  Gain  *  Congestion window  /  SRTT
+*
+*                   where
+*                       (1) Gain = NET_TCP_TX_PACE_GAIN_SLOW_START_PCT while in slow start, so that the
+*                                  congestion window may still double every round-trip time; ...
+*                       (2) Gain = NET_TCP_TX_PACE_GAIN_CONG_AVOID_PCT otherwise.
+*
+*               (b) Until a smoothed round-trip time is measured, a TCP connection is paced ONLY by its
+*                   configured maximum rate, if any.
+*
+*               (c) A configured maximum rate limits the pacing rate; NET_TCP_TX_PACE_RATE_AUTO paces a
+*                   TCP connection by its congestion window & round-trip time ONLY.
+*
+*           (2) Pacing is implemented as a token bucket, in octets, refilled at the pacing rate & limited to
+*               NET_TCP_TX_PACE_BURST_SEG_NBR maximum-sized segments so that a TCP connection does NOT
+*               accumulate an unbounded burst while idle.
+*
+*           (3) Pacing delays are scheduled on the TCP timers & are therefore as fine-grained as the
+*               high-resolution network timers, if enabled (see 'TCP TIMER DEFINES  Note #1a').
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_TX_PACE_RATE_NONE                         0u   /* Tx pacing dis'd.                                     */
+#define  NET_TCP_TX_PACE_RATE_AUTO       DEF_INT_32U_MAX_VAL    /* Tx pacing by cong win & RTT ONLY (see Note #1c).     */
+
+#define  NET_TCP_TX_PACE_GAIN_SLOW_START_PCT             200u   /* See Note #1a1.                                       */
+#define  NET_TCP_TX_PACE_GAIN_CONG_AVOID_PCT             120u   /* See Note #1a2.                                       */
+
+#define  NET_TCP_TX_PACE_BURST_SEG_NBR                     2u   /* See Note #2.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                           TCP ECN DEFINES
+*
+* Note(s) : (1) RFC #3168, Section 6.1.1 negotiates Explicit Congestion Notification (ECN) in the TCP
+*               connection handshake :
+*
+*               (a) An active open transmits its SYN with BOTH the ECE & CWR flags set; ECN is enabled if
+*                   the remote host's SYN/ACK has the ECE flag set & the CWR flag clear.
+*
+*               (b) A passive open that receives a SYN with BOTH the ECE & CWR flags set transmits its
+*                   SYN/ACK with the ECE flag set & the CWR flag clear & enables ECN.
+*
+*               (c) A connection request answered from the TCP SYN cache enables ECN ONLY if the request
+*                   is still cached when the handshake completes, since SYN cookies do NOT encode ECN
+*                   (see 'TCP SYN CACHE DEFINES  Note #2c').
+*
+*           (2) RFC #3168, Section 6.1.3 requires a TCP receiver that receives a segment marked CE to set
+*               the ECE flag in EVERY transmitted acknowledgement until it receives a segment with the CWR
+*               flag set.
+*
+*           (3) RFC #3168, Section 6.1.2 requires a TCP sender that receives an ECE acknowledgement to :
+*
+*               (a) Reduce its transmit congestion window as for fast re-transmit, but WITHOUT re-transmitting
+*                   any segment ...
+*               (b) ... & at most once per transmit window of data.
+*
+*               (c) Set the CWR flag in the next transmitted new data segment.
+*
+*           (4) RFC #3168, Sections 6.1.4 & 6.1.5 permit ONLY new data segments to be marked ECN-capable;
+*               acknowledgement-only, synchronization, re-transmitted & window probe segments are
+*               transmitted as Not-ECT.
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_ECN_TX_ECT                 NET_IP_ECN_ECT_0    /* See Note #4.                                         */
+
+
+/*
+*********************************************************************************************************
+*                                        TCP FAST OPEN DEFINES
+*
+* Note(s) : (1) RFC #7413, Section 4 carries application data in the SYN of a connection request that
+*               presents a valid server cookie :
+*
+*               (a) A client that holds NO cookie for a server transmits its SYN with an empty TCP Fast Open
+*                   option to request a cookie; the server returns a cookie in its SYN/ACK's TCP Fast Open
+*                   option which the client caches for subsequent connections.
+*
+*               (b) A client that holds a cookie for a server transmits the cookie & up to one maximum
+*                   segment size of application data in its SYN.  Any SYN data NOT acknowledged by the
+*                   server's SYN/ACK is re-transmitted as a normal data segment.
+*
+*               (c) A server accepts the data in a SYN ONLY if the SYN carries a valid cookie; otherwise
+*                   the SYN's data is discarded & the connection request proceeds as a normal three-way
+*                   handshake.
+*
+*           (2) Server cookies are generated by an MD5 hash of the client's IP address & the TCP secret
+*               key, truncated to NET_TCP_FAST_OPEN_COOKIE_LEN octets (see RFC #7413, Section 4.1.2).
+*
+*           (3) Data received in a SYN is queued to the connection like any other received data & is
+*               made available to the application once the connection is accepted.
+*
+*           (4) Connection requests that carry a valid cookie bypass the TCP SYN cache since the
+*               cache does NOT hold received data (see 'TCP SYN CACHE DEFINES').
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_FAST_OPEN_COOKIE_LEN                      8u   /* See Note #2.                                         */
+#define  NET_TCP_FAST_OPEN_COOKIE_LEN_MIN                  4u   /* See RFC #7413, Section 4.1.1.                        */
+#define  NET_TCP_FAST_OPEN_COOKIE_LEN_MAX                 16u
+#define  NET_TCP_FAST_OPEN_COOKIE_LEN_REQ                  0u   /* See Note #1a.                                        */
+#define  NET_TCP_FAST_OPEN_COOKIE_LEN_NONE               DEF_INT_08U_MAX_VAL
+
+
+/*
+*********************************************************************************************************
+*                                   TCP PATH MTU DISCOVERY DEFINES
+*
+* Note(s) : (1) RFC #1191, Section 3 & RFC #8201, Section 4 discover a path's MTU from the ICMP messages
+*               returned by routers that can NOT forward a packet without fragmentation :
+*
+*               (a) ICMPv4 'Fragmentation Needed' & ICMPv6 'Packet Too Big' messages are demultiplexed to
+*                   the TCP connection identified by the addresses & ports of the segment quoted in the
+*                   message.  Messages that quote a sequence number NOT currently un-acknowledged by the
+*                   connection are ignored (see RFC #5927, Section 4.1).
+*
+*               (b) A connection's path maximum segment size is the reported MTU less the minimum IP & TCP
+*                   header sizes but is NEVER reduced below the default transmit maximum segment size (see
+*                   'TCP SEGMENT SIZE DEFINES  Note #1b2').  The connection's maximum segment size is then
+*                   limited to its path maximum segment size.
+*
+*               (c) IPv4 data segments that fit the connection's maximum segment size are transmitted with
+*                   the 'Don't Fragment' flag set so that routers report a smaller path MTU.  Segments
+*                   queued before the path MTU was reduced are re-transmitted without the flag & are
+*                   fragmented by the routers along the path.
+*
+*               (d) Since IPv6 packets are NEVER fragmented by routers & IPv6 transmit fragmentation is NOT
+*                   currently supported, IPv6 segments queued before the path MTU was reduced are
+*                   re-transmitted at their original size.
+*
+*           (2) RFC #2923, Section 2.1 & RFC #4821, Section 1 describe 'black hole' paths whose routers drop
+*               large packets without returning any ICMP message :
+*
+*               (a) A segment that is re-transmitted NET_TCP_PATH_MTU_BLACK_HOLE_RE_TX_TH times on
+*                   re-transmit timeouts reduces the connection's path MTU to the black hole MTU ...
+*
+*               (b) ... the minimum IPv6 link MTU (see RFC #8200, Section 5), which nearly all paths
+*                   forward.  A segment that still fits the black hole MTU reduces the connection's path
+*                   maximum segment size to the default transmit maximum segment size.
+*
+*           (3) Path maximum segment sizes are cached per remote host so that subsequent connections to the
+*               host start at the discovered size :
+*
+*               (a) Cached path maximum segment sizes expire after NET_TCP_DFLT_PATH_MTU_TIMEOUT_SEC (see
+*                   RFC #1191, Section 6.3).
+*
+*               (b) A connection whose path maximum segment size expires probes for a larger path MTU by
+*                   transmitting subsequent segments at its full maximum segment size (see RFC #4821,
+*                   Section 7.7).
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_PATH_MTU_BLACK_HOLE_RE_TX_TH              2u   /* See Note #2a.                                        */
+#define  NET_TCP_PATH_MTU_BLACK_HOLE_MTU                1280u   /* See Note #2b.                                        */
+
+#define  NET_TCP_PATH_MTU_TIMEOUT_MS                    (NET_TCP_DFLT_PATH_MTU_TIMEOUT_SEC * DEF_TIME_NBR_mS_PER_SEC)
+
+
+/*
+*********************************************************************************************************
+*                                       TCP TIME-WAIT DEFINES
+*
+* Note(s) : (1) RFC #793, Section 3.5 holds a closed connection in the TIME-WAIT state for twice the maximum
+*               segment lifetime (2MSL) so that any re-transmitted remote FIN can be acknowledged & so that
+*               old duplicate segments are NOT accepted by a new incarnation of the connection.  Since ONLY
+*               the connection's addresses & sequence numbers are needed for this, a connection entering
+*               the TIME-WAIT state is freed & its TIME-WAIT state is held in a compact time-wait entry :
+*
+*               (a) Connections whose maximum segment lifetime is zero are NOT compacted since they close
+*                   on entering the TIME-WAIT state.
+*
+*               (b) If NO time-wait entry is free or expired, the connection is held in the TIME-WAIT state
+*                   until its time-wait timer expires.
+*
+*           (2) Segments received for a time-wait entry are handled as by the TIME-WAIT state :
+*
+*               (a) A reset segment whose sequence number is the next expected sequence number frees the
+*                   entry (see RFC #793, Section 3.9 'SEGMENT ARRIVES : Check RST Bit'); other reset
+*                   segments are silently discarded.
+*
+*               (b) RFC #1122, Section 4.2.2.13 allows a new connection request to re-open a connection in
+*                   the TIME-WAIT state if its initial sequence number is greater than the largest sequence
+*                   number received.  Such connection requests free the entry & are demultiplexed to any
+*                   listening connection.
+*
+*               (c) Any other segment is acknowledged with the receive window saved when the connection
+*                   was compacted; a re-transmitted FIN also restarts the 2MSL timeout.  Acknowledgement-
+*                   only segments are silently discarded.
+*
+*           (3) Time-wait entries expire when searched rather than by network timers so that compacted
+*               connections do NOT consume timers.
+*
+*           (4) Since a compacted connection's addresses are NO longer held by a network connection, a
+*               socket connection request to the same local & remote addresses is refused until the
+*               time-wait entry expires, unless the socket's local port was randomly selected & another
+*               random local port can be used (see 'net_sock.c  NetSock_ConnHandlerAddr()  Note #2').
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                      TCP ADAPTIVE ACK DEFINES
+*
+* Note(s) : (1) A connection acknowledges every received data segment while in quick-ack mode so that the
+*               remote host's congestion window opens at the rate of one MSS per segment :
+*
+*               (a) Quick-ack mode is entered for the first NET_TCP_ACK_QUICK_CNT data segments received on
+*                   each connection, during which the remote host's slow start is most sensitive to delayed
+*                   acknowledgements.
+*
+*               (b) Quick-ack mode is re-entered whenever out-of-order segments are received (see
+*                   'net_tcp.c  NetTCP_RxPktConnHandlerRxQ_Conn()  Note #7') so that the remote host's fast
+*                   re-transmit & fast recovery are clocked by an acknowledgement for every segment
+*                   following a loss.
+*
+*           (2) Otherwise, a single delayed acknowledgement is transmitted for several received data segments
+*               (ack decimation) :
+*
+*               (a) The number of data segments per acknowledgement is one quarter of the number of maximum
+*                   sized segments in the connection's configured receive window so that at least
+*                   NET_TCP_ACK_DECIMATION_WIN_DIV acknowledgements are transmitted per receive window ...
+*
+*               (b) ... but is NEVER less than NET_TCP_ACK_DLY_CNT_TH (see 'TCP CONGESTION CONTROL DEFINES
+*                   Note #6a') nor greater than NET_TCP_ACK_DECIMATION_CNT_MAX.
+*
+*               (c) The acknowledgement delay timeout still limits the delay of any acknowledgement (see
+*                   RFC #1122, Section 4.2.3.2).
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_ACK_QUICK_CNT                            16u   /* See Note #1a.                                        */
+
+#define  NET_TCP_ACK_DECIMATION_WIN_DIV                    4u   /* See Note #2a.                                        */
+#define  NET_TCP_ACK_DECIMATION_CNT_MAX                    8u   /* See Note #2b.                                        */
+
+
+/*
+*********************************************************************************************************
+*                                  TCP RE-TRANSMIT QUEUE INDEX DEFINES
+*
+* Note(s) : (1) A connection's re-transmit queue segments are also held, in sequence number order, in the
+*               connection's re-transmit queue index, a circular array of NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY
+*               entries :
+*
+*               (a) Segments are added to the index tail as they are moved from the transmit queue to the
+*                   re-transmit queue & removed from the index head as they are fully acknowledged.
+*
+*               (b) Each entry holds the segment's end sequence number, the sequence number following the
+*                   segment's last octet.  A segment's end sequence number does NOT change while the segment
+*                   is queued for re-transmission since partial acknowledgements only advance the segment's
+*                   start sequence number (see 'net_tcp.c  NetTCP_RxPktConnHandlerReTxQ()  Note #6').
+*
+*               (c) A segment's transmit timestamp & re-transmit count are held in its network buffer header
+*                   ('TCP_RTT_TS_Txd_ms' & 'TCP_SegReTxCtr').
+*
+*           (2) Received acknowledgements are handled with the index :
+*
+*               (a) The fully acknowledged segments are located by a binary search of the entries' end
+*                   sequence numbers ...
+*
+*               (b) ... & are unlinked from the re-transmit queue as a single list of segments.
+*
+*           (3) If the index is full, subsequent re-transmit queue segments are NOT indexed :
+*
+*               (a) Acknowledgements of segments NOT indexed are handled by walking the re-transmit queue.
+*
+*               (b) Once ALL indexed segments are acknowledged, the index is rebuilt from the remaining
+*                   re-transmit queue segments.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                      TCP ISN SIPHASH DEFINES
+*
+* Note(s) : (1) RFC #6528, Section 3 generates initial sequence numbers as :
+*
+*                   ISN  =  M  +  F(localip, localport, remoteip, remoteport, secretkey)
+*
+*               (a) F is a keyed SipHash-2-4 hash of the connection's addresses & ports, truncated to its
+*                   lower 32 bits.  The 128-bit hash key serves as RFC #6528's secret key.
+*
+*               (b) The hash key is separate from the secret key shared by the SYN cache & TCP Fast Open
+*                   cookies so that rekeying does NOT invalidate any outstanding cookies.
+*
+*           (2) The hash key is regenerated when an initial sequence number is requested at least
+*               NET_TCP_DFLT_ISN_REKEY_TIME_SEC seconds after the key was last generated :
+*
+*               (a) Rekeying changes F for every four-tuple.  A new incarnation of a connection opened
+*                   shortly after a rekey may thus be assigned an initial sequence number lower than the
+*                   previous incarnation's & is then NOT accepted by a remote host's TIME-WAIT state (see
+*                   RFC #1122, Section 4.2.2.13).  The rekey time SHOULD thus be much greater than 2MSL.
+*
+*               (b) A rekey time of zero disables rekeying.
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_ISN_REKEY_TIME_MAX_SEC                86400u   /* See Note #2.                                         */
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1326,7 +1930,7 @@ typedef  CPU_INT16U  NET_TCP_SEG_SIZE;
 */
 
 #if 0                                                           /* See Note #1.                                         */
-typedef  CPU_INT16U  NET_TCP_WIN_SIZE;
+typedef  CPU_INT32U  NET_TCP_WIN_SIZE;
 #endif
 
 
@@ -1429,6 +2033,29 @@ typedef  CPU_INT32U  NET_TCP_TIMEOUT_MS;
 typedef  CPU_INT16U  NET_TCP_TIMEOUT_SEC;
 
 
+/*
+*********************************************************************************************************
+*                                   TCP TRANSMIT PACING DATA TYPES
+*
+* Note(s) : (1) TCP transmit pacing rates are configured in octets per second but maintained in octets per
+*               millisecond.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+typedef  CPU_INT32U  NET_TCP_TX_PACE_RATE;                      /* Tx pacing rate (see Note #1).                        */
+
+
+typedef  struct  net_tcp_tx_pace_stat {
+    NET_TCP_TX_PACE_RATE                 RateCfgd;                      /* Tx pacing max rate cfg'd (in octets/sec).            */
+    NET_TCP_TX_PACE_RATE                 RateCur;                       /* Tx pacing cur rate       (in octets/sec).            */
+    CPU_INT32U                           Burst;                         /* Tx pacing burst size     (in octets    ).            */
+    CPU_INT32U                           Tokens;                        /* Tx pacing tokens avail   (in octets    ).            */
+    CPU_INT32U                           DlyCtr;                        /* Nbr of tx Q segs dly'd by tx pacing.                 */
+} NET_TCP_TX_PACE_STAT;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                  TCP CONNECTION QUANTITY DATA TYPE
@@ -1570,6 +2197,52 @@ typedef  struct  net_tcp_opt_cfg_max_seg_size {
 } NET_TCP_OPT_CFG_MAX_SEG_SIZE;
 
 
+/*
+*********************************************************************************************************
+*                          TCP WINDOW SCALE OPTION CONFIGURATION DATA TYPE
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+typedef  struct  net_tcp_opt_cfg_win_scale {
+    NET_TCP_OPT_TYPE        Type;
+    CPU_INT08U              WinScale;                           /* TCP win scale shift.                                 */
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_WIN_SCALE;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                          TCP FAST OPEN OPTION CONFIGURATION DATA TYPE
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+typedef  struct  net_tcp_opt_cfg_fast_open {
+    NET_TCP_OPT_TYPE        Type;
+    CPU_INT08U              CookieLen;                          /* TCP Fast Open cookie len.                            */
+    CPU_INT08U             *CookiePtr;                          /* Ptr to TCP Fast Open cookie.                         */
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_FAST_OPEN;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                               TCP RE-TRANSMIT QUEUE INDEX ENTRY DATA TYPE
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+typedef  struct  net_tcp_re_tx_q_idx_entry {
+    NET_BUF                *SegPtr;                             /* Ptr to re-tx Q seg.                                  */
+    NET_TCP_SEQ_NBR         SeqNbrEnd;                          /* Seg end seq nbr (see 'TCP RE-TRANSMIT QUEUE INDEX    */
+                                                                /*                  DEFINES  Note #1b').                */
+} NET_TCP_RE_TX_Q_IDX_ENTRY;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   APP CALLBACK FUNCTION DATA TYPE
@@ -1640,6 +2313,10 @@ struct  net_tcp_conn {
     NET_TCP_SEG_SIZE                     MaxSegSizeLocalActual;         /* Local max seg size actual/advertised to remote host. */
     NET_TCP_SEG_SIZE                     MaxSegSizeRemote;              /*       Max seg size        advertised by remote host. */
     NET_TCP_SEG_SIZE                     MaxSegSizeConn;                /*       Max seg size calc'd for conn.                  */
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+    NET_TCP_SEG_SIZE                     MaxSegSizePath;                /*       Max seg size limited by path MTU.              */
+    NET_TS_MS                            PathMTU_TS_ms;                 /* TS path max seg size reduced (in ms).                */
+#endif
 
 
 
@@ -1654,6 +2331,21 @@ struct  net_tcp_conn {
 
     NET_TCP_WIN_SIZE                     RxWinSizeUpdateTh;             /* Rx win size update th (rx silly win ctrl).           */
 
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    CPU_BOOLEAN                          WinScaleEn;                    /* Indicate whether win scale negotiated.               */
+    CPU_INT08U                           RxWinScale;                    /* Rx win scale shift (advertised   to   remote host).  */
+    CPU_INT08U                           TxWinScale;                    /* Tx win scale shift (advertised by     remote host).  */
+#endif
+
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+    NET_TCP_WIN_SIZE                     RxWinTuneBase;                 /* Rx win size cfg'd before auto-tuning.                */
+    NET_TCP_WIN_SIZE                     RxWinTuneRdCtr;                /* Rx data octets rd by app during cur tune interval.   */
+    NET_TS_MS                            RxWinTuneTS_ms;                /* Cur tune interval start TS (in ms).                  */
+    NET_TCP_SEQ_NBR                      RxWinTuneRTT_SeqNbr;           /* Rx seq nbr ending cur rx RTT measurement.            */
+    NET_TS_MS                            RxWinTuneRTT_TS_ms;            /* Cur rx RTT measurement start TS (in ms).             */
+    NET_TCP_TIMEOUT_MS                   RxWinTuneRTT_ms;               /* Rx RTT measured by rx'r         (in ms).             */
+#endif
+
 
     NET_TCP_RX_Q_STATE                   RxQ_State;                     /*                   Rx Q state.                        */
 
@@ -1707,6 +2399,42 @@ struct  net_tcp_conn {
 
     NET_TCP_WIN_SIZE                     TxWinSizeMinTh;                /* Tx  win size min th (tx silly win ctrl).             */
     CPU_BOOLEAN                          TxWinSizeNagleEn;              /* Tx  win size Nagle alg en.                           */
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+    CPU_BOOLEAN                          TxCorkEn;                      /* Tx  cork en.                                         */
+#endif
+
+#ifdef  NET_TCP_RACK_MODULE_EN
+    NET_TCP_TX_RTT_TS_MS                 TxRACK_TS_ms;                  /* RACK xmit TS of last-sent ack'd seg (in ms).         */
+    NET_TCP_TIMEOUT_MS                   TxRACK_RTT_ms;                 /* RACK RTT     of last-sent ack'd seg (in ms).         */
+    NET_TCP_TIMEOUT_MS                   TxRACK_RTT_Min_ms;             /* RACK min RTT                        (in ms).         */
+    CPU_BOOLEAN                          TxRACK_Recovery;               /* Indicate RACK loss recovery in progress.             */
+    NET_TCP_SEQ_NBR                      TxRACK_RecoverSeqNbr;          /* Tx seq nbr ending RACK loss recovery.                */
+    CPU_BOOLEAN                          TxTLP_Armed;                   /* Indicate re-tx Q tmr armed with TLP PTO.             */
+    CPU_BOOLEAN                          TxTLP_Txd;                     /* Indicate TLP probe outstanding.                      */
+#endif
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+    NET_TCP_TX_PACE_RATE                 TxPaceRateCfgd;                /* Tx  pacing max rate cfg'd (in octets/sec).           */
+    NET_TCP_TX_PACE_RATE                 TxPaceRate_ms;                 /* Tx  pacing cur rate       (in octets/ms ).           */
+    CPU_INT32U                           TxPaceBurst;                   /* Tx  pacing burst size     (in octets    ).           */
+    CPU_INT32U                           TxPaceTokens;                  /* Tx  pacing tokens avail   (in octets    ).           */
+    NET_TS_MS                            TxPaceTS_ms;                   /* Tx  pacing last refill TS (in ms        ).           */
+    CPU_INT32U                           TxPaceDlyCtr;                  /* Nbr of tx Q segs dly'd by tx pacing.                 */
+#endif
+
+#ifdef  NET_TCP_ECN_MODULE_EN
+    CPU_BOOLEAN                          ECN_En;                        /* Indicate whether ECN negotiated.                     */
+    CPU_BOOLEAN                          RxECN_EchoReqd;                /* Indicate rx'd CE to echo in tx'd acks.               */
+    CPU_BOOLEAN                          TxECN_CWR_Reqd;                /* Indicate CWR to tx on next new data seg.             */
+    CPU_BOOLEAN                          TxECN_Recovery;                /* Indicate ECN cong win reduction in progress.         */
+    NET_TCP_SEQ_NBR                      TxECN_RecoverSeqNbr;           /* Tx seq nbr ending ECN cong win reduction.            */
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+    CPU_BOOLEAN                          FastOpenEn;                    /* TCP Fast Open en.                                    */
+    NET_TCP_SEG_SIZE                     TxFastOpenDataLen;             /* Len of data tx'd in sync seg.                        */
+    CPU_BOOLEAN                          TxFastOpenCookieReqd;          /* Indicate TFO cookie to tx in sync seg.               */
+#endif
 
     NET_TCP_TIMEOUT_MS                   TxWinSillyWinTimeout_ms;       /* Tx  silly win timeout (in ms   ).                    */
     NET_TCP_TIMEOUT_MS                   TxWinZeroWinTimeout_ms;        /* Tx  zero  win timeout (in ms   ).                    */
@@ -1717,6 +2445,9 @@ struct  net_tcp_conn {
     NET_TMR_TICK                         TxAckDlyTimeout_tick;          /* Tx  ack dly timeout (in ticks).                      */
     NET_TMR                             *TxAckDlyTmr;                   /* Tx  ack dly tmr.                                     */
     CPU_INT16U                           TxAckDlyCnt;                   /* Tx  ack dly cur cnt.                                 */
+#ifdef  NET_TCP_ACK_ADAPT_MODULE_EN
+    CPU_INT16U                           TxAckQuickCnt;                 /* Tx  quick ack rem'ing cnt.                           */
+#endif
 
     CPU_BOOLEAN                          TxAckImmedRxdPushEn;           /* Tx  immed ack for rx'd TCP push seg(s) en.           */
 
@@ -1754,10 +2485,20 @@ struct  net_tcp_conn {
     NET_TMR                             *TxQ_IdleTmr;                   /*      Tx Q idle              tmr.                     */
     NET_TMR                             *TxQ_SillyWinTmr;               /*      Tx Q silly win persist tmr.                     */
     NET_TMR                             *TxQ_ZeroWinTmr;                /*      Tx Q zero  win persist tmr.                     */
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+    NET_TMR                             *TxQ_PaceTmr;                   /*      Tx Q pacing            tmr.                     */
+#endif
 
     NET_BUF                             *ReTxQ_Head;                    /* Head of Q of TCP pkts to re-tx on timeout.           */
     NET_BUF                             *ReTxQ_Tail;                    /* Tail of Q of TCP pkts to re-tx on timeout.           */
     NET_TMR                             *ReTxQ_Tmr;                     /*   Re-tx Q         tmr.                               */
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+                                                                        /*   Re-tx Q seq nbr idx.                               */
+    NET_TCP_RE_TX_Q_IDX_ENTRY            ReTxQ_Idx[NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY];
+    CPU_INT16U                           ReTxQ_IdxHead;                 /*   Re-tx Q idx head ix.                               */
+    CPU_INT16U                           ReTxQ_IdxNbr;                  /*   Re-tx Q idx nbr of idx'd segs.                     */
+    CPU_BOOLEAN                          ReTxQ_IdxOvf;                  /*   Re-tx Q idx ovf'd (tail segs NOT idx'd).           */
+#endif
 
 
 
@@ -1780,6 +2521,77 @@ struct  net_tcp_conn {
 };
 
 
+                                                                /* ---------------- NET TCP SYN CACHE ----------------- */
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+typedef  struct  net_tcp_syn_cache_entry {
+    NET_TCP_CONN_ID                      ConnID_Listen;                 /* TCP listen conn id (NONE if entry free).             */
+    NET_IF_NBR                           IF_Nbr;                        /* IF nbr   rx'd conn req.                              */
+
+                                                                        /* Conn local & remote addrs.                           */
+    CPU_INT08U                           AddrLocal [NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U                           AddrRemote[NET_CONN_ADDR_LEN_MAX];
+
+    NET_TCP_SEQ_NBR                      RxSeqNbrSync;                  /* Sync  rx seq nbr.                                    */
+    NET_TCP_SEQ_NBR                      TxSeqNbrSync;                  /* Sync  tx seq nbr (see Note #2a).                     */
+    NET_TCP_SEG_SIZE                     MaxSegSizeRemote;              /* Max seg size advertised by remote host.              */
+#ifdef  NET_TCP_WIN_SCALE_MODULE_EN
+    CPU_INT08U                           TxWinScale;                    /* Tx win scale shift advertised by remote host.        */
+#endif
+#ifdef  NET_TCP_ECN_MODULE_EN
+    CPU_BOOLEAN                          ECN_En;                        /* Indicate whether ECN req'd    by remote host.        */
+#endif
+
+    NET_TS_MS                            TS_ms;                         /* TS conn req rx'd (in ms).                            */
+} NET_TCP_SYN_CACHE_ENTRY;
+#endif
+
+
+                                                                /* ---------- NET TCP FAST OPEN COOKIE CACHE ---------- */
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+typedef  struct  net_tcp_fast_open_cache_entry {
+                                                                        /* Server addr (port clr'd).                            */
+    CPU_INT08U                           AddrRemote[NET_CONN_ADDR_LEN_MAX];
+
+    CPU_INT08U                           CookieLen;                     /* Cookie len (NONE if entry free).                     */
+    CPU_INT08U                           Cookie[NET_TCP_FAST_OPEN_COOKIE_LEN_MAX];
+
+    NET_TS_MS                            TS_ms;                         /* TS cookie last used (in ms).                         */
+} NET_TCP_FAST_OPEN_CACHE_ENTRY;
+#endif
+
+
+                                                                /* -------------- NET TCP PATH MTU CACHE -------------- */
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+typedef  struct  net_tcp_path_mtu_cache_entry {
+                                                                        /* Remote host addr (port clr'd).                       */
+    CPU_INT08U                           AddrRemote[NET_CONN_ADDR_LEN_MAX];
+
+    NET_TCP_SEG_SIZE                     MaxSegSize;                    /* Path max seg size (NONE if entry free).              */
+
+    NET_TS_MS                            TS_ms;                         /* TS path max seg size reduced (in ms).                */
+} NET_TCP_PATH_MTU_CACHE_ENTRY;
+#endif
+
+
+                                                                /* ---------------- NET TCP TIME-WAIT ----------------- */
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+typedef  struct  net_tcp_time_wait_entry {
+    NET_CONN_FAMILY                      Family;                        /* Conn family (NONE if entry free).                    */
+
+                                                                        /* Conn local & remote addrs.                           */
+    CPU_INT08U                           AddrLocal [NET_CONN_ADDR_LEN_MAX];
+    CPU_INT08U                           AddrRemote[NET_CONN_ADDR_LEN_MAX];
+
+    NET_TCP_SEQ_NBR                      RxSeqNbrNext;                  /* Next rx seq nbr (after rx'd FIN).                    */
+    NET_TCP_SEQ_NBR                      TxSeqNbrNext;                  /* Next tx seq nbr (after tx'd FIN).                    */
+    NET_TCP_WIN_SIZE                     RxWinSizeHdr;                  /* Rx win size (as adv'd in hdr).                       */
+
+    NET_TS_MS                            TS_ms;                         /* TS 2MSL timeout (re-)started (in ms).                */
+    NET_TS_MS                            Timeout_ms;                    /* 2MSL timeout                 (in ms).                */
+} NET_TCP_TIME_WAIT_ENTRY;
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1913,6 +2725,24 @@ CPU_BOOLEAN         NetTCP_ConnCfgTxNagleEn              (NET_TCP_CONN_ID
                                                           CPU_BOOLEAN                          nagle_en,
                                                           NET_ERR                             *p_err);
 
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+CPU_BOOLEAN         NetTCP_ConnCfgTxCorkEn               (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                          CPU_BOOLEAN                          cork_en,
+                                                          NET_ERR                             *p_err);
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+CPU_BOOLEAN         NetTCP_ConnCfgFastOpenEn             (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                          CPU_BOOLEAN                          fast_open_en,
+                                                          NET_ERR                             *p_err);
+#endif
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+CPU_BOOLEAN         NetTCP_ConnCfgTxPaceRate             (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                          NET_TCP_TX_PACE_RATE                 rate_max,
+                                                          NET_ERR                             *p_err);
+#endif
+
 CPU_BOOLEAN         NetTCP_ConnCfgTxAckImmedRxdPushEn    (NET_TCP_CONN_ID                      conn_id_tcp,
                                                           CPU_BOOLEAN                          tx_immed_ack_en,
                                                           NET_ERR                             *p_err);
@@ -1947,6 +2777,12 @@ void                NetTCP_ConnPoolStatResetMaxUsed      (void);
 
 NET_TCP_CONN_STATE  NetTCP_ConnStateGet                  (NET_TCP_CONN_ID                      conn_id);
 
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+CPU_BOOLEAN         NetTCP_ConnTxPaceStatGet             (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                          NET_TCP_TX_PACE_STAT                *p_stat,
+                                                          NET_ERR                             *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1960,6 +2796,22 @@ void             NetTCP_Init                          (NET_ERR              *p_e
 void             NetTCP_Rx                            (NET_BUF              *pbuf,
                                                        NET_ERR              *p_err);
 
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+#ifdef  NET_IPv4_MODULE_EN
+void             NetTCP_RxPathMTU_IPv4                (NET_IPv4_ADDR         addr_src,
+                                                       NET_IPv4_ADDR         addr_dest,
+                                                       NET_TCP_HDR          *p_tcp_hdr,
+                                                       CPU_INT32U            mtu);
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+void             NetTCP_RxPathMTU_IPv6                (NET_IPv6_ADDR        *p_addr_src,
+                                                       NET_IPv6_ADDR        *p_addr_dest,
+                                                       NET_TCP_HDR          *p_tcp_hdr,
+                                                       CPU_INT32U            mtu);
+#endif
+#endif
+
 CPU_INT16U       NetTCP_RxAppData                     (NET_TCP_CONN_ID       conn_id_tcp,
                                                        void                 *pdata_buf,
                                                        CPU_INT16U            data_buf_len,
@@ -1969,7 +2821,9 @@ CPU_INT16U       NetTCP_RxAppData                     (NET_TCP_CONN_ID       con
 
 
                                                                                     /* ----------- TX FNCTS ----------- */
-void             NetTCP_TxConnReq                     (NET_TCP_CONN_ID       conn_id_tcp,
+CPU_INT16U       NetTCP_TxConnReq                     (NET_TCP_CONN_ID       conn_id_tcp,
+                                                       void                 *p_data,
+                                                       CPU_INT16U            data_len,
                                                        NET_ERR              *p_err);
 
 void             NetTCP_TxConnReqClose                (NET_TCP_CONN_ID       conn_id_tcp,
@@ -2049,6 +2903,24 @@ CPU_BOOLEAN      NetTCP_ConnCfgTxNagleEnHandler       (NET_TCP_CONN_ID
                                                        CPU_BOOLEAN                          nagle_en,
                                                        NET_ERR                             *p_err);
 
+#ifdef  NET_TCP_TX_CORK_MODULE_EN
+CPU_BOOLEAN      NetTCP_ConnCfgTxCorkEnHandler        (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                       CPU_BOOLEAN                          cork_en,
+                                                       NET_ERR                             *p_err);
+#endif
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+CPU_BOOLEAN      NetTCP_ConnCfgFastOpenEnHandler      (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                       CPU_BOOLEAN                          fast_open_en,
+                                                       NET_ERR                             *p_err);
+#endif
+
+#ifdef  NET_TCP_TX_PACE_MODULE_EN
+CPU_BOOLEAN      NetTCP_ConnCfgTxPaceRateHandler      (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                       NET_TCP_TX_PACE_RATE                 rate_max,
+                                                       NET_ERR                             *p_err);
+#endif
+
 CPU_BOOLEAN      NetTCP_ConnCfgTxAckDlyTimeoutHandler (NET_TCP_CONN_ID                      conn_id_tcp,
                                                        NET_TCP_TIMEOUT_MS                   timeout_ms,
                                                        NET_ERR                             *p_err);
@@ -2087,6 +2959,10 @@ CPU_BOOLEAN      NetTCP_ConnCfgMSL_TimeoutHandler     (NET_TCP_CONN_ID
 CPU_BOOLEAN      NetTCP_ConnIsUsed                    (NET_TCP_CONN_ID       conn_id_tcp,
                                                        NET_ERR              *p_err);
 
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+CPU_BOOLEAN      NetTCP_ConnTimeWaitIsUsed            (NET_CONN_ID           conn_id);
+#endif
+
 
 
                                                                                     /* --------- TCP Q FNCTS ---------- */
@@ -2203,6 +3079,75 @@ NET_TCP_SEQ_NBR  NetTCP_ConnFiveTupleSeqNbrGet        (NET_CONN             *p_c
 #endif
 
 
+#ifdef  NET_TCP_RX_WIN_AUTO_TUNE_MODULE_EN
+#if     (DEF_CHK_VAL(NET_TCP_DFLT_RX_WIN_AUTO_TUNE_MAX_OCTET, \
+                     NET_TCP_DFLT_RX_WIN_SIZE_OCTET,          \
+                     NET_TCP_WIN_SIZE_MAX) != DEF_OK)
+#error  "NET_TCP_DFLT_RX_WIN_AUTO_TUNE_MAX_OCTET   illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  >= NET_TCP_DFLT_RX_WIN_SIZE_OCTET]"
+#error  "                                         [     &&  <= NET_TCP_WIN_SIZE_MAX          ]"
+#endif
+#endif
+
+
+#ifdef  NET_TCP_SYN_CACHE_MODULE_EN
+#if     (NET_TCP_DFLT_SYN_CACHE_NBR_ENTRY < 1)
+#error  "NET_TCP_DFLT_SYN_CACHE_NBR_ENTRY          illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  >= 1]"
+#endif
+#endif
+
+
+#ifdef  NET_TCP_FAST_OPEN_MODULE_EN
+#if     (NET_TCP_DFLT_FAST_OPEN_CACHE_NBR_ENTRY < 1)
+#error  "NET_TCP_DFLT_FAST_OPEN_CACHE_NBR_ENTRY    illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  >= 1]"
+#endif
+#endif
+
+
+#ifdef  NET_TCP_PATH_MTU_MODULE_EN
+#if     (NET_TCP_DFLT_PATH_MTU_CACHE_NBR_ENTRY < 1)
+#error  "NET_TCP_DFLT_PATH_MTU_CACHE_NBR_ENTRY     illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  >= 1]"
+#endif
+
+#if     (DEF_CHK_VAL(NET_TCP_DFLT_PATH_MTU_TIMEOUT_SEC, \
+                     1,                                 \
+                     (DEF_INT_32U_MAX_VAL / DEF_TIME_NBR_mS_PER_SEC)) != DEF_OK)
+#error  "NET_TCP_DFLT_PATH_MTU_TIMEOUT_SEC         illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  >= 1                                          ]"
+#error  "                                         [     &&  <= DEF_INT_32U_MAX_VAL / DEF_TIME_NBR_mS_PER_SEC]"
+#endif
+#endif
+
+
+#ifdef  NET_TCP_TIME_WAIT_MODULE_EN
+#if     (NET_TCP_DFLT_TIME_WAIT_NBR_ENTRY < 1)
+#error  "NET_TCP_DFLT_TIME_WAIT_NBR_ENTRY          illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  >= 1]"
+#endif
+#endif
+
+
+#ifdef  NET_TCP_RE_TX_Q_IDX_MODULE_EN
+#if    ((NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY < 1) || \
+        (NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY > DEF_INT_16U_MAX_VAL))
+#error  "NET_TCP_DFLT_RE_TX_Q_IDX_NBR_ENTRY        illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  >= 1    ]"
+#error  "                                         [     &&  <= 65535]"
+#endif
+#endif
+
+
+#ifdef  NET_TCP_ISN_SIPHASH_MODULE_EN
+#if     (NET_TCP_DFLT_ISN_REKEY_TIME_SEC > NET_TCP_ISN_REKEY_TIME_MAX_SEC)
+#error  "NET_TCP_DFLT_ISN_REKEY_TIME_SEC           illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  <= NET_TCP_ISN_REKEY_TIME_MAX_SEC]"
+#endif
+#endif
+
+
 #ifndef  NET_TCP_DFLT_TIMEOUT_CONN_MAX_SEG_SEC
 #error  "NET_TCP_DFLT_TIMEOUT_CONN_MAX_SEG_SEC           not #define'd in 'net_cfg.h'                "
 #error  "                                         [MUST be  >= NET_TCP_CONN_TIMEOUT_MAX_SEG_MIN_SEC]"
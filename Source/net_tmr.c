@@ -68,6 +68,11 @@ static  NET_STAT_POOL   NetTmr_PoolStat;
 static  NET_TMR        *NetTmr_TaskListHead;               /* Ptr to head of Tmr Task List.                        */
 static  NET_TMR        *NetTmr_TaskListPtr;                /* Ptr to cur     Tmr Task List tmr to update.          */
 
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+static  NET_TMR        *NetTmr_HiResListHead;              /* Ptr to head of High-Res Tmr List.                    */
+static  NET_TMR_TICK    NetTmr_HiResTickCur;               /* Cur high-res tick.                                   */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -84,6 +89,15 @@ static  void  NetTmr_Task          (       void          *p_data);
 
 static  void  NetTmr_Clr           (       NET_TMR       *p_tmr);
 
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+static  void  NetTmr_HiResHandler  (       void);
+
+static  void  NetTmr_HiResListInsert(      NET_TMR       *p_tmr,
+                                           NET_TMR_TICK   time);
+
+static  void  NetTmr_HiResListRemove(      NET_TMR       *p_tmr);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -95,6 +109,7 @@ static  void  NetTmr_Clr           (       NET_TMR       *p_tmr);
 *                   (b) Initialize timer pool
 *                   (c) Initialize timer table
 *                   (d) Initialize timer task list pointer
+*                   (e) Initialize high-resolution timer list
 *
 *
 * Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
@@ -158,6 +173,12 @@ void  NetTmr_Init (const  NET_TASK_CFG  *p_tmr_task_cfg,
     NetTmr_TaskListHead = DEF_NULL;
     NetTmr_TaskListPtr  = DEF_NULL;
 
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+                                                                /* ------------- INIT HIGH-RES TMR LIST --------------- */
+    NetTmr_HiResListHead = DEF_NULL;
+    NetTmr_HiResTickCur  = 0u;
+#endif
+
 
    *p_err = NET_TMR_ERR_NONE;
 }
@@ -172,6 +193,7 @@ void  NetTmr_Init (const  NET_TASK_CFG  *p_tmr_task_cfg,
 *                   (a) Validate network timer/OS configuration :
 *
 *                       (1) OS ticker / Network Timer Task frequency
+*                       (2) OS ticker / high-resolution timer frequency, if enabled
 *
 *                   (b) Create Network Timer Task
 *
@@ -181,7 +203,8 @@ void  NetTmr_Init (const  NET_TASK_CFG  *p_tmr_task_cfg,
 *                               NET_TMR_ERR_NONE                    Network timer/OS initialization successful.
 *                               NET_TMR_ERR_INIT_TASK_INVALID_FREQ  Invalid OS ticker frequency configured; MUST
 *                                                                       be greater than (or equal to) configured
-*                                                                       network timer task frequency.
+*                                                                       network timer task frequency & high-
+*                                                                       resolution timer frequency.
 *                               NET_TMR_ERR_INIT_TASK_INVALID_ARG   Invalid argument to init timer task.
 *                               NET_ERR_FAULT_MEM_ALLOC             Error in memory allocation.
 *                               NET_ERR_FAULT_UNKNOWN_ERR           Unknown error code encounter.
@@ -212,6 +235,13 @@ static  void  NetTmr_TaskInit (const  NET_TASK_CFG  *p_tmr_task_cfg,
         return;
     }
 
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+    if (KAL_TickRate < NET_TMR_CFG_HI_RES_FREQ) {               /* If OS ticker frequency < high-res tmr   ...          */
+       *p_err = NET_TMR_ERR_INIT_TASK_INVALID_FREQ;             /* ... frequency, return error (see Note #1a2).         */
+        return;
+    }
+#endif
+
 
                                                                 /* ------------ CREATE NETWORK TIMER TASK ------------- */
     NetTmr_TaskHandle = KAL_TaskAlloc((const  CPU_CHAR *)NET_TMR_TASK_NAME,
@@ -293,22 +323,49 @@ static  void  NetTmr_TaskInit (const  NET_TASK_CFG  *p_tmr_task_cfg,
 *                   (a) Failure to delay timer task will prevent some network task(s)/operation(s) from
 *                       functioning correctly.  Thus, timer task is assumed to be successfully delayed
 *                       since NO error handling could be performed to counteract failure.
+*
+*               (4) If high-resolution timers are enabled, the timer task is scheduled at the
+*                   NET_TMR_CFG_HI_RES_FREQ rate instead :
+*
+*                   (a) NetTmr_HiResHandler() runs on every high-resolution tick.
+*
+*                   (b) NetTmr_TaskHandler()  runs on every NET_TMR_HI_RES_TASK_RATIO high-resolution
+*                       ticks so that the Timer Task List is still handled at NET_TMR_CFG_TASK_FREQ rate.
 *********************************************************************************************************
 */
 
 static  void  NetTmr_Task (void  *p_data)
 {
-    KAL_TICK  dly;
+    KAL_TICK     dly;
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+    CPU_INT32U   tick_ctr;
+#endif
 
 
    (void)&p_data;                                               /* Prevent 'variable unused' compiler warning.          */
 
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+    dly      = KAL_TickRate / NET_TMR_CFG_HI_RES_FREQ;          /* Delay task at NET_TMR_CFG_HI_RES_FREQ rate.          */
+    tick_ctr = 0u;
+
+    while (DEF_ON) {
+        KAL_DlyTick(dly, KAL_OPT_DLY_PERIODIC);
+        NetTmr_HiResHandler();                                  /* See Note #4a.                                        */
+
+        tick_ctr++;
+        if (tick_ctr >= NET_TMR_HI_RES_TASK_RATIO) {
+            tick_ctr = 0u;
+            NetTmr_TaskHandler();                               /* See Note #4b.                                        */
+        }
+    }
+#else
     dly = KAL_TickRate / NET_TMR_CFG_TASK_FREQ;                 /* Delay task at NET_TMR_CFG_TASK_FREQ rate.            */
 
     while (DEF_ON) {
         KAL_DlyTick(dly, KAL_OPT_DLY_PERIODIC);
         NetTmr_TaskHandler();
     }
+#endif
 }
 
 /*
@@ -640,6 +697,82 @@ NET_TMR  *NetTmr_Get (CPU_FNCT_PTR    fnct,
 }
 
 
+/*
+*********************************************************************************************************
+*                                          NetTmr_GetHiRes()
+*
+* Description : Allocate & initialize a high-resolution network timer.
+*
+* Argument(s) : fnct        Pointer to callback function to execute when timer expires (see Note #1).
+*
+*               obj         Pointer to object that requests a timer (MAY be NULL).
+*
+*               time        Initial timer value (in high-resolution ticks) [see Note #2].
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TMR_ERR_NONE                Network timer successfully allocated & initialized.
+*
+*                                                               - RETURNED BY NetTmr_Get() : -
+*                               NET_ERR_FAULT_NULL_FNCT         Argument 'fnct' passed a NULL pointer.
+*                               NET_TMR_ERR_NONE_AVAIL          NO available timers to allocate.
+*                               NET_TMR_ERR_IN_USE              Network timer already in use.
+*
+* Return(s)   : Pointer to network timer, if NO error(s).
+*
+*               Pointer to NULL,          otherwise.
+*
+* Caller(s)   : various.
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) See 'NetTmr_Get()  Note #3'.
+*
+*               (2) (a) High-resolution timers are allocated from the same timer pool as all other network
+*                       timers but are kept in the High-Resolution Timer List, ordered by expiration tick,
+*                       & are handled at NET_TMR_CFG_HI_RES_FREQ rate.
+*
+*                   (b) Timer values are in NET_TMR_HI_RES_TICK_PER_SEC ticks.  Subsequent NetTmr_Set()
+*                       calls on a high-resolution timer also use high-resolution ticks.
+*
+*                   (c) Timer value of 0 ticks allowed; next high-resolution tick will expire timer.
+*
+*                   See also 'NetTmr_HiResHandler()  Note #2'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+NET_TMR  *NetTmr_GetHiRes (CPU_FNCT_PTR    fnct,
+                           void           *obj,
+                           NET_TMR_TICK    time,
+                           NET_ERR        *p_err)
+{
+    NET_TMR  *p_tmr;
+    CPU_SR_ALLOC();
+
+                                                                /* ------------------ GET & INIT TMR ------------------ */
+    p_tmr = NetTmr_Get(fnct, obj, time, p_err);
+    if (*p_err != NET_TMR_ERR_NONE) {
+        return (DEF_NULL);
+    }
+
+    CPU_CRITICAL_ENTER();
+                                                                /* -- MOVE TMR FROM TMR TASK LIST TO HI-RES TMR LIST -- */
+    NetTmr_TaskListHead = p_tmr->NextPtr;                       /* Tmr inserted @ Tmr Task List head by NetTmr_Get().   */
+    if (NetTmr_TaskListHead != DEF_NULL) {
+        NetTmr_TaskListHead->PrevPtr = DEF_NULL;
+    }
+
+    DEF_BIT_SET(p_tmr->Flags, NET_TMR_FLAG_HI_RES);
+    NetTmr_HiResListInsert(p_tmr, time);
+    CPU_CRITICAL_EXIT();
+
+    return (p_tmr);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                            NetTmr_Free()
@@ -712,11 +845,23 @@ void  NetTmr_Free (NET_TMR  *p_tmr)
         NetTmr_TaskListPtr  = p_tmr_next;                       /* ... adv Tmr Task ptr to skip this tmr (see Note #3a).*/
     }
 
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+    if (DEF_BIT_IS_SET(p_tmr->Flags, NET_TMR_FLAG_HI_RES) == DEF_YES) {
+        NetTmr_HiResListRemove(p_tmr);                          /* Remove high-res tmr from High-Res Tmr List.          */
+        DEF_BIT_CLR(p_tmr->Flags, NET_TMR_FLAG_HI_RES);
+        p_tmr_prev = DEF_NULL;
+        p_tmr_next = DEF_NULL;
+    } else {
+        p_tmr_prev = p_tmr->PrevPtr;
+        p_tmr_next = p_tmr->NextPtr;
+    }
+#else
     p_tmr_prev = p_tmr->PrevPtr;
     p_tmr_next = p_tmr->NextPtr;
+#endif
     if (p_tmr_prev != DEF_NULL) {                               /* If tmr is NOT    the head of Tmr Task List, ...      */
         p_tmr_prev->NextPtr  = p_tmr_next;                      /* ...  set prev tmr to skip tmr.                       */
-    } else {                                                    /* Else set next tmr as head of Tmr Task List.          */
+    } else if (p_tmr == NetTmr_TaskListHead) {                  /* Else set next tmr as head of Tmr Task List.          */
         NetTmr_TaskListHead = p_tmr_next;
 
         if (p_tmr_next != DEF_NULL) {                           /* Clear the new head's prev tmr.                       */
@@ -803,6 +948,9 @@ void  NetTmr_Free (NET_TMR  *p_tmr)
 *               (3) Timer value of 0 ticks/seconds allowed; next tick will expire timer.
 *
 *                   See also 'NetTmr_TaskHandler()  Note #7'.
+*
+*               (4) High-resolution timers are re-inserted into the High-Resolution Timer List at their
+*                   new expiration tick (see 'NetTmr_GetHiRes()  Note #2b').
 *********************************************************************************************************
 */
 
@@ -838,7 +986,16 @@ void  NetTmr_Set (NET_TMR       *p_tmr,
     }
 
     p_tmr->Fnct   = fnct;
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+    if (DEF_BIT_IS_SET(p_tmr->Flags, NET_TMR_FLAG_HI_RES) == DEF_YES) {
+        NetTmr_HiResListRemove(p_tmr);                          /* Re-insert high-res tmr (see Note #4).                */
+        NetTmr_HiResListInsert(p_tmr, time);
+    } else {
+        p_tmr->TmrVal = time;
+    }
+#else
     p_tmr->TmrVal = time;
+#endif
 
     CPU_CRITICAL_EXIT();
 
@@ -976,4 +1133,197 @@ static  void  NetTmr_Clr (NET_TMR  *p_tmr)
     p_tmr->Obj     = DEF_NULL;
     p_tmr->Fnct    = DEF_NULL;
     p_tmr->TmrVal  = NET_TMR_TIME_0S;
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+    p_tmr->Flags   = NET_TMR_FLAG_NONE;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetTmr_HiResHandler()
+*
+* Description : (1) Handle network timers in the High-Resolution Timer List :
+*
+*                   (a) Advance high-resolution tick
+*                   (b) Acquire network lock, if any timer expired                      See Note #2
+*                   (c) Free & execute callback function of each expired timer          See Note #4
+*                   (d) Release network lock
+*
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTmr_Task().
+*
+* Note(s)     : (2) The High-Resolution Timer List is ordered by expiration tick so that only the head of
+*                   the list needs to be checked on each high-resolution tick.  The network lock is NOT
+*                   acquired unless the head timer has expired.
+*
+*               (3) Since NetTmr_HiResHandler() is asynchronous to ANY timer Get/Set, one additional tick
+*                   is added to each timer's expiration so that the requested timeout is ALWAYS satisfied
+*                   (see also 'NetTmr_TaskHandler()  Note #7').
+*
+*               (4) Expired timers are freed PRIOR to executing the timer callback function & are always
+*                   removed from the head of the High-Resolution Timer List.  Therefore, timers freed or
+*                   inserted by timer callback functions do NOT corrupt the list handling.
+*
+*                   See also 'NetTmr_TaskHandler()  Note #8'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+static  void  NetTmr_HiResHandler (void)
+{
+    NET_TMR       *p_tmr;
+    void          *obj;
+    CPU_FNCT_PTR   fnct;
+    NET_ERR        err;
+    CPU_SR_ALLOC();
+
+
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, ...                            */
+        Net_InitCompWait(&err);                                 /* ... wait on net init.                                */
+        if (err != NET_ERR_NONE) {
+            return;
+        }
+    }
+
+                                                                /* ---------------- ADV HI-RES TICK ------------------- */
+    CPU_CRITICAL_ENTER();
+    NetTmr_HiResTickCur++;
+    p_tmr = NetTmr_HiResListHead;
+    if ((p_tmr == DEF_NULL) ||                                  /* If NO tmr expired, rtn w/o net lock (see Note #2).   */
+        ((CPU_INT32S)(NetTmr_HiResTickCur - p_tmr->TmrVal) <= 0)) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+    CPU_CRITICAL_EXIT();
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetTmr_HiResHandler, &err);
+    if (err != NET_ERR_NONE) {
+        return;                                                 /* Could not acquire the Global Network Lock.           */
+    }
+
+                                                                /* ------------ HANDLE HI-RES TMR LIST ---------------- */
+    CPU_CRITICAL_ENTER();
+    p_tmr = NetTmr_HiResListHead;
+    while ((p_tmr != DEF_NULL) &&                               /* Handle expired tmrs (see Note #3).                   */
+           ((CPU_INT32S)(NetTmr_HiResTickCur - p_tmr->TmrVal) > 0)) {
+
+        obj  = p_tmr->Obj;                                      /* Get obj for ...                                      */
+        fnct = p_tmr->Fnct;                                     /* ... tmr callback fnct.                               */
+
+        NetTmr_Free(p_tmr);                                     /* ... free tmr (see Note #4); ...                      */
+
+        CPU_CRITICAL_EXIT();
+        if (fnct != DEF_NULL) {                                 /* ... & if avail,             ...                      */
+            fnct(obj);                                          /* ... exec tmr callback fnct.                          */
+        }
+        CPU_CRITICAL_ENTER();
+
+        p_tmr = NetTmr_HiResListHead;
+    }
+    CPU_CRITICAL_EXIT();
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetTmr_HiResListInsert()
+*
+* Description : Insert a network timer into the High-Resolution Timer List, ordered by expiration tick.
+*
+* Argument(s) : p_tmr       Pointer to a network timer.
+*               ----        Argument validated in caller(s).
+*
+*               time        Timer value (in high-resolution ticks).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTmr_GetHiRes(),
+*               NetTmr_Set().
+*
+* Note(s)     : (1) MUST be called with critical section entered.
+*
+*               (2) Timers with equal expiration ticks are kept in insertion order.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+static  void  NetTmr_HiResListInsert (NET_TMR       *p_tmr,
+                                      NET_TMR_TICK   time)
+{
+    NET_TMR  *p_tmr_prev;
+    NET_TMR  *p_tmr_next;
+
+
+    p_tmr->TmrVal = NetTmr_HiResTickCur + time;                 /* Set tmr expiration tick.                             */
+
+    p_tmr_prev    = DEF_NULL;
+    p_tmr_next    = NetTmr_HiResListHead;
+    while ((p_tmr_next != DEF_NULL) &&                          /* Find first tmr expiring after tmr (see Note #2).     */
+           ((CPU_INT32S)(p_tmr_next->TmrVal - p_tmr->TmrVal) <= 0)) {
+        p_tmr_prev = p_tmr_next;
+        p_tmr_next = p_tmr_next->NextPtr;
+    }
+
+    p_tmr->PrevPtr = p_tmr_prev;
+    p_tmr->NextPtr = p_tmr_next;
+    if (p_tmr_prev != DEF_NULL) {
+        p_tmr_prev->NextPtr  = p_tmr;
+    } else {
+        NetTmr_HiResListHead = p_tmr;
+    }
+    if (p_tmr_next != DEF_NULL) {
+        p_tmr_next->PrevPtr  = p_tmr;
+    }
 }
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetTmr_HiResListRemove()
+*
+* Description : Remove a network timer from the High-Resolution Timer List.
+*
+* Argument(s) : p_tmr       Pointer to a network timer.
+*               ----        Argument validated in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTmr_Free(),
+*               NetTmr_Set().
+*
+* Note(s)     : (1) MUST be called with critical section entered.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+static  void  NetTmr_HiResListRemove (NET_TMR  *p_tmr)
+{
+    NET_TMR  *p_tmr_prev;
+    NET_TMR  *p_tmr_next;
+
+
+    p_tmr_prev = p_tmr->PrevPtr;
+    p_tmr_next = p_tmr->NextPtr;
+    if (p_tmr_prev != DEF_NULL) {
+        p_tmr_prev->NextPtr  = p_tmr_next;
+    } else {
+        NetTmr_HiResListHead = p_tmr_next;
+    }
+    if (p_tmr_next != DEF_NULL) {
+        p_tmr_next->PrevPtr  = p_tmr_prev;
+    }
+
+    p_tmr->PrevPtr = DEF_NULL;
+    p_tmr->NextPtr = DEF_NULL;
+}
+#endif
@@ -85,6 +85,27 @@
 #define  NET_TMR_TASK_PERIOD_nS     (DEF_TIME_NBR_nS_PER_SEC  /  NET_TMR_CFG_TASK_FREQ)
 
 
+/*
+*********************************************************************************************************
+*                            NETWORK HIGH-RESOLUTION TIMER TIME DEFINES
+*
+* Note(s) : (1) High-resolution timer time constants based on NET_TMR_CFG_HI_RES_FREQ, the frequency at
+*               which NetTmr_Task() handles the High-Resolution Timer List (see 'net_tmr.c  NetTmr_Task()
+*               Note #4').
+*
+*           (2) NET_TMR_HI_RES_TASK_RATIO is the number of high-resolution timer ticks per Timer Task tick.
+*********************************************************************************************************
+*/
+
+#ifdef   NET_TMR_HI_RES_MODULE_EN
+#define  NET_TMR_HI_RES_TICK_PER_SEC                     NET_TMR_CFG_HI_RES_FREQ
+
+#define  NET_TMR_HI_RES_PERIOD_mS   (DEF_TIME_NBR_mS_PER_SEC  /  NET_TMR_CFG_HI_RES_FREQ)
+
+#define  NET_TMR_HI_RES_TASK_RATIO  (NET_TMR_CFG_HI_RES_FREQ  /  NET_TMR_CFG_TASK_FREQ)
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -129,6 +150,9 @@ typedef  CPU_INT32U    NET_TMR_TICK;
 
 typedef  NET_FLAGS  NET_TMR_FLAGS;
 
+#define  NET_TMR_FLAG_NONE                        DEF_BIT_NONE
+#define  NET_TMR_FLAG_HI_RES                      DEF_BIT_00    /* Tmr in High-Resolution Timer List.                   */
+
 
 /*
 *********************************************************************************************************
@@ -163,6 +187,10 @@ struct  net_tmr {
     CPU_FNCT_PTR    Fnct;                                       /* Ptr to fnct used on obj when TMR expires.            */
 
     NET_TMR_TICK    TmrVal;                                     /* Cur tmr val (in NET_TMR_TICK ticks).                 */
+
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+    NET_TMR_FLAGS   Flags;                                      /* Tmr flags.                                           */
+#endif
 };
 
 
@@ -217,6 +245,13 @@ NET_TMR        *NetTmr_Get                 (      CPU_FNCT_PTR    fnct,
                                                   NET_TMR_TICK    time,
                                                   NET_ERR        *p_err);
 
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+NET_TMR        *NetTmr_GetHiRes            (      CPU_FNCT_PTR    fnct,
+                                                  void           *obj,
+                                                  NET_TMR_TICK    time,
+                                                  NET_ERR        *p_err);
+#endif
+
 void            NetTmr_Free                (      NET_TMR        *p_tmr);
 
 
@@ -269,6 +304,20 @@ void            NetTmr_Set                 (      NET_TMR        *p_tmr,
 #endif
 
 
+
+
+#ifdef  NET_TMR_HI_RES_MODULE_EN
+#if     ((NET_TMR_CFG_HI_RES_FREQ <  NET_TMR_CFG_TASK_FREQ) || \
+         (NET_TMR_CFG_HI_RES_FREQ >  DEF_TIME_NBR_mS_PER_SEC) || \
+        ((NET_TMR_CFG_HI_RES_FREQ %  NET_TMR_CFG_TASK_FREQ) != 0))
+#error  "NET_TMR_CFG_HI_RES_FREQ      illegally #define'd in 'net_cfg.h'         "
+#error  "                       [MUST be  >= NET_TMR_CFG_TASK_FREQ]               "
+#error  "                       [     &&  <= 1000 Hz]                            "
+#error  "                       [     &&  multiple of NET_TMR_CFG_TASK_FREQ]     "
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
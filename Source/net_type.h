@@ -404,7 +404,7 @@ typedef  CPU_INT16U  NET_TCP_HDR_FLAGS;
 */
 
                                                                 /* See Note #1.                                         */
-typedef  CPU_INT16U  NET_TCP_WIN_SIZE;
+typedef  CPU_INT32U  NET_TCP_WIN_SIZE;
 
 /*
 *********************************************************************************************************
@@ -364,6 +364,8 @@ void  NetUDP_Rx (NET_BUF  *p_buf,
 *                                       NET_UDP_FLAG_RX_DATA_PEEK       Receive UDP application data without consuming
 *                                                                           the data; i.e. do NOT free any UDP receive
 *                                                                           packet buffer(s).
+*                                       NET_UDP_FLAG_RX_DATA_VEC        Receive UDP application data into a data
+*                                                                           vector cursor (see Note #11).
 *
 *               pip_opts_buf        Pointer to buffer to receive possible IP options (see Note #6a), if NO error(s).
 *
@@ -459,6 +461,11 @@ void  NetUDP_Rx (NET_BUF  *p_buf,
 *                       via NetUDP_RxAppData().
 *
 *              (10) IP options arguments may NOT be necessary.
+*
+*              (11) If NET_UDP_FLAG_RX_DATA_VEC is set, 'pdata_buf' points to a data vector cursor (see
+*                   'net_buf.h  NETWORK BUFFER DATA VECTOR DATA TYPES') & 'data_buf_len' is the total length
+*                   of the data vector; the application data is scattered directly from the packet buffer(s)
+*                   into the data vector's application buffers.
 *********************************************************************************************************
 */
 
@@ -545,7 +552,8 @@ CPU_INT16U  NetUDP_RxAppData (NET_BUF        *p_buf,
 
                                                                 /* ---------------- VALIDATE RX FLAGS ----------------- */
     flag_mask = NET_UDP_FLAG_NONE        |
-                NET_UDP_FLAG_RX_DATA_PEEK;
+                NET_UDP_FLAG_RX_DATA_PEEK |
+                NET_UDP_FLAG_RX_DATA_VEC;
                                                                 /* If any invalid flags req'd, rtn err (see Note #5).   */
     if ((flags & (NET_UDP_FLAGS)~flag_mask) != NET_UDP_FLAG_NONE) {
         NET_CTR_ERR_INC(Net_ErrCtrs.UDP.InvalidFlagsCtr);
@@ -604,17 +612,25 @@ CPU_INT16U  NetUDP_RxAppData (NET_BUF        *p_buf,
             err_rtn      =  NET_UDP_ERR_INVALID_DATA_SIZE;      /* ... & rtn data size err code (see Note #4b).         */
         }
 
-        NetBuf_DataRd(p_buf,
-                      p_buf_hdr->DataIx,
-                      data_len_pkt,
-                      p_data,
-                     &err);
+        if (DEF_BIT_IS_SET(flags, NET_UDP_FLAG_RX_DATA_VEC) == DEF_YES) {
+            NetBuf_DataRdVec(p_buf,                             /* See Note #11.                                        */
+                             p_buf_hdr->DataIx,
+                             data_len_pkt,
+                             (NET_BUF_DATA_VEC_CURSOR *)pdata_buf,
+                            &err);
+        } else {
+            NetBuf_DataRd(p_buf,
+                          p_buf_hdr->DataIx,
+                          data_len_pkt,
+                          p_data,
+                         &err);
+            p_data += data_len_pkt;                             /* MUST NOT cast ptr operand (see Note #8b).            */
+        }
         if (err != NET_BUF_ERR_NONE) {                          /* See Note #9a.                                        */
             NetUDP_RxPktDiscard(p_buf_head, p_err);
             return (0u);
         }
-                                                                /* Update data ptr & lens.                              */
-        p_data           +=             data_len_pkt;           /* MUST NOT cast ptr operand (see Note #8b).            */
+                                                                /* Update data lens.                                    */
         data_len_tot     += (CPU_INT16U)data_len_pkt;
         data_len_buf_rem -= (CPU_INT16U)data_len_pkt;
 
@@ -1054,6 +1070,10 @@ exit_lock_fault:
 *
 *                               NET_UDP_FLAG_NONE               No UDP  transmit flags selected.
 *                               NET_UDP_FLAG_TX_CHK_SUM_DIS     DISABLE transmit check-sums.
+*                               NET_UDP_FLAG_TX_DATA_VEC        Transmit UDP application data from a data
+*                                                                   vector cursor (see Note #7).
+*                               NET_UDP_FLAG_TX_DATA_EXT        Transmit UDP application data by reference
+*                                                                   from an external data cursor (see Note #8).
 *                               NET_UDP_FLAG_TX_BLOCK           Transmit UDP application data with blocking,
 *                                                                   if flag set; without blocking, if clear
 *                                                                   (see Note #4a).
@@ -1150,6 +1170,16 @@ exit_lock_fault:
 *                   (b) 'data_len' of 0 octets NOT allowed.
 *
 *               (6) On ANY transmit error, any remaining application data transmit is immediately aborted.
+*
+*               (7) If NET_UDP_FLAG_TX_DATA_VEC is set, 'p_data' points to a data vector cursor (see
+*                   'net_buf.h  NETWORK BUFFER DATA VECTOR DATA TYPES') & the application data is gathered
+*                   directly from the data vector into the transmit buffer.  The flag is cleared before the
+*                   datagram is handed to the UDP transmit handler.
+*
+*               (8) If NET_UDP_FLAG_TX_DATA_EXT is set, 'p_data' points to an external data cursor (see
+*                   'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES') & the transmit buffer
+*                   references the application data in place instead of copying it.  The flag is cleared
+*                   before the datagram is handed to the UDP transmit handler.
 *********************************************************************************************************
 */
 #ifdef  NET_IPv4_MODULE_EN
@@ -1273,11 +1303,29 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
     }
 
     data_ix_pkt += data_ix_pkt_offset;
-    NetBuf_DataWr(p_buf,                           /* Wr app data into app data tx buf.                    */
-                  data_ix_pkt,
-                  data_len_pkt,
-                  p_data_pkt,
-                  p_err);
+    if (DEF_BIT_IS_SET(flags_udp, NET_UDP_FLAG_TX_DATA_VEC) == DEF_YES) {
+        NetBuf_DataWrVec(p_buf,                                 /* Wr app data vec into app data tx buf (see Note #7).  */
+                         data_ix_pkt,
+                         data_len_pkt,
+                         (NET_BUF_DATA_VEC_CURSOR *)p_data,
+                         p_err);
+        DEF_BIT_CLR(flags_udp, NET_UDP_FLAG_TX_DATA_VEC);
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+    } else if (DEF_BIT_IS_SET(flags_udp, NET_UDP_FLAG_TX_DATA_EXT) == DEF_YES) {
+        NetBuf_DataExtSet(p_buf,                                /* Ref ext app data from tx buf (see Note #8).          */
+                          data_ix_pkt,
+                          data_len_pkt,
+                          (NET_BUF_DATA_EXT_CURSOR *)p_data,
+                          p_err);
+        DEF_BIT_CLR(flags_udp, NET_UDP_FLAG_TX_DATA_EXT);
+#endif
+    } else {
+        NetBuf_DataWr(p_buf,                                    /* Wr app data into app data tx buf.                    */
+                      data_ix_pkt,
+                      data_len_pkt,
+                      p_data_pkt,
+                      p_err);
+    }
     if (*p_err != NET_BUF_ERR_NONE) {
          NetUDP_TxPktDiscard(p_buf, &err);
          return (data_len_tot);
@@ -1360,6 +1408,10 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
 *
 *                               NET_UDP_FLAG_NONE               No UDP  transmit flags selected.
 *                               NET_UDP_FLAG_TX_CHK_SUM_DIS     DISABLE transmit check-sums.
+*                               NET_UDP_FLAG_TX_DATA_VEC        Transmit UDP application data from a data
+*                                                                   vector cursor (see Note #7).
+*                               NET_UDP_FLAG_TX_DATA_EXT        Transmit UDP application data by reference
+*                                                                   from an external data cursor (see Note #8).
 *                               NET_UDP_FLAG_TX_BLOCK           Transmit UDP application data with blocking,
 *                                                                   if flag set; without blocking, if clear
 *                                                                   (see Note #4a).
@@ -1456,6 +1508,16 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
 *                   (b) 'data_len' of 0 octets NOT allowed.
 *
 *               (6) On ANY transmit error, any remaining application data transmit is immediately aborted.
+*
+*               (7) If NET_UDP_FLAG_TX_DATA_VEC is set, 'p_data' points to a data vector cursor (see
+*                   'net_buf.h  NETWORK BUFFER DATA VECTOR DATA TYPES') & the application data is gathered
+*                   directly from the data vector into the transmit buffer.  The flag is cleared before the
+*                   datagram is handed to the UDP transmit handler.
+*
+*               (8) If NET_UDP_FLAG_TX_DATA_EXT is set, 'p_data' points to an external data cursor (see
+*                   'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES') & the transmit buffer
+*                   references the application data in place instead of copying it.  The flag is cleared
+*                   before the datagram is handed to the UDP transmit handler.
 *********************************************************************************************************
 */
 #ifdef  NET_IPv6_MODULE_EN
@@ -1568,11 +1630,29 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
     }
 
     data_ix_pkt += data_ix_pkt_offset;
-    NetBuf_DataWr((NET_BUF    *)p_buf,                           /* Wr app data into app data tx buf.                    */
-                  (NET_BUF_SIZE)data_ix_pkt,
-                  (NET_BUF_SIZE)data_len_pkt,
-                  (CPU_INT08U *)p_data_pkt,
-                  (NET_ERR    *)p_err);
+    if (DEF_BIT_IS_SET(flags_udp, NET_UDP_FLAG_TX_DATA_VEC) == DEF_YES) {
+        NetBuf_DataWrVec((NET_BUF                 *)p_buf,      /* Wr app data vec into app data tx buf (see Note #7).  */
+                         (NET_BUF_SIZE             )data_ix_pkt,
+                         (NET_BUF_SIZE             )data_len_pkt,
+                         (NET_BUF_DATA_VEC_CURSOR *)p_data,
+                         (NET_ERR                 *)p_err);
+        DEF_BIT_CLR(flags_udp, NET_UDP_FLAG_TX_DATA_VEC);
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+    } else if (DEF_BIT_IS_SET(flags_udp, NET_UDP_FLAG_TX_DATA_EXT) == DEF_YES) {
+        NetBuf_DataExtSet((NET_BUF                 *)p_buf,     /* Ref ext app data from tx buf (see Note #8).          */
+                          (NET_BUF_SIZE             )data_ix_pkt,
+                          (NET_BUF_SIZE             )data_len_pkt,
+                          (NET_BUF_DATA_EXT_CURSOR *)p_data,
+                          (NET_ERR                 *)p_err);
+        DEF_BIT_CLR(flags_udp, NET_UDP_FLAG_TX_DATA_EXT);
+#endif
+    } else {
+        NetBuf_DataWr((NET_BUF    *)p_buf,                      /* Wr app data into app data tx buf.                    */
+                      (NET_BUF_SIZE)data_ix_pkt,
+                      (NET_BUF_SIZE)data_len_pkt,
+                      (CPU_INT08U *)p_data_pkt,
+                      (NET_ERR    *)p_err);
+    }
     if (*p_err != NET_BUF_ERR_NONE) {
          NetUDP_TxPktDiscard(p_buf, &err);
          return (data_len_tot);
@@ -154,11 +154,14 @@
 
                                                                 /* ------------------ UDP TX  FLAGS ------------------- */
 #define  NET_UDP_FLAG_TX_CHK_SUM_DIS              DEF_BIT_00    /* DISABLE tx        chk sums.                          */
+#define  NET_UDP_FLAG_TX_DATA_VEC                 DEF_BIT_01    /* Tx app data from data vec cursor.                    */
+#define  NET_UDP_FLAG_TX_DATA_EXT                 DEF_BIT_02    /* Tx app data by ref from ext data cursor.             */
 #define  NET_UDP_FLAG_TX_BLOCK                    DEF_BIT_07
 
                                                                 /* ------------------ UDP RX  FLAGS ------------------- */
 #define  NET_UDP_FLAG_RX_CHK_SUM_NONE_DISCARD     DEF_BIT_08    /* Discard rx'd NULL chk sum UDP datagrams.             */
 #define  NET_UDP_FLAG_RX_DATA_PEEK                DEF_BIT_09
+#define  NET_UDP_FLAG_RX_DATA_VEC                 DEF_BIT_10    /* Rx app data into data vec cursor.                    */
 #define  NET_UDP_FLAG_RX_BLOCK                    DEF_BIT_15
 
 
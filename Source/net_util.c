@@ -109,6 +109,17 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc       (void         *p_data,
                                                     CPU_BOOLEAN   last_pkt_buf,
                                                     CPU_INT08U   *psum_err);
 
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+static  CPU_INT32U  NetUtil_16BitSumDataExtCalc    (NET_BUF      *pbuf,
+                                                    CPU_INT16U    data_ix,
+                                                    CPU_INT16U    data_len,
+                                                    CPU_INT08U   *poctet_prev,
+                                                    CPU_INT08U   *poctet_last,
+                                                    CPU_BOOLEAN   prev_octet_valid,
+                                                    CPU_BOOLEAN   last_pkt_buf,
+                                                    CPU_INT08U   *psum_err);
+#endif
+
 static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc(void         *pdata_buf,
                                                     void         *ppseudo_hdr,
                                                     CPU_INT16U    pseudo_hdr_size,
@@ -1475,6 +1486,123 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
 }
 
 
+/*
+*********************************************************************************************************
+*                                    NetUtil_16BitSumDataExtCalc()
+*
+* Description : Calculate 16-bit sum on a zero-copy transmit packet buffer's data, including its referenced
+*               application data.
+*
+* Argument(s) : pbuf                Pointer to packet buffer.
+*               ----                Argument validated in NetUtil_16BitOnesCplSumDataCalc().
+*
+*               data_ix             Index  into packet buffer's DATA area of data to sum.
+*
+*               data_len            Length of   packet buffer's data to sum (in octets).
+*
+*               poctet_prev         Pointer to last octet from a previous packet buffer.
+*
+*               poctet_last         Pointer to variable that will receive the value of the last octet from
+*                                       the packet buffer.
+*
+*               prev_octet_valid    Indicate whether pointer to the last octet of the packet buffer is valid.
+*
+*               last_pkt_buf        Indicate whether the current packet buffer is the last packet buffer.
+*
+*               psum_err            Pointer to variable that will receive the error return code(s) from this
+*                                       function; see 'NetUtil_16BitSumDataCalc()  psum_err'.
+*
+* Return(s)   : 16-bit sum, if NO error(s).
+*
+*               0,          otherwise.
+*
+* Caller(s)   : NetUtil_16BitOnesCplSumDataCalc().
+*
+* Note(s)     : (1) The packet buffer's data is summed in up to three consecutive parts -- the DATA area
+*                   octets before the referenced data, the referenced application data & the DATA area
+*                   octets after the referenced data -- with the last octet of each odd-length part
+*                   prepended to the next part, exactly as between consecutive packet buffers.
+*
+*                   See also 'net_buf.h  NETWORK BUFFER EXTERNAL DATA REFERENCE DATA TYPES  Note #1a'.
+*
+*               (2) Referenced application data is always set within the transport data; i.e. after the
+*                   transport header & before any transport trailer octets.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+static  CPU_INT32U  NetUtil_16BitSumDataExtCalc (NET_BUF      *pbuf,
+                                                 CPU_INT16U    data_ix,
+                                                 CPU_INT16U    data_len,
+                                                 CPU_INT08U   *poctet_prev,
+                                                 CPU_INT08U   *poctet_last,
+                                                 CPU_BOOLEAN   prev_octet_valid,
+                                                 CPU_BOOLEAN   last_pkt_buf,
+                                                 CPU_INT08U   *psum_err)
+{
+    NET_BUF_HDR  *pbuf_hdr;
+    void         *p_part[3];
+    CPU_INT16U    part_len[3];
+    CPU_INT16U    part_ix;
+    CPU_INT16U    part_ix_last;
+    CPU_INT16U    ext_ix_end;
+    CPU_INT16U    data_ix_end;
+    CPU_INT32U    sum;
+    CPU_BOOLEAN   octet_last_valid;
+
+
+    pbuf_hdr    = &pbuf->Hdr;
+    ext_ix_end  =  pbuf_hdr->DataExtIx + pbuf_hdr->DataExtLen;
+    data_ix_end =  data_ix             + data_len;
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    if ((pbuf_hdr->DataExtIx < data_ix) ||                      /* If ref'd data NOT within data to sum, ...            */
+        (ext_ix_end          > data_ix_end)) {                  /* ... rtn err (see Note #2).                           */
+       *psum_err = NET_UTIL_16_BIT_SUM_ERR_NULL_SIZE;
+        return (0u);
+    }
+#endif
+                                                                /* Split data into parts (see Note #1).                 */
+    p_part[0]   = (void *)&pbuf->DataPtr[data_ix];
+    part_len[0] =  pbuf_hdr->DataExtIx - data_ix;
+    p_part[1]   = (void *) pbuf_hdr->DataExtPtr;
+    part_len[1] =  pbuf_hdr->DataExtLen;
+    p_part[2]   = (void *)&pbuf->DataPtr[ext_ix_end];
+    part_len[2] =  data_ix_end - ext_ix_end;
+
+    part_ix_last = (part_len[2] > 0u) ? 2u : 1u;
+    sum          =  0u;
+   *psum_err     =  NET_UTIL_16_BIT_SUM_ERR_NONE;
+
+    for (part_ix = 0u; part_ix <= part_ix_last; part_ix++) {
+        if (part_len[part_ix] < 1u) {
+            continue;
+        }
+
+        sum += NetUtil_16BitSumDataCalc((void       *)p_part[part_ix],
+                                        (CPU_INT16U  )part_len[part_ix],
+                                        (CPU_INT08U *)poctet_prev,
+                                        (CPU_INT08U *)poctet_last,
+                                        (CPU_BOOLEAN )prev_octet_valid,
+                                        (CPU_BOOLEAN )((part_ix == part_ix_last) ? last_pkt_buf : DEF_NO),
+                                        (CPU_INT08U *)psum_err);
+
+        if (part_ix != part_ix_last) {                          /* Prepend odd last octet to next part.                 */
+            octet_last_valid = DEF_BIT_IS_SET(*psum_err, NET_UTIL_16_BIT_SUM_ERR_LAST_OCTET);
+            if (octet_last_valid == DEF_YES) {
+               *poctet_prev      = *poctet_last;
+                prev_octet_valid =  DEF_YES;
+            } else {
+               *poctet_prev      =  0u;
+                prev_octet_valid =  DEF_NO;
+            }
+        }
+    }
+
+    return (sum);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                  NetUtil_16BitOnesCplSumDataCalc()
@@ -1539,6 +1667,9 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
 *
 *                   (b) ... the one's-complement sum MUST be converted to host-order but MUST NOT be re-
 *                       converted back to network-order (see 'NetUtil_16BitSumDataCalc()  Note #5c3').
+*
+*               (6) Zero-copy transmit packet buffers also sum their referenced application data; see
+*                   'NetUtil_16BitSumDataExtCalc()  Note #1'.
 *********************************************************************************************************
 */
 
@@ -1649,6 +1780,26 @@ static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc (void        *pdata_buf,
         p_data       = (void    *)&pbuf->DataPtr[data_ix];
         pbuf_next    = (NET_BUF *) pbuf_hdr->NextBufPtr;
         mem_buf_last = (pbuf_next == (NET_BUF *)0) ? DEF_YES : DEF_NO;
+#ifdef  NET_SOCK_TX_ZERO_COPY_MODULE_EN
+        if (pbuf_hdr->DataExtRefPtr != DEF_NULL) {                  /* If pkt buf refs app data (see Note #6), ...      */
+            sum_val  =  NetUtil_16BitSumDataExtCalc((NET_BUF    *) pbuf,
+                                                    (CPU_INT16U  ) data_ix,
+                                                    (CPU_INT16U  ) data_len,
+                                                    (CPU_INT08U *)&octet_prev,
+                                                    (CPU_INT08U *)&octet_last,
+                                                    (CPU_BOOLEAN ) octet_prev_valid,
+                                                    (CPU_BOOLEAN ) mem_buf_last,
+                                                    (CPU_INT08U *)&sum_err);
+        } else {                                                    /* ... else calc pkt buf's 16-bit sum.              */
+            sum_val  =  NetUtil_16BitSumDataCalc((void       *) p_data,
+                                                 (CPU_INT16U  ) data_len,
+                                                 (CPU_INT08U *)&octet_prev,
+                                                 (CPU_INT08U *)&octet_last,
+                                                 (CPU_BOOLEAN ) octet_prev_valid,
+                                                 (CPU_BOOLEAN ) mem_buf_last,
+                                                 (CPU_INT08U *)&sum_err);
+        }
+#else
                                                                     /* Calc pkt buf's 16-bit sum.                       */
         sum_val      =  NetUtil_16BitSumDataCalc((void       *) p_data,
                                                  (CPU_INT16U  ) data_len,
@@ -1657,6 +1808,7 @@ static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc (void        *pdata_buf,
                                                  (CPU_BOOLEAN ) octet_prev_valid,
                                                  (CPU_BOOLEAN ) mem_buf_last,
                                                  (CPU_INT08U *)&sum_err);
+#endif
 
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
         if (mem_buf_first == DEF_YES) {